@@ -1375,6 +1375,376 @@ FUNC(StatusType, OS_CODE) TryToGetSpinlock
 );
 
 
+/***********************************************************************************************************************
+ *  Os_GetSpinlockStatistics()
+ **********************************************************************************************************************/
+/*! \brief        Returns the contention statistics of a spinlock on the given core.
+ *  \details      The statistics are recorded, if OS_CFG_SPINLOCK_STATISTICS is enabled. They are recorded by the given
+ *                core while it holds the spinlock. If the spinlock is taken on the given core during the call, the
+ *                returned values may stem from different lock grants.
+ *
+ *  \param[in]    SpinlockId        The spinlock which shall be queried.
+ *  \param[in]    CoreID            The core which shall be queried.
+ *  \param[out]   Statistics        Contains the statistics of the spinlock on the given core.
+ *
+ *  \return       E_OK              No error.
+ *                E_OS_SYS_DISABLED Spinlock statistics are disabled in the configuration.
+ *                E_OS_ID           (EXTENDED status:) Invalid SpinlockID or CoreID.
+ *                E_OS_PARAM_POINTER (EXTENDED status:) Given pointer is NULL.
+ *                E_OS_ACCESS       (Service Protection:) The caller has no access to the spinlock.
+ *
+ *  \context      TASK|ISR2
+ *
+ *  \reentrant    TRUE
+ *  \synchronous  TRUE
+ *
+ *  \pre          Pre-Condition: None
+ **********************************************************************************************************************/
+FUNC(StatusType, OS_CODE) Os_GetSpinlockStatistics
+(
+  SpinlockIdType SpinlockId,
+  CoreIdType CoreID,
+  Os_SpinlockStatisticsRefType Statistics
+);
+
+
+/***********************************************************************************************************************
+ *  Os_GetTaskStateAsync()
+ **********************************************************************************************************************/
+/*! \brief        Starts the query of the state of a task without waiting for a foreign core.
+ *  \details      If the object belongs to the local core, the call is completed immediately. Otherwise the request
+ *                is sent to the owning core and the caller continues. The result is fetched by
+ *                \ref Os_GetAsyncCallResult(). If Mask is not 0, the given events are set for the calling task, once
+ *                the result is available. The handle must not be modified until the call is completed.
+ *
+ *  \param[in]    TaskID            The object which shall be queried.
+ *  \param[in]    Mask              Events to set for the calling task on completion. 0 for no notification.
+ *  \param[out]   Call              Handle of the call. The task state is stored in member State.
+ *
+ *  \return       E_OK              No error.
+ *                E_OS_ID           (EXTENDED status:) Invalid TaskID.
+ *                E_OS_CALLEVEL     (EXTENDED status:) Called from invalid context.
+ *                E_OS_PARAM_POINTER (EXTENDED status:) Given pointer is NULL.
+ *                E_OS_ACCESS       (Service Protection:) Caller has no access to the object or a notification is
+ *                                  requested by a caller, which is no extended task.
+ *                E_OS_DISABLEDINT  (Service Protection:) Caller is in interrupt API sequence.
+ *                E_OS_SYS_OVERFLOW The cross core request could not be sent, as no buffer is free.
+ *                E_OS_SYS_CALL_NOT_ALLOWED A notification is requested, which the owning core may not deliver.
+ *                E_OS_SYS_FUNCTION_UNAVAILABLE A notification is requested, which the calling core does not handle.
+ *
+ *  \context      TASK|ISR2
+ *
+ *  \reentrant    TRUE
+ *  \synchronous  TRUE
+ *
+ *  \pre          Pre-Condition: None
+ **********************************************************************************************************************/
+FUNC(StatusType, OS_CODE) Os_GetTaskStateAsync
+(
+  TaskType TaskID,
+  EventMaskType Mask,
+  Os_AsyncCallRefType Call
+);
+
+
+/***********************************************************************************************************************
+ *  Os_GetAlarmAsync()
+ **********************************************************************************************************************/
+/*! \brief        Starts the query of the relative ticks until an alarm expires without waiting for a foreign core.
+ *  \details      If the object belongs to the local core, the call is completed immediately. Otherwise the request
+ *                is sent to the owning core and the caller continues. The result is fetched by
+ *                \ref Os_GetAsyncCallResult(). If Mask is not 0, the given events are set for the calling task, once
+ *                the result is available. The handle must not be modified until the call is completed.
+ *
+ *  \param[in]    AlarmID           The object which shall be queried.
+ *  \param[in]    Mask              Events to set for the calling task on completion. 0 for no notification.
+ *  \param[out]   Call              Handle of the call. The relative ticks are stored in member Tick.
+ *
+ *  \return       E_OK              No error.
+ *                E_OS_NOFUNC       The alarm is not in use.
+ *                E_OS_ID           (EXTENDED status:) Invalid AlarmID.
+ *                E_OS_CALLEVEL     (EXTENDED status:) Called from invalid context.
+ *                E_OS_PARAM_POINTER (EXTENDED status:) Given pointer is NULL.
+ *                E_OS_ACCESS       (Service Protection:) Caller has no access to the object or a notification is
+ *                                  requested by a caller, which is no extended task.
+ *                E_OS_DISABLEDINT  (Service Protection:) Caller is in interrupt API sequence.
+ *                E_OS_SYS_OVERFLOW The cross core request could not be sent, as no buffer is free.
+ *                E_OS_SYS_CALL_NOT_ALLOWED A notification is requested, which the owning core may not deliver.
+ *                E_OS_SYS_FUNCTION_UNAVAILABLE A notification is requested, which the calling core does not handle.
+ *
+ *  \context      TASK|ISR2
+ *
+ *  \reentrant    TRUE
+ *  \synchronous  TRUE
+ *
+ *  \pre          Pre-Condition: None
+ **********************************************************************************************************************/
+FUNC(StatusType, OS_CODE) Os_GetAlarmAsync
+(
+  AlarmType AlarmID,
+  EventMaskType Mask,
+  Os_AsyncCallRefType Call
+);
+
+
+/***********************************************************************************************************************
+ *  Os_GetCounterValueAsync()
+ **********************************************************************************************************************/
+/*! \brief        Starts the query of the value of a counter without waiting for a foreign core.
+ *  \details      If the object belongs to the local core, the call is completed immediately. Otherwise the request
+ *                is sent to the owning core and the caller continues. The result is fetched by
+ *                \ref Os_GetAsyncCallResult(). If Mask is not 0, the given events are set for the calling task, once
+ *                the result is available. The handle must not be modified until the call is completed.
+ *
+ *  \param[in]    CounterID         The object which shall be queried.
+ *  \param[in]    Mask              Events to set for the calling task on completion. 0 for no notification.
+ *  \param[out]   Call              Handle of the call. The counter value is stored in member Tick.
+ *
+ *  \return       E_OK              No error.
+ *                E_OS_ID           (EXTENDED status:) Invalid CounterID.
+ *                E_OS_CALLEVEL     (EXTENDED status:) Called from invalid context.
+ *                E_OS_PARAM_POINTER (EXTENDED status:) Given pointer is NULL.
+ *                E_OS_ACCESS       (Service Protection:) Caller has no access to the object or a notification is
+ *                                  requested by a caller, which is no extended task.
+ *                E_OS_DISABLEDINT  (Service Protection:) Caller is in interrupt API sequence.
+ *                E_OS_SYS_OVERFLOW The cross core request could not be sent, as no buffer is free.
+ *                E_OS_SYS_CALL_NOT_ALLOWED A notification is requested, which the owning core may not deliver.
+ *                E_OS_SYS_FUNCTION_UNAVAILABLE A notification is requested, which the calling core does not handle.
+ *
+ *  \context      TASK|ISR2
+ *
+ *  \reentrant    TRUE
+ *  \synchronous  TRUE
+ *
+ *  \pre          Pre-Condition: None
+ **********************************************************************************************************************/
+FUNC(StatusType, OS_CODE) Os_GetCounterValueAsync
+(
+  CounterType CounterID,
+  EventMaskType Mask,
+  Os_AsyncCallRefType Call
+);
+
+
+/***********************************************************************************************************************
+ *  Os_GetAsyncCallResult()
+ **********************************************************************************************************************/
+/*! \brief        Fetches the result of an asynchronous call.
+ *  \details      If the call is completed, its result is stored in the handle and the return value of the queried
+ *                service is returned. A completed handle returns E_OK on further calls.
+ *                E_OS_SYS_CROSS_CORE_REQUESTED is no error and is not reported to the ErrorHook.
+ *                Calls which are not completed, when the caller terminates or is killed, are discarded.
+ *
+ *  \param[in,out] Call             Handle of the call, as set up by \ref Os_GetTaskStateAsync(),
+ *                                  \ref Os_GetAlarmAsync() or \ref Os_GetCounterValueAsync().
+ *
+ *  \return       E_OK              The call is completed.
+ *                E_OS_SYS_CROSS_CORE_REQUESTED The foreign core has not handled the call yet.
+ *                E_OS_NOFUNC       The handle does not refer to a call of the caller.
+ *                E_OS_PARAM_POINTER (EXTENDED status:) Given pointer is NULL.
+ *                other             The return value of the queried service.
+ *
+ *  \context      TASK|ISR2
+ *
+ *  \reentrant    TRUE
+ *  \synchronous  TRUE
+ *
+ *  \pre          The call has been started by the calling task or ISR.
+ **********************************************************************************************************************/
+FUNC(StatusType, OS_CODE) Os_GetAsyncCallResult
+(
+  Os_AsyncCallRefType Call
+);
+
+/***********************************************************************************************************************
+ *  Os_GetTaskAccounting()
+ **********************************************************************************************************************/
+/*! \brief        Returns the runtime accounting data of a task.
+ *  \details      The data is recorded, if OS_CFG_THREAD_ACCOUNTING is enabled. Times are given in ticks of the
+ *                accounting timer of the core the task is assigned to. The data is copied without synchronization
+ *                with that core, so the returned values may stem from different switch points, if the task is
+ *                running or being switched during the call.
+ *
+ *  \param[in]    TaskID            The task which shall be queried.
+ *  \param[out]   Accounting        Contains the runtime accounting data of the task.
+ *
+ *  \return       E_OK              No error.
+ *                E_OS_SYS_DISABLED Runtime accounting is disabled in the configuration.
+ *                E_OS_ID           (EXTENDED status:) Invalid TaskID.
+ *                E_OS_PARAM_POINTER (EXTENDED status:) Given pointer is NULL.
+ *
+ *  \context      TASK|ISR2
+ *
+ *  \reentrant    TRUE
+ *  \synchronous  TRUE
+ *
+ *  \pre          Pre-Condition: None
+ **********************************************************************************************************************/
+FUNC(StatusType, OS_CODE) Os_GetTaskAccounting
+(
+  TaskType TaskID,
+  Os_ThreadAccountingRefType Accounting
+);
+
+/***********************************************************************************************************************
+ *  Os_GetISRAccounting()
+ **********************************************************************************************************************/
+/*! \brief        Returns the runtime accounting data of a ISR.
+ *  \details      The data is recorded, if OS_CFG_THREAD_ACCOUNTING is enabled. Times are given in ticks of the
+ *                accounting timer of the core the ISR is assigned to. The data is copied without synchronization
+ *                with that core, so the returned values may stem from different switch points, if the ISR is
+ *                running or being switched during the call.
+ *
+ *  \param[in]    ISRID             The ISR which shall be queried.
+ *  \param[out]   Accounting        Contains the runtime accounting data of the ISR.
+ *
+ *  \return       E_OK              No error.
+ *                E_OS_SYS_DISABLED Runtime accounting is disabled in the configuration.
+ *                E_OS_ID           (EXTENDED status:) Invalid ISRID.
+ *                E_OS_PARAM_POINTER (EXTENDED status:) Given pointer is NULL.
+ *
+ *  \context      TASK|ISR2
+ *
+ *  \reentrant    TRUE
+ *  \synchronous  TRUE
+ *
+ *  \pre          Pre-Condition: None
+ **********************************************************************************************************************/
+FUNC(StatusType, OS_CODE) Os_GetISRAccounting
+(
+  ISRType ISRID,
+  Os_ThreadAccountingRefType Accounting
+);
+
+
+/***********************************************************************************************************************
+ *  Os_ScanStackUsage()
+ **********************************************************************************************************************/
+/*! \brief        Refines the stack usage high-water marks of all stacks of the local core.
+ *  \details      If OS_CFG_STACKMEASUREMENT_INCREMENTAL is enabled, the stack usage services return a cached
+ *                high-water mark per stack, which each query refines by checking at most
+ *                OS_CFG_STACKMEASUREMENT_CHUNK stack entries. This service performs such a step for every stack of
+ *                the calling core. Calling it periodically, e.g. from a diagnostic task, keeps the high-water marks
+ *                current at a constant cost per call.
+ *
+ *  \return       E_OK              No error.
+ *                E_OS_SYS_DISABLED Incremental stack usage measurement is disabled in the configuration.
+ *
+ *  \context      TASK|ISR2
+ *
+ *  \reentrant    TRUE
+ *  \synchronous  TRUE
+ *
+ *  \pre          Pre-Condition: None
+ **********************************************************************************************************************/
+FUNC(StatusType, OS_CODE) Os_ScanStackUsage
+(
+  void
+);
+
+
+/***********************************************************************************************************************
+ *  Os_GetNtfStackPoolStatistics()
+ **********************************************************************************************************************/
+/*! \brief        Returns the usage statistics of the stack pool of a non-trusted function.
+ *  \details      The statistics are recorded since StartOS(). Denials counts all calls of Os_CallNonTrustedFunction()
+ *                which failed with E_OS_SYS_NO_NTFSTACK, either because the pool was empty or because the calling
+ *                application had reached its limit. The stack pool is managed by the core which owns the
+ *                non-trusted function, so the service is only available on that core.
+ *
+ *  \param[in]    FunctionIndex     The non-trusted function which shall be queried.
+ *  \param[out]   Statistics        Contains the usage statistics of the stack pool.
+ *
+ *  \return       E_OK              No error.
+ *                E_OS_SERVICEID    No function defined for this index.
+ *                E_OS_ACCESS       (EXTENDED status:) The given object belongs to a foreign core.
+ *                E_OS_PARAM_POINTER (EXTENDED status:) Given pointer is NULL.
+ *
+ *  \context      TASK|ISR2
+ *
+ *  \reentrant    TRUE
+ *  \synchronous  TRUE
+ *
+ *  \pre          Pre-Condition: None
+ **********************************************************************************************************************/
+FUNC(StatusType, OS_CODE) Os_GetNtfStackPoolStatistics
+(
+  Os_NonTrustedFunctionIndexType FunctionIndex,
+  Os_NtfStackPoolStatisticsRefType Statistics
+);
+
+
+/***********************************************************************************************************************
+ *  Os_ActivateTaskSet()
+ **********************************************************************************************************************/
+/*! \brief        Activates all tasks of a configured task set at once.
+ *  \details      Each task of the set is activated as by ActivateTask(). The tasks of the local core are inserted
+ *                into the ready queues first and the scheduling decision is taken once, so the highest priority
+ *                task of the set starts (if it preempts the caller) after all tasks have been activated. Tasks of
+ *                foreign cores are activated asynchronously.
+ *
+ *                If the activation of a task fails, the remaining tasks are activated anyway. The error of the first
+ *                failed activation is returned. For a task of a foreign core only errors of sending the request are
+ *                returned. Errors of its activation (e.g. E_OS_LIMIT) are reported asynchronously to the ErrorHook
+ *                of the calling core, as for other asynchronous cross core requests.
+ *
+ *  \param[in]    TaskSetID         Reference to the task set.
+ *
+ *  \return       E_OK              No error.
+ *                E_OS_LIMIT        Too many task activations of at least one local task.
+ *                E_OS_ID           (EXTENDED status:) Invalid TaskSetID.
+ *                E_OS_CALLEVEL     (EXTENDED status:) Called from invalid context.
+ *                E_OS_DISABLEDINT  (Service Protection:) Caller is in interrupt API sequence.
+ *                E_OS_ACCESS       (Service Protection:) The caller has no access to all tasks of the set or the
+ *                                  owner application of a task is not accessible.
+ *                E_OS_SYS_OVERFLOW The cross core request of a task could not be sent, as no buffer is free.
+ *                E_OS_SYS_CALL_NOT_ALLOWED The caller may not send cross core requests to the core of a task.
+ *                E_OS_SYS_FUNCTION_UNAVAILABLE The core of a task does not handle task activations.
+ *
+ *  \context      TASK|ISR2
+ *
+ *  \reentrant    TRUE
+ *  \synchronous  TRUE, if all tasks of the set belong to the local core.
+ *
+ *  \pre          Pre-Condition: None
+ **********************************************************************************************************************/
+FUNC(StatusType, OS_CODE) Os_ActivateTaskSet
+(
+  Os_TaskSetIdType TaskSetID
+);
+
+
+/***********************************************************************************************************************
+ *  Os_GetMpSkippedSwitches()
+ **********************************************************************************************************************/
+/*! \brief        Returns the number of memory protection switches on the given core, which have been skipped.
+ *  \details      A switch counts as skipped, if it has not reprogrammed the application or the thread access rights
+ *                (or both), because the requested access rights were already active. Each switch is counted at most
+ *                once. The counter is recorded since StartOS() and wraps around on overflow.
+ *
+ *                In case of an error, the function simply returns 0. The following error information is only provided
+ *                in the ErrorHook:
+ *                E_OS_SYS_DISABLED Memory protection is disabled in the configuration.
+ *                E_OS_ID           (EXTENDED status:) Passed Core ID is not a valid ID.
+ *                E_OS_ID           (EXTENDED status:) CoreID is not a valid AUTOSAR core ID.
+ *
+ *  \param[in]    CoreID         The core which shall be queried.
+ *
+ *  \return       Number of skipped switches on the given core or zero.
+ *
+ *  \context      ANY
+ *
+ *  \reentrant    TRUE
+ *  \synchronous  TRUE
+ *
+ *  \pre          Pre-Condition: None
+ **********************************************************************************************************************/
+FUNC(uint32, OS_CODE) Os_GetMpSkippedSwitches
+(
+  CoreIdType CoreID
+);
+
+
 /***********************************************************************************************************************
  *  DisableAllInterrupts()
  **********************************************************************************************************************/
@@ -205,25 +205,15 @@ Os_AccessCheckTest,
   {
     result = OS_MEM_ACCESS_TYPE_NON;
   }
+  /* #20 Search the region by bisection, if the regions are sorted. */
+  else if(AccessRights->RegionsSorted != FALSE)
+  {
+    result = Os_AccessCheckSearchSorted(AccessRights, addressStart, addressEnd);                                        /* SBSW_OS_FC_PRECONDITION */
+  }
+  /* #30 Otherwise search the region linearly. */
   else
   {
-    Os_AccessCheckIdx_IteratorType idx;
-    P2CONST(Os_AccessCheckRegionConfigType, AUTOMATIC, OS_CONST) region;
-
-    result = OS_MEM_ACCESS_TYPE_NON;
-
-    /* #20 Search in the access right configuration for the correct region. */
-    for(idx = 0; idx < (Os_AccessCheckIdx_IteratorType) AccessRights->RegionCount; ++idx)
-    {
-      region = &(AccessRights->Regions[idx]);
-
-      /* #30 If such a region was found, set the return value to its access rights. */
-      if( (addressStart >= region->AddressStart) && (addressEnd <= region->AddressEnd) )
-      {
-        result = region->AccessRights;
-        break;
-      }
-    }
+    result = Os_AccessCheckSearchLinear(AccessRights, addressStart, addressEnd);                                        /* SBSW_OS_FC_PRECONDITION */
   }
 
   return result;
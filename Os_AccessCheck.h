@@ -83,6 +83,138 @@
 /***********************************************************************************************************************
  *  GLOBAL FUNCTIONS
  **********************************************************************************************************************/
+/***********************************************************************************************************************
+ *  Os_AccessCheckSearchLinear()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE AccessType, OS_CODE, OS_ALWAYS_INLINE,
+Os_AccessCheckSearchLinear,
+(
+  P2CONST(Os_AccessCheckConfigType, AUTOMATIC, OS_CONST) AccessRights,
+  Os_AccessCheckAddress AddressStart,
+  Os_AccessCheckAddress AddressEnd
+))
+{
+  AccessType result;
+  Os_AccessCheckIdx_IteratorType idx;
+  P2CONST(Os_AccessCheckRegionConfigType, AUTOMATIC, OS_CONST) region;
+
+  result = OS_MEM_ACCESS_TYPE_NON;
+
+  /* #10 Search in the access right configuration for the correct region. */
+  for(idx = 0; idx < (Os_AccessCheckIdx_IteratorType) AccessRights->RegionCount; ++idx)
+  {
+    region = &(AccessRights->Regions[idx]);
+
+    /* #20 If such a region was found, set the return value to its access rights. */
+    if( (AddressStart >= region->AddressStart) && (AddressEnd <= region->AddressEnd) )
+    {
+      result = region->AccessRights;
+      break;
+    }
+  }
+
+  return result;
+}
+
+
+/***********************************************************************************************************************
+ *  Os_AccessCheckSearchSorted()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE AccessType, OS_CODE, OS_ALWAYS_INLINE,
+Os_AccessCheckSearchSorted,
+(
+  P2CONST(Os_AccessCheckConfigType, AUTOMATIC, OS_CONST) AccessRights,
+  Os_AccessCheckAddress AddressStart,
+  Os_AccessCheckAddress AddressEnd
+))
+{
+  AccessType result;
+  Os_AccessCheckIdx_IteratorType low;
+  Os_AccessCheckIdx_IteratorType high;
+
+  result = OS_MEM_ACCESS_TYPE_NON;
+  low = 0;
+  high = (Os_AccessCheckIdx_IteratorType)AccessRights->RegionCount;
+
+  /* #10 Find the number of regions, which start at or before AddressStart. */
+  while(low < high)
+  {
+    Os_AccessCheckIdx_IteratorType middle;
+    middle = low + ((high - low) / 2u);
+
+    if(AccessRights->Regions[middle].AddressStart <= AddressStart)
+    {
+      low = middle + 1u;
+    }
+    else
+    {
+      high = middle;
+    }
+  }
+
+  /* #20 If the last of these regions contains the given range, set the return value to its access rights. */
+  if(low > 0u)
+  {
+    P2CONST(Os_AccessCheckRegionConfigType, AUTOMATIC, OS_CONST) region;
+    region = &(AccessRights->Regions[low - 1u]);
+
+    if(AddressEnd <= region->AddressEnd)
+    {
+      result = region->AccessRights;
+    }
+  }
+
+  return result;
+}
+
+
+/***********************************************************************************************************************
+ *  Os_AccessCheckIsSortingValid()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE Os_StdReturnType, OS_CODE, OS_ALWAYS_INLINE,
+Os_AccessCheckIsSortingValid,
+(
+  P2CONST(Os_AccessCheckConfigType, AUTOMATIC, OS_CONST) AccessRights
+))
+{
+  Os_StdReturnType result;
+  Os_AccessCheckIdx_IteratorType idx;
+
+  result = !0u;                                                                                                         /* PRQA S 4404, 4558 */ /* MD_Os_C90BooleanCompatibility, MD_Os_Rule10.1_4558 */
+
+  /* #10 If the regions are flagged as sorted, check that each region ends before the next one starts. */
+  if(AccessRights->RegionsSorted != FALSE)
+  {
+    for(idx = 1; idx < (Os_AccessCheckIdx_IteratorType)AccessRights->RegionCount; ++idx)
+    {
+      if(AccessRights->Regions[idx - 1u].AddressEnd >= AccessRights->Regions[idx].AddressStart)
+      {
+        result = 0u;
+        break;
+      }
+    }
+  }
+
+  return result;
+}
+
 
 
 # define OS_STOP_SEC_CODE
@@ -103,6 +103,12 @@ struct Os_AccessCheckConfigType_Tag
 
   /*! The number of configured regions */
   Os_AccessCheckIdx RegionCount;
+
+  /*! Whether the regions are sorted by ascending AddressStart and do not overlap (!FALSE) or not (FALSE).
+   *  The generator sets this flag, if it could sort and merge the regions without changing the result of a
+   *  linear search. Sorted regions are searched by bisection. Task and ISR initialization assert that sorted
+   *  regions do not overlap. */
+  boolean RegionsSorted;
 };
 
 
@@ -191,6 +197,93 @@ FUNC(AccessType, OS_CODE) Os_Api_CheckISRMemoryAccess
 );
 
 
+/***********************************************************************************************************************
+ *  Os_AccessCheckSearchLinear()
+ **********************************************************************************************************************/
+/*! \brief        Returns the access rights of the first region, which contains the given address range.
+ *  \details      The regions are searched in configuration order.
+ *
+ *  \param[in]    AccessRights        The access rights of the object to be checked. Parameter must not be NULL.
+ *  \param[in]    AddressStart        First address of the range to be checked.
+ *  \param[in]    AddressEnd          Last address of the range to be checked.
+ *
+ *  \return       Value which contains the access rights to the given memory region.
+ *  \retval       OS_MEM_ACCESS_TYPE_NON      No region contains the given range.
+ *
+ *  \context      OS_INTERNAL
+ *
+ *  \reentrant    TRUE
+ *  \synchronous  TRUE
+ *
+ *  \pre          AddressStart <= AddressEnd.
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE AccessType, OS_CODE, OS_ALWAYS_INLINE,
+Os_AccessCheckSearchLinear,
+(
+  P2CONST(Os_AccessCheckConfigType, AUTOMATIC, OS_CONST) AccessRights,
+  Os_AccessCheckAddress AddressStart,
+  Os_AccessCheckAddress AddressEnd
+));
+
+
+/***********************************************************************************************************************
+ *  Os_AccessCheckSearchSorted()
+ **********************************************************************************************************************/
+/*! \brief        Returns the access rights of the region, which contains the given address range.
+ *  \details      As the regions are sorted and do not overlap, only the last region starting at or before
+ *                AddressStart may contain the range. This region is found by bisection. The result is identical to
+ *                the one of \ref Os_AccessCheckSearchLinear().
+ *
+ *  \param[in]    AccessRights        The access rights of the object to be checked. Parameter must not be NULL.
+ *  \param[in]    AddressStart        First address of the range to be checked.
+ *  \param[in]    AddressEnd          Last address of the range to be checked.
+ *
+ *  \return       Value which contains the access rights to the given memory region.
+ *  \retval       OS_MEM_ACCESS_TYPE_NON      No region contains the given range.
+ *
+ *  \context      OS_INTERNAL
+ *
+ *  \reentrant    TRUE
+ *  \synchronous  TRUE
+ *
+ *  \pre          AddressStart <= AddressEnd.
+ *  \pre          AccessRights->RegionsSorted is not FALSE.
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE AccessType, OS_CODE, OS_ALWAYS_INLINE,
+Os_AccessCheckSearchSorted,
+(
+  P2CONST(Os_AccessCheckConfigType, AUTOMATIC, OS_CONST) AccessRights,
+  Os_AccessCheckAddress AddressStart,
+  Os_AccessCheckAddress AddressEnd
+));
+
+
+/***********************************************************************************************************************
+ *  Os_AccessCheckIsSortingValid()
+ **********************************************************************************************************************/
+/*! \brief        Returns whether the regions may be searched by bisection (!0) or not (0).
+ *  \details      Regions, which are not flagged as sorted, are always valid. Sorted regions are valid, if each of them
+ *                ends before the next one starts.
+ *
+ *  \param[in]    AccessRights        The access rights to be checked. Parameter must not be NULL.
+ *
+ *  \retval       !0    The regions are not flagged as sorted, or they are sorted and do not overlap.
+ *  \retval       0     The regions are flagged as sorted, but they are unsorted or overlap.
+ *
+ *  \context      OS_INTERNAL
+ *
+ *  \reentrant    TRUE
+ *  \synchronous  TRUE
+ *
+ *  \pre          -
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE Os_StdReturnType, OS_CODE, OS_ALWAYS_INLINE,
+Os_AccessCheckIsSortingValid,
+(
+  P2CONST(Os_AccessCheckConfigType, AUTOMATIC, OS_CONST) AccessRights
+));
+
+
 # define OS_STOP_SEC_CODE
 # include "Os_MemMap_OsCode.h"                                                                                          /* PRQA S 5087 */ /* MD_MSR_MemMap */
 
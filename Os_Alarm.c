@@ -1338,6 +1338,94 @@ FUNC(Os_StatusType, OS_CODE) Os_Api_GetAlarm
 }                                                                                                                       /* PRQA S 6050, 6080 */ /* MD_MSR_STCAL, MD_MSR_STMIF */
 
 
+/***********************************************************************************************************************
+ *  Os_Api_GetAlarmAsync()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ */
+FUNC(Os_StatusType, OS_CODE) Os_Api_GetAlarmAsync
+(
+  AlarmType AlarmID,
+  EventMaskType Mask,
+  Os_AsyncCallRefType Call
+)
+{
+  Os_StatusType status;
+  P2CONST(Os_ThreadConfigType, AUTOMATIC, OS_CONST) currentThread;
+
+  currentThread = Os_CoreGetThread();
+
+  /* #10 Perform error checks. */
+  if(OS_UNLIKELY(Os_AlarmCheckId(AlarmID) == OS_CHECK_FAILED ))
+  {
+    status = OS_STATUS_ID_1;
+  }
+  else if(OS_UNLIKELY(Os_ThreadCheckCallContext(                                                                        /* SBSW_OS_AL_THREADCHECKCALLCONTEXT_001 */
+                          currentThread, OS_APICONTEXT_GETALARM) == OS_CHECK_FAILED))
+  {
+    status = OS_STATUS_CALLEVEL;
+  }
+  else if(OS_UNLIKELY(Os_ThreadCheckAreInterruptsEnabled(                                                               /* SBSW_OS_AL_THREADCHECKAREINTERRUPTSENABLED_001 */
+                          currentThread) == OS_CHECK_FAILED))
+  {
+    status = OS_STATUS_DISABLEDINT;
+  }
+  else
+  {
+    P2CONST(Os_AlarmConfigType, AUTOMATIC, OS_CONST) me;
+
+    me = Os_AlarmId2Alarm(AlarmID);
+
+    if(OS_UNLIKELY(Os_AppCheckAccess( Os_ThreadGetCurrentApplication(currentThread),                                    /* SBSW_OS_AL_APPCHECKACCESS_001 */ /* SBSW_OS_AL_THREADGETCURRENTAPPLICATION_001 */ /* SBSW_OS_AL_ALARMGETACCESSINGAPPLICATIONS_001 */
+                                      Os_AlarmGetAccessingApplications(me))
+                                        == OS_CHECK_FAILED))
+    {
+      status = OS_STATUS_ACCESSRIGHTS_1;
+    }
+    else
+    {
+      status = Os_XSigCheckNotification(currentThread, Mask);                                                           /* SBSW_OS_AL_XSIGCHECKNOTIFICATION_001 */
+    }
+
+    if(status == OS_STATUS_OK)
+    {
+      P2CONST(Os_CoreAsrConfigType, AUTOMATIC, OS_CONST) targetCore;
+
+      targetCore = Os_JobGetCore(&(me->Job));                                                                           /* SBSW_OS_AL_JOBGETCORE_001 */
+
+      /* #20 If the given alarm belongs to the local core, get the alarm and complete the call immediately. */
+      if(OS_LIKELY(Os_CoreAsrIsCoreLocal(targetCore) != 0u))                                                            /* COV_OS_HALPLATFORMMULTICOREUNSUPPORTED */ /* SBSW_OS_AL_COREASRISCORELOCAL_001 */ /* PRQA S 2991, 2995 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule2.2_2995 */
+      {
+        Os_IntStateType intState;
+
+        Os_IntSuspend(&intState);                                                                                       /* SBSW_OS_FC_POINTER2LOCAL */
+
+        status = Os_AlarmGetAlarm(me, &(Call->Tick));                                                                   /* SBSW_OS_AL_ALARMGETALARM_002 */
+
+        Os_IntResume(&intState);                                                                                        /* SBSW_OS_FC_POINTER2LOCAL */
+
+        if(status == OS_STATUS_OK)
+        {
+          Os_XSigCompleteLocal(currentThread, Mask, Call);                                                              /* SBSW_OS_AL_XSIGCOMPLETELOCAL_001 */
+        }
+      }
+      /* #30 Otherwise, send the request to the foreign core without waiting for the result. */
+      else
+      {
+        status = Os_XSigSendRequest_GetAlarm(targetCore, currentThread, AlarmID, Mask, Call);                           /* SBSW_OS_AL_XSIGSEND_002 */
+      }
+    }
+  }
+
+  return status;
+}                                                                                                                       /* PRQA S 6050, 6080 */ /* MD_MSR_STCAL, MD_MSR_STMIF */
+
+
 /***********************************************************************************************************************
  *  Os_Api_SetRelAlarm()
  **********************************************************************************************************************/
@@ -1744,6 +1832,28 @@ FUNC(Os_StatusType, OS_CODE) Os_Api_CancelAlarm
  \COUNTERMEASURE \M [CM_OS_JOBGETCORE_M]
 
 
+\ID SBSW_OS_AL_XSIGCHECKNOTIFICATION_001
+ \DESCRIPTION    Os_XSigCheckNotification is called with the return value of Os_CoreGetThread.
+ \COUNTERMEASURE \N [CM_OS_COREGETTHREAD_N]
+
+\ID SBSW_OS_AL_ALARMGETALARM_002
+ \DESCRIPTION    Os_AlarmGetAlarm is called with the return value of Os_AlarmId2Alarm and a member of the call handle
+                 passed as argument to the caller function. Precondition ensures that the handle pointer is valid.
+                 The compliance of the precondition is check during review.
+ \COUNTERMEASURE \M [CM_OS_ALARMID2ALARM_M]
+
+\ID SBSW_OS_AL_XSIGCOMPLETELOCAL_001
+ \DESCRIPTION    Os_XSigCompleteLocal is called with the return value of Os_CoreGetThread and a call handle passed as
+                 argument to the caller function. Precondition ensures that the handle pointer is valid.
+                 The compliance of the precondition is check during review.
+ \COUNTERMEASURE \N [CM_OS_COREGETTHREAD_N]
+
+\ID SBSW_OS_AL_XSIGSEND_002
+ \DESCRIPTION    A cross core request function is called, with the return values of Os_JobGetCore() and
+                 Os_CoreGetThread() and a call handle passed as argument to the caller function. Correctness of
+                 Os_CoreGetThread and of the handle pointer is ensured by preconditions.
+ \COUNTERMEASURE \M [CM_OS_JOBGETCORE_M]
+
 SBSW_JUSTIFICATION_END */
 
 /*
@@ -728,6 +728,40 @@ FUNC(Os_StatusType, OS_CODE) Os_Api_GetAlarm
 );
 
 
+/***********************************************************************************************************************
+ *  Os_Api_GetAlarmAsync()
+ **********************************************************************************************************************/
+/*! \brief        OS service Os_GetAlarmAsync().
+ *  \details      For further details see Os_GetAlarmAsync().
+ *
+ *  \param[in]    AlarmID             See Os_GetAlarmAsync().
+ *  \param[in]    Mask                See Os_GetAlarmAsync().
+ *  \param[out]   Call                See Os_GetAlarmAsync().
+ *
+ *  \retval       OS_STATUS_OK              No error.
+ *  \retval       OS_STATUS_NOFUNC_1        Alarm is not in use.
+ *  \retval       OS_STATUS_ID_1            (EXTENDED status:) Invalid AlarmID.
+ *  \retval       OS_STATUS_CALLEVEL        (EXTENDED status:) Called from invalid context.
+ *  \retval       OS_STATUS_DISABLEDINT     (Service Protection:) Caller is in interrupt API sequence.
+ *  \retval       OS_STATUS_ACCESSRIGHTS_1  (Service Protection:) Caller's access rights are not sufficient.
+ *  \retval       OS_STATUS_NOEXTENDEDTASK_CALLER  A notification is requested, but the caller is no extended task.
+ *  \retval       other                     See \ref Os_XSigSendRequest().
+ *
+ *  \context      TASK|ISR2|PRETHOOK|POSTTHOOK
+ *
+ *  \reentrant    TRUE
+ *  \synchronous  TRUE
+ *
+ *  \pre          Supervisor mode.
+ **********************************************************************************************************************/
+FUNC(Os_StatusType, OS_CODE) Os_Api_GetAlarmAsync
+(
+  AlarmType AlarmID,
+  EventMaskType Mask,
+  Os_AsyncCallRefType Call
+);
+
+
 /***********************************************************************************************************************
  *  Os_Api_SetRelAlarm()
  **********************************************************************************************************************/
@@ -50,11 +50,24 @@
 /* Os hal dependencies */
 
 
-#define OS_BARRIER_COUNTERTHRESHOLD     ((Os_BarrierCounterType)1u << ((sizeof(Os_BarrierCounterType) * 8u) - 1u))
 
 /***********************************************************************************************************************
  *  LOCAL CONSTANT MACROS
  **********************************************************************************************************************/
+/*! Mask of the number of pending attendees within the barrier state. */
+#define OS_BARRIER_STATE_PENDING_MASK     ((Os_BarrierStateType)0x000000FFuL)
+
+/*! Mask of the number of attached attendees within the barrier state. */
+#define OS_BARRIER_STATE_ATTACHED_MASK    ((Os_BarrierStateType)0x0000FF00uL)
+
+/*! Position of the number of attached attendees within the barrier state. */
+#define OS_BARRIER_STATE_ATTACHED_SHIFT   (8u)
+
+/*! One attached attendee within the barrier state. */
+#define OS_BARRIER_STATE_ATTACHED_ONE     ((Os_BarrierStateType)0x00000100uL)
+
+/*! Phase (sense of the current synchronization point) within the barrier state. */
+#define OS_BARRIER_STATE_PHASE            ((Os_BarrierStateType)0x00010000uL)
 
 /***********************************************************************************************************************
  *  LOCAL FUNCTION MACROS
@@ -79,13 +92,14 @@
 #include "Os_MemMap_OsCode.h"                                                                                           /* PRQA S 5087 */ /* MD_MSR_MemMap */
 
 /***********************************************************************************************************************
- *  Os_BarrierIsCounterLo()
+ *  Os_BarrierStateGetPhase()
  **********************************************************************************************************************/
-/*! \brief          Returns whether Value is lower than Compare (!0), or not (0).
+/*! \brief          Returns the phase of the given barrier state.
  *  \details        --no details--
  *
- *  \param[in]      Value   The value to check.
- *  \param[in]      Compare The compare value.
+ *  \param[in]      State   The barrier state.
+ *
+ *  \return         The sense of the current synchronization point.
  *
  *  \context        OS_INTERNAL
  *
@@ -94,22 +108,24 @@
  *
  *  \pre            -
  **********************************************************************************************************************/
-OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE Os_StdReturnType,  OS_CODE, OS_ALWAYS_INLINE,
-Os_BarrierIsCounterLo,
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE Os_BarrierSenseType, OS_CODE, OS_ALWAYS_INLINE,
+Os_BarrierStateGetPhase,
 (
-  Os_BarrierCounterType Value,
-  Os_BarrierCounterType Compare
+  Os_BarrierStateType State
 ));
 
 
 /***********************************************************************************************************************
- *  Os_BarrierIsCounterGe()
+ *  Os_BarrierStateOpen()
  **********************************************************************************************************************/
-/*! \brief          Returns whether Value is equal to or greater than Compare (!0), or not (0).
- *  \details        --no details--
+/*! \brief          Returns the barrier state after opening the current synchronization point.
+ *  \details        The phase is set to the given sense and the number of pending attendees is reloaded with the
+ *                  number of attached attendees.
+ *
+ *  \param[in]      State   The barrier state with the number of attached attendees after opening.
+ *  \param[in]      Sense   The sense of the synchronization point which is opened.
  *
- *  \param[in]      Value   The value to check.
- *  \param[in]      Compare The compare value.
+ *  \return         The new barrier state.
  *
  *  \context        OS_INTERNAL
  *
@@ -118,11 +134,11 @@ Os_BarrierIsCounterLo,
  *
  *  \pre            -
  **********************************************************************************************************************/
-OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE Os_StdReturnType,  OS_CODE, OS_ALWAYS_INLINE,
-Os_BarrierIsCounterGe,
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE Os_BarrierStateType, OS_CODE, OS_ALWAYS_INLINE,
+Os_BarrierStateOpen,
 (
-  Os_BarrierCounterType Value,
-  Os_BarrierCounterType Compare
+  Os_BarrierStateType State,
+  Os_BarrierSenseType Sense
 ));
 
 
@@ -174,12 +190,12 @@ OS_CODE, OS_ALWAYS_INLINE, Os_BarrierGetAttendeeDyn,
 
 
 /***********************************************************************************************************************
- *  Os_BarrierGetLowestCounter()
+ *  Os_BarrierJoin()
  **********************************************************************************************************************/
-/*! \brief          Returns the lowest counter value of all attached barriers.
+/*! \brief          Attaches the given attendee to the current synchronization point of the barrier.
  *  \details        --no details--
  *
- *  \param[in]      Barrier   The barrier query. Parameter must not be NULL.
+ *  \param[in,out]  Barrier   The barrier to attach to. Parameter must not be NULL.
  *
  *  \context        OS_INTERNAL
  *
@@ -187,35 +203,63 @@ OS_CODE, OS_ALWAYS_INLINE, Os_BarrierGetAttendeeDyn,
  *  \synchronous    TRUE
  *
  *  \pre            Concurrent access to given object is prevented by caller.
+ *  \pre            Attendee is detached from the barrier.
  **********************************************************************************************************************/
-OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE Os_BarrierCounterType,  OS_CODE, OS_ALWAYS_INLINE,
-Os_BarrierGetLowestCounter,
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,
+Os_BarrierJoin,
 (
   P2CONST(Os_BarrierBaseConfigType, AUTOMATIC, OS_VAR_NOINIT) Barrier
 ));
 
 
 /***********************************************************************************************************************
- *  Os_BarrierIsSynchronized()
+ *  Os_BarrierArrive()
+ **********************************************************************************************************************/
+/*! \brief          Announces that the given attendee has reached the synchronization point with the given sense.
+ *  \details        If the attendee is the last pending one, the phase of the barrier state is reversed.
+ *
+ *  \param[in]      Barrier   The barrier to synchronize on. Parameter must not be NULL.
+ *  \param[in]      Sense     The sense of the synchronization point.
+ *
+ *  \retval         !0        The attendee has been the last pending one and has to release the others.
+ *  \retval         0         Other attendees are pending.
+ *
+ *  \context        OS_INTERNAL
+ *
+ *  \reentrant      TRUE for different objects.
+ *  \synchronous    TRUE
+ *
+ *  \pre            Attendee is attached to the barrier.
  **********************************************************************************************************************/
-/*! \brief          Returns the whether the given attendee is synchronized or detached (!0), or not (0).
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE Os_StdReturnType, OS_CODE, OS_ALWAYS_INLINE,
+Os_BarrierArrive,
+(
+  P2CONST(Os_BarrierBaseConfigType, AUTOMATIC, OS_VAR_NOINIT) Barrier,
+  Os_BarrierSenseType Sense
+));
+
+
+/***********************************************************************************************************************
+ *  Os_BarrierRelease()
+ **********************************************************************************************************************/
+/*! \brief          Writes the given sense into the release flag of all attendees.
  *  \details        --no details--
  *
- *  \param[in]      Barrier     The barrier to query. Parameter must not be NULL.
- *  \param[in]      AttendeeIdx The attendee of interest. The value must be smaller than Barrier->AttendeeCount.
+ *  \param[in]      Barrier   The barrier to open. Parameter must not be NULL.
+ *  \param[in]      Sense     The sense of the opened synchronization point.
  *
  *  \context        OS_INTERNAL
  *
  *  \reentrant      TRUE
  *  \synchronous    TRUE
  *
- *  \pre            -
+ *  \pre            The phase of the barrier state has been set to the given sense by the caller.
  **********************************************************************************************************************/
-OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE Os_StdReturnType,  OS_CODE, OS_ALWAYS_INLINE,
-Os_BarrierIsSynchronized,
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,
+Os_BarrierRelease,
 (
   P2CONST(Os_BarrierBaseConfigType, AUTOMATIC, OS_VAR_NOINIT) Barrier,
-  Os_BarrierAttendeeIdxType AttendeeIdx
+  Os_BarrierSenseType Sense
 ));
 
 
@@ -301,45 +345,47 @@ Os_BarrierId2Barrier,
  *  LOCAL FUNCTIONS
  **********************************************************************************************************************/
 /***********************************************************************************************************************
- *  Os_BarrierIsCounterLo()
+ *  Os_BarrierStateGetPhase()
  **********************************************************************************************************************/
-/*!
- * Internal comment removed.
- *
- *
- *
- */
-OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE Os_StdReturnType,  OS_CODE, OS_ALWAYS_INLINE,                              /* COV_OS_HALPLATFORMMULTICOREUNSUPPORTED */
-Os_BarrierIsCounterLo,
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE Os_BarrierSenseType, OS_CODE, OS_ALWAYS_INLINE,                            /* COV_OS_HALPLATFORMMULTICOREUNSUPPORTED */
+Os_BarrierStateGetPhase,
 (
-  Os_BarrierCounterType Value,
-  Os_BarrierCounterType Compare
+  Os_BarrierStateType State
 ))                                                                                                                      /* COV_OS_HALPLATFORMMULTICOREUNSUPPORTED */
 {
-  /* #10 Calculate difference between Compare and Value. If difference lies within the positive half of the possible
-   *     value range, return a non-zero value. Otherwise the value is negative -> return zero. */
-  /* Ensure that comparison is based on unsigned type by casting into Os_BarrierCounterType before compare. */
-  return (Os_StdReturnType)((Os_BarrierCounterType)(Value - Compare) >= OS_BARRIER_COUNTERTHRESHOLD);                   /* PRQA S 4304 */ /* MD_Os_C90BooleanCompatibility */
+  return (Os_BarrierSenseType)((State & OS_BARRIER_STATE_PHASE) != 0u);                                                 /* PRQA S 4304 */ /* MD_Os_C90BooleanCompatibility */
 }
 
 
 /***********************************************************************************************************************
- *  Os_BarrierIsCounterGe()
+ *  Os_BarrierStateOpen()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
  *
  *
+ *
  */
-OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE Os_StdReturnType,  OS_CODE, OS_ALWAYS_INLINE,                              /* COV_OS_HALPLATFORMMULTICOREUNSUPPORTED */
-Os_BarrierIsCounterGe,
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE Os_BarrierStateType, OS_CODE, OS_ALWAYS_INLINE,                            /* COV_OS_HALPLATFORMMULTICOREUNSUPPORTED */
+Os_BarrierStateOpen,
 (
-  Os_BarrierCounterType Value,
-  Os_BarrierCounterType Compare
+  Os_BarrierStateType State,
+  Os_BarrierSenseType Sense
 ))                                                                                                                      /* COV_OS_HALPLATFORMMULTICOREUNSUPPORTED */
 {
-  /* #10 Return whether Value is greater than or equal to Compare. */
-  return (Os_StdReturnType)(Os_BarrierIsCounterLo(Value, Compare) == 0u);                                               /* PRQA S 4304 */ /* MD_Os_C90BooleanCompatibility */
+  Os_BarrierStateType result;
+
+  /* #10 Keep the number of attached attendees and reload the number of pending attendees with it. */
+  result = (State & OS_BARRIER_STATE_ATTACHED_MASK)
+         | ((State & OS_BARRIER_STATE_ATTACHED_MASK) >> OS_BARRIER_STATE_ATTACHED_SHIFT);
+
+  /* #20 Set the phase to the given sense. */
+  if(Sense != 0u)
+  {
+    result |= OS_BARRIER_STATE_PHASE;
+  }
+
+  return result;
 }
 
 
@@ -372,7 +418,7 @@ OS_CODE, OS_ALWAYS_INLINE, Os_BarrierGetAttendeeDyn,
 
 
 /***********************************************************************************************************************
- *  Os_BarrierGetLowestCounter()
+ *  Os_BarrierJoin()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -380,99 +426,103 @@ OS_CODE, OS_ALWAYS_INLINE, Os_BarrierGetAttendeeDyn,
  *
  *
  *
- *
- *
- *
- *
  */
-OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE Os_BarrierCounterType,  OS_CODE, OS_ALWAYS_INLINE,                         /* COV_OS_HALPLATFORMMULTICOREUNSUPPORTED */
-Os_BarrierGetLowestCounter,
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,                                           /* COV_OS_HALPLATFORMMULTICOREUNSUPPORTED */
+Os_BarrierJoin,
 (
   P2CONST(Os_BarrierBaseConfigType, AUTOMATIC, OS_VAR_NOINIT) Barrier
 ))                                                                                                                      /* COV_OS_HALPLATFORMMULTICOREUNSUPPORTED */
 {
-  Os_BarrierCounterType result;
-  Os_BarrierAttendeeIdx_IteratorType attendeeIdx;
-  Os_BarrierCounterType attendeeCounter;
-  P2CONST(Os_BarrierBaseType volatile, AUTOMATIC, OS_VAR_NOINIT) attendee;
+  P2VAR(Os_BarrierBaseType volatile, AUTOMATIC, OS_VAR_NOINIT) dyn;
+  Os_BarrierStateType state;
+  Os_BarrierSenseType phase;
 
-  /* #10 Initial result is 0. */
-  result = 0;
+  dyn = Os_BarrierGetDyn(Barrier);                                                                                      /* SBSW_OS_FC_PRECONDITION */
 
-  /* #20 Iterate over all attendees. */
-  for(attendeeIdx = 0; attendeeIdx < (Os_BarrierAttendeeIdx_IteratorType) Barrier->AttendeeCount; ++attendeeIdx)
+  /* #10 Increment the number of attached and pending attendees. Retry, if the state has been changed concurrently. */
+  do
   {
-    attendee = Os_BarrierGetAttendeeDyn(Barrier, (Os_BarrierAttendeeIdxType) attendeeIdx);                              /* SBSW_OS_FC_PRECONDITION */
+    state = *(Barrier->State);
+  }while(Os_Hal_BitFieldCmpSwap(Barrier->State, state + OS_BARRIER_STATE_ATTACHED_ONE + 1uL, state) != state);          /* SBSW_OS_BR_BARRIERSTATE_001 */ /* COV_OS_BRRACECONDITION */
 
-    /* #30 If the attendee is attached and is not me, take its counter value as intermediate result. */
-    if((attendee->AttendeeState == OS_BARRIERATTENDEESTATE_ATTACHED) && (attendee != Barrier->Dyn))                     /* COV_OS_HALPLATFORMMULTICOREUNSUPPORTED */
-    {
-      /* #40 Abort iteration. */
-      result = attendee->Counter;
-      attendeeIdx++;                                                                                                    /* PRQA S 2469 */ /* MD_Os_Rule14.2_2469 */
-      break;
-    }
-  }
+  /* #20 Take over the phase of the current synchronization point. It cannot be opened before this attendee arrives.
+   *     An attendee opening the previous synchronization point may write the same value into the release flag. */
+  phase = Os_BarrierStateGetPhase(state);
+  dyn->Sense = phase;                                                                                                   /* SBSW_OS_BR_BARRIERGETDYN_001 */
+  dyn->Release = phase;                                                                                                 /* SBSW_OS_BR_BARRIERGETDYN_001 */
+
+  /* #30 Attach to the barrier. */
+  dyn->AttendeeState = OS_BARRIERATTENDEESTATE_ATTACHED;                                                                /* SBSW_OS_BR_BARRIERGETDYN_001 */
+}
 
 
-  /* #50 Continue iteration over all attendees. */
-  for(; attendeeIdx < (Os_BarrierAttendeeIdx_IteratorType) Barrier->AttendeeCount; ++attendeeIdx)                       /* COV_OS_HALPLATFORMMULTICOREUNSUPPORTED */
+/***********************************************************************************************************************
+ *  Os_BarrierArrive()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE Os_StdReturnType, OS_CODE, OS_ALWAYS_INLINE,                               /* COV_OS_HALPLATFORMMULTICOREUNSUPPORTED */
+Os_BarrierArrive,
+(
+  P2CONST(Os_BarrierBaseConfigType, AUTOMATIC, OS_VAR_NOINIT) Barrier,
+  Os_BarrierSenseType Sense
+))                                                                                                                      /* COV_OS_HALPLATFORMMULTICOREUNSUPPORTED */
+{
+  Os_BarrierStateType state;
+  Os_BarrierStateType newState;
+  Os_StdReturnType isLast;
+
+  do
   {
-    attendee = Os_BarrierGetAttendeeDyn(Barrier, (Os_BarrierAttendeeIdxType) attendeeIdx);                              /* SBSW_OS_FC_PRECONDITION */
-    attendeeCounter = attendee->Counter;
+    state = *(Barrier->State);
 
-    /* #60 If the attendee is attached, is not me and has a different counter value: */
-    if(     (attendee->AttendeeState == OS_BARRIERATTENDEESTATE_ATTACHED)
-        &&  (attendee != Barrier->Dyn)
-        &&  (result != attendeeCounter))                                                                                /* COV_OS_HALPLATFORMNEEDMORETHAN2CORES */
+    /* #10 If this is the last pending attendee, open the synchronization point. */
+    if((state & OS_BARRIER_STATE_PENDING_MASK) <= 1uL)                                                                  /* COV_OS_HALPLATFORMMULTICOREUNSUPPORTED */
     {
-      /* #70 Select the lower counter value and abort. */
-      if(Os_BarrierIsCounterLo(attendeeCounter, result) != 0u)
-      {
-        result = attendeeCounter;
-      }
-
-      break;
+      newState = Os_BarrierStateOpen(state, Sense);
+      isLast = !0u;                                                                                                     /* PRQA S 4404, 4558 */ /* MD_Os_C90BooleanCompatibility, MD_Os_Rule10.1_4558 */
+    }
+    /* #20 Otherwise, decrement the number of pending attendees. */
+    else
+    {
+      newState = state - 1uL;
+      isLast = 0u;
     }
-  }
 
-  return (Os_BarrierCounterType)result;
+    /* #30 Retry, if the state has been changed concurrently. */
+  }while(Os_Hal_BitFieldCmpSwap(Barrier->State, newState, state) != state);                                             /* SBSW_OS_BR_BARRIERSTATE_001 */ /* COV_OS_BRRACECONDITION */
+
+  return isLast;
 }
 
 
 /***********************************************************************************************************************
- *  Os_BarrierIsSynchronized()
+ *  Os_BarrierRelease()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
  *
  *
- *
  */
-OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE Os_StdReturnType, OS_CODE, OS_ALWAYS_INLINE,                               /* COV_OS_HALPLATFORMMULTICOREUNSUPPORTED */
-Os_BarrierIsSynchronized,
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,                                           /* COV_OS_HALPLATFORMMULTICOREUNSUPPORTED */
+Os_BarrierRelease,
 (
   P2CONST(Os_BarrierBaseConfigType, AUTOMATIC, OS_VAR_NOINIT) Barrier,
-  Os_BarrierAttendeeIdxType AttendeeIdx
+  Os_BarrierSenseType Sense
 ))                                                                                                                      /* COV_OS_HALPLATFORMMULTICOREUNSUPPORTED */
 {
-  P2CONST(Os_BarrierBaseType volatile, AUTOMATIC, OS_VAR_NOINIT) attendee;
-  Os_BarrierCounterType attendeeCounter;
-  Os_BarrierCounterType ownCounter;
-  Os_StdReturnType synchronized;
-
-  attendee = Os_BarrierGetAttendeeDyn(Barrier, AttendeeIdx);                                                            /* SBSW_OS_FC_PRECONDITION */
-
-  /* Take a snapshot of values to avoid compiler warning about undefined order of volatile accesses */
-  attendeeCounter = attendee->Counter;
-  ownCounter = Barrier->Dyn->Counter;
-
-  /* #10 If the addressed attendee is detached or has already reached the counter value, the result
-       is !0, otherwise 0. */
-  synchronized = (Os_BarrierIsCounterGe(attendeeCounter, ownCounter) != 0u)                                             /* PRQA S 4404 */ /* MD_Os_C90BooleanCompatibility */
-      || (attendee->AttendeeState == OS_BARRIERATTENDEESTATE_DETACHED );                                                /* COV_OS_HALPLATFORMMULTICOREUNSUPPORTED */
+  Os_BarrierAttendeeIdx_IteratorType attendeeIdx;
 
-  return synchronized;
+  /* #10 Write the sense into the release flag of each attendee. Detached attendees overwrite it on attachment. */
+  for(attendeeIdx = 0; attendeeIdx < (Os_BarrierAttendeeIdx_IteratorType) Barrier->AttendeeCount; ++attendeeIdx)
+  {
+    Os_BarrierGetAttendeeDyn(Barrier, (Os_BarrierAttendeeIdxType)attendeeIdx)->Release = Sense;                         /* SBSW_OS_FC_PRECONDITION */ /* SBSW_OS_BR_BARRIERGETATTENDEEDYN_001 */
+  }
 }
 
 
@@ -548,9 +598,13 @@ FUNC(void, OS_CODE) Os_BarrierInit
 
   dyn = Os_BarrierGetDyn(Barrier);                                                                                      /* SBSW_OS_FC_PRECONDITION */
 
-  /* #10 Set attendee state to initial state and clear counter. */
+  /* #10 Set attendee state to initial state and clear the senses. */
   dyn->AttendeeState = OS_BARRIERATTENDEESTATE_DETACHED;                                                                /* SBSW_OS_BR_BARRIERGETDYN_001 */
-  dyn->Counter = 0;                                                                                                     /* SBSW_OS_BR_BARRIERGETDYN_001 */
+  dyn->Sense = 0;                                                                                                       /* SBSW_OS_BR_BARRIERGETDYN_001 */
+  dyn->Release = 0;                                                                                                     /* SBSW_OS_BR_BARRIERGETDYN_001 */
+
+  /* #20 Clear the shared state. No attendee is attached yet. */
+  *(Barrier->State) = 0;                                                                                                /* SBSW_OS_BR_BARRIERSTATE_001 */
 }
 
 
@@ -561,9 +615,6 @@ FUNC(void, OS_CODE) Os_BarrierInit
  * Internal comment removed.
  *
  *
- *
- *
- *
  */
 FUNC(void, OS_CODE) Os_BarrierAttach
 (
@@ -572,25 +623,8 @@ FUNC(void, OS_CODE) Os_BarrierAttach
 {
   if(Os_CoreIsSingleAsrCoreOs() == 0u)                                                                                  /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */ /* COV_OS_HALPLATFORMMULTICOREUNSUPPORTED */
   {
-    Os_BarrierCounterType counterSnapshot;
-    P2VAR(Os_BarrierBaseType volatile, AUTOMATIC, OS_VAR_NOINIT) dyn;
-
-    dyn = Os_BarrierGetDyn(Barrier);                                                                                    /* SBSW_OS_FC_PRECONDITION */
-
-    /* #10 Get the lowest counter value of all attendees which are attached to this barrier. */
-    counterSnapshot = Os_BarrierGetLowestCounter(Barrier);                                                              /* SBSW_OS_FC_PRECONDITION */
-
-    do
-    {
-      /* #20 Attach to the barrier. */
-      dyn->Counter = counterSnapshot;                                                                                   /* SBSW_OS_BR_BARRIERGETDYN_001 */
-      dyn->AttendeeState = OS_BARRIERATTENDEESTATE_ATTACHED;                                                            /* SBSW_OS_BR_BARRIERGETDYN_001 */
-
-      /* #30 Get an overall counter snapshot. */
-      counterSnapshot = Os_BarrierGetLowestCounter(Barrier);                                                            /* SBSW_OS_FC_PRECONDITION */
-
-      /* #40 Loop while lowest counter value changed during attach step. */
-    }while(dyn->Counter != counterSnapshot);                                                                            /* COV_OS_BRRACECONDITION */
+    /* #10 Attach to the current synchronization point of the barrier. */
+    Os_BarrierJoin(Barrier);                                                                                            /* SBSW_OS_FC_PRECONDITION */
   }
 }
 
@@ -610,13 +644,8 @@ FUNC(void, OS_CODE) Os_BarrierAttachUserBarrier
 {
   if(Os_CoreIsSingleAsrCoreOs() == 0u)                                                                                  /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */ /* COV_OS_HALPLATFORMMULTICOREUNSUPPORTED */
   {
-    P2VAR(Os_BarrierBaseType volatile, AUTOMATIC, OS_VAR_NOINIT) dyn;
-
-    dyn = Os_BarrierGetDyn(Barrier);                                                                                    /* SBSW_OS_FC_PRECONDITION */
-
     /* #10 Attach to the barrier. */
-    dyn->AttendeeState = OS_BARRIERATTENDEESTATE_ATTACHED;                                                              /* SBSW_OS_BR_BARRIERGETDYN_001 */
-
+    Os_BarrierJoin(Barrier);                                                                                            /* SBSW_OS_FC_PRECONDITION */
   }
 }
 
@@ -628,12 +657,59 @@ FUNC(void, OS_CODE) Os_BarrierAttachUserBarrier
  * Internal comment removed.
  *
  *
+ *
+ *
+ *
+ *
+ *
  */
 FUNC(void, OS_CODE) Os_BarrierDetach
 (
   P2CONST(Os_BarrierBaseConfigType, AUTOMATIC, OS_VAR_NOINIT) Barrier
 )
 {
+  if(Os_CoreIsSingleAsrCoreOs() == 0u)                                                                                  /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */ /* COV_OS_HALPLATFORMMULTICOREUNSUPPORTED */
+  {
+    Os_BarrierStateType state;
+    Os_BarrierStateType newState;
+    Os_BarrierSenseType sense;
+    Os_StdReturnType isLast;
+
+    sense = Os_BarrierGetDyn(Barrier)->Sense;                                                                           /* SBSW_OS_FC_PRECONDITION */
+
+    do
+    {
+      state = *(Barrier->State);
+      newState = state - OS_BARRIER_STATE_ATTACHED_ONE;
+      isLast = 0u;
+
+      /* #10 If the attendee has not reached the current synchronization point yet: */
+      if(Os_BarrierStateGetPhase(state) == sense)                                                                       /* COV_OS_HALPLATFORMMULTICOREUNSUPPORTED */
+      {
+        /* #20 If it is the last pending attendee and others are attached, open the synchronization point. */
+        if(((state & OS_BARRIER_STATE_PENDING_MASK) <= 1uL) && (newState >= OS_BARRIER_STATE_ATTACHED_ONE))             /* COV_OS_HALPLATFORMNEEDMORETHAN2CORES */
+        {
+          newState = Os_BarrierStateOpen(newState, (Os_BarrierSenseType)(sense ^ 1u));
+          isLast = !0u;                                                                                                 /* PRQA S 4404, 4558 */ /* MD_Os_C90BooleanCompatibility, MD_Os_Rule10.1_4558 */
+        }
+        /* #30 Otherwise, it is no longer pending. */
+        else
+        {
+          newState = newState - 1uL;
+        }
+      }
+
+      /* #40 Retry, if the state has been changed concurrently. */
+    }while(Os_Hal_BitFieldCmpSwap(Barrier->State, newState, state) != state);                                           /* SBSW_OS_BR_BARRIERSTATE_001 */ /* COV_OS_BRRACECONDITION */
+
+    /* #50 Release the waiting attendees, if this attendee opened the synchronization point. */
+    if(isLast != 0u)                                                                                                    /* COV_OS_HALPLATFORMNEEDMORETHAN2CORES */
+    {
+      Os_BarrierRelease(Barrier, (Os_BarrierSenseType)(sense ^ 1u));                                                    /* SBSW_OS_FC_PRECONDITION */
+    }
+  }
+
+  /* #60 Detach from the barrier. */
   Os_BarrierGetDyn(Barrier)->AttendeeState = OS_BARRIERATTENDEESTATE_DETACHED;                                          /* SBSW_OS_FC_PRECONDITION */ /* SBSW_OS_BR_BARRIERGETDYN_001 */
 }
 
@@ -647,6 +723,7 @@ FUNC(void, OS_CODE) Os_BarrierDetach
  *
  *
  *
+ *
  */
 FUNC(void, OS_CODE) Os_BarrierSynchronizeInternal
 (
@@ -655,26 +732,26 @@ FUNC(void, OS_CODE) Os_BarrierSynchronizeInternal
 {
   if(Os_CoreIsSingleAsrCoreOs() == 0u)                                                                                  /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */ /* COV_OS_HALPLATFORMMULTICOREUNSUPPORTED */
   {
-    Os_StdReturnType synchronized;
-    Os_BarrierAttendeeIdx_IteratorType attendeeIdx;
+    P2VAR(Os_BarrierBaseType volatile, AUTOMATIC, OS_VAR_NOINIT) dyn;
+    Os_BarrierSenseType sense;
 
-    /* #10 Increment the barrier counter. */
-    Os_BarrierGetDyn(Barrier)->Counter++;                                                                               /* PRQA S 3387 */ /* MD_Os_Rule13.3_3387 */ /* SBSW_OS_FC_PRECONDITION */ /* SBSW_OS_BR_BARRIERGETDYN_001 */
+    dyn = Os_BarrierGetDyn(Barrier);                                                                                    /* SBSW_OS_FC_PRECONDITION */
 
-    /* #20 Spin until all attendees are synchronized. */
-    do
-    {
-      synchronized = TRUE;
+    /* #10 Reverse the local sense. */
+    sense = (Os_BarrierSenseType)(dyn->Sense ^ 1u);
+    dyn->Sense = sense;                                                                                                 /* SBSW_OS_BR_BARRIERGETDYN_001 */
 
-      for (attendeeIdx = 0; attendeeIdx < (Os_BarrierAttendeeIdx_IteratorType) Barrier->AttendeeCount; ++attendeeIdx)
-      {
-        synchronized = (Os_BarrierIsSynchronized(Barrier, (Os_BarrierAttendeeIdxType)attendeeIdx)) && synchronized;     /* PRQA S 4115, 4404, 4558 */ /* MD_Os_Rule10.1_4115, MD_Os_C90BooleanCompatibility, MD_Os_Rule10.1_4558 */ /* SBSW_OS_FC_PRECONDITION */ /* COV_OS_HALPLATFORMMULTICOREUNSUPPORTED */
-      }
+    /* #20 Announce the arrival. If this has been the last pending attendee, release all attendees. */
+    if(Os_BarrierArrive(Barrier, sense) != 0u)                                                                          /* SBSW_OS_FC_PRECONDITION */ /* COV_OS_HALPLATFORMMULTICOREUNSUPPORTED */
+    {
+      Os_BarrierRelease(Barrier, sense);                                                                                /* SBSW_OS_FC_PRECONDITION */
+    }
 
-      /* #30 Perform NOP. */
+    /* #30 Spin on the own release flag until the synchronization point is opened. */
+    while(dyn->Release != sense)                                                                                        /* COV_OS_HALPLATFORMMULTICOREUNSUPPORTED */
+    {
       Os_Hal_CoreNop();
-
-    } while (synchronized == FALSE);                                                                                    /* COV_OS_HALPLATFORMMULTICOREUNSUPPORTED */
+    }
   }
 }
 
@@ -752,6 +829,15 @@ FUNC(Os_StatusType, OS_CODE) Os_Api_BarrierSynchronize
  \DESCRIPTION    Write access to the dynamic data of a barrier.
  \COUNTERMEASURE \M [CM_OS_BARRIER_DYN_M]
 
+\ID SBSW_OS_BR_BARRIERSTATE_001
+ \DESCRIPTION    Access to the shared state of a barrier.
+ \COUNTERMEASURE \M [CM_OS_BARRIER_STATE_M]
+
+\ID SBSW_OS_BR_BARRIERGETATTENDEEDYN_001
+ \DESCRIPTION    Write access to the dynamic data of a barrier attendee. The index is limited by AttendeeCount.
+ \COUNTERMEASURE \M [CM_OS_BARRIER_ATTENDEEREFS_M]
+                 \M [CM_OS_BARRIER_DYN_M]
+
  \ID SBSW_OS_BR_CORE2ASRCORE_001
  \DESCRIPTION    Os_Core2AsrCore is called with the return value of Os_CoreGetCurrentCore.
  \COUNTERMEASURE \S [CM_OS_COREGETCURRENTCORE_S]
@@ -794,6 +880,14 @@ SBSW_JUSTIFICATION_END */
 \CM CM_OS_BARRIER_DYN_M
       Verify that the Barrier Dyn pointer of each Barrier object is a non NULL_PTR.
 
+\CM CM_OS_BARRIER_STATE_M
+      Verify that the State pointer of each Barrier object is a non NULL_PTR and that all attendees of a barrier
+      refer to the same state.
+
+\CM CM_OS_BARRIER_ATTENDEEREFS_M
+      Verify that AttendeeRefs of each Barrier object has AttendeeCount elements and that each element is a non
+      NULL_PTR.
+
 \CM CM_OS_BARRIERID2BARRIER_R
       The caller ensures, that the returned pointer is not used for write accesses or as input for further
       functions, if the returned pointer is NULL_PTR.
@@ -808,8 +902,8 @@ SBSW_JUSTIFICATION_END */
 
 \ID COV_OS_BRRACECONDITION
    \ACCEPT XF
-   \REASON True condition may not be stimulated by tests due to race condition: Two cores have to perform
-           synchronization while a third core is attached to the barrier.
+   \REASON True condition may not be stimulated by tests due to race condition: Another core has to modify the
+           shared barrier state between the read of the state and the compare and swap.
 
 
 END_COVERAGE_JUSTIFICATION */
@@ -25,35 +25,36 @@
  *
  *  Each barrier consists of several attendees on different cores.
  *
- *  The basic idea of the barrier synchronization implementation is that each attendee has a synchronization counter.
- *  It increments this counter at a synchronization point and waits until all other counters have reached this value.
- *  So one barrier allows the synchronization of all attendees at several synchronization points.
- *
- *  Concurrent data access from different attendees is possible, as each attendee only changes its own counter and
- *  just reads the counters of all other attendees (atomic read of the counter variables must be possible).
- *
- *  Initially all attendees are detached from the barrier. When the first attendee is attached, its counter is set to
- *  zero. When further attendees are attached to the barrier, they derive the initial state of their counter variable
- *  from the already attached attendees. If multiple attendees have already been attached and have currently different
- *  counter values, the lowest value is chosen. The difference in counter value means that the attendees with higher
- *  counter values have already reached the synchronization point while the attendees with lower counter values have
- *  not. The newly attached attendee has to reach the synchronization point before the barrier is opened.
- *
- *  Attendees need to be configured statically and may be attached or detached at any time. Newly attached attendees
- *  will skip the synchronization points which have already been reached by all other attached attendees. In case
- *  the (asynchronous) attachment of a new attendee occurs right at the time when the last of the already attached
- *  attendees reaches a synchronization point, it will be unsure whether or not the new attendee is still considered
- *  for this synchronization point or just for the next one.
- *
- *  For each pair of attached attendees the difference between the counters is one at most. Comparison between to
- *  counter values is performed, by checking the difference between both values:
- *
- *  Let d = barrier1.Counter - barrier2.Counter
- *   - If      d == 0 => Values are identical.
- *   - Else if d == 1 => barrier1 has reached the barrier, barrier 2 not.
- *   - Else           => barrier2 has reached the barrier, barrier 1 has not.
- *   In order to check whether a barrier value is already reached the difference 'd' is compared against the
- *   threshold OS_BARRIER_COUNTERTHRESHOLD which equals the half value of range of the underlying type (0x80...0).
+ *  The barrier synchronization is implemented as a centralized sense-reversing barrier. All attendees of a barrier
+ *  share one state word, which holds the number of attached attendees, the number of attached attendees which have not
+ *  reached the current synchronization point yet (pending) and the sense (phase) of the current synchronization point.
+ *  The state word is only modified by atomic compare and swap operations.
+ *
+ *  Each attendee has a local sense and a local release flag. At a synchronization point, the attendee reverses its
+ *  local sense and decrements the pending count. The last attendee opens the barrier: It reverses the phase, reloads
+ *  the pending count with the number of attached attendees and writes the new sense into the release flag of every
+ *  attendee. All other attendees spin on their own release flag until it equals their local sense. So each attendee
+ *  only polls data which is not written by other attendees until the barrier is opened, and one synchronization point
+ *  causes O(N) instead of O(N^2) cross-core accesses.
+ *
+ *  A combining-tree barrier is not provided. A barrier has at most one attendee per core and attendees may attach and
+ *  detach at any time. A tree would have to track the attached attendees on each of its levels, while the central
+ *  state word is only modified once per attendee and synchronization point.
+ *
+ *  Initially all attendees are detached from the barrier. Attaching an attendee increments the number of attached and
+ *  the number of pending attendees and takes over the current phase as local sense. A newly attached attendee thus
+ *  has to reach the current synchronization point before the barrier is opened. Synchronization points which have
+ *  already been passed by all other attached attendees are skipped. In case the (asynchronous) attachment of a new
+ *  attendee occurs right at the time when the last of the already attached attendees reaches a synchronization
+ *  point, it will be unsure whether or not the new attendee is still considered for this synchronization point or
+ *  just for the next one.
+ *
+ *  Detaching an attendee decrements the number of attached attendees. If the attendee has not reached the current
+ *  synchronization point yet, the pending count is decremented as well. If it was the last pending attendee, the
+ *  detaching attendee opens the barrier for the others.
+ *
+ *  Attendees need to be configured statically. An attendee may be attached by a foreign core as long as the attendee
+ *  does not use the barrier concurrently.
  *
  *
  *  \{
@@ -110,7 +111,11 @@
 typedef uint8 Os_BarrierAttendeeIdxType;
 typedef uint8_least Os_BarrierAttendeeIdx_IteratorType;
 
-typedef uint8 Os_BarrierCounterType;
+/*! Sense of a synchronization point (0 or 1). */
+typedef uint8 Os_BarrierSenseType;
+
+/*! Shared state word of a barrier (phase, number of attached and number of pending attendees). */
+typedef uint32 Os_BarrierStateType;
 
 typedef P2CONST(Os_BarrierBaseConfigType, AUTOMATIC, OS_VAR_NOINIT) Os_BarrierAttendeeRefType;
 
@@ -133,8 +138,12 @@ struct Os_BarrierBaseType_Tag
   /*! Defines whether this attendee is considered during synchronization. */
   Os_BarrierAttendeeStateType AttendeeState;
 
-  /*! Counts the number of cores which have not reached the barrier until now. */
-  Os_BarrierCounterType Counter;
+  /*! Sense of the next synchronization point which has not been passed by this attendee. Written by the attendee. */
+  Os_BarrierSenseType Sense;
+
+  /*! Sense of the last synchronization point, which has been opened. Written by the attendee which opens the barrier.
+   *  The attendee spins on this flag. */
+  Os_BarrierSenseType Release;
 };
 
 
@@ -144,6 +153,9 @@ struct Os_BarrierBaseConfigType_Tag
   /*! The dynamic data of a barrier. */
   P2VAR(Os_BarrierBaseType volatile, AUTOMATIC, OS_VAR_NOINIT) Dyn;
 
+  /*! The state word, which is shared by all attendees of this barrier. */
+  P2VAR(Os_BarrierStateType volatile, AUTOMATIC, OS_VAR_NOINIT) State;
+
   /*! List of references to the dynamic data of all attendees assigned to this barrier (including this attendee). */
   P2CONST(Os_BarrierAttendeeRefType, AUTOMATIC, OS_VAR_NOINIT) AttendeeRefs;
 
@@ -176,7 +188,7 @@ struct Os_BarrierBaseConfigType_Tag
  *  \synchronous    TRUE
  *
  *  \pre            Concurrent access to given object is prevented by caller.
- *  \pre            The counter value of each other initialized attendee is '0'.
+ *  \pre            No attendee of the barrier is attached.
  **********************************************************************************************************************/
 FUNC(void, OS_CODE) Os_BarrierInit
 (
@@ -188,7 +200,8 @@ FUNC(void, OS_CODE) Os_BarrierInit
  *  Os_BarrierAttach()
  **********************************************************************************************************************/
 /*! \brief          Tells the barrier that the caller has to be synchronized at the next barrier.
- *  \details        --no details--
+ *  \details        The attendee is considered for the current synchronization point, if it has not been passed by
+ *                  all other attached attendees yet.
  *
  *  \param[in,out]  Barrier   The barrier to synchronize on. Parameter must not be NULL.
  *
@@ -233,7 +246,7 @@ FUNC(void, OS_CODE) Os_BarrierAttachUserBarrier
  **********************************************************************************************************************/
 /*! \brief          Tells the barrier that the caller does not have to be synchronized or is already waiting for
  *                  becoming synchronous.
- *  \details        --no details--
+ *  \details        If the caller is the last attendee the others are waiting for, the barrier is opened.
  *
  *  \param[in,out]  Barrier   The barrier to skip. Parameter must not be NULL.
  *
@@ -255,7 +268,7 @@ FUNC(void, OS_CODE) Os_BarrierDetach
  *  Os_BarrierSynchronizeInternal()
  **********************************************************************************************************************/
 /*! \brief          Enters the barrier and waits until all attendees are synchronized.
- *  \details        -- no details --
+ *  \details        The caller spins on its own release flag. The last arriving attendee opens the barrier.
  *
  *  \param[in,out]  Barrier   The synchronization barrier. Parameter must not be NULL.
  *
@@ -265,6 +278,7 @@ FUNC(void, OS_CODE) Os_BarrierDetach
  *  \synchronous    TRUE
  *
  *  \pre            Concurrent access to given object is prevented by caller.
+ *  \pre            Attendee is attached to the barrier.
  **********************************************************************************************************************/
 FUNC(void, OS_CODE) Os_BarrierSynchronizeInternal
 (
@@ -140,6 +140,11 @@ union Os_ParamType_Tag
   Os_BarrierIdType                          ParamBarrierIdType;
   Os_ExceptionContextRefType                ParamExceptionContextRefType;
   Os_CoreStartStateType *                   ParamCoreStartStateRefType;
+  Os_SpinlockStatisticsRefType              ParamSpinlockStatisticsRefType;
+  Os_AsyncCallRefType                       ParamAsyncCallRefType;
+  Os_ThreadAccountingRefType                ParamThreadAccountingRefType;
+  Os_NtfStackPoolStatisticsRefType          ParamNtfStackPoolStatisticsRefType;
+  Os_TaskSetIdType                          ParamTaskSetIdType;
 };
 
 
@@ -57,6 +57,7 @@
 #include "Os_TimingProtection.h"
 #include "Os_XSignal.h"
 #include "Os_Ioc.h"
+#include "Os_Timer.h"
 #include "Os.h"
 
 /* Os HAL dependencies */
@@ -366,6 +367,29 @@ OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE boolean, OS_CODE, OS_ALWAYS_INLINE
 OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE, Os_CoreIdle, (void));
 
 
+/***********************************************************************************************************************
+ *  Os_CoreTicklessEnter()
+ **********************************************************************************************************************/
+/*! \brief          Suppresses the periodic ticks of the core's tickless timers until their next expiry.
+ *  \details        Each tickless timer is reprogrammed to the tick which reaches the next expiration point of its
+ *                  counter. Nothing is done, if the idle mode is not IDLE_TICKLESS or the ticks are already suppressed.
+ *
+ *  \param[in]      Core     The local core. Parameter must not be NULL.
+ *
+ *  \context        OS_INTERNAL
+ *
+ *  \reentrant      FALSE
+ *  \synchronous    TRUE
+ *
+ *  \pre            The given core is the local core.
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,
+Os_CoreTicklessEnter,
+(
+  P2CONST(Os_CoreAsrConfigType, AUTOMATIC, OS_CONST) Core
+));
+
+
 /***********************************************************************************************************************
  *  Os_CoreGetStatus()
  **********************************************************************************************************************/
@@ -842,7 +866,7 @@ OS_LOCAL FUNC(void, OS_CODE) Os_CorePreStartInit
   core = Os_Core2AsrCore(Os_CoreGetCurrentCore());                                                                      /* SBSW_OS_CORE_CORE2ASRCORE_002 */
 
   /* #10 Initialize core's memory protection. */
-  Os_MpCoreInit(core->MemoryProtection, InitialStackRegion);                                                            /* SBSW_OS_CORE_MPCOREINIT_001 */
+  Os_MpCoreInit(core->MemoryProtection, InitialStackRegion, Os_CoreAsrGetMpActive(core));                               /* SBSW_OS_CORE_MPCOREINIT_001 */
 
   /* #20 Initialize system hooks. */
   Os_CoreHooksInit(core);                                                                                               /* SBSW_OS_CORE_COREHOOKSINIT_001 */
@@ -1029,6 +1053,7 @@ FUNC(OS_LOCAL_INLINE void, OS_CODE) Os_CoreInit(void)
   coreStatus->OsState = OS_COREOSSTATE_STARTED;                                                                         /* SBSW_OS_CORE_COREASR_STATUS_002 */
 
   coreDyn->IdleMode = IDLE_NO_HALT;                                                                                     /* SBSW_OS_CORE_COREASR_DYN_001 */
+  coreDyn->IsTickless = FALSE;                                                                                          /* SBSW_OS_CORE_COREASR_DYN_001 */
 
   /* #20 Initialize Resources. */
   for(index = 0; index < (Os_ObjIdx_IteratorType) core->ResourceCount; index++)
@@ -1425,14 +1450,64 @@ Os_CoreGetTrue, (void))
 OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,
 Os_CoreIdle, (void))
 {
+  P2CONST(Os_CoreAsrConfigType, AUTOMATIC, OS_CONST) core;
+
+  core = Os_ThreadGetCore(Os_CoreGetThread());                                                                          /* SBSW_OS_CORE_THREADGETCORE_001 */
+
   /* #10 Call HAL Idle in an endless loop. */
   while(Os_CoreGetTrue() == TRUE)                                                                                       /* PRQA S 2871, 2990 */ /* MD_Os_Dir4.1_2871, MD_Os_Rule14.3_2990 */ /* COV_OS_COREIDLELOOP */
   {
+    /* #20 Suppress the periodic ticks until the next expiry, if requested. */
+    Os_CoreTicklessEnter(core);                                                                                         /* SBSW_OS_CORE_CORETICKLESSENTER_001 */
+
     Os_Hal_CoreIdle();                                                                                                  /* PRQA S 2987 */ /* MD_Os_Rule2.2_2987 */
   }
 }
 
 
+/***********************************************************************************************************************
+ *  Os_CoreTicklessEnter()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,
+Os_CoreTicklessEnter,
+(
+  P2CONST(Os_CoreAsrConfigType, AUTOMATIC, OS_CONST) Core
+))
+{
+  P2VAR(Os_CoreAsrType, AUTOMATIC, OS_VAR_NOINIT) coreDyn;
+  Os_IntStateType interruptState;
+  Os_ObjIdx_IteratorType index;
+
+  coreDyn = Os_CoreAsrGetDyn(Core);                                                                                     /* SBSW_OS_FC_PRECONDITION */
+
+  /* #10 Suspend interrupts, so that no ISR observes a partially reprogrammed timer. */
+  Os_IntSuspend(&interruptState);                                                                                       /* SBSW_OS_FC_POINTER2LOCAL */
+
+  /* #20 If tickless idle is requested and the ticks are not suppressed yet: */
+  if((coreDyn->IdleMode == IDLE_TICKLESS) && (coreDyn->IsTickless == FALSE))
+  {
+    /* #30 Stretch the period of each tickless timer up to its next expiry. */
+    for(index = 0; index < (Os_ObjIdx_IteratorType)Core->TicklessTimerCount; index++)
+    {
+      if(Os_TimerPfrtTicklessEnter(Core->TicklessTimerRefs[index]) == TRUE)                                             /* SBSW_OS_CORE_TIMERPFRTTICKLESS_001 */
+      {
+        /* #40 Remember that ticks are suppressed, if at least one timer has been stretched. */
+        coreDyn->IsTickless = TRUE;                                                                                     /* SBSW_OS_CORE_COREASR_DYN_001 */
+      }
+    }
+  }
+
+  Os_IntResume(&interruptState);                                                                                        /* SBSW_OS_FC_POINTER2LOCAL */
+}
+
+
 /***********************************************************************************************************************
  *  Os_CoreGetStatus()
  **********************************************************************************************************************/
@@ -3006,6 +3081,32 @@ FUNC(Os_StatusType, OS_CODE) Os_CoreControlIdle
 }
 
 
+/***********************************************************************************************************************
+ *  Os_CoreTicklessCatchUp()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ */
+FUNC(void, OS_CODE) Os_CoreTicklessCatchUp
+(
+  P2CONST(Os_CoreAsrConfigType, AUTOMATIC, OS_CONST) Core
+)
+{
+  Os_ObjIdx_IteratorType index;
+
+  /* #10 Add the elapsed ticks to each tickless timer and resume its periodic interrupt. */
+  for(index = 0; index < (Os_ObjIdx_IteratorType)Core->TicklessTimerCount; index++)
+  {
+    Os_TimerPfrtTicklessLeave(Core->TicklessTimerRefs[index]);                                                          /* SBSW_OS_CORE_TIMERPFRTTICKLESS_001 */
+  }
+
+  /* #20 Mark the ticks as no longer suppressed. */
+  Os_CoreAsrGetDyn(Core)->IsTickless = FALSE;                                                                           /* SBSW_OS_FC_PRECONDITION */ /* SBSW_OS_CORE_COREASRGETDYN_003 */
+}
+
+
 #define OS_STOP_SEC_CODE
 #include "Os_MemMap_OsCode.h"                                                                                           /* PRQA S 5087 */ /* MD_MSR_MemMap */
 
@@ -3178,7 +3279,8 @@ FUNC(Os_StatusType, OS_CODE) Os_CoreControlIdle
  \COUNTERMEASURE \M [CM_OS_SYSTEM_MEMORYPROTECTION_M]
 
 \ID SBSW_OS_CORE_MPCOREINIT_001
- \DESCRIPTION    Os_MpCoreInit is called with the MemoryProtection of a core object returned by Os_Core2AsrCore.
+ \DESCRIPTION    Os_MpCoreInit is called with the MemoryProtection of a core object returned by Os_Core2AsrCore and
+                 the active access rights returned by Os_CoreAsrGetMpActive for the same core object.
                  Precondition of Os_Core2AsrCore ensures that the returned Core pointer is valid. The compliance of the
                  precondition is check during review.
  \COUNTERMEASURE \M [CM_OS_COREASR_MEMORYPROTECTION_M]
@@ -3645,6 +3747,17 @@ FUNC(Os_StatusType, OS_CODE) Os_CoreControlIdle
                   if a Pre-Start Task is configured for the core.
  \COUNTERMEASURE \M [CM_OS_COREASR_PRESTARTTASK_CALLBACK_M]
 
+\ID SBSW_OS_CORE_CORETICKLESSENTER_001
+ \DESCRIPTION    Os_CoreTicklessEnter is called with the return value of Os_ThreadGetCore.
+ \COUNTERMEASURE \M [CM_OS_THREADGETCORE_M]
+
+\ID SBSW_OS_CORE_TIMERPFRTTICKLESS_001
+ \DESCRIPTION    A tickless function of a PFRT timer is called with an entry of TicklessTimerRefs. The used
+                 TicklessTimerRefs index is limited to TicklessTimerCount. TicklessTimerCount and TicklessTimerRefs are
+                 derived from a core passed as argument to the caller function. Precondition ensures that the argument
+                 pointer is valid. The compliance of the precondition is checked during review.
+ \COUNTERMEASURE \M [CM_OS_COREASR_TICKLESSTIMERREFS_M]
+
 SBSW_JUSTIFICATION_END */
 
 /*
@@ -3728,6 +3841,13 @@ SBSW_JUSTIFICATION_END */
         3. each element in InterruptSourceRefs except the last one is no NULL_PTR, the last one must be
            NULL_PTR.
 
+\CM CM_OS_COREASR_TICKLESSTIMERREFS_M
+      Verify that:
+        1. each Autosar core's TicklessTimerRefs pointer is no NULL_PTR,
+        2. each Autosar core's TicklessTimerRefs size is equal to the core's TicklessTimerCount,
+        3. each element in TicklessTimerRefs except the last one is no NULL_PTR, the last one must be NULL_PTR and
+        4. each element in TicklessTimerRefs refers to a PFRT driven counter, which is assigned to the core.
+
 \CM CM_OS_SYSTEM_INTERRUPTSOURCEREFS_M
       Verify that:
         1. Verify that the system InterruptSourceRefs pointer is not NULL_PTR,
@@ -3784,7 +3904,15 @@ SBSW_JUSTIFICATION_END */
       must be a NULL_PTR if OS_CFG_TIMING_PROTECTION is defined to OS_CFG_TP_NO_CORE.
 
 \CM CM_OS_COREGETTRACE_M
-      Verify that the Trace pointer of each Core is valid, when ORTI tracing is enabled.
+      Verify that the Trace pointer of each Core is valid, when ORTI tracing or runtime accounting is enabled.
+
+\CM CM_OS_COREGETTRACERECORDER_M
+      Verify that, if OS_CFG_TRACE_RECORDER is enabled, the TraceRecorder pointer of each Core is valid, its Dyn and
+      Buffer pointers are valid, the Buffer has (Mask + 1) elements, (Mask + 1) is a power of two and the Timer
+      pointer is valid.
+
+\CM CM_OS_COREGETACCOUNTINGTIMER_M
+      Verify that, if OS_CFG_THREAD_ACCOUNTING is enabled, the AccountingTimer pointer of each AUTOSAR Core is valid.
 
 \CM CM_OS_COREASR_RESOURCEREFS_M
       Verify that:
@@ -3964,6 +4092,12 @@ Justifications for Variant Coverage:
            All uncovered derivatives contain only modules which are tested by a derivative under regression.
            The compliance with a specific derivative under test is assured by the Equivalence Hardware Architecture Check.
 
+\ID COV_OS_PRIORITYQUEUEARITY
+   \ACCEPT TX
+   \ACCEPT XF
+   \REASON The condition selects the configured arity of the priority queue heap. Only one arity is used per
+           configuration. Apart from the index calculation, the heap code does not depend on the arity.
+
 \ID COV_OS_DERIVATIVEDUMMYMODULE
    \ACCEPT TX
    \REASON The uncovered code only contains empty dummy implementations to avoid compile errors for specific derivative
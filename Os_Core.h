@@ -170,6 +170,19 @@ P2VAR(Os_CoreAsrType, AUTOMATIC, OS_VAR_NOINIT), OS_CODE, OS_ALWAYS_INLINE, Os_C
 }
 
 
+/***********************************************************************************************************************
+ *  Os_CoreAsrGetMpActive()
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE                                                                            /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+P2VAR(Os_MpActiveType, AUTOMATIC, OS_VAR_NOINIT), OS_CODE, OS_ALWAYS_INLINE, Os_CoreAsrGetMpActive,
+(
+  P2CONST(Os_CoreAsrConfigType, AUTOMATIC, OS_CONST) Core
+))
+{
+  return &(Core->Dyn->MpActive);
+}
+
+
 /***********************************************************************************************************************
  *  Os_CoreAsrGetTimingProtection()
  **********************************************************************************************************************/
@@ -195,6 +208,32 @@ P2VAR(Os_TraceCoreType, TYPEDEF, OS_VAR_NOINIT), OS_CODE, OS_ALWAYS_INLINE, Os_C
 }
 
 
+/***********************************************************************************************************************
+ *  Os_CoreGetTraceRecorder()
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE                                                                            /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+P2CONST(Os_TraceRecorderConfigType, TYPEDEF, OS_CONST), OS_CODE, OS_ALWAYS_INLINE, Os_CoreGetTraceRecorder,
+(
+  P2CONST(Os_CoreConfigType, AUTOMATIC, OS_CONST) Core
+))
+{
+  return Core->TraceRecorder;
+}
+
+
+/***********************************************************************************************************************
+ *  Os_CoreGetAccountingTimer()
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE                                                                            /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+P2CONST(Os_Hal_TimerFrtConfigType, TYPEDEF, OS_CONST), OS_CODE, OS_ALWAYS_INLINE, Os_CoreGetAccountingTimer,
+(
+  P2CONST(Os_CoreConfigType, AUTOMATIC, OS_CONST) Core
+))
+{
+  return Core->AccountingTimer;
+}
+
+
 /***********************************************************************************************************************
  *  Os_CoreAsrGetBarriers()
  **********************************************************************************************************************/
@@ -931,6 +970,28 @@ Os_CoreInitialEnableInterruptSources,
 }
 
 
+/***********************************************************************************************************************
+ *  Os_CoreTicklessLeave()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,                                           /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+Os_CoreTicklessLeave,
+(
+  P2CONST(Os_CoreAsrConfigType, AUTOMATIC, OS_CONST) Core
+))
+{
+  /* #10 If the periodic ticks of the tickless timers are suppressed, catch up the elapsed ticks. */
+  if(OS_UNLIKELY(Os_CoreAsrGetDyn(Core)->IsTickless == TRUE))                                                           /* SBSW_OS_FC_PRECONDITION */
+  {
+    Os_CoreTicklessCatchUp(Core);                                                                                       /* SBSW_OS_FC_PRECONDITION */
+  }
+}
+
+
 # define OS_STOP_SEC_CODE
 # include "Os_MemMap_OsCode.h"                                                                                          /* PRQA S 5087 */ /* MD_MSR_MemMap */
 
@@ -154,15 +154,17 @@
 # include "Os_SpinlockInt.h"
 # include "Os_BarrierInt.h"
 # include "Os_DequeInt.h"
-# include "Os_MemoryProtection_Types.h"
+# include "Os_MemoryProtectionInt.h"
 # include "Os_Trace_Types.h"
 # include "Os_Thread_Types.h"
 # include "Os_Task_Types.h"
+# include "Os_Timer_Types.h"
 
 /* Os Hal dependencies */
 # include "Os_Hal_OsInt.h"
 # include "Os_Hal_CoreInt.h"
 # include "Os_Hal_CompilerInt.h"
+# include "Os_Hal_TimerInt.h"
 
 
 /***********************************************************************************************************************
@@ -322,6 +324,12 @@ struct Os_CoreConfigType_Tag
   /*! Trace information for this core */
   P2VAR(Os_TraceCoreType, TYPEDEF, OS_VAR_NOINIT) Trace;
 
+  /*! Built-in trace recorder of this core. NULL_PTR, if the trace recorder is disabled. */
+  P2CONST(Os_TraceRecorderConfigType, TYPEDEF, OS_CONST) TraceRecorder;
+
+  /*! Timer for the runtime accounting of the threads of this core. NULL_PTR, if runtime accounting is disabled. */
+  P2CONST(Os_Hal_TimerFrtConfigType, TYPEDEF, OS_CONST) AccountingTimer;
+
   /*! Tells whether the core can be started as an AUTOSAR core. */
   boolean IsAsrCore;
 
@@ -368,11 +376,17 @@ struct Os_CoreAsrType_Tag
   /*! The mode of the idle behavior. */
   IdleModeType IdleMode;
 
+  /*! Tells whether the periodic ticks of the tickless timers are currently suppressed. */
+  boolean IsTickless;
+
   /*! Tells which hook is currently executing. */
   Os_HookInfoType HookInfo;
 
   /*! The currently active stack configuration. */
   Os_StackConfigRefType CurrentStack;
+
+  /*! The access rights which are programmed into the memory protection hardware. */
+  Os_MpActiveType MpActive;
 };
 
 
@@ -491,6 +505,12 @@ struct Os_CoreAsrConfigType_Tag
   /*! Number of core ISR configurations */
   Os_ObjIdxType IsrCount;
 
+  /*! List of PFRT driven counters, which suppress their periodic ticks in idle mode IDLE_TICKLESS. */
+  P2CONST(Os_TimerPfrtConfigRefType, TYPEDEF, OS_CONST) TicklessTimerRefs;
+
+  /*! Number of tickless timers. */
+  Os_ObjIdxType TicklessTimerCount;
+
 };
 
 
@@ -807,6 +827,30 @@ OS_ALWAYS_INLINE, Os_CoreAsrGetDyn,
 ));
 
 
+/***********************************************************************************************************************
+ *  Os_CoreAsrGetMpActive()
+ **********************************************************************************************************************/
+/*! \brief          Returns the active memory protection access rights of an AUTOSAR core.
+ *  \details        --no details--
+ *
+ *  \param[in]      Core        The core to query. Parameter must not be NULL.
+ *
+ *  \return         The pointer to the active access rights of the core.
+ *
+ *  \context        OS_INTERNAL
+ *
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *
+ *  \pre            -
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE P2VAR(Os_MpActiveType, AUTOMATIC, OS_VAR_NOINIT), OS_CODE,
+OS_ALWAYS_INLINE, Os_CoreAsrGetMpActive,
+(
+  P2CONST(Os_CoreAsrConfigType, AUTOMATIC, OS_CONST) Core
+));
+
+
 /***********************************************************************************************************************
  *  Os_CoreAsrGetTimingProtection()
  **********************************************************************************************************************/
@@ -840,7 +884,8 @@ OS_ALWAYS_INLINE, Os_CoreAsrGetTimingProtection,
  *
  *  \param[in]      Core        The core to query. Parameter must not be NULL.
  *
- *  \return         The trace pointer of the given core. The pointer is always valid, if ORTI tracing is enabled.
+ *  \return         The trace pointer of the given core. The pointer is always valid, if ORTI tracing or runtime
+ *                  accounting is enabled.
  *
  *  \context        ANY
  *
@@ -856,6 +901,56 @@ P2VAR(Os_TraceCoreType, TYPEDEF, OS_VAR_NOINIT), OS_CODE, OS_ALWAYS_INLINE, Os_C
 ));
 
 
+/***********************************************************************************************************************
+ *  Os_CoreGetTraceRecorder()
+ **********************************************************************************************************************/
+/*! \brief          Returns the built-in trace recorder of a core.
+ *  \details        --no details--
+ *
+ *  \param[in]      Core        The core to query. Parameter must not be NULL.
+ *
+ *  \return         The trace recorder of the given core. The pointer is always valid, if the trace recorder is
+ *                  enabled.
+ *
+ *  \context        ANY
+ *
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *
+ *  \pre            -
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE
+P2CONST(Os_TraceRecorderConfigType, TYPEDEF, OS_CONST), OS_CODE, OS_ALWAYS_INLINE, Os_CoreGetTraceRecorder,
+(
+  P2CONST(Os_CoreConfigType, AUTOMATIC, OS_CONST) Core
+));
+
+
+/***********************************************************************************************************************
+ *  Os_CoreGetAccountingTimer()
+ **********************************************************************************************************************/
+/*! \brief          Returns the timer for the runtime accounting of the threads of a core.
+ *  \details        --no details--
+ *
+ *  \param[in]      Core        The core to query. Parameter must not be NULL.
+ *
+ *  \return         The accounting timer of the given core. The pointer is always valid, if runtime accounting is
+ *                  enabled.
+ *
+ *  \context        ANY
+ *
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *
+ *  \pre            -
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE
+P2CONST(Os_Hal_TimerFrtConfigType, TYPEDEF, OS_CONST), OS_CODE, OS_ALWAYS_INLINE, Os_CoreGetAccountingTimer,
+(
+  P2CONST(Os_CoreConfigType, AUTOMATIC, OS_CONST) Core
+));
+
+
 /***********************************************************************************************************************
  *  Os_CoreAsrGetBarriers()
  **********************************************************************************************************************/
@@ -1904,6 +1999,52 @@ FUNC(Os_StatusType, OS_CODE) Os_CoreControlIdle
 );
 
 
+/***********************************************************************************************************************
+ *  Os_CoreTicklessCatchUp()
+ **********************************************************************************************************************/
+/*! \brief          Resumes the periodic ticks of all tickless timers of the given core.
+ *  \details        The ticks which have elapsed since the core entered tickless idle are added to the counters in one
+ *                  step.
+ *
+ *  \param[in]      Core     The local core. Parameter must not be NULL.
+ *
+ *  \context        OS_INTERNAL
+ *
+ *  \reentrant      FALSE
+ *  \synchronous    TRUE
+ *
+ *  \pre            Interrupts are disabled.
+ *  \pre            The given core is the local core.
+ **********************************************************************************************************************/
+FUNC(void, OS_CODE) Os_CoreTicklessCatchUp
+(
+  P2CONST(Os_CoreAsrConfigType, AUTOMATIC, OS_CONST) Core
+);
+
+
+/***********************************************************************************************************************
+ *  Os_CoreTicklessLeave()
+ **********************************************************************************************************************/
+/*! \brief          Leaves tickless idle, if the periodic ticks of the given core are currently suppressed.
+ *  \details        Each category 2 ISR calls this function before any counter may be accessed.
+ *
+ *  \param[in]      Core     The local core. Parameter must not be NULL.
+ *
+ *  \context        OS_INTERNAL
+ *
+ *  \reentrant      FALSE
+ *  \synchronous    TRUE
+ *
+ *  \pre            Interrupts are disabled.
+ *  \pre            The given core is the local core.
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,
+Os_CoreTicklessLeave,
+(
+  P2CONST(Os_CoreAsrConfigType, AUTOMATIC, OS_CONST) Core
+));
+
+
 /***********************************************************************************************************************
  *  Os_CoreInitialEnableInterruptSources()
  **********************************************************************************************************************/
@@ -373,6 +373,160 @@ OS_ALWAYS_INLINE, Os_Counter2TimerPfrt,
 ));
 
 
+/***********************************************************************************************************************
+ *  Os_CounterWheelUpdate()
+ **********************************************************************************************************************/
+/*! \brief          Moves the time of the counter's timing wheel towards Now and returns an expired job.
+ *  \details        The wheel time is moved slot by slot as long as no job is expired. Reached slots of higher levels
+ *                  are cascaded. If there is no further used slot until Now, the wheel time is moved to Now.
+ *
+ *  \param[in,out]  Counter     The counter to modify. Parameter must not be NULL.
+ *  \param[in]      Now         The current physical counter value.
+ *
+ *  \return         An expired job.
+ *  \retval         NULL_PTR    No job expired until Now.
+ *
+ *  \context        OS_INTERNAL
+ *
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *
+ *  \pre            Concurrent access to given object is prevented by caller.
+ *  \pre            The counter keeps its jobs in a timing wheel.
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE P2CONST(Os_JobConfigType, AUTOMATIC, OS_CONST), OS_CODE,
+OS_ALWAYS_INLINE, Os_CounterWheelUpdate,
+(
+  P2CONST(Os_CounterConfigType, AUTOMATIC, OS_CONST) Counter,
+  Os_TickType Now
+));
+
+
+/***********************************************************************************************************************
+ *  Os_CounterWheelSetCompareValue()
+ **********************************************************************************************************************/
+/*! \brief          Sets the compare value to the next event of the counter's timing wheel.
+ *  \details        If the wheel is empty, the compare value is set as far as possible into the future.
+ *                  The wheel time is only moved by the tick path. If the next event has already been reached in the
+ *                  meantime, the wheel time is brought up to date first, so that the compare value is not set into
+ *                  the past.
+ *
+ *  \param[in,out]  Counter     The counter to modify. Parameter must not be NULL.
+ *
+ *  \context        OS_INTERNAL
+ *
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *
+ *  \pre            Concurrent access to given object is prevented by caller.
+ *  \pre            The counter keeps its jobs in a timing wheel.
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE, Os_CounterWheelSetCompareValue,
+(
+  P2CONST(Os_CounterConfigType, AUTOMATIC, OS_CONST) Counter
+));
+
+
+/***********************************************************************************************************************
+ *  Os_CounterJobInsert()
+ **********************************************************************************************************************/
+/*! \brief          Enqueues the job in the counter's job store and updates the compare value if needed.
+ *  \details        The job store is either the priority queue or the timing wheel of the counter.
+ *
+ *  \param[in,out]  Counter     The counter to modify. Parameter must not be NULL.
+ *  \param[in]      Job         The job to enqueue. Parameter must not be NULL.
+ *
+ *  \context        OS_INTERNAL
+ *
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *
+ *  \pre            Concurrent access to given object is prevented by caller.
+ *  \pre            The expiration time stamp of the job is set.
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE, Os_CounterJobInsert,
+(
+  P2CONST(Os_CounterConfigType, AUTOMATIC, OS_CONST) Counter,
+  P2CONST(Os_JobConfigType, AUTOMATIC, OS_CONST) Job
+));
+
+
+/***********************************************************************************************************************
+ *  Os_CounterWheelWorkJobs()
+ **********************************************************************************************************************/
+/*! \brief          Works off all expired jobs of the counter's timing wheel.
+ *  \details        Interrupts are opened for a short time after MAX_JOB_EXECS_PER_LOCK jobs.
+ *
+ *  \param[in,out]  Counter         The counter to work. Parameter must not be NULL.
+ *  \param[in,out]  InterruptState  The interrupt state which has been saved by Os_IntSuspend().
+ *                                  Parameter must not be NULL.
+ *
+ *  \context        OS_INTERNAL
+ *
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *
+ *  \pre            Interrupts are suspended.
+ *  \pre            The counter keeps its jobs in a timing wheel.
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE, Os_CounterWheelWorkJobs,
+(
+  P2CONST(Os_CounterConfigType, AUTOMATIC, OS_CONST) Counter,
+  P2VAR(Os_IntStateType, AUTOMATIC, AUTOMATIC) InterruptState
+));
+
+
+/***********************************************************************************************************************
+ *  Os_CounterQueueWorkJobs()
+ **********************************************************************************************************************/
+/*! \brief          Works off all expired jobs of the counter's priority queue.
+ *  \details        The expired jobs are removed in batches of up to MAX_JOB_EXECS_PER_LOCK jobs. Each batch costs a
+ *                  single repair of the heap. Interrupts are opened for a short time after MAX_JOB_EXECS_PER_LOCK jobs.
+ *                  Jobs which are reloaded by Os_JobDo() are inserted into the already repaired queue.
+ *
+ *  \param[in,out]  Counter         The counter to work. Parameter must not be NULL.
+ *  \param[in,out]  InterruptState  The interrupt state which has been saved by Os_IntSuspend().
+ *                                  Parameter must not be NULL.
+ *
+ *  \context        OS_INTERNAL
+ *
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *
+ *  \pre            Interrupts are suspended.
+ *  \pre            The counter keeps its jobs in a priority queue.
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE, Os_CounterQueueWorkJobs,
+(
+  P2CONST(Os_CounterConfigType, AUTOMATIC, OS_CONST) Counter,
+  P2VAR(Os_IntStateType, AUTOMATIC, AUTOMATIC) InterruptState
+));
+
+
+/***********************************************************************************************************************
+ *  Os_CounterQueueDeleteJob()
+ **********************************************************************************************************************/
+/*! \brief          Removes the job from the counter's priority queue and updates the compare value if needed.
+ *  \details        --no details--
+ *
+ *  \param[in,out]  Counter     The counter to modify. Parameter must not be NULL.
+ *  \param[in]      Job         The job to remove. Parameter must not be NULL.
+ *
+ *  \context        OS_INTERNAL
+ *
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *
+ *  \pre            Concurrent access to given object is prevented by caller.
+ *  \pre            The job is part of the counter's priority queue.
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE, Os_CounterQueueDeleteJob,
+(
+  P2CONST(Os_CounterConfigType, AUTOMATIC, OS_CONST) Counter,
+  P2CONST(Os_JobConfigType, AUTOMATIC, OS_CONST) Job
+));
+
+
 /***********************************************************************************************************************
  *  LOCAL FUNCTIONS
  **********************************************************************************************************************/
@@ -631,6 +785,315 @@ FUNC(Os_TickType, OS_CODE) Os_CounterSub
 }
 
 
+/***********************************************************************************************************************
+ *  Os_CounterGetTimestamp()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ */
+FUNC(Os_TickType, OS_CODE) Os_CounterGetTimestamp
+(
+  P2CONST(Os_CounterConfigType, AUTOMATIC, OS_CONST) Counter,
+  Os_TickType Offset
+)
+{
+  Os_Assert((Os_StdReturnType)(Offset <= Counter->Characteristics.MaxAllowedValue));                                    /* PRQA S 4304 */ /* MD_Os_C90BooleanCompatibility */
+
+  /* #10 Return mod(now + Offset). */
+  return Os_TimerAdd(Counter->Characteristics.MaxCountingValue,
+                     Os_CounterGetPhysicalValue(Counter),                                                               /* SBSW_OS_FC_PRECONDITION */
+                     Offset);
+}
+
+
+/***********************************************************************************************************************
+ *  Os_CounterWheelUpdate()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE P2CONST(Os_JobConfigType, AUTOMATIC, OS_CONST), OS_CODE,
+OS_ALWAYS_INLINE, Os_CounterWheelUpdate,
+(
+  P2CONST(Os_CounterConfigType, AUTOMATIC, OS_CONST) Counter,
+  Os_TickType Now
+))
+{
+  P2CONST(Os_TimingWheelConfigType, AUTOMATIC, OS_CONST) jobWheel = Counter->JobWheel;
+  P2CONST(Os_JobConfigType, AUTOMATIC, OS_CONST) job;
+
+  job = Os_TimingWheelTopGet(jobWheel);                                                                                 /* SBSW_OS_CNT_TIMINGWHEEL_001 */
+
+  /* #10 Repeat until a job is expired: */
+  while(job == NULL_PTR)
+  {
+    Os_TickType reference = Os_TimingWheelReferenceGet(jobWheel);                                                       /* SBSW_OS_CNT_TIMINGWHEEL_001 */
+    Os_TickType elapsed = Os_TimerSub(Counter->Characteristics.MaxCountingValue, Now, reference);
+    Os_TimingWheelTimeType nextEvent = elapsed;
+
+    if(Os_TimingWheelIsEmpty(jobWheel) == 0u)                                                                           /* SBSW_OS_CNT_TIMINGWHEEL_001 */
+    {
+      nextEvent = Os_TimingWheelNextEventGet(jobWheel);                                                                 /* SBSW_OS_CNT_TIMINGWHEEL_001 */
+    }
+
+    /* #20 If the next used slot is not reached before Now, move the wheel time to Now and stop. */
+    if(nextEvent >= elapsed)
+    {
+      Os_TimingWheelAdvance(jobWheel, elapsed, Now);                                                                    /* SBSW_OS_CNT_TIMINGWHEEL_001 */
+      job = Os_TimingWheelTopGet(jobWheel);                                                                             /* SBSW_OS_CNT_TIMINGWHEEL_001 */
+      break;
+    }
+
+    /* #30 Otherwise move the wheel time to the next used slot. */
+    Os_TimingWheelAdvance(jobWheel,                                                                                     /* SBSW_OS_CNT_TIMINGWHEEL_001 */
+                          nextEvent,
+                          Os_TimerAdd(Counter->Characteristics.MaxCountingValue, reference, nextEvent));
+    job = Os_TimingWheelTopGet(jobWheel);                                                                               /* SBSW_OS_CNT_TIMINGWHEEL_001 */
+  }
+
+  return job;
+}
+
+
+/***********************************************************************************************************************
+ *  Os_CounterWheelSetCompareValue()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE, Os_CounterWheelSetCompareValue,
+(
+  P2CONST(Os_CounterConfigType, AUTOMATIC, OS_CONST) Counter
+))
+{
+  P2CONST(Os_TimingWheelConfigType, AUTOMATIC, OS_CONST) jobWheel = Counter->JobWheel;
+  Os_TickType now = Os_CounterGetPhysicalValue(Counter);                                                                /* SBSW_OS_FC_PRECONDITION */
+  Os_TickType expirationTimestamp;
+
+  /* #10 If the wheel is empty, set compare value as far as possible into the future. */
+  if(Os_TimingWheelIsEmpty(jobWheel) != 0u)                                                                             /* SBSW_OS_CNT_TIMINGWHEEL_001 */
+  {
+    expirationTimestamp = Os_TimerAdd(
+        Counter->Characteristics.MaxCountingValue,
+        now,
+        Counter->Characteristics.MaxAllowedValue);
+  }
+  /* #20 Otherwise: */
+  else
+  {
+    Os_TickType elapsed = Os_TimerSub(Counter->Characteristics.MaxCountingValue,
+                                      now,
+                                      Os_TimingWheelReferenceGet(jobWheel));                                            /* SBSW_OS_CNT_TIMINGWHEEL_001 */
+
+    /* #30 If the next used slot has already been reached, move the wheel time towards now. */
+    if(Os_TimingWheelNextEventGet(jobWheel) <= elapsed)                                                                 /* SBSW_OS_CNT_TIMINGWHEEL_001 */
+    {
+      (void)Os_CounterWheelUpdate(Counter, now);                                                                        /* SBSW_OS_FC_PRECONDITION */
+    }
+
+    /* #40 Set compare value to the time of the next used slot. */
+    expirationTimestamp = Os_TimerAdd(
+        Counter->Characteristics.MaxCountingValue,
+        Os_TimingWheelReferenceGet(jobWheel),                                                                           /* SBSW_OS_CNT_TIMINGWHEEL_001 */
+        Os_TimingWheelNextEventGet(jobWheel));                                                                          /* SBSW_OS_CNT_TIMINGWHEEL_001 */
+  }
+
+  Os_CounterSetCompareValue(Counter, expirationTimestamp);                                                              /* SBSW_OS_FC_PRECONDITION */
+}
+
+
+/***********************************************************************************************************************
+ *  Os_CounterJobInsert()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ *
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE, Os_CounterJobInsert,
+(
+  P2CONST(Os_CounterConfigType, AUTOMATIC, OS_CONST) Counter,
+  P2CONST(Os_JobConfigType, AUTOMATIC, OS_CONST) Job
+))
+{
+  /* #10 If the counter keeps its jobs in a timing wheel: */
+  if(Counter->JobWheel != NULL_PTR)
+  {
+    P2CONST(Os_TimingWheelConfigType, AUTOMATIC, OS_CONST) jobWheel = Counter->JobWheel;
+    Os_TickType expirationTime = Os_JobGetExpirationTimestamp(Job);                                                     /* SBSW_OS_FC_PRECONDITION */
+    Os_TickType now = Os_CounterGetPhysicalValue(Counter);                                                              /* SBSW_OS_FC_PRECONDITION */
+    Os_TimingWheelTimeType delay;
+
+    /* #20 The tick path keeps the wheel time up to date only while the wheel has jobs. If the wheel is empty, move
+     *     its time to now, so that the delay is calculated from a reference within the counter range. */
+    if(Os_TimingWheelIsEmpty(jobWheel) != 0u)                                                                           /* SBSW_OS_CNT_TIMINGWHEEL_001 */
+    {
+      Os_TimingWheelAdvance(jobWheel,                                                                                   /* SBSW_OS_CNT_TIMINGWHEEL_001 */
+                            Os_TimerSub(Counter->Characteristics.MaxCountingValue,
+                                        now,
+                                        Os_TimingWheelReferenceGet(jobWheel)),                                          /* SBSW_OS_CNT_TIMINGWHEEL_001 */
+                            now);
+    }
+
+    /* #30 A job which is not in the future expires now. */
+    if(Os_CounterIsFutureValue(Counter, expirationTime, now) == 0u)                                                     /* SBSW_OS_FC_PRECONDITION */
+    {
+      expirationTime = now;
+    }
+
+    /* #40 Calculate the delay from the wheel time. The wheel time is not moved here, as it never is ahead of now. */
+    delay = Os_TimerSub(Counter->Characteristics.MaxCountingValue,
+                        expirationTime,
+                        Os_TimingWheelReferenceGet(jobWheel));                                                          /* SBSW_OS_CNT_TIMINGWHEEL_001 */
+
+    /* #50 Insert the job. If the next event of the wheel has changed, update timer's compare value. */
+    if(Os_TimingWheelInsert(jobWheel, Job, delay) != 0u)                                                                /* SBSW_OS_CNT_TIMINGWHEEL_001 */
+    {
+      Os_CounterWheelSetCompareValue(Counter);                                                                          /* SBSW_OS_FC_PRECONDITION */
+    }
+  }
+  /* #60 Otherwise: */
+  else
+  {
+    P2CONST(Os_PriorityQueueConfigType, AUTOMATIC, OS_CONST) jobQueue = &(Counter->JobQueue);
+
+    /* #70 Enqueue the given job in counter's job queue. */
+    Os_PriorityQueueInsert(jobQueue, Job);                                                                              /* SBSW_OS_FC_PRECONDITION */
+
+    /* #80 If the top element of the queue has changed, update timer's compare value. */
+    if(Job == Os_PriorityQueueTopGet(jobQueue))                                                                         /* SBSW_OS_FC_PRECONDITION */
+    {
+      Os_CounterSetCompareValue(Counter, Os_JobGetExpirationTimestamp(Job));                                            /* SBSW_OS_FC_PRECONDITION */
+    }
+  }
+}                                                                                                                       /* PRQA S 6050 */ /* MD_MSR_STCAL */
+
+
+/***********************************************************************************************************************
+ *  Os_CounterWheelWorkJobs()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE, Os_CounterWheelWorkJobs,
+(
+  P2CONST(Os_CounterConfigType, AUTOMATIC, OS_CONST) Counter,
+  P2VAR(Os_IntStateType, AUTOMATIC, AUTOMATIC) InterruptState
+))
+{
+  P2CONST(Os_JobConfigType, AUTOMATIC, OS_CONST) job;
+  uint8 jobCounter = 0u;
+
+  job = Os_CounterWheelUpdate(Counter, Os_CounterGetPhysicalValue(Counter));                                            /* SBSW_OS_FC_PRECONDITION */
+
+  /* #10 Repeat until there are no expired jobs in the wheel: */
+  while(OS_LIKELY(job != NULL_PTR))
+  {
+    /* #20 Dequeue the job. */
+    Os_TimingWheelDeleteTop(Counter->JobWheel);                                                                         /* SBSW_OS_CNT_TIMINGWHEEL_001 */
+
+    /* #30 Work the job off. */
+    Os_JobDo(job);                                                                                                      /* SBSW_OS_FC_PRECONDITION */
+
+    /* #40 Increment the local job counter. */
+    jobCounter = jobCounter + 1u;
+
+    /* #50 If the maximum number of job executions per interrupt lock is reached: */
+    if (jobCounter >= MAX_JOB_EXECS_PER_LOCK)
+    {
+      jobCounter = 0u;
+
+      /* #60 Open interrupts for a short time to allow interrupts of higher priority. */
+      Os_IntResume(InterruptState);                                                                                     /* SBSW_OS_FC_PRECONDITION */
+      Os_IntSuspend(InterruptState);                                                                                    /* SBSW_OS_FC_PRECONDITION */
+    }
+
+    /* #70 Get the next expired job. (We have a continuously changing FRT here.) */
+    job = Os_CounterWheelUpdate(Counter, Os_CounterGetPhysicalValue(Counter));                                          /* SBSW_OS_FC_PRECONDITION */
+  }
+}
+
+
+/***********************************************************************************************************************
+ *  Os_CounterQueueWorkJobs()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ *
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE, Os_CounterQueueWorkJobs,
+(
+  P2CONST(Os_CounterConfigType, AUTOMATIC, OS_CONST) Counter,
+  P2VAR(Os_IntStateType, AUTOMATIC, AUTOMATIC) InterruptState
+))
+{
+  Os_PriorityQueueNodeType dueJobs[MAX_JOB_EXECS_PER_LOCK];
+  Os_PriorityQueueNodeIdxType dueCount;
+  Os_PriorityQueueNodeIdxType jobCounter = 0u;
+
+  /* #10 Repeat until there are no expired jobs in the queue: */
+  do
+  {
+    Os_PriorityQueueNodeIdx_IteratorType idx;
+
+    /* #20 Get counter's current value. (We have a continuously changing FRT here.) */
+    Os_TickType now = Os_CounterGetPhysicalValue(Counter);                                                              /* SBSW_OS_FC_PRECONDITION */
+
+    /* #30 Dequeue the expired jobs, which may still be worked off within this interrupt lock. */
+    dueCount = Os_PriorityQueueDeleteDue(&(Counter->JobQueue),                                                          /* SBSW_OS_CNT_PRIORITYQUEUEDELETEDUE_001 */
+                                         now,
+                                         dueJobs,
+                                         (Os_PriorityQueueNodeIdxType)(MAX_JOB_EXECS_PER_LOCK - jobCounter));
+
+    /* #40 Work the jobs off in expiration order. */
+    for(idx = 0u; idx < dueCount; idx++)
+    {
+      Os_JobDo(dueJobs[idx].Data);                                                                                      /* SBSW_OS_CNT_JOBDO_001 */
+    }
+
+    /* #50 Increment the local job counter. */
+    jobCounter = jobCounter + dueCount;
+
+    /* #60 If the maximum number of job executions per interrupt lock is reached: */
+    if (jobCounter >= MAX_JOB_EXECS_PER_LOCK)
+    {
+      jobCounter = 0u;
+
+      /* #70 Open interrupts for a short time to allow interrupts of higher priority. */
+      Os_IntResume(InterruptState);                                                                                     /* SBSW_OS_FC_PRECONDITION */
+      Os_IntSuspend(InterruptState);                                                                                    /* SBSW_OS_FC_PRECONDITION */
+    }
+  } while(dueCount > 0u);
+}
+
+
 /***********************************************************************************************************************
  *  GLOBAL FUNCTIONS
  **********************************************************************************************************************/
@@ -673,8 +1136,15 @@ FUNC(void, OS_CODE) Os_CounterInit
       break;                                                                                                            /* PRQA S 2880 */ /* MD_Os_Rule2.1_2880_NonReturning */
   }
 
-  /* #20 Initialize the priority queue */
-  Os_PriorityQueueInit(&(Counter->JobQueue));                                                                           /* SBSW_OS_FC_PRECONDITION */
+  /* #20 Initialize the job store: either the timing wheel or the priority queue */
+  if(Counter->JobWheel != NULL_PTR)
+  {
+    Os_TimingWheelInit(Counter->JobWheel);                                                                              /* SBSW_OS_CNT_TIMINGWHEEL_001 */
+  }
+  else
+  {
+    Os_PriorityQueueInit(&(Counter->JobQueue));                                                                         /* SBSW_OS_FC_PRECONDITION */
+  }
 }                                                                                                                       /* PRQA S 6050 */ /* MD_MSR_STCAL */
 
 
@@ -782,74 +1252,52 @@ FUNC(void, OS_CODE) Os_CounterWorkJobs
   P2CONST(Os_CounterConfigType, AUTOMATIC, OS_CONST) Counter
 )
 {
-  P2CONST(Os_JobConfigType, AUTOMATIC, OS_CONST) job;
-  P2CONST(Os_PriorityQueueConfigType, AUTOMATIC, OS_CONST) jobQueue = &(Counter->JobQueue);
   Os_IntStateType interruptState;
-  uint8 jobCounter = 0u;
 
   /* #10 Suspend interrupts */
   Os_IntSuspend(&interruptState);                                                                                       /* SBSW_OS_FC_POINTER2LOCAL */
 
-  job = Os_PriorityQueueTopGet(jobQueue);                                                                               /* SBSW_OS_FC_PRECONDITION */
-
-  /* #20 Repeat until queue is empty OR there are no expired jobs in the queue: */
-  while(OS_LIKELY(job != NULL_PTR))
+  /* #20 If the counter keeps its jobs in a timing wheel: */
+  if(Counter->JobWheel != NULL_PTR)
   {
-    /* #30 Get counter's current value. (We have a continuously changing FRT here.) */
-    Os_TickType now = Os_CounterGetPhysicalValue(Counter);                                                              /* SBSW_OS_FC_PRECONDITION */
-
-    /* #40 If the high prio job is expired (likely): */
-    if(OS_LIKELY(Os_CounterIsFutureValue(Counter, job->Dyn->ExpirationTimestamp, now) == 0u))                           /* SBSW_OS_FC_PRECONDITION */
-    {
-      /* #50 Dequeue the job. */
-      Os_PriorityQueueDeleteTop(jobQueue);                                                                              /* SBSW_OS_FC_PRECONDITION */
+    /* #30 Work off all expired jobs of the wheel. */
+    Os_CounterWheelWorkJobs(Counter, &interruptState);                                                                  /* SBSW_OS_FC_POINTER2LOCAL */
 
-      /* #60 Work the job off. */
-      Os_JobDo(job);                                                                                                    /* SBSW_OS_FC_PRECONDITION */
+    /* #40 Set compare value to the next used slot of the wheel. */
+    Os_CounterWheelSetCompareValue(Counter);                                                                            /* SBSW_OS_FC_PRECONDITION */
+  }
+  /* #50 Otherwise: */
+  else
+  {
+    P2CONST(Os_JobConfigType, AUTOMATIC, OS_CONST) job;
 
-      /* #70 Increment the local job counter. */
-      jobCounter = jobCounter + 1u;
+    /* #60 Work off all expired jobs of the queue. */
+    Os_CounterQueueWorkJobs(Counter, &interruptState);                                                                  /* SBSW_OS_FC_POINTER2LOCAL */
 
-      /* #80 If the maximum number of job executions per interrupt lock is reached: */
-      if (jobCounter >= MAX_JOB_EXECS_PER_LOCK)
-      {
-        jobCounter = 0u;
+    job = Os_PriorityQueueTopGet(&(Counter->JobQueue));                                                                 /* SBSW_OS_FC_PRECONDITION */
 
-        /* #90 Open interrupts for a short time to allow interrupts of higher priority. */
-        Os_IntResume(&interruptState);                                                                                  /* SBSW_OS_FC_POINTER2LOCAL */
-        Os_IntSuspend(&interruptState);                                                                                 /* SBSW_OS_FC_POINTER2LOCAL */
-      }
+    /* #70 If the queue still contains jobs: */
+    if(job != NULL_PTR)
+    {
+      /* #80 Set compare value to expiration time of next job. */
+      Os_CounterSetCompareValue(Counter, job->Dyn->ExpirationTimestamp);                                                /* SBSW_OS_FC_PRECONDITION */
     }
+    /* #90 else */
     else
     {
-      break;
-    }
-
-    /* #100 Get high prio job from queue. */
-    job = Os_PriorityQueueTopGet(jobQueue);                                                                             /* SBSW_OS_FC_PRECONDITION */
-  }
-
-  /* #110 If the queue still contains jobs: */
-  if(job != NULL_PTR)
-  {
-    /* #120 Set compare value to expiration time of next job. */
-    Os_CounterSetCompareValue(Counter, job->Dyn->ExpirationTimestamp);                                                  /* SBSW_OS_FC_PRECONDITION */
-  }
-  /* #130 else */
-  else
-  {
-    /* #140 Set compare value far into the future. */
-    Os_TickType now = Os_CounterGetPhysicalValue(Counter);                                                              /* SBSW_OS_FC_PRECONDITION */
-    Os_TickType expirationTimestamp;
+      /* #100 Set compare value far into the future. */
+      Os_TickType now = Os_CounterGetPhysicalValue(Counter);                                                            /* SBSW_OS_FC_PRECONDITION */
+      Os_TickType expirationTimestamp;
 
-    expirationTimestamp = Os_TimerAdd(
-        Counter->Characteristics.MaxCountingValue,
-        now,
-        Counter->Characteristics.MaxAllowedValue);
-    Os_CounterSetCompareValue(Counter, expirationTimestamp);                                                            /* SBSW_OS_FC_PRECONDITION */
+      expirationTimestamp = Os_TimerAdd(
+          Counter->Characteristics.MaxCountingValue,
+          now,
+          Counter->Characteristics.MaxAllowedValue);
+      Os_CounterSetCompareValue(Counter, expirationTimestamp);                                                          /* SBSW_OS_FC_PRECONDITION */
+    }
   }
 
-  /* #150 Resume all interrupts. */
+  /* #110 Resume all interrupts. */
   Os_IntResume(&interruptState);                                                                                        /* SBSW_OS_FC_POINTER2LOCAL */
 }                                                                                                                       /* PRQA S 6050 */ /* MD_MSR_STCAL */
 
@@ -929,32 +1377,11 @@ FUNC(void, OS_CODE) Os_CounterAddRelJob
   Os_TickType Offset
 )
 {
-  Os_TickType now;
-  Os_TickType newExpTime;
-  P2CONST(Os_PriorityQueueConfigType, AUTOMATIC, OS_CONST) jobQueue;
-
-  jobQueue = &Counter->JobQueue;
-
-  /* #10 Get the current counter value (now). */
-  now = Os_CounterGetPhysicalValue(Counter);                                                                            /* SBSW_OS_FC_PRECONDITION */
-
-  /* #20 Set job's expiration time to mod(now + Offset). */
-  newExpTime = Os_TimerAdd(
-      Counter->Characteristics.MaxCountingValue,
-      now,
-      Offset);
-
-  Os_JobSetExpirationTimestamp(Job, newExpTime);                                                                        /* SBSW_OS_FC_PRECONDITION */
+  /* #10 Set job's expiration time to mod(now + Offset). */
+  Os_JobSetExpirationTimestamp(Job, Os_CounterGetTimestamp(Counter, Offset));                                           /* SBSW_OS_FC_PRECONDITION */
 
-  /* #30 Enqueue the given job in counter's job queue. */
-  Os_PriorityQueueInsert(jobQueue, Job);                                                                                /* SBSW_OS_FC_PRECONDITION */
-
-  /* #40 If the top element of the queue has changed: */
-  if(Job == Os_PriorityQueueTopGet(jobQueue))                                                                           /* SBSW_OS_FC_PRECONDITION */
-  {
-    /* #50 Update timer's compare value. */
-    Os_CounterSetCompareValue(Counter, newExpTime);                                                                     /* SBSW_OS_FC_PRECONDITION */
-  }
+  /* #20 Enqueue the given job in counter's job store and update timer's compare value, if needed. */
+  Os_CounterJobInsert(Counter, Job);                                                                                    /* SBSW_OS_FC_PRECONDITION */
 }                                                                                                                       /* PRQA S 6050 */ /* MD_MSR_STCAL */
 
 
@@ -977,12 +1404,9 @@ FUNC(void, OS_CODE) Os_CounterAddAbsJob
   Os_TickType Start
 )
 {
-  P2CONST(Os_PriorityQueueConfigType, AUTOMATIC, OS_CONST) jobQueue;
   Os_TickType absStart;
   Os_TickType now;
 
-  jobQueue = &Counter->JobQueue;
-
   /* #10 Get the correct absolute start time for the timer. */
   now = Os_CounterGetPhysicalValue(Counter);                                                                            /* SBSW_OS_FC_PRECONDITION */
   absStart = Os_CounterAbsValue2TimerAbsValue(Counter, now, Start);                                                     /* SBSW_OS_FC_PRECONDITION */
@@ -990,15 +1414,8 @@ FUNC(void, OS_CODE) Os_CounterAddAbsJob
   /* #20 Set job's expiration time to Start. */
   Os_JobSetExpirationTimestamp(Job, absStart);                                                                          /* SBSW_OS_FC_PRECONDITION */
 
-  /* #30 Enqueue the given job in counter's job queue. */
-  Os_PriorityQueueInsert(jobQueue, Job);                                                                                /* SBSW_OS_FC_PRECONDITION */
-
-  /* #40 If the top element of the queue has changed: */
-  if(Job == Os_PriorityQueueTopGet(jobQueue))                                                                           /* SBSW_OS_FC_PRECONDITION */
-  {
-    /* #50 Update timer's compare value. */
-    Os_CounterSetCompareValue(Counter, absStart);                                                                       /* SBSW_OS_FC_PRECONDITION */
-  }
+  /* #30 Enqueue the given job in counter's job store and update timer's compare value, if needed. */
+  Os_CounterJobInsert(Counter, Job);                                                                                    /* SBSW_OS_FC_PRECONDITION */
 }                                                                                                                       /* PRQA S 6050 */ /* MD_MSR_STCAL */
 
 
@@ -1084,9 +1501,6 @@ FUNC(void, OS_CODE) Os_CounterReloadJob
 {
   Os_TickType lastExpTime;
   Os_TickType newExpTime;
-  P2CONST(Os_PriorityQueueConfigType, AUTOMATIC, OS_CONST) jobQueue;
-
-  jobQueue = &Counter->JobQueue;
 
   /* #10 Get the job's current expiration time stamp (lastExpTime). */
   lastExpTime = Os_JobGetExpirationTimestamp(Job);                                                                      /* SBSW_OS_FC_PRECONDITION */
@@ -1099,20 +1513,47 @@ FUNC(void, OS_CODE) Os_CounterReloadJob
 
   Os_JobSetExpirationTimestamp(Job, newExpTime);                                                                        /* SBSW_OS_FC_PRECONDITION */
 
-  /* #30 Enqueue the given job in counter's job queue. */
-  Os_PriorityQueueInsert(jobQueue, Job);                                                                                /* SBSW_OS_FC_PRECONDITION */
+  /* #30 Enqueue the given job in counter's job store and update timer's compare value, if needed. */
+  Os_CounterJobInsert(Counter, Job);                                                                                    /* SBSW_OS_FC_PRECONDITION */
+}                                                                                                                       /* PRQA S 6050 */ /* MD_MSR_STCAL */
+
 
-  /* #40 If the top element of the queue has changed: */
-  if(Job == Os_PriorityQueueTopGet(jobQueue))                                                                           /* SBSW_OS_FC_PRECONDITION */
+/***********************************************************************************************************************
+ *  Os_CounterDeleteJob()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ */
+FUNC(void, OS_CODE) Os_CounterDeleteJob
+(
+  P2CONST(Os_CounterConfigType, AUTOMATIC, OS_CONST) Counter,
+  P2CONST(Os_JobConfigType, AUTOMATIC, OS_CONST) Job
+)
+{
+  /* #10 If the counter keeps its jobs in a timing wheel: */
+  if(Counter->JobWheel != NULL_PTR)
+  {
+    /* #20 Delete the given job from the wheel. If the next event of the wheel has changed, update timer's compare
+     *     value. */
+    if(Os_TimingWheelDelete(Counter->JobWheel, Job) != 0u)                                                              /* SBSW_OS_CNT_TIMINGWHEEL_001 */
+    {
+      Os_CounterWheelSetCompareValue(Counter);                                                                          /* SBSW_OS_FC_PRECONDITION */
+    }
+  }
+  /* #30 Otherwise, delete the given job from the priority queue. */
+  else
   {
-    /* #50 Update timer's compare value. */
-    Os_CounterSetCompareValue(Counter, newExpTime);                                                                     /* SBSW_OS_FC_PRECONDITION */
+    Os_CounterQueueDeleteJob(Counter, Job);                                                                             /* SBSW_OS_FC_PRECONDITION */
   }
-}                                                                                                                       /* PRQA S 6050 */ /* MD_MSR_STCAL */
+}
 
 
 /***********************************************************************************************************************
- *  Os_CounterDeleteJob()
+ *  Os_CounterQueueDeleteJob()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -1123,11 +1564,11 @@ FUNC(void, OS_CODE) Os_CounterReloadJob
  *
  *
  */
-FUNC(void, OS_CODE) Os_CounterDeleteJob
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE, Os_CounterQueueDeleteJob,
 (
   P2CONST(Os_CounterConfigType, AUTOMATIC, OS_CONST) Counter,
   P2CONST(Os_JobConfigType, AUTOMATIC, OS_CONST) Job
-)
+))
 {
   P2CONST(Os_JobConfigType, AUTOMATIC, OS_CONST) topJob;
   P2CONST(Os_PriorityQueueConfigType, AUTOMATIC, OS_CONST) jobQueue;
@@ -1354,6 +1795,85 @@ FUNC(Os_StatusType, OS_CODE) Os_Api_GetCounterValue
 }                                                                                                                       /* PRQA S 6050, 6080 */ /* MD_MSR_STCAL, MD_MSR_STMIF */
 
 
+/***********************************************************************************************************************
+ *  Os_Api_GetCounterValueAsync()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ */
+FUNC(Os_StatusType, OS_CODE) Os_Api_GetCounterValueAsync
+(
+  CounterType CounterID,
+  EventMaskType Mask,
+  Os_AsyncCallRefType Call
+)
+{
+  Os_StatusType status;
+  P2CONST(Os_ThreadConfigType, AUTOMATIC, OS_CONST) currentThread;
+
+  currentThread = Os_CoreGetThread();
+
+  /* #10 Perform error checks. */
+  if(OS_UNLIKELY(Os_ThreadCheckCallContext(currentThread, OS_APICONTEXT_GETCOUNTERVALUE) == OS_CHECK_FAILED))           /* SBSW_OS_CNT_THREADCHECKCALLCONTEXT_001 */
+  {
+    status = OS_STATUS_CALLEVEL;
+  }
+  else if(OS_UNLIKELY(Os_CounterCheckId(CounterID) == OS_CHECK_FAILED))
+  {
+    status = OS_STATUS_ID_1;
+  }
+  else if(OS_UNLIKELY(Os_ThreadCheckAreInterruptsEnabled(currentThread) == OS_CHECK_FAILED))                            /* SBSW_OS_CNT_THREADCHECKAREINTERRUPTSENABLED_001 */
+  {
+    status = OS_STATUS_DISABLEDINT;
+  }
+  else
+  {
+    P2CONST(Os_CounterConfigType, AUTOMATIC, OS_CONST) me = Os_CounterId2Counter(CounterID);
+    P2CONST(Os_AppConfigType, AUTOMATIC, OS_CONST) currentApp = Os_ThreadGetCurrentApplication(currentThread);          /* SBSW_OS_CNT_THREADGETCURRENTAPPLICATION_001 */
+
+    if(OS_UNLIKELY(Os_AppCheckAccess(currentApp, Os_CounterGetAccessingApplications(me)) == OS_CHECK_FAILED))           /* SBSW_OS_CNT_APPCHECKACCESS_001 */ /* SBSW_OS_CNT_COUNTERGETACCESSINGAPPLICATIONS_001 */
+    {
+      status = OS_STATUS_ACCESSRIGHTS_1;
+    }
+    else
+    {
+      status = Os_XSigCheckNotification(currentThread, Mask);                                                           /* SBSW_OS_CNT_XSIGCHECKNOTIFICATION_001 */
+    }
+
+    if(status == OS_STATUS_OK)
+    {
+      /* #20 If the counter belongs to the local core, get the value and complete the call immediately. */
+      if(OS_LIKELY(Os_CoreAsrIsCoreLocal(me->Core) != 0u))                                                              /* SBSW_OS_CNT_COREASRISCORELOCAL_002 */ /* COV_OS_HALPLATFORMMULTICOREUNSUPPORTED */ /* PRQA S 2991, 2995 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule2.2_2995 */
+      {
+        Os_IntStateType interruptState;
+
+        Os_IntSuspend(&interruptState);                                                                                 /* SBSW_OS_FC_POINTER2LOCAL */
+
+        status = Os_CounterGetUserValueLocal(me, &(Call->Tick));                                                        /* SBSW_OS_CNT_COUNTERGETUSERVALUELOCAL_002 */
+
+        Os_IntResume(&interruptState);                                                                                  /* SBSW_OS_FC_POINTER2LOCAL */
+
+        if(status == OS_STATUS_OK)
+        {
+          Os_XSigCompleteLocal(currentThread, Mask, Call);                                                              /* SBSW_OS_CNT_XSIGCOMPLETELOCAL_001 */
+        }
+      }
+      /* #30 Otherwise, send the request to the foreign core without waiting for the result. */
+      else
+      {
+        status = Os_XSigSendRequest_GetCounterValue(me->Core, currentThread, CounterID, Mask, Call);                    /* SBSW_OS_CNT_XSIGSEND_002 */
+      }
+    }
+  }
+
+  return status;
+}                                                                                                                       /* PRQA S 6050, 6080 */ /* MD_MSR_STCAL, MD_MSR_STMIF */
+
+
 /***********************************************************************************************************************
  *  Os_Api_GetElapsedValue()
  **********************************************************************************************************************/
@@ -1543,9 +2063,61 @@ FUNC(Os_StatusType, OS_CODE) Os_Api_GetElapsedValue
  \DESCRIPTION     Os_CounterCheckValueLeMaxAllowed is called with the return value of Os_CounterId2Counter.
  \COUNTERMEASURE  \M [CM_OS_COUNTERID2COUNTER_M]
 
+\ID SBSW_OS_CNT_PRIORITYQUEUEDELETEDUE_001
+ \DESCRIPTION     Os_PriorityQueueDeleteDue is called with the JobQueue of the counter, which is passed as argument,
+                  and with a local array. The passed maximum count does not exceed the size of the local array, because
+                  the local job counter is always lower than MAX_JOB_EXECS_PER_LOCK at this point.
+ \COUNTERMEASURE  \N [CM_OS_COUNTERDUEJOBS_N]
+
+\ID SBSW_OS_CNT_JOBDO_001
+ \DESCRIPTION     Os_JobDo is called with a job, which has been returned by Os_PriorityQueueDeleteDue. The index is
+                  lower than the returned number of jobs.
+ \COUNTERMEASURE  \N [CM_OS_COUNTERDUEJOBS_N]
+
+\ID SBSW_OS_CNT_TIMINGWHEEL_001
+ \DESCRIPTION     A timing wheel function is called with the JobWheel member of a counter. The caller ensures that
+                  the wheel is used only if JobWheel is no NULL_PTR.
+ \COUNTERMEASURE  \R [CM_OS_COUNTERJOBWHEEL_R]
+
+\ID SBSW_OS_CNT_XSIGCHECKNOTIFICATION_001
+ \DESCRIPTION     Os_XSigCheckNotification is called with the return value of Os_CoreGetThread.
+ \COUNTERMEASURE  \N [CM_OS_COREGETTHREAD_N]
+
+\ID SBSW_OS_CNT_COREASRISCORELOCAL_002
+ \DESCRIPTION     Os_CoreAsrIsCoreLocal is called with the core of the return value of Os_CounterId2Counter.
+ \COUNTERMEASURE  \M [CM_OS_COUNTERID2COUNTER_M]
+                  \M [CM_OS_COUNTERGETCORE_M]
+
+\ID SBSW_OS_CNT_COUNTERGETUSERVALUELOCAL_002
+ \DESCRIPTION     Os_CounterGetUserValueLocal is called with the return value of Os_CounterId2Counter and a member of
+                  the call handle passed as argument to the caller. Correctness of the argument is ensured by
+                  preconditions. The compliance of the precondition is check during review.
+ \COUNTERMEASURE  \M [CM_OS_COUNTERID2COUNTER_M]
+
+\ID SBSW_OS_CNT_XSIGCOMPLETELOCAL_001
+ \DESCRIPTION     Os_XSigCompleteLocal is called with the return value of Os_CoreGetThread and a call handle passed
+                  as argument to the caller. Correctness of the argument is ensured by preconditions. The compliance
+                  of the precondition is check during review.
+ \COUNTERMEASURE  \N [CM_OS_COREGETTHREAD_N]
+
+\ID SBSW_OS_CNT_XSIGSEND_002
+ \DESCRIPTION     A cross core request function is called, with the core derived from the return value of
+                  Os_CounterId2Counter, the return value of Os_CoreGetThread and a call handle passed as argument to
+                  the caller. Correctness of the argument is ensured by preconditions. The compliance of the
+                  precondition is check during review.
+ \COUNTERMEASURE  \M [CM_OS_COUNTERGETCORE_M]
+
 SBSW_JUSTIFICATION_END */
 
 /*
+\CM CM_OS_COUNTERDUEJOBS_N
+      The local array of due jobs has MAX_JOB_EXECS_PER_LOCK elements. Os_PriorityQueueDeleteDue writes at most the
+      requested number of elements and returns the number of written elements.
+
+\CM CM_OS_COUNTERJOBWHEEL_R
+      Each call of a timing wheel function is guarded by a check, that the JobWheel member of the counter is no
+      NULL_PTR.
+
 \CM CM_OS_COUNTERID2COUNTER_M
       Verify that:
         1. each counter pointer in OsCfg_CounterRefs is no NULL_PTR,
@@ -44,6 +44,7 @@
 /* Os kernel module dependencies */
 # include "Os_Common.h"
 # include "Os_PriorityQueue.h"
+# include "Os_TimingWheel.h"
 # include "OsInt.h"
 # include "Os_Lcfg.h"
 # include "Os_Error.h"
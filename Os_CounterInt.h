@@ -26,6 +26,8 @@
  *  Each counter has a priority queue to manage its jobs. A priority queue is used, because the number of active
  *  alarms is dynamic and may be large. In previous implementations the job handling code has been generated, in
  *  case of a small number of possible active jobs (aka "GeneratedFastAlarms").
+ *  Counters with many cyclic jobs may keep their jobs in a hierarchical timing wheel instead (JobWheel), which
+ *  inserts and expires jobs in constant time.
  *
  *  ![Data Structures](CounterDataStructures.png)
  *
@@ -55,6 +57,7 @@
  *  The counter module uses the timer module to generate timer interrupts (if the counter is not a software counter).
  *
  *  \see \ref Os_PriorityQueue
+ *  \see \ref Os_TimingWheel
  *  \see \ref Os_Job
  *
  *
@@ -122,6 +125,8 @@
 # include "Os_ErrorInt.h"
 # include "Os_PriorityQueue_Types.h"
 # include "Os_PriorityQueueInt.h"
+# include "Os_TimingWheel_Types.h"
+# include "Os_TimingWheelInt.h"
 # include "Os_Application_Types.h"
 # include "Os_Core_Types.h"
 
@@ -225,6 +230,9 @@ struct Os_CounterConfigType_Tag
 
   /*! Reference to applications which access this object. */
   Os_AppAccessMaskType AccessingApplications;
+
+  /*! Timing wheel which keeps the jobs instead of JobQueue. NULL_PTR, if the counter uses JobQueue. */
+  P2CONST(Os_TimingWheelConfigType, TYPEDEF, OS_CONST) JobWheel;
 };
 
 
@@ -786,6 +794,32 @@ FUNC(Os_TickType, OS_CODE) Os_CounterSub
 );
 
 
+/***********************************************************************************************************************
+ *  Os_CounterGetTimestamp()
+ **********************************************************************************************************************/
+/*! \brief          Returns the physical counter value, which lies the given offset after now.
+ *  \details        The returned value may be compared against other physical values of the same counter with
+ *                  Os_CounterIsFutureValue(). An offset of 0 returns the current physical value.
+ *
+ *  \param[in]      Counter   The counter to query. Parameter must not be NULL.
+ *  \param[in]      Offset    The offset to now. Must be in range 0..MaxAllowedValue.
+ *
+ *  \return         mod(now + Offset).
+ *
+ *  \context        OS_INTERNAL
+ *
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *
+ *  \pre            Counter belongs to the local core.
+ **********************************************************************************************************************/
+FUNC(Os_TickType, OS_CODE) Os_CounterGetTimestamp
+(
+  P2CONST(Os_CounterConfigType, AUTOMATIC, OS_CONST) Counter,
+  Os_TickType Offset
+);
+
+
 /***********************************************************************************************************************
  *  Os_CounterWorkJobs()
  **********************************************************************************************************************/
@@ -1043,6 +1077,39 @@ FUNC(Os_StatusType, OS_CODE) Os_Api_GetCounterValue
 );
 
 
+/***********************************************************************************************************************
+ *  Os_Api_GetCounterValueAsync()
+ **********************************************************************************************************************/
+/*! \brief      OS service Os_GetCounterValueAsync().
+ *  \details    For further details see Os_GetCounterValueAsync().
+ *
+ *  \param[in]    CounterID   See Os_GetCounterValueAsync().
+ *  \param[in]    Mask        See Os_GetCounterValueAsync().
+ *  \param[out]   Call        See Os_GetCounterValueAsync().
+ *
+ *  \retval       OS_STATUS_OK              No Error.
+ *  \retval       OS_STATUS_ID_1            (EXTENDED status:) Invalid CounterID.
+ *  \retval       OS_STATUS_CALLEVEL        (EXTENDED status:) Called from invalid context.
+ *  \retval       OS_STATUS_DISABLEDINT     (Service Protection:) Caller is in interrupt API sequence.
+ *  \retval       OS_STATUS_ACCESSRIGHTS_1  (Service Protection:) Caller's access rights are not sufficient.
+ *  \retval       OS_STATUS_NOEXTENDEDTASK_CALLER  A notification is requested, but the caller is no extended task.
+ *  \retval       other                     See \ref Os_XSigSendRequest().
+ *
+ *  \context      TASK|ISR2
+ *
+ *  \reentrant    TRUE
+ *  \synchronous  TRUE
+ *
+ *  \pre          Supervisor mode.
+ **********************************************************************************************************************/
+FUNC(Os_StatusType, OS_CODE) Os_Api_GetCounterValueAsync
+(
+  CounterType CounterID,
+  EventMaskType Mask,
+  Os_AsyncCallRefType Call
+);
+
+
 /***********************************************************************************************************************
  *  Os_Api_GetElapsedValue()
  **********************************************************************************************************************/
@@ -1064,6 +1064,390 @@ Os_ErrReportTryToGetSpinlock,
 }
 
 
+/***********************************************************************************************************************
+ *  Os_ErrReportGetSpinlockStatistics()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE StatusType, OS_CODE, OS_ALWAYS_INLINE,                                     /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+Os_ErrReportGetSpinlockStatistics,
+(
+  Os_StatusType Status,
+  SpinlockIdType SpinlockId,
+  CoreIdType CoreID,
+  Os_SpinlockStatisticsRefType Statistics
+))
+{
+  /* #10 If there was an error: */
+  if(OS_UNLIKELY(Os_ErrIsPropagationRequired(Status) != 0u))
+  {
+    /* #20 Create error parameter object. */
+    Os_ErrorParamsType errorParameters;
+    errorParameters.Parameter[OS_ERRORPARAMINDEX_1].ParamSpinlockIdType = SpinlockId;                                   /* SBSW_OS_ERROR_ERROR_PARAMETER_001 */
+    errorParameters.Parameter[OS_ERRORPARAMINDEX_2].ParamCoreIdType = CoreID;                                           /* SBSW_OS_ERROR_ERROR_PARAMETER_001 */
+    errorParameters.Parameter[OS_ERRORPARAMINDEX_3].ParamSpinlockStatisticsRefType = Statistics;                        /* SBSW_OS_ERROR_ERROR_PARAMETER_001 */
+
+    /* #30 Report the error and get the error return code. */
+    Os_TrapErrApplicationError(OSServiceId_GetSpinlockStatistics, Status, &errorParameters);                            /* SBSW_OS_FC_POINTER2LOCAL */
+  }
+
+  /* #40 Return the error code. */
+  return Os_ErrOsStatus2UserStatus(Status);
+}
+
+
+/***********************************************************************************************************************
+ *  Os_ErrReportGetTaskStateAsync()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE StatusType, OS_CODE, OS_ALWAYS_INLINE,                                     /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+Os_ErrReportGetTaskStateAsync,
+(
+  Os_StatusType Status,
+  TaskType TaskID,
+  EventMaskType Mask,
+  Os_AsyncCallRefType Call
+))
+{
+  /* #10 If there was an error: */
+  if(OS_UNLIKELY(Os_ErrIsPropagationRequired(Status) != 0u))
+  {
+    /* #20 Create error parameter object. */
+    Os_ErrorParamsType errorParameters;
+    errorParameters.Parameter[OS_ERRORPARAMINDEX_1].ParamTaskType = TaskID;                                             /* SBSW_OS_ERROR_ERROR_PARAMETER_001 */
+    errorParameters.Parameter[OS_ERRORPARAMINDEX_2].ParamEventMaskType = Mask;                                          /* SBSW_OS_ERROR_ERROR_PARAMETER_001 */
+    errorParameters.Parameter[OS_ERRORPARAMINDEX_3].ParamAsyncCallRefType = Call;                                       /* SBSW_OS_ERROR_ERROR_PARAMETER_001 */
+
+    /* #30 Report the error and get the error return code. */
+    Os_TrapErrApplicationError(OSServiceId_GetTaskStateAsync, Status, &errorParameters);                                /* SBSW_OS_FC_POINTER2LOCAL */
+  }
+
+  /* #40 Return the error code. */
+  return Os_ErrOsStatus2UserStatus(Status);
+}
+
+
+/***********************************************************************************************************************
+ *  Os_ErrReportGetAlarmAsync()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE StatusType, OS_CODE, OS_ALWAYS_INLINE,                                     /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+Os_ErrReportGetAlarmAsync,
+(
+  Os_StatusType Status,
+  AlarmType AlarmID,
+  EventMaskType Mask,
+  Os_AsyncCallRefType Call
+))
+{
+  /* #10 If there was an error: */
+  if(OS_UNLIKELY(Os_ErrIsPropagationRequired(Status) != 0u))
+  {
+    /* #20 Create error parameter object. */
+    Os_ErrorParamsType errorParameters;
+    errorParameters.Parameter[OS_ERRORPARAMINDEX_1].ParamAlarmType = AlarmID;                                           /* SBSW_OS_ERROR_ERROR_PARAMETER_001 */
+    errorParameters.Parameter[OS_ERRORPARAMINDEX_2].ParamEventMaskType = Mask;                                          /* SBSW_OS_ERROR_ERROR_PARAMETER_001 */
+    errorParameters.Parameter[OS_ERRORPARAMINDEX_3].ParamAsyncCallRefType = Call;                                       /* SBSW_OS_ERROR_ERROR_PARAMETER_001 */
+
+    /* #30 Report the error and get the error return code. */
+    Os_TrapErrApplicationError(OSServiceId_GetAlarmAsync, Status, &errorParameters);                                    /* SBSW_OS_FC_POINTER2LOCAL */
+  }
+
+  /* #40 Return the error code. */
+  return Os_ErrOsStatus2UserStatus(Status);
+}
+
+
+/***********************************************************************************************************************
+ *  Os_ErrReportGetCounterValueAsync()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE StatusType, OS_CODE, OS_ALWAYS_INLINE,                                     /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+Os_ErrReportGetCounterValueAsync,
+(
+  Os_StatusType Status,
+  CounterType CounterID,
+  EventMaskType Mask,
+  Os_AsyncCallRefType Call
+))
+{
+  /* #10 If there was an error: */
+  if(OS_UNLIKELY(Os_ErrIsPropagationRequired(Status) != 0u))
+  {
+    /* #20 Create error parameter object. */
+    Os_ErrorParamsType errorParameters;
+    errorParameters.Parameter[OS_ERRORPARAMINDEX_1].ParamCounterType = CounterID;                                       /* SBSW_OS_ERROR_ERROR_PARAMETER_001 */
+    errorParameters.Parameter[OS_ERRORPARAMINDEX_2].ParamEventMaskType = Mask;                                          /* SBSW_OS_ERROR_ERROR_PARAMETER_001 */
+    errorParameters.Parameter[OS_ERRORPARAMINDEX_3].ParamAsyncCallRefType = Call;                                       /* SBSW_OS_ERROR_ERROR_PARAMETER_001 */
+
+    /* #30 Report the error and get the error return code. */
+    Os_TrapErrApplicationError(OSServiceId_GetCounterValueAsync, Status, &errorParameters);                             /* SBSW_OS_FC_POINTER2LOCAL */
+  }
+
+  /* #40 Return the error code. */
+  return Os_ErrOsStatus2UserStatus(Status);
+}
+
+
+/***********************************************************************************************************************
+ *  Os_ErrReportGetAsyncCallResult()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE StatusType, OS_CODE, OS_ALWAYS_INLINE,                                     /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+Os_ErrReportGetAsyncCallResult,
+(
+  Os_StatusType Status,
+  Os_AsyncCallRefType Call
+))
+{
+  /* #10 If there was an error, other than a pending cross core request: */
+  if(OS_UNLIKELY((Status != OS_STATUS_CROSS_CORE_REQUESTED) && (Os_ErrIsPropagationRequired(Status) != 0u)))
+  {
+    /* #20 Create error parameter object. */
+    Os_ErrorParamsType errorParameters;
+    errorParameters.Parameter[OS_ERRORPARAMINDEX_1].ParamAsyncCallRefType = Call;                                       /* SBSW_OS_ERROR_ERROR_PARAMETER_001 */
+
+    /* #30 Report the error and get the error return code. */
+    Os_TrapErrApplicationError(OSServiceId_GetAsyncCallResult, Status, &errorParameters);                               /* SBSW_OS_FC_POINTER2LOCAL */
+  }
+
+  /* #40 Return the error code. */
+  return Os_ErrOsStatus2UserStatus(Status);
+}
+
+/***********************************************************************************************************************
+ *  Os_ErrReportGetTaskAccounting()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE StatusType, OS_CODE, OS_ALWAYS_INLINE,                                     /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+Os_ErrReportGetTaskAccounting,
+(
+  Os_StatusType Status,
+  TaskType TaskID,
+  Os_ThreadAccountingRefType Accounting
+))
+{
+  /* #10 If there was an error: */
+  if(OS_UNLIKELY(Os_ErrIsPropagationRequired(Status) != 0u))
+  {
+    /* #20 Create error parameter object. */
+    Os_ErrorParamsType errorParameters;
+    errorParameters.Parameter[OS_ERRORPARAMINDEX_1].ParamTaskType = TaskID;                                             /* SBSW_OS_ERROR_ERROR_PARAMETER_001 */
+    errorParameters.Parameter[OS_ERRORPARAMINDEX_2].ParamThreadAccountingRefType = Accounting;                          /* SBSW_OS_ERROR_ERROR_PARAMETER_001 */
+
+    /* #30 Report the error and get the error return code. */
+    Os_TrapErrApplicationError(OSServiceId_GetTaskAccounting, Status, &errorParameters);                                /* SBSW_OS_FC_POINTER2LOCAL */
+  }
+
+  /* #40 Return the error code. */
+  return Os_ErrOsStatus2UserStatus(Status);
+}
+
+/***********************************************************************************************************************
+ *  Os_ErrReportGetISRAccounting()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE StatusType, OS_CODE, OS_ALWAYS_INLINE,                                     /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+Os_ErrReportGetISRAccounting,
+(
+  Os_StatusType Status,
+  ISRType ISRID,
+  Os_ThreadAccountingRefType Accounting
+))
+{
+  /* #10 If there was an error: */
+  if(OS_UNLIKELY(Os_ErrIsPropagationRequired(Status) != 0u))
+  {
+    /* #20 Create error parameter object. */
+    Os_ErrorParamsType errorParameters;
+    errorParameters.Parameter[OS_ERRORPARAMINDEX_1].ParamISRType = ISRID;                                               /* SBSW_OS_ERROR_ERROR_PARAMETER_001 */
+    errorParameters.Parameter[OS_ERRORPARAMINDEX_2].ParamThreadAccountingRefType = Accounting;                          /* SBSW_OS_ERROR_ERROR_PARAMETER_001 */
+
+    /* #30 Report the error and get the error return code. */
+    Os_TrapErrApplicationError(OSServiceId_GetISRAccounting, Status, &errorParameters);                                 /* SBSW_OS_FC_POINTER2LOCAL */
+  }
+
+  /* #40 Return the error code. */
+  return Os_ErrOsStatus2UserStatus(Status);
+}
+
+
+/***********************************************************************************************************************
+ *  Os_ErrReportScanStackUsage()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE StatusType, OS_CODE, OS_ALWAYS_INLINE,                                     /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+Os_ErrReportScanStackUsage,
+(
+  Os_StatusType Status
+))
+{
+  /* #10 If there was an error: */
+  if(OS_UNLIKELY(Os_ErrIsPropagationRequired(Status) != 0u))
+  {
+    /* #20 Create error parameter object. */
+    Os_ErrorParamsType errorParameters;
+
+    /* #30 Report the error and get the error return code. */
+    Os_TrapErrApplicationError(OSServiceId_ScanStackUsage, Status, &errorParameters);                                   /* SBSW_OS_FC_POINTER2LOCAL */
+  }
+
+  /* #40 Return the error code. */
+  return Os_ErrOsStatus2UserStatus(Status);
+}
+
+
+/***********************************************************************************************************************
+ *  Os_ErrReportGetNtfStackPoolStatistics()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE StatusType, OS_CODE, OS_ALWAYS_INLINE,                                     /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+Os_ErrReportGetNtfStackPoolStatistics,
+(
+  Os_StatusType Status,
+  Os_NonTrustedFunctionIndexType FunctionIndex,
+  Os_NtfStackPoolStatisticsRefType Statistics
+))
+{
+  /* #10 If there was an error: */
+  if(OS_UNLIKELY(Os_ErrIsPropagationRequired(Status) != 0u))
+  {
+    /* #20 Create error parameter object. */
+    Os_ErrorParamsType errorParameters;
+    errorParameters.Parameter[OS_ERRORPARAMINDEX_1].ParamOs_NonTrustedFunctionIndexType = FunctionIndex;                /* SBSW_OS_ERROR_ERROR_PARAMETER_001 */
+    errorParameters.Parameter[OS_ERRORPARAMINDEX_2].ParamNtfStackPoolStatisticsRefType = Statistics;                    /* SBSW_OS_ERROR_ERROR_PARAMETER_001 */
+
+    /* #30 Report the error and get the error return code. */
+    Os_TrapErrApplicationError(OSServiceId_GetNtfStackPoolStatistics, Status, &errorParameters);                        /* SBSW_OS_FC_POINTER2LOCAL */
+  }
+
+  /* #40 Return the error code. */
+  return Os_ErrOsStatus2UserStatus(Status);
+}
+
+
+/***********************************************************************************************************************
+ *  Os_ErrReportActivateTaskSet()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE StatusType, OS_CODE, OS_ALWAYS_INLINE,                                     /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+Os_ErrReportActivateTaskSet,
+(
+  Os_StatusType Status,
+  Os_TaskSetIdType TaskSetID
+))
+{
+  /* #10 If there was an error: */
+  if(OS_UNLIKELY(Os_ErrIsPropagationRequired(Status) != 0u))
+  {
+    /* #20 Create error parameter object. */
+    Os_ErrorParamsType errorParameters;
+    errorParameters.Parameter[OS_ERRORPARAMINDEX_1].ParamTaskSetIdType = TaskSetID;                                     /* SBSW_OS_ERROR_ERROR_PARAMETER_001 */
+
+    /* #30 Report the error and get the error return code. */
+    Os_TrapErrApplicationError(OSServiceId_ActivateTaskSet, Status, &errorParameters);                                  /* SBSW_OS_FC_POINTER2LOCAL */
+  }
+
+  /* #40 Return the error code. */
+  return Os_ErrOsStatus2UserStatus(Status);
+}
+
+
+/***********************************************************************************************************************
+ *  Os_ErrReportGetMpSkippedSwitches()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,                                           /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+Os_ErrReportGetMpSkippedSwitches,
+(
+  Os_StatusType Status,
+  CoreIdType CoreID
+))
+{
+  /* #10 If there was an error: */
+  if(OS_UNLIKELY(Os_ErrIsPropagationRequired(Status) != 0u))
+  {
+    /* #20 Create error parameter object. */
+    Os_ErrorParamsType errorParameters;
+    errorParameters.Parameter[OS_ERRORPARAMINDEX_1].ParamCoreIdType = CoreID;                                           /* SBSW_OS_ERROR_ERROR_PARAMETER_001 */
+
+    /* #30 Report the error and get the error return code. */
+    Os_TrapErrApplicationError(OSServiceId_GetMpSkippedSwitches, Status, &errorParameters);                             /* SBSW_OS_FC_POINTER2LOCAL */
+  }
+}
+
+
 /***********************************************************************************************************************
  *  Os_ErrReportControlIdle()
  **********************************************************************************************************************/
@@ -1049,6 +1049,318 @@ Os_ErrReportTryToGetSpinlock,
 ));
 
 
+/***********************************************************************************************************************
+ *  Os_ErrReportGetSpinlockStatistics()
+ **********************************************************************************************************************/
+/*! \brief        Reports the given status value in case of errors otherwise the function returns the StatusType
+ *                specified by AUTOSAR.
+ *  \details      --no details--
+ *
+ *  \param[in]    Status            The result of the API execution.
+ *  \param[in]    SpinlockId        The first API parameter.
+ *  \param[in]    CoreID            The second API parameter.
+ *  \param[in]    Statistics        The third API parameter.
+ *
+ *  \context      OS_INTERNAL
+ *
+ *  \return       See \ref Os_GetSpinlockStatistics().
+ *
+ *  \reentrant    TRUE
+ *  \synchronous  TRUE
+ *
+ *  \pre          -
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE StatusType, OS_CODE, OS_ALWAYS_INLINE,
+Os_ErrReportGetSpinlockStatistics,
+(
+  Os_StatusType Status,
+  SpinlockIdType SpinlockId,
+  CoreIdType CoreID,
+  Os_SpinlockStatisticsRefType Statistics
+));
+
+
+/***********************************************************************************************************************
+ *  Os_ErrReportGetTaskStateAsync()
+ **********************************************************************************************************************/
+/*! \brief        Reports the given status value in case of errors otherwise the function returns the StatusType
+ *                specified by AUTOSAR.
+ *  \details      --no details--
+ *
+ *  \param[in]    Status            The result of the API execution.
+ *  \param[in]    TaskID            The first API parameter.
+ *  \param[in]    Mask              The second API parameter.
+ *  \param[in]    Call              The third API parameter.
+ *
+ *  \context      OS_INTERNAL
+ *
+ *  \return       See \ref Os_GetTaskStateAsync().
+ *
+ *  \reentrant    TRUE
+ *  \synchronous  TRUE
+ *
+ *  \pre          -
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE StatusType, OS_CODE, OS_ALWAYS_INLINE,
+Os_ErrReportGetTaskStateAsync,
+(
+  Os_StatusType Status,
+  TaskType TaskID,
+  EventMaskType Mask,
+  Os_AsyncCallRefType Call
+));
+
+
+/***********************************************************************************************************************
+ *  Os_ErrReportGetAlarmAsync()
+ **********************************************************************************************************************/
+/*! \brief        Reports the given status value in case of errors otherwise the function returns the StatusType
+ *                specified by AUTOSAR.
+ *  \details      --no details--
+ *
+ *  \param[in]    Status            The result of the API execution.
+ *  \param[in]    AlarmID           The first API parameter.
+ *  \param[in]    Mask              The second API parameter.
+ *  \param[in]    Call              The third API parameter.
+ *
+ *  \context      OS_INTERNAL
+ *
+ *  \return       See \ref Os_GetAlarmAsync().
+ *
+ *  \reentrant    TRUE
+ *  \synchronous  TRUE
+ *
+ *  \pre          -
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE StatusType, OS_CODE, OS_ALWAYS_INLINE,
+Os_ErrReportGetAlarmAsync,
+(
+  Os_StatusType Status,
+  AlarmType AlarmID,
+  EventMaskType Mask,
+  Os_AsyncCallRefType Call
+));
+
+
+/***********************************************************************************************************************
+ *  Os_ErrReportGetCounterValueAsync()
+ **********************************************************************************************************************/
+/*! \brief        Reports the given status value in case of errors otherwise the function returns the StatusType
+ *                specified by AUTOSAR.
+ *  \details      --no details--
+ *
+ *  \param[in]    Status            The result of the API execution.
+ *  \param[in]    CounterID         The first API parameter.
+ *  \param[in]    Mask              The second API parameter.
+ *  \param[in]    Call              The third API parameter.
+ *
+ *  \context      OS_INTERNAL
+ *
+ *  \return       See \ref Os_GetCounterValueAsync().
+ *
+ *  \reentrant    TRUE
+ *  \synchronous  TRUE
+ *
+ *  \pre          -
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE StatusType, OS_CODE, OS_ALWAYS_INLINE,
+Os_ErrReportGetCounterValueAsync,
+(
+  Os_StatusType Status,
+  CounterType CounterID,
+  EventMaskType Mask,
+  Os_AsyncCallRefType Call
+));
+
+
+/***********************************************************************************************************************
+ *  Os_ErrReportGetAsyncCallResult()
+ **********************************************************************************************************************/
+/*! \brief        Reports the given status value in case of errors otherwise the function returns the StatusType
+ *                specified by AUTOSAR.
+ *  \details      OS_STATUS_CROSS_CORE_REQUESTED is no error and is not reported.
+ *
+ *  \param[in]    Status            The result of the API execution.
+ *  \param[in]    Call              The first API parameter.
+ *
+ *  \context      OS_INTERNAL
+ *
+ *  \return       See \ref Os_GetAsyncCallResult().
+ *
+ *  \reentrant    TRUE
+ *  \synchronous  TRUE
+ *
+ *  \pre          -
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE StatusType, OS_CODE, OS_ALWAYS_INLINE,
+Os_ErrReportGetAsyncCallResult,
+(
+  Os_StatusType Status,
+  Os_AsyncCallRefType Call
+));
+
+/***********************************************************************************************************************
+ *  Os_ErrReportGetTaskAccounting()
+ **********************************************************************************************************************/
+/*! \brief        Reports the given status value in case of errors otherwise the function returns the StatusType
+ *                specified by AUTOSAR.
+ *  \details      --no details--
+ *
+ *  \param[in]    Status            The result of the API execution.
+ *  \param[in]    TaskID            The first API parameter.
+ *  \param[in]    Accounting        The second API parameter.
+ *
+ *  \context      OS_INTERNAL
+ *
+ *  \return       See \ref Os_GetTaskAccounting().
+ *
+ *  \reentrant    TRUE
+ *  \synchronous  TRUE
+ *
+ *  \pre          -
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE StatusType, OS_CODE, OS_ALWAYS_INLINE,
+Os_ErrReportGetTaskAccounting,
+(
+  Os_StatusType Status,
+  TaskType TaskID,
+  Os_ThreadAccountingRefType Accounting
+));
+
+/***********************************************************************************************************************
+ *  Os_ErrReportGetISRAccounting()
+ **********************************************************************************************************************/
+/*! \brief        Reports the given status value in case of errors otherwise the function returns the StatusType
+ *                specified by AUTOSAR.
+ *  \details      --no details--
+ *
+ *  \param[in]    Status            The result of the API execution.
+ *  \param[in]    ISRID             The first API parameter.
+ *  \param[in]    Accounting        The second API parameter.
+ *
+ *  \context      OS_INTERNAL
+ *
+ *  \return       See \ref Os_GetISRAccounting().
+ *
+ *  \reentrant    TRUE
+ *  \synchronous  TRUE
+ *
+ *  \pre          -
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE StatusType, OS_CODE, OS_ALWAYS_INLINE,
+Os_ErrReportGetISRAccounting,
+(
+  Os_StatusType Status,
+  ISRType ISRID,
+  Os_ThreadAccountingRefType Accounting
+));
+
+
+/***********************************************************************************************************************
+ *  Os_ErrReportScanStackUsage()
+ **********************************************************************************************************************/
+/*! \brief        Reports the given status value in case of errors otherwise the function returns the StatusType
+ *                specified by AUTOSAR.
+ *  \details      --no details--
+ *
+ *  \param[in]    Status            The result of the API execution.
+ *
+ *  \context      OS_INTERNAL
+ *
+ *  \return       See \ref Os_ScanStackUsage().
+ *
+ *  \reentrant    TRUE
+ *  \synchronous  TRUE
+ *
+ *  \pre          -
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE StatusType, OS_CODE, OS_ALWAYS_INLINE,
+Os_ErrReportScanStackUsage,
+(
+  Os_StatusType Status
+));
+
+
+/***********************************************************************************************************************
+ *  Os_ErrReportGetNtfStackPoolStatistics()
+ **********************************************************************************************************************/
+/*! \brief        Reports the given status value in case of errors otherwise the function returns the StatusType
+ *                specified by AUTOSAR.
+ *  \details      --no details--
+ *
+ *  \param[in]    Status            The result of the API execution.
+ *  \param[in]    FunctionIndex     The first API parameter.
+ *  \param[in]    Statistics        The second API parameter.
+ *
+ *  \context      OS_INTERNAL
+ *
+ *  \return       See \ref Os_GetNtfStackPoolStatistics().
+ *
+ *  \reentrant    TRUE
+ *  \synchronous  TRUE
+ *
+ *  \pre          -
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE StatusType, OS_CODE, OS_ALWAYS_INLINE,
+Os_ErrReportGetNtfStackPoolStatistics,
+(
+  Os_StatusType Status,
+  Os_NonTrustedFunctionIndexType FunctionIndex,
+  Os_NtfStackPoolStatisticsRefType Statistics
+));
+
+
+/***********************************************************************************************************************
+ *  Os_ErrReportActivateTaskSet()
+ **********************************************************************************************************************/
+/*! \brief        Reports the given status value in case of errors otherwise the function returns the StatusType
+ *                specified by AUTOSAR.
+ *  \details      --no details--
+ *
+ *  \param[in]    Status            The result of the API execution.
+ *  \param[in]    TaskSetID         The first API parameter.
+ *
+ *  \context      OS_INTERNAL
+ *
+ *  \return       See \ref Os_ActivateTaskSet().
+ *
+ *  \reentrant    TRUE
+ *  \synchronous  TRUE
+ *
+ *  \pre          -
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE StatusType, OS_CODE, OS_ALWAYS_INLINE,
+Os_ErrReportActivateTaskSet,
+(
+  Os_StatusType Status,
+  Os_TaskSetIdType TaskSetID
+));
+
+
+/***********************************************************************************************************************
+ *  Os_ErrReportGetMpSkippedSwitches()
+ **********************************************************************************************************************/
+/*! \brief        Reports the given status value in case of errors.
+ *  \details      --no details--
+ *
+ *  \param[in]    Status            The result of the API execution.
+ *  \param[in]    CoreID            The first API parameter.
+ *
+ *  \context      OS_INTERNAL
+ *
+ *  \reentrant    TRUE
+ *  \synchronous  TRUE
+ *
+ *  \pre          -
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,
+Os_ErrReportGetMpSkippedSwitches,
+(
+  Os_StatusType Status,
+  CoreIdType CoreID
+));
+
+
 /***********************************************************************************************************************
  *  Os_ErrReportControlIdle()
  **********************************************************************************************************************/
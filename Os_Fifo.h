@@ -106,6 +106,62 @@ Os_FifoIdxIncrement,
 }
 
 
+/***********************************************************************************************************************
+ *  Os_FifoIdxPublish
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,                                           /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+Os_FifoIdxPublish,
+(
+  P2VAR(Os_FifoIdxType, AUTOMATIC, OS_APPL_DATA) Index,
+  Os_FifoIdxType Size,
+  Os_StdReturnType Ordered
+))
+{
+  Os_FifoIdxType next = (*Index);
+
+  /* #10 Calculate the next index. */
+  Os_FifoIdxIncrement(&next, Size);                                                                                     /* SBSW_OS_FC_POINTER2ARGUMENT */
+
+  /* #20 If requested, complete all accesses to the queue element, before the opposite side may observe the new
+   *     index. */
+  if(Ordered != 0u)
+  {
+    Os_Hal_Dsync();
+  }
+
+  /* #30 Publish the new index. */
+  (*Index) = next;                                                                                                      /* SBSW_OS_PWA_PRECONDITION */
+}
+
+
+/***********************************************************************************************************************
+ *  Os_FifoIdxAcquire()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,                                           /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+Os_FifoIdxAcquire,
+(
+  Os_StdReturnType Ordered
+))
+{
+  /* #10 If requested, do not access a queue element, before the opposite index has been read. */
+  if(Ordered != 0u)
+  {
+    Os_Hal_Dsync();
+  }
+}
+
+
 /***********************************************************************************************************************
  *  Os_FifoIsFull()
  **********************************************************************************************************************/
@@ -179,6 +179,7 @@ Os_Fifo16IndicesInRangeOnWrite,
  *
  *  \param[in,out]  Fifo    The FIFO instance. Parameter must not be NULL.
  *  \param[in]      Value   The value to be enqueued.
+ *  \param[in]      Ordered !0, if the opposite side accesses the FIFO concurrently without a common lock.
  *
  *  \retval         OS_FIFOWRITERESULT_OK              If writing succeeded.
  *  \retval         OS_FIFOWRITERESULT_BUFFEROVERFLOW  If the queue is already full.
@@ -194,7 +195,8 @@ OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE Os_FifoWriteResultType, OS_CODE,
 OS_ALWAYS_INLINE, Os_Fifo16Enqueue,
 (
   P2CONST(Os_Fifo16WriteConfigType, AUTOMATIC, OS_APPL_DATA) Fifo,
-  uint16 Value
+  uint16 Value,
+  Os_StdReturnType Ordered
 ));
 
 
@@ -281,6 +283,7 @@ Os_Fifo16IndicesInRangeOnRead,
  *  \details        --no details--
  *
  *  \param[in,out]  Fifo    The FIFO instance. Parameter must not be NULL.
+ *  \param[in]      Ordered !0, if the opposite side accesses the FIFO concurrently without a common lock.
  *
  *  \return         Returns the value of the eldest element.
  *
@@ -293,7 +296,8 @@ Os_Fifo16IndicesInRangeOnRead,
  **********************************************************************************************************************/
 OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE uint16, OS_CODE, OS_ALWAYS_INLINE, Os_Fifo16Dequeue,
 (
-  P2CONST(Os_Fifo16ReadConfigType, AUTOMATIC, OS_APPL_DATA) Fifo
+  P2CONST(Os_Fifo16ReadConfigType, AUTOMATIC, OS_APPL_DATA) Fifo,
+  Os_StdReturnType Ordered
 ));
 
 
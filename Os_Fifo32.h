@@ -134,7 +134,8 @@ OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE Os_FifoWriteResultType, OS_CODE,
 OS_ALWAYS_INLINE, Os_Fifo32Enqueue,
 (
   P2CONST(Os_Fifo32WriteConfigType, AUTOMATIC, OS_APPL_DATA) Fifo,
-  uint32 Value
+  uint32 Value,
+  Os_StdReturnType Ordered
 ))
 {
   Os_FifoWriteResultType result;
@@ -144,13 +145,16 @@ OS_ALWAYS_INLINE, Os_Fifo32Enqueue,
   /* #10 Perform checks. */
   if(OS_LIKELY(Os_Fifo32IsFull(Fifo) == 0u))                                                                            /* SBSW_OS_FC_PRECONDITION */
   {
-    /* Hint: As a foreign core may read the new Value concurrently, perform the write access before the writeIdx is
-     * updated. */
-    /* #20 Write the value. */
+    /* #20 Do not overwrite the element, before the reader has released it. */
+    Os_FifoIdxAcquire(Ordered);
+
+    /* Hint: As a foreign core may read the new Value concurrently, the write access is completed before the writeIdx
+     * is published. */
+    /* #30 Write the value. */
     Fifo->Data[Fifo->Dyn->WriteIdx].Value = Value;                                                                      /* SBSW_OS_FF32_FIFOWRITE_DATA_001 */
 
-    /* #30 Increment the write index counter. */
-    Os_FifoIdxIncrement(&(Fifo->Dyn->WriteIdx), Fifo->Size);                                                            /* SBSW_OS_FF32_FIFOIDXINCREMENT_002 */
+    /* #40 Increment and publish the write index counter. */
+    Os_FifoIdxPublish(&(Fifo->Dyn->WriteIdx), Fifo->Size, Ordered);                                                     /* SBSW_OS_FF32_FIFOIDXINCREMENT_002 */
     result = OS_FIFOWRITERESULT_OK;
   }
 
@@ -231,18 +235,22 @@ OS_ALWAYS_INLINE, Os_Fifo32IndicesInRangeOnRead,
 OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE uint32, OS_CODE, OS_ALWAYS_INLINE,                                         /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
 Os_Fifo32Dequeue,
 (
-  P2CONST(Os_Fifo32ReadConfigType, AUTOMATIC, OS_APPL_DATA) Fifo
+  P2CONST(Os_Fifo32ReadConfigType, AUTOMATIC, OS_APPL_DATA) Fifo,
+  Os_StdReturnType Ordered
 ))
 {
   uint32 result;
 
   /* #10 Perform checks. */
   Os_Assert((Os_StdReturnType)(Os_Fifo32IsEmpty(Fifo) == 0u));                                                          /* PRQA S 4304*/ /* MD_Os_C90BooleanCompatibility */ /* SBSW_OS_FC_PRECONDITION */
-  /* #20 Read the result value. */
+  /* #20 Do not read the element, before the writer has published it. */
+  Os_FifoIdxAcquire(Ordered);
+
+  /* #30 Read the result value. */
   result = Fifo->Data[Fifo->Dyn->ReadIdx].Value;
 
-  /* #30 Increment the front index counter. */
-  Os_FifoIdxIncrement(&(Fifo->Dyn->ReadIdx), Fifo->Size);                                                               /* SBSW_OS_FF32_FIFOIDXINCREMENT_001 */
+  /* #40 Increment and publish the front index counter. */
+  Os_FifoIdxPublish(&(Fifo->Dyn->ReadIdx), Fifo->Size, Ordered);                                                        /* SBSW_OS_FF32_FIFOIDXINCREMENT_001 */
 
   return result;
 }
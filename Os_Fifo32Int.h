@@ -180,6 +180,7 @@ Os_Fifo32IndicesInRangeOnWrite,
  *
  *  \param[in,out]  Fifo    The FIFO instance. Parameter must not be NULL.
  *  \param[in]      Value   The value to be enqueued.
+ *  \param[in]      Ordered !0, if the opposite side accesses the FIFO concurrently without a common lock.
  *
  *  \retval         OS_FIFOWRITERESULT_OK              If writing succeeded.
  *  \retval         OS_FIFOWRITERESULT_BUFFEROVERFLOW  If the queue is already full.
@@ -195,7 +196,8 @@ OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE Os_FifoWriteResultType, OS_CODE,
 OS_ALWAYS_INLINE, Os_Fifo32Enqueue,
 (
   P2CONST(Os_Fifo32WriteConfigType, AUTOMATIC, OS_APPL_DATA) Fifo,
-  uint32 Value
+  uint32 Value,
+  Os_StdReturnType Ordered
 ));
 
 
@@ -282,6 +284,7 @@ Os_Fifo32IndicesInRangeOnRead,
  *  \details        --no details--
  *
  *  \param[in,out]  Fifo    The FIFO instance. Parameter must not be NULL.
+ *  \param[in]      Ordered !0, if the opposite side accesses the FIFO concurrently without a common lock.
  *
  *  \return         Returns the value of the eldest element.
  *
@@ -294,7 +297,8 @@ Os_Fifo32IndicesInRangeOnRead,
  **********************************************************************************************************************/
 OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE uint32, OS_CODE, OS_ALWAYS_INLINE, Os_Fifo32Dequeue,
 (
-  P2CONST(Os_Fifo32ReadConfigType, AUTOMATIC, OS_APPL_DATA) Fifo
+  P2CONST(Os_Fifo32ReadConfigType, AUTOMATIC, OS_APPL_DATA) Fifo,
+  Os_StdReturnType Ordered
 ));
 
 
@@ -22,6 +22,12 @@
  * queue is treated as full if the incremented write index equals the read index. Therefore the buffer can hold
  * Fifo->Size-1 elements. The maximum Fifo->Size is 255 elements.
  *
+ * Each index is written by one side only. If the caller requests ordered accesses (Ordered parameter), a side
+ * publishes its index with release ordering (the element accesses complete before the new index is visible) and
+ * accesses an element only after the opposite index has been read (acquire ordering). Therefore one writer and one
+ * reader may access the same FIFO concurrently without any lock. Callers which protect both sides by a common lock
+ * pass Ordered = 0 and do not pay for the memory barriers.
+ *
  * ![Data Structure](CmpPrimitivesFifo.png)
  *
  * \see [Circular buffer](http:\\en.wikipedia.org/wiki/Circular_buffer)
@@ -115,6 +121,53 @@ OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE, O
 ));
 
 
+/***********************************************************************************************************************
+ *  Os_FifoIdxPublish()
+ **********************************************************************************************************************/
+/*! \brief          Increments the own queue index and publishes it to the opposite side.
+ *  \details        The new index is written with a single store. The opposite side never observes an intermediate
+ *                  value. If Ordered is set, all preceding accesses to queue elements are completed before.
+ *
+ *  \param[in,out]  Index   The index to be incremented. Parameter must not be NULL.
+ *  \param[in]      Size    The size of the queue. The value must be greater than *Index.
+ *  \param[in]      Ordered !0, if the opposite side accesses the FIFO concurrently without a common lock.
+ *
+ *  \context        ANY
+ *
+ *  \reentrant      TRUE for different FIFOs
+ *  \synchronous    TRUE
+ *
+ *  \pre            -
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE, Os_FifoIdxPublish,
+(
+  P2VAR(Os_FifoIdxType, AUTOMATIC, TYPEDEF) Index,
+  Os_FifoIdxType Size,
+  Os_StdReturnType Ordered
+));
+
+
+/***********************************************************************************************************************
+ *  Os_FifoIdxAcquire()
+ **********************************************************************************************************************/
+/*! \brief          Orders subsequent accesses to queue elements after the preceding read of the opposite index.
+ *  \details        Does nothing, if Ordered is not set.
+ *
+ *  \param[in]      Ordered !0, if the opposite side accesses the FIFO concurrently without a common lock.
+ *
+ *  \context        ANY
+ *
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *
+ *  \pre            -
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE, Os_FifoIdxAcquire,
+(
+  Os_StdReturnType Ordered
+));
+
+
 /***********************************************************************************************************************
  *  Os_FifoIsFull()
  **********************************************************************************************************************/
@@ -135,6 +135,18 @@
                  Fifo argument is ensured by precondition. The compliance of the precondition is check during review.
  \COUNTERMEASURE \M [CM_OS_FIFOREF_READCBK_DATA_M]
 
+\ID SBSW_OS_FFREF_FIFO_SLOTCBK_001
+ \DESCRIPTION    Call of SlotCbk function of a FIFO write object passed as argument to the caller. The index is the
+                 WriteIdx of the FIFO, which is in range as the FIFO is not full. The correctness of the Fifo argument
+                 is ensured by precondition. The compliance of the precondition is check during review.
+ \COUNTERMEASURE \M [CM_OS_FIFOREF_SLOTCBK_DATA_M]
+
+\ID SBSW_OS_FFREF_FIFO_SLOTCBK_002
+ \DESCRIPTION    Call of SlotCbk function of a FIFO read object passed as argument to the caller. The index is the
+                 ReadIdx of the FIFO, which is in range as the FIFO is not empty. The correctness of the Fifo argument
+                 is ensured by precondition. The compliance of the precondition is check during review.
+ \COUNTERMEASURE \M [CM_OS_FIFOREF_SLOTCBK_DATA_M]
+
 
 SBSW_JUSTIFICATION_END */
 
@@ -156,6 +168,10 @@ SBSW_JUSTIFICATION_END */
 
 \CM CM_OS_FIFOREF_READCBK_DATA_M
       Verify that the ReadCallback of each Os_FifoRefReadConfigType instance is a non NULL_PTR.
+
+\CM CM_OS_FIFOREF_SLOTCBK_DATA_M
+      Verify that the SlotCbk of each Os_FifoRefWriteConfigType and Os_FifoRefReadConfigType instance is a non
+      NULL_PTR and returns the address of the array element with the given index.
  */
 
 
@@ -98,6 +98,7 @@ Os_FifoRefWriteInit,
 {
   /* #10  Initialize all indices to zero. */
   Fifo->Dyn->WriteIdx = 0;                                                                                              /* SBSW_OS_FFREF_FIFOWRITE_DYN_001 */
+  Fifo->Dyn->Loaned = FALSE;                                                                                            /* SBSW_OS_FFREF_FIFOWRITE_DYN_001 */
 }
 
 
@@ -134,7 +135,8 @@ OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE Os_FifoWriteResultType, OS_CODE, OS
 Os_FifoRefEnqueue,
 (
   P2CONST(Os_FifoRefWriteConfigType, AUTOMATIC, OS_APPL_DATA) Fifo,
-  P2CONST(void, TYPEDEF, AUTOMATIC) Value
+  P2CONST(void, TYPEDEF, AUTOMATIC) Value,
+  Os_StdReturnType Ordered
 ))
 {
   Os_FifoWriteResultType result = OS_FIFOWRITERESULT_BUFFEROVERFLOW;
@@ -142,13 +144,16 @@ Os_FifoRefEnqueue,
   /* #10 Perform checks. */
   if(OS_LIKELY(Os_FifoRefIsFull(Fifo) == 0u))                                                                           /* SBSW_OS_FC_PRECONDITION */
   {
-    /* Hint: As a foreign core may read the new Value concurrently, perform the write access before the writeIdx is
-     * updated. */
-    /* #20 Write the value. */
+    /* #20 Do not overwrite the element, before the reader has released it. */
+    Os_FifoIdxAcquire(Ordered);
+
+    /* Hint: As a foreign core may read the new Value concurrently, the write access is completed before the writeIdx
+     * is published. */
+    /* #30 Write the value. */
     Fifo->WriteCbk(Fifo->Data, Fifo->Dyn->WriteIdx, Value);                                                             /* SBSW_OS_FFREF_FIFO_WRITECBK_001 */
 
-    /* #30 Increment the write index counter. */
-    Os_FifoIdxIncrement(&(Fifo->Dyn->WriteIdx), Fifo->Size);                                                            /* SBSW_OS_FFREF_FIFOIDXINCREMENT_002 */
+    /* #40 Increment and publish the write index counter. */
+    Os_FifoIdxPublish(&(Fifo->Dyn->WriteIdx), Fifo->Size, Ordered);                                                     /* SBSW_OS_FFREF_FIFOIDXINCREMENT_002 */
     result = OS_FIFOWRITERESULT_OK;
   }
 
@@ -175,6 +180,75 @@ Os_FifoRefIsFull,
 }
 
 
+/***********************************************************************************************************************
+ *  Os_FifoRefLoan()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(                                                                                           /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+OS_LOCAL_INLINE P2VAR(void, AUTOMATIC, OS_APPL_DATA), OS_CODE, OS_ALWAYS_INLINE,
+Os_FifoRefLoan,
+(
+  P2CONST(Os_FifoRefWriteConfigType, AUTOMATIC, OS_APPL_DATA) Fifo,
+  Os_StdReturnType Ordered
+))
+{
+  P2VAR(void, AUTOMATIC, OS_APPL_DATA) slot = NULL_PTR;
+
+  /* #10 If the queue is not full, mark the element at the write position as loaned and return its address. The
+   *     caller must not overwrite the element, before the reader has released it. */
+  if(OS_LIKELY(Os_FifoRefIsFull(Fifo) == 0u))                                                                           /* SBSW_OS_FC_PRECONDITION */
+  {
+    Os_FifoIdxAcquire(Ordered);
+    Fifo->Dyn->Loaned = TRUE;                                                                                           /* SBSW_OS_FFREF_FIFOWRITE_DYN_001 */
+    slot = Fifo->SlotCbk(Fifo->Data, Fifo->Dyn->WriteIdx);                                                              /* SBSW_OS_FFREF_FIFO_SLOTCBK_001 */
+  }
+
+  return slot;
+}
+
+
+/***********************************************************************************************************************
+ *  Os_FifoRefCommit()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,                                           /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+Os_FifoRefCommit,
+(
+  P2CONST(Os_FifoRefWriteConfigType, AUTOMATIC, OS_APPL_DATA) Fifo,
+  Os_StdReturnType Ordered
+))
+{
+  /* #10 Perform checks. */
+  Os_Assert((Os_StdReturnType)(Os_FifoRefIsLoaned(Fifo) != 0u));                                                        /* PRQA S 4304 */ /* MD_Os_C90BooleanCompatibility */ /* SBSW_OS_FC_PRECONDITION */
+
+  /* #20 Return the loan and publish the element by incrementing the write index counter. */
+  Fifo->Dyn->Loaned = FALSE;                                                                                            /* SBSW_OS_FFREF_FIFOWRITE_DYN_001 */
+  Os_FifoIdxPublish(&(Fifo->Dyn->WriteIdx), Fifo->Size, Ordered);                                                       /* SBSW_OS_FFREF_FIFOIDXINCREMENT_002 */
+}
+
+
+/***********************************************************************************************************************
+ *  Os_FifoRefIsLoaned()
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE Os_StdReturnType, OS_CONST, OS_ALWAYS_INLINE,                              /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+Os_FifoRefIsLoaned,
+(
+  P2CONST(Os_FifoRefWriteConfigType, AUTOMATIC, OS_APPL_DATA) Fifo
+))
+{
+  return (Os_StdReturnType)(Fifo->Dyn->Loaned != FALSE);                                                                /* PRQA S 4304 */ /* MD_Os_C90BooleanCompatibility */
+}
+
+
 /***********************************************************************************************************************
  *  FIFO Read Functions
  **********************************************************************************************************************/
@@ -194,6 +268,7 @@ Os_FifoRefReadInit,
 {
   /* #10  Initialize all indices to zero. */
   Fifo->Dyn->ReadIdx = 0;                                                                                               /* SBSW_OS_FFREF_FIFOREAD_DYN_001 */
+  Fifo->Dyn->Borrowed = FALSE;                                                                                          /* SBSW_OS_FFREF_FIFOREAD_DYN_001 */
 }
 
 
@@ -230,17 +305,21 @@ OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,
 Os_FifoRefDequeue,
 (
   P2CONST(Os_FifoRefReadConfigType, AUTOMATIC, OS_APPL_DATA) Fifo,
-  P2VAR(void, TYPEDEF, AUTOMATIC) DataRef
+  P2VAR(void, TYPEDEF, AUTOMATIC) DataRef,
+  Os_StdReturnType Ordered
 ))
 {
   /* #10 Perform checks. */
   Os_Assert((Os_StdReturnType)(Os_FifoRefIsEmpty(Fifo) == 0u));                                                         /* PRQA S 4304 */ /* MD_Os_C90BooleanCompatibility */ /* SBSW_OS_FC_PRECONDITION */
 
-  /* #20 Read the result value. */
+  /* #20 Do not read the element, before the writer has published it. */
+  Os_FifoIdxAcquire(Ordered);
+
+  /* #30 Read the result value. */
   Fifo->ReadCbk(Fifo->Data, Fifo->Dyn->ReadIdx, DataRef);                                                               /* SBSW_OS_FFREF_FIFO_READCBK_001 */
 
-  /* #30 Increment the front index counter. */
-  Os_FifoIdxIncrement(&(Fifo->Dyn->ReadIdx), Fifo->Size);                                                               /* SBSW_OS_FFREF_FIFOIDXINCREMENT_001 */
+  /* #40 Increment and publish the front index counter. */
+  Os_FifoIdxPublish(&(Fifo->Dyn->ReadIdx), Fifo->Size, Ordered);                                                        /* SBSW_OS_FFREF_FIFOIDXINCREMENT_001 */
 }
 
 
@@ -263,6 +342,72 @@ Os_FifoRefIsEmpty,
 }
 
 
+/***********************************************************************************************************************
+ *  Os_FifoRefBorrow()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(                                                                                           /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+OS_LOCAL_INLINE P2CONST(void, AUTOMATIC, OS_APPL_DATA), OS_CODE, OS_ALWAYS_INLINE,
+Os_FifoRefBorrow,
+(
+  P2CONST(Os_FifoRefReadConfigType, AUTOMATIC, OS_APPL_DATA) Fifo,
+  Os_StdReturnType Ordered
+))
+{
+  /* #10 Perform checks. */
+  Os_Assert((Os_StdReturnType)(Os_FifoRefIsEmpty(Fifo) == 0u));                                                         /* PRQA S 4304 */ /* MD_Os_C90BooleanCompatibility */ /* SBSW_OS_FC_PRECONDITION */
+
+  /* #20 The caller must not read the element, before the writer has published it. */
+  Os_FifoIdxAcquire(Ordered);
+
+  /* #30 Mark the eldest element as borrowed and return its address. */
+  Fifo->Dyn->Borrowed = TRUE;                                                                                           /* SBSW_OS_FFREF_FIFOREAD_DYN_001 */
+  return Fifo->SlotCbk(Fifo->Data, Fifo->Dyn->ReadIdx);                                                                 /* SBSW_OS_FFREF_FIFO_SLOTCBK_002 */
+}
+
+
+/***********************************************************************************************************************
+ *  Os_FifoRefRelease()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,                                           /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+Os_FifoRefRelease,
+(
+  P2CONST(Os_FifoRefReadConfigType, AUTOMATIC, OS_APPL_DATA) Fifo,
+  Os_StdReturnType Ordered
+))
+{
+  /* #10 Perform checks. */
+  Os_Assert((Os_StdReturnType)(Os_FifoRefIsBorrowed(Fifo) != 0u));                                                      /* PRQA S 4304 */ /* MD_Os_C90BooleanCompatibility */ /* SBSW_OS_FC_PRECONDITION */
+
+  /* #20 Return the element and hand it over to the writer by incrementing the front index counter. */
+  Fifo->Dyn->Borrowed = FALSE;                                                                                          /* SBSW_OS_FFREF_FIFOREAD_DYN_001 */
+  Os_FifoIdxPublish(&(Fifo->Dyn->ReadIdx), Fifo->Size, Ordered);                                                        /* SBSW_OS_FFREF_FIFOIDXINCREMENT_001 */
+}
+
+
+/***********************************************************************************************************************
+ *  Os_FifoRefIsBorrowed()
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE Os_StdReturnType, OS_CONST, OS_ALWAYS_INLINE,                              /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+Os_FifoRefIsBorrowed,
+(
+  P2CONST(Os_FifoRefReadConfigType, AUTOMATIC, OS_APPL_DATA) Fifo
+))
+{
+  return (Os_StdReturnType)(Fifo->Dyn->Borrowed != FALSE);                                                              /* PRQA S 4304 */ /* MD_Os_C90BooleanCompatibility */
+}
+
+
 /***********************************************************************************************************************
  *  Os_FifoRefEmptyQueue()
  **********************************************************************************************************************/
@@ -279,6 +424,9 @@ Os_FifoRefEmptyQueue,
 {
   /* #10  Use base class method. */
   Os_FifoEmptyQueue(&(Fifo->Write->WriteIdx), &(Fifo->Dyn->ReadIdx));                                                   /* SBSW_OS_FFREF_FIFOEMPTYQUEUE_001 */
+
+  /* #20 A borrowed element has been removed as well. */
+  Fifo->Dyn->Borrowed = FALSE;                                                                                          /* SBSW_OS_FFREF_FIFOREAD_DYN_001 */
 }
 
 
@@ -97,10 +97,37 @@ typedef P2FUNC(void, OS_CODE, Os_FifoRefWriteCbk)
 );
 
 
+/*! \brief   Callback to get the address of the element at the given index within the array (write side).
+ *  \details The caller has to ensure that the given index is within a valid range.
+ *  \param[in] Buffer       The array.
+ *  \param[in] Idx          The array index.
+ *  \return    The address of the element.
+ */
+typedef P2FUNC(P2VAR(void, AUTOMATIC, TYPEDEF), OS_CODE, Os_FifoRefWriteSlotCbk)
+(
+  P2VAR(void, AUTOMATIC, TYPEDEF) Buffer,
+  Os_FifoIdxType Idx
+);
+
+
+/*! \brief   Callback to get the address of the element at the given index within the array (read side).
+ *  \details The caller has to ensure that the given index is within a valid range.
+ *  \param[in] Buffer       The array.
+ *  \param[in] Idx          The array index.
+ *  \return    The address of the element.
+ */
+typedef P2FUNC(P2CONST(void, AUTOMATIC, TYPEDEF), OS_CODE, Os_FifoRefReadSlotCbk)
+(
+  P2CONST(void, AUTOMATIC, TYPEDEF) Buffer,
+  Os_FifoIdxType Idx
+);
+
+
 /*! Defines the runtime data of a FIFO. */
 typedef struct
 {
   Os_FifoIdxType WriteIdx;                                        /*!< Position of the next write to the queue. */
+  boolean Loaned;                                                 /*!< The element at WriteIdx is loaned. */
 }Os_FifoRefWriteType;
 
 
@@ -108,6 +135,7 @@ typedef struct
 typedef struct
 {
   Os_FifoIdxType ReadIdx;                                         /*!< Position of the last read from the queue. */
+  boolean Borrowed;                                               /*!< The element at ReadIdx is borrowed. */
 }Os_FifoRefReadType;
 
 
@@ -119,6 +147,7 @@ struct Os_FifoRefWriteConfigType_Tag
   P2VAR(void, AUTOMATIC, OS_APPL_DATA) Data;                      /*!< Pointer to the queue array. */
   Os_FifoIdxType Size;                                            /*!< The queue size. */
   Os_FifoRefWriteCbk WriteCbk;                                    /*!< Function which is used to write to the array. */
+  Os_FifoRefWriteSlotCbk SlotCbk;                                 /*!< Function which returns an element address. */
 };
 
 
@@ -130,6 +159,7 @@ struct Os_FifoRefReadConfigType_Tag
   P2CONST(void, AUTOMATIC, OS_APPL_DATA) Data;                    /*!< Pointer to the queue array. */
   Os_FifoIdxType Size;                                            /*!< The queue size. */
   Os_FifoRefReadCbk ReadCbk;                                      /*!< Function which is used to read from the array. */
+  Os_FifoRefReadSlotCbk SlotCbk;                                  /*!< Function which returns an element address. */
 };
 
 
@@ -203,6 +233,7 @@ Os_FifoRefIndicesInRangeOnWrite,
  *
  *  \param[in,out]  Fifo    The FIFO instance. Parameter must not be NULL.
  *  \param[in]      Value   The value to be enqueued. Parameter must not be NULL.
+ *  \param[in]      Ordered !0, if the opposite side accesses the FIFO concurrently without a common lock.
  *
  *  \retval         OS_FIFOWRITERESULT_OK              If writing succeeded.
  *  \retval         OS_FIFOWRITERESULT_BUFFEROVERFLOW  If the queue is already full.
@@ -218,7 +249,8 @@ OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE Os_FifoWriteResultType, OS_CODE,
 OS_ALWAYS_INLINE, Os_FifoRefEnqueue,
 (
   P2CONST(Os_FifoRefWriteConfigType, AUTOMATIC, OS_APPL_DATA) Fifo,
-  P2CONST(void, TYPEDEF, AUTOMATIC) Value
+  P2CONST(void, TYPEDEF, AUTOMATIC) Value,
+  Os_StdReturnType Ordered
 ));
 
 
@@ -247,6 +279,82 @@ Os_FifoRefIsFull,
 ));
 
 
+/***********************************************************************************************************************
+ *  Os_FifoRefLoan()
+ **********************************************************************************************************************/
+/*! \brief          Loans the element at the next write position of the queue to the caller.
+ *  \details        The caller fills the element in place. The element becomes visible to the reader not before
+ *                  Os_FifoRefCommit() is called.
+ *
+ *  \param[in,out]  Fifo    The FIFO instance. Parameter must not be NULL.
+ *  \param[in]      Ordered !0, if the opposite side accesses the FIFO concurrently without a common lock.
+ *
+ *  \return         The address of the loaned element. NULL_PTR, if the queue is already full.
+ *
+ *  \context        ANY
+ *
+ *  \reentrant      TRUE for different FIFOs
+ *  \synchronous    TRUE
+ *
+ *  \pre            No element of the queue is loaned.
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE P2VAR(void, AUTOMATIC, OS_APPL_DATA), OS_CODE,
+OS_ALWAYS_INLINE, Os_FifoRefLoan,
+(
+  P2CONST(Os_FifoRefWriteConfigType, AUTOMATIC, OS_APPL_DATA) Fifo,
+  Os_StdReturnType Ordered
+));
+
+
+/***********************************************************************************************************************
+ *  Os_FifoRefCommit()
+ **********************************************************************************************************************/
+/*! \brief          Enqueues the loaned element.
+ *  \details        --no details--
+ *
+ *  \param[in,out]  Fifo    The FIFO instance. Parameter must not be NULL.
+ *  \param[in]      Ordered !0, if the opposite side accesses the FIFO concurrently without a common lock.
+ *
+ *  \context        ANY
+ *
+ *  \reentrant      TRUE for different FIFOs
+ *  \synchronous    TRUE
+ *
+ *  \pre            An element of the queue is loaned.
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,
+Os_FifoRefCommit,
+(
+  P2CONST(Os_FifoRefWriteConfigType, AUTOMATIC, OS_APPL_DATA) Fifo,
+  Os_StdReturnType Ordered
+));
+
+
+/***********************************************************************************************************************
+ *  Os_FifoRefIsLoaned()
+ **********************************************************************************************************************/
+/*! \brief          Returns whether an element of the queue is loaned.
+ *  \details        --no details--
+ *
+ *  \param[in]      Fifo  The FIFO to query. Parameter must not be NULL.
+ *
+ *  \retval         !0    If an element is loaned.
+ *  \retval         0     If no element is loaned.
+ *
+ *  \context        ANY
+ *
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *
+ *  \pre            -
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE Os_StdReturnType, OS_CONST, OS_ALWAYS_INLINE,
+Os_FifoRefIsLoaned,
+(
+  P2CONST(Os_FifoRefWriteConfigType, AUTOMATIC, OS_APPL_DATA) Fifo
+));
+
+
 /***********************************************************************************************************************
  *  FIFO Read Functions
  **********************************************************************************************************************/
@@ -306,6 +414,7 @@ Os_FifoRefIndicesInRangeOnRead,
  *
  *  \param[in,out]  Fifo    The FIFO instance. Parameter must not be NULL.
  *  \param[out]     DataRef Pointer to the location to receive the data. Parameter must not be NULL.
+ *  \param[in]      Ordered !0, if the opposite side accesses the FIFO concurrently without a common lock.
  *
  *  \return         Returns the value of the eldest element.
  *
@@ -321,7 +430,8 @@ OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,
 Os_FifoRefDequeue,
 (
   P2CONST(Os_FifoRefReadConfigType, AUTOMATIC, OS_APPL_DATA) Fifo,
-  P2VAR(void, TYPEDEF, AUTOMATIC) DataRef
+  P2VAR(void, TYPEDEF, AUTOMATIC) DataRef,
+  Os_StdReturnType Ordered
 ));
 
 
@@ -350,11 +460,87 @@ Os_FifoRefIsEmpty,
 ));
 
 
+/***********************************************************************************************************************
+ *  Os_FifoRefBorrow()
+ **********************************************************************************************************************/
+/*! \brief          Lends the eldest element in the queue to the caller without removing it.
+ *  \details        The element is not overwritten by the writer, until Os_FifoRefRelease() is called.
+ *
+ *  \param[in,out]  Fifo    The FIFO instance. Parameter must not be NULL.
+ *  \param[in]      Ordered !0, if the opposite side accesses the FIFO concurrently without a common lock.
+ *
+ *  \return         The address of the eldest element.
+ *
+ *  \context        ANY
+ *
+ *  \reentrant      TRUE for different FIFOs
+ *  \synchronous    TRUE
+ *
+ *  \pre            The queue is not empty.
+ *  \pre            No element of the queue is borrowed.
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE P2CONST(void, AUTOMATIC, OS_APPL_DATA), OS_CODE,
+OS_ALWAYS_INLINE, Os_FifoRefBorrow,
+(
+  P2CONST(Os_FifoRefReadConfigType, AUTOMATIC, OS_APPL_DATA) Fifo,
+  Os_StdReturnType Ordered
+));
+
+
+/***********************************************************************************************************************
+ *  Os_FifoRefRelease()
+ **********************************************************************************************************************/
+/*! \brief          Removes the borrowed element from the queue.
+ *  \details        --no details--
+ *
+ *  \param[in,out]  Fifo    The FIFO instance. Parameter must not be NULL.
+ *  \param[in]      Ordered !0, if the opposite side accesses the FIFO concurrently without a common lock.
+ *
+ *  \context        ANY
+ *
+ *  \reentrant      TRUE for different FIFOs
+ *  \synchronous    TRUE
+ *
+ *  \pre            An element of the queue is borrowed.
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,
+Os_FifoRefRelease,
+(
+  P2CONST(Os_FifoRefReadConfigType, AUTOMATIC, OS_APPL_DATA) Fifo,
+  Os_StdReturnType Ordered
+));
+
+
+/***********************************************************************************************************************
+ *  Os_FifoRefIsBorrowed()
+ **********************************************************************************************************************/
+/*! \brief          Returns whether an element of the queue is borrowed.
+ *  \details        --no details--
+ *
+ *  \param[in]      Fifo  The FIFO to query. Parameter must not be NULL.
+ *
+ *  \retval         !0    If an element is borrowed.
+ *  \retval         0     If no element is borrowed.
+ *
+ *  \context        ANY
+ *
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *
+ *  \pre            -
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE Os_StdReturnType, OS_CONST, OS_ALWAYS_INLINE,
+Os_FifoRefIsBorrowed,
+(
+  P2CONST(Os_FifoRefReadConfigType, AUTOMATIC, OS_APPL_DATA) Fifo
+));
+
+
 /***********************************************************************************************************************
  *  Os_FifoRefEmptyQueue()
  **********************************************************************************************************************/
 /*! \brief          Empties the queue from the receiver side.
- *  \details        --no details--
+ *  \details        A borrowed element is released as well.
  *
  *  \param[in,out]  Fifo    The FIFO instance. Parameter must not be NULL.
  *
@@ -62,7 +62,9 @@
 # if defined(OS_STATIC_CODE_ANALYSIS)                                                                                   /* COV_OS_STATICCODEANALYSIS */
 #  include "Os_Hal_StaticCodeAnalysis.h"
 # else
-#  if defined (OS_CFG_COMPILER_TASKING)
+#  if defined (OS_CFG_DERIVATIVEGROUP_POSIX)
+#   include "Os_Hal_Compiler_PosixInt.h"
+#  elif defined (OS_CFG_COMPILER_TASKING)
 #   include "Os_Hal_Compiler_TaskingInt.h"
 #  elif defined (OS_CFG_COMPILER_GNU)
 #   include "Os_Hal_Compiler_HighTecInt.h"
@@ -61,7 +61,7 @@
 /* Os hal module dependencies */
 # include "Os_Hal_Compiler.h"
 
-# if defined (OS_CFG_COMPILER_GNU)
+# if defined (OS_CFG_COMPILER_GNU) && !defined (OS_CFG_DERIVATIVEGROUP_POSIX)
 
 /**********************************************************************************************************************
  *  GLOBAL CONSTANT MACROS
@@ -0,0 +1,424 @@
+/**********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2021 by Vector Informatik GmbH.                                              All rights reserved.
+ *
+ *                This software is copyright protected and proprietary to Vector Informatik GmbH.
+ *                Vector Informatik GmbH grants to you only those rights as set out in the license conditions.
+ *                All other rights remain with Vector Informatik GmbH.
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/**
+ * \ingroup    Os_Hal
+ * \addtogroup Os_Hal_Compiler
+ * \brief   Compiler abstraction of the POSIX host derivative (GCC and Clang)
+ *
+ * \{
+ *
+ * \file    Os_Hal_Compiler_PosixInt.h
+ * \brief   This file contains the specific keyword definition for host compilers.
+ * \details
+ * The POSIX host derivative has no TriCore core special function registers and no context save areas. The
+ * abstractions which are needed by the generic HAL modules are mapped to GCC builtins or to the interrupt emulation
+ * of Os_Hal_Core_Posix.c. The TriCore register abstractions (Mfcr, Mtcr, Mta<n>, ...) are not provided on purpose:
+ * each use outside of the TriCore specific files is a porting error.
+ *
+ * The interrupt and exception entry macros do not generate vector table code. Category 2 and unhandled interrupt
+ * entries are plain C functions, which register themselves at the interrupt emulation during program startup.
+ *********************************************************************************************************************/
+/***********************************************************************************************************************
+ *  REVISION HISTORY
+ *  --------------------------------------------------------------------------------------------------------------------
+ *  Refer to Os_Hal_Os.h.
+ **********************************************************************************************************************/
+
+
+#ifndef OS_HAL_COMPILER_POSIXINT_H
+# define OS_HAL_COMPILER_POSIXINT_H
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+# include "Std_Types.h"
+# include "Os_CommonInt.h"
+
+/**********************************************************************************************************************
+ *  GLOBAL CONSTANT MACROS
+ *********************************************************************************************************************/
+/*! \brief  Abstraction for compiler specific attributes, required by core */
+# define OS_ALWAYS_INLINE            __attribute__((always_inline))
+# define OS_NORETURN                 __attribute__((noreturn))
+# define OS_FLATTEN                  __attribute__((flatten))
+# define OS_PURE                     __attribute__((pure))
+# define OS_LIKELY(x)                __builtin_expect(!!(x), 1)
+# define OS_UNLIKELY(x)              __builtin_expect(!!(x), 0)
+
+/*! \brief  Abstraction for HAL specific compiler attribute to prevent from inlining a function. */
+# define OS_HAL_NOINLINE             __attribute__((noinline))
+
+/*! \brief  Abstraction for thread local storage. Each emulated core is one host thread. */
+# define OS_HAL_POSIX_THREAD_LOCAL   __thread
+
+/**********************************************************************************************************************
+ *  GLOBAL FUNCTION MACROS
+ *********************************************************************************************************************/
+
+
+/*! \brief      Declares a function with a compiler specific attribute.
+ *  \details    The implementations prototype has to be created with OS_FUNC_ATTRIBUTE_DEFINITION.
+ *  \param[in]  rettype       The return type of the function.
+ *  \param[in]  memclass      The memory class of the function.
+ *  \param[in]  attribute     The function attribute {OS_ALWAYS_INLINE; OS_PURE, ...}.
+ *  \param[in]  functionName  The function name.
+ *  \param[in]  arguments     The function arguments in brackets. E.g. (uint8 a, uint16 b) or (void).
+ */
+# define OS_FUNC_ATTRIBUTE_DECLARATION(rettype, memclass, attribute, functionName, arguments) \
+         attribute FUNC(rettype, memclass) functionName arguments
+
+
+/*! \brief      Provides a function prototype for function definitions with a compiler specific attribute.
+ *  \details    The declaration has to be created with OS_FUNC_ATTRIBUTE_DECLARE.
+ *  \param[in]  rettype       The return type of the function.
+ *  \param[in]  memclass      The memory class of the function.
+ *  \param[in]  attribute     The function attribute {OS_ALWAYS_INLINE; OS_PURE, ...}.
+ *  \param[in]  functionName  The function name.
+ *  \param[in]  arguments     The function arguments in brackets. E.g. (uint8 a, uint16 b) or (void).
+ */
+# define OS_FUNC_ATTRIBUTE_DEFINITION(rettype, memclass, attribute, functionName, arguments) \
+         attribute FUNC(rettype, memclass) functionName arguments
+
+
+/*! \brief      Compiler abstraction for preprocessor string concatenation.
+ *  \details    The define is used, when a macro calls another macro with string concatenation.
+ *  \param[in]  x       The called macro which needs sting concatenation.
+ */
+# define OS_HAL_EXPAND(x)  OS_HAL_EXPAND1(x)
+# define OS_HAL_EXPAND1(x) #x
+
+
+/*! \brief         Abstraction of disabling core local interrupt.
+ *  \details       Clears the IE flag of the emulated ICR of the calling core.
+ *  \context       ANY
+ *  \reentrant     FALSE
+ *  \synchronous   TRUE
+ *  \pre           -
+ */
+# define Os_Hal_Disable()         Os_Hal_PosixIntDisable()
+
+
+/*! \brief         Abstraction of enabling core local interrupt.
+ *  \details       Sets the IE flag of the emulated ICR of the calling core and handles pending interrupts.
+ *  \context       ANY
+ *  \reentrant     FALSE
+ *  \synchronous   TRUE
+ *  \pre           -
+ */
+# define Os_Hal_Enable()          Os_Hal_PosixIntEnable()
+
+
+/*! \brief         Abstraction of the ISYNC instruction.
+ *  \details       There is no instruction pipeline to synchronize on the host, only compiler reordering is
+ *                 prevented.
+ *  \context       ANY
+ *  \reentrant     FALSE
+ *  \synchronous   TRUE
+ *  \pre           -
+ */
+# define Os_Hal_Isync()           __atomic_signal_fence(__ATOMIC_SEQ_CST)
+
+
+/*! \brief         Abstraction of the DSYNC instruction.
+ *  \context       ANY
+ *  \reentrant     FALSE
+ *  \synchronous   TRUE
+ *  \pre           -
+ */
+# define Os_Hal_Dsync()           __atomic_thread_fence(__ATOMIC_SEQ_CST)
+
+
+/*! \brief         Abstraction of the CLZ instruction.
+ *  \details       __builtin_clz() is undefined for 0, the TriCore instruction returns 32.
+ *  \param[in]     x       The value, whose leading zero needs to be counted.
+ *  \return        The number of leading zero.
+ *  \context       ANY
+ *  \reentrant     FALSE
+ *  \synchronous   TRUE
+ *  \pre           -
+ */
+# define Os_Hal_Clz(x)            (((uint32)(x) == 0uL) ? 32u : (uint32)__builtin_clz((uint32)(x)))
+
+
+/*! \brief         Abstraction of the CMPSWAP instruction.
+ *  \param[in]     x       The address of the spinlock variable.
+ *  \param[in]     y       The value that should be swapped.
+ *  \param[in]     z.......The condition value. Only when *x == z, y is swapped
+ *  \return        The value of *x before the operation.
+ *  \context       ANY
+ *  \reentrant     FALSE
+ *  \synchronous   TRUE
+ *  \pre           -
+ */
+# define Os_Hal_CmpSwap(x, y, z)  Os_Hal_PosixCmpSwap((x), (y), (z))
+
+
+/*! \brief         Abstraction of the DEBUG instruction.
+ *  \context       ANY
+ *  \reentrant     FALSE
+ *  \synchronous   TRUE
+ *  \pre           -
+ */
+# define Os_Hal_Debug()           __builtin_trap()
+
+
+/*! \brief         Abstraction of the NOP instruction.
+ *  \details       Used in busy waiting loops, thus the host's spin loop hint is used.
+ *  \context       ANY
+ *  \reentrant     FALSE
+ *  \synchronous   TRUE
+ *  \pre           -
+ */
+# if defined (__x86_64__) || defined (__i386__)
+#  define Os_Hal_Nop()            __builtin_ia32_pause()
+# elif defined (__aarch64__) || defined (__arm__)
+#  define Os_Hal_Nop()            __asm__ __volatile__ ("yield" ::: "memory")
+# else
+#  define Os_Hal_Nop()            __atomic_signal_fence(__ATOMIC_SEQ_CST)
+# endif
+
+
+/*! \brief         Abstraction of exception and interrupt section declarations.
+ *  \details       The host derivative does not need a vector table section.
+ */
+# define Os_Hal_ExceptionSectionDeclaration(core)
+# define Os_Hal_InterruptSectionDeclaration(core)
+
+
+/*! \brief         Abstraction of unhandled exception entry.
+ *  \details       Synchronous host exceptions are not mapped to TriCore trap classes, thus no entry is needed.
+ *  \param[in]     core       On which core the entry is registered.
+ *  \param[in]     class      For which class the entry is registered.
+ */
+# define Os_Hal_UnhandledTrapEntry(core, class)
+
+
+/*! \brief         Abstraction of memory protection exception entry.
+ *  \details       The host derivative has no memory protection, thus no entry is needed.
+ *  \param[in]     core       On which core the entry is registered.
+ *  \param[in]     class      For which class the entry is registered.
+ */
+# define Os_Hal_MemoryTrapEntry(core, class)
+
+
+/*! \brief         Abstraction of system call exception entry.
+ *  \details       System calls are plain function calls on the host (see Os_Hal_DefineTrapFunction()).
+ *  \param[in]     core       On which core the entry is registered.
+ */
+# define Os_Hal_SysCallTrapEntry(core)
+
+
+/*! \brief         Abstraction of user defined exception entry.
+ *  \details       Synchronous host exceptions are not mapped to TriCore trap classes, thus no entry is needed.
+ *  \param[in]     core       On which core the entry is registered.
+ *  \param[in]     class      For which class the entry is registered.
+ *  \param[in]     UserFunc   The user function, which is to be called.
+ */
+# define Os_Hal_UserTrapEntry(core, class, UserFunc)
+
+
+/*! \brief         Abstraction of Cat2 interrupt entry.
+ *  \details       Defines the handler function of the given level and registers it at the interrupt emulation of
+ *                 the given core. The interrupt emulation calls the handler with disabled interrupts and the
+ *                 current priority set to level, as the TriCore hardware does.
+ *  \param[in]     core          On which core the entry is registered. It must be in range [0, 6].
+ *  \param[in]     level         For which level the entry is registered. It must be in range [0, 255].
+ *  \param[in]     systemlevel   The interrupt level, until which the interrupts are disabled.
+ *  \param[in]     isrconfig     The ISR configuration data, which should be handled.
+ *  \context       ANY
+ *  \reentrant     FALSE
+ *  \synchronous   TRUE
+ *  \pre           -
+ */
+# define Os_Hal_Cat2InterruptEntry(core, level, systemlevel, isrconfig) \
+  static void osIsrLevel_##level##_Core##core(void) \
+  { \
+    Os_Hal_IsrRun((P2CONST(Os_IsrConfigType, AUTOMATIC, OS_CONST))&(isrconfig)); \
+  } \
+  __attribute__((constructor)) static void osIsrLevelRegister_##level##_Core##core(void) \
+  { \
+    Os_Hal_PosixIntRegisterVector((uint32)(core), (uint32)(level), osIsrLevel_##level##_Core##core); \
+  }
+
+
+/*! \brief         Abstraction of unhandled interrupt entry.
+ *  \details       Levels without a registered handler are reported by the interrupt emulation itself, thus no
+ *                 entry is needed.
+ *  \param[in]     core          On which core the entry is registered. It must be in range [0, 6].
+ *  \param[in]     level         For which level the entry is registered. It must be in range [0, 255].
+ */
+# define Os_Hal_UnhandledInterruptEntry(core, level)
+
+
+/*! \brief         Abstraction of Cat0 interrupt entry.
+ *  \details       The user function is registered at the interrupt emulation of the given core.
+ *  \param[in]     core       On which core the entry is registered. It must be in range [0, 6].
+ *  \param[in]     level      For which level the entry is registered. It must be in range [0, 255].
+ *  \param[in]     function   The user function, which is to be called.
+ */
+# define Os_Hal_Cat0InterruptEntry(core, level, function) \
+  __attribute__((constructor)) static void osIsrLevelRegister_##level##_Core##core(void) \
+  { \
+    Os_Hal_PosixIntRegisterVector((uint32)(core), (uint32)(level), function); \
+  }
+
+
+/*! \brief         Abstraction of Cat1 interrupt entry.
+ *  \details       The user function is registered at the interrupt emulation of the given core.
+ *  \param[in]     core       On which core the entry is registered. It must be in range [0, 6].
+ *  \param[in]     level      For which level the entry is registered. It must be in range [0, 255].
+ *  \param[in]     function   The user function, which is to be called.
+ */
+# define Os_Hal_Cat1InterruptEntry(core, level, function) \
+  __attribute__((constructor)) static void osIsrLevelRegister_##level##_Core##core(void) \
+  { \
+    Os_Hal_PosixIntRegisterVector((uint32)(core), (uint32)(level), function); \
+  }
+
+
+ /*! \brief         Abstraction of function declaration to trigger system call.
+  *  \param[in]     name       The function name.
+  *  \param[in]     parameters The parameters
+  *  \param[in]     id         The system call identifier (TIN in system call handler)
+  *  \context       ANY
+  *  \reentrant     FALSE
+  *  \synchronous   TRUE
+  *  \pre           -
+  */
+# define Os_Hal_DeclareTrapFunction(name, parameters, id)   \
+         OS_FUNC_ATTRIBUTE_DECLARATION(void, OS_CODE, OS_HAL_NOINLINE, name, parameters)
+
+
+ /*! \brief         Abstraction of function definition to trigger system call.
+  *  \details       There is no privilege level change on the host. The system call is emulated by
+  *                 Os_Hal_PosixSysCall(), which enters Os_Hal_SysCall() with the same interrupt state transitions as
+  *                 the TriCore SYSCALL instruction.
+  *  \param[in]     name                  The function name.
+  *  \param[in]     parametersAsArguments The parameters in form of the function arguments (with types)
+  *  \param[in]     parameters            The pure name of the parameters
+  *  \param[in]     id                    The system call identifier (TIN in system call handler)
+  *  \context       ANY
+  *  \reentrant     FALSE
+  *  \synchronous   TRUE
+  *  \pre           -
+  */
+# define Os_Hal_DefineTrapFunction(name, parametersAsArguments, parameters, id)   \
+         OS_FUNC_ATTRIBUTE_DEFINITION(void, OS_CODE, OS_HAL_NOINLINE, name, parametersAsArguments) \
+         { \
+           Os_Hal_PosixSysCall((uint32)(id), (parameters)); \
+         }
+
+/**********************************************************************************************************************
+ *  GLOBAL DATA TYPES AND STRUCTURES
+ *********************************************************************************************************************/
+
+/*! Handler function of an emulated interrupt level. */
+typedef P2FUNC(void, OS_CODE, Os_Hal_PosixIntVectorType)(void);
+
+
+/**********************************************************************************************************************
+ *  GLOBAL DATA PROTOTYPES
+ *********************************************************************************************************************/
+
+
+/**********************************************************************************************************************
+ *  GLOBAL FUNCTION PROTOTYPES
+ *********************************************************************************************************************/
+
+# define OS_START_SEC_CODE
+# include "Os_MemMap_OsCode.h"                                                                                          /* PRQA S 5087 */ /* MD_MSR_MemMap */
+
+/*! \brief         Disables interrupts of the calling emulated core.
+ *  \context       ANY
+ *  \reentrant     FALSE
+ *  \synchronous   TRUE
+ *  \pre           -
+ */
+FUNC(void, OS_CODE) Os_Hal_PosixIntDisable(void);
+
+
+/*! \brief         Enables interrupts of the calling emulated core and handles pending interrupts.
+ *  \context       ANY
+ *  \reentrant     FALSE
+ *  \synchronous   TRUE
+ *  \pre           -
+ */
+FUNC(void, OS_CODE) Os_Hal_PosixIntEnable(void);
+
+
+/*! \brief         Registers the handler of an interrupt level of an emulated core.
+ *  \details       Called from the interrupt entries during program startup.
+ *  \param[in]     Core     Physical core ID.
+ *  \param[in]     Level    The interrupt level. It must be in range [1, 255].
+ *  \param[in]     Vector   The handler function.
+ *  \context       Program startup
+ *  \reentrant     FALSE
+ *  \synchronous   TRUE
+ *  \pre           -
+ */
+FUNC(void, OS_CODE) Os_Hal_PosixIntRegisterVector(uint32 Core, uint32 Level, Os_Hal_PosixIntVectorType Vector);
+
+
+/*! \brief         Emulates the SYSCALL instruction.
+ *  \param[in]     Tin      The system call identifier.
+ *  \param[in]     Packet   The trap packet, which is passed to Os_Hal_SysCall().
+ *  \context       ANY
+ *  \reentrant     TRUE
+ *  \synchronous   TRUE
+ *  \pre           -
+ */
+FUNC(void, OS_CODE) Os_Hal_PosixSysCall(uint32 Tin, P2VAR(void, AUTOMATIC, OS_VAR_NOINIT) Packet);
+
+
+/*! \brief         Abstraction of the CMPSWAP instruction.
+ *  \param[in,out] Address    The address of the variable.
+ *  \param[in]     Value      The value that should be swapped.
+ *  \param[in]     Condition  Only when *Address == Condition, Value is swapped.
+ *  \return        The value of *Address before the operation.
+ *  \context       ANY
+ *  \reentrant     TRUE
+ *  \synchronous   TRUE
+ *  \pre           -
+ */
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE uint32, OS_CODE, OS_ALWAYS_INLINE, Os_Hal_PosixCmpSwap,
+(
+  P2VAR(volatile uint32, AUTOMATIC, OS_VAR_NOINIT) Address,
+  uint32 Value,
+  uint32 Condition
+));
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE uint32, OS_CODE, OS_ALWAYS_INLINE, Os_Hal_PosixCmpSwap,
+(
+  P2VAR(volatile uint32, AUTOMATIC, OS_VAR_NOINIT) Address,
+  uint32 Value,
+  uint32 Condition
+))
+{
+  uint32 expected = Condition;
+
+  /* #10 On failure the current value is written to expected, on success it already holds the old value. */
+  (void)__atomic_compare_exchange_n(Address, &expected, Value, 0, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+  return expected;
+}
+
+# define OS_STOP_SEC_CODE
+# include "Os_MemMap_OsCode.h"                                                                                          /* PRQA S 5087 */ /* MD_MSR_MemMap */
+
+#endif /* OS_HAL_COMPILER_POSIXINT_H */
+
+/*!
+ * \}
+ */
+/**********************************************************************************************************************
+ *  END OF FILE: Os_Hal_Compiler_PosixInt.h
+ *********************************************************************************************************************/
@@ -76,6 +76,8 @@
 /**********************************************************************************************************************
  *  GLOBAL FUNCTIONS
  **********************************************************************************************************************/
+/* The POSIX host core module provides these functions in Os_Hal_Context_Posix.c. */
+#if !defined (OS_HAL_CORE_POSIX)
 
 /***********************************************************************************************************************
  *  Os_Hal_ContextSwitch()
@@ -184,6 +186,8 @@ OS_HAL_NOINLINE, Os_Hal_ContextCallOnStack,
 
 
 
+#endif /* if !defined (OS_HAL_CORE_POSIX) */
+
 
 #define OS_STOP_SEC_CODE
 #include "Os_MemMap_OsCode.h"                                                                                           /* PRQA S 5087 */ /* MD_MSR_MemMap */
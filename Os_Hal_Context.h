@@ -71,6 +71,10 @@
 /***********************************************************************************************************************
  *  GLOBAL FUNCTION PROTOTYPES
  **********************************************************************************************************************/
+/* The POSIX host core module switches host contexts instead of CSA lists (see Os_Hal_Context_Posix.h). */
+# if defined (OS_HAL_CORE_POSIX)
+#  include "Os_Hal_Context_Posix.h"
+# else
 # define OS_START_SEC_CODE
 # include "Os_MemMap_OsCode.h"                                                                                          /* PRQA S 5087 */ /* MD_MSR_MemMap */
 
@@ -879,6 +883,7 @@ Os_Hal_ContextRestoreFpuContext,
 
 # define OS_STOP_SEC_CODE
 # include "Os_MemMap_OsCode.h"                                                                                          /* PRQA S 5087 */ /* MD_MSR_MemMap */
+# endif /* if defined (OS_HAL_CORE_POSIX) */
 
 #endif /* OS_HAL_CONTEXT_H */
 
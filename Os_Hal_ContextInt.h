@@ -45,6 +45,11 @@
  *  \note Add a FPU interface, so kernel decides generally when to save/restore/disable/enable FPU.
  *        The context switches would get faster, because FPU registers are typically a lot of data to save/restore.
  *
+ *  \note Lazy FPU switching, i.e. saving the FPU registers only if another thread uses the FPU, does not apply to
+ *        TriCore. The FPU works on the general purpose registers, which are saved with the upper and lower context
+ *        anyway, and there is no FPU disable trap to detect the first FPU access of a thread. Therefore
+ *        Os_Hal_ContextStoreFpuContext() and Os_Hal_ContextRestoreFpuContext() are empty.
+ *
  *
  *  \see \ref ContextSwitch
  *  \see \ref Os_Thread
@@ -112,6 +117,32 @@
  *  Some of this information may be automatically saved by hardware (on stack or some kind of dedicated saving area).
  *  In this case you may need to save a pointer to this data, to be able to instruct the hardware to restore it later.
  */
+# if defined (OS_HAL_CORE_POSIX)
+struct Os_Hal_ContextType_Tag
+{
+  /*! The saved host context (ucontext_t) on the stack of the suspended thread.
+   *  NULL_PTR if the thread is started from the beginning, when it is resumed the next time. */
+  P2VAR(void, AUTOMATIC, OS_VAR_NOINIT) Frame;
+
+  /*! The execution start address of the thread. 0 if only the return address is executed (aborted thread). */
+  Os_Hal_AddressType Entry;
+
+  /*! The address which is executed after the entry function has returned. */
+  Os_Hal_AddressType ReturnAddress;
+
+  /*! The stack start address of the thread (the lower address). */
+  Os_Hal_AddressType StackLow;
+
+  /*! The stack end address of the thread (the upper address). */
+  Os_Hal_AddressType StackHigh;
+
+  /*! The first pointer parameter. */
+  P2CONST(void, AUTOMATIC, OS_VAR_NOINIT) Parameter;
+
+  /*! The interrupt state (ICR format), which is applied when the thread is resumed. */
+  uint32 IntState;
+};
+# else
 struct Os_Hal_ContextType_Tag
 {
   /*! The link register, from which the thread will be proceeded. */
@@ -140,6 +171,7 @@ struct Os_Hal_ContextType_Tag
   /*! The first pointer parameter. */
   uint32 A4;
 };
+# endif /* if defined (OS_HAL_CORE_POSIX) */
 
 
 /*! Information needed to initialize the context of a thread.
@@ -153,10 +185,10 @@ struct Os_Hal_ContextType_Tag
 struct Os_Hal_ContextConfigType_Tag
 {
   /*! The stack end address of this thread (the upper address). */
-  uint32 StackEndAddr;
+  Os_Hal_AddressType StackEndAddr;
 
   /*! The stack start address of this thread (the lower address). */
-  uint32 StackStartAddr;
+  Os_Hal_AddressType StackStartAddr;
 
   /*! The PSW register configuration containing
       - protection set for AURIX and AURIX2G (corresponding to memory protection identifier),
@@ -169,10 +201,10 @@ struct Os_Hal_ContextConfigType_Tag
   uint32 ProtectionSet;
 
   /*! The execution start address of this thread. */
-  uint32 Entry;
+  Os_Hal_AddressType Entry;
 
   /*! The return address of this thread, which is depending on whether it is a task, ISR, trusted or non-trusted. */
-  uint32 ReturnAddress;
+  Os_Hal_AddressType ReturnAddress;
 
   /*! The interrupt level and global flag of this thread, which is depending on whether it is a task, a ISR or
    *  a Hook. This attribute is to be written into PCXI register. */
@@ -189,10 +221,10 @@ struct Os_Hal_ContextConfigType_Tag
 struct Os_Hal_ContextStackConfigType_Tag
 {
   /*! Stack start address (lower bound) */
-  uint32 StackRegionStart;
+  Os_Hal_AddressType StackRegionStart;
 
   /*! Stack end address (higher bound) */
-  uint32 StackRegionEnd;
+  Os_Hal_AddressType StackRegionEnd;
 };
 
 
@@ -639,6 +671,25 @@ Os_Hal_ContextIsExceptionContextModificationSupported,
 ));
 
 
+# if defined (OS_HAL_CORE_POSIX)
+/***********************************************************************************************************************
+ *  Os_Hal_ContextIntResume()
+ **********************************************************************************************************************/
+/*! \brief        Resumes the given context on the POSIX host platform.
+ *  \details      The host context of the thread is restored, if it has been suspended before. Otherwise the thread is
+ *                started on its stack: the entry function is called with the parameter, afterwards the return address.
+ *  \param[in]    Next      The context to resume. Parameter must not be NULL.
+ *  \context      OS_INTERNAL
+ *  \reentrant    TRUE for different context.
+ *  \synchronous  TRUE
+ *  \pre          Interrupts are disabled globally.
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(void, OS_CODE, OS_NORETURN,
+Os_Hal_ContextIntResume,
+(
+  P2CONST(Os_Hal_ContextType, AUTOMATIC, OS_VAR_NOINIT) Next
+));
+# else
 /***********************************************************************************************************************
  *  Os_Hal_ContextIntCleanupCSAs()
  **********************************************************************************************************************/
@@ -773,6 +824,9 @@ Os_Hal_ContextIntRestore,
 ));
 
 
+# endif /* if defined (OS_HAL_CORE_POSIX) */
+
+
 /***********************************************************************************************************************
  *  Os_Hal_ContextFetchInitialFpuContext()
  **********************************************************************************************************************/
@@ -0,0 +1,344 @@
+/**********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2021 by Vector Informatik GmbH.                                              All rights reserved.
+ *
+ *                This software is copyright protected and proprietary to Vector Informatik GmbH.
+ *                Vector Informatik GmbH grants to you only those rights as set out in the license conditions.
+ *                All other rights remain with Vector Informatik GmbH.
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/**
+ * \addtogroup  Os_Hal_Context
+ * \{
+ *
+ * \file        Os_Hal_Context_Posix.c
+ * \brief       Context related primitives of the POSIX host platform which must not be inlined.
+ * \details     Threads are suspended with getcontext() on their own stack and resumed with setcontext().
+ *              Threads which have not been suspended yet are started with makecontext() on their configured stack.
+ *
+ *********************************************************************************************************************/
+/***********************************************************************************************************************
+ *  REVISION HISTORY
+ *  --------------------------------------------------------------------------------------------------------------------
+ *  Refer to Os_Hal_Os.h.
+ **********************************************************************************************************************/
+
+                                                                                                                        /* PRQA S 0777 EOF */ /* MD_MSR_Rule5.1 */
+
+#define OS_HAL_CONTEXT_POSIX_SOURCE
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+/* AUTOSAR includes */
+#include "Std_Types.h"
+
+/* Os kernel module dependencies */
+
+/* Os hal dependencies */
+#include "Os_Hal_Context.h"
+
+#if defined (OS_HAL_CORE_POSIX)
+
+/* Host dependencies */
+# include <stdint.h>
+# include <ucontext.h>
+
+/**********************************************************************************************************************
+ *  LOCAL CONSTANT MACROS
+ **********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ *  LOCAL FUNCTION MACROS
+ **********************************************************************************************************************/
+
+/*! Converts a configured address to a host pointer. */
+# define OS_HAL_CONTEXT_ADDRESS_TO_PTR(address)     ((void*)(uintptr_t)(address))
+
+/**********************************************************************************************************************
+ *  LOCAL DATA TYPES AND STRUCTURES
+ **********************************************************************************************************************/
+
+/*! Entry function of a thread. */
+typedef P2FUNC(void, OS_CODE, Os_Hal_ContextEntryType)(P2CONST(void, AUTOMATIC, OS_VAR_NOINIT) Parameter);
+
+/*! Return address of a thread. */
+typedef P2FUNC(void, OS_CODE, Os_Hal_ContextReturnType)(void);
+
+/**********************************************************************************************************************
+ *  LOCAL DATA PROTOTYPES
+ **********************************************************************************************************************/
+
+/*! Host context, which starts a thread on its configured stack. One per core. */
+static ucontext_t Os_Hal_ContextStarter[OS_CFG_COREPHYSICALID_COUNT];
+
+/*! The context, which is started by Os_Hal_ContextStarter. One per core. */
+static P2CONST(Os_Hal_ContextType, AUTOMATIC, OS_VAR_NOINIT) Os_Hal_ContextStarting[OS_CFG_COREPHYSICALID_COUNT];
+
+/**********************************************************************************************************************
+ *  GLOBAL DATA
+ **********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ *  LOCAL FUNCTION PROTOTYPES
+ **********************************************************************************************************************/
+# define OS_START_SEC_CODE
+# include "Os_MemMap_OsCode.h"                                                                                          /* PRQA S 5087 */ /* MD_MSR_MemMap */
+
+/***********************************************************************************************************************
+ *  Os_Hal_ContextIntRun()
+ **********************************************************************************************************************/
+/*! \brief        Runs the given context on the current stack.
+ *  \details      Applies the interrupt state of the context, calls its entry function and afterwards its return
+ *                address.
+ *  \param[in]    Context   The context to run. Parameter must not be NULL.
+ *  \context      OS_INTERNAL
+ *  \reentrant    TRUE for different context.
+ *  \synchronous  TRUE
+ *  \pre          Interrupts are disabled globally.
+ *  \pre          Os_Hal_PosixCoreType.ResumeIcr holds the interrupt state of the context.
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(static void, OS_CODE, OS_NORETURN,
+Os_Hal_ContextIntRun,
+(
+  P2CONST(Os_Hal_ContextType, AUTOMATIC, OS_VAR_NOINIT) Context
+));
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_ContextIntStart()
+ **********************************************************************************************************************/
+/*! \brief        Start function of the host context Os_Hal_ContextStarter.
+ *  \context      OS_INTERNAL
+ *  \reentrant    TRUE
+ *  \synchronous  TRUE
+ *  \pre          Interrupts are disabled globally.
+ **********************************************************************************************************************/
+static void Os_Hal_ContextIntStart(void);
+
+
+/**********************************************************************************************************************
+ *  LOCAL FUNCTIONS
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *  Os_Hal_ContextIntRun()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(static void, OS_CODE, OS_NORETURN,
+Os_Hal_ContextIntRun,
+(
+  P2CONST(Os_Hal_ContextType, AUTOMATIC, OS_VAR_NOINIT) Context
+))
+{
+  /* #10 Take over the context data, as the context may be re-initialized while the thread is running. */
+  Os_Hal_AddressType entry = Context->Entry;
+  Os_Hal_AddressType returnAddress = Context->ReturnAddress;
+  P2CONST(void, AUTOMATIC, OS_VAR_NOINIT) parameter = Context->Parameter;
+
+  /* #20 Apply the interrupt state of the thread. */
+  Os_Hal_PosixIcrWrite(Os_Hal_PosixCoreGetSelf()->ResumeIcr);
+
+  /* #30 Call the entry function, if the thread has not been aborted. */
+  if(entry != 0uL)
+  {
+    ((Os_Hal_ContextEntryType)OS_HAL_CONTEXT_ADDRESS_TO_PTR(entry))(parameter);                                         /* PRQA S 0305 */ /* MD_Os_Hal_Rule11.1_0305 */
+  }
+
+  /* #40 Call the return address, which never returns. */
+  ((Os_Hal_ContextReturnType)OS_HAL_CONTEXT_ADDRESS_TO_PTR(returnAddress))();                                           /* PRQA S 0305 */ /* MD_Os_Hal_Rule11.1_0305 */
+
+  Os_Hal_CoreFreeze();
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_ContextIntStart()
+ **********************************************************************************************************************/
+static void Os_Hal_ContextIntStart(void)
+{
+  Os_Hal_ContextIntRun(Os_Hal_ContextStarting[Os_Hal_PosixCoreId]);
+}
+
+
+/**********************************************************************************************************************
+ *  GLOBAL FUNCTIONS
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *  Os_Hal_ContextIntResume()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(void, OS_CODE, OS_NORETURN,
+Os_Hal_ContextIntResume,
+(
+  P2CONST(Os_Hal_ContextType, AUTOMATIC, OS_VAR_NOINIT) Next
+))
+{
+  /* #10 Hand over the interrupt state to the resumed thread. */
+  Os_Hal_PosixCoreGetSelf()->ResumeIcr = Next->IntState;
+
+  /* #20 If the thread has been suspended, restore its host context. */
+  if(Next->Frame != NULL_PTR)
+  {
+    (void)setcontext((const ucontext_t*)Next->Frame);
+  }
+  /* #30 Otherwise start the thread on its stack. */
+  else
+  {
+    P2VAR(ucontext_t, AUTOMATIC, OS_VAR_NOINIT) starter = &Os_Hal_ContextStarter[Os_Hal_PosixCoreId];
+
+    Os_Hal_ContextStarting[Os_Hal_PosixCoreId] = Next;
+    (void)getcontext(starter);
+    starter->uc_stack.ss_sp = OS_HAL_CONTEXT_ADDRESS_TO_PTR(Next->StackLow);
+    starter->uc_stack.ss_size = (size_t)(Next->StackHigh - Next->StackLow);
+    starter->uc_link = NULL_PTR;
+    makecontext(starter, Os_Hal_ContextIntStart, 0);
+    (void)setcontext(starter);
+  }
+
+  /* #40 Freeze the core, if the host context could not be restored. */
+  Os_Hal_CoreFreeze();
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_ContextSwitch()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(void, OS_CODE,
+OS_HAL_NOINLINE, Os_Hal_ContextSwitch,
+(
+  P2VAR(Os_Hal_ContextType, AUTOMATIC, OS_VAR_NOINIT) Current,
+  P2CONST(Os_Hal_ContextType, AUTOMATIC, OS_VAR_NOINIT) Next
+))
+{
+  ucontext_t frame;
+  volatile uint32 resumed = 0uL;
+
+  /* #10 Save the interrupt state and the host context of the current thread. */
+  Current->IntState = Os_Hal_PosixCoreGetSelf()->Icr & (OS_HAL_ICR_INT_MASK | OS_HAL_ICR_INT_LEVEL_MASK);              /* SBSW_OS_HAL_PWA_CALLER */
+  Current->Frame = &frame;                                                                                              /* SBSW_OS_HAL_PWA_CALLER */
+  (void)getcontext(&frame);
+
+  /* #20 Resume the next thread. */
+  if(resumed == 0uL)
+  {
+    resumed = 1uL;
+    Os_Hal_ContextIntResume(Next);                                                                                      /* SBSW_OS_HAL_FC_CALLER */
+  }
+
+  /* #30 The current thread has been resumed: apply its interrupt state. */
+  Os_Hal_PosixIcrWrite(Os_Hal_PosixCoreGetSelf()->ResumeIcr);
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_ContextCall()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(void, OS_CODE,
+OS_HAL_NOINLINE, Os_Hal_ContextCall,
+(
+  P2VAR(Os_Hal_ContextType, AUTOMATIC, OS_VAR_NOINIT) Current,
+  P2VAR(Os_Hal_ContextType, AUTOMATIC, OS_VAR_NOINIT) Next
+))
+{
+  ucontext_t frame;
+  volatile uint32 resumed = 0uL;
+
+  /* #10 Save the interrupt state and the host context of the current thread. */
+  Current->IntState = Os_Hal_PosixCoreGetSelf()->Icr & (OS_HAL_ICR_INT_MASK | OS_HAL_ICR_INT_LEVEL_MASK);              /* SBSW_OS_HAL_PWA_CALLER */
+  Current->Frame = &frame;                                                                                              /* SBSW_OS_HAL_PWA_CALLER */
+  (void)getcontext(&frame);
+
+  /* #20 Run the next thread on the current stack. */
+  if(resumed == 0uL)
+  {
+    resumed = 1uL;
+    Os_Hal_PosixCoreGetSelf()->ResumeIcr = Next->IntState;
+    Os_Hal_ContextIntRun(Next);                                                                                         /* SBSW_OS_HAL_FC_CALLER */
+  }
+
+  /* #30 The current thread has been resumed: apply its interrupt state. */
+  Os_Hal_PosixIcrWrite(Os_Hal_PosixCoreGetSelf()->ResumeIcr);
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_ContextCallOnStack()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(void, OS_CODE,
+OS_HAL_NOINLINE, Os_Hal_ContextCallOnStack,
+(
+  P2VAR(Os_Hal_ContextType, AUTOMATIC, OS_VAR_NOINIT) Current,
+  P2CONST(Os_Hal_ContextType, AUTOMATIC, OS_VAR_NOINIT) Next
+))
+{
+  ucontext_t frame;
+  volatile uint32 resumed = 0uL;
+
+  /* #10 Save the interrupt state and the host context of the current thread. */
+  Current->IntState = Os_Hal_PosixCoreGetSelf()->Icr & (OS_HAL_ICR_INT_MASK | OS_HAL_ICR_INT_LEVEL_MASK);              /* SBSW_OS_HAL_PWA_CALLER */
+  Current->Frame = &frame;                                                                                              /* SBSW_OS_HAL_PWA_CALLER */
+  (void)getcontext(&frame);
+
+  /* #20 Run the next thread on its own stack. */
+  if(resumed == 0uL)
+  {
+    resumed = 1uL;
+    Os_Hal_ContextIntResume(Next);                                                                                      /* SBSW_OS_HAL_FC_CALLER */
+  }
+
+  /* #30 The current thread has been resumed: apply its interrupt state. */
+  Os_Hal_PosixIcrWrite(Os_Hal_PosixCoreGetSelf()->ResumeIcr);
+}
+
+
+# define OS_STOP_SEC_CODE
+# include "Os_MemMap_OsCode.h"                                                                                          /* PRQA S 5087 */ /* MD_MSR_MemMap */
+
+#endif /* if defined (OS_HAL_CORE_POSIX) */
+
+/*!
+ * \}
+ */
+
+/**********************************************************************************************************************
+ *  END OF FILE: Os_Hal_Context_Posix.c
+ *********************************************************************************************************************/
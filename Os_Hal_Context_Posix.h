@@ -0,0 +1,386 @@
+/***********************************************************************************************************************
+ *  COPYRIGHT
+ *  --------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2021 by Vector Informatik GmbH.                                              All rights reserved.
+ *
+ *                This software is copyright protected and proprietary to Vector Informatik GmbH.
+ *                Vector Informatik GmbH grants to you only those rights as set out in the license conditions.
+ *                All other rights remain with Vector Informatik GmbH.
+ *  \endverbatim
+ *  --------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  ------------------------------------------------------------------------------------------------------------------*/
+/**
+ *  \addtogroup Os_Hal_Context
+ *
+ *  \{
+ *  \file       Os_Hal_Context_Posix.h
+ *  \brief      Context switching primitives of the POSIX host platform.
+ *  \details    A suspended thread is described by the host context (ucontext_t), which is saved on its own stack.
+ *              A thread which has not been suspended yet is started from its configuration (entry, return address,
+ *              stack). The interrupt state of a context is kept in ICR format and applied by the resumed thread.
+ *              This file replaces the function definitions of Os_Hal_Context.h.
+ *
+ **********************************************************************************************************************/
+/***********************************************************************************************************************
+ *  REVISION HISTORY
+ *  --------------------------------------------------------------------------------------------------------------------
+ *  Refer to Os_Hal_Os.h.
+ **********************************************************************************************************************/
+                                                                                                                        /* PRQA S 0388  EOF */ /* MD_MSR_Dir1.1 */
+
+#ifndef OS_HAL_CONTEXT_POSIX_H
+# define OS_HAL_CONTEXT_POSIX_H
+
+/***********************************************************************************************************************
+ *  INCLUDES
+ **********************************************************************************************************************/
+/* AUTOSAR includes */
+# include "Std_Types.h"
+
+/* Os module dependencies */
+# include "Os_Hal_ContextInt.h"
+
+/* Os HAL dependencies */
+# include "Os_Hal_Core_PosixInt.h"
+
+/***********************************************************************************************************************
+ *  GLOBAL CONSTANT MACROS
+ **********************************************************************************************************************/
+
+
+/***********************************************************************************************************************
+ *  GLOBAL FUNCTION MACROS
+ **********************************************************************************************************************/
+
+/*! Converts an interrupt state in PCXI format (PIE, PCPN) to ICR format (IE, CCPN). */
+# define OS_HAL_CONTEXT_PCXI_TO_ICR(pcxi)                                                     \
+         ((((pcxi) & OS_HAL_PCXI_PIE_MASK) >> OS_HAL_PCXI_IE_TO_PIE) |                         \
+          (((pcxi) & OS_HAL_PCXI_PCPN_MASK) >> OS_HAL_PCXI_CCPN_TO_PCPN))
+
+
+/***********************************************************************************************************************
+ *  GLOBAL DATA TYPES AND STRUCTURES
+ **********************************************************************************************************************/
+
+
+/***********************************************************************************************************************
+ *  GLOBAL DATA PROTOTYPES
+ **********************************************************************************************************************/
+
+
+/***********************************************************************************************************************
+ *  GLOBAL FUNCTION PROTOTYPES
+ **********************************************************************************************************************/
+# define OS_START_SEC_CODE
+# include "Os_MemMap_OsCode.h"                                                                                          /* PRQA S 5087 */ /* MD_MSR_MemMap */
+
+
+/***********************************************************************************************************************
+ *  GLOBAL FUNCTIONS
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *  Os_Hal_ContextInit()
+ *********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DEFINITION(                                                                                           /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,
+Os_Hal_ContextInit,
+(
+  P2CONST(Os_Hal_ContextConfigType, AUTOMATIC, OS_CONST) Config,
+  P2VAR(Os_Hal_ContextType, AUTOMATIC, OS_VAR_NOINIT) Context
+))
+{
+  /* #10 Let the thread start from its entry function, when it is resumed the next time. */
+  Context->Frame = NULL_PTR;                                                                                            /* SBSW_OS_HAL_PWA_CALLER */
+  Context->Entry = Config->Entry;                                                                                       /* SBSW_OS_HAL_PWA_CALLER */
+  Context->ReturnAddress = Config->ReturnAddress;                                                                       /* SBSW_OS_HAL_PWA_CALLER */
+  Context->StackLow = Config->StackStartAddr;                                                                           /* SBSW_OS_HAL_PWA_CALLER */
+  Context->StackHigh = Config->StackEndAddr;                                                                            /* SBSW_OS_HAL_PWA_CALLER */
+  Context->Parameter = NULL_PTR;                                                                                        /* SBSW_OS_HAL_PWA_CALLER */
+
+  /* #20 Take over the configured interrupt state. */
+  Context->IntState = OS_HAL_CONTEXT_PCXI_TO_ICR(Config->IntStatus);                                                    /* SBSW_OS_HAL_PWA_CALLER */
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_ContextReset()
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DEFINITION(                                                                                           /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,
+Os_Hal_ContextReset,
+(
+  P2CONST(Os_Hal_ContextConfigType, AUTOMATIC, OS_CONST) Config,
+  P2VAR(Os_Hal_ContextType, AUTOMATIC, OS_VAR_NOINIT) Context
+))
+{
+  /* #10 There are no resources bound to a context, thus a reset is an initialization. */
+  Os_Hal_ContextInit(Config, Context);                                                                                  /* SBSW_OS_HAL_FC_CALLER */
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_ContextSetParameter()
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DEFINITION(                                                                                           /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE, Os_Hal_ContextSetParameter,
+(
+  P2VAR(Os_Hal_ContextType, AUTOMATIC, OS_VAR_NOINIT) Context,
+  P2CONST(void, AUTOMATIC, OS_VAR_NOINIT) Parameter
+))
+{
+  Context->Parameter = Parameter;                                                                                       /* SBSW_OS_HAL_PWA_CALLER */
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_ContextSetStack()
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DEFINITION(                                                                                           /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE, Os_Hal_ContextSetStack,
+(
+  P2VAR(Os_Hal_ContextType, AUTOMATIC, OS_VAR_NOINIT) Context,
+  P2CONST(Os_Hal_ContextStackConfigType, AUTOMATIC, OS_VAR_NOINIT) Stack
+))
+{
+  Context->StackLow = Stack->StackRegionStart;                                                                          /* SBSW_OS_HAL_PWA_CALLER */
+  Context->StackHigh = Stack->StackRegionEnd;                                                                           /* SBSW_OS_HAL_PWA_CALLER */
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_ContextGetStack()
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,                                           /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+Os_Hal_ContextGetStack,
+(
+  P2CONST(Os_Hal_ContextConfigType, AUTOMATIC, OS_CONST) Context,
+  P2VAR(Os_Hal_ContextStackConfigType, AUTOMATIC, OS_VAR_NOINIT) Stack
+))
+{
+   Stack->StackRegionStart = Context->StackStartAddr;                                                                   /* SBSW_OS_HAL_PWA_CALLER */
+   Stack->StackRegionEnd = Context->StackEndAddr;                                                                       /* SBSW_OS_HAL_PWA_CALLER */
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_ContextSetInterruptState()
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DEFINITION(                                                                                           /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE, Os_Hal_ContextSetInterruptState,
+(
+  P2VAR(Os_Hal_ContextType, AUTOMATIC, OS_VAR_NOINIT) Context,
+  P2CONST(Os_Hal_IntStateType, AUTOMATIC, OS_VAR_NOINIT) InterruptState
+))
+{
+  Context->IntState = *InterruptState & (OS_HAL_ICR_INT_MASK | OS_HAL_ICR_INT_LEVEL_MASK);                              /* SBSW_OS_HAL_PWA_CALLER */
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_ContextSetUserMsrBits()
+ **********************************************************************************************************************/
+/*!
+ * There are no user controlled machine state bits on the host.
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,                                           /* PRQA S 3219, 3673 */ /* MD_Os_Rule2.1_3219, MD_Os_Hal_Rule8.13_3673 */
+Os_Hal_ContextSetUserMsrBits,
+(
+  P2VAR(Os_Hal_ContextType, AUTOMATIC, OS_VAR_NOINIT) Context
+))
+{
+  OS_IGNORE_UNREF_PARAM(Context);                                                                                       /* PRQA S 3112 */ /* MD_MSR_DummyStmt */
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_ContextFirstResume()
+ **********************************************************************************************************************/
+/*!
+ * The host context of the startup code is abandoned.
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(                                                                                           /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE, Os_Hal_ContextFirstResume,
+(
+  P2CONST(Os_Hal_ContextType, AUTOMATIC, OS_VAR_NOINIT) Next
+))
+{
+  /* #10 Restore the next thread context. */
+  Os_Hal_ContextIntResume(Next);                                                                                        /* SBSW_OS_HAL_FC_CALLER */
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_ContextResetAndResume()
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DEFINITION(                                                                                           /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE, Os_Hal_ContextResetAndResume,
+(
+  P2CONST(Os_Hal_ContextConfigType, AUTOMATIC, OS_CONST) CurrentConfig,
+  P2VAR(Os_Hal_ContextType, AUTOMATIC, OS_VAR_NOINIT) Current,
+  P2CONST(Os_Hal_ContextType, AUTOMATIC, OS_VAR_NOINIT) Next
+))
+{
+  /* #10 Disable all interrupts. */
+  Os_Hal_Disable();
+
+  /* #20 Re-initialize the current context. Its host context is dropped, as it is never resumed. */
+  Os_Hal_ContextInit(CurrentConfig, Current);                                                                           /* SBSW_OS_HAL_FC_CALLER */
+
+  /* #30 Restore the next thread context. */
+  Os_Hal_ContextIntResume(Next);                                                                                        /* SBSW_OS_HAL_FC_CALLER */
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_ContextAbort()
+ **********************************************************************************************************************/
+/*!
+ * The context is re-initialized on its stack, but only the return address is executed on resumption.
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(                                                                                           /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE, Os_Hal_ContextAbort,
+(
+  P2CONST(Os_Hal_ContextConfigType, AUTOMATIC, OS_CONST) Config,
+  P2VAR(Os_Hal_ContextType, AUTOMATIC, OS_VAR_NOINIT) Context
+))
+{
+  /* #10 Re-initialize the context. */
+  Os_Hal_ContextInit(Config, Context);                                                                                  /* SBSW_OS_HAL_FC_CALLER */
+
+  /* #20 Skip the entry function. */
+  Context->Entry = 0uL;                                                                                                 /* SBSW_OS_HAL_PWA_CALLER */
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_ContextReturn()
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,                                           /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+Os_Hal_ContextReturn,
+(
+  P2CONST(Os_Hal_ContextType, AUTOMATIC, OS_VAR_NOINIT) Current,
+  P2CONST(Os_Hal_ContextType, AUTOMATIC, OS_VAR_NOINIT) Next
+))
+{
+  OS_IGNORE_UNREF_PARAM(Current);                                                                                       /* PRQA S 3112 */ /* MD_MSR_DummyStmt */
+
+  /* #10 Disable all interrupts. */
+  Os_Hal_Disable();
+
+  /* #20 Restore the next thread context, which has been saved by the context call. */
+  Os_Hal_ContextIntResume(Next);                                                                                        /* SBSW_OS_HAL_FC_CALLER */
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_ContextIsExceptionContextReadingSupported()
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE Os_StdReturnType, OS_CODE, OS_ALWAYS_INLINE,                               /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+Os_Hal_ContextIsExceptionContextReadingSupported,
+(
+  void
+))
+{
+  return 0u;
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_ContextIsExceptionContextModificationSupported()
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE Os_StdReturnType, OS_CODE, OS_ALWAYS_INLINE,                               /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+Os_Hal_ContextIsExceptionContextModificationSupported,
+(
+  void
+))
+{
+  return 0u;
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_ContextFetchInitialFpuContext()
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,                                           /* PRQA S 3219, 3673 */ /* MD_Os_Rule2.1_3219, MD_Os_Hal_Rule8.13_3673 */
+Os_Hal_ContextFetchInitialFpuContext,
+(
+  P2VAR(Os_Hal_ContextFpuContextType, AUTOMATIC, OS_VAR_NOINIT) InitialContext
+))
+{
+  /* #10 Stub implementation: fpu registers are part of the host context. */
+  OS_IGNORE_UNREF_PARAM(InitialContext);                                                                                /* PRQA S 3112 */ /* MD_MSR_DummyStmt */
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_ContextInitFpu()
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,                                           /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+Os_Hal_ContextInitFpu,
+(
+  P2CONST(Os_Hal_ContextFpuContextType, AUTOMATIC, OS_VAR_NOINIT) InitialContext
+))
+{
+  /* #10 Stub implementation: fpu registers are part of the host context. */
+  OS_IGNORE_UNREF_PARAM(InitialContext);                                                                                /* PRQA S 3112 */ /* MD_MSR_DummyStmt */
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_ContextInitFpuContext()
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,                                           /* PRQA S 3219, 3673 */ /* MD_Os_Rule2.1_3219, MD_Os_Hal_Rule8.13_3673 */
+Os_Hal_ContextInitFpuContext,
+(
+  P2VAR(Os_Hal_ContextFpuContextType, AUTOMATIC, OS_VAR_NOINIT) Context,
+  P2CONST(Os_Hal_ContextFpuContextType, AUTOMATIC, OS_VAR_NOINIT) InitialContext
+))
+{
+  /* #10 Stub implementation: fpu registers are part of the host context. */
+  OS_IGNORE_UNREF_PARAM(Context);                                                                                       /* PRQA S 3112 */ /* MD_MSR_DummyStmt */
+  OS_IGNORE_UNREF_PARAM(InitialContext);                                                                                /* PRQA S 3112 */ /* MD_MSR_DummyStmt */
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_ContextStoreFpuContext()
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,                                           /* PRQA S 3219, 3673 */ /* MD_Os_Rule2.1_3219, MD_Os_Hal_Rule8.13_3673 */
+Os_Hal_ContextStoreFpuContext,
+(
+  P2VAR(Os_Hal_ContextFpuContextType, AUTOMATIC, OS_VAR_NOINIT) Context
+))
+{
+  /* #10 Stub implementation: fpu registers are saved with the host context. */
+  OS_IGNORE_UNREF_PARAM(Context);                                                                                       /* PRQA S 3112 */ /* MD_MSR_DummyStmt */
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_ContextRestoreFpuContext()
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,                                           /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+Os_Hal_ContextRestoreFpuContext,
+(
+  P2CONST(Os_Hal_ContextFpuContextType, AUTOMATIC, OS_VAR_NOINIT) Context
+))
+{
+  /* #10 Stub implementation: fpu registers are restored with the host context. */
+  OS_IGNORE_UNREF_PARAM(Context);                                                                                       /* PRQA S 3112 */ /* MD_MSR_DummyStmt */
+}
+
+# define OS_STOP_SEC_CODE
+# include "Os_MemMap_OsCode.h"                                                                                          /* PRQA S 5087 */ /* MD_MSR_MemMap */
+
+#endif /* OS_HAL_CONTEXT_POSIX_H */
+
+/*!
+ * \}
+ */
+
+/***********************************************************************************************************************
+ *  END OF FILE: Os_Hal_Context_Posix.h
+ **********************************************************************************************************************/
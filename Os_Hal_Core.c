@@ -97,6 +97,8 @@
 /***********************************************************************************************************************
  *  GLOBAL FUNCTIONS
  **********************************************************************************************************************/
+/* The POSIX host core module provides these functions in Os_Hal_Core_Posix.c. */
+#if !defined (OS_HAL_CORE_POSIX)
 /***********************************************************************************************************************
  *  Os_Hal_CoreInit()
  **********************************************************************************************************************/
@@ -149,6 +151,7 @@ OS_FUNC_ATTRIBUTE_DEFINITION(void, OS_CODE, OS_NORETURN, Os_Hal_CoreFreeze,
 
   }
 }
+#endif /* if !defined (OS_HAL_CORE_POSIX) */
 
 
 #define OS_STOP_SEC_CODE
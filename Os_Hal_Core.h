@@ -56,6 +56,8 @@
 #  include "Os_Hal_Core_162_P.h"
 # elif defined (OS_HAL_CORE_18)
 #  include "Os_Hal_Core_18.h"                                                                                           /* COV_OS_HAL_CORE_BETA */
+# elif defined (OS_HAL_CORE_POSIX)
+#  include "Os_Hal_Core_Posix.h"
 # else
 #  error "The selected core module is not supported!"
 # endif
@@ -82,6 +84,8 @@
  *  GLOBAL FUNCTION PROTOTYPES
  **********************************************************************************************************************/
 
+/* The POSIX host core module implements all core primitives on its own (see Os_Hal_Core_Posix.h). */
+# if !defined (OS_HAL_CORE_POSIX)
 # define OS_START_SEC_CODE
 # include "Os_MemMap_OsCode.h"                                                                                          /* PRQA S 5087 */ /* MD_MSR_MemMap */
 
@@ -398,6 +402,97 @@ OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE, Os_Hal_SpinUnlock,
 }
 
 
+/***********************************************************************************************************************
+ *  Os_Hal_BitFieldCmpSwap()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(                                                                                           /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+OS_LOCAL_INLINE Os_Hal_BitFieldType, OS_CODE, OS_ALWAYS_INLINE,
+Os_Hal_BitFieldCmpSwap,
+(
+  P2VAR(volatile Os_Hal_BitFieldType, AUTOMATIC, OS_VAR_NOINIT) BitField,
+  Os_Hal_BitFieldType Value,
+  Os_Hal_BitFieldType Condition
+))
+{
+  Os_Hal_BitFieldType previous;
+
+  /* #10 Publish all preceding writes before the new value becomes visible. */
+  Os_Hal_Dsync();
+
+  /* #20 Swap by the CMPSWAP.W instruction. */
+  previous = (Os_Hal_BitFieldType)Os_Hal_CmpSwap(BitField, Value, Condition);                                           /* SBSW_OS_HAL_FC_CALLER */
+
+  /* #30 Order the following accesses after the operation. */
+  Os_Hal_Dsync();
+
+  return previous;
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_BitFieldSetAtomic()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(                                                                                           /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,
+Os_Hal_BitFieldSetAtomic,
+(
+  P2VAR(volatile Os_Hal_BitFieldType, AUTOMATIC, OS_VAR_NOINIT) BitField,
+  Os_Hal_BitFieldType Mask
+))
+{
+  Os_Hal_BitFieldType expected;
+  Os_Hal_BitFieldType current = *BitField;
+
+  /* #10 Retry the swap until no other core has modified the bit field in between. */
+  do
+  {
+    expected = current;
+    current = Os_Hal_BitFieldCmpSwap(BitField, (expected | Mask), expected);                                            /* SBSW_OS_HAL_FC_CALLER */
+  } while(current != expected);
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_BitFieldClearAtomic()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(                                                                                           /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,
+Os_Hal_BitFieldClearAtomic,
+(
+  P2VAR(volatile Os_Hal_BitFieldType, AUTOMATIC, OS_VAR_NOINIT) BitField,
+  Os_Hal_BitFieldType Mask
+))
+{
+  Os_Hal_BitFieldType expected;
+  Os_Hal_BitFieldType current = *BitField;
+
+  /* #10 Retry the swap until no other core has modified the bit field in between. */
+  do
+  {
+    expected = current;
+    current = Os_Hal_BitFieldCmpSwap(BitField, (expected & (Os_Hal_BitFieldType)(~Mask)), expected);                    /* SBSW_OS_HAL_FC_CALLER */
+  } while(current != expected);
+}
+
+
 /***********************************************************************************************************************
  *  Os_Hal_XSigInit()
  **********************************************************************************************************************/
@@ -475,6 +570,7 @@ Os_Hal_CoreNop,
 
 # define OS_STOP_SEC_CODE
 # include "Os_MemMap_OsCode.h"                                                                                          /* PRQA S 5087 */ /* MD_MSR_MemMap */
+# endif /* if !defined (OS_HAL_CORE_POSIX) */
 
 #endif /* OS_HAL_CORE_H */
 
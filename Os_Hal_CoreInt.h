@@ -65,6 +65,8 @@
 #  include "Os_Hal_Core_162_PInt.h"
 # elif defined (OS_HAL_CORE_18)
 #  include "Os_Hal_Core_18Int.h"                                                                                        /* COV_OS_HAL_CORE_BETA */
+# elif defined (OS_HAL_CORE_POSIX)
+#  include "Os_Hal_Core_PosixInt.h"
 # else
 #  error "The selected core module is not supported!"
 # endif
@@ -105,7 +107,7 @@ struct Os_Hal_CoreConfigType_Tag
   uint32 ProgramCounterRegister;
 
   /*! The address of the start label */
-  uint32 StartLabelAddress;
+  Os_Hal_AddressType StartLabelAddress;
 
   /*! The global address of the DBGSR register on this core */
   uint32 DBGSRRegister;
@@ -689,6 +691,84 @@ Os_Hal_SpinUnlock,
 ));
 
 
+/***********************************************************************************************************************
+ *  Os_Hal_BitFieldCmpSwap()
+ **********************************************************************************************************************/
+/*! \brief        Atomically replaces a bit field shared between cores, if it holds the expected value.
+ *  \details      The operation is ordered after all preceding and before all subsequent memory accesses of the
+ *                caller, regardless of whether the swap took place. This is the only compare and swap primitive of
+ *                the HAL, all other atomic read-modify-write operations are built on it.
+ *
+ *  \param[in,out]  BitField   The bit field to modify. Parameter must not be NULL.
+ *  \param[in]      Value      The value to store.
+ *  \param[in]      Condition  The value the bit field must hold for the store to take place.
+ *
+ *  \return       The value of the bit field before the operation. The swap took place, if it equals Condition.
+ *
+ *  \context      ANY
+ *
+ *  \reentrant    TRUE
+ *  \synchronous  TRUE
+ *
+ *  \pre          -
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE Os_Hal_BitFieldType, OS_CODE, OS_ALWAYS_INLINE,
+Os_Hal_BitFieldCmpSwap,
+(
+  P2VAR(volatile Os_Hal_BitFieldType, AUTOMATIC, OS_VAR_NOINIT) BitField,
+  Os_Hal_BitFieldType Value,
+  Os_Hal_BitFieldType Condition
+));
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_BitFieldSetAtomic()
+ **********************************************************************************************************************/
+/*! \brief        Atomically sets the given bits in a bit field shared between cores.
+ *  \details      The operation is ordered after all preceding memory accesses of the caller.
+ *
+ *  \param[in,out]  BitField  The bit field to modify. Parameter must not be NULL.
+ *  \param[in]      Mask      The bits to set.
+ *
+ *  \context      OS_INTERNAL
+ *
+ *  \reentrant    TRUE
+ *  \synchronous  TRUE
+ *
+ *  \pre          -
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,
+Os_Hal_BitFieldSetAtomic,
+(
+  P2VAR(volatile Os_Hal_BitFieldType, AUTOMATIC, OS_VAR_NOINIT) BitField,
+  Os_Hal_BitFieldType Mask
+));
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_BitFieldClearAtomic()
+ **********************************************************************************************************************/
+/*! \brief        Atomically clears the given bits in a bit field shared between cores.
+ *  \details      The operation is ordered before all subsequent memory accesses of the caller.
+ *
+ *  \param[in,out]  BitField  The bit field to modify. Parameter must not be NULL.
+ *  \param[in]      Mask      The bits to clear.
+ *
+ *  \context      OS_INTERNAL
+ *
+ *  \reentrant    TRUE
+ *  \synchronous  TRUE
+ *
+ *  \pre          -
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,
+Os_Hal_BitFieldClearAtomic,
+(
+  P2VAR(volatile Os_Hal_BitFieldType, AUTOMATIC, OS_VAR_NOINIT) BitField,
+  Os_Hal_BitFieldType Mask
+));
+
+
 /***********************************************************************************************************************
  *  Os_Hal_XSigInit()
  **********************************************************************************************************************/
@@ -0,0 +1,640 @@
+/***********************************************************************************************************************
+ *  COPYRIGHT
+ *  --------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2021 by Vector Informatik GmbH.                                              All rights reserved.
+ *
+ *                This software is copyright protected and proprietary to Vector Informatik GmbH.
+ *                Vector Informatik GmbH grants to you only those rights as set out in the license conditions.
+ *                All other rights remain with Vector Informatik GmbH.
+ *  \endverbatim
+ *  --------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  ------------------------------------------------------------------------------------------------------------------*/
+/**
+ *  \addtogroup Os_Hal_Core
+ *  \{
+ *
+ *  \file       Os_Hal_Core_Posix.c
+ *  \brief      Core and interrupt emulation of the POSIX host platform.
+ *  \details    See Os_Hal_Core_PosixInt.h for the emulation model.
+ *
+ **********************************************************************************************************************/
+/***********************************************************************************************************************
+ *  REVISION HISTORY
+ *  --------------------------------------------------------------------------------------------------------------------
+ *  Refer to Os_Hal_Os.h.
+ **********************************************************************************************************************/
+
+                                                                                                                        /* PRQA S 0777 EOF */ /* MD_MSR_Rule5.1 */
+
+#define OS_HAL_CORE_POSIX_SOURCE
+
+/***********************************************************************************************************************
+ *  INCLUDES
+ **********************************************************************************************************************/
+/* AUTOSAR includes */
+#include "Std_Types.h"
+
+/* Os module declarations */
+#include "Os_Hal_Core.h"
+
+/* Os kernel module dependencies */
+
+/* Os HAL dependencies */
+#include "Os_Hal_Os.h"
+#include "Os_Hal_Cfg.h"
+#include "Os_Hal_EntryInt.h"
+#include "Os_Hal_InterruptInt.h"
+
+#if defined (OS_HAL_CORE_POSIX)
+
+/* Host dependencies */
+# include <errno.h>
+# include <stdint.h>
+# include <stdlib.h>
+
+/***********************************************************************************************************************
+ *  VERSION CHECK
+ **********************************************************************************************************************/
+
+/* Check the version of OS header file */
+# if (  (OS_HAL_SW_MAJOR_VERSION != (2u)) \
+     || (OS_HAL_SW_MINOR_VERSION != (49u)) \
+     || (OS_HAL_SW_PATCH_VERSION != (0u)) )
+#  error "Vendor specific version numbers of Os_Hal_Core_Posix.c and Os_Hal_Os.h are inconsistent"
+# endif
+
+/***********************************************************************************************************************
+ *  LOCAL CONSTANT MACROS
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *  LOCAL FUNCTION MACROS
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *  LOCAL DATA TYPES AND STRUCTURES
+ **********************************************************************************************************************/
+
+/*! Start label of a core. */
+typedef P2FUNC(void, OS_CODE, Os_Hal_PosixStartLabelType)(void);
+
+/***********************************************************************************************************************
+ *  LOCAL DATA PROTOTYPES
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *  GLOBAL DATA
+ **********************************************************************************************************************/
+
+/*! Emulation data of all physical cores. */
+VAR(Os_Hal_PosixCoreType, OS_VAR_NOINIT) Os_Hal_PosixCore[OS_CFG_COREPHYSICALID_COUNT];
+
+/*! Emulated service request control registers. */
+volatile VAR(uint32, OS_VAR_NOINIT) Os_Hal_PosixSrc[OS_HAL_INT_SRC_COUNT];
+
+/*! Physical core ID of the calling host thread. */
+OS_HAL_POSIX_THREAD_LOCAL VAR(uint32, OS_VAR_NOINIT) Os_Hal_PosixCoreId;
+
+/***********************************************************************************************************************
+ *  LOCAL FUNCTION PROTOTYPES
+ **********************************************************************************************************************/
+# define OS_START_SEC_CODE
+# include "Os_MemMap_OsCode.h"                                                                                          /* PRQA S 5087 */ /* MD_MSR_MemMap */
+
+/***********************************************************************************************************************
+ *  Os_Hal_PosixIntGetAccepted()
+ **********************************************************************************************************************/
+/*! \brief        Returns the highest pending level of the given core, which is accepted by its ICR.
+ *  \param[in]    Core    The emulation data of the calling core.
+ *  \return       The accepted level or 0, if no level is accepted.
+ *  \context      ANY
+ *  \reentrant    TRUE
+ *  \synchronous  TRUE
+ *  \pre          -
+ **********************************************************************************************************************/
+static uint32 Os_Hal_PosixIntGetAccepted(P2CONST(Os_Hal_PosixCoreType, AUTOMATIC, OS_VAR_NOINIT) Core);
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_PosixIntAcknowledge()
+ **********************************************************************************************************************/
+/*! \brief        Clears the service request of the source which is assigned to the given level.
+ *  \details      The request is only acknowledged, if the source is still enabled, pending and routed to the level
+ *                and the core. Otherwise the level has been raised spuriously.
+ *  \param[in]    Core    The emulation data of the calling core.
+ *  \param[in]    Level   The accepted level.
+ *  \retval       !0      The request has been acknowledged and the level handler is to be called.
+ *  \retval       0       The request is spurious.
+ *  \context      ANY
+ *  \reentrant    TRUE
+ *  \synchronous  TRUE
+ *  \pre          -
+ **********************************************************************************************************************/
+static uint32 Os_Hal_PosixIntAcknowledge(P2CONST(Os_Hal_PosixCoreType, AUTOMATIC, OS_VAR_NOINIT) Core, uint32 Level);
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_PosixIntNotify()
+ **********************************************************************************************************************/
+/*! \brief        Marks the level of a pending source as pending on its target core and notifies the core.
+ *  \param[in]    SrcValue    The value of the SRC register.
+ *  \context      ANY
+ *  \reentrant    TRUE
+ *  \synchronous  TRUE
+ *  \pre          -
+ **********************************************************************************************************************/
+static void Os_Hal_PosixIntNotify(uint32 SrcValue);
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_PosixSignalHandler()
+ **********************************************************************************************************************/
+/*! \brief        Handler of OS_HAL_POSIX_SIGNAL. Handles accepted interrupts of the calling core.
+ *  \param[in]    Signal    The signal number.
+ *  \context      Signal handler
+ *  \reentrant    TRUE
+ *  \synchronous  FALSE
+ *  \pre          -
+ **********************************************************************************************************************/
+static void Os_Hal_PosixSignalHandler(int Signal);
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_PosixCoreThread()
+ **********************************************************************************************************************/
+/*! \brief        Host thread of a started core. Executes the start label of the core.
+ *  \param[in]    Argument    The core configuration.
+ *  \details      If the start label returns, the core is stopped and the host thread terminates.
+ *  \return       Never returns, if the start label does not return.
+ *  \context      Host thread
+ *  \reentrant    TRUE
+ *  \synchronous  TRUE
+ *  \pre          -
+ **********************************************************************************************************************/
+static void* Os_Hal_PosixCoreThread(void* Argument);
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_PosixCoreInitData()
+ **********************************************************************************************************************/
+/*! \brief        Initializes the level to source assignment of all cores during program startup.
+ *  \context      Program startup
+ *  \reentrant    FALSE
+ *  \synchronous  TRUE
+ *  \pre          -
+ **********************************************************************************************************************/
+static void Os_Hal_PosixCoreInitData(void) __attribute__((constructor));
+
+
+/***********************************************************************************************************************
+ *  LOCAL FUNCTIONS
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *  Os_Hal_PosixIntGetAccepted()
+ **********************************************************************************************************************/
+static uint32 Os_Hal_PosixIntGetAccepted(P2CONST(Os_Hal_PosixCoreType, AUTOMATIC, OS_VAR_NOINIT) Core)
+{
+  uint32 icr = Core->Icr;
+  uint32 level = 0uL;
+  uint32 index = OS_HAL_POSIX_LEVEL_WORDS;
+
+  /* #10 If interrupts are enabled, search the highest pending level. */
+  if((icr & OS_HAL_ICR_INT_MASK) != 0uL)
+  {
+    while(index > 0uL)
+    {
+      uint32 pending;
+
+      index--;
+      pending = __atomic_load_n(&Core->PendingLevels[index], __ATOMIC_SEQ_CST);
+      if(pending != 0uL)
+      {
+        level = (index * 32uL) + (31uL - (uint32)Os_Hal_Clz(pending));
+        break;
+      }
+    }
+
+    /* #20 Accept the level, if it is above the current priority. */
+    if(level <= (icr & OS_HAL_ICR_INT_LEVEL_MASK))
+    {
+      level = 0uL;
+    }
+  }
+
+  return level;
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_PosixIntAcknowledge()
+ **********************************************************************************************************************/
+static uint32 Os_Hal_PosixIntAcknowledge(P2CONST(Os_Hal_PosixCoreType, AUTOMATIC, OS_VAR_NOINIT) Core, uint32 Level)
+{
+  uint32 source = Core->LevelSource[Level];
+  uint32 expected = OS_HAL_INT_SRC_SRE_MASK | OS_HAL_INT_SRC_SRR_MASK | Level |
+                    (Os_Hal_PosixCoreId << OS_HAL_INT_SRC_TOS_SHIFTVALUE);
+  uint32 checkMask = OS_HAL_INT_SRC_SRE_MASK | OS_HAL_INT_SRC_SRR_MASK | OS_HAL_INT_SRC_SRPN_MASK |
+                     OS_HAL_INT_SRC_TOS_MASK;
+  uint32 acknowledged = 0uL;
+
+  if(source < OS_HAL_INT_SRC_COUNT)
+  {
+    uint32 srcValue = __atomic_load_n(&Os_Hal_PosixSrc[source], __ATOMIC_SEQ_CST);
+
+    /* #10 Clear SRR, as long as the source is enabled, pending and routed to the level of this core. */
+    while(((srcValue & checkMask) == expected) && (acknowledged == 0uL))
+    {
+      if(__atomic_compare_exchange_n(&Os_Hal_PosixSrc[source], &srcValue, srcValue & ~OS_HAL_INT_SRC_SRR_MASK, 0,
+                                     __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST))
+      {
+        acknowledged = 1uL;
+      }
+    }
+  }
+
+  return acknowledged;
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_PosixIntNotify()
+ **********************************************************************************************************************/
+static void Os_Hal_PosixIntNotify(uint32 SrcValue)
+{
+  uint32 level = SrcValue & OS_HAL_INT_SRC_SRPN_MASK;
+  uint32 core = (SrcValue & OS_HAL_INT_SRC_TOS_MASK) >> OS_HAL_INT_SRC_TOS_SHIFTVALUE;
+
+  if((level != 0uL) && (core < (uint32)OS_CFG_COREPHYSICALID_COUNT))
+  {
+    P2VAR(Os_Hal_PosixCoreType, AUTOMATIC, OS_VAR_NOINIT) target = &Os_Hal_PosixCore[core];
+
+    /* #10 Mark the level as pending. */
+    (void)__atomic_fetch_or(&target->PendingLevels[level / 32uL], (1uL << (level % 32uL)), __ATOMIC_SEQ_CST);
+
+    /* #20 If the calling core is the target, handle the level synchronously. */
+    if(core == Os_Hal_PosixCoreId)
+    {
+      if(target->Dispatching == 0)
+      {
+        Os_Hal_PosixIcrWrite(target->Icr);
+      }
+    }
+    /* #30 Otherwise notify the target core, if it is running. */
+    else if(target->Started != 0uL)
+    {
+      (void)pthread_kill(target->Thread, OS_HAL_POSIX_SIGNAL);
+    }
+    else
+    {
+      /* The core handles the level, when it enables interrupts the first time. */
+    }
+  }
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_PosixSignalHandler()
+ **********************************************************************************************************************/
+static void Os_Hal_PosixSignalHandler(int Signal)
+{
+  int savedErrno = errno;
+
+  OS_IGNORE_UNREF_PARAM(Signal);                                                                                        /* PRQA S 3112 */ /* MD_MSR_DummyStmt */
+
+  /* #10 Handle accepted interrupts, unless the core is currently evaluating them anyway. */
+  if(Os_Hal_PosixCoreId < (uint32)OS_CFG_COREPHYSICALID_COUNT)
+  {
+    P2CONST(Os_Hal_PosixCoreType, AUTOMATIC, OS_VAR_NOINIT) core = Os_Hal_PosixCoreGetSelf();
+
+    if((core->Dispatching == 0) && ((core->Icr & OS_HAL_ICR_INT_MASK) != 0uL))
+    {
+      Os_Hal_PosixIntDispatch();
+    }
+  }
+
+  errno = savedErrno;
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_PosixCoreThread()
+ **********************************************************************************************************************/
+static void* Os_Hal_PosixCoreThread(void* Argument)
+{
+  P2CONST(Os_Hal_CoreConfigType, AUTOMATIC, OS_CONST) config = (P2CONST(Os_Hal_CoreConfigType, AUTOMATIC, OS_CONST))Argument;
+
+  /* #10 Bind the host thread to the core and execute the start label. */
+  Os_Hal_PosixCoreId = config->CoreId;
+  ((Os_Hal_PosixStartLabelType)(uintptr_t)config->StartLabelAddress)();                                                 /* PRQA S 0305 */ /* MD_Os_Hal_Rule11.1_0305 */
+
+  /* #20 The start label has returned: the core stops and is not notified any longer. */
+  __atomic_store_n(&Os_Hal_PosixCore[config->CoreId].Started, 0uL, __ATOMIC_SEQ_CST);
+
+  return NULL_PTR;
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_PosixCoreInitData()
+ **********************************************************************************************************************/
+static void Os_Hal_PosixCoreInitData(void)
+{
+  uint32 core;
+  uint32 level;
+
+  for(core = 0uL; core < (uint32)OS_CFG_COREPHYSICALID_COUNT; core++)
+  {
+    for(level = 0uL; level < OS_HAL_POSIX_LEVEL_COUNT; level++)
+    {
+      Os_Hal_PosixCore[core].LevelSource[level] = OS_HAL_POSIX_NO_SOURCE;
+    }
+  }
+}
+
+
+/***********************************************************************************************************************
+ *  GLOBAL FUNCTIONS
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *  Os_Hal_PosixIntDispatch()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ *
+ *
+ */
+FUNC(void, OS_CODE) Os_Hal_PosixIntDispatch(void)
+{
+  P2VAR(Os_Hal_PosixCoreType, AUTOMATIC, OS_VAR_NOINIT) core = Os_Hal_PosixCoreGetSelf();
+  uint32 level;
+
+  do
+  {
+    /* #10 Ignore notifications while the pending levels are evaluated. */
+    core->Dispatching = 1;
+
+    level = Os_Hal_PosixIntGetAccepted(core);
+    while(level != 0uL)
+    {
+      /* #20 Take the level and acknowledge its source. */
+      (void)__atomic_fetch_and(&core->PendingLevels[level / 32uL], ~(1uL << (level % 32uL)), __ATOMIC_SEQ_CST);
+
+      if(Os_Hal_PosixIntAcknowledge(core, level) != 0uL)
+      {
+        uint32 icr = core->Icr;
+        Os_Hal_PosixIntVectorType vector = core->Vector[level];
+
+        /* #30 Enter the handler with interrupts disabled and the level as current priority.
+         *     The handler may switch to another thread, thus notifications are accepted again. */
+        core->Icr = level;
+        core->Dispatching = 0;
+
+        if(vector != NULL_PTR)
+        {
+          vector();
+        }
+        else
+        {
+          Os_Hal_UnhandledIrq((Os_InterruptSourceIdType)level, 0uL, NULL_PTR);                                          /* SBSW_OS_HAL_FC_CONST */
+        }
+
+        /* #40 Return from the handler (RFE). */
+        core->Dispatching = 1;
+        core->Icr = icr;
+      }
+
+      level = Os_Hal_PosixIntGetAccepted(core);
+    }
+
+    core->Dispatching = 0;
+
+    /* #50 Evaluate again, if a level has been raised while notifications were ignored. */
+  } while(Os_Hal_PosixIntGetAccepted(core) != 0uL);
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_PosixSrcModify()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ */
+FUNC(void, OS_CODE) Os_Hal_PosixSrcModify(uint32 Source, uint32 ClearMask, uint32 SetMask)
+{
+  P2VAR(volatile uint32, AUTOMATIC, OS_VAR_NOINIT) src = &Os_Hal_PosixSrc[Source / OS_HAL_INT_SRC_SIZE];
+  uint32 setMask = SetMask;
+  uint32 oldValue;
+  uint32 newValue;
+
+  /* #10 SETR sets the service request, CLRR clears it. Both bits read as zero. */
+  if((setMask & OS_HAL_INT_SRC_SETR_MASK) != 0uL)
+  {
+    setMask = (setMask & ~OS_HAL_INT_SRC_SETR_MASK) | OS_HAL_INT_SRC_SRR_MASK;
+  }
+  if((setMask & OS_HAL_INT_SRC_CLRR_MASK) != 0uL)
+  {
+    setMask &= ~(OS_HAL_INT_SRC_CLRR_MASK | OS_HAL_INT_SRC_SRR_MASK);
+  }
+
+  /* #20 Modify the register atomically. */
+  oldValue = __atomic_load_n(src, __ATOMIC_SEQ_CST);
+  do
+  {
+    newValue = (oldValue & ~ClearMask) | setMask;
+  } while(__atomic_compare_exchange_n(src, &oldValue, newValue, 0, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST) == 0);
+
+  /* #30 Notify the target core, if the source is pending and enabled. */
+  if((newValue & (OS_HAL_INT_SRC_SRR_MASK | OS_HAL_INT_SRC_SRE_MASK)) ==
+     (OS_HAL_INT_SRC_SRR_MASK | OS_HAL_INT_SRC_SRE_MASK))
+  {
+    Os_Hal_PosixIntNotify(newValue);
+  }
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_PosixIntRegisterVector()
+ **********************************************************************************************************************/
+FUNC(void, OS_CODE) Os_Hal_PosixIntRegisterVector(uint32 Core, uint32 Level, Os_Hal_PosixIntVectorType Vector)
+{
+  if((Core < (uint32)OS_CFG_COREPHYSICALID_COUNT) && (Level < OS_HAL_POSIX_LEVEL_COUNT))
+  {
+    Os_Hal_PosixCore[Core].Vector[Level] = Vector;
+  }
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_PosixIntDisable()
+ **********************************************************************************************************************/
+FUNC(void, OS_CODE) Os_Hal_PosixIntDisable(void)
+{
+  P2VAR(Os_Hal_PosixCoreType, AUTOMATIC, OS_VAR_NOINIT) core = Os_Hal_PosixCoreGetSelf();
+
+  core->Icr &= ~OS_HAL_ICR_INT_MASK;
+  __atomic_signal_fence(__ATOMIC_SEQ_CST);
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_PosixIntEnable()
+ **********************************************************************************************************************/
+FUNC(void, OS_CODE) Os_Hal_PosixIntEnable(void)
+{
+  Os_Hal_PosixIcrWrite(Os_Hal_PosixCoreGetSelf()->Icr | OS_HAL_ICR_INT_MASK);
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_PosixSysCall()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ */
+FUNC(void, OS_CODE) Os_Hal_PosixSysCall(uint32 Tin, P2VAR(void, AUTOMATIC, OS_VAR_NOINIT) Packet)
+{
+  P2VAR(Os_Hal_PosixCoreType, AUTOMATIC, OS_VAR_NOINIT) core = Os_Hal_PosixCoreGetSelf();
+  uint32 icr = core->Icr;
+  uint32 pcxi;
+
+  /* #10 Save the interrupt state in PCXI format and disable interrupts, as the SYSCALL trap does. */
+  pcxi = ((icr & OS_HAL_ICR_INT_MASK) << OS_HAL_PCXI_IE_TO_PIE) |
+         ((icr & OS_HAL_ICR_INT_LEVEL_MASK) << OS_HAL_PCXI_CCPN_TO_PCPN);
+  core->Icr = icr & ~OS_HAL_ICR_INT_MASK;
+
+  /* #20 Handle the system call. */
+  pcxi = Os_Hal_SysCall(Tin, pcxi, (P2VAR(Os_TrapPacketType, AUTOMATIC, OS_VAR_NOINIT))Packet, NULL_PTR);             /* SBSW_OS_HAL_FC_CALLER */
+
+  /* #30 Return from the trap (RFE). */
+  Os_Hal_PosixIcrWrite(((pcxi & OS_HAL_PCXI_PIE_MASK) >> OS_HAL_PCXI_IE_TO_PIE) |
+                       ((pcxi & OS_HAL_PCXI_PCPN_MASK) >> OS_HAL_PCXI_CCPN_TO_PCPN));
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_PosixCoreIdle()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ */
+FUNC(void, OS_CODE) Os_Hal_PosixCoreIdle(void)
+{
+  sigset_t notification;
+  sigset_t previous;
+  sigset_t waiting;
+
+  /* #10 Block notifications, so that no notification gets lost between the check and the suspension. */
+  (void)sigemptyset(&notification);
+  (void)sigaddset(&notification, OS_HAL_POSIX_SIGNAL);
+  (void)pthread_sigmask(SIG_BLOCK, &notification, &previous);
+
+  /* #20 Suspend until a notification arrives, if no level is accepted. */
+  if(Os_Hal_PosixIntGetAccepted(Os_Hal_PosixCoreGetSelf()) == 0uL)
+  {
+    waiting = previous;
+    (void)sigdelset(&waiting, OS_HAL_POSIX_SIGNAL);
+    (void)sigsuspend(&waiting);
+  }
+
+  /* #30 Restore the notification mask and handle accepted levels. */
+  (void)pthread_sigmask(SIG_SETMASK, &previous, NULL_PTR);
+  Os_Hal_PosixIcrWrite(Os_Hal_PosixCoreGetSelf()->Icr);
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_PosixCoreStart()
+ **********************************************************************************************************************/
+FUNC(void, OS_CODE) Os_Hal_PosixCoreStart(P2CONST(Os_Hal_CoreConfigType, AUTOMATIC, OS_CONST) Core)
+{
+  pthread_t thread;
+
+  if(pthread_create(&thread, NULL_PTR, Os_Hal_PosixCoreThread, (void*)Core) != 0)                                      /* PRQA S 0311 */ /* MD_Os_Hal_Rule11.8_0311 */
+  {
+    Os_Hal_CoreFreeze();
+  }
+
+  (void)pthread_detach(thread);
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_CoreInit()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ */
+FUNC(void, OS_CODE) Os_Hal_CoreInit(P2CONST(Os_Hal_CoreAsrConfigType, AUTOMATIC, OS_CONST) Config)
+{
+  P2VAR(Os_Hal_PosixCoreType, AUTOMATIC, OS_VAR_NOINIT) core = Os_Hal_PosixCoreGetSelf();
+  struct sigaction action;
+
+  /* #10 Install the notification handler. Nested notifications are allowed, as handlers may switch threads. */
+  action.sa_handler = Os_Hal_PosixSignalHandler;
+  action.sa_flags = SA_NODEFER | SA_RESTART;
+  (void)sigemptyset(&action.sa_mask);
+  (void)sigaction(OS_HAL_POSIX_SIGNAL, &action, NULL_PTR);
+
+  /* #20 Register the host thread of the core, so that other cores are able to notify it. */
+  core->Thread = pthread_self();
+  __atomic_store_n(&core->Started, 1uL, __ATOMIC_SEQ_CST);
+
+  OS_IGNORE_UNREF_PARAM(Config);                                                                                        /* PRQA S 3112 */ /* MD_MSR_DummyStmt */
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_CoreInitHardware()
+ **********************************************************************************************************************/
+FUNC(void, OS_CODE) Os_Hal_CoreInitHardware(P2CONST(Os_Hal_SystemConfigType, AUTOMATIC, OS_CONST) Config)
+{
+  OS_IGNORE_UNREF_PARAM(Config);                                                                                        /* PRQA S 3112 */ /* MD_MSR_DummyStmt */
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_CoreFreeze()
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DEFINITION(void, OS_CODE, OS_NORETURN, Os_Hal_CoreFreeze,
+(
+  void
+))
+{
+  /* #10 A frozen core stops the whole host process, so that the failure is visible to the test environment. */
+  abort();
+}
+
+
+# define OS_STOP_SEC_CODE
+# include "Os_MemMap_OsCode.h"                                                                                          /* PRQA S 5087 */ /* MD_MSR_MemMap */
+
+#endif /* if defined (OS_HAL_CORE_POSIX) */
+
+
+/*!
+ * \}
+ */
+
+/***********************************************************************************************************************
+ *  END OF FILE: Os_Hal_Core_Posix.c
+ **********************************************************************************************************************/
@@ -0,0 +1,483 @@
+/**********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2021 by Vector Informatik GmbH.                                              All rights reserved.
+ *
+ *                This software is copyright protected and proprietary to Vector Informatik GmbH.
+ *                Vector Informatik GmbH grants to you only those rights as set out in the license conditions.
+ *                All other rights remain with Vector Informatik GmbH.
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/**
+ * \ingroup     Os_Hal
+ * \addtogroup  Os_Hal_Core
+ *
+ * \{
+ *
+ * \file       Os_Hal_Core_Posix.h
+ * \brief      Primitives function implementation for the emulated cores of the POSIX host derivative
+ *
+ * This file replaces the generic TriCore implementation of Os_Hal_Core.h.
+ *********************************************************************************************************************/
+/***********************************************************************************************************************
+ *  REVISION HISTORY
+ *  --------------------------------------------------------------------------------------------------------------------
+ *  Refer to Os_Hal_Os.h.
+ **********************************************************************************************************************/
+                                                                                                                        /* PRQA S 0388  EOF */ /* MD_MSR_Dir1.1 */
+
+
+#ifndef OS_HAL_CORE_POSIX_H
+# define OS_HAL_CORE_POSIX_H
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+/* AUTOSAR includes */
+# include "Std_Types.h"
+
+/* Os module declarations */
+# include "Os_Hal_Core_PosixInt.h"
+
+/* Os kernel module dependencies */
+
+/* Os Hal dependencies */
+
+/**********************************************************************************************************************
+ *  GLOBAL CONSTANT MACROS
+ *********************************************************************************************************************/
+
+
+/**********************************************************************************************************************
+ *  GLOBAL FUNCTION MACROS
+ *********************************************************************************************************************/
+
+
+/**********************************************************************************************************************
+ *  GLOBAL DATA TYPES AND STRUCTURES
+ *********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ *  GLOBAL DATA PROTOTYPES
+ *********************************************************************************************************************/
+
+
+/**********************************************************************************************************************
+ *  GLOBAL FUNCTION PROTOTYPES
+ *********************************************************************************************************************/
+
+# define OS_START_SEC_CODE
+# include "Os_MemMap_OsCode.h"                                                                                          /* PRQA S 5087 */ /* MD_MSR_MemMap */
+
+
+/**********************************************************************************************************************
+ *  GLOBAL FUNCTIONS
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *  Os_Hal_CoreIsThreadPointerUserReadable()
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE Os_StdReturnType, OS_CODE, OS_ALWAYS_INLINE,                               /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+Os_Hal_CoreIsThreadPointerUserReadable,
+(
+  void
+))
+{
+  return !0u;                                                                                                           /* PRQA S 4404, 4558 */ /* MD_Os_C90BooleanCompatibility, MD_Os_Rule10.1_4558 */
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_CoreIsCoreIdUserReadable()
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE Os_StdReturnType, OS_CODE, OS_ALWAYS_INLINE,                               /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+Os_Hal_CoreIsCoreIdUserReadable,
+(
+  void
+))
+{
+  return !0u;                                                                                                           /* PRQA S 4404, 4558 */ /* MD_Os_C90BooleanCompatibility, MD_Os_Rule10.1_4558 */
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_CoreSetThread()
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DEFINITION(                                                                                           /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE, Os_Hal_CoreSetThread,
+(
+    P2CONST(Os_Hal_Core2ThreadConfigType, AUTOMATIC, OS_CONST) Core2Thread,
+    P2CONST(Os_ThreadConfigType, AUTOMATIC, OS_CONST) Thread
+))
+{
+  /* #10 The thread pointer is part of the emulation data of the calling core. */
+  Os_Hal_PosixCoreGetSelf()->CurrentThread = Thread;
+  OS_IGNORE_UNREF_PARAM(Core2Thread);                                                                                   /* PRQA S 3112 */ /* MD_MSR_DummyStmt */
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_CoreGetThread()
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE                                                                            /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+P2CONST(Os_ThreadConfigType, AUTOMATIC, OS_CONST), OS_CODE, OS_ALWAYS_INLINE,
+Os_Hal_CoreGetThread,
+(
+    P2CONST(Os_Hal_Core2ThreadConfigType, AUTOMATIC, OS_CONST) Core2Thread
+))
+{
+  OS_IGNORE_UNREF_PARAM(Core2Thread);                                                                                   /* PRQA S 3112 */ /* MD_MSR_DummyStmt */
+  return Os_Hal_PosixCoreGetSelf()->CurrentThread;
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_CoreIsPrivilegedModeUserReadable()
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE Os_StdReturnType, OS_CODE, OS_ALWAYS_INLINE,                               /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+Os_Hal_CoreIsPrivilegedModeUserReadable,
+(
+  void
+))
+{
+  return !0u;                                                                                                           /* PRQA S 4404, 4558 */ /* MD_Os_C90BooleanCompatibility, MD_Os_Rule10.1_4558 */
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_CoreGetPrivilegedMode()
+ **********************************************************************************************************************/
+/*!
+ * The host process has no user mode. All threads are executed privileged.
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE Os_StdReturnType, OS_CODE, OS_ALWAYS_INLINE,                               /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+Os_Hal_CoreGetPrivilegedMode,
+(
+  void
+))
+{
+  return !0u;                                                                                                           /* PRQA S 4404, 4558 */ /* MD_Os_C90BooleanCompatibility, MD_Os_Rule10.1_4558 */
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_CoreGetPrivilegedModeFromPcxi()
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE boolean, OS_CODE, OS_ALWAYS_INLINE,                                         /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+Os_Hal_CoreGetPrivilegedModeFromPcxi,
+(
+  uint32 Param
+))
+{
+  OS_IGNORE_UNREF_PARAM(Param);                                                                                         /* PRQA S 3112 */ /* MD_MSR_DummyStmt */
+  return TRUE;
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_CountLeadingZeros()
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE uint8, OS_CODE, OS_ALWAYS_INLINE,                                          /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+Os_Hal_CountLeadingZeros,
+(
+    Os_Hal_BitFieldType BitField
+))
+{
+  return (uint8)Os_Hal_Clz(BitField);
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_StackEndGet()
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DEFINITION(                                                                                           /* PRQA S 3219, 3673 */ /* MD_Os_Rule2.1_3219, MD_Os_Hal_Rule8.13_3673 */
+OS_LOCAL_INLINE P2VAR(Os_Hal_StackType, AUTOMATIC, OS_VAR_NOINIT), OS_CODE, OS_ALWAYS_INLINE,
+Os_Hal_StackEndGet,
+(
+  P2VAR(Os_Hal_StackType, AUTOMATIC, OS_VAR_NOINIT) LowAddress,
+  P2VAR(Os_Hal_StackType, AUTOMATIC, OS_VAR_NOINIT) HighAddress
+))
+{
+  OS_IGNORE_UNREF_PARAM(HighAddress);                                                                                   /* PRQA S 3112 */ /* MD_MSR_DummyStmt */
+  return LowAddress;
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_StackBottomGet()
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DEFINITION(                                                                                           /* PRQA S 3219, 3673 */ /* MD_Os_Rule2.1_3219, MD_Os_Hal_Rule8.13_3673 */
+OS_LOCAL_INLINE P2VAR(Os_Hal_StackType, AUTOMATIC, OS_VAR_NOINIT), OS_CODE, OS_ALWAYS_INLINE,
+Os_Hal_StackBottomGet,
+(
+  P2VAR(Os_Hal_StackType, AUTOMATIC, OS_VAR_NOINIT) LowAddress,
+  P2VAR(Os_Hal_StackType, AUTOMATIC, OS_VAR_NOINIT) HighAddress
+))
+{
+  OS_IGNORE_UNREF_PARAM(LowAddress);                                                                                    /* PRQA S 3112 */ /* MD_MSR_DummyStmt */
+  return HighAddress;
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_StackTopGet()
+ **********************************************************************************************************************/
+/*!
+ * The frame address of the calling function is used as approximation of the stack pointer.
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(                                                                                           /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+OS_LOCAL_INLINE P2VAR(Os_Hal_StackType, AUTOMATIC, OS_VAR_NOINIT), OS_CODE, OS_ALWAYS_INLINE,
+Os_Hal_StackTopGet,
+(
+  void
+))
+{
+  return (Os_Hal_StackType*)__builtin_frame_address(0);
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_StackPointerMoveDown()
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE                                                                            /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+P2VAR(Os_Hal_StackType, AUTOMATIC, OS_VAR_NOINIT), OS_CODE, OS_ALWAYS_INLINE, Os_Hal_StackPointerMoveDown,
+(
+  P2VAR(Os_Hal_StackType, AUTOMATIC, OS_VAR_NOINIT) StackPointer
+))
+{
+  return (Os_Hal_StackType*)(&(StackPointer[1]));
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_StackCalculateUsage()
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE uint32, OS_CODE, OS_ALWAYS_INLINE,                                         /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+Os_Hal_StackCalculateUsage,
+(
+  P2CONST(Os_Hal_StackType, AUTOMATIC, OS_VAR_NOINIT) StackBottom,
+  P2CONST(Os_Hal_StackType, AUTOMATIC, OS_VAR_NOINIT) StackTop
+))
+{
+  /* #10 Pointers are wider than 32 bit on 64 bit hosts, thus the difference is calculated on byte pointers. */
+  return (uint32)((P2CONST(uint8, AUTOMATIC, OS_VAR_NOINIT))StackBottom -
+                  (P2CONST(uint8, AUTOMATIC, OS_VAR_NOINIT))StackTop);
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_CoreStart()
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,                                           /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+Os_Hal_CoreStart,
+(
+  P2CONST(Os_Hal_CoreConfigType, AUTOMATIC, OS_CONST) Core
+))
+{
+  /* #10 Create the host thread of the core. */
+  Os_Hal_PosixCoreStart(Core);                                                                                          /* SBSW_OS_HAL_FC_CALLER */
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_CoreGetId()
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE Os_CorePhysicalIdType, OS_CODE,                                            /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+OS_ALWAYS_INLINE, Os_Hal_CoreGetId,
+(
+  void
+))
+{
+  return (Os_CorePhysicalIdType)Os_Hal_PosixCoreId;
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_SpinInit()
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DEFINITION(                                                                                           /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,
+Os_Hal_SpinInit,
+(
+  P2VAR(volatile Os_Hal_SpinlockType, AUTOMATIC, OS_VAR_NOINIT) Spinlock
+))
+{
+  __atomic_store_n(Spinlock, OS_HAL_UNLOCKED, __ATOMIC_SEQ_CST);                                                        /* SBSW_OS_HAL_PWA_CALLER */
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_SpinIsLocked()
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DEFINITION(                                                                                           /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+OS_LOCAL_INLINE Os_StdReturnType, OS_CODE, OS_ALWAYS_INLINE,
+Os_Hal_SpinIsLocked,
+(
+  P2CONST(volatile Os_Hal_SpinlockType, AUTOMATIC, OS_VAR_NOINIT) Spinlock
+))
+{
+  return (Os_StdReturnType)(__atomic_load_n(Spinlock, __ATOMIC_RELAXED) != OS_HAL_UNLOCKED);                            /* PRQA S 4304 */ /* MD_Os_C90BooleanCompatibility */
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_SpinTryLock()
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DEFINITION(                                                                                           /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+OS_LOCAL_INLINE Os_Hal_SpinlockResultType, OS_CODE, OS_ALWAYS_INLINE,
+Os_Hal_SpinTryLock,
+(
+  P2VAR(volatile Os_Hal_SpinlockType, AUTOMATIC, OS_VAR_NOINIT) Spinlock
+))
+{
+  return Os_Hal_CmpSwap(Spinlock, Os_Hal_PosixCoreId, OS_HAL_UNLOCKED);                                                 /* SBSW_OS_HAL_FC_CALLER */
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_SpinUnlock()
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DEFINITION(                                                                                           /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE, Os_Hal_SpinUnlock,
+(
+  P2VAR(volatile Os_Hal_SpinlockType, AUTOMATIC, OS_VAR_NOINIT) Spinlock
+))
+{
+  __atomic_store_n(Spinlock, OS_HAL_UNLOCKED, __ATOMIC_SEQ_CST);                                                        /* SBSW_OS_HAL_PWA_CALLER */
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_BitFieldCmpSwap()
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DEFINITION(                                                                                           /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+OS_LOCAL_INLINE Os_Hal_BitFieldType, OS_CODE, OS_ALWAYS_INLINE,
+Os_Hal_BitFieldCmpSwap,
+(
+  P2VAR(volatile Os_Hal_BitFieldType, AUTOMATIC, OS_VAR_NOINIT) BitField,
+  Os_Hal_BitFieldType Value,
+  Os_Hal_BitFieldType Condition
+))
+{
+  /* #10 The sequentially consistent swap also orders all surrounding accesses. */
+  return (Os_Hal_BitFieldType)Os_Hal_CmpSwap(BitField, Value, Condition);                                               /* SBSW_OS_HAL_FC_CALLER */
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_BitFieldSetAtomic()
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DEFINITION(                                                                                           /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,
+Os_Hal_BitFieldSetAtomic,
+(
+  P2VAR(volatile Os_Hal_BitFieldType, AUTOMATIC, OS_VAR_NOINIT) BitField,
+  Os_Hal_BitFieldType Mask
+))
+{
+  (void)__atomic_fetch_or(BitField, Mask, __ATOMIC_SEQ_CST);                                                            /* SBSW_OS_HAL_PWA_CALLER */
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_BitFieldClearAtomic()
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DEFINITION(                                                                                           /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,
+Os_Hal_BitFieldClearAtomic,
+(
+  P2VAR(volatile Os_Hal_BitFieldType, AUTOMATIC, OS_VAR_NOINIT) BitField,
+  Os_Hal_BitFieldType Mask
+))
+{
+  (void)__atomic_fetch_and(BitField, (Os_Hal_BitFieldType)(~Mask), __ATOMIC_SEQ_CST);                                   /* SBSW_OS_HAL_PWA_CALLER */
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_XSigInit()
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,                                           /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+Os_Hal_XSigInit,
+(
+  P2CONST(Os_Hal_XSigInterruptConfigType, AUTOMATIC, OS_CONST) XSigConfig
+))
+{
+  /* #10 Enable the cross core interrupt. */
+  Os_Hal_PosixSrcModify(XSigConfig->ConfigData->Source, 0uL, OS_HAL_INT_SRC_SRE_MASK);
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_XSigTrigger()
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,                                           /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+Os_Hal_XSigTrigger,
+(
+  P2CONST(Os_Hal_XSigInterruptConfigType, AUTOMATIC, OS_CONST) XSigConfig
+))
+{
+  /* #10 Set the service request flag, the receiver core is notified by the interrupt emulation. */
+  Os_Hal_PosixSrcModify(XSigConfig->ConfigData->Source, 0uL, OS_HAL_INT_SRC_SRR_MASK);
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_XSigAcknowledge()
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,                                           /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+Os_Hal_XSigAcknowledge,
+(
+  P2CONST(Os_Hal_XSigInterruptConfigType, AUTOMATIC, OS_CONST) XSigConfig
+))
+{
+  OS_IGNORE_UNREF_PARAM(XSigConfig);                                                                                    /* PRQA S 3112 */ /* MD_MSR_DummyStmt */
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_CoreIdle()
+ **********************************************************************************************************************/
+/*!
+ * The host thread is suspended instead of spinning, so that idle cores do not consume host CPU time.
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,                                           /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+Os_Hal_CoreIdle,
+(
+  void
+))
+{
+  Os_Hal_PosixCoreIdle();
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_CoreNop()
+ **********************************************************************************************************************/
+/*!
+ * Busy waiting cores also yield the host CPU, as the emulated cores may outnumber the host CPUs.
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,                                           /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+Os_Hal_CoreNop,
+(
+  void
+))
+{
+  Os_Hal_Nop();
+  (void)sched_yield();
+}
+
+# define OS_STOP_SEC_CODE
+# include "Os_MemMap_OsCode.h"                                                                                          /* PRQA S 5087 */ /* MD_MSR_MemMap */
+
+#endif /* OS_HAL_CORE_POSIX_H */
+
+/*!
+ * \}
+ */
+/**********************************************************************************************************************
+ *  END OF FILE: Os_Hal_Core_Posix.h
+ *********************************************************************************************************************/
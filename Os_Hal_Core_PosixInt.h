@@ -0,0 +1,382 @@
+/**********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2021 by Vector Informatik GmbH.                                              All rights reserved.
+ *
+ *                This software is copyright protected and proprietary to Vector Informatik GmbH.
+ *                Vector Informatik GmbH grants to you only those rights as set out in the license conditions.
+ *                All other rights remain with Vector Informatik GmbH.
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/**
+ * \ingroup     Os_Hal
+ * \addtogroup  Os_Hal_Core
+ * \brief   Primitives definition for the emulated cores of the POSIX host derivative
+ *
+ * \{
+ *
+ * \file       Os_Hal_Core_PosixInt.h
+ * \brief      This file contains the data of the core and interrupt emulation of the POSIX host derivative.
+ *
+ * Each physical core is emulated by one host thread. The host thread of the master core is the thread which calls
+ * main(), all other cores are started by Os_Hal_CoreStart().
+ *
+ * The interrupt emulation keeps the register layout of the TriCore hardware, so that generated configuration data
+ * (interrupt levels, PCXI encoded interrupt states, SRC offsets) can be used without modification:
+ *  - Each core has an emulated ICR (IE flag and CCPN).
+ *  - All cores share an array of emulated SRC registers (SRPN, SRE, TOS, SRR).
+ *    Other than on the hardware, TOS holds the physical core ID.
+ *  - A source which is pending and enabled sets the bit of its level in the pending level set of the core selected
+ *    by TOS. A core which is not the calling core is notified with a signal (OS_HAL_POSIX_SIGNAL).
+ *  - A core accepts the highest pending level, if it is above CCPN and IE is set. The handler is called with IE
+ *    cleared and CCPN set to the level. The previous ICR is restored afterwards (RFE).
+ *********************************************************************************************************************/
+/***********************************************************************************************************************
+ *  REVISION HISTORY
+ *  --------------------------------------------------------------------------------------------------------------------
+ *  Refer to Os_Hal_Os.h.
+ **********************************************************************************************************************/
+
+
+#ifndef OS_HAL_CORE_POSIXINT_H
+# define OS_HAL_CORE_POSIXINT_H
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+# include "Std_Types.h"
+
+# include <pthread.h>
+# include <sched.h>
+# include <signal.h>
+
+
+/**********************************************************************************************************************
+ *  GLOBAL CONSTANT MACROS
+ *********************************************************************************************************************/
+/*! Interrupt control register: bit mask for the global interrupt enable flag (IE). */
+# define OS_HAL_ICR_INT_MASK              0x00008000uL
+/*! Interrupt control register: bit mask for the current CPU priority number (CCPN). */
+# define OS_HAL_ICR_INT_LEVEL_MASK        0x000000FFuL
+/*! Global interrupt disabled. */
+# define OS_HAL_ICR_INT_GLOBAL_DISABLED   0x00000000uL
+/*! Global interrupt enabled. */
+# define OS_HAL_ICR_INT_GLOBAL_ENABLED    0x00008000uL
+
+/*! PCXI encoding of interrupt states as used by the generated configuration: previous CPU priority number. */
+# define OS_HAL_PCXI_PCPN_MASK            0x3FC00000uL
+/*! PCXI encoding: previous interrupt enable flag. */
+# define OS_HAL_PCXI_PIE_MASK             0x00200000uL
+/*! PCXI encoding: shift from ICR.IE to PCXI.PIE. */
+# define OS_HAL_PCXI_IE_TO_PIE            (6u)
+/*! PCXI encoding: shift from ICR.CCPN to PCXI.PCPN. */
+# define OS_HAL_PCXI_CCPN_TO_PCPN         (22u)
+
+/*! Core start registers are not available. The defines allow the use of the generated core configuration. */
+# define OS_HAL_CORE0_PC                  (0uL)
+# define OS_HAL_CORE0_DBGSR               (0uL)
+# define OS_HAL_CORE0_SYSCON_CORECON      (0uL)
+# define OS_HAL_CORE0_BOOTCON             (0uL)
+# define OS_HAL_CORE1_PC                  (0uL)
+# define OS_HAL_CORE1_DBGSR               (0uL)
+# define OS_HAL_CORE1_SYSCON_CORECON      (0uL)
+# define OS_HAL_CORE1_BOOTCON             (0uL)
+# define OS_HAL_CORE2_PC                  (0uL)
+# define OS_HAL_CORE2_DBGSR               (0uL)
+# define OS_HAL_CORE2_SYSCON_CORECON      (0uL)
+# define OS_HAL_CORE2_BOOTCON             (0uL)
+# define OS_HAL_CORE3_PC                  (0uL)
+# define OS_HAL_CORE3_DBGSR               (0uL)
+# define OS_HAL_CORE3_SYSCON_CORECON      (0uL)
+# define OS_HAL_CORE3_BOOTCON             (0uL)
+# define OS_HAL_CORE4_PC                  (0uL)
+# define OS_HAL_CORE4_DBGSR               (0uL)
+# define OS_HAL_CORE4_SYSCON_CORECON      (0uL)
+# define OS_HAL_CORE4_BOOTCON             (0uL)
+# define OS_HAL_CORE5_PC                  (0uL)
+# define OS_HAL_CORE5_DBGSR               (0uL)
+# define OS_HAL_CORE5_SYSCON_CORECON      (0uL)
+# define OS_HAL_CORE5_BOOTCON             (0uL)
+# define OS_HAL_CORE6_PC                  (0uL)
+# define OS_HAL_CORE6_DBGSR               (0uL)
+# define OS_HAL_CORE6_SYSCON_CORECON      (0uL)
+# define OS_HAL_CORE6_BOOTCON             (0uL)
+
+/*! Number of protection sets. Used by the generated memory protection configuration. */
+# define OS_HAL_COREMPU_NUM_OF_PS         4
+
+/*! Number of interrupt levels. */
+# define OS_HAL_POSIX_LEVEL_COUNT         (256uL)
+/*! Number of words of the pending level set. */
+# define OS_HAL_POSIX_LEVEL_WORDS         (OS_HAL_POSIX_LEVEL_COUNT / 32uL)
+/*! Marks a level without interrupt source. */
+# define OS_HAL_POSIX_NO_SOURCE           (0xFFFFFFFFuL)
+/*! Core ID of host threads, which do not emulate a core (e.g. the timer thread). */
+# define OS_HAL_POSIX_NO_CORE             (0xFFFFFFFFuL)
+
+/*! Signal which notifies a core about a pending interrupt. May be overwritten by the build environment. */
+# if !defined (OS_HAL_POSIX_SIGNAL)
+#  define OS_HAL_POSIX_SIGNAL             SIGUSR1
+# endif
+
+
+/**********************************************************************************************************************
+ *  GLOBAL FUNCTION MACROS
+ *********************************************************************************************************************/
+
+/* The host has no core MPU. The memory protection primitives evaluate their arguments and have no effect. */
+
+/*! Set a data MPU region. */
+# define Os_Hal_SetDataRegion(Slot, LowerValue, UpperValue)                                                 \
+         ((void)(Slot), (void)(LowerValue), (void)(UpperValue))
+
+/*! Set a code MPU region. */
+# define Os_Hal_SetCodeRegion(Slot, LowerValue, UpperValue)                                                 \
+         ((void)(Slot), (void)(LowerValue), (void)(UpperValue))
+
+/*! Initial read access rights for all protection sets. */
+# define Os_Hal_InitializeAccessDPRE(Value)                          ((void)(Value))
+
+/*! Initial write access rights for all protection sets. */
+# define Os_Hal_InitializeAccessDPWE(Value)                          ((void)(Value))
+
+/*! Initial execution rights for all protection sets. */
+# define Os_Hal_InitializeAccessCPXE(Value)                          ((void)(Value))
+
+/*! Modify the read access rights for a particular protection set. */
+# define Os_Hal_ReadModifyAccessDPRE(ProtectionSet, Mask, Value)     ((void)(ProtectionSet), (void)(Mask), (void)(Value))
+
+/*! Modify the write access rights for a particular protection set. */
+# define Os_Hal_ReadModifyAccessDPWE(ProtectionSet, Mask, Value)     ((void)(ProtectionSet), (void)(Mask), (void)(Value))
+
+/*! Modify the execution rights for a particular protection set. */
+# define Os_Hal_ReadModifyAccessCPXE(ProtectionSet, Mask, Value)     ((void)(ProtectionSet), (void)(Mask), (void)(Value))
+
+
+/**********************************************************************************************************************
+ *  GLOBAL DATA TYPES AND STRUCTURES
+ *********************************************************************************************************************/
+
+/*! Emulation data of one physical core. */
+typedef struct
+{
+  /*! Emulated interrupt control register (IE and CCPN). Only written by the owning core. */
+  volatile uint32 Icr;
+
+  /*! Interrupt state (ICR format), which is applied by the context that is resumed next. */
+  uint32 ResumeIcr;
+
+  /*! !0 while the core evaluates pending interrupts. Notifications are ignored during this time. */
+  volatile sig_atomic_t Dispatching;
+
+  /*! !0 if the host thread of the core is running. */
+  volatile uint32 Started;
+
+  /*! Host thread, which emulates the core. */
+  pthread_t Thread;
+
+  /*! Thread pointer (see Os_Hal_CoreSetThread()). */
+  P2CONST(Os_ThreadConfigType, AUTOMATIC, OS_CONST) CurrentThread;
+
+  /*! Pending and enabled interrupt levels. Set by any core, cleared by the owning core. */
+  volatile uint32 PendingLevels[OS_HAL_POSIX_LEVEL_WORDS];
+
+  /*! SRC index of each level, OS_HAL_POSIX_NO_SOURCE if no source is assigned to the level. */
+  uint32 LevelSource[OS_HAL_POSIX_LEVEL_COUNT];
+
+  /*! Handler of each level. */
+  Os_Hal_PosixIntVectorType Vector[OS_HAL_POSIX_LEVEL_COUNT];
+} Os_Hal_PosixCoreType;
+
+
+/**********************************************************************************************************************
+ *  GLOBAL DATA PROTOTYPES
+ *********************************************************************************************************************/
+
+/* The emulation data is host memory and is not mapped to OS data sections. */
+
+/*! Emulation data of all physical cores. */
+extern VAR(Os_Hal_PosixCoreType, OS_VAR_NOINIT) Os_Hal_PosixCore[OS_CFG_COREPHYSICALID_COUNT];
+
+/*! Emulated service request control registers. */
+extern volatile VAR(uint32, OS_VAR_NOINIT) Os_Hal_PosixSrc[OS_HAL_INT_SRC_COUNT];
+
+/*! Physical core ID of the calling host thread. The thread which calls main() is core 0. */
+extern OS_HAL_POSIX_THREAD_LOCAL VAR(uint32, OS_VAR_NOINIT) Os_Hal_PosixCoreId;
+
+
+/**********************************************************************************************************************
+ *  GLOBAL FUNCTION PROTOTYPES
+ *********************************************************************************************************************/
+
+# define OS_START_SEC_CODE
+# include "Os_MemMap_OsCode.h"                                                                                          /* PRQA S 5087 */ /* MD_MSR_MemMap */
+
+/***********************************************************************************************************************
+ *  Os_Hal_PosixIntDispatch()
+ **********************************************************************************************************************/
+/*! \brief        Handles all pending interrupts of the calling core, which are accepted by its ICR.
+ *  \context      ANY
+ *  \reentrant    TRUE
+ *  \synchronous  TRUE
+ *  \pre          Called by a host thread, which emulates a core.
+ **********************************************************************************************************************/
+FUNC(void, OS_CODE) Os_Hal_PosixIntDispatch(void);
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_PosixSrcModify()
+ **********************************************************************************************************************/
+/*! \brief        Atomically modifies an emulated SRC register and notifies the target core, if the source became
+ *                pending and enabled.
+ *  \param[in]    Source      SRC offset of the interrupt source.
+ *  \param[in]    ClearMask   Bits to clear.
+ *  \param[in]    SetMask     Bits to set.
+ *  \context      ANY
+ *  \reentrant    TRUE
+ *  \synchronous  TRUE
+ *  \pre          -
+ **********************************************************************************************************************/
+FUNC(void, OS_CODE) Os_Hal_PosixSrcModify(uint32 Source, uint32 ClearMask, uint32 SetMask);
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_PosixCoreIdle()
+ **********************************************************************************************************************/
+/*! \brief        Suspends the host thread of the calling core until an interrupt is pending.
+ *  \context      OS_INTERNAL
+ *  \reentrant    FALSE
+ *  \synchronous  TRUE
+ *  \pre          -
+ **********************************************************************************************************************/
+FUNC(void, OS_CODE) Os_Hal_PosixCoreIdle(void);
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_PosixCoreStart()
+ **********************************************************************************************************************/
+/*! \brief        Creates the host thread of the given core, which executes the start label.
+ *  \param[in]    Core    The core configuration.
+ *  \context      OS_INTERNAL
+ *  \reentrant    FALSE
+ *  \synchronous  TRUE
+ *  \pre          -
+ **********************************************************************************************************************/
+FUNC(void, OS_CODE) Os_Hal_PosixCoreStart(P2CONST(Os_Hal_CoreConfigType, AUTOMATIC, OS_CONST) Core);
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_CoreGetId()
+ **********************************************************************************************************************/
+/*! \brief          Returns the physical identifier of the local core
+ *  \details
+ *
+ *  \return         Physical identifier of the local core.
+ *
+ *  \context        OS_INTERNAL
+ *
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *
+ *  \pre            -
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE Os_CorePhysicalIdType, OS_CODE,
+OS_ALWAYS_INLINE, Os_Hal_CoreGetId,
+(
+  void
+));
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_PosixCoreGetSelf()
+ **********************************************************************************************************************/
+/*! \brief        Returns the emulation data of the calling core.
+ *  \return       Emulation data of the calling core.
+ *  \context      ANY
+ *  \reentrant    TRUE
+ *  \synchronous  TRUE
+ *  \pre          Called by a host thread, which emulates a core.
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE P2VAR(Os_Hal_PosixCoreType, AUTOMATIC, OS_VAR_NOINIT), OS_CODE,
+OS_ALWAYS_INLINE, Os_Hal_PosixCoreGetSelf, (void));
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE P2VAR(Os_Hal_PosixCoreType, AUTOMATIC, OS_VAR_NOINIT), OS_CODE,
+OS_ALWAYS_INLINE, Os_Hal_PosixCoreGetSelf, (void))
+{
+  return &Os_Hal_PosixCore[Os_Hal_PosixCoreId];
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_PosixIntIsPending()
+ **********************************************************************************************************************/
+/*! \brief        Returns whether any interrupt level is pending on the given core.
+ *  \details      Only a fast pre-check. Os_Hal_PosixIntDispatch() decides whether the level is accepted.
+ *  \param[in]    Core    The emulation data of the core.
+ *  \retval       !0      At least one level is pending.
+ *  \retval       0       No level is pending.
+ *  \context      ANY
+ *  \reentrant    TRUE
+ *  \synchronous  TRUE
+ *  \pre          -
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE uint32, OS_CODE, OS_ALWAYS_INLINE, Os_Hal_PosixIntIsPending,
+(
+  P2CONST(Os_Hal_PosixCoreType, AUTOMATIC, OS_VAR_NOINIT) Core
+));
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE uint32, OS_CODE, OS_ALWAYS_INLINE, Os_Hal_PosixIntIsPending,
+(
+  P2CONST(Os_Hal_PosixCoreType, AUTOMATIC, OS_VAR_NOINIT) Core
+))
+{
+  uint32 pending = 0uL;
+  uint32 index;
+
+  for(index = 0uL; index < OS_HAL_POSIX_LEVEL_WORDS; index++)
+  {
+    pending |= Core->PendingLevels[index];
+  }
+
+  return pending;
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_PosixIcrWrite()
+ **********************************************************************************************************************/
+/*! \brief        Writes the emulated ICR of the calling core and handles interrupts, which got accepted.
+ *  \param[in]    Icr     New ICR value (IE and CCPN).
+ *  \context      ANY
+ *  \reentrant    FALSE
+ *  \synchronous  TRUE
+ *  \pre          Called by a host thread, which emulates a core.
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE, Os_Hal_PosixIcrWrite, (uint32 Icr));
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE, Os_Hal_PosixIcrWrite, (uint32 Icr))
+{
+  P2VAR(Os_Hal_PosixCoreType, AUTOMATIC, OS_VAR_NOINIT) core = Os_Hal_PosixCoreGetSelf();
+
+  /* #10 Write the register. */
+  core->Icr = Icr;
+  __atomic_signal_fence(__ATOMIC_SEQ_CST);
+
+  /* #20 If interrupts are enabled and any level is pending, let the dispatcher decide. */
+  if(((Icr & OS_HAL_ICR_INT_MASK) != 0uL) && (Os_Hal_PosixIntIsPending(core) != 0uL))
+  {
+    Os_Hal_PosixIntDispatch();
+  }
+}
+
+# define OS_STOP_SEC_CODE
+# include "Os_MemMap_OsCode.h"                                                                                          /* PRQA S 5087 */ /* MD_MSR_MemMap */
+
+#endif /* OS_HAL_CORE_POSIXINT_H */
+
+/*!
+ * \}
+ */
+/**********************************************************************************************************************
+ *  END OF FILE: Os_Hal_Core_PosixInt.h
+ *********************************************************************************************************************/
@@ -87,6 +87,8 @@
 #  include "Os_Hal_Derivative_TC3ExQInt.h"
 # elif defined(OS_CFG_DERIVATIVEGROUP_TC49X)                                                                           /* COV_OS_DERIVATIVEGROUP */
 #  include "Os_Hal_Derivative_TC49xInt.h"
+# elif defined(OS_CFG_DERIVATIVEGROUP_POSIX)                                                                           /* COV_OS_DERIVATIVEGROUP */
+#  include "Os_Hal_Derivative_PosixInt.h"
 # else
 #  error "The selected derivative is not supported!"
 # endif /* OS_CFG_DERIVATIVEGROUP_<> */
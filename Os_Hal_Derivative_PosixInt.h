@@ -0,0 +1,93 @@
+/**********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2021 by Vector Informatik GmbH.                                              All rights reserved.
+ *
+ *                This software is copyright protected and proprietary to Vector Informatik GmbH.
+ *                Vector Informatik GmbH grants to you only those rights as set out in the license conditions.
+ *                All other rights remain with Vector Informatik GmbH.
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/**
+ * \addtogroup  Os_Hal_Derivative
+ * \{
+ *
+ * \file
+ * \brief  This file contains derivative specific information of the POSIX host derivative.
+ *
+ * The POSIX host derivative runs the unmodified kernel as a user space process on a POSIX host (Linux, macOS).
+ * Each physical core is emulated by one host thread. Interrupt sources, the interrupt control register and the
+ * system timer are emulated in software (see Os_Hal_Core_Posix.c).
+ * The derivative is selected with OS_CFG_DERIVATIVEGROUP_POSIX and is used for functional testing and
+ * benchmarking of the kernel without target hardware.
+ *********************************************************************************************************************/
+/**********************************************************************************************************************
+ *  REVISION HISTORY
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  Refer to Os_Hal_Os.h.
+ *********************************************************************************************************************/
+
+#ifndef OS_HAL_DERIVATIVE_POSIXINT_H
+# define OS_HAL_DERIVATIVE_POSIXINT_H
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ *  GLOBAL CONSTANT MACROS
+ *********************************************************************************************************************/
+
+/** POSIX host **/
+
+/* STM module (emulated) */
+# define OS_HAL_TIMER_STM                            STD_OFF
+# define OS_HAL_TIMER_CoreSTM                        STD_OFF
+# define OS_HAL_TIMER_POSIX                          STD_ON
+
+/*! Frequency of the emulated system timer in Hz. May be overwritten by the build environment. */
+# if !defined (OS_HAL_TIMER_POSIX_FREQUENCY)
+#  define OS_HAL_TIMER_POSIX_FREQUENCY               (100000000uL)
+# endif
+
+# define OS_HAL_TIMER_STM_COUNT                      (6uL)
+# define OS_HAL_INT_SRC_STM0_CH0_OFFSET              (0x300uL)
+# define OS_HAL_INT_SRC_STM0_CH1_OFFSET              (0x304uL)
+# define OS_HAL_INT_SRC_STM1_CH0_OFFSET              (0x308uL)
+# define OS_HAL_INT_SRC_STM1_CH1_OFFSET              (0x30CuL)
+# define OS_HAL_INT_SRC_STM2_CH0_OFFSET              (0x310uL)
+# define OS_HAL_INT_SRC_STM2_CH1_OFFSET              (0x314uL)
+# define OS_HAL_INT_SRC_STM3_CH0_OFFSET              (0x318uL)
+# define OS_HAL_INT_SRC_STM3_CH1_OFFSET              (0x31CuL)
+# define OS_HAL_INT_SRC_STM4_CH0_OFFSET              (0x320uL)
+# define OS_HAL_INT_SRC_STM4_CH1_OFFSET              (0x324uL)
+# define OS_HAL_INT_SRC_STM5_CH0_OFFSET              (0x328uL)
+# define OS_HAL_INT_SRC_STM5_CH1_OFFSET              (0x32CuL)
+
+
+/* GPT module (not available) */
+# define OS_HAL_TIMER_GPT                            STD_OFF
+
+
+/* Core module (emulated by host threads) */
+# define OS_HAL_CORE_POSIX                           STD_ON
+
+/* Interrupt router module (emulated) */
+# define OS_HAL_INTERRUPT_POSIX                      STD_ON
+
+/*! Number of emulated service request control registers (SRC), same layout as on AURIX TC3xx. */
+# define OS_HAL_INT_SRC_COUNT                        (1024uL)
+
+
+
+#endif /* OS_HAL_DERIVATIVE_POSIXINT_H */
+
+/*!
+ * \}
+ */
+/**********************************************************************************************************************
+ *  END OF FILE: Os_Hal_Derivative_PosixInt.h
+ *********************************************************************************************************************/
@@ -88,6 +88,8 @@
 #  include "Os_Hal_Derivative_TC3ExQ_Types.h"
 # elif defined(OS_CFG_DERIVATIVEGROUP_TC49X)                                                                           /* COV_OS_DERIVATIVEGROUP */
 #  include "Os_Hal_Derivative_TC49x_Types.h"
+# elif defined(OS_CFG_DERIVATIVEGROUP_POSIX)                                                                           /* COV_OS_DERIVATIVEGROUP */
+#  include "Os_Hal_Derivative_Posix_Types.h"
 # else
 #  error "The selected derivative is not supported!"
 # endif /* OS_CFG_DERIVATIVEGROUP_<> */
@@ -68,6 +68,8 @@
 # define OS_START_SEC_CODE
 # include "Os_MemMap_OsCode.h"                                                                                          /* PRQA S 5087 */ /* MD_MSR_MemMap */
 
+/* The POSIX host core module has no context save areas, thus the exception context is not available. */
+# if !defined (OS_HAL_CORE_POSIX)
 /***********************************************************************************************************************
  *  Os_Hal_Exception_Save_Context()
  **********************************************************************************************************************/
@@ -110,6 +112,7 @@ Os_Hal_Exception_Resume_Context,
 (
   uint32 Pcxi
 ));
+# endif /* if !defined (OS_HAL_CORE_POSIX) */
 
 # define OS_STOP_SEC_CODE
 # include "Os_MemMap_OsCode.h"                                                                                          /* PRQA S 5087 */ /* MD_MSR_MemMap */
@@ -122,6 +125,7 @@ Os_Hal_Exception_Resume_Context,
 # define OS_START_SEC_CODE
 # include "Os_MemMap_OsCode.h"                                                                                          /* PRQA S 5087 */ /* MD_MSR_MemMap */
 
+# if !defined (OS_HAL_CORE_POSIX)
 /***********************************************************************************************************************
  *  Os_Hal_Exception_Save_Context()
  **********************************************************************************************************************/
@@ -432,6 +436,67 @@ Os_Hal_MemFault,
   }
 }
 
+# else /* if !defined (OS_HAL_CORE_POSIX) */
+
+/***********************************************************************************************************************
+ *  Os_Hal_UnhandledExc()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(void, OS_CODE, OS_HAL_NOINLINE,
+Os_Hal_UnhandledExc,
+(
+  Os_ExceptionSourceIdType ExceptionSource,
+  uint32 Pcxi,
+  Os_AddressOfConstType ExceptionAddress,
+   uint32 SavedMpuRegionForStackLow,
+   uint32 SavedMpuRegionForStackUpper
+))
+{
+  OS_IGNORE_UNREF_PARAM(SavedMpuRegionForStackLow);                                                                     /* PRQA S 3112 */ /* MD_MSR_DummyStmt */
+  OS_IGNORE_UNREF_PARAM(SavedMpuRegionForStackUpper);                                                                   /* PRQA S 3112 */ /* MD_MSR_DummyStmt */
+
+  /* #10 Call the handler in core. */
+  Os_UnhandledExc(ExceptionSource, ExceptionAddress, Os_Hal_CoreGetPrivilegedModeFromPcxi(Pcxi));                      /* SBSW_OS_HAL_FC_CALLER */
+
+  /* #20 Disable interrupt globally to lock category 0 ISRs. */
+  Os_Hal_Disable();
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_MemFault()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(void, OS_CODE, OS_HAL_NOINLINE,
+Os_Hal_MemFault,
+(
+  Os_ExceptionSourceIdType ExceptionSource,
+  uint32 Pcxi,
+  Os_AddressOfConstType ExceptionAddress,
+  uint32 SavedMpuRegionForStackLow,
+  uint32 SavedMpuRegionForStackUpper
+))
+{
+  OS_IGNORE_UNREF_PARAM(ExceptionSource);                                                                               /* PRQA S 3112 */ /* MD_MSR_DummyStmt */
+  OS_IGNORE_UNREF_PARAM(SavedMpuRegionForStackLow);                                                                     /* PRQA S 3112 */ /* MD_MSR_DummyStmt */
+  OS_IGNORE_UNREF_PARAM(SavedMpuRegionForStackUpper);                                                                   /* PRQA S 3112 */ /* MD_MSR_DummyStmt */
+
+  /* #10 Call the handler in core. */
+  Os_MemFault(ExceptionAddress, Os_Hal_CoreGetPrivilegedModeFromPcxi(Pcxi));                                            /* SBSW_OS_HAL_FC_CALLER */
+
+  /* #20 Disable interrupt globally to lock category 0 ISRs. */
+  Os_Hal_Disable();
+}
+# endif /* if !defined (OS_HAL_CORE_POSIX) */
+
 /***********************************************************************************************************************
  *  Os_Hal_SysCall()
  **********************************************************************************************************************/
@@ -73,6 +73,10 @@
  *  GLOBAL FUNCTION PROTOTYPES
  **********************************************************************************************************************/
 
+/* The interrupt primitives of the POSIX host platform work on emulated registers (see Os_Hal_Interrupt_Posix.h). */
+# if defined (OS_HAL_INTERRUPT_POSIX)
+#  include "Os_Hal_Interrupt_Posix.h"
+# else
 # define OS_START_SEC_CODE
 # include "Os_MemMap_OsCode.h"                                                                                          /* PRQA S 5087 */ /* MD_MSR_MemMap */
 
@@ -809,6 +813,7 @@ Os_Hal_IntPostActionMapped,
 
 # define OS_STOP_SEC_CODE
 # include "Os_MemMap_OsCode.h"                                                                                          /* PRQA S 5087 */ /* MD_MSR_MemMap */
+# endif /* if defined (OS_HAL_INTERRUPT_POSIX) */
 
 #endif /* OS_HAL_INTERRUPT_H */
 
@@ -0,0 +1,91 @@
+/**********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2021 by Vector Informatik GmbH.                                              All rights reserved.
+ *
+ *                This software is copyright protected and proprietary to Vector Informatik GmbH.
+ *                Vector Informatik GmbH grants to you only those rights as set out in the license conditions.
+ *                All other rights remain with Vector Informatik GmbH.
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/**
+ * \ingroup    Os_Hal
+ * \addtogroup Os_Hal_Interrupt
+ * \brief      Primitives definition of the emulated interrupt router on the POSIX host platform
+ *
+ * \{
+ *
+ * \file       Os_Hal_InterruptController_PosixInt.h
+ * \brief      This file contains the definition of the emulated SRC registers of the POSIX host platform
+ *
+ * The emulated SRC registers use the bit layout of the AURIX TC3xx interrupt router. The registers are not memory
+ * mapped, the SRC offset of an interrupt source is the byte offset into Os_Hal_PosixSrc.
+ *********************************************************************************************************************/
+/***********************************************************************************************************************
+ *  REVISION HISTORY
+ *  --------------------------------------------------------------------------------------------------------------------
+ *  Refer to Os_Hal_Os.h.
+ **********************************************************************************************************************/
+
+
+#ifndef OS_HAL_INTERRUPTCONTROLLER_POSIXINT_H
+# define OS_HAL_INTERRUPTCONTROLLER_POSIXINT_H
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+
+
+/**********************************************************************************************************************
+ *  GLOBAL CONSTANT MACROS
+ *********************************************************************************************************************/
+
+/*! bit mask for interrupt priority */
+# define OS_HAL_INT_SRC_SRPN_MASK           0x000000FFuL
+/*! bit mask for interrupt pending information */
+# define OS_HAL_INT_SRC_SRR_MASK            0x01000000uL
+/*! bit mask to clear interrupt pending flag */
+# define OS_HAL_INT_SRC_CLRR_MASK           0x02000000uL
+/*! bit mask for triggering interrupt sources */
+# define OS_HAL_INT_SRC_SETR_MASK           0x04000000uL
+/*! bit mask for enabling and disabling interrupt sources */
+# define OS_HAL_INT_SRC_SRE_MASK            0x00000400uL
+/*! bit mask for interrupts to cores assignment */
+# define OS_HAL_INT_SRC_TOS_MASK            0x00003800uL
+/*! amount of bits to be shifted for correct TOS placement */
+# define OS_HAL_INT_SRC_TOS_SHIFTVALUE      11uL
+/*! Size of one SRC register in bytes, used to convert SRC offsets to indices of Os_Hal_PosixSrc */
+# define OS_HAL_INT_SRC_SIZE                4uL
+
+
+
+/**********************************************************************************************************************
+ *  GLOBAL FUNCTION MACROS
+ *********************************************************************************************************************/
+
+
+/**********************************************************************************************************************
+ *  GLOBAL DATA TYPES AND STRUCTURES
+ *********************************************************************************************************************/
+
+
+/**********************************************************************************************************************
+ *  GLOBAL DATA PROTOTYPES
+ *********************************************************************************************************************/
+
+
+/**********************************************************************************************************************
+ *  GLOBAL FUNCTION PROTOTYPES
+ *********************************************************************************************************************/
+
+#endif /* OS_HAL_INTERRUPTCONTROLLER_POSIXINT_H */
+
+/*!
+ * \}
+ */
+/**********************************************************************************************************************
+ *  END OF FILE: Os_Hal_InterruptController_PosixInt.h
+ *********************************************************************************************************************/
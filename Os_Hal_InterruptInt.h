@@ -90,6 +90,8 @@
 #  include "Os_Hal_InterruptController_AurixTC3xx_IRInt.h"
 # elif defined(OS_HAL_INTERRUPT_AURIXTC4XX_IR)                                                                          /* COV_OS_HAL_INTERRUPTCONTROLLER_BETA */
 #  include "Os_Hal_InterruptController_AurixTC4xx_IRInt.h"
+# elif defined(OS_HAL_INTERRUPT_POSIX)
+#  include "Os_Hal_InterruptController_PosixInt.h"
 # else
 #  error "The selected core module is not supported!"
 # endif
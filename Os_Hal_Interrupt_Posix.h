@@ -0,0 +1,807 @@
+/***********************************************************************************************************************
+ *  COPYRIGHT
+ *  --------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2021 by Vector Informatik GmbH.                                              All rights reserved.
+ *
+ *                This software is copyright protected and proprietary to Vector Informatik GmbH.
+ *                Vector Informatik GmbH grants to you only those rights as set out in the license conditions.
+ *                All other rights remain with Vector Informatik GmbH.
+ *  \endverbatim
+ *  --------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  ------------------------------------------------------------------------------------------------------------------*/
+/**
+ *  \addtogroup Os_Hal_Interrupt
+ *  \{
+ *
+ *  \file     Os_Hal_Interrupt_Posix.h
+ *  \brief    Interrupt primitives of the POSIX host platform.
+ *
+ *  The primitives work on the emulated ICR of the calling core and on the emulated SRC registers
+ *  (see Os_Hal_Core_PosixInt.h). This file replaces the function definitions of Os_Hal_Interrupt.h.
+ **********************************************************************************************************************/
+/***********************************************************************************************************************
+ *  REVISION HISTORY
+ *  --------------------------------------------------------------------------------------------------------------------
+ *  Refer to Os_Hal_Os.h.
+ **********************************************************************************************************************/
+                                                                                                                        /* PRQA S 0388  EOF */ /* MD_MSR_Dir1.1 */
+#ifndef OS_HAL_INTERRUPT_POSIX_H
+# define OS_HAL_INTERRUPT_POSIX_H
+
+/***********************************************************************************************************************
+ *  INCLUDES
+ **********************************************************************************************************************/
+/* AUTOSAR includes */
+# include "Std_Types.h"
+
+/* Os module declarations */
+# include "Os_Hal_InterruptInt.h"
+
+/* Os Hal dependencies */
+# include "Os_Hal_Core_PosixInt.h"
+
+
+/***********************************************************************************************************************
+ *  GLOBAL CONSTANT MACROS
+ **********************************************************************************************************************/
+
+
+/***********************************************************************************************************************
+ *  GLOBAL FUNCTION MACROS
+ **********************************************************************************************************************/
+
+
+/***********************************************************************************************************************
+ *  GLOBAL DATA TYPES AND STRUCTURES
+ **********************************************************************************************************************/
+
+
+/***********************************************************************************************************************
+ *  GLOBAL DATA PROTOTYPES
+ **********************************************************************************************************************/
+
+
+/***********************************************************************************************************************
+ *  GLOBAL FUNCTION PROTOTYPES
+ **********************************************************************************************************************/
+
+# define OS_START_SEC_CODE
+# include "Os_MemMap_OsCode.h"                                                                                          /* PRQA S 5087 */ /* MD_MSR_MemMap */
+
+
+/***********************************************************************************************************************
+ *  GLOBAL FUNCTIONS
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *  Os_Hal_IntEnableGlobal()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,                                           /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+Os_Hal_IntEnableGlobal, (void))
+{
+  /* #10 Enable the global interrupt status. */
+  Os_Hal_Enable();
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_IntDisableGlobal()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,                                           /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+Os_Hal_IntDisableGlobal, (void))
+{
+  /* #10 Disable the global interrupt status. */
+  Os_Hal_Disable();
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_IntDisableAndReturnGlobalState()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE Os_Hal_IntGlobalStateType, OS_CODE, OS_ALWAYS_INLINE,                      /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+Os_Hal_IntDisableAndReturnGlobalState, (void))
+{
+  Os_Hal_IntGlobalStateType retState;
+
+  /* #10 Get the current global interrupt status. */
+  retState = (Os_Hal_IntGlobalStateType)(Os_Hal_PosixCoreGetSelf()->Icr & OS_HAL_ICR_INT_MASK);
+
+  /* #20 Disable the global interrupt status. */
+  Os_Hal_Disable();
+
+  return retState;
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_IntSetGlobalState()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,                                           /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+Os_Hal_IntSetGlobalState,
+(
+  P2CONST(Os_Hal_IntGlobalStateType, AUTOMATIC, OS_APPL_DATA) State
+))
+{
+  Os_Hal_IntGlobalStateType icr;
+
+  /* #10 Set the global interrupt status. */
+  Os_Hal_Disable();
+  icr =  Os_Hal_PosixCoreGetSelf()->Icr & (Os_Hal_IntGlobalStateType)~(OS_HAL_ICR_INT_GLOBAL_ENABLED);
+
+  Os_Hal_PosixIcrWrite(icr | *State);
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_IntGetLevel()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE,                                                             /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+OS_ALWAYS_INLINE, Os_Hal_IntGetLevel,
+(
+  P2VAR(Os_Hal_IntLevelType, AUTOMATIC, OS_APPL_DATA) Level
+))
+{
+  /* #10 Get the current interrupt level. */
+  *Level = (Os_Hal_IntLevelType)(Os_Hal_PosixCoreGetSelf()->Icr & OS_HAL_ICR_INT_LEVEL_MASK);                           /* SBSW_OS_HAL_PWA_CALLER */
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_IntSetLevel()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,                                           /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+Os_Hal_IntSetLevel,
+(
+  P2CONST(Os_Hal_IntLevelType, AUTOMATIC, OS_APPL_DATA) Level
+))
+{
+  Os_Hal_IntGlobalStateType previousState;
+
+  /* #10 Store the current interrupt global state and disable all interrupts. */
+  Os_Hal_IntGetGlobalState(&previousState);                                                                             /* SBSW_OS_HAL_FC_LOCAL_VAR */
+  Os_Hal_Disable();
+
+  /* #20 Set the interrupt level. */
+  Os_Hal_PosixCoreGetSelf()->Icr = (Os_Hal_PosixCoreGetSelf()->Icr & ~OS_HAL_ICR_INT_LEVEL_MASK) | (*Level);
+
+  /* #30 Restore the previous interrupt global state. */
+  Os_Hal_IntSetGlobalState(&previousState);                                                                             /* SBSW_OS_HAL_FC_LOCAL_VAR */
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_IntGetGlobalEnable()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,                                           /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+Os_Hal_IntGetGlobalEnable,
+(
+  P2VAR(Os_Hal_IntGlobalStateType, AUTOMATIC, OS_APPL_DATA) State
+))
+{
+  /* #10 Get global interrupt enable mask. */
+  *State = (Os_Hal_IntGlobalStateType)(OS_HAL_ICR_INT_GLOBAL_ENABLED);                                                  /* SBSW_OS_HAL_PWA_CALLER */
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_IntGetCat2LockLevel()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,                                           /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+Os_Hal_IntGetCat2LockLevel,
+(
+  P2VAR(Os_Hal_IntLevelType, AUTOMATIC, OS_APPL_DATA) Level
+))
+{
+  /* #10 Get the interrupt level for CAT2. */
+  *Level = (Os_Hal_IntLevelType)OS_CFG_HAL_ISR2_DISABLE_LEVEL;                                                          /* SBSW_OS_HAL_PWA_CALLER */
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_IntGetCat1LockLevel()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,                                           /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+Os_Hal_IntGetCat1LockLevel,
+(
+  P2VAR(Os_Hal_IntLevelType, AUTOMATIC, OS_APPL_DATA) Level
+))
+{
+  /* #10 Get the interrupt level for CAT1. */
+  *Level = (Os_Hal_IntLevelType)OS_CFG_HAL_ISR1_DISABLE_LEVEL;                                                          /* SBSW_OS_HAL_PWA_CALLER */
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_IntGetTPLockLevel()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,                                           /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+Os_Hal_IntGetTPLockLevel,
+(
+  P2VAR(Os_Hal_IntLevelType, AUTOMATIC, OS_APPL_DATA) Level
+))
+{
+  /* #10 Get the interrupt level for TP. */
+  *Level = (Os_Hal_IntLevelType)OS_CFG_HAL_TP_DISABLE_LEVEL;                                                            /* SBSW_OS_HAL_PWA_CALLER */
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_IntGetTaskLevel()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,                                           /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+Os_Hal_IntGetTaskLevel,
+(
+  P2VAR(Os_Hal_IntLevelType, AUTOMATIC, OS_APPL_DATA) Level
+))
+{
+  /* #10 Get the interrupt level for tasks. */
+  *Level = (Os_Hal_IntLevelType)0;                                                                                      /* SBSW_OS_HAL_PWA_CALLER */
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_IntGetInterruptState()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE,                                                             /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+OS_ALWAYS_INLINE, Os_Hal_IntGetInterruptState,
+(
+  P2VAR(Os_Hal_IntStateType, AUTOMATIC, OS_VAR_NOINIT) InterruptState
+))
+{
+  /* #10 Get the current interrupt status. */
+  *InterruptState = (Os_Hal_IntStateType)(                                                                              /* SBSW_OS_HAL_PWA_CALLER */
+                                           Os_Hal_PosixCoreGetSelf()->Icr &
+                                           (OS_HAL_ICR_INT_MASK | OS_HAL_ICR_INT_LEVEL_MASK)
+                                         );
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_IntDisableSource()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,                                           /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+Os_Hal_IntDisableSource,
+(
+  P2CONST(Os_Hal_IntIsrConfigType, AUTOMATIC, OS_APPL_DATA) IsrConfig
+))
+{
+  /* #10 Disable the given interrupt source in its SRC register. */
+  Os_Hal_PosixSrcModify(IsrConfig->Source, OS_HAL_INT_SRC_SRE_MASK, 0uL);
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_IntDisableSourceMapped()
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,                                           /* COV_OS_HALPLATFORMISRMAPPINGAVAILABILITY */ /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+Os_Hal_IntDisableSourceMapped,
+(
+  P2CONST(Os_Hal_IntIsrConfigType, AUTOMATIC, OS_APPL_DATA) IsrConfig,
+  P2CONST(Os_Hal_IntIsrMapConfigType, AUTOMATIC, OS_APPL_DATA) IsrMapConfig
+))                                                                                                                      /* COV_OS_HALPLATFORMISRMAPPINGAVAILABILITY */
+{
+  OS_IGNORE_UNREF_PARAM(IsrConfig);                                                                                     /* PRQA S 3112 */ /* MD_MSR_DummyStmt */
+  OS_IGNORE_UNREF_PARAM(IsrMapConfig);                                                                                  /* PRQA S 3112 */ /* MD_MSR_DummyStmt */
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_IntEnableSource()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,                                           /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+Os_Hal_IntEnableSource,
+(
+  P2CONST(Os_Hal_IntIsrConfigType, AUTOMATIC, OS_APPL_DATA) IsrConfig
+))
+{
+  /* #10 Enable the given interrupt source in its SRC register. */
+  Os_Hal_PosixSrcModify(IsrConfig->Source, 0uL, OS_HAL_INT_SRC_SRE_MASK);
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_IntEnableSourceMapped()
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,                                           /* COV_OS_HALPLATFORMISRMAPPINGAVAILABILITY */ /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+Os_Hal_IntEnableSourceMapped,
+(
+  P2CONST(Os_Hal_IntIsrConfigType, AUTOMATIC, OS_APPL_DATA) IsrConfig,
+  P2CONST(Os_Hal_IntIsrMapConfigType, AUTOMATIC, OS_APPL_DATA) IsrMapConfig
+))                                                                                                                      /* COV_OS_HALPLATFORMISRMAPPINGAVAILABILITY */
+{
+  OS_IGNORE_UNREF_PARAM(IsrConfig);                                                                                     /* PRQA S 3112 */ /* MD_MSR_DummyStmt */
+  OS_IGNORE_UNREF_PARAM(IsrMapConfig);                                                                                  /* PRQA S 3112 */ /* MD_MSR_DummyStmt */
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_IntIsClearPendingSupported()
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE Os_StdReturnType, OS_CODE, OS_ALWAYS_INLINE,                               /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+Os_Hal_IntIsClearPendingSupported,( void ))
+{
+  return !0u;                                                                                                           /* PRQA S 4404, 4558 */ /* MD_Os_C90BooleanCompatibility, MD_Os_Rule10.1_4558 */
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_IntClearPending()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,                                           /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+Os_Hal_IntClearPending,
+(
+  P2CONST(Os_Hal_IntIsrConfigType, AUTOMATIC, OS_APPL_DATA) IsrConfig
+))
+{
+  /* #10 Clear the interrupt pending flag in its SRC register. */
+  Os_Hal_PosixSrcModify(IsrConfig->Source, OS_HAL_INT_SRC_SRR_MASK, 0uL);
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_IntClearPendingMapped()
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,                                           /* COV_OS_HALPLATFORMISRMAPPINGAVAILABILITY */ /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+Os_Hal_IntClearPendingMapped,
+(
+  P2CONST(Os_Hal_IntIsrConfigType, AUTOMATIC, OS_APPL_DATA) IsrConfig,
+  P2CONST(Os_Hal_IntIsrMapConfigType, AUTOMATIC, OS_APPL_DATA) IsrMapConfig
+))                                                                                                                      /* COV_OS_HALPLATFORMISRMAPPINGAVAILABILITY */
+{
+  OS_IGNORE_UNREF_PARAM(IsrConfig);                                                                                     /* PRQA S 3112 */ /* MD_MSR_DummyStmt */
+  OS_IGNORE_UNREF_PARAM(IsrMapConfig);                                                                                  /* PRQA S 3112 */ /* MD_MSR_DummyStmt */
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_IntIsInterruptSourceEnabled()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE Os_StdReturnType, OS_CODE, OS_ALWAYS_INLINE,                               /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+Os_Hal_IntIsInterruptSourceEnabled,
+(
+  P2CONST(Os_Hal_IntIsrConfigType, AUTOMATIC, OS_APPL_DATA) IsrConfig
+))
+{
+  volatile uint32 intSourceValue;
+
+  /* #10 Get the interrupt source enable flag. */
+  intSourceValue = Os_Hal_PosixSrc[IsrConfig->Source / OS_HAL_INT_SRC_SIZE];
+
+  /* #20 Return the interrupt source enable status. */
+  return (Os_StdReturnType)((intSourceValue & OS_HAL_INT_SRC_SRE_MASK) != 0x0uL);                                       /* PRQA S 4304 */ /* MD_Os_C90BooleanCompatibility */
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_IntIsInterruptSourceEnabledMapped()
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE Os_StdReturnType, OS_CODE, OS_ALWAYS_INLINE,                               /* COV_OS_HALPLATFORMISRMAPPINGAVAILABILITY */ /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+Os_Hal_IntIsInterruptSourceEnabledMapped,
+(
+  P2CONST(Os_Hal_IntIsrConfigType, AUTOMATIC, OS_APPL_DATA) IsrConfig,
+  P2CONST(Os_Hal_IntIsrMapConfigType, AUTOMATIC, OS_APPL_DATA) IsrMapConfig
+))                                                                                                                      /* COV_OS_HALPLATFORMISRMAPPINGAVAILABILITY */
+{
+  OS_IGNORE_UNREF_PARAM(IsrConfig);                                                                                     /* PRQA S 3112 */ /* MD_MSR_DummyStmt */
+  OS_IGNORE_UNREF_PARAM(IsrMapConfig);                                                                                  /* PRQA S 3112 */ /* MD_MSR_DummyStmt */
+  return 0u;
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_IntIsInterruptPending()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE Os_StdReturnType, OS_CODE, OS_ALWAYS_INLINE,                               /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+Os_Hal_IntIsInterruptPending,
+(
+  P2CONST(Os_Hal_IntIsrConfigType, AUTOMATIC, OS_APPL_DATA) IsrConfig
+))
+{
+  volatile uint32 intSourceValue;
+
+  /* #10 Get the interrupt source pending flag. */
+  intSourceValue = Os_Hal_PosixSrc[IsrConfig->Source / OS_HAL_INT_SRC_SIZE];
+
+  /* #20 Return the interrupt source pending status. */
+  return (Os_StdReturnType)((intSourceValue & OS_HAL_INT_SRC_SRR_MASK) != 0x0uL);                                       /* PRQA S 4304 */ /* MD_Os_C90BooleanCompatibility */
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_IntIsInterruptPendingMapped()
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE Os_StdReturnType, OS_CODE, OS_ALWAYS_INLINE,                               /* COV_OS_HALPLATFORMISRMAPPINGAVAILABILITY */ /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+Os_Hal_IntIsInterruptPendingMapped,
+(
+  P2CONST(Os_Hal_IntIsrConfigType, AUTOMATIC, OS_APPL_DATA) IsrConfig,
+  P2CONST(Os_Hal_IntIsrMapConfigType, AUTOMATIC, OS_APPL_DATA) IsrMapConfig
+))                                                                                                                      /* COV_OS_HALPLATFORMISRMAPPINGAVAILABILITY */
+{
+  OS_IGNORE_UNREF_PARAM(IsrConfig);                                                                                     /* PRQA S 3112 */ /* MD_MSR_DummyStmt */
+  OS_IGNORE_UNREF_PARAM(IsrMapConfig);                                                                                  /* PRQA S 3112 */ /* MD_MSR_DummyStmt */
+  return 0u;
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_IntEndOfInterrupt()
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,                                           /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+Os_Hal_IntEndOfInterrupt,
+(
+  P2CONST(Os_Hal_IntIsrConfigType, AUTOMATIC, OS_APPL_DATA) IsrConfig
+))
+{
+  /*! \note There is no need to acknowledge that interrupt handling in Aurix. */
+  OS_IGNORE_UNREF_PARAM(IsrConfig);                                                                                     /* PRQA S 3112 */ /* MD_MSR_DummyStmt */
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_IntEndOfInterruptMapped()
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,                                           /* COV_OS_HALPLATFORMISRMAPPINGAVAILABILITY */ /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+Os_Hal_IntEndOfInterruptMapped,
+(
+  P2CONST(Os_Hal_IntIsrConfigType, AUTOMATIC, OS_APPL_DATA) IsrConfig,
+  P2CONST(Os_Hal_IntIsrMapConfigType, AUTOMATIC, OS_APPL_DATA) IsrMapConfig
+))                                                                                                                      /* COV_OS_HALPLATFORMISRMAPPINGAVAILABILITY */
+{
+  OS_IGNORE_UNREF_PARAM(IsrConfig);                                                                                     /* PRQA S 3112 */ /* MD_MSR_DummyStmt */
+  OS_IGNORE_UNREF_PARAM(IsrMapConfig);                                                                                  /* PRQA S 3112 */ /* MD_MSR_DummyStmt */
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_IntIsrLevelIsLe(()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE Os_StdReturnType,                                                          /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+OS_CODE, OS_ALWAYS_INLINE, Os_Hal_IntIsrLevelIsLe,
+(
+  P2CONST(Os_Hal_IntIsrConfigType, AUTOMATIC, OS_APPL_DATA) IsrConfig,
+  P2CONST(Os_Hal_IntLevelType, AUTOMATIC, OS_CONST) Level
+))
+{
+  /* #10 Get the interrupt level is lower or equal status. */
+  return (Os_StdReturnType)(IsrConfig->Level <= (*Level));                                                              /* PRQA S 4304 */ /* MD_Os_C90BooleanCompatibility */
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_IntLevelIsGt()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE Os_StdReturnType, OS_CODE,                                                 /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+OS_ALWAYS_INLINE, Os_Hal_IntLevelIsGt,
+(
+  P2CONST(Os_Hal_IntLevelType, AUTOMATIC, OS_CONST) LevelX,
+  P2CONST(Os_Hal_IntLevelType, AUTOMATIC, OS_CONST) LevelY
+))
+{
+  /* #10 Get the interrupt level is higher status. */
+  return (Os_StdReturnType)((*LevelX) > (*LevelY));                                                                     /* PRQA S 4304 */ /* MD_Os_C90BooleanCompatibility */
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_IntTrapRestore()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE,                                                             /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+OS_ALWAYS_INLINE, Os_Hal_IntTrapRestore,
+(
+  P2CONST(Os_Hal_IntTrapStateType, AUTOMATIC, OS_VAR_NOINIT) InterruptState
+))
+{
+  uint32 icr;
+
+  /* #10 Restore the previous interrupt status. */
+  icr = Os_Hal_PosixCoreGetSelf()->Icr & ~(OS_HAL_ICR_INT_MASK | OS_HAL_ICR_INT_LEVEL_MASK);
+  icr |= *InterruptState;
+
+  Os_Hal_PosixIcrWrite(icr);
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_IntTrapUpdate()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE,                                                             /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+OS_ALWAYS_INLINE, Os_Hal_IntTrapUpdate,
+(
+  P2VAR(Os_Hal_IntTrapStateType, AUTOMATIC, OS_VAR_NOINIT) InterruptState
+))
+{
+  /* #10 Get the current interrupt status. */
+  *InterruptState = (Os_Hal_IntTrapStateType)(                                                                          /* SBSW_OS_HAL_PWA_CALLER */
+                                               Os_Hal_PosixCoreGetSelf()->Icr &
+                                               (OS_HAL_ICR_INT_MASK | OS_HAL_ICR_INT_LEVEL_MASK)
+                                             );
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_IntInterruptSourceInit()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE,                                                             /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+OS_ALWAYS_INLINE, Os_Hal_IntInterruptSourceInit,
+(
+  P2CONST(Os_Hal_IntIsrConfigType, AUTOMATIC, OS_APPL_DATA) InterruptSource
+))
+{
+  /* #10 Assign the source to its level on the target core, so that the core can acknowledge the source. */
+  Os_Hal_PosixCore[InterruptSource->CoreAssignment].LevelSource[InterruptSource->Level] =                               /* SBSW_OS_HAL_PWA_ISRCONFIG */
+    InterruptSource->Source / OS_HAL_INT_SRC_SIZE;
+
+  /* #20 Set the required priority and core assignment. */
+  Os_Hal_PosixSrcModify(InterruptSource->Source,
+                        OS_HAL_INT_SRC_SRPN_MASK | OS_HAL_INT_SRC_TOS_MASK,
+                        InterruptSource->Level | (((uint32)(InterruptSource->CoreAssignment)) << OS_HAL_INT_SRC_TOS_SHIFTVALUE));
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_IntInterruptSourceInitMapped()
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE,                                                             /* COV_OS_HALPLATFORMISRMAPPINGAVAILABILITY */ /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+OS_ALWAYS_INLINE, Os_Hal_IntInterruptSourceInitMapped,
+(
+  P2CONST(Os_Hal_IntIsrConfigType, AUTOMATIC, OS_APPL_DATA) InterruptSource,
+  P2CONST(Os_Hal_IntIsrMapConfigType, AUTOMATIC, OS_APPL_DATA) IsrMapConfig
+))                                                                                                                      /* COV_OS_HALPLATFORMISRMAPPINGAVAILABILITY */
+{
+  OS_IGNORE_UNREF_PARAM(InterruptSource);                                                                               /* PRQA S 3112 */ /* MD_MSR_DummyStmt */
+  OS_IGNORE_UNREF_PARAM(IsrMapConfig);                                                                                  /* PRQA S 3112 */ /* MD_MSR_DummyStmt */
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_IntIsGlobal2LevelSwitchSupported()
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE Os_StdReturnType, OS_CODE, OS_ALWAYS_INLINE,                               /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+Os_Hal_IntIsGlobal2LevelSwitchSupported, (void))
+{
+  return !0u;                                                                                                           /* PRQA S 4404, 4558 */ /* MD_Os_C90BooleanCompatibility, MD_Os_Rule10.1_4558 */
+}
+
+/***********************************************************************************************************************
+ *  Os_Hal_IntIsPeripheralInterruptTriggerSupported()
+ **********************************************************************************************************************/
+ /*!
+ * Internal comment removed.
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE Os_StdReturnType, OS_CODE, OS_ALWAYS_INLINE,                               /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+Os_Hal_IntIsPeripheralInterruptTriggerSupported, (void))
+{
+  /* #10 Return !0 because the peripheral interrupts can be triggered. */
+  return !0u;                                                                                                           /* PRQA S 4404, 4558 */ /* MD_Os_C90BooleanCompatibility, MD_Os_Rule10.1_4558 */
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_IntIsLevelSupported()
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE Os_StdReturnType, OS_CODE, OS_ALWAYS_INLINE,                               /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+Os_Hal_IntIsLevelSupported, (void))
+{
+  return !0u;                                                                                                           /* PRQA S 4404, 4558 */ /* MD_Os_C90BooleanCompatibility, MD_Os_Rule10.1_4558 */
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_IntGetGlobalState()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,                                           /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+Os_Hal_IntGetGlobalState,
+(
+  P2VAR(Os_Hal_IntGlobalStateType, AUTOMATIC, OS_APPL_DATA) State
+))
+{
+  /* #10 Get the current global interrupt status. */
+  *State = (Os_Hal_IntGlobalStateType)(Os_Hal_PosixCoreGetSelf()->Icr & OS_HAL_ICR_INT_MASK);                           /* SBSW_OS_HAL_PWA_CALLER */
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_IntIsInterruptMappingSupported()
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE Os_StdReturnType, OS_CODE, OS_ALWAYS_INLINE,                               /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+Os_Hal_IntIsInterruptMappingSupported, ( void ))
+{
+  return 0u;
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_IntIsInterruptPostActionSupported()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE Os_StdReturnType, OS_CODE, OS_ALWAYS_INLINE,                               /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+Os_Hal_IntIsInterruptPostActionSupported, ( void ))
+{
+  /* #10 Return 0 as the hardware does not support interrupt post action handling. */
+  return 0u;
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_IntPostAction()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,                                           /* COV_OS_HALPLATFORMISRPOSTACTIONAVAILABILITY */ /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+Os_Hal_IntPostAction,
+(
+  P2CONST(Os_Hal_IntIsrConfigType, AUTOMATIC, OS_APPL_DATA) IsrConfig
+))                                                                                                                      /* COV_OS_HALPLATFORMISRPOSTACTIONAVAILABILITY */
+{
+  /* #10 Nothing to do on this hardware. */
+  OS_IGNORE_UNREF_PARAM(IsrConfig);                                                                                     /* PRQA S 3112 */ /* MD_MSR_DummyStmt */
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_IntPostActionMapped()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,                                           /* COV_OS_HALPLATFORMISRPOSTACTIONAVAILABILITY */ /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+Os_Hal_IntPostActionMapped,
+(
+  P2CONST(Os_Hal_IntIsrConfigType, AUTOMATIC, OS_APPL_DATA) IsrConfig,
+  P2CONST(Os_Hal_IntIsrMapConfigType, AUTOMATIC, OS_APPL_DATA) IsrMapConfig
+))                                                                                                                      /* COV_OS_HALPLATFORMISRPOSTACTIONAVAILABILITY */
+{
+  /* #10 Nothing to do on this hardware. */
+  OS_IGNORE_UNREF_PARAM(IsrConfig);                                                                                     /* PRQA S 3112 */ /* MD_MSR_DummyStmt */
+  OS_IGNORE_UNREF_PARAM(IsrMapConfig);                                                                                  /* PRQA S 3112 */ /* MD_MSR_DummyStmt */
+}
+
+
+# define OS_STOP_SEC_CODE
+# include "Os_MemMap_OsCode.h"                                                                                          /* PRQA S 5087 */ /* MD_MSR_MemMap */
+
+#endif /* OS_HAL_INTERRUPT_POSIX_H */
+
+/*!
+ * \}
+ */
+
+/**********************************************************************************************************************
+ *  END OF FILE: Os_Hal_Interrupt_Posix.h
+ *********************************************************************************************************************/
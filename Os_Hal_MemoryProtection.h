@@ -121,7 +121,9 @@ OS_ALWAYS_INLINE, Os_Hal_MpCoreInit,
   P2CONST(Os_Hal_ContextStackConfigType, AUTOMATIC, OS_VAR_NOINIT) InitialStackRegion
 ))
 {
+# if !defined (OS_HAL_CORE_POSIX)
   Os_Hal_IntGlobalStateType previousState;
+# endif
 
   /* #10 If there are MPU data regions configured which need to be reprogrammed: */
   if(CoreConfig->MpuDataRegionCount > 0u)
@@ -150,6 +152,10 @@ OS_ALWAYS_INLINE, Os_Hal_MpCoreInit,
     Os_Hal_InitializeAccessCPXE(CoreConfig->MpuCodeRegionExecutionEnable);                                              /* SBSW_OS_HAL_FC_MPUCONFIG */
   }
 
+# if defined (OS_HAL_CORE_POSIX)
+  /* #80 The POSIX host has no core MPU, which could be activated. */
+  OS_IGNORE_UNREF_PARAM(InitialStackRegion);                                                                            /* PRQA S 3112 */ /* MD_MSR_DummyStmt */
+# else
   /* #80 set the stack regions. */
   Os_Hal_Mtcr(OS_HAL_COREMPU_DPR_UPPER0, InitialStackRegion->StackRegionEnd);
   Os_Hal_Mtcr(OS_HAL_COREMPU_DPR_LOW0,   InitialStackRegion->StackRegionStart);
@@ -166,6 +172,7 @@ OS_ALWAYS_INLINE, Os_Hal_MpCoreInit,
 
   /* #110 Restore the previous interrupt global state. */
   Os_Hal_IntSetGlobalState(&previousState);                                                                             /* SBSW_OS_HAL_FC_LOCAL_VAR */
+# endif
 }                                                                                                                       /* PRQA S 6050 */ /* MD_MSR_STCAL */
 
 
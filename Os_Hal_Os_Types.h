@@ -34,6 +34,7 @@
 # include "Std_Types.h"
 
 /* Os module declarations */
+# include "Os_Cfg.h"
 
 /* Os kernel module dependencies */
 
@@ -58,7 +59,11 @@
 /*! Platform specific address type.
  *  \details This data type has the same bit width as a pointer. Therefore a conversion from this type into a
  *  pointer and vice versa is always valid. */
+# if defined(OS_CFG_DERIVATIVEGROUP_POSIX)                                                                              /* COV_OS_DERIVATIVEGROUP */
+typedef unsigned long Os_Hal_AddressType;
+# else
 typedef uint32 Os_Hal_AddressType;
+# endif
 
 
 /*! Forward declaration of Os_ExceptionContextType */
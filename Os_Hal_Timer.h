@@ -65,6 +65,10 @@
 #  include "Os_Hal_Timer_CoreSTM.h"
 # endif
 
+# if defined (OS_HAL_TIMER_POSIX)
+#  include "Os_Hal_Timer_Posix.h"
+# endif
+
 /***********************************************************************************************************************
  *  GLOBAL CONSTANT MACROS
  **********************************************************************************************************************/
@@ -136,6 +136,10 @@
 #  include "Os_Hal_Timer_CoreSTMInt.h"
 # endif
 
+# if defined (OS_HAL_TIMER_POSIX)
+#  include "Os_Hal_Timer_PosixInt.h"
+# endif
+
 /***********************************************************************************************************************
  *  GLOBAL CONSTANT MACROS
  **********************************************************************************************************************/
@@ -0,0 +1,290 @@
+/**********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2021 by Vector Informatik GmbH.                                              All rights reserved.
+ *
+ *                This software is copyright protected and proprietary to Vector Informatik GmbH.
+ *                Vector Informatik GmbH grants to you only those rights as set out in the license conditions.
+ *                All other rights remain with Vector Informatik GmbH.
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/**
+ * \addtogroup  Os_Hal_Timer
+ * \{
+ *
+ * \file        Os_Hal_Timer_Posix.c
+ * \brief       Counter and compare channel emulation of the POSIX host platform.
+ *
+ *
+ *********************************************************************************************************************/
+/***********************************************************************************************************************
+ *  REVISION HISTORY
+ *  --------------------------------------------------------------------------------------------------------------------
+ *  Refer to Os_Hal_Os.h.
+ **********************************************************************************************************************/
+
+                                                                                                                        /* PRQA S 0777 EOF */ /* MD_MSR_Rule5.1 */
+
+#define OS_HAL_TIMER_POSIX_SOURCE
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+/* AUTOSAR includes */
+#include "Std_Types.h"
+
+/* Os kernel module dependencies */
+
+/* Os hal dependencies */
+#include "Os_Hal_Timer.h"
+
+#if defined (OS_HAL_TIMER_POSIX)
+
+/* Host dependencies */
+# include <time.h>
+
+/**********************************************************************************************************************
+ *  LOCAL CONSTANT MACROS
+ **********************************************************************************************************************/
+
+/*! Nanoseconds per second. */
+# define OS_HAL_TIMER_POSIX_NS_PER_SECOND         (1000000000uLL)
+
+/*! Marks a host time, which is never reached. */
+# define OS_HAL_TIMER_POSIX_NEVER                 (0xFFFFFFFFFFFFFFFFuLL)
+
+/**********************************************************************************************************************
+ *  LOCAL FUNCTION MACROS
+ **********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ *  LOCAL DATA TYPES AND STRUCTURES
+ **********************************************************************************************************************/
+
+/*! State of an emulated compare channel. */
+typedef struct
+{
+  /*! SRC offset of the interrupt source. */
+  uint32 Source;
+
+  /*! Host time (CLOCK_MONOTONIC in nanoseconds) of the expiration. OS_HAL_TIMER_POSIX_NEVER, if not armed. */
+  uint64 Deadline;
+} Os_Hal_PosixTimerChannelType;
+
+/**********************************************************************************************************************
+ *  LOCAL DATA PROTOTYPES
+ **********************************************************************************************************************/
+
+/*! Compare channels. Protected by Os_Hal_PosixTimerLock. */
+static Os_Hal_PosixTimerChannelType Os_Hal_PosixTimerChannel[OS_HAL_TIMER_POSIX_CHANNEL_COUNT];
+
+/*! Protects the compare channels. */
+static pthread_mutex_t Os_Hal_PosixTimerLock = PTHREAD_MUTEX_INITIALIZER;
+
+/*! Wakes the timer thread, if a compare channel has been armed. */
+static pthread_cond_t Os_Hal_PosixTimerCondition;
+
+/*! Starts the timer thread once. */
+static pthread_once_t Os_Hal_PosixTimerOnce = PTHREAD_ONCE_INIT;
+
+/**********************************************************************************************************************
+ *  GLOBAL DATA
+ **********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ *  LOCAL FUNCTION PROTOTYPES
+ **********************************************************************************************************************/
+# define OS_START_SEC_CODE
+# include "Os_MemMap_OsCode.h"                                                                                          /* PRQA S 5087 */ /* MD_MSR_MemMap */
+
+/*! \brief        Returns the host time (CLOCK_MONOTONIC) in nanoseconds and optionally the matching counter value. */
+static uint64 Os_Hal_PosixTimerNow(P2VAR(Os_Hal_TimerFrtTickType, AUTOMATIC, OS_VAR_NOINIT) Counter);
+
+/*! \brief        Initializes the channels and creates the timer thread. */
+static void Os_Hal_PosixTimerStart(void);
+
+/*! \brief        Timer thread. Sets the service requests of expired channels. */
+static void* Os_Hal_PosixTimerThread(void* Argument);
+
+
+/**********************************************************************************************************************
+ *  LOCAL FUNCTIONS
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *  Os_Hal_PosixTimerNow()
+ **********************************************************************************************************************/
+static uint64 Os_Hal_PosixTimerNow(P2VAR(Os_Hal_TimerFrtTickType, AUTOMATIC, OS_VAR_NOINIT) Counter)
+{
+  struct timespec now;
+
+  (void)clock_gettime(CLOCK_MONOTONIC, &now);
+
+  /* #10 Scale the seconds and the nanoseconds separately, so that the product does not overflow. */
+  if(Counter != NULL_PTR)
+  {
+    *Counter = (Os_Hal_TimerFrtTickType)(((uint64)now.tv_sec * (uint64)OS_HAL_TIMER_POSIX_FREQUENCY) +
+                                         (((uint64)now.tv_nsec * (uint64)OS_HAL_TIMER_POSIX_FREQUENCY) /
+                                          OS_HAL_TIMER_POSIX_NS_PER_SECOND));
+  }
+
+  return ((uint64)now.tv_sec * OS_HAL_TIMER_POSIX_NS_PER_SECOND) + (uint64)now.tv_nsec;
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_PosixTimerStart()
+ **********************************************************************************************************************/
+static void Os_Hal_PosixTimerStart(void)
+{
+  pthread_condattr_t attributes;
+  pthread_t thread;
+  uint32 channel;
+
+  for(channel = 0uL; channel < OS_HAL_TIMER_POSIX_CHANNEL_COUNT; channel++)
+  {
+    Os_Hal_PosixTimerChannel[channel].Deadline = OS_HAL_TIMER_POSIX_NEVER;
+  }
+
+  /* #10 The condition uses the same clock as the deadlines. */
+  (void)pthread_condattr_init(&attributes);
+  (void)pthread_condattr_setclock(&attributes, CLOCK_MONOTONIC);
+  (void)pthread_cond_init(&Os_Hal_PosixTimerCondition, &attributes);
+  (void)pthread_condattr_destroy(&attributes);
+
+  if(pthread_create(&thread, NULL_PTR, Os_Hal_PosixTimerThread, NULL_PTR) != 0)
+  {
+    Os_Hal_CoreFreeze();
+  }
+  (void)pthread_detach(thread);
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_PosixTimerThread()
+ **********************************************************************************************************************/
+static void* Os_Hal_PosixTimerThread(void* Argument)
+{
+  OS_IGNORE_UNREF_PARAM(Argument);                                                                                      /* PRQA S 3112 */ /* MD_MSR_DummyStmt */
+
+  /* #10 The timer thread does not emulate a core. */
+  Os_Hal_PosixCoreId = OS_HAL_POSIX_NO_CORE;
+
+  (void)pthread_mutex_lock(&Os_Hal_PosixTimerLock);
+  for(;;)
+  {
+    uint64 now = Os_Hal_PosixTimerNow(NULL_PTR);
+    uint64 next = OS_HAL_TIMER_POSIX_NEVER;
+    uint32 channel;
+
+    /* #20 Raise the service request of each expired channel and find the next deadline. */
+    for(channel = 0uL; channel < OS_HAL_TIMER_POSIX_CHANNEL_COUNT; channel++)
+    {
+      P2VAR(Os_Hal_PosixTimerChannelType, AUTOMATIC, OS_VAR_NOINIT) timer = &Os_Hal_PosixTimerChannel[channel];
+
+      if(timer->Deadline <= now)
+      {
+        timer->Deadline = OS_HAL_TIMER_POSIX_NEVER;
+        Os_Hal_PosixSrcModify(timer->Source, 0uL, OS_HAL_INT_SRC_SRR_MASK);
+      }
+      else if(timer->Deadline < next)
+      {
+        next = timer->Deadline;
+      }
+      else
+      {
+        /* The channel expires later or is not armed. */
+      }
+    }
+
+    /* #30 Sleep until the next deadline or until a channel is armed. */
+    if(next == OS_HAL_TIMER_POSIX_NEVER)
+    {
+      (void)pthread_cond_wait(&Os_Hal_PosixTimerCondition, &Os_Hal_PosixTimerLock);
+    }
+    else
+    {
+      struct timespec deadline;
+
+      deadline.tv_sec = (time_t)(next / OS_HAL_TIMER_POSIX_NS_PER_SECOND);
+      deadline.tv_nsec = (long)(next % OS_HAL_TIMER_POSIX_NS_PER_SECOND);
+      (void)pthread_cond_timedwait(&Os_Hal_PosixTimerCondition, &Os_Hal_PosixTimerLock, &deadline);
+    }
+  }
+
+  return NULL_PTR;                                                                                                      /* PRQA S 2880 */ /* MD_Os_Rule2.1_2880 */
+}
+
+
+/**********************************************************************************************************************
+ *  GLOBAL FUNCTIONS
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *  Os_Hal_PosixTimerGetCounter()
+ **********************************************************************************************************************/
+FUNC(Os_Hal_TimerFrtTickType, OS_CODE) Os_Hal_PosixTimerGetCounter(void)
+{
+  Os_Hal_TimerFrtTickType counter;
+
+  (void)Os_Hal_PosixTimerNow(&counter);
+
+  return counter;
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_PosixTimerSetCompare()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ */
+FUNC(void, OS_CODE) Os_Hal_PosixTimerSetCompare(uint32 Channel, uint32 Source, Os_Hal_TimerFrtTickType Compare)
+{
+  Os_Hal_TimerFrtTickType counter;
+  uint64 now;
+  uint64 distance;
+  sigset_t notification;
+  sigset_t previous;
+
+  (void)pthread_once(&Os_Hal_PosixTimerOnce, Os_Hal_PosixTimerStart);
+
+  /* #10 Convert the compare value into a host deadline. The distance is taken modulo the counter range. */
+  now = Os_Hal_PosixTimerNow(&counter);
+  distance = (uint64)(Os_Hal_TimerFrtTickType)(Compare - counter);
+  distance = (distance * OS_HAL_TIMER_POSIX_NS_PER_SECOND) / (uint64)OS_HAL_TIMER_POSIX_FREQUENCY;
+
+  /* #20 Block notifications of the calling core, so that no handler re-enters while the lock is held. */
+  (void)sigemptyset(&notification);
+  (void)sigaddset(&notification, OS_HAL_POSIX_SIGNAL);
+  (void)pthread_sigmask(SIG_BLOCK, &notification, &previous);
+
+  /* #30 Arm the channel and wake the timer thread. */
+  (void)pthread_mutex_lock(&Os_Hal_PosixTimerLock);
+  Os_Hal_PosixTimerChannel[Channel].Source = Source;
+  Os_Hal_PosixTimerChannel[Channel].Deadline = now + distance;
+  (void)pthread_cond_signal(&Os_Hal_PosixTimerCondition);
+  (void)pthread_mutex_unlock(&Os_Hal_PosixTimerLock);
+
+  (void)pthread_sigmask(SIG_SETMASK, &previous, NULL_PTR);
+}
+
+
+# define OS_STOP_SEC_CODE
+# include "Os_MemMap_OsCode.h"                                                                                          /* PRQA S 5087 */ /* MD_MSR_MemMap */
+
+#endif /* if defined (OS_HAL_TIMER_POSIX) */
+
+/*!
+ * \}
+ */
+
+/**********************************************************************************************************************
+ *  END OF FILE: Os_Hal_Timer_Posix.c
+ *********************************************************************************************************************/
@@ -0,0 +1,170 @@
+/**********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2021 by Vector Informatik GmbH.                                              All rights reserved.
+ *
+ *                This software is copyright protected and proprietary to Vector Informatik GmbH.
+ *                Vector Informatik GmbH grants to you only those rights as set out in the license conditions.
+ *                All other rights remain with Vector Informatik GmbH.
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/**
+ * \ingroup     Os_Hal
+ * \addtogroup  Os_Hal_Timer
+ *
+ * \{
+ *
+ * \file       Os_Hal_Timer_Posix.h
+ * \brief      This file contains the definition of the emulated timer of the POSIX host platform
+ *
+ *********************************************************************************************************************/
+/***********************************************************************************************************************
+ *  REVISION HISTORY
+ *  --------------------------------------------------------------------------------------------------------------------
+ *  Refer to Os_Hal_Os.h.
+ **********************************************************************************************************************/
+                                                                                                                        /* PRQA S 0388  EOF */ /* MD_MSR_Dir1.1 */
+
+#ifndef OS_HAL_TIMER_POSIX_H
+# define OS_HAL_TIMER_POSIX_H
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+/* AUTOSAR includes */
+# include "Std_Types.h"
+
+/* Os module declarations */
+# include "Os_Hal_Timer_PosixInt.h"
+
+/* Os kernel module dependencies */
+
+/* Os Hal dependencies */
+# include "Os_Hal_Interrupt.h"
+
+/**********************************************************************************************************************
+ *  GLOBAL CONSTANT MACROS
+ *********************************************************************************************************************/
+
+
+/**********************************************************************************************************************
+ *  GLOBAL FUNCTION MACROS
+ *********************************************************************************************************************/
+
+
+/**********************************************************************************************************************
+ *  GLOBAL DATA TYPES AND STRUCTURES
+ *********************************************************************************************************************/
+
+
+/**********************************************************************************************************************
+ *  GLOBAL DATA PROTOTYPES
+ *********************************************************************************************************************/
+
+
+/**********************************************************************************************************************
+ *  GLOBAL FUNCTION PROTOTYPES
+ *********************************************************************************************************************/
+
+# define OS_START_SEC_CODE
+# include "Os_MemMap_OsCode.h"                                                                                          /* PRQA S 5087 */ /* MD_MSR_MemMap */
+
+/**********************************************************************************************************************
+ *  GLOBAL FUNCTIONS
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *  Os_Hal_TimerFrtInit()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,                                           /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+Os_Hal_TimerFrtInit,
+(
+  P2CONST(Os_Hal_TimerFrtConfigType, AUTOMATIC, OS_CONST) TimerConfig
+))
+{
+  /* #10 Arm the compare channel with the reload value. If this is a HRT, the generated reload value should be 0. */
+  Os_Hal_PosixTimerSetCompare(TimerConfig->Channel, TimerConfig->InterruptSource, TimerConfig->ReloadValue);
+
+  /* #20 Enable the interrupt. */
+  Os_Hal_PosixSrcModify(TimerConfig->InterruptSource, 0uL, OS_HAL_INT_SRC_SRE_MASK);
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_TimerFrtGetCounterValue()
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DEFINITION(                                                                                           /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+OS_LOCAL_INLINE Os_Hal_TimerFrtTickType, OS_CODE, OS_ALWAYS_INLINE,
+Os_Hal_TimerFrtGetCounterValue,
+(
+  P2CONST(Os_Hal_TimerFrtConfigType, AUTOMATIC, OS_CONST) TimerConfig
+))
+{
+  OS_IGNORE_UNREF_PARAM(TimerConfig);                                                                                   /* PRQA S 3112 */ /* MD_MSR_DummyStmt */
+  return Os_Hal_PosixTimerGetCounter();
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_TimerFrtSetCompareValue()
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,                                           /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+Os_Hal_TimerFrtSetCompareValue,
+(
+  P2CONST(Os_Hal_TimerFrtConfigType, AUTOMATIC, OS_CONST) TimerConfig,
+  Os_Hal_TimerFrtTickType ExpirationTime
+))
+{
+  Os_Hal_PosixTimerSetCompare(TimerConfig->Channel, TimerConfig->InterruptSource, ExpirationTime);
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_TimerFrtAcknowledge()
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,                                           /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+Os_Hal_TimerFrtAcknowledge,
+(
+  P2CONST(Os_Hal_TimerFrtConfigType, AUTOMATIC, OS_CONST) TimerConfig
+))
+{
+  /*!
+   * \note There is no need to acknowledge a FRT.
+   */
+  OS_IGNORE_UNREF_PARAM(TimerConfig);                                                                                   /* PRQA S 3112 */ /* MD_MSR_DummyStmt */
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_TimerFrtTriggerIrq()
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,                                           /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+Os_Hal_TimerFrtTriggerIrq,
+(
+  P2CONST(Os_Hal_TimerFrtConfigType, AUTOMATIC, OS_CONST) TimerConfig
+))
+{
+  Os_Hal_PosixSrcModify(TimerConfig->InterruptSource, 0uL, OS_HAL_INT_SRC_SETR_MASK);
+}
+
+
+# define OS_STOP_SEC_CODE
+# include "Os_MemMap_OsCode.h"                                                                                          /* PRQA S 5087 */ /* MD_MSR_MemMap */
+
+#endif /* OS_HAL_TIMER_POSIX_H */
+
+/*!
+ * \}
+ */
+/**********************************************************************************************************************
+ *  END OF FILE: Os_Hal_Timer_Posix.h
+ *********************************************************************************************************************/
@@ -0,0 +1,262 @@
+/**********************************************************************************************************************
+ *  COPYRIGHT
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2021 by Vector Informatik GmbH.                                              All rights reserved.
+ *
+ *                This software is copyright protected and proprietary to Vector Informatik GmbH.
+ *                Vector Informatik GmbH grants to you only those rights as set out in the license conditions.
+ *                All other rights remain with Vector Informatik GmbH.
+ *  \endverbatim
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/**
+ * \ingroup     Os_Hal
+ * \addtogroup  Os_Hal_Timer
+ *
+ * \{
+ *
+ * \file       Os_Hal_Timer_PosixInt.h
+ * \brief      This file contains the declaration of the emulated timer of the POSIX host platform
+ *
+ * The counter is derived from CLOCK_MONOTONIC with the frequency OS_HAL_TIMER_POSIX_FREQUENCY. Compare channels
+ * are emulated by a host thread, which sets the service request of the assigned SRC, once the counter has reached
+ * the compare value.
+ *********************************************************************************************************************/
+/***********************************************************************************************************************
+ *  REVISION HISTORY
+ *  --------------------------------------------------------------------------------------------------------------------
+ *  Refer to Os_Hal_Os.h.
+ **********************************************************************************************************************/
+
+
+#ifndef OS_HAL_TIMER_POSIXINT_H
+# define OS_HAL_TIMER_POSIXINT_H
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+/* AUTOSAR includes */
+# include "Std_Types.h"
+
+/* Os module declarations */
+
+/* Os kernel module dependencies */
+
+/* Os Hal dependencies */
+
+/**********************************************************************************************************************
+ *  GLOBAL CONSTANT MACROS
+ *********************************************************************************************************************/
+/*! Number of emulated compare channels (two per STM). */
+# define OS_HAL_TIMER_POSIX_CHANNEL_COUNT         (OS_HAL_TIMER_STM_COUNT * 2uL)
+
+
+/**********************************************************************************************************************
+ *  GLOBAL FUNCTION MACROS
+ *********************************************************************************************************************/
+
+
+/**********************************************************************************************************************
+ *  GLOBAL DATA TYPES AND STRUCTURES
+ *********************************************************************************************************************/
+
+/*! High resolution timer configuration information. */
+struct Os_Hal_TimerFrtConfigType_Tag
+{
+  /*! The emulated compare channel. It must be in range [0, OS_HAL_TIMER_POSIX_CHANNEL_COUNT - 1]. */
+  uint32 Channel;
+
+  /*! SRC offset of the interrupt source used by this timer */
+  uint32 InterruptSource;
+
+  /*! This is the reload value, if this timer is used to simulate a PIT */
+  uint32 ReloadValue;
+};
+
+/**********************************************************************************************************************
+ *  GLOBAL DATA PROTOTYPES
+ *********************************************************************************************************************/
+
+
+/**********************************************************************************************************************
+ *  GLOBAL FUNCTION PROTOTYPES
+ *********************************************************************************************************************/
+
+# define OS_START_SEC_CODE
+# include "Os_MemMap_OsCode.h"                                                                                          /* PRQA S 5087 */ /* MD_MSR_MemMap */
+
+/***********************************************************************************************************************
+ *  Os_Hal_PosixTimerGetCounter()
+ **********************************************************************************************************************/
+/*! \brief          Returns the current value of the emulated counter.
+ *  \return         Current counter value.
+ *  \context        ANY
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *  \pre            -
+ **********************************************************************************************************************/
+FUNC(Os_Hal_TimerFrtTickType, OS_CODE) Os_Hal_PosixTimerGetCounter(void);
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_PosixTimerSetCompare()
+ **********************************************************************************************************************/
+/*! \brief          Arms an emulated compare channel.
+ *  \details        The service request of the given source is set, once the counter reaches the compare value.
+ *                  As on the hardware, a compare value which has already been passed expires after a wrap around
+ *                  of the counter.
+ *  \param[in]      Channel   The emulated compare channel.
+ *  \param[in]      Source    SRC offset of the interrupt source.
+ *  \param[in]      Compare   The compare value.
+ *  \context        ANY
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *  \pre            -
+ **********************************************************************************************************************/
+FUNC(void, OS_CODE) Os_Hal_PosixTimerSetCompare(uint32 Channel, uint32 Source, Os_Hal_TimerFrtTickType Compare);
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_TimerFrtInit()
+ **********************************************************************************************************************/
+/*! \brief          Initialize a free running timer using the given configuration.
+ *  \details
+ *  The kernel uses this function during OS initialization to initialize hardware timers.
+ *  Enable the interrupt source of the hardware timer.
+ *
+ *  \param[in]      TimerConfig     Timer hardware configuration. Parameter must not be NULL.
+ *
+ *  \context        OS_INTERNAL
+ *
+ *  \reentrant      FALSE
+ *  \synchronous    TRUE
+ *
+ *  \pre            Supervisor mode
+ *  \pre            Concurrent access is prevented by caller.
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,
+Os_Hal_TimerFrtInit,
+(
+  P2CONST(Os_Hal_TimerFrtConfigType, AUTOMATIC, OS_CONST) TimerConfig
+));
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_TimerFrtGetCounterValue()
+ **********************************************************************************************************************/
+/*! \brief          Return the current counter register value of the given free running timer.
+ *  \details
+ *  The kernel uses this function to implement the AUTOSAR counter interface in case of a free running timer.
+ *
+ *  \param[in]      TimerConfig     Timer hardware configuration. Parameter must not be NULL.
+ *
+ *  \return         Current counter register value.
+ *
+ *  \context        OS_INTERNAL|ANY
+ *
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *
+ *  \pre            Supervisor mode
+ *  \pre            Concurrent access prevented by caller.
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE Os_Hal_TimerFrtTickType, OS_CODE, OS_ALWAYS_INLINE,
+Os_Hal_TimerFrtGetCounterValue,
+(
+  P2CONST(Os_Hal_TimerFrtConfigType, AUTOMATIC, OS_CONST) TimerConfig
+));
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_TimerFrtSetCompareValue()
+ **********************************************************************************************************************/
+/*! \brief          Set the compare value of the given HRT.
+ *  \details
+ *  This function shall set the compare value of the given timer.
+ *
+ *  \param[in,out]  TimerConfig     Timer hardware configuration. Parameter must not be NULL.
+ *  \param[in]      ExpirationTime  The new compare value.
+ *
+ *  \context        ISR2|OS_INTERNAL
+ *
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *
+ *  \pre            Supervisor mode
+ *  \pre            Concurrent access is prevented by caller.
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,
+Os_Hal_TimerFrtSetCompareValue,
+(
+  P2CONST(Os_Hal_TimerFrtConfigType, AUTOMATIC, OS_CONST) TimerConfig,
+  Os_Hal_TimerFrtTickType ExpirationTime
+));
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_TimerFrtAcknowledge()
+ **********************************************************************************************************************/
+/*! \brief          Tell the timer hardware, that we are handling the interrupt request.
+ *  \details
+ *  The kernel uses this function to implement the FRT ISR. It is used to clear pending timer interrupt flags,
+ *  to be able to configure the next timer interrupt.
+ *
+ *  \param[in]      TimerConfig     Timer hardware configuration. Parameter must not be NULL.
+ *
+ *  \context        ISR2|OS_INTERNAL
+ *
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *
+ *  \pre            Supervisor mode
+ *  \pre            Concurrent access is prevented by caller.
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,
+Os_Hal_TimerFrtAcknowledge,
+(
+  P2CONST(Os_Hal_TimerFrtConfigType, AUTOMATIC, OS_CONST) TimerConfig
+));
+
+
+/***********************************************************************************************************************
+ *  Os_Hal_TimerFrtTriggerIrq()
+ **********************************************************************************************************************/
+/*! \brief          Triggers a HRT timer interrupt.
+ *  \details        The kernel uses this function, to trigger a timer ISR, if it detects that an expiration time stamp
+ *                  has been missed.
+ *
+ *  \param[in]      TimerConfig     Timer hardware configuration. Parameter must not be NULL.
+ *
+ *  \context        ISR2|OS_INTERNAL
+ *
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *
+ *  \pre            Supervisor mode
+ *  \pre            Concurrent access is prevented by caller.
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,
+Os_Hal_TimerFrtTriggerIrq,
+(
+  P2CONST(Os_Hal_TimerFrtConfigType, AUTOMATIC, OS_CONST) TimerConfig
+));
+
+
+/***********************************************************************************************************************
+ *  GLOBAL FUNCTIONS
+ **********************************************************************************************************************/
+
+
+# define OS_STOP_SEC_CODE
+# include "Os_MemMap_OsCode.h"                                                                                          /* PRQA S 5087 */ /* MD_MSR_MemMap */
+
+#endif /* OS_HAL_TIMER_POSIXINT_H */
+
+/*!
+ * \}
+ */
+/**********************************************************************************************************************
+ *  END OF FILE: Os_Hal_Timer_PosixInt.h
+ *********************************************************************************************************************/
@@ -387,6 +387,83 @@ OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE, O
 ));
 
 
+/***********************************************************************************************************************
+ *  Os_IocIsLockFree()
+ **********************************************************************************************************************/
+/*! \brief          Returns whether the IOC is accessed without any lock (OS_IOCLOCKMODE_LOCKFREE).
+ *  \details        Lock-free IOCs order their FIFO accesses by memory barriers instead.
+ *
+ *  \param[in]      Ioc             IOC to query. Parameter must not be NULL.
+ *
+ *  \retval         !0    The IOC is lock-free.
+ *  \retval         0     The IOC is protected by its lock mode.
+ *
+ *  \context        ANY
+ *
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *
+ *  \pre            -
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE Os_StdReturnType, OS_CODE, OS_ALWAYS_INLINE, Os_IocIsLockFree,
+(
+  P2CONST(Os_IocConfigType, TYPEDEF, OS_CONST) Ioc
+));
+
+
+/***********************************************************************************************************************
+ *  Os_IocLocksInterrupts()
+ **********************************************************************************************************************/
+/*! \brief          Returns whether the lock mode of the IOC locks interrupts (OS_IOCLOCKMODE_INTERRUPTS or
+ *                  OS_IOCLOCKMODE_ALL).
+ *  \details        --no details--
+ *
+ *  \param[in]      Ioc             IOC to query. Parameter must not be NULL.
+ *
+ *  \retval         !0    The lock mode locks interrupts.
+ *  \retval         0     The lock mode does not lock interrupts.
+ *
+ *  \context        ANY
+ *
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *
+ *  \pre            -
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE Os_StdReturnType, OS_CODE, OS_ALWAYS_INLINE, Os_IocLocksInterrupts,
+(
+  P2CONST(Os_IocConfigType, TYPEDEF, OS_CONST) Ioc
+));
+
+
+/***********************************************************************************************************************
+ *  Os_IocLockModeIsValid()
+ **********************************************************************************************************************/
+/*! \brief          Returns whether the lock mode of the IOC is supported by its sub class.
+ *  \details        OS_IOCLOCKMODE_LOCKFREE requires exactly one writer and one reader of the FIFO. It is only
+ *                  supported by the queued send and receive sub classes of 1:1 channels. N:1 channels share the
+ *                  receiver's ready mask and the multi-receive state between several senders.
+ *                  Single buffered IOCs with sequence counter require a lock mode, which locks interrupts. A reader
+ *                  of such an IOC requires a snapshot buffer.
+ *
+ *  \param[in]      Ioc             IOC to query. Parameter must not be NULL.
+ *
+ *  \retval         !0    The lock mode is supported.
+ *  \retval         0     The lock mode is not supported.
+ *
+ *  \context        OS_INTERNAL
+ *
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *
+ *  \pre            -
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE Os_StdReturnType, OS_CODE, OS_ALWAYS_INLINE, Os_IocLockModeIsValid,
+(
+  P2CONST(Os_IocConfigType, TYPEDEF, OS_CONST) Ioc
+));
+
+
 /***********************************************************************************************************************
  *  Os_IocCallCallbacks()
  **********************************************************************************************************************/
@@ -459,6 +536,249 @@ OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE, O
 ));
 
 
+/***********************************************************************************************************************
+ *  Os_IocIsDataReceived()
+ **********************************************************************************************************************/
+/*! \brief          Returns whether a receive status reports a received element.
+ *  \details        --no details--
+ *
+ *  \param[in]      Status          Status of an internal receive function.
+ *
+ *  \retval         !0  An element has been received.
+ *  \retval         0   No element has been received.
+ *
+ *  \context        ANY
+ *
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *
+ *  \pre            -
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE Os_StdReturnType, OS_CODE, OS_ALWAYS_INLINE, Os_IocIsDataReceived,
+(
+  Os_IocInternalReturnType Status
+));
+
+
+/***********************************************************************************************************************
+ *  Os_IocMergeReceiveStatus()
+ **********************************************************************************************************************/
+/*! \brief          Merges the status of one received element into the status of a multi element receive.
+ *  \details        The first element determines the status. A data loss, which is detected at a later element, is
+ *                  reported as IOC_E_LOST_DATA, because the loss has already been removed from the lost counter
+ *                  snapshot.
+ *
+ *  \param[in]      Status          Status of the elements received so far.
+ *  \param[in]      ElementStatus   Status of the current element.
+ *  \param[in]      Received        Number of elements received before the current element.
+ *
+ *  \return         The merged status.
+ *
+ *  \context        ANY
+ *
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *
+ *  \pre            -
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE Os_IocInternalReturnType, OS_CODE, OS_ALWAYS_INLINE,
+Os_IocMergeReceiveStatus,
+(
+  Os_IocInternalReturnType Status,
+  Os_IocInternalReturnType ElementStatus,
+  uint32 Received
+));
+
+
+/***********************************************************************************************************************
+ *  Os_IocNotifyReceiver()
+ **********************************************************************************************************************/
+/*! \brief          Marks the channel of the given sender in the ready mask of its multiple receive IOC.
+ *  \details        Does nothing, if the sender does not feed a multiple receive IOC or if the multiple receive
+ *                  IOC does not use a ready mask (see Os_IocMultiReceiveUsesReadyMask()).
+ *                  Called after data has been written or lost, so that the receiver visits the channel.
+ *
+ *  \param[in]      Ioc        The sender. Parameter must not be NULL.
+ *
+ *  \context        ANY
+ *
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *
+ *  \pre            -
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE, Os_IocNotifyReceiver,
+(
+  P2CONST(Os_IocSendConfigType, AUTOMATIC, OS_CONST) Ioc
+));
+
+
+/***********************************************************************************************************************
+ *  Os_IocMultiReceiveUsesReadyMask()
+ **********************************************************************************************************************/
+/*! \brief          Returns whether the senders of the given multiple receive IOC maintain its ready mask.
+ *  \details        Senders and receiver both decide by this function, see UsesReadyMask.
+ *
+ *  \param[in]      Ioc        IOC to query. Parameter must not be NULL.
+ *
+ *  \retval         !0  The ready mask is used.
+ *  \retval         0   The ready mask is not used. All channels have to be visited.
+ *
+ *  \context        ANY
+ *
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *
+ *  \pre            -
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE Os_StdReturnType, OS_CODE, OS_ALWAYS_INLINE,
+Os_IocMultiReceiveUsesReadyMask,
+(
+  P2CONST(Os_IocMultiReceiveConfigType, AUTOMATIC, OS_CONST) Ioc
+));
+
+
+/***********************************************************************************************************************
+ *  Os_IocMultiReceiveReadyBit()
+ **********************************************************************************************************************/
+/*! \brief          Returns the ready mask bit of the given channel.
+ *  \details        --no details--
+ *
+ *  \param[in]      Channel    Index of the channel. Must be smaller than OS_BITFIELD_BITWIDTH.
+ *
+ *  \return         The ready mask bit of the channel.
+ *
+ *  \context        ANY
+ *
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *
+ *  \pre            -
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE Os_BitFieldType, OS_CODE, OS_ALWAYS_INLINE,
+Os_IocMultiReceiveReadyBit,
+(
+  Os_ObjIdx_IteratorType Channel
+));
+
+
+/***********************************************************************************************************************
+ *  Os_IocMultiReceiveNextReady()
+ **********************************************************************************************************************/
+/*! \brief          Returns the next marked channel in round robin order.
+ *  \details        The search starts at the channel, where the last receive ended, and wraps around.
+ *
+ *  \param[in]      Ioc        IOC to query. Parameter must not be NULL.
+ *  \param[in]      Pending    Marked channels, which have not been visited yet. Must not be zero.
+ *
+ *  \return         Index of the next marked channel.
+ *
+ *  \context        ANY
+ *
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *
+ *  \pre            Os_IocMultiReceiveUsesReadyMask() returns !0 for the given IOC.
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE Os_ObjIdx_IteratorType, OS_CODE, OS_ALWAYS_INLINE,
+Os_IocMultiReceiveNextReady,
+(
+  P2CONST(Os_IocMultiReceiveConfigType, AUTOMATIC, OS_CONST) Ioc,
+  Os_BitFieldType Pending
+));
+
+
+/***********************************************************************************************************************
+ *  Os_IocMultiReceiveChannel()
+ **********************************************************************************************************************/
+/*! \brief          Reads one element from the given channel of a multiple receive IOC.
+ *  \details        Dispatches to the internal receive function of the given sub class.
+ *
+ *  \param[in,out]  Ioc        IOC to read from. Parameter must not be NULL.
+ *  \param[in]      SubClass   Sub class of Ioc. Must be a multiple receive sub class.
+ *  \param[in]      Channel    Index of the channel. Must be smaller than ReceiveChannelCount.
+ *  \param[out]     Data       Element of the sub class element type. Parameter must not be NULL.
+ *
+ *  \return         See Os_Ioc08ReceiveInternal().
+ *
+ *  \context        ANY
+ *
+ *  \reentrant      TRUE for different objects.
+ *  \synchronous    TRUE
+ *
+ *  \pre            Depending on the lock type the caller has to synchronize the access to the given IOC object.
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE Os_IocInternalReturnType, OS_CODE, OS_ALWAYS_INLINE,
+Os_IocMultiReceiveChannel,
+(
+  P2CONST(Os_IocMultiReceiveConfigType, AUTOMATIC, OS_CONST) Ioc,
+  Os_IocSubClassType SubClass,
+  Os_ObjIdx_IteratorType Channel,
+  P2VAR(void, TYPEDEF, AUTOMATIC) Data
+));
+
+
+/***********************************************************************************************************************
+ *  Os_IocMultiReceiveChannelIsEmpty()
+ **********************************************************************************************************************/
+/*! \brief          Returns whether the given channel of a multiple receive IOC is empty.
+ *  \details        Dispatches to the FIFO of the given sub class.
+ *
+ *  \param[in]      Ioc        IOC to query. Parameter must not be NULL.
+ *  \param[in]      SubClass   Sub class of Ioc. Must be a multiple receive sub class.
+ *  \param[in]      Channel    Index of the channel. Must be smaller than ReceiveChannelCount.
+ *
+ *  \retval         !0  The channel is empty.
+ *  \retval         0   The channel contains data.
+ *
+ *  \context        ANY
+ *
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *
+ *  \pre            -
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE Os_StdReturnType, OS_CODE, OS_ALWAYS_INLINE,
+Os_IocMultiReceiveChannelIsEmpty,
+(
+  P2CONST(Os_IocMultiReceiveConfigType, AUTOMATIC, OS_CONST) Ioc,
+  Os_IocSubClassType SubClass,
+  Os_ObjIdx_IteratorType Channel
+));
+
+
+/***********************************************************************************************************************
+ *  Os_IocMultiReceiveReady()
+ **********************************************************************************************************************/
+/*! \brief          Reads one element from the marked channels of a multiple receive IOC.
+ *  \details        Visits the marked channels in round robin order until data is found. A channel is unmarked
+ *                  before it is read, so that data written concurrently marks it again. If data has been received,
+ *                  the channel is marked again if it still contains data, and the next receive continues after it.
+ *
+ *  \param[in,out]  Ioc        IOC to read from. Parameter must not be NULL.
+ *  \param[in]      SubClass   Sub class of Ioc. Must be a multiple receive sub class.
+ *  \param[out]     Data       Element of the sub class element type. Parameter must not be NULL.
+ *
+ *  \return         Status of the last visited channel, see Os_Ioc08ReceiveInternal().
+ *  \retval         OS_IOC_E_INTERNAL_NO_DATA  No channel is marked or no marked channel contains data.
+ *
+ *  \context        ANY
+ *
+ *  \reentrant      TRUE for different objects.
+ *  \synchronous    TRUE
+ *
+ *  \pre            Os_IocMultiReceiveUsesReadyMask() returns !0 for the given IOC.
+ *  \pre            Depending on the lock type the caller has to synchronize the access to the given IOC object.
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE Os_IocInternalReturnType, OS_CODE, OS_ALWAYS_INLINE,
+Os_IocMultiReceiveReady,
+(
+  P2CONST(Os_IocMultiReceiveConfigType, AUTOMATIC, OS_CONST) Ioc,
+  Os_IocSubClassType SubClass,
+  P2VAR(void, TYPEDEF, AUTOMATIC) Data
+));
+
+
 /***********************************************************************************************************************
  *  Os_Ioc08ReceiveInit()
  **********************************************************************************************************************/
@@ -852,104 +1172,291 @@ OS_LOCAL_INLINE Os_IocInternalReturnType, OS_CODE, OS_ALWAYS_INLINE, Os_IocRefRe
 
 
 /***********************************************************************************************************************
- *  Os_IocWriteInit()
+ *  Os_IocRefReceiveCheck()
  **********************************************************************************************************************/
-/*! \brief          Initializes an Os_IocWriteConfigType object and its parent class objects.
- *  \details        This function is called in Init-Step2 for global objects and in Init-Step4 for core local objects.
+/*! \brief          Checks whether an item can be read from the IOC without reading it.
+ *  \details        Used by Os_IocRefReceiveInternal() and Os_IocRefReceiveBorrow(). A data loss is reported only
+ *                  once.
  *
  *  \param[in,out]  Ioc        IOC to query. Parameter must not be NULL.
  *
+ *  \retval         OS_IOC_E_INTERNAL_OK         An item is available.
+ *  \retval         OS_IOC_E_INTERNAL_CHANNEL_CLOSED Channel closed.
+ *  \retval         OS_IOC_E_INTERNAL_CLOSE_CHANNEL Channel inconsistent. Receiver shall close channel.
+ *  \retval         OS_IOC_E_INTERNAL_NOK        An item is borrowed.
+ *  \retval         OS_IOC_E_INTERNAL_NO_DATA    The buffer is empty.
+ *  \retval         OS_IOC_E_INTERNAL_LOST_DATA  An item is available. The sender was unable to write all data to the
+ *                                            IOC because of a buffer overflow.
+ *  \retval         OS_IOC_E_INTERNAL_LOST_AND_NO_DATA Data has been lost and the queue is currently empty.
+ *
  *  \context        ANY
  *
  *  \reentrant      TRUE for different objects.
  *  \synchronous    TRUE
  *
- *  \pre            Local core is an AUTOSAR core.
- *  \pre            Concurrent access to given object is prevented by caller.
+ *  \pre            Depending on the lock type the caller has to synchronize the access to the given IOC object.
  **********************************************************************************************************************/
-OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE, Os_IocWriteInit,
+OS_FUNC_ATTRIBUTE_DECLARATION(
+OS_LOCAL_INLINE Os_IocInternalReturnType, OS_CODE, OS_ALWAYS_INLINE, Os_IocRefReceiveCheck,
 (
-  P2CONST(Os_IocWriteConfigType, TYPEDEF, OS_CONST) Ioc
+  P2CONST(Os_IocRefReceiveConfigType, TYPEDEF, OS_CONST) Ioc
 ));
 
 
 /***********************************************************************************************************************
- *  Os_IocIoc2Ioc08MultiReceive()
+ *  Os_IocReceiveElement()
  **********************************************************************************************************************/
-/*! \brief          Returns the Ioc08MultiReceive corresponding to an Ioc.
- *  \details        --no details--
+/*! \brief          Receives one element of a multi element receive into Data[Idx].
+ *  \details        Dispatches to the internal receive function of the given sub class.
  *
- *  \param[in]      Ioc     IOC to translate. Parameter must not be NULL and must be of type Ioc08MultiReceive.
+ *  \param[in,out]  Ioc        Base class object of the receiver. Parameter must not be NULL.
+ *  \param[in]      SubClass   Sub class of Ioc. Must be Ioc08Receive, Ioc16Receive or Ioc32Receive.
+ *  \param[out]     Data       Array of elements of the sub class element type. Parameter must not be NULL.
+ *  \param[in]      Idx        Index of the element within Data.
  *
- *  \return         The Ioc08MultiReceive corresponding to the given Ioc.
+ *  \return         See Os_Ioc08ReceiveInternal().
  *
  *  \context        ANY
  *
- *  \reentrant      TRUE
+ *  \reentrant      TRUE for different objects.
  *  \synchronous    TRUE
  *
- *  \pre            -
+ *  \pre            Depending on the lock type the caller has to synchronize the access to the given IOC object.
  **********************************************************************************************************************/
 OS_FUNC_ATTRIBUTE_DECLARATION(
-OS_LOCAL_INLINE P2CONST(Os_Ioc08MultiReceiveConfigType, AUTOMATIC, OS_CONST), OS_CODE, OS_ALWAYS_INLINE,
-Os_IocIoc2Ioc08MultiReceive,
+OS_LOCAL_INLINE Os_IocInternalReturnType, OS_CODE, OS_ALWAYS_INLINE, Os_IocReceiveElement,
 (
-  P2CONST(Os_IocConfigType, AUTOMATIC, OS_CONST) Ioc
+  P2CONST(Os_IocConfigType, TYPEDEF, OS_CONST) Ioc,
+  Os_IocSubClassType SubClass,
+  P2VAR(void, TYPEDEF, AUTOMATIC) Data,
+  uint32 Idx
 ));
 
 
 /***********************************************************************************************************************
- *  Os_IocIoc2Ioc16MultiReceive()
+ *  Os_IocSendIndicesInRange()
  **********************************************************************************************************************/
-/*! \brief          Returns the Ioc16MultiReceive corresponding to an Ioc.
- *  \details        --no details--
+/*! \brief          Returns whether the write indices of the FIFO of the given sender are in range.
+ *  \details        Dispatches to the FIFO of the given sub class.
  *
- *  \param[in]      Ioc     IOC to translate. Parameter must not be NULL and must be of type Ioc16MultiReceive.
+ *  \param[in]      Ioc        Base class object of the sender. Parameter must not be NULL.
+ *  \param[in]      SubClass   Sub class of Ioc. Must be Ioc08Send, Ioc16Send or Ioc32Send.
  *
- *  \return         The Ioc16MultiReceive corresponding to the given Ioc.
+ *  \retval         !0  Indices are in range.
+ *  \retval         0   Indices are out of range.
  *
  *  \context        ANY
  *
  *  \reentrant      TRUE
  *  \synchronous    TRUE
  *
- *  \pre            -
+ *  \pre            Depending on the lock type the caller has to synchronize the access to the given IOC object.
  **********************************************************************************************************************/
 OS_FUNC_ATTRIBUTE_DECLARATION(
-OS_LOCAL_INLINE P2CONST(Os_Ioc16MultiReceiveConfigType, AUTOMATIC, OS_CONST), OS_CODE, OS_ALWAYS_INLINE,
-Os_IocIoc2Ioc16MultiReceive,
+OS_LOCAL_INLINE Os_StdReturnType, OS_CODE, OS_ALWAYS_INLINE, Os_IocSendIndicesInRange,
 (
-  P2CONST(Os_IocConfigType, AUTOMATIC, OS_CONST) Ioc
+  P2CONST(Os_IocConfigType, TYPEDEF, OS_CONST) Ioc,
+  Os_IocSubClassType SubClass
 ));
 
 
 /***********************************************************************************************************************
- *  Os_IocIoc2Ioc32MultiReceive()
+ *  Os_IocSendElement()
  **********************************************************************************************************************/
-/*! \brief          Returns the Ioc32MultiReceive corresponding to an Ioc.
- *  \details        --no details--
+/*! \brief          Writes Data[Idx] of a multi element send to the FIFO of the given sender.
+ *  \details        Dispatches to the FIFO of the given sub class.
  *
- *  \param[in]      Ioc     IOC to translate. Parameter must not be NULL and must be of type Ioc32MultiReceive.
+ *  \param[in,out]  Ioc        Base class object of the sender. Parameter must not be NULL.
+ *  \param[in]      SubClass   Sub class of Ioc. Must be Ioc08Send, Ioc16Send or Ioc32Send.
+ *  \param[in]      Data       Array of elements of the sub class element type. Parameter must not be NULL.
+ *  \param[in]      Idx        Index of the element within Data.
+ *  \param[in]      Ordered    !0 if the FIFO is accessed without lock, see Os_Fifo08Enqueue().
  *
- *  \return         The Ioc32MultiReceive corresponding to the given Ioc.
+ *  \return         See Os_Fifo08Enqueue().
  *
  *  \context        ANY
  *
- *  \reentrant      TRUE
+ *  \reentrant      TRUE for different objects.
  *  \synchronous    TRUE
  *
- *  \pre            -
+ *  \pre            Depending on the lock type the caller has to synchronize the access to the given IOC object.
  **********************************************************************************************************************/
 OS_FUNC_ATTRIBUTE_DECLARATION(
-OS_LOCAL_INLINE P2CONST(Os_Ioc32MultiReceiveConfigType, AUTOMATIC, OS_CONST), OS_CODE, OS_ALWAYS_INLINE,
-Os_IocIoc2Ioc32MultiReceive,
+OS_LOCAL_INLINE Os_FifoWriteResultType, OS_CODE, OS_ALWAYS_INLINE, Os_IocSendElement,
 (
-  P2CONST(Os_IocConfigType, AUTOMATIC, OS_CONST) Ioc
+  P2CONST(Os_IocConfigType, TYPEDEF, OS_CONST) Ioc,
+  Os_IocSubClassType SubClass,
+  P2CONST(void, TYPEDEF, AUTOMATIC) Data,
+  uint32 Idx,
+  Os_StdReturnType Ordered
 ));
 
 
 /***********************************************************************************************************************
- *  Os_IocIoc2IocRefMultiReceive()
+ *  Os_IocReceiveN()
+ **********************************************************************************************************************/
+/*! \brief          Base class implementation of Os_Ioc08ReceiveN(), Os_Ioc16ReceiveN() and Os_Ioc32ReceiveN().
+ *  \details        The sub class is passed as constant by the callers, so the dispatch is resolved at compile time.
+ *
+ *  \param[in,out]  Ioc        Receiver to read from. Parameter must not be NULL.
+ *  \param[in]      SubClass   Sub class of Ioc. Must be Ioc08Receive, Ioc16Receive or Ioc32Receive.
+ *  \param[out]     Data       Array of at least Count elements of the sub class element type.
+ *                             Parameter must not be NULL.
+ *  \param[in]      Count      Maximum number of elements to read.
+ *  \param[out]     Received   Number of elements read. Parameter must not be NULL.
+ *
+ *  \return         See Os_Ioc08ReceiveN().
+ *
+ *  \context        TASK|ISR2
+ *
+ *  \reentrant      TRUE for different objects.
+ *  \synchronous    TRUE
+ *
+ *  \pre            -
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(
+OS_LOCAL_INLINE Std_ReturnType, OS_CODE, OS_ALWAYS_INLINE, Os_IocReceiveN,
+(
+  P2CONST(Os_IocReceiveConfigType, TYPEDEF, OS_CONST) Ioc,
+  Os_IocSubClassType SubClass,
+  P2VAR(void, TYPEDEF, AUTOMATIC) Data,
+  uint32 Count,
+  P2VAR(uint32, TYPEDEF, AUTOMATIC) Received
+));
+
+
+/***********************************************************************************************************************
+ *  Os_IocSendN()
+ **********************************************************************************************************************/
+/*! \brief          Base class implementation of Os_Ioc08SendN(), Os_Ioc16SendN() and Os_Ioc32SendN().
+ *  \details        The sub class is passed as constant by the callers, so the dispatch is resolved at compile time.
+ *
+ *  \param[in,out]  Ioc        Sender to write to. Parameter must not be NULL.
+ *  \param[in]      SubClass   Sub class of Ioc. Must be Ioc08Send, Ioc16Send or Ioc32Send.
+ *  \param[in]      Data       Array of at least Count elements of the sub class element type.
+ *                             Parameter must not be NULL.
+ *  \param[in]      Count      Number of elements to write.
+ *  \param[out]     Sent       Number of elements written. Parameter must not be NULL.
+ *
+ *  \return         See Os_Ioc08SendN().
+ *
+ *  \context        TASK|ISR2
+ *
+ *  \reentrant      TRUE for different objects.
+ *  \synchronous    TRUE
+ *
+ *  \pre            -
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(
+OS_LOCAL_INLINE Std_ReturnType, OS_CODE, OS_ALWAYS_INLINE, Os_IocSendN,
+(
+  P2CONST(Os_IocSendConfigType, TYPEDEF, OS_CONST) Ioc,
+  Os_IocSubClassType SubClass,
+  P2CONST(void, TYPEDEF, AUTOMATIC) Data,
+  uint32 Count,
+  P2VAR(uint32, TYPEDEF, AUTOMATIC) Sent
+));
+
+
+/***********************************************************************************************************************
+ *  Os_IocWriteInit()
+ **********************************************************************************************************************/
+/*! \brief          Initializes an Os_IocWriteConfigType object and its parent class objects.
+ *  \details        This function is called in Init-Step2 for global objects and in Init-Step4 for core local objects.
+ *
+ *  \param[in,out]  Ioc        IOC to query. Parameter must not be NULL.
+ *
+ *  \context        ANY
+ *
+ *  \reentrant      TRUE for different objects.
+ *  \synchronous    TRUE
+ *
+ *  \pre            Local core is an AUTOSAR core.
+ *  \pre            Concurrent access to given object is prevented by caller.
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE, Os_IocWriteInit,
+(
+  P2CONST(Os_IocWriteConfigType, TYPEDEF, OS_CONST) Ioc
+));
+
+
+/***********************************************************************************************************************
+ *  Os_IocIoc2Ioc08MultiReceive()
+ **********************************************************************************************************************/
+/*! \brief          Returns the Ioc08MultiReceive corresponding to an Ioc.
+ *  \details        --no details--
+ *
+ *  \param[in]      Ioc     IOC to translate. Parameter must not be NULL and must be of type Ioc08MultiReceive.
+ *
+ *  \return         The Ioc08MultiReceive corresponding to the given Ioc.
+ *
+ *  \context        ANY
+ *
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *
+ *  \pre            -
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(
+OS_LOCAL_INLINE P2CONST(Os_Ioc08MultiReceiveConfigType, AUTOMATIC, OS_CONST), OS_CODE, OS_ALWAYS_INLINE,
+Os_IocIoc2Ioc08MultiReceive,
+(
+  P2CONST(Os_IocConfigType, AUTOMATIC, OS_CONST) Ioc
+));
+
+
+/***********************************************************************************************************************
+ *  Os_IocIoc2Ioc16MultiReceive()
+ **********************************************************************************************************************/
+/*! \brief          Returns the Ioc16MultiReceive corresponding to an Ioc.
+ *  \details        --no details--
+ *
+ *  \param[in]      Ioc     IOC to translate. Parameter must not be NULL and must be of type Ioc16MultiReceive.
+ *
+ *  \return         The Ioc16MultiReceive corresponding to the given Ioc.
+ *
+ *  \context        ANY
+ *
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *
+ *  \pre            -
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(
+OS_LOCAL_INLINE P2CONST(Os_Ioc16MultiReceiveConfigType, AUTOMATIC, OS_CONST), OS_CODE, OS_ALWAYS_INLINE,
+Os_IocIoc2Ioc16MultiReceive,
+(
+  P2CONST(Os_IocConfigType, AUTOMATIC, OS_CONST) Ioc
+));
+
+
+/***********************************************************************************************************************
+ *  Os_IocIoc2Ioc32MultiReceive()
+ **********************************************************************************************************************/
+/*! \brief          Returns the Ioc32MultiReceive corresponding to an Ioc.
+ *  \details        --no details--
+ *
+ *  \param[in]      Ioc     IOC to translate. Parameter must not be NULL and must be of type Ioc32MultiReceive.
+ *
+ *  \return         The Ioc32MultiReceive corresponding to the given Ioc.
+ *
+ *  \context        ANY
+ *
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *
+ *  \pre            -
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(
+OS_LOCAL_INLINE P2CONST(Os_Ioc32MultiReceiveConfigType, AUTOMATIC, OS_CONST), OS_CODE, OS_ALWAYS_INLINE,
+Os_IocIoc2Ioc32MultiReceive,
+(
+  P2CONST(Os_IocConfigType, AUTOMATIC, OS_CONST) Ioc
+));
+
+
+/***********************************************************************************************************************
+ *  Os_IocIoc2IocRefMultiReceive()
  **********************************************************************************************************************/
 /*! \brief          Returns the IocRefMultiReceive corresponding to an Ioc.
  *  \details        --no details--
@@ -973,6 +1480,30 @@ Os_IocIoc2IocRefMultiReceive,
 ));
 
 
+/***********************************************************************************************************************
+ *  Os_IocIoc2IocRead()
+ **********************************************************************************************************************/
+/*! \brief          Returns the IocRead corresponding to an Ioc.
+ *  \details        --no details--
+ *
+ *  \param[in]      Ioc     IOC to translate. Parameter must not be NULL and must be of type IocRead.
+ *
+ *  \return         The IocRead corresponding to the given Ioc.
+ *
+ *  \context        ANY
+ *
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *
+ *  \pre            -
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE P2CONST(Os_IocReadConfigType, AUTOMATIC, OS_CONST), OS_CODE,
+OS_ALWAYS_INLINE, Os_IocIoc2IocRead,
+(
+  P2CONST(Os_IocConfigType, AUTOMATIC, OS_CONST) Ioc
+));
+
+
 /***********************************************************************************************************************
  *  Os_IocIoc2IocWrite()
  **********************************************************************************************************************/
@@ -1287,7 +1818,7 @@ Os_IocGetAccessingApplications,
  **********************************************************************************************************************/
 
 /***********************************************************************************************************************
- *  Os_IocIoc2IocWrite()
+ *  Os_IocIoc2IocRead()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -1295,18 +1826,18 @@ Os_IocGetAccessingApplications,
  *
  */
 OS_FUNC_ATTRIBUTE_DEFINITION(
-OS_LOCAL_INLINE P2CONST(Os_IocWriteConfigType, AUTOMATIC, OS_CONST), OS_CODE, OS_ALWAYS_INLINE, Os_IocIoc2IocWrite,
+OS_LOCAL_INLINE P2CONST(Os_IocReadConfigType, AUTOMATIC, OS_CONST), OS_CODE, OS_ALWAYS_INLINE, Os_IocIoc2IocRead,
 (
   P2CONST(Os_IocConfigType, AUTOMATIC, OS_CONST) Ioc
 ))
 {
   /* #10 Perform cast on given pointer. */
-  return (P2CONST(Os_IocWriteConfigType, AUTOMATIC, OS_CONST))Ioc;                                                      /* PRQA S 0310 */ /* MD_Os_Rule11.3_0310 */
+  return (P2CONST(Os_IocReadConfigType, AUTOMATIC, OS_CONST))Ioc;                                                       /* PRQA S 0310 */ /* MD_Os_Rule11.3_0310 */
 }
 
 
 /***********************************************************************************************************************
- *  Os_IocIoc2Ioc08Receive()
+ *  Os_IocIoc2IocWrite()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -1314,130 +1845,407 @@ OS_LOCAL_INLINE P2CONST(Os_IocWriteConfigType, AUTOMATIC, OS_CONST), OS_CODE, OS
  *
  */
 OS_FUNC_ATTRIBUTE_DEFINITION(
-OS_LOCAL_INLINE P2CONST(Os_Ioc08ReceiveConfigType, AUTOMATIC, OS_CONST), OS_CODE, OS_ALWAYS_INLINE,
-Os_IocIoc2Ioc08Receive,
+OS_LOCAL_INLINE P2CONST(Os_IocWriteConfigType, AUTOMATIC, OS_CONST), OS_CODE, OS_ALWAYS_INLINE, Os_IocIoc2IocWrite,
 (
   P2CONST(Os_IocConfigType, AUTOMATIC, OS_CONST) Ioc
 ))
 {
   /* #10 Perform cast on given pointer. */
-  return (P2CONST(Os_Ioc08ReceiveConfigType, AUTOMATIC, OS_CONST))Ioc;                                                  /* PRQA S 0310 */ /* MD_Os_Rule11.3_0310 */
+  return (P2CONST(Os_IocWriteConfigType, AUTOMATIC, OS_CONST))Ioc;                                                      /* PRQA S 0310 */ /* MD_Os_Rule11.3_0310 */
 }
 
 
 /***********************************************************************************************************************
- *  Os_IocIoc2Ioc16Receive()
+ *  Os_IocNotifyReceiver()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
  *
  *
  */
-OS_FUNC_ATTRIBUTE_DEFINITION(
-OS_LOCAL_INLINE P2CONST(Os_Ioc16ReceiveConfigType, AUTOMATIC, OS_CONST), OS_CODE, OS_ALWAYS_INLINE,
-Os_IocIoc2Ioc16Receive,
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE, Os_IocNotifyReceiver,
 (
-  P2CONST(Os_IocConfigType, AUTOMATIC, OS_CONST) Ioc
+  P2CONST(Os_IocSendConfigType, AUTOMATIC, OS_CONST) Ioc
 ))
 {
-  /* #10 Perform cast on given pointer. */
-  return (P2CONST(Os_Ioc16ReceiveConfigType, AUTOMATIC, OS_CONST))Ioc;                                                  /* PRQA S 0310 */ /* MD_Os_Rule11.3_0310 */
+  /* #10 If the sender belongs to a multiple receive IOC with ready mask, mark the channel. */
+  if(Ioc->MultiReceive != NULL_PTR)
+  {
+    if(Os_IocMultiReceiveUsesReadyMask(Ioc->MultiReceive) != 0u)                                                        /* SBSW_OS_FC_PRECONDITION */
+    {
+      Os_Hal_BitFieldSetAtomic(&(Os_IocMultiReceiveGetDyn(Ioc->MultiReceive)->ReadyMask), Ioc->ReadyBit);               /* SBSW_OS_IOC_IOCMULTIRECEIVEGETDYN_002 */
+    }
+  }
 }
 
 
 /***********************************************************************************************************************
- *  Os_IocIoc2Ioc32Receive()
+ *  Os_IocMultiReceiveUsesReadyMask()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
  *
  *
  */
-OS_FUNC_ATTRIBUTE_DEFINITION(
-OS_LOCAL_INLINE P2CONST(Os_Ioc32ReceiveConfigType, AUTOMATIC, OS_CONST), OS_CODE, OS_ALWAYS_INLINE,
-Os_IocIoc2Ioc32Receive,
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE Os_StdReturnType, OS_CODE, OS_ALWAYS_INLINE,
+Os_IocMultiReceiveUsesReadyMask,
 (
-  P2CONST(Os_IocConfigType, AUTOMATIC, OS_CONST) Ioc
+  P2CONST(Os_IocMultiReceiveConfigType, AUTOMATIC, OS_CONST) Ioc
 ))
 {
-  /* #10 Perform cast on given pointer. */
-  return (P2CONST(Os_Ioc32ReceiveConfigType, AUTOMATIC, OS_CONST))Ioc;                                                  /* PRQA S 0310 */ /* MD_Os_Rule11.3_0310 */
+  return (Os_StdReturnType)(Ioc->UsesReadyMask != FALSE);                                                               /* PRQA S 4304 */ /* MD_Os_C90BooleanCompatibility */
 }
 
 
 /***********************************************************************************************************************
- *  Os_IocIoc2IocRefReceive()
+ *  Os_IocMultiReceiveReadyBit()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
  *
  *
  */
-OS_FUNC_ATTRIBUTE_DEFINITION(
-OS_LOCAL_INLINE P2CONST(Os_IocRefReceiveConfigType, AUTOMATIC, OS_CONST), OS_CODE, OS_ALWAYS_INLINE,
-Os_IocIoc2IocRefReceive,
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE Os_BitFieldType, OS_CODE, OS_ALWAYS_INLINE,
+Os_IocMultiReceiveReadyBit,
 (
-  P2CONST(Os_IocConfigType, AUTOMATIC, OS_CONST) Ioc
+  Os_ObjIdx_IteratorType Channel
 ))
 {
-  /* #10 Perform cast on given pointer. */
-  return (P2CONST(Os_IocRefReceiveConfigType, AUTOMATIC, OS_CONST))Ioc;                                                 /* PRQA S 0310 */ /* MD_Os_Rule11.3_0310 */
+  return (Os_BitFieldType)(OS_BITFIELD_MASK_MSB >> Channel);
 }
 
 
 /***********************************************************************************************************************
- *  Os_IocIoc2Ioc08MultiReceive()
+ *  Os_IocMultiReceiveNextReady()
  **********************************************************************************************************************/
-OS_FUNC_ATTRIBUTE_DEFINITION(
-OS_LOCAL_INLINE P2CONST(Os_Ioc08MultiReceiveConfigType, AUTOMATIC, OS_CONST), OS_CODE, OS_ALWAYS_INLINE,
-Os_IocIoc2Ioc08MultiReceive,
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE Os_ObjIdx_IteratorType, OS_CODE, OS_ALWAYS_INLINE,
+Os_IocMultiReceiveNextReady,
 (
-  P2CONST(Os_IocConfigType, AUTOMATIC, OS_CONST) Ioc
+  P2CONST(Os_IocMultiReceiveConfigType, AUTOMATIC, OS_CONST) Ioc,
+  Os_BitFieldType Pending
 ))
 {
-  return (P2CONST(Os_Ioc08MultiReceiveConfigType, AUTOMATIC, OS_CONST))Ioc;                                             /* PRQA S 0310 */ /* MD_Os_Rule11.3_0310 */
-}
+  Os_BitFieldType candidates;
+  Os_ObjIdx_IteratorType start;
 
+  start = (Os_ObjIdx_IteratorType)Os_IocMultiReceiveGetDyn(Ioc)->NextReceiveChannel;                                    /* SBSW_OS_FC_PRECONDITION */
 
-/***********************************************************************************************************************
- *  Os_IocIoc2Ioc16MultiReceive()
- **********************************************************************************************************************/
-OS_FUNC_ATTRIBUTE_DEFINITION(
-OS_LOCAL_INLINE P2CONST(Os_Ioc16MultiReceiveConfigType, AUTOMATIC, OS_CONST), OS_CODE, OS_ALWAYS_INLINE,
-Os_IocIoc2Ioc16MultiReceive,
-(
-  P2CONST(Os_IocConfigType, AUTOMATIC, OS_CONST) Ioc
-))
-{
-  return (P2CONST(Os_Ioc16MultiReceiveConfigType, AUTOMATIC, OS_CONST))Ioc;                                             /* PRQA S 0310 */ /* MD_Os_Rule11.3_0310 */
+  /* #10 Prefer the marked channels from the start position on. */
+  candidates = Pending & (Os_BitFieldType)(((Os_BitFieldType)(~(Os_BitFieldType)0u)) >> start);
+
+  /* #20 If there is none, wrap around to the first marked channel. */
+  if(candidates == 0u)
+  {
+    candidates = Pending;
+  }
+
+  /* #30 The number of leading zeros is the channel index. */
+  return (Os_ObjIdx_IteratorType)Os_Bit_CountLeadingZeros(candidates);
 }
 
 
 /***********************************************************************************************************************
- *  Os_IocIoc2Ioc32MultiReceive()
+ *  Os_IocMultiReceiveChannel()
  **********************************************************************************************************************/
-OS_FUNC_ATTRIBUTE_DEFINITION(
-OS_LOCAL_INLINE P2CONST(Os_Ioc32MultiReceiveConfigType, AUTOMATIC, OS_CONST), OS_CODE, OS_ALWAYS_INLINE,
-Os_IocIoc2Ioc32MultiReceive,
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE Os_IocInternalReturnType, OS_CODE, OS_ALWAYS_INLINE,
+Os_IocMultiReceiveChannel,
 (
-  P2CONST(Os_IocConfigType, AUTOMATIC, OS_CONST) Ioc
+  P2CONST(Os_IocMultiReceiveConfigType, AUTOMATIC, OS_CONST) Ioc,
+  Os_IocSubClassType SubClass,
+  Os_ObjIdx_IteratorType Channel,
+  P2VAR(void, TYPEDEF, AUTOMATIC) Data
 ))
 {
-  return (P2CONST(Os_Ioc32MultiReceiveConfigType, AUTOMATIC, OS_CONST))Ioc;                                             /* PRQA S 0310 */ /* MD_Os_Rule11.3_0310 */
+  Os_IocInternalReturnType status = OS_IOC_E_INTERNAL_NOK;
+
+  /* #10 Call the internal receive function of the sub class with the receiver of the channel. */
+  switch(SubClass)
+  {
+    case Ioc08MultiReceive:
+      status = Os_Ioc08ReceiveInternal(                                                                                 /* SBSW_OS_IOC_IOC08RECEIVEINTERNAL_001 */
+          &(Os_IocIoc2Ioc08MultiReceive(&(Ioc->Base))->Receivers[Channel]),
+          (P2VAR(uint8, AUTOMATIC, AUTOMATIC))Data                                                                      /* PRQA S 0316 */ /* MD_Os_Rule11.5_0316 */
+      );
+      break;
+
+    case Ioc16MultiReceive:
+      status = Os_Ioc16ReceiveInternal(                                                                                 /* SBSW_OS_IOC_IOC16RECEIVEINTERNAL_001 */
+          &(Os_IocIoc2Ioc16MultiReceive(&(Ioc->Base))->Receivers[Channel]),
+          (P2VAR(uint16, AUTOMATIC, AUTOMATIC))Data                                                                     /* PRQA S 0316 */ /* MD_Os_Rule11.5_0316 */
+      );
+      break;
+
+    case Ioc32MultiReceive:
+      status = Os_Ioc32ReceiveInternal(                                                                                 /* SBSW_OS_IOC_IOC32RECEIVEINTERNAL_001 */
+          &(Os_IocIoc2Ioc32MultiReceive(&(Ioc->Base))->Receivers[Channel]),
+          (P2VAR(uint32, AUTOMATIC, AUTOMATIC))Data                                                                     /* PRQA S 0316 */ /* MD_Os_Rule11.5_0316 */
+      );
+      break;
+
+    case IocRefMultiReceive:
+      status = Os_IocRefReceiveInternal(                                                                                /* SBSW_OS_IOC_IOCREFRECEIVEINTERNAL_001 */
+          &(Os_IocIoc2IocRefMultiReceive(&(Ioc->Base))->Receivers[Channel]),
+          Data
+      );
+      break;
+
+    default:                                                                                                            /* COV_OS_INVSTATE */
+      /* cannot be reached as the SubClass parameter is set by module internal caller only */
+      Os_ErrKernelPanic();
+      break;                                                                                                            /* PRQA S 2880 */ /* MD_Os_Rule2.1_2880_NonReturning */
+  }
+
+  return status;
 }
 
 
 /***********************************************************************************************************************
- *  Os_IocIoc2IocRefMultiReceive()
+ *  Os_IocMultiReceiveChannelIsEmpty()
  **********************************************************************************************************************/
-OS_FUNC_ATTRIBUTE_DEFINITION(
-OS_LOCAL_INLINE P2CONST(Os_IocRefMultiReceiveConfigType, AUTOMATIC, OS_CONST), OS_CODE, OS_ALWAYS_INLINE,
-Os_IocIoc2IocRefMultiReceive,
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE Os_StdReturnType, OS_CODE, OS_ALWAYS_INLINE,
+Os_IocMultiReceiveChannelIsEmpty,
 (
-  P2CONST(Os_IocConfigType, AUTOMATIC, OS_CONST) Ioc
+  P2CONST(Os_IocMultiReceiveConfigType, AUTOMATIC, OS_CONST) Ioc,
+  Os_IocSubClassType SubClass,
+  Os_ObjIdx_IteratorType Channel
 ))
 {
-  return (P2CONST(Os_IocRefMultiReceiveConfigType, AUTOMATIC, OS_CONST))Ioc;                                            /* PRQA S 0310 */ /* MD_Os_Rule11.3_0310 */
+  Os_StdReturnType result = !0u;                                                                                        /* PRQA S 4404, 4558 */ /* MD_Os_C90BooleanCompatibility, MD_Os_Rule10.1_4558 */
+
+  /* #10 Query the FIFO of the receiver of the channel. */
+  switch(SubClass)
+  {
+    case Ioc08MultiReceive:
+      result = Os_Fifo08IsEmpty(&(Os_IocIoc2Ioc08MultiReceive(&(Ioc->Base))->Receivers[Channel].FifoRead));             /* SBSW_OS_IOC_IOC08RECEIVEINTERNAL_001 */
+      break;
+
+    case Ioc16MultiReceive:
+      result = Os_Fifo16IsEmpty(&(Os_IocIoc2Ioc16MultiReceive(&(Ioc->Base))->Receivers[Channel].FifoRead));             /* SBSW_OS_IOC_IOC16RECEIVEINTERNAL_001 */
+      break;
+
+    case Ioc32MultiReceive:
+      result = Os_Fifo32IsEmpty(&(Os_IocIoc2Ioc32MultiReceive(&(Ioc->Base))->Receivers[Channel].FifoRead));             /* SBSW_OS_IOC_IOC32RECEIVEINTERNAL_001 */
+      break;
+
+    case IocRefMultiReceive:
+      result = Os_FifoRefIsEmpty(&(Os_IocIoc2IocRefMultiReceive(&(Ioc->Base))->Receivers[Channel].FifoRead));           /* SBSW_OS_IOC_IOCREFRECEIVEINTERNAL_001 */
+      break;
+
+    default:                                                                                                            /* COV_OS_INVSTATE */
+      /* cannot be reached as the SubClass parameter is set by module internal caller only */
+      Os_ErrKernelPanic();
+      break;                                                                                                            /* PRQA S 2880 */ /* MD_Os_Rule2.1_2880_NonReturning */
+  }
+
+  return result;
+}
+
+
+/***********************************************************************************************************************
+ *  Os_IocMultiReceiveReady()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE Os_IocInternalReturnType, OS_CODE, OS_ALWAYS_INLINE,
+Os_IocMultiReceiveReady,
+(
+  P2CONST(Os_IocMultiReceiveConfigType, AUTOMATIC, OS_CONST) Ioc,
+  Os_IocSubClassType SubClass,
+  P2VAR(void, TYPEDEF, AUTOMATIC) Data
+))
+{
+  P2VAR(Os_IocMultiReceiveType volatile, AUTOMATIC, TYPEDEF) dyn;
+  Os_IocInternalReturnType status = OS_IOC_E_INTERNAL_NO_DATA;
+  Os_BitFieldType pending;
+  Os_ObjIdx_IteratorType channel;
+
+  dyn = Os_IocMultiReceiveGetDyn(Ioc);                                                                                  /* SBSW_OS_FC_PRECONDITION */
+  pending = dyn->ReadyMask;
+
+  /* #10 Until data is found, visit the next marked channel in round robin order. */
+  while((status == OS_IOC_E_INTERNAL_NO_DATA) && (pending != 0u))
+  {
+    channel = Os_IocMultiReceiveNextReady(Ioc, pending);                                                                /* SBSW_OS_FC_PRECONDITION */
+    pending &= (Os_BitFieldType)(~Os_IocMultiReceiveReadyBit(channel));
+
+    /* #20 Unmark the channel before reading it, so that data written concurrently marks it again. */
+    Os_Hal_BitFieldClearAtomic(&(dyn->ReadyMask), Os_IocMultiReceiveReadyBit(channel));                                 /* SBSW_OS_IOC_IOCMULTIRECEIVEGETDYN_001 */
+    status = Os_IocMultiReceiveChannel(Ioc, SubClass, channel, Data);                                                   /* SBSW_OS_FC_PRECONDITION */
+
+    /* #30 If data has been received, continue with the next channel on the next call. Mark the channel again, if
+     *     it still contains data. */
+    if(Os_IocIsDataReceived(status) != 0u)
+    {
+      dyn->NextReceiveChannel = (Os_ObjIdxType)channel;                                                                 /* SBSW_OS_IOC_IOCMULTIRECEIVEGETDYN_001 */
+      if(Os_IocMultiReceiveChannelIsEmpty(Ioc, SubClass, channel) == 0u)                                                /* SBSW_OS_FC_PRECONDITION */
+      {
+        Os_Hal_BitFieldSetAtomic(&(dyn->ReadyMask), Os_IocMultiReceiveReadyBit(channel));                               /* SBSW_OS_IOC_IOCMULTIRECEIVEGETDYN_001 */
+      }
+    }
+  }
+
+  return status;
+}
+
+
+/***********************************************************************************************************************
+ *  Os_IocIoc2Ioc08Receive()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(
+OS_LOCAL_INLINE P2CONST(Os_Ioc08ReceiveConfigType, AUTOMATIC, OS_CONST), OS_CODE, OS_ALWAYS_INLINE,
+Os_IocIoc2Ioc08Receive,
+(
+  P2CONST(Os_IocConfigType, AUTOMATIC, OS_CONST) Ioc
+))
+{
+  /* #10 Perform cast on given pointer. */
+  return (P2CONST(Os_Ioc08ReceiveConfigType, AUTOMATIC, OS_CONST))Ioc;                                                  /* PRQA S 0310 */ /* MD_Os_Rule11.3_0310 */
+}
+
+
+/***********************************************************************************************************************
+ *  Os_IocIoc2Ioc16Receive()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(
+OS_LOCAL_INLINE P2CONST(Os_Ioc16ReceiveConfigType, AUTOMATIC, OS_CONST), OS_CODE, OS_ALWAYS_INLINE,
+Os_IocIoc2Ioc16Receive,
+(
+  P2CONST(Os_IocConfigType, AUTOMATIC, OS_CONST) Ioc
+))
+{
+  /* #10 Perform cast on given pointer. */
+  return (P2CONST(Os_Ioc16ReceiveConfigType, AUTOMATIC, OS_CONST))Ioc;                                                  /* PRQA S 0310 */ /* MD_Os_Rule11.3_0310 */
+}
+
+
+/***********************************************************************************************************************
+ *  Os_IocIoc2Ioc32Receive()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(
+OS_LOCAL_INLINE P2CONST(Os_Ioc32ReceiveConfigType, AUTOMATIC, OS_CONST), OS_CODE, OS_ALWAYS_INLINE,
+Os_IocIoc2Ioc32Receive,
+(
+  P2CONST(Os_IocConfigType, AUTOMATIC, OS_CONST) Ioc
+))
+{
+  /* #10 Perform cast on given pointer. */
+  return (P2CONST(Os_Ioc32ReceiveConfigType, AUTOMATIC, OS_CONST))Ioc;                                                  /* PRQA S 0310 */ /* MD_Os_Rule11.3_0310 */
+}
+
+
+/***********************************************************************************************************************
+ *  Os_IocIoc2IocRefReceive()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(
+OS_LOCAL_INLINE P2CONST(Os_IocRefReceiveConfigType, AUTOMATIC, OS_CONST), OS_CODE, OS_ALWAYS_INLINE,
+Os_IocIoc2IocRefReceive,
+(
+  P2CONST(Os_IocConfigType, AUTOMATIC, OS_CONST) Ioc
+))
+{
+  /* #10 Perform cast on given pointer. */
+  return (P2CONST(Os_IocRefReceiveConfigType, AUTOMATIC, OS_CONST))Ioc;                                                 /* PRQA S 0310 */ /* MD_Os_Rule11.3_0310 */
+}
+
+
+/***********************************************************************************************************************
+ *  Os_IocIoc2Ioc08MultiReceive()
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DEFINITION(
+OS_LOCAL_INLINE P2CONST(Os_Ioc08MultiReceiveConfigType, AUTOMATIC, OS_CONST), OS_CODE, OS_ALWAYS_INLINE,
+Os_IocIoc2Ioc08MultiReceive,
+(
+  P2CONST(Os_IocConfigType, AUTOMATIC, OS_CONST) Ioc
+))
+{
+  return (P2CONST(Os_Ioc08MultiReceiveConfigType, AUTOMATIC, OS_CONST))Ioc;                                             /* PRQA S 0310 */ /* MD_Os_Rule11.3_0310 */
+}
+
+
+/***********************************************************************************************************************
+ *  Os_IocIoc2Ioc16MultiReceive()
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DEFINITION(
+OS_LOCAL_INLINE P2CONST(Os_Ioc16MultiReceiveConfigType, AUTOMATIC, OS_CONST), OS_CODE, OS_ALWAYS_INLINE,
+Os_IocIoc2Ioc16MultiReceive,
+(
+  P2CONST(Os_IocConfigType, AUTOMATIC, OS_CONST) Ioc
+))
+{
+  return (P2CONST(Os_Ioc16MultiReceiveConfigType, AUTOMATIC, OS_CONST))Ioc;                                             /* PRQA S 0310 */ /* MD_Os_Rule11.3_0310 */
+}
+
+
+/***********************************************************************************************************************
+ *  Os_IocIoc2Ioc32MultiReceive()
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DEFINITION(
+OS_LOCAL_INLINE P2CONST(Os_Ioc32MultiReceiveConfigType, AUTOMATIC, OS_CONST), OS_CODE, OS_ALWAYS_INLINE,
+Os_IocIoc2Ioc32MultiReceive,
+(
+  P2CONST(Os_IocConfigType, AUTOMATIC, OS_CONST) Ioc
+))
+{
+  return (P2CONST(Os_Ioc32MultiReceiveConfigType, AUTOMATIC, OS_CONST))Ioc;                                             /* PRQA S 0310 */ /* MD_Os_Rule11.3_0310 */
+}
+
+
+/***********************************************************************************************************************
+ *  Os_IocIoc2IocRefMultiReceive()
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DEFINITION(
+OS_LOCAL_INLINE P2CONST(Os_IocRefMultiReceiveConfigType, AUTOMATIC, OS_CONST), OS_CODE, OS_ALWAYS_INLINE,
+Os_IocIoc2IocRefMultiReceive,
+(
+  P2CONST(Os_IocConfigType, AUTOMATIC, OS_CONST) Ioc
+))
+{
+  return (P2CONST(Os_IocRefMultiReceiveConfigType, AUTOMATIC, OS_CONST))Ioc;                                            /* PRQA S 0310 */ /* MD_Os_Rule11.3_0310 */
 }
 
 
@@ -1532,9 +2340,14 @@ FUNC(void, OS_CODE) Os_IocInitInternal
   {
     Os_ErrKernelPanic();
   }
+  /* #20 If the lock mode is not supported by the sub class: KernelPanic. */
+  else if(Os_IocLockModeIsValid(Ioc) == 0u)                                                                             /* SBSW_OS_FC_PRECONDITION */ /* COV_OS_INVSTATE */
+  {
+    Os_ErrKernelPanic();
+  }
   else
   {
-    /* #20 Otherwise, call initialization functions of sub classes */
+    /* #30 Otherwise, call initialization functions of sub classes */
     switch(Ioc->SubClass)
     {
       case Ioc08Receive:
@@ -1677,6 +2490,15 @@ OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE, Os
   Os_IocInitBase(&(Ioc->Base));                                                                                         /* SBSW_OS_FC_PRECONDITION */
 
   Os_IocMultiReceiveGetDyn(Ioc)->NextReceiveChannel = 0;                                                                /* SBSW_OS_FC_PRECONDITION */ /* SBSW_OS_IOC_IOCMULTIRECEIVEGETDYN_001 */
+
+  Os_IocMultiReceiveGetDyn(Ioc)->ReadyMask = 0u;                                                                        /* SBSW_OS_FC_PRECONDITION */ /* SBSW_OS_IOC_IOCMULTIRECEIVEGETDYN_001 */
+
+  /* #20 If the ready mask is used but cannot represent all channels: KernelPanic. */
+  if(OS_UNLIKELY((Os_IocMultiReceiveUsesReadyMask(Ioc) != 0u)                                                           /* SBSW_OS_FC_PRECONDITION */ /* COV_OS_INVSTATE */
+              && (Ioc->ReceiveChannelCount > (Os_ObjIdxType)OS_BITFIELD_BITWIDTH)))
+  {
+    Os_ErrKernelPanic();
+  }
 }
 
 
@@ -1887,6 +2709,7 @@ OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE, Os
   switch(Ioc->LockMode)
   {
     case OS_IOCLOCKMODE_NONE:
+    case OS_IOCLOCKMODE_LOCKFREE:
       /* Do nothing. */
       break;
 
@@ -1931,6 +2754,7 @@ OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE, Os
   switch(Ioc->LockMode)
   {
     case OS_IOCLOCKMODE_NONE:
+    case OS_IOCLOCKMODE_LOCKFREE:
       /* Do nothing. */
       break;
 
@@ -1958,98 +2782,213 @@ OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE, Os
 
 
 /***********************************************************************************************************************
- *  Os_IocCallCallbacks()
+ *  Os_IocIsLockFree()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
  *
  *
- *
- *
  */
-OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE Std_ReturnType, OS_CODE, OS_ALWAYS_INLINE, Os_IocCallCallbacks,
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE Os_StdReturnType, OS_CODE, OS_ALWAYS_INLINE, Os_IocIsLockFree,
 (
-  P2CONST(Os_IocCallbacksConfigType, TYPEDEF, OS_CONST) Callbacks
+  P2CONST(Os_IocConfigType, TYPEDEF, OS_CONST) Ioc
 ))
 {
-  Std_ReturnType result;
-  boolean callFailed = FALSE;
-
-  /* #10 Check whether callbacks are enabled. */
-  if (Os_IocHasCallbacks() != 0u)                                                                                       /* PRQA S 2991, 2995 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule2.2_2995 */
-  {
-    Os_HookIdType index;
-
-    /* #20 Call each configured callback. */
-    for(index = (Os_HookIdType)0; index < Callbacks->CallbackCount; index++)
-    {
-      if(OS_UNLIKELY(Os_HookCallCallback(Callbacks->CallbackRefs[index]) != OS_STATUS_OK))                              /* SBSW_OS_IOC_HOOKCALLCALLBACK_001 */
-      {
-        callFailed = TRUE;
-      }
-    }
-  }
-
-  /* #30 Returns IOC_E_NOK, if at least one of the callbacks is not successfully triggered. */
-  if(OS_LIKELY(callFailed == FALSE))                                                                                    /* COMP_WARN_OS_CW_005 */
-  {
-    result = IOC_E_OK;
-  }
-  else
-  {
-    result = IOC_E_NOK;
-  }
-
-  return result;
+  return (Os_StdReturnType)(Ioc->LockMode == OS_IOCLOCKMODE_LOCKFREE);                                                  /* PRQA S 4304 */ /* MD_Os_C90BooleanCompatibility */
 }
 
 
 /***********************************************************************************************************************
- *  Os_IocCheckNoDataLost()
+ *  Os_IocLocksInterrupts()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
  *
  *
- *
- *
- *
  */
-OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE Os_StdReturnType, OS_CODE, OS_ALWAYS_INLINE, Os_IocCheckNoDataLost,
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE Os_StdReturnType, OS_CODE, OS_ALWAYS_INLINE, Os_IocLocksInterrupts,
 (
-  P2CONST(Os_IocReceiveConfigType, TYPEDEF, OS_CONST) Ioc
+  P2CONST(Os_IocConfigType, TYPEDEF, OS_CONST) Ioc
 ))
 {
-  P2VAR(Os_IocReceiveType volatile, AUTOMATIC, TYPEDEF) receiverDyn;
-  P2CONST(Os_IocSendType volatile, AUTOMATIC, TYPEDEF) senderDyn;
-  Os_StdReturnType result;
-  Os_IocLostCounterType lostCounter;
-
-  receiverDyn = Os_IocReceiveGetDyn(Ioc);                                                                               /* SBSW_OS_FC_PRECONDITION */
-  senderDyn = Os_IocSendGetDyn(Ioc->Send);                                                                              /* SBSW_OS_IOC_IOCSENDGETDYN_001 */
-
-  lostCounter = senderDyn->LostCounter;
-
-  /* #10 If the lost counter did not change since the last check, return no data lost. */
-  if(lostCounter == receiverDyn->LostCounterSnapshot)
-  {
-    result = !OS_CHECK_FAILED;                                                                                          /* PRQA S 4404, 4558 */  /* MD_Os_C90BooleanCompatibility, MD_Os_Rule10.1_4558 */
-  }
-  /* #20 Otherwise: */
-  else
-  {
-    /* #30 Update the lost counter snapshot. */
-    receiverDyn->LostCounterSnapshot = lostCounter;                                                                     /* SBSW_OS_IOC_IOCRECEIVEGETDYN_001 */
-
-    /* #40 Return data lost. */
-    result = OS_CHECK_FAILED;
-  }
-  return result;
+  return (Os_StdReturnType)((Ioc->LockMode == OS_IOCLOCKMODE_INTERRUPTS) || (Ioc->LockMode == OS_IOCLOCKMODE_ALL));     /* PRQA S 4304 */ /* MD_Os_C90BooleanCompatibility */
 }
 
 
 /***********************************************************************************************************************
- *  Os_IocIncrementLostCounter()
+ *  Os_IocLockModeIsValid()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE Os_StdReturnType, OS_CODE, OS_ALWAYS_INLINE, Os_IocLockModeIsValid,
+(
+  P2CONST(Os_IocConfigType, TYPEDEF, OS_CONST) Ioc
+))
+{
+  Os_StdReturnType result = !0u;                                                                                        /* PRQA S 4404, 4558 */ /* MD_Os_C90BooleanCompatibility, MD_Os_Rule10.1_4558 */
+
+  /* #10 If the IOC is lock-free: */
+  if(Os_IocIsLockFree(Ioc) != 0u)                                                                                       /* SBSW_OS_FC_PRECONDITION */
+  {
+    /* #20 Senders are supported, if they do not feed an N:1 channel. */
+    /* #30 Receivers are supported, if their sender does not feed an N:1 channel. */
+    /* #40 Other sub classes are not supported. */
+    switch(Ioc->SubClass)
+    {
+      case Ioc08Send:
+        result = (Os_StdReturnType)(Os_IocIoc2Ioc08Send(Ioc)->Ioc.MultiReceive == NULL_PTR);                            /* PRQA S 4304 */ /* MD_Os_C90BooleanCompatibility */ /* SBSW_OS_FC_PRECONDITION */
+        break;
+      case Ioc16Send:
+        result = (Os_StdReturnType)(Os_IocIoc2Ioc16Send(Ioc)->Ioc.MultiReceive == NULL_PTR);                            /* PRQA S 4304 */ /* MD_Os_C90BooleanCompatibility */ /* SBSW_OS_FC_PRECONDITION */
+        break;
+      case Ioc32Send:
+        result = (Os_StdReturnType)(Os_IocIoc2Ioc32Send(Ioc)->Ioc.MultiReceive == NULL_PTR);                            /* PRQA S 4304 */ /* MD_Os_C90BooleanCompatibility */ /* SBSW_OS_FC_PRECONDITION */
+        break;
+      case IocRefSend:
+        result = (Os_StdReturnType)(Os_IocIoc2IocRefSend(Ioc)->Ioc.MultiReceive == NULL_PTR);                           /* PRQA S 4304 */ /* MD_Os_C90BooleanCompatibility */ /* SBSW_OS_FC_PRECONDITION */
+        break;
+      case Ioc08Receive:
+        result = (Os_StdReturnType)(Os_IocIoc2Ioc08Receive(Ioc)->Ioc.Send->MultiReceive == NULL_PTR);                   /* PRQA S 4304 */ /* MD_Os_C90BooleanCompatibility */ /* SBSW_OS_FC_PRECONDITION */
+        break;
+      case Ioc16Receive:
+        result = (Os_StdReturnType)(Os_IocIoc2Ioc16Receive(Ioc)->Ioc.Send->MultiReceive == NULL_PTR);                   /* PRQA S 4304 */ /* MD_Os_C90BooleanCompatibility */ /* SBSW_OS_FC_PRECONDITION */
+        break;
+      case Ioc32Receive:
+        result = (Os_StdReturnType)(Os_IocIoc2Ioc32Receive(Ioc)->Ioc.Send->MultiReceive == NULL_PTR);                   /* PRQA S 4304 */ /* MD_Os_C90BooleanCompatibility */ /* SBSW_OS_FC_PRECONDITION */
+        break;
+      case IocRefReceive:
+        result = (Os_StdReturnType)(Os_IocIoc2IocRefReceive(Ioc)->Ioc.Send->MultiReceive == NULL_PTR);                  /* PRQA S 4304 */ /* MD_Os_C90BooleanCompatibility */ /* SBSW_OS_FC_PRECONDITION */
+        break;
+      default:
+        result = 0u;
+        break;
+    }
+  }
+  /* #50 If the IOC is a writer with sequence counter, it has to lock interrupts, so that no reader preempts it. */
+  else if(Ioc->SubClass == IocWrite)
+  {
+    if(Os_IocIoc2IocWrite(Ioc)->Sequence != NULL_PTR)                                                                   /* SBSW_OS_FC_PRECONDITION */
+    {
+      result = Os_IocLocksInterrupts(Ioc);                                                                              /* SBSW_OS_FC_PRECONDITION */
+    }
+  }
+  /* #60 If the IOC is a reader with sequence counter, it has to lock interrupts, so that no other reader on its core
+   *     uses the snapshot buffer meanwhile, and it needs a snapshot buffer. */
+  else if(Ioc->SubClass == IocRead)
+  {
+    if(Os_IocIoc2IocRead(Ioc)->Sequence != NULL_PTR)                                                                    /* SBSW_OS_FC_PRECONDITION */
+    {
+      result = (Os_StdReturnType)((Os_IocLocksInterrupts(Ioc) != 0u)                                                    /* PRQA S 4304 */ /* MD_Os_C90BooleanCompatibility */ /* SBSW_OS_FC_PRECONDITION */
+                 && (Os_IocIoc2IocRead(Ioc)->Snapshot != NULL_PTR));
+    }
+  }
+  else
+  {
+    /* Other lock modes are supported by all sub classes. MISRA 14.10 */
+  }
+
+  return result;
+}
+
+
+/***********************************************************************************************************************
+ *  Os_IocCallCallbacks()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE Std_ReturnType, OS_CODE, OS_ALWAYS_INLINE, Os_IocCallCallbacks,
+(
+  P2CONST(Os_IocCallbacksConfigType, TYPEDEF, OS_CONST) Callbacks
+))
+{
+  Std_ReturnType result;
+  boolean callFailed = FALSE;
+
+  /* #10 Check whether callbacks are enabled. */
+  if (Os_IocHasCallbacks() != 0u)                                                                                       /* PRQA S 2991, 2995 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule2.2_2995 */
+  {
+    Os_HookIdType index;
+
+    /* #20 Call each configured callback. */
+    for(index = (Os_HookIdType)0; index < Callbacks->CallbackCount; index++)
+    {
+      if(OS_UNLIKELY(Os_HookCallCallback(Callbacks->CallbackRefs[index]) != OS_STATUS_OK))                              /* SBSW_OS_IOC_HOOKCALLCALLBACK_001 */
+      {
+        callFailed = TRUE;
+      }
+    }
+  }
+
+  /* #30 Returns IOC_E_NOK, if at least one of the callbacks is not successfully triggered. */
+  if(OS_LIKELY(callFailed == FALSE))                                                                                    /* COMP_WARN_OS_CW_005 */
+  {
+    result = IOC_E_OK;
+  }
+  else
+  {
+    result = IOC_E_NOK;
+  }
+
+  return result;
+}
+
+
+/***********************************************************************************************************************
+ *  Os_IocCheckNoDataLost()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE Os_StdReturnType, OS_CODE, OS_ALWAYS_INLINE, Os_IocCheckNoDataLost,
+(
+  P2CONST(Os_IocReceiveConfigType, TYPEDEF, OS_CONST) Ioc
+))
+{
+  P2VAR(Os_IocReceiveType volatile, AUTOMATIC, TYPEDEF) receiverDyn;
+  P2CONST(Os_IocSendType volatile, AUTOMATIC, TYPEDEF) senderDyn;
+  Os_StdReturnType result;
+  Os_IocLostCounterType lostCounter;
+
+  receiverDyn = Os_IocReceiveGetDyn(Ioc);                                                                               /* SBSW_OS_FC_PRECONDITION */
+  senderDyn = Os_IocSendGetDyn(Ioc->Send);                                                                              /* SBSW_OS_IOC_IOCSENDGETDYN_001 */
+
+  lostCounter = senderDyn->LostCounter;
+
+  /* #10 If the lost counter did not change since the last check, return no data lost. */
+  if(lostCounter == receiverDyn->LostCounterSnapshot)
+  {
+    result = !OS_CHECK_FAILED;                                                                                          /* PRQA S 4404, 4558 */  /* MD_Os_C90BooleanCompatibility, MD_Os_Rule10.1_4558 */
+  }
+  /* #20 Otherwise: */
+  else
+  {
+    /* #30 Update the lost counter snapshot. */
+    receiverDyn->LostCounterSnapshot = lostCounter;                                                                     /* SBSW_OS_IOC_IOCRECEIVEGETDYN_001 */
+
+    /* #40 Return data lost. */
+    result = OS_CHECK_FAILED;
+  }
+  return result;
+}
+
+
+/***********************************************************************************************************************
+ *  Os_IocIncrementLostCounter()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -2070,6 +3009,71 @@ OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE, Os
 }
 
 
+/***********************************************************************************************************************
+ *  Os_IocIsDataReceived()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE Os_StdReturnType, OS_CODE, OS_ALWAYS_INLINE, Os_IocIsDataReceived,
+(
+  Os_IocInternalReturnType Status
+))
+{
+  /* #10 Return whether the status reports a received element. */
+  return (Os_StdReturnType)((Status == OS_IOC_E_INTERNAL_OK) || (Status == OS_IOC_E_INTERNAL_LOST_DATA));               /* PRQA S 4304 */ /* MD_Os_C90BooleanCompatibility */
+}
+
+
+/***********************************************************************************************************************
+ *  Os_IocMergeReceiveStatus()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE Os_IocInternalReturnType, OS_CODE, OS_ALWAYS_INLINE,
+Os_IocMergeReceiveStatus,
+(
+  Os_IocInternalReturnType Status,
+  Os_IocInternalReturnType ElementStatus,
+  uint32 Received
+))
+{
+  Os_IocInternalReturnType result;
+
+  /* #10 If this is the first element, use its status. */
+  if(Received == 0u)
+  {
+    result = ElementStatus;
+  }
+  /* #20 Otherwise, if data loss has been detected, report it. */
+  else if((ElementStatus == OS_IOC_E_INTERNAL_LOST_DATA) || (ElementStatus == OS_IOC_E_INTERNAL_LOST_AND_NO_DATA))
+  {
+    result = OS_IOC_E_INTERNAL_LOST_DATA;
+  }
+  /* #30 Otherwise, if the channel is inconsistent, report it. */
+  else if((ElementStatus == OS_IOC_E_INTERNAL_CLOSE_CHANNEL)                                                            /* COV_OS_INVSTATE */
+       || (ElementStatus == OS_IOC_E_INTERNAL_CHANNEL_CLOSED))
+  {
+    result = ElementStatus;
+  }
+  /* #40 Otherwise keep the status. */
+  else
+  {
+    result = Status;
+  }
+
+  return result;
+}
+
+
 /***********************************************************************************************************************
  *  Os_IocEmptyMultiQueue()
  **********************************************************************************************************************/
@@ -2187,7 +3191,7 @@ OS_LOCAL_INLINE Os_IocInternalReturnType, OS_CODE, OS_ALWAYS_INLINE, Os_Ioc08Rec
     }
 
     /* #20 Read from the IOC buffer. */
-    (*Data) = Os_Fifo08Dequeue(&(Ioc->FifoRead));                                                                       /* SBSW_OS_FC_PRECONDITION */ /* SBSW_OS_PWA_PRECONDITION */
+    (*Data) = Os_Fifo08Dequeue(&(Ioc->FifoRead), Os_IocIsLockFree(&(Ioc->Ioc.Base)));                                   /* SBSW_OS_FC_PRECONDITION */ /* SBSW_OS_PWA_PRECONDITION */
   }
 
   return status;
@@ -2248,7 +3252,7 @@ OS_LOCAL_INLINE Os_IocInternalReturnType, OS_CODE, OS_ALWAYS_INLINE, Os_Ioc16Rec
     }
 
     /* #20 Read from the IOC buffer. */
-    (*Data) = Os_Fifo16Dequeue(&(Ioc->FifoRead));                                                                       /* SBSW_OS_FC_PRECONDITION */ /* SBSW_OS_PWA_PRECONDITION */
+    (*Data) = Os_Fifo16Dequeue(&(Ioc->FifoRead), Os_IocIsLockFree(&(Ioc->Ioc.Base)));                                   /* SBSW_OS_FC_PRECONDITION */ /* SBSW_OS_PWA_PRECONDITION */
   }
 
   return status;
@@ -2309,7 +3313,7 @@ OS_LOCAL_INLINE Os_IocInternalReturnType, OS_CODE, OS_ALWAYS_INLINE, Os_Ioc32Rec
     }
 
     /* #20 Read from the IOC buffer. */
-    (*Data) = Os_Fifo32Dequeue(&(Ioc->FifoRead));                                                                       /* SBSW_OS_FC_PRECONDITION */ /* SBSW_OS_PWA_PRECONDITION */
+    (*Data) = Os_Fifo32Dequeue(&(Ioc->FifoRead), Os_IocIsLockFree(&(Ioc->Ioc.Base)));                                   /* SBSW_OS_FC_PRECONDITION */ /* SBSW_OS_PWA_PRECONDITION */
   }
 
   return status;
@@ -2334,6 +3338,36 @@ OS_LOCAL_INLINE Os_IocInternalReturnType, OS_CODE, OS_ALWAYS_INLINE, Os_IocRefRe
 {
   Os_IocInternalReturnType status;
 
+  /* #10 Perform checks. */
+  status = Os_IocRefReceiveCheck(Ioc);                                                                                  /* SBSW_OS_FC_PRECONDITION */
+
+  /* #20 If an item is available, read from the IOC buffer. */
+  if(Os_IocIsDataReceived(status) != 0u)
+  {
+    Os_FifoRefDequeue(&(Ioc->FifoRead), Data, Os_IocIsLockFree(&(Ioc->Ioc.Base)));                                      /* SBSW_OS_FC_PRECONDITION */
+  }
+
+  return status;
+}
+
+
+/***********************************************************************************************************************
+ *  Os_IocRefReceiveCheck()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(
+OS_LOCAL_INLINE Os_IocInternalReturnType, OS_CODE, OS_ALWAYS_INLINE, Os_IocRefReceiveCheck,
+(
+  P2CONST(Os_IocRefReceiveConfigType, TYPEDEF, OS_CONST) Ioc
+))
+{
+  Os_IocInternalReturnType status;
+
   /* #10 Perform checks. */
   if(OS_UNLIKELY(Os_IocChannelIsEnabled(&(Ioc->Ioc.Base)) == 0u))                                                       /* SBSW_OS_FC_PRECONDITION */ /* COV_OS_INVSTATE */
   {
@@ -2347,6 +3381,11 @@ OS_LOCAL_INLINE Os_IocInternalReturnType, OS_CODE, OS_ALWAYS_INLINE, Os_IocRefRe
   {
     status = OS_IOC_E_INTERNAL_CLOSE_CHANNEL;
   }
+  else if(OS_UNLIKELY(Os_FifoRefIsBorrowed(&(Ioc->FifoRead)) != 0u))                                                    /* SBSW_OS_FC_PRECONDITION */
+  {
+    /* #20 The eldest item is still borrowed, it may neither be read nor borrowed again. */
+    status = OS_IOC_E_INTERNAL_NOK;
+  }
   else if(OS_UNLIKELY(Os_FifoRefIsEmpty(&(Ioc->FifoRead)) != 0u))                                                       /* SBSW_OS_FC_PRECONDITION */
   {
     if(OS_UNLIKELY(Os_IocCheckNoDataLost(&(Ioc->Ioc)) == OS_CHECK_FAILED))                                              /* SBSW_OS_FC_PRECONDITION */
@@ -2368,9 +3407,6 @@ OS_LOCAL_INLINE Os_IocInternalReturnType, OS_CODE, OS_ALWAYS_INLINE, Os_IocRefRe
     {
       status = OS_IOC_E_INTERNAL_OK;
     }
-
-    /* #20 Read from the IOC buffer. */
-    Os_FifoRefDequeue(&(Ioc->FifoRead), Data);                                                                          /* SBSW_OS_FC_PRECONDITION */
   }
 
   return status;
@@ -2378,49 +3414,438 @@ OS_LOCAL_INLINE Os_IocInternalReturnType, OS_CODE, OS_ALWAYS_INLINE, Os_IocRefRe
 
 
 /***********************************************************************************************************************
- *  GLOBAL FUNCTIONS
- **********************************************************************************************************************/
-/***********************************************************************************************************************
- *  IOC uint8
- **********************************************************************************************************************/
-/***********************************************************************************************************************
- *  Os_Ioc08ReceiveInit()
+ *  Os_IocReceiveElement()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
  *
  *
  *
+ *
+ *
+ *
+ *
+ *
  */
-OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE, Os_Ioc08ReceiveInit,
+OS_FUNC_ATTRIBUTE_DEFINITION(
+OS_LOCAL_INLINE Os_IocInternalReturnType, OS_CODE, OS_ALWAYS_INLINE, Os_IocReceiveElement,
 (
-  P2CONST(Os_Ioc08ReceiveConfigType, TYPEDEF, OS_CONST) Ioc
+  P2CONST(Os_IocConfigType, TYPEDEF, OS_CONST) Ioc,
+  Os_IocSubClassType SubClass,
+  P2VAR(void, TYPEDEF, AUTOMATIC) Data,
+  uint32 Idx
 ))
 {
-  /* #10 Initialize the base class. */
-  Os_IocReceiveInit(&(Ioc->Ioc));                                                                                       /* SBSW_OS_FC_PRECONDITION */
+  Os_IocInternalReturnType status = OS_IOC_E_INTERNAL_NOK;
 
-  /* #20 Initialize FIFO reader part. */
-  Os_Fifo08ReadInit(&(Ioc->FifoRead));                                                                                  /* SBSW_OS_FC_PRECONDITION */
+  /* #10 Call the internal receive function of the sub class with the element at Idx. */
+  switch(SubClass)
+  {
+    case Ioc08Receive:
+      status = Os_Ioc08ReceiveInternal(                                                                                 /* SBSW_OS_IOC_IOC08RECEIVEINTERNAL_002 */
+          Os_IocIoc2Ioc08Receive(Ioc),
+          &(((P2VAR(uint8, AUTOMATIC, AUTOMATIC))Data)[Idx])                                                            /* PRQA S 0316 */ /* MD_Os_Rule11.5_0316 */
+      );
+      break;
+
+    case Ioc16Receive:
+      status = Os_Ioc16ReceiveInternal(                                                                                 /* SBSW_OS_IOC_IOC16RECEIVEINTERNAL_002 */
+          Os_IocIoc2Ioc16Receive(Ioc),
+          &(((P2VAR(uint16, AUTOMATIC, AUTOMATIC))Data)[Idx])                                                           /* PRQA S 0316 */ /* MD_Os_Rule11.5_0316 */
+      );
+      break;
+
+    case Ioc32Receive:
+      status = Os_Ioc32ReceiveInternal(                                                                                 /* SBSW_OS_IOC_IOC32RECEIVEINTERNAL_002 */
+          Os_IocIoc2Ioc32Receive(Ioc),
+          &(((P2VAR(uint32, AUTOMATIC, AUTOMATIC))Data)[Idx])                                                           /* PRQA S 0316 */ /* MD_Os_Rule11.5_0316 */
+      );
+      break;
+
+    default:                                                                                                            /* COV_OS_INVSTATE */
+      /* cannot be reached as the SubClass parameter is set by module internal caller only */
+      Os_ErrKernelPanic();
+      break;                                                                                                            /* PRQA S 2880 */ /* MD_Os_Rule2.1_2880_NonReturning */
+  }
+
+  return status;
 }
 
 
 /***********************************************************************************************************************
- *  Os_Ioc08SendInit()
+ *  Os_IocSendIndicesInRange()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
  *
  *
  *
+ *
+ *
+ *
+ *
+ *
  */
-OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE, Os_Ioc08SendInit,
+OS_FUNC_ATTRIBUTE_DEFINITION(
+OS_LOCAL_INLINE Os_StdReturnType, OS_CODE, OS_ALWAYS_INLINE, Os_IocSendIndicesInRange,
 (
-  P2CONST(Os_Ioc08SendConfigType, TYPEDEF, OS_CONST) Ioc
+  P2CONST(Os_IocConfigType, TYPEDEF, OS_CONST) Ioc,
+  Os_IocSubClassType SubClass
 ))
 {
-  /* #10 Initialize the base class. */
-  Os_IocSendInit(&(Ioc->Ioc));                                                                                          /* SBSW_OS_FC_PRECONDITION */
+  Os_StdReturnType result = 0u;
+
+  /* #10 Check the write indices of the FIFO of the sub class. */
+  switch(SubClass)
+  {
+    case Ioc08Send:
+      result = Os_Fifo08IndicesInRangeOnWrite(&(Os_IocIoc2Ioc08Send(Ioc)->FifoWrite));                                  /* SBSW_OS_FC_PRECONDITION */
+      break;
+
+    case Ioc16Send:
+      result = Os_Fifo16IndicesInRangeOnWrite(&(Os_IocIoc2Ioc16Send(Ioc)->FifoWrite));                                  /* SBSW_OS_FC_PRECONDITION */
+      break;
+
+    case Ioc32Send:
+      result = Os_Fifo32IndicesInRangeOnWrite(&(Os_IocIoc2Ioc32Send(Ioc)->FifoWrite));                                  /* SBSW_OS_FC_PRECONDITION */
+      break;
+
+    default:                                                                                                            /* COV_OS_INVSTATE */
+      /* cannot be reached as the SubClass parameter is set by module internal caller only */
+      Os_ErrKernelPanic();
+      break;                                                                                                            /* PRQA S 2880 */ /* MD_Os_Rule2.1_2880_NonReturning */
+  }
+
+  return result;
+}
+
+
+/***********************************************************************************************************************
+ *  Os_IocSendElement()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ *
+ *
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(
+OS_LOCAL_INLINE Os_FifoWriteResultType, OS_CODE, OS_ALWAYS_INLINE, Os_IocSendElement,
+(
+  P2CONST(Os_IocConfigType, TYPEDEF, OS_CONST) Ioc,
+  Os_IocSubClassType SubClass,
+  P2CONST(void, TYPEDEF, AUTOMATIC) Data,
+  uint32 Idx,
+  Os_StdReturnType Ordered
+))
+{
+  Os_FifoWriteResultType result = OS_FIFOWRITERESULT_BUFFEROVERFLOW;
+
+  /* #10 Write the element at Idx to the FIFO of the sub class. */
+  switch(SubClass)
+  {
+    case Ioc08Send:
+      result = Os_Fifo08Enqueue(                                                                                        /* SBSW_OS_FC_PRECONDITION */
+          &(Os_IocIoc2Ioc08Send(Ioc)->FifoWrite),
+          ((P2CONST(uint8, AUTOMATIC, AUTOMATIC))Data)[Idx],                                                            /* PRQA S 0316 */ /* MD_Os_Rule11.5_0316 */
+          Ordered
+      );
+      break;
+
+    case Ioc16Send:
+      result = Os_Fifo16Enqueue(                                                                                        /* SBSW_OS_FC_PRECONDITION */
+          &(Os_IocIoc2Ioc16Send(Ioc)->FifoWrite),
+          ((P2CONST(uint16, AUTOMATIC, AUTOMATIC))Data)[Idx],                                                           /* PRQA S 0316 */ /* MD_Os_Rule11.5_0316 */
+          Ordered
+      );
+      break;
+
+    case Ioc32Send:
+      result = Os_Fifo32Enqueue(                                                                                        /* SBSW_OS_FC_PRECONDITION */
+          &(Os_IocIoc2Ioc32Send(Ioc)->FifoWrite),
+          ((P2CONST(uint32, AUTOMATIC, AUTOMATIC))Data)[Idx],                                                           /* PRQA S 0316 */ /* MD_Os_Rule11.5_0316 */
+          Ordered
+      );
+      break;
+
+    default:                                                                                                            /* COV_OS_INVSTATE */
+      /* cannot be reached as the SubClass parameter is set by module internal caller only */
+      Os_ErrKernelPanic();
+      break;                                                                                                            /* PRQA S 2880 */ /* MD_Os_Rule2.1_2880_NonReturning */
+  }
+
+  return result;
+}
+
+
+/***********************************************************************************************************************
+ *  Os_IocReceiveN()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ *
+ *
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(
+OS_LOCAL_INLINE Std_ReturnType, OS_CODE, OS_ALWAYS_INLINE, Os_IocReceiveN,
+(
+  P2CONST(Os_IocReceiveConfigType, TYPEDEF, OS_CONST) Ioc,
+  Os_IocSubClassType SubClass,
+  P2VAR(void, TYPEDEF, AUTOMATIC) Data,
+  uint32 Count,
+  P2VAR(uint32, TYPEDEF, AUTOMATIC) Received
+))
+{
+  Os_IocInternalReturnType status;
+  uint32 received = 0u;
+
+  /* #10 If Ioc is not enabled: KernelPanic. */
+  if(Os_IocIsEnabled() == 0u)                                                                                           /* COV_OS_INVSTATE */ /* PRQA S 2992, 2996 */ /* MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2996 */
+  {
+    Os_ErrKernelPanic();
+  }
+
+  {
+    P2CONST(Os_AppConfigType, TYPEDEF, OS_CONST) currentApplication;
+    Os_AppAccessMaskType permittedApplications;
+
+    currentApplication = Os_ThreadGetCurrentApplication(Os_CoreGetThread());                                            /* SBSW_OS_IOC_THREADGETCURRENTAPPLICATION_001 */
+    permittedApplications = Os_IocGetAccessingApplications(&(Ioc->Base));                                               /* SBSW_OS_FC_PRECONDITION */
+
+    /* #15 Perform checks. */
+    if(OS_UNLIKELY(Os_AppCheckAccess(currentApplication, permittedApplications) == OS_CHECK_FAILED))                    /* SBSW_OS_IOC_APPCHECKACCESS_001 */
+    {
+      status = OS_IOC_E_INTERNAL_NOK;
+    }
+    else
+    {
+      Os_IocInternalReturnType elementStatus = OS_IOC_E_INTERNAL_OK;
+      OS_JUSTIFY_NOINIT(Os_IntStateType interruptState);
+
+      status = OS_IOC_E_INTERNAL_NO_DATA;
+
+      /* #20 Get the locks once for all elements. */
+      Os_IocLock(&(Ioc->Base), &interruptState);                                                                        /* SBSW_OS_IOC_IOCLOCK_001 */
+
+      /* #30 Call internal receive function until Count elements are read or no further element is available. */
+      while((received < Count) && (Os_IocIsDataReceived(elementStatus) != 0u))
+      {
+        elementStatus = Os_IocReceiveElement(&(Ioc->Base), SubClass, Data, received);                                   /* SBSW_OS_IOC_RECEIVEELEMENT_001 */
+        status = Os_IocMergeReceiveStatus(status, elementStatus, received);
+
+        if(Os_IocIsDataReceived(elementStatus) != 0u)
+        {
+          received++;
+        }
+      }
+
+      /* #40 Correct the return value and close the channel if necessary. */
+      if(OS_UNLIKELY((status == OS_IOC_E_INTERNAL_CLOSE_CHANNEL)))                                                      /* COV_OS_INVSTATE */
+      {
+        Os_IocReceiveCloseChannel(Ioc);                                                                                 /* SBSW_OS_FC_PRECONDITION */
+        /* OS_IOC_E_INTERNAL_CLOSE_CHANNEL in not known externally, other return values are numerical identical */
+        status = OS_IOC_E_INTERNAL_NO_DATA;
+      }
+      else if(OS_UNLIKELY((status == OS_IOC_E_INTERNAL_CHANNEL_CLOSED)))                                                /* COV_OS_INVSTATE */
+      {
+        /* OS_IOC_E_INTERNAL_CHANNEL_CLOSED in not known externally, other return values are numerical identical */
+        status = OS_IOC_E_INTERNAL_NO_DATA;
+      }
+      else
+      {
+        /* status does not need to be changed. MISRA 14.10 */
+      }
+
+      /* #50 Release the locks. */
+      Os_IocUnlock(&(Ioc->Base), &interruptState);                                                                      /* SBSW_OS_IOC_IOCUNLOCK_001 */
+    }
+  }
+
+  /* #60 Report the number of received elements. */
+  (*Received) = received;                                                                                               /* SBSW_OS_PWA_PRECONDITION */
+
+  return (Std_ReturnType) status;
+}                                                                                                                       /* PRQA S 6050, 6080 */ /* MD_MSR_STCAL, MD_MSR_STMIF */
+
+
+/***********************************************************************************************************************
+ *  Os_IocSendN()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ *
+ *
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(
+OS_LOCAL_INLINE Std_ReturnType, OS_CODE, OS_ALWAYS_INLINE, Os_IocSendN,
+(
+  P2CONST(Os_IocSendConfigType, TYPEDEF, OS_CONST) Ioc,
+  Os_IocSubClassType SubClass,
+  P2CONST(void, TYPEDEF, AUTOMATIC) Data,
+  uint32 Count,
+  P2VAR(uint32, TYPEDEF, AUTOMATIC) Sent
+))
+{
+  Std_ReturnType status;
+  uint32 sent = 0u;
+
+  /* #10 If Ioc is not enabled: KernelPanic. */
+  if(Os_IocIsEnabled() == 0u)                                                                                           /* COV_OS_INVSTATE */ /* PRQA S 2992, 2996 */ /* MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2996 */
+  {
+    Os_ErrKernelPanic();
+  }
+
+  {
+    P2CONST(Os_AppConfigType, TYPEDEF, OS_CONST) currentApplication;
+    Os_AppAccessMaskType permittedApplications;
+
+    currentApplication = Os_ThreadGetCurrentApplication(Os_CoreGetThread());                                            /* SBSW_OS_IOC_THREADGETCURRENTAPPLICATION_001 */
+    permittedApplications = Os_IocGetAccessingApplications(&(Ioc->Base));                                               /* SBSW_OS_FC_PRECONDITION */
+
+    /* #15 Perform static checks. */
+    if(OS_UNLIKELY(Os_AppCheckAccess(currentApplication, permittedApplications) == OS_CHECK_FAILED))                    /* SBSW_OS_IOC_APPCHECKACCESS_001 */
+    {
+      status = IOC_E_NOK;
+    }
+    else
+    {
+      Os_FifoWriteResultType result = OS_FIFOWRITERESULT_OK;
+      Os_StdReturnType ordered;
+      OS_JUSTIFY_NOINIT(Os_IntStateType interruptState);
+
+      status = IOC_E_OK;
+
+      /* #20 Get the locks once for all elements. */
+      Os_IocLock(&(Ioc->Base), &interruptState);                                                                        /* SBSW_OS_IOC_IOCLOCK_001 */
+
+      /* #30 Check that the channel is enabled and that the FIFO indices are in range. If not close the channel. */
+      if(OS_UNLIKELY((Os_IocChannelIsEnabled(&(Ioc->Base)) == 0u)))                                                     /* SBSW_OS_FC_PRECONDITION */ /* COV_OS_INVSTATE */
+      {
+        status = IOC_E_LIMIT;
+      }
+      else if(OS_UNLIKELY((Os_IocChannelIsEnabled(&(Ioc->Receive->Base)) == 0u)))                                       /* SBSW_OS_IOC_IOCCHANNELISENABLED_002 */ /* COV_OS_INVSTATE */
+      {
+        Os_IocSendCloseChannel(Ioc);                                                                                    /* SBSW_OS_FC_PRECONDITION */
+        status = IOC_E_LIMIT;
+      }
+      else if(OS_UNLIKELY((Os_IocSendIndicesInRange(&(Ioc->Base), SubClass) == 0u)))                                    /* SBSW_OS_FC_PRECONDITION */ /* COV_OS_INVSTATE */
+      {
+        Os_IocSendCloseChannel(Ioc);                                                                                    /* SBSW_OS_FC_PRECONDITION */
+        status = IOC_E_LIMIT;
+      }
+      else
+      {
+        /* #40 Write to the IOC buffer until all elements are written or the buffer is full. */
+        ordered = Os_IocIsLockFree(&(Ioc->Base));                                                                       /* SBSW_OS_FC_PRECONDITION */
+        while((sent < Count) && (result == OS_FIFOWRITERESULT_OK))
+        {
+          result = Os_IocSendElement(&(Ioc->Base), SubClass, Data, sent, ordered);                                      /* SBSW_OS_IOC_SENDELEMENT_001 */
+
+          if(OS_LIKELY(result == OS_FIFOWRITERESULT_OK))
+          {
+            sent++;
+          }
+        }
+
+        /* #50 If FIFO is full before all elements are written: */
+        if(OS_UNLIKELY(result == OS_FIFOWRITERESULT_BUFFEROVERFLOW))
+        {
+          /* #60 Increment lost counter. */
+          Os_IocIncrementLostCounter(Ioc);                                                                              /* SBSW_OS_FC_PRECONDITION */
+          status = IOC_E_LIMIT;
+        }
+
+        /* #65 Mark the channel at a multiple receive IOC, also after a data loss, which has to be reported. */
+        Os_IocNotifyReceiver(Ioc);                                                                                      /* SBSW_OS_FC_PRECONDITION */
+      }
+
+      /* #70 Release the locks. */
+      Os_IocUnlock(&(Ioc->Base), &interruptState);                                                                      /* SBSW_OS_IOC_IOCUNLOCK_001 */
+
+      /* #80 If at least one element has been written: */
+      if(OS_LIKELY(sent != 0u))
+      {
+        Std_ReturnType callbackStatus;
+
+        /* #90 Tell base class object, that sending is completed by calling the callbacks once, when configured.
+         *     Keep a detected buffer overflow. */
+        callbackStatus = Os_IocCallCallbacks(&(Ioc->Callbacks));                                                        /* SBSW_OS_FC_PRECONDITION */
+        if(status == IOC_E_OK)
+        {
+          status = callbackStatus;
+        }
+      }
+    }
+  }
+
+  /* #100 Report the number of written elements. */
+  (*Sent) = sent;                                                                                                       /* SBSW_OS_PWA_PRECONDITION */
+
+  return status;
+}                                                                                                                       /* PRQA S 6050, 6080 */ /* MD_MSR_STCAL, MD_MSR_STMIF */
+
+
+/***********************************************************************************************************************
+ *  GLOBAL FUNCTIONS
+ **********************************************************************************************************************/
+/***********************************************************************************************************************
+ *  IOC uint8
+ **********************************************************************************************************************/
+/***********************************************************************************************************************
+ *  Os_Ioc08ReceiveInit()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE, Os_Ioc08ReceiveInit,
+(
+  P2CONST(Os_Ioc08ReceiveConfigType, TYPEDEF, OS_CONST) Ioc
+))
+{
+  /* #10 Initialize the base class. */
+  Os_IocReceiveInit(&(Ioc->Ioc));                                                                                       /* SBSW_OS_FC_PRECONDITION */
+
+  /* #20 Initialize FIFO reader part. */
+  Os_Fifo08ReadInit(&(Ioc->FifoRead));                                                                                  /* SBSW_OS_FC_PRECONDITION */
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Ioc08SendInit()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE, Os_Ioc08SendInit,
+(
+  P2CONST(Os_Ioc08SendConfigType, TYPEDEF, OS_CONST) Ioc
+))
+{
+  /* #10 Initialize the base class. */
+  Os_IocSendInit(&(Ioc->Ioc));                                                                                          /* SBSW_OS_FC_PRECONDITION */
 
   /* #20 Initialize FIFO writer part. */
   Os_Fifo08WriteInit(&(Ioc->FifoWrite));                                                                                /* SBSW_OS_FC_PRECONDITION */
@@ -2428,7 +3853,518 @@ OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE, Os
 
 
 /***********************************************************************************************************************
- *  Os_Ioc08MultiReceive()
+ *  Os_Ioc08MultiReceive()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ *
+ *
+ *
+ *
+ *
+ *
+ *
+ */
+FUNC(Std_ReturnType, OS_CODE) Os_Ioc08MultiReceive
+(
+  P2CONST(Os_Ioc08MultiReceiveConfigType, TYPEDEF, OS_CONST) Ioc,
+  P2VAR(uint8, TYPEDEF, AUTOMATIC) Data
+)
+{
+  Os_IocInternalReturnType status;
+
+  /* #10 If Ioc is not enabled: KernelPanic. */
+  if(Os_IocIsEnabled() == 0u)                                                                                           /* COV_OS_INVSTATE */ /* PRQA S 2992, 2996 */ /* MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2996 */
+  {
+    Os_ErrKernelPanic();
+  }
+
+  {
+    P2CONST(Os_AppConfigType, TYPEDEF, OS_CONST) currentApplication;
+    Os_AppAccessMaskType permittedApplications;
+
+    currentApplication = Os_ThreadGetCurrentApplication(Os_CoreGetThread());                                            /* SBSW_OS_IOC_THREADGETCURRENTAPPLICATION_001 */
+    permittedApplications = Os_IocGetAccessingApplications(&(Ioc->Ioc.Base));                                           /* SBSW_OS_FC_PRECONDITION */
+
+    /* #15 Perform static checks. */
+    if(OS_UNLIKELY(Os_AppCheckAccess(currentApplication, permittedApplications) == OS_CHECK_FAILED))                    /* SBSW_OS_IOC_APPCHECKACCESS_001 */
+    {
+      status = OS_IOC_E_INTERNAL_NOK;
+    }
+    else
+    {
+      OS_JUSTIFY_NOINIT(Os_IntStateType intState);
+      Os_ObjIdx_IteratorType currentReceiveIdx;
+
+      /* #20 Get the locks. */
+      Os_IocLock(&(Ioc->Ioc.Base), &intState);                                                                          /* SBSW_OS_IOC_IOCLOCK_001 */
+
+      /* #30 Perform checks. */
+      if(OS_UNLIKELY(Os_IocChannelIsEnabled(&(Ioc->Ioc.Base)) == 0u))                                                   /* SBSW_OS_FC_PRECONDITION */ /* COV_OS_INVSTATE */
+      {
+        /* OS_IOC_E_INTERNAL_CHANNEL_CLOSED makes no sense here as it is not stated to the caller anyhow. */
+        status = OS_IOC_E_INTERNAL_NO_DATA;
+      }
+      else
+      {
+        P2VAR(Os_IocMultiReceiveType volatile, AUTOMATIC, TYPEDEF) dyn;
+        Os_ObjIdx_IteratorType receiveChannelCounter;
+
+        dyn = Os_IocMultiReceiveGetDyn(&(Ioc->Ioc));                                                                    /* SBSW_OS_FC_PRECONDITION */
+        currentReceiveIdx = (Os_ObjIdx_IteratorType) dyn->NextReceiveChannel;
+
+        status = OS_IOC_E_INTERNAL_NO_DATA;
+
+        /* #40 If the senders mark the channels, which may contain data, visit the marked channels only. */
+        if(Os_IocMultiReceiveUsesReadyMask(&(Ioc->Ioc)) != 0u)                                                          /* SBSW_OS_FC_PRECONDITION */
+        {
+          status = Os_IocMultiReceiveReady(&(Ioc->Ioc), Ioc08MultiReceive, Data);                                       /* SBSW_OS_FC_PRECONDITION */
+        }
+        else
+        {
+          /* #44 Otherwise, for each IOC channel, beginning from where last receive ended: */
+          for(receiveChannelCounter = 0; receiveChannelCounter < (Os_ObjIdx_IteratorType) Ioc->Ioc.ReceiveChannelCount; /* COV_OS_HALPLATFORMTESTEDASMULTICORE */
+              receiveChannelCounter++)
+          {
+            /* #50 Read from the IOC channel. */
+            status = Os_Ioc08ReceiveInternal(&(Ioc->Receivers[currentReceiveIdx]), Data);                               /* SBSW_OS_IOC_IOC08RECEIVEINTERNAL_001 */
+
+            /* #60 If the channel contained data or an error occurred, abort looking for data. */
+            if (status != OS_IOC_E_INTERNAL_NO_DATA)
+            {
+              break;
+            }
+
+            currentReceiveIdx++;
+            if (currentReceiveIdx >= (Os_ObjIdx_IteratorType) Ioc->Ioc.ReceiveChannelCount)                             /* COV_OS_HALPLATFORMTESTEDASMULTICORE */
+            {
+              currentReceiveIdx = 0;
+            }
+          }
+        }
+
+        /* #70 Close all channels if an error has been detected */
+        switch(status)
+        {
+          case OS_IOC_E_INTERNAL_OK:
+            /* intentionally no break */
+          case OS_IOC_E_INTERNAL_LOST_DATA:
+            /* intentionally no break */
+          case OS_IOC_E_INTERNAL_LOST_AND_NO_DATA:
+            /* intentionally no break */
+          case OS_IOC_E_INTERNAL_NO_DATA:
+            /* no error to be handled inside this function */
+            break;
+          default:                                                                                                      /* COV_OS_INVSTATE */
+            /* an internal error has occurred, close all channels */
+            for(currentReceiveIdx = 0; currentReceiveIdx < (Os_ObjIdx_IteratorType) Ioc->Ioc.ReceiveChannelCount;       /* COV_OS_INVSTATE */
+                currentReceiveIdx++)
+            {
+              Os_IocReceiveCloseChannel(&(Ioc->Receivers[currentReceiveIdx].Ioc));                                      /* SBSW_OS_IOC_IOCRECEIVECLOSECHANNEL_001 */
+            }
+            /* The caller cannot handle internal error codes */
+            status = OS_IOC_E_INTERNAL_NO_DATA;
+            break;
+        }
+
+        /* #80 Compute the channel index for next IOC receive call. */
+        dyn->NextReceiveChannel++;                                                                                      /* PRQA S 3387 */ /* MD_Os_Rule13.3_3387 */ /* SBSW_OS_IOC_IOCMULTIRECEIVEGETDYN_001 */
+        if (dyn->NextReceiveChannel >= Ioc->Ioc.ReceiveChannelCount)
+        {
+          dyn->NextReceiveChannel = 0;                                                                                  /* SBSW_OS_IOC_IOCMULTIRECEIVEGETDYN_001 */
+        }
+      }
+      /* #90 Release the locks. */
+      Os_IocUnlock(&(Ioc->Ioc.Base), &intState);                                                                        /* SBSW_OS_IOC_IOCUNLOCK_001 */
+    }
+  }
+
+  return (Std_ReturnType) status;
+}                                                                                                                       /* PRQA S 6050 */ /* MD_MSR_STCAL */
+
+
+/***********************************************************************************************************************
+ *  Os_Ioc08Receive()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ *
+ *
+ *
+ */
+FUNC(Std_ReturnType, OS_CODE) Os_Ioc08Receive
+(
+  P2CONST(Os_Ioc08ReceiveConfigType, TYPEDEF, OS_CONST) Ioc,
+  P2VAR(uint8, TYPEDEF, AUTOMATIC) Data
+)
+{
+  Os_IocInternalReturnType status;
+
+  /* #10 If Ioc is not enabled: KernelPanic. */
+  if(Os_IocIsEnabled() == 0u)                                                                                           /* COV_OS_INVSTATE */ /* PRQA S 2992, 2996 */ /* MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2996 */
+  {
+    Os_ErrKernelPanic();
+  }
+
+  {
+    P2CONST(Os_AppConfigType, TYPEDEF, OS_CONST) currentApplication;
+    Os_AppAccessMaskType permittedApplications;
+
+    currentApplication = Os_ThreadGetCurrentApplication(Os_CoreGetThread());                                            /* SBSW_OS_IOC_THREADGETCURRENTAPPLICATION_001 */
+    permittedApplications = Os_IocGetAccessingApplications(&(Ioc->Ioc.Base));                                           /* SBSW_OS_FC_PRECONDITION */
+
+    /* #15 Perform checks. */
+    if(OS_UNLIKELY(Os_AppCheckAccess(currentApplication, permittedApplications) == OS_CHECK_FAILED))                    /* SBSW_OS_IOC_APPCHECKACCESS_001 */
+    {
+      status = OS_IOC_E_INTERNAL_NOK;
+    }
+    else
+    {
+      OS_JUSTIFY_NOINIT(Os_IntStateType interruptState);
+
+      /* #20 Get the locks. */
+      Os_IocLock(&(Ioc->Ioc.Base), &interruptState);                                                                    /* SBSW_OS_IOC_IOCLOCK_001 */
+
+      /* #30 Call internal receive function. */
+      status = Os_Ioc08ReceiveInternal(Ioc, Data);                                                                      /* SBSW_OS_FC_PRECONDITION */
+
+      /* #40 Correct the return value and close the channel if necessary. */
+      if(OS_UNLIKELY((status == OS_IOC_E_INTERNAL_CLOSE_CHANNEL)))                                                      /* COV_OS_INVSTATE */
+      {
+        Os_IocReceiveCloseChannel(&(Ioc->Ioc));                                                                         /* SBSW_OS_FC_PRECONDITION */
+        /* OS_IOC_E_INTERNAL_CLOSE_CHANNEL in not known externally, other return values are numerical identical */
+        status = OS_IOC_E_INTERNAL_NO_DATA;
+      }
+      else if(OS_UNLIKELY(status == OS_IOC_E_INTERNAL_CHANNEL_CLOSED))                                                  /* COV_OS_INVSTATE */
+      {
+        /* OS_IOC_E_INTERNAL_CHANNEL_CLOSED in not known externally, other return values are numerical identical */
+        status = OS_IOC_E_INTERNAL_NO_DATA;
+      }
+      else
+      {
+        /* status does not need to be changed. MISRA 14.10 */
+      }
+
+      /* #50 Release the locks. */
+      Os_IocUnlock(&(Ioc->Ioc.Base), &interruptState);                                                                  /* SBSW_OS_IOC_IOCUNLOCK_001 */
+    }
+  }
+
+  return (Std_ReturnType) status;
+}                                                                                                                       /* PRQA S 6050 */ /* MD_MSR_STCAL */
+
+
+/***********************************************************************************************************************
+ *  Os_Ioc08ReceiveN()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ *
+ *
+ *
+ *
+ */
+FUNC(Std_ReturnType, OS_CODE) Os_Ioc08ReceiveN
+(
+  P2CONST(Os_Ioc08ReceiveConfigType, TYPEDEF, OS_CONST) Ioc,
+  P2VAR(uint8, TYPEDEF, AUTOMATIC) Data,
+  uint32 Count,
+  P2VAR(uint32, TYPEDEF, AUTOMATIC) Received
+)
+{
+  /* #10 Call the base class method. */
+  return Os_IocReceiveN(&(Ioc->Ioc), Ioc08Receive, Data, Count, Received);                                              /* SBSW_OS_FC_PRECONDITION */
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Ioc08EmptyQueue()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ */
+FUNC(Std_ReturnType, OS_CODE) Os_Ioc08EmptyQueue
+(
+  P2CONST(Os_Ioc08ReceiveConfigType, TYPEDEF, OS_CONST) Ioc
+)
+{
+  Std_ReturnType status;
+
+  /* #10 If Ioc is not enabled: KernelPanic. */
+  if(Os_IocIsEnabled() == 0u)                                                                                           /* COV_OS_INVSTATE */ /* PRQA S 2992, 2996 */ /* MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2996 */
+  {
+    Os_ErrKernelPanic();
+  }
+
+  {
+    P2CONST(Os_AppConfigType, TYPEDEF, OS_CONST) currentApplication;
+    Os_AppAccessMaskType permittedApplications;
+
+    currentApplication = Os_ThreadGetCurrentApplication(Os_CoreGetThread());                                            /* SBSW_OS_IOC_THREADGETCURRENTAPPLICATION_001 */
+    permittedApplications = Os_IocGetAccessingApplications(&(Ioc->Ioc.Base));                                           /* SBSW_OS_FC_PRECONDITION */
+
+    /* #15 Perform static checks. */
+    if(OS_UNLIKELY(Os_AppCheckAccess(currentApplication, permittedApplications) == OS_CHECK_FAILED))                    /* SBSW_OS_IOC_APPCHECKACCESS_001 */
+    {
+      status = IOC_E_NOK;
+    }
+    else
+    {
+      /* #20 Redirect to FIFO. */
+      Os_Fifo08EmptyQueue(&(Ioc->FifoRead));                                                                            /* SBSW_OS_IOC_FIFO08EMPTYQUEUE_001 */
+
+      status = IOC_E_OK;
+    }
+  }
+
+  return status;
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Ioc08EmptyMultiQueue()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ */
+FUNC(Std_ReturnType, OS_CODE) Os_Ioc08EmptyMultiQueue                                                                   /* COV_OS_HALPLATFORMTESTEDASMULTICORE */
+(
+  P2CONST(Os_Ioc08MultiReceiveConfigType, TYPEDEF, OS_CONST) Ioc
+)
+{
+  Std_ReturnType status;
+
+  /* #10 If Ioc is not enabled: KernelPanic. */
+  if(Os_IocIsEnabled() == 0u)                                                                                           /* COV_OS_INVSTATE */ /* PRQA S 2992, 2996 */ /* MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2996 */
+  {
+    Os_ErrKernelPanic();
+  }
+
+  {
+    P2CONST(Os_AppConfigType, TYPEDEF, OS_CONST) currentApplication;
+    Os_AppAccessMaskType permittedApplications;
+
+    currentApplication = Os_ThreadGetCurrentApplication(Os_CoreGetThread());                                            /* SBSW_OS_IOC_THREADGETCURRENTAPPLICATION_001 */
+    permittedApplications = Os_IocGetAccessingApplications(&(Ioc->Ioc.Base));                                           /* SBSW_OS_FC_PRECONDITION */
+
+    /* #15 Perform static checks. */
+    if(OS_UNLIKELY(Os_AppCheckAccess(currentApplication, permittedApplications) == OS_CHECK_FAILED))                    /* SBSW_OS_IOC_APPCHECKACCESS_001 */
+    {
+      status = IOC_E_NOK;
+    }
+    else
+    {
+      /* #20 Call the base class method. */
+      (void)Os_IocEmptyMultiQueue(&(Ioc->Ioc), Ioc08MultiReceive);                                                      /* SBSW_OS_FC_PRECONDITION */
+      status = IOC_E_OK;
+    }
+  }
+
+  return status;
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Ioc08Send()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ *
+ *
+ *
+ *
+ *
+ *
+ *
+ */
+FUNC(Std_ReturnType, OS_CODE) Os_Ioc08Send
+(
+  P2CONST(Os_Ioc08SendConfigType, TYPEDEF, OS_CONST) Ioc,
+  uint8 Data
+)
+{
+  Std_ReturnType status;
+
+  /* #10 If Ioc is not enabled: KernelPanic. */
+  if(Os_IocIsEnabled() == 0u)                                                                                           /* COV_OS_INVSTATE */ /* PRQA S 2992, 2996 */ /* MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2996 */
+  {
+    Os_ErrKernelPanic();
+  }
+
+  {
+    P2CONST(Os_AppConfigType, TYPEDEF, OS_CONST) currentApplication;
+    Os_AppAccessMaskType permittedApplications;
+
+    currentApplication = Os_ThreadGetCurrentApplication(Os_CoreGetThread());                                            /* SBSW_OS_IOC_THREADGETCURRENTAPPLICATION_001 */
+    permittedApplications = Os_IocGetAccessingApplications(&(Ioc->Ioc.Base));                                           /* SBSW_OS_FC_PRECONDITION */
+
+    /* #15 Perform static checks. */
+    if(OS_UNLIKELY(Os_AppCheckAccess(currentApplication, permittedApplications) == OS_CHECK_FAILED))                    /* SBSW_OS_IOC_APPCHECKACCESS_001 */
+    {
+      status = IOC_E_NOK;
+    }
+    else
+    {
+      Os_FifoWriteResultType result;
+      OS_JUSTIFY_NOINIT(Os_IntStateType interruptState);
+
+      status = IOC_E_OK;
+
+      /* #20 Get the locks. */
+      Os_IocLock(&(Ioc->Ioc.Base), &interruptState);                                                                    /* SBSW_OS_IOC_IOCLOCK_001 */
+
+      /* #30 Check that the channel is enabled and that the FIFO indices are in range. If not close the channel. */
+      if(OS_UNLIKELY(Os_IocChannelIsEnabled(&(Ioc->Ioc.Base)) == 0u))                                                   /* SBSW_OS_FC_PRECONDITION */ /* COV_OS_INVSTATE */
+      {
+        status = IOC_E_LIMIT;
+      }
+      else if(OS_UNLIKELY((Os_IocChannelIsEnabled(&(Ioc->Ioc.Receive->Base)) == 0u)))                                   /* SBSW_OS_IOC_IOCCHANNELISENABLED_002 */ /* COV_OS_INVSTATE */
+      {
+        Os_IocSendCloseChannel(&(Ioc->Ioc));                                                                            /* SBSW_OS_FC_PRECONDITION */
+        status = IOC_E_LIMIT;
+      }
+      else if(OS_UNLIKELY((Os_Fifo08IndicesInRangeOnWrite(&(Ioc->FifoWrite)) == 0u)))                                   /* SBSW_OS_FC_PRECONDITION */ /* COV_OS_INVSTATE */
+      {
+        Os_IocSendCloseChannel(&(Ioc->Ioc));                                                                            /* SBSW_OS_FC_PRECONDITION */
+        status = IOC_E_LIMIT;
+      }
+      else
+      {
+        /* #40 Try to write to the IOC buffer. */
+        result = Os_Fifo08Enqueue(&(Ioc->FifoWrite), Data, Os_IocIsLockFree(&(Ioc->Ioc.Base)));                         /* SBSW_OS_FC_PRECONDITION */
+
+        /* #50 If FIFO is already full: */
+        if(OS_UNLIKELY((OS_UNLIKELY(result == OS_FIFOWRITERESULT_BUFFEROVERFLOW))))
+        {
+          /* #60 Increment lost counter. */
+          Os_IocIncrementLostCounter(&(Ioc->Ioc));                                                                      /* SBSW_OS_FC_PRECONDITION */
+          status = IOC_E_LIMIT;
+        }
+
+        /* #65 Mark the channel at a multiple receive IOC, also after a data loss, which has to be reported. */
+        Os_IocNotifyReceiver(&(Ioc->Ioc));                                                                              /* SBSW_OS_FC_PRECONDITION */
+      }
+
+      /* #70 Release the locks. */
+      Os_IocUnlock(&(Ioc->Ioc.Base), &interruptState);                                                                  /* SBSW_OS_IOC_IOCUNLOCK_001 */
+
+      /* #80 If no error detected: */
+      if(OS_LIKELY(status == IOC_E_OK))
+      {
+        /* #90 Tell base class object, that sending is completed by calling the callbacks, when configured. */
+        status = Os_IocCallCallbacks(&(Ioc->Ioc.Callbacks));                                                            /* SBSW_OS_FC_PRECONDITION */
+      }
+    }
+  }
+
+  return status;
+}                                                                                                                       /* PRQA S 6050, 6080 */ /* MD_MSR_STCAL, MD_MSR_STMIF */
+
+
+/***********************************************************************************************************************
+ *  Os_Ioc08SendN()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ *
+ *
+ *
+ *
+ *
+ *
+ *
+ *
+ */
+FUNC(Std_ReturnType, OS_CODE) Os_Ioc08SendN
+(
+  P2CONST(Os_Ioc08SendConfigType, TYPEDEF, OS_CONST) Ioc,
+  P2CONST(uint8, TYPEDEF, AUTOMATIC) Data,
+  uint32 Count,
+  P2VAR(uint32, TYPEDEF, AUTOMATIC) Sent
+)
+{
+  /* #10 Call the base class method. */
+  return Os_IocSendN(&(Ioc->Ioc), Ioc08Send, Data, Count, Sent);                                                        /* SBSW_OS_FC_PRECONDITION */
+}
+
+
+/***********************************************************************************************************************
+ *  IOC 16
+ **********************************************************************************************************************/
+/***********************************************************************************************************************
+ *  Os_Ioc16ReceiveInit()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE, Os_Ioc16ReceiveInit,
+(
+  P2CONST(Os_Ioc16ReceiveConfigType, TYPEDEF, OS_CONST) Ioc
+))
+{
+  /* #10 Initialize the base class. */
+  Os_IocReceiveInit(&(Ioc->Ioc));                                                                                       /* SBSW_OS_FC_PRECONDITION */
+
+  /* #20 Initialize all fields. */
+  Os_Fifo16ReadInit(&(Ioc->FifoRead));                                                                                  /* SBSW_OS_FC_PRECONDITION */
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Ioc16SendInit()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE, Os_Ioc16SendInit,
+(
+  P2CONST(Os_Ioc16SendConfigType, TYPEDEF, OS_CONST) Ioc
+))
+{
+  /* #10 Initialize the base class. */
+  Os_IocSendInit(&(Ioc->Ioc));                                                                                          /* SBSW_OS_FC_PRECONDITION */
+
+  /* #20 Initialize all fields. */
+  Os_Fifo16WriteInit(&(Ioc->FifoWrite));                                                                                /* SBSW_OS_FC_PRECONDITION */
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Ioc16MultiReceive()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -2444,10 +4380,10 @@ OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE, Os
  *
  *
  */
-FUNC(Std_ReturnType, OS_CODE) Os_Ioc08MultiReceive
+FUNC(Std_ReturnType, OS_CODE) Os_Ioc16MultiReceive
 (
-  P2CONST(Os_Ioc08MultiReceiveConfigType, TYPEDEF, OS_CONST) Ioc,
-  P2VAR(uint8, TYPEDEF, AUTOMATIC) Data
+  P2CONST(Os_Ioc16MultiReceiveConfigType, TYPEDEF, OS_CONST) Ioc,
+  P2VAR(uint16, TYPEDEF, AUTOMATIC) Data
 )
 {
   Os_IocInternalReturnType status;
@@ -2481,12 +4417,12 @@ FUNC(Std_ReturnType, OS_CODE) Os_Ioc08MultiReceive
       /* #30 Perform checks. */
       if(OS_UNLIKELY(Os_IocChannelIsEnabled(&(Ioc->Ioc.Base)) == 0u))                                                   /* SBSW_OS_FC_PRECONDITION */ /* COV_OS_INVSTATE */
       {
-        /* OS_IOC_E_INTERNAL_CHANNEL_CLOSED makes no sense here as it is not stated to the caller anyhow. */
+        /* OS_IOC_E_INTERNAL_CHANNEL_CLOSED makes no sense here as it is not stated to the caller anyhow */
         status = OS_IOC_E_INTERNAL_NO_DATA;
       }
       else
       {
-        P2VAR(Os_IocMultiReceiveType volatile, AUTOMATIC, TYPEDEF) dyn;
+        P2VAR(Os_IocMultiReceiveType volatile, AUTOMATIC, OS_VAR_NOINIT) dyn;
         Os_ObjIdx_IteratorType receiveChannelCounter;
 
         dyn = Os_IocMultiReceiveGetDyn(&(Ioc->Ioc));                                                                    /* SBSW_OS_FC_PRECONDITION */
@@ -2494,27 +4430,35 @@ FUNC(Std_ReturnType, OS_CODE) Os_Ioc08MultiReceive
 
         status = OS_IOC_E_INTERNAL_NO_DATA;
 
-        /* #40 For each IOC channel, beginning from where last receive ended: */
-        for(receiveChannelCounter = 0; receiveChannelCounter < (Os_ObjIdx_IteratorType) Ioc->Ioc.ReceiveChannelCount;   /* COV_OS_HALPLATFORMTESTEDASMULTICORE */
-            receiveChannelCounter++)
+        /* #40 If the senders mark the channels, which may contain data, visit the marked channels only. */
+        if(Os_IocMultiReceiveUsesReadyMask(&(Ioc->Ioc)) != 0u)                                                          /* SBSW_OS_FC_PRECONDITION */
         {
-          /* #50 Read from the IOC channel. */
-          status = Os_Ioc08ReceiveInternal(&(Ioc->Receivers[currentReceiveIdx]), Data);                                 /* SBSW_OS_IOC_IOC08RECEIVEINTERNAL_001 */
-
-          /* #60 If the channel contained data or an error occurred, abort looking for data. */
-          if (status != OS_IOC_E_INTERNAL_NO_DATA)
+          status = Os_IocMultiReceiveReady(&(Ioc->Ioc), Ioc16MultiReceive, Data);                                       /* SBSW_OS_FC_PRECONDITION */
+        }
+        else
+        {
+          /* #44 Otherwise, for each IOC channel, beginning from where last receive ended: */
+          for(receiveChannelCounter = 0; receiveChannelCounter < (Os_ObjIdx_IteratorType) Ioc->Ioc.ReceiveChannelCount; /* COV_OS_HALPLATFORMTESTEDASMULTICORE */
+              receiveChannelCounter++)
           {
-            break;
-          }
+            /* #50 Read from the IOC channel. */
+            status = Os_Ioc16ReceiveInternal(&(Ioc->Receivers[currentReceiveIdx]), Data);                               /* SBSW_OS_IOC_IOC16RECEIVEINTERNAL_001 */
 
-          currentReceiveIdx++;
-          if (currentReceiveIdx >= (Os_ObjIdx_IteratorType) Ioc->Ioc.ReceiveChannelCount)                               /* COV_OS_HALPLATFORMTESTEDASMULTICORE */
-          {
-            currentReceiveIdx = 0;
+            /* #60 If the channel contained data or an error occurred, abort looking for data. */
+            if (status != OS_IOC_E_INTERNAL_NO_DATA)
+            {
+              break;
+            }
+
+            currentReceiveIdx++;
+            if (currentReceiveIdx >= (Os_ObjIdx_IteratorType) Ioc->Ioc.ReceiveChannelCount)                             /* COV_OS_HALPLATFORMTESTEDASMULTICORE */
+            {
+              currentReceiveIdx = 0;
+            }
           }
         }
 
-        /* #70 Close all channels if an error has been detected */
+        /* #70 Close all channels if an error has been detected. */
         switch(status)
         {
           case OS_IOC_E_INTERNAL_OK:
@@ -2555,7 +4499,54 @@ FUNC(Std_ReturnType, OS_CODE) Os_Ioc08MultiReceive
 
 
 /***********************************************************************************************************************
- *  Os_Ioc08Receive()
+ *  Os_Ioc16EmptyMultiQueue()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ */
+FUNC(Std_ReturnType, OS_CODE) Os_Ioc16EmptyMultiQueue                                                                   /* COV_OS_HALPLATFORMTESTEDASMULTICORE */
+(
+  P2CONST(Os_Ioc16MultiReceiveConfigType, TYPEDEF, OS_CONST) Ioc
+)
+{
+  Std_ReturnType status;
+
+  /* #10 If Ioc is not enabled: KernelPanic. */
+  if(Os_IocIsEnabled() == 0u)                                                                                           /* COV_OS_INVSTATE */ /* PRQA S 2992, 2996 */ /* MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2996 */
+  {
+    Os_ErrKernelPanic();
+  }
+
+  {
+    P2CONST(Os_AppConfigType, TYPEDEF, OS_CONST) currentApplication;
+    Os_AppAccessMaskType permittedApplications;
+
+    currentApplication = Os_ThreadGetCurrentApplication(Os_CoreGetThread());                                            /* SBSW_OS_IOC_THREADGETCURRENTAPPLICATION_001 */
+    permittedApplications = Os_IocGetAccessingApplications(&(Ioc->Ioc.Base));                                           /* SBSW_OS_FC_PRECONDITION */
+
+    /* #15 Perform static checks. */
+    if(OS_UNLIKELY(Os_AppCheckAccess(currentApplication, permittedApplications) == OS_CHECK_FAILED))                    /* SBSW_OS_IOC_APPCHECKACCESS_001 */
+    {
+      status = IOC_E_NOK;
+    }
+    else
+    {
+      /* #20 Call the base class method. */
+      (void)Os_IocEmptyMultiQueue(&(Ioc->Ioc), Ioc16MultiReceive);                                                      /* SBSW_OS_FC_PRECONDITION */
+      status = IOC_E_OK;
+    }
+  }
+
+  return status;
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Ioc16Receive()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -2567,10 +4558,10 @@ FUNC(Std_ReturnType, OS_CODE) Os_Ioc08MultiReceive
  *
  *
  */
-FUNC(Std_ReturnType, OS_CODE) Os_Ioc08Receive
+FUNC(Std_ReturnType, OS_CODE) Os_Ioc16Receive
 (
-  P2CONST(Os_Ioc08ReceiveConfigType, TYPEDEF, OS_CONST) Ioc,
-  P2VAR(uint8, TYPEDEF, AUTOMATIC) Data
+  P2CONST(Os_Ioc16ReceiveConfigType, TYPEDEF, OS_CONST) Ioc,
+  P2VAR(uint16, TYPEDEF, AUTOMATIC) Data
 )
 {
   Os_IocInternalReturnType status;
@@ -2600,17 +4591,17 @@ FUNC(Std_ReturnType, OS_CODE) Os_Ioc08Receive
       /* #20 Get the locks. */
       Os_IocLock(&(Ioc->Ioc.Base), &interruptState);                                                                    /* SBSW_OS_IOC_IOCLOCK_001 */
 
-      /* #30 Call internal receive function. */
-      status = Os_Ioc08ReceiveInternal(Ioc, Data);                                                                      /* SBSW_OS_FC_PRECONDITION */
+      /* #30 Call internal receive function */
+      status = Os_Ioc16ReceiveInternal(Ioc, Data);                                                                      /* SBSW_OS_FC_PRECONDITION */
 
-      /* #40 Correct the return value and close the channel if necessary. */
+      /* #40 Correct the return value and close the channel if necessary */
       if(OS_UNLIKELY((status == OS_IOC_E_INTERNAL_CLOSE_CHANNEL)))                                                      /* COV_OS_INVSTATE */
       {
         Os_IocReceiveCloseChannel(&(Ioc->Ioc));                                                                         /* SBSW_OS_FC_PRECONDITION */
         /* OS_IOC_E_INTERNAL_CLOSE_CHANNEL in not known externally, other return values are numerical identical */
         status = OS_IOC_E_INTERNAL_NO_DATA;
       }
-      else if(OS_UNLIKELY(status == OS_IOC_E_INTERNAL_CHANNEL_CLOSED))                                                  /* COV_OS_INVSTATE */
+      else if(OS_UNLIKELY((status == OS_IOC_E_INTERNAL_CHANNEL_CLOSED)))                                                /* COV_OS_INVSTATE */
       {
         /* OS_IOC_E_INTERNAL_CHANNEL_CLOSED in not known externally, other return values are numerical identical */
         status = OS_IOC_E_INTERNAL_NO_DATA;
@@ -2630,7 +4621,7 @@ FUNC(Std_ReturnType, OS_CODE) Os_Ioc08Receive
 
 
 /***********************************************************************************************************************
- *  Os_Ioc08EmptyQueue()
+ *  Os_Ioc16ReceiveN()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -2638,47 +4629,26 @@ FUNC(Std_ReturnType, OS_CODE) Os_Ioc08Receive
  *
  *
  *
+ *
+ *
+ *
+ *
  */
-FUNC(Std_ReturnType, OS_CODE) Os_Ioc08EmptyQueue
+FUNC(Std_ReturnType, OS_CODE) Os_Ioc16ReceiveN
 (
-  P2CONST(Os_Ioc08ReceiveConfigType, TYPEDEF, OS_CONST) Ioc
+  P2CONST(Os_Ioc16ReceiveConfigType, TYPEDEF, OS_CONST) Ioc,
+  P2VAR(uint16, TYPEDEF, AUTOMATIC) Data,
+  uint32 Count,
+  P2VAR(uint32, TYPEDEF, AUTOMATIC) Received
 )
 {
-  Std_ReturnType status;
-
-  /* #10 If Ioc is not enabled: KernelPanic. */
-  if(Os_IocIsEnabled() == 0u)                                                                                           /* COV_OS_INVSTATE */ /* PRQA S 2992, 2996 */ /* MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2996 */
-  {
-    Os_ErrKernelPanic();
-  }
-
-  {
-    P2CONST(Os_AppConfigType, TYPEDEF, OS_CONST) currentApplication;
-    Os_AppAccessMaskType permittedApplications;
-
-    currentApplication = Os_ThreadGetCurrentApplication(Os_CoreGetThread());                                            /* SBSW_OS_IOC_THREADGETCURRENTAPPLICATION_001 */
-    permittedApplications = Os_IocGetAccessingApplications(&(Ioc->Ioc.Base));                                           /* SBSW_OS_FC_PRECONDITION */
-
-    /* #15 Perform static checks. */
-    if(OS_UNLIKELY(Os_AppCheckAccess(currentApplication, permittedApplications) == OS_CHECK_FAILED))                    /* SBSW_OS_IOC_APPCHECKACCESS_001 */
-    {
-      status = IOC_E_NOK;
-    }
-    else
-    {
-      /* #20 Redirect to FIFO. */
-      Os_Fifo08EmptyQueue(&(Ioc->FifoRead));                                                                            /* SBSW_OS_IOC_FIFO08EMPTYQUEUE_001 */
-
-      status = IOC_E_OK;
-    }
-  }
-
-  return status;
+  /* #10 Call the base class method. */
+  return Os_IocReceiveN(&(Ioc->Ioc), Ioc16Receive, Data, Count, Received);                                              /* SBSW_OS_FC_PRECONDITION */
 }
 
 
 /***********************************************************************************************************************
- *  Os_Ioc08EmptyMultiQueue()
+ *  Os_Ioc16EmptyQueue()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -2687,9 +4657,9 @@ FUNC(Std_ReturnType, OS_CODE) Os_Ioc08EmptyQueue
  *
  *
  */
-FUNC(Std_ReturnType, OS_CODE) Os_Ioc08EmptyMultiQueue                                                                   /* COV_OS_HALPLATFORMTESTEDASMULTICORE */
+FUNC(Std_ReturnType, OS_CODE) Os_Ioc16EmptyQueue
 (
-  P2CONST(Os_Ioc08MultiReceiveConfigType, TYPEDEF, OS_CONST) Ioc
+  P2CONST(Os_Ioc16ReceiveConfigType, TYPEDEF, OS_CONST) Ioc
 )
 {
   Std_ReturnType status;
@@ -2714,8 +4684,9 @@ FUNC(Std_ReturnType, OS_CODE) Os_Ioc08EmptyMultiQueue
     }
     else
     {
-      /* #20 Call the base class method. */
-      (void)Os_IocEmptyMultiQueue(&(Ioc->Ioc), Ioc08MultiReceive);                                                      /* SBSW_OS_FC_PRECONDITION */
+      /* #20 Redirect to FIFO. */
+      Os_Fifo16EmptyQueue(&(Ioc->FifoRead));                                                                            /* SBSW_OS_IOC_FIFO16EMPTYQUEUE_001 */
+
       status = IOC_E_OK;
     }
   }
@@ -2725,7 +4696,7 @@ FUNC(Std_ReturnType, OS_CODE) Os_Ioc08EmptyMultiQueue
 
 
 /***********************************************************************************************************************
- *  Os_Ioc08Send()
+ *  Os_Ioc16Send()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -2741,10 +4712,10 @@ FUNC(Std_ReturnType, OS_CODE) Os_Ioc08EmptyMultiQueue
  *
  *
  */
-FUNC(Std_ReturnType, OS_CODE) Os_Ioc08Send
+FUNC(Std_ReturnType, OS_CODE) Os_Ioc16Send
 (
-  P2CONST(Os_Ioc08SendConfigType, TYPEDEF, OS_CONST) Ioc,
-  uint8 Data
+  P2CONST(Os_Ioc16SendConfigType, TYPEDEF, OS_CONST) Ioc,
+  uint16 Data
 )
 {
   Std_ReturnType status;
@@ -2778,7 +4749,7 @@ FUNC(Std_ReturnType, OS_CODE) Os_Ioc08Send
       Os_IocLock(&(Ioc->Ioc.Base), &interruptState);                                                                    /* SBSW_OS_IOC_IOCLOCK_001 */
 
       /* #30 Check that the channel is enabled and that the FIFO indices are in range. If not close the channel. */
-      if(OS_UNLIKELY(Os_IocChannelIsEnabled(&(Ioc->Ioc.Base)) == 0u))                                                   /* SBSW_OS_FC_PRECONDITION */ /* COV_OS_INVSTATE */
+      if(OS_UNLIKELY((Os_IocChannelIsEnabled(&(Ioc->Ioc.Base)) == 0u)))                                                 /* SBSW_OS_FC_PRECONDITION */ /* COV_OS_INVSTATE */
       {
         status = IOC_E_LIMIT;
       }
@@ -2787,7 +4758,7 @@ FUNC(Std_ReturnType, OS_CODE) Os_Ioc08Send
         Os_IocSendCloseChannel(&(Ioc->Ioc));                                                                            /* SBSW_OS_FC_PRECONDITION */
         status = IOC_E_LIMIT;
       }
-      else if(OS_UNLIKELY((Os_Fifo08IndicesInRangeOnWrite(&(Ioc->FifoWrite)) == 0u)))                                   /* SBSW_OS_FC_PRECONDITION */ /* COV_OS_INVSTATE */
+      else if(OS_UNLIKELY((Os_Fifo16IndicesInRangeOnWrite(&(Ioc->FifoWrite)) == 0u)))                                   /* SBSW_OS_FC_PRECONDITION */ /* COV_OS_INVSTATE */
       {
         Os_IocSendCloseChannel(&(Ioc->Ioc));                                                                            /* SBSW_OS_FC_PRECONDITION */
         status = IOC_E_LIMIT;
@@ -2795,15 +4766,18 @@ FUNC(Std_ReturnType, OS_CODE) Os_Ioc08Send
       else
       {
         /* #40 Try to write to the IOC buffer. */
-        result = Os_Fifo08Enqueue(&(Ioc->FifoWrite), Data);                                                             /* SBSW_OS_FC_PRECONDITION */
+        result = Os_Fifo16Enqueue(&(Ioc->FifoWrite), Data, Os_IocIsLockFree(&(Ioc->Ioc.Base)));                         /* SBSW_OS_FC_PRECONDITION */
 
         /* #50 If FIFO is already full: */
-        if(OS_UNLIKELY((OS_UNLIKELY(result == OS_FIFOWRITERESULT_BUFFEROVERFLOW))))
+        if(OS_UNLIKELY(result == OS_FIFOWRITERESULT_BUFFEROVERFLOW))
         {
           /* #60 Increment lost counter. */
           Os_IocIncrementLostCounter(&(Ioc->Ioc));                                                                      /* SBSW_OS_FC_PRECONDITION */
           status = IOC_E_LIMIT;
         }
+
+        /* #65 Mark the channel at a multiple receive IOC, also after a data loss, which has to be reported. */
+        Os_IocNotifyReceiver(&(Ioc->Ioc));                                                                              /* SBSW_OS_FC_PRECONDITION */
       }
 
       /* #70 Release the locks. */
@@ -2823,10 +4797,41 @@ FUNC(Std_ReturnType, OS_CODE) Os_Ioc08Send
 
 
 /***********************************************************************************************************************
- *  IOC 16
+ *  Os_Ioc16SendN()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ *
+ *
+ *
+ *
+ *
+ *
+ *
+ *
+ */
+FUNC(Std_ReturnType, OS_CODE) Os_Ioc16SendN
+(
+  P2CONST(Os_Ioc16SendConfigType, TYPEDEF, OS_CONST) Ioc,
+  P2CONST(uint16, TYPEDEF, AUTOMATIC) Data,
+  uint32 Count,
+  P2VAR(uint32, TYPEDEF, AUTOMATIC) Sent
+)
+{
+  /* #10 Call the base class method. */
+  return Os_IocSendN(&(Ioc->Ioc), Ioc16Send, Data, Count, Sent);                                                        /* SBSW_OS_FC_PRECONDITION */
+}
+
+
+/***********************************************************************************************************************
+ *  IOC 32
  **********************************************************************************************************************/
 /***********************************************************************************************************************
- *  Os_Ioc16ReceiveInit()
+ *  Os_Ioc32ReceiveInit()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -2834,21 +4839,21 @@ FUNC(Std_ReturnType, OS_CODE) Os_Ioc08Send
  *
  *
  */
-OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE, Os_Ioc16ReceiveInit,
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE, Os_Ioc32ReceiveInit,
 (
-  P2CONST(Os_Ioc16ReceiveConfigType, TYPEDEF, OS_CONST) Ioc
+  P2CONST(Os_Ioc32ReceiveConfigType, TYPEDEF, OS_CONST) Ioc
 ))
 {
   /* #10 Initialize the base class. */
   Os_IocReceiveInit(&(Ioc->Ioc));                                                                                       /* SBSW_OS_FC_PRECONDITION */
 
   /* #20 Initialize all fields. */
-  Os_Fifo16ReadInit(&(Ioc->FifoRead));                                                                                  /* SBSW_OS_FC_PRECONDITION */
+  Os_Fifo32ReadInit(&(Ioc->FifoRead));                                                                                  /* SBSW_OS_FC_PRECONDITION */
 }
 
 
 /***********************************************************************************************************************
- *  Os_Ioc16SendInit()
+ *  Os_Ioc32SendInit()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -2856,21 +4861,21 @@ OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE, Os
  *
  *
  */
-OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE, Os_Ioc16SendInit,
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE, Os_Ioc32SendInit,
 (
-  P2CONST(Os_Ioc16SendConfigType, TYPEDEF, OS_CONST) Ioc
+  P2CONST(Os_Ioc32SendConfigType, TYPEDEF, OS_CONST) Ioc
 ))
 {
   /* #10 Initialize the base class. */
   Os_IocSendInit(&(Ioc->Ioc));                                                                                          /* SBSW_OS_FC_PRECONDITION */
 
   /* #20 Initialize all fields. */
-  Os_Fifo16WriteInit(&(Ioc->FifoWrite));                                                                                /* SBSW_OS_FC_PRECONDITION */
+  Os_Fifo32WriteInit(&(Ioc->FifoWrite));                                                                                /* SBSW_OS_FC_PRECONDITION */
 }
 
 
 /***********************************************************************************************************************
- *  Os_Ioc16MultiReceive()
+ *  Os_Ioc32MultiReceive()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -2886,10 +4891,10 @@ OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE, Os
  *
  *
  */
-FUNC(Std_ReturnType, OS_CODE) Os_Ioc16MultiReceive
+FUNC(Std_ReturnType, OS_CODE) Os_Ioc32MultiReceive
 (
-  P2CONST(Os_Ioc16MultiReceiveConfigType, TYPEDEF, OS_CONST) Ioc,
-  P2VAR(uint16, TYPEDEF, AUTOMATIC) Data
+  P2CONST(Os_Ioc32MultiReceiveConfigType, TYPEDEF, OS_CONST) Ioc,
+  P2VAR(uint32, TYPEDEF, AUTOMATIC) Data
 )
 {
   Os_IocInternalReturnType status;
@@ -2923,7 +4928,7 @@ FUNC(Std_ReturnType, OS_CODE) Os_Ioc16MultiReceive
       /* #30 Perform checks. */
       if(OS_UNLIKELY(Os_IocChannelIsEnabled(&(Ioc->Ioc.Base)) == 0u))                                                   /* SBSW_OS_FC_PRECONDITION */ /* COV_OS_INVSTATE */
       {
-        /* OS_IOC_E_INTERNAL_CHANNEL_CLOSED makes no sense here as it is not stated to the caller anyhow */
+        /* OS_IOC_E_INTERNAL_CHANNEL_CLOSED makes no sense here as it is not stated to the caller anyhow. */
         status = OS_IOC_E_INTERNAL_NO_DATA;
       }
       else
@@ -2936,23 +4941,31 @@ FUNC(Std_ReturnType, OS_CODE) Os_Ioc16MultiReceive
 
         status = OS_IOC_E_INTERNAL_NO_DATA;
 
-        /* #40 For each IOC channel, beginning from where last receive ended: */
-        for(receiveChannelCounter = 0; receiveChannelCounter < (Os_ObjIdx_IteratorType) Ioc->Ioc.ReceiveChannelCount;   /* COV_OS_HALPLATFORMTESTEDASMULTICORE */
-            receiveChannelCounter++)
+        /* #40 If the senders mark the channels, which may contain data, visit the marked channels only. */
+        if(Os_IocMultiReceiveUsesReadyMask(&(Ioc->Ioc)) != 0u)                                                          /* SBSW_OS_FC_PRECONDITION */
         {
-          /* #50 Read from the IOC channel. */
-          status = Os_Ioc16ReceiveInternal(&(Ioc->Receivers[currentReceiveIdx]), Data);                                 /* SBSW_OS_IOC_IOC16RECEIVEINTERNAL_001 */
-
-          /* #60 If the channel contained data or an error occurred, abort looking for data. */
-          if (status != OS_IOC_E_INTERNAL_NO_DATA)
+          status = Os_IocMultiReceiveReady(&(Ioc->Ioc), Ioc32MultiReceive, Data);                                       /* SBSW_OS_FC_PRECONDITION */
+        }
+        else
+        {
+          /* #44 Otherwise, for each IOC channel, beginning from where last receive ended: */
+          for(receiveChannelCounter = 0; receiveChannelCounter < (Os_ObjIdx_IteratorType) Ioc->Ioc.ReceiveChannelCount; /* COV_OS_HALPLATFORMTESTEDASMULTICORE */
+              receiveChannelCounter++)
           {
-            break;
-          }
+            /* #50 Read from the IOC channel. */
+            status = Os_Ioc32ReceiveInternal(&(Ioc->Receivers[currentReceiveIdx]), Data);                               /* SBSW_OS_IOC_IOC32RECEIVEINTERNAL_001 */
 
-          currentReceiveIdx++;
-          if (currentReceiveIdx >= (Os_ObjIdx_IteratorType) Ioc->Ioc.ReceiveChannelCount)                               /* COV_OS_HALPLATFORMTESTEDASMULTICORE */
-          {
-            currentReceiveIdx = 0;
+            /* #60 If the channel contained data or an error occurred, abort looking for data. */
+            if (status != OS_IOC_E_INTERNAL_NO_DATA)
+            {
+              break;
+            }
+
+            currentReceiveIdx++;
+            if (currentReceiveIdx >= (Os_ObjIdx_IteratorType) Ioc->Ioc.ReceiveChannelCount)                             /* COV_OS_HALPLATFORMTESTEDASMULTICORE */
+            {
+              currentReceiveIdx = 0;
+            }
           }
         }
 
@@ -2997,7 +5010,7 @@ FUNC(Std_ReturnType, OS_CODE) Os_Ioc16MultiReceive
 
 
 /***********************************************************************************************************************
- *  Os_Ioc16EmptyMultiQueue()
+ *  Os_Ioc32Receive()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -3005,13 +5018,17 @@ FUNC(Std_ReturnType, OS_CODE) Os_Ioc16MultiReceive
  *
  *
  *
+ *
+ *
+ *
  */
-FUNC(Std_ReturnType, OS_CODE) Os_Ioc16EmptyMultiQueue                                                                   /* COV_OS_HALPLATFORMTESTEDASMULTICORE */
+FUNC(Std_ReturnType, OS_CODE) Os_Ioc32Receive
 (
-  P2CONST(Os_Ioc16MultiReceiveConfigType, TYPEDEF, OS_CONST) Ioc
+  P2CONST(Os_Ioc32ReceiveConfigType, TYPEDEF, OS_CONST) Ioc,
+  P2VAR(uint32, TYPEDEF, AUTOMATIC) Data
 )
 {
-  Std_ReturnType status;
+  Os_IocInternalReturnType status;
 
   /* #10 If Ioc is not enabled: KernelPanic. */
   if(Os_IocIsEnabled() == 0u)                                                                                           /* COV_OS_INVSTATE */ /* PRQA S 2992, 2996 */ /* MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2996 */
@@ -3026,25 +5043,49 @@ FUNC(Std_ReturnType, OS_CODE) Os_Ioc16EmptyMultiQueue
     currentApplication = Os_ThreadGetCurrentApplication(Os_CoreGetThread());                                            /* SBSW_OS_IOC_THREADGETCURRENTAPPLICATION_001 */
     permittedApplications = Os_IocGetAccessingApplications(&(Ioc->Ioc.Base));                                           /* SBSW_OS_FC_PRECONDITION */
 
-    /* #15 Perform static checks. */
+    /* #15 Perform checks. */
     if(OS_UNLIKELY(Os_AppCheckAccess(currentApplication, permittedApplications) == OS_CHECK_FAILED))                    /* SBSW_OS_IOC_APPCHECKACCESS_001 */
     {
-      status = IOC_E_NOK;
+      status = OS_IOC_E_INTERNAL_NOK;
     }
     else
     {
-      /* #20 Call the base class method. */
-      (void)Os_IocEmptyMultiQueue(&(Ioc->Ioc), Ioc16MultiReceive);                                                      /* SBSW_OS_FC_PRECONDITION */
-      status = IOC_E_OK;
+      OS_JUSTIFY_NOINIT(Os_IntStateType interruptState);
+
+      /* #20 Get the locks. */
+      Os_IocLock(&(Ioc->Ioc.Base), &interruptState);                                                                    /* SBSW_OS_IOC_IOCLOCK_001 */
+
+      /* #30 Call internal receive function */
+      status = Os_Ioc32ReceiveInternal(Ioc, Data);                                                                      /* SBSW_OS_FC_PRECONDITION */
+
+      /* #40 Correct the return value and close the channel if necessary */
+      if(OS_UNLIKELY((status == OS_IOC_E_INTERNAL_CLOSE_CHANNEL)))                                                      /* COV_OS_INVSTATE */
+      {
+        Os_IocReceiveCloseChannel(&(Ioc->Ioc));                                                                         /* SBSW_OS_FC_PRECONDITION */
+        /* OS_IOC_E_INTERNAL_CLOSE_CHANNEL in not known externally, other return values are numerical identical */
+        status = OS_IOC_E_INTERNAL_NO_DATA;
+      }
+      else if(OS_UNLIKELY((status == OS_IOC_E_INTERNAL_CHANNEL_CLOSED)))                                                /* COV_OS_INVSTATE */
+      {
+        /* OS_IOC_E_INTERNAL_CHANNEL_CLOSED in not known externally, other return values are numerical identical */
+        status = OS_IOC_E_INTERNAL_NO_DATA;
+      }
+      else
+      {
+        /* status does not need to be changed. MISRA 14.10 */
+      }
+
+      /* #50 Release the locks. */
+      Os_IocUnlock(&(Ioc->Ioc.Base), &interruptState);                                                                  /* SBSW_OS_IOC_IOCUNLOCK_001 */
     }
   }
 
-  return status;
-}
+  return (Std_ReturnType) status;
+}                                                                                                                       /* PRQA S 6050 */ /* MD_MSR_STCAL */
 
 
 /***********************************************************************************************************************
- *  Os_Ioc16Receive()
+ *  Os_Ioc32ReceiveN()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -3055,14 +5096,37 @@ FUNC(Std_ReturnType, OS_CODE) Os_Ioc16EmptyMultiQueue
  *
  *
  *
+ *
  */
-FUNC(Std_ReturnType, OS_CODE) Os_Ioc16Receive
+FUNC(Std_ReturnType, OS_CODE) Os_Ioc32ReceiveN
 (
-  P2CONST(Os_Ioc16ReceiveConfigType, TYPEDEF, OS_CONST) Ioc,
-  P2VAR(uint16, TYPEDEF, AUTOMATIC) Data
+  P2CONST(Os_Ioc32ReceiveConfigType, TYPEDEF, OS_CONST) Ioc,
+  P2VAR(uint32, TYPEDEF, AUTOMATIC) Data,
+  uint32 Count,
+  P2VAR(uint32, TYPEDEF, AUTOMATIC) Received
 )
 {
-  Os_IocInternalReturnType status;
+  /* #10 Call the base class method. */
+  return Os_IocReceiveN(&(Ioc->Ioc), Ioc32Receive, Data, Count, Received);                                              /* SBSW_OS_FC_PRECONDITION */
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Ioc32EmptyQueue()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ */
+FUNC(Std_ReturnType, OS_CODE) Os_Ioc32EmptyQueue
+(
+  P2CONST(Os_Ioc32ReceiveConfigType, TYPEDEF, OS_CONST) Ioc
+)
+{
+  Std_ReturnType status;
 
   /* #10 If Ioc is not enabled: KernelPanic. */
   if(Os_IocIsEnabled() == 0u)                                                                                           /* COV_OS_INVSTATE */ /* PRQA S 2992, 2996 */ /* MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2996 */
@@ -3080,46 +5144,23 @@ FUNC(Std_ReturnType, OS_CODE) Os_Ioc16Receive
     /* #15 Perform checks. */
     if(OS_UNLIKELY(Os_AppCheckAccess(currentApplication, permittedApplications) == OS_CHECK_FAILED))                    /* SBSW_OS_IOC_APPCHECKACCESS_001 */
     {
-      status = OS_IOC_E_INTERNAL_NOK;
+      status = IOC_E_NOK;
     }
     else
     {
-      OS_JUSTIFY_NOINIT(Os_IntStateType interruptState);
-
-      /* #20 Get the locks. */
-      Os_IocLock(&(Ioc->Ioc.Base), &interruptState);                                                                    /* SBSW_OS_IOC_IOCLOCK_001 */
-
-      /* #30 Call internal receive function */
-      status = Os_Ioc16ReceiveInternal(Ioc, Data);                                                                      /* SBSW_OS_FC_PRECONDITION */
-
-      /* #40 Correct the return value and close the channel if necessary */
-      if(OS_UNLIKELY((status == OS_IOC_E_INTERNAL_CLOSE_CHANNEL)))                                                      /* COV_OS_INVSTATE */
-      {
-        Os_IocReceiveCloseChannel(&(Ioc->Ioc));                                                                         /* SBSW_OS_FC_PRECONDITION */
-        /* OS_IOC_E_INTERNAL_CLOSE_CHANNEL in not known externally, other return values are numerical identical */
-        status = OS_IOC_E_INTERNAL_NO_DATA;
-      }
-      else if(OS_UNLIKELY((status == OS_IOC_E_INTERNAL_CHANNEL_CLOSED)))                                                /* COV_OS_INVSTATE */
-      {
-        /* OS_IOC_E_INTERNAL_CHANNEL_CLOSED in not known externally, other return values are numerical identical */
-        status = OS_IOC_E_INTERNAL_NO_DATA;
-      }
-      else
-      {
-        /* status does not need to be changed. MISRA 14.10 */
-      }
+      /* #20 Redirect to FIFO. */
+      Os_Fifo32EmptyQueue(&(Ioc->FifoRead));                                                                            /* SBSW_OS_IOC_FIFO32EMPTYQUEUE_001 */
 
-      /* #50 Release the locks. */
-      Os_IocUnlock(&(Ioc->Ioc.Base), &interruptState);                                                                  /* SBSW_OS_IOC_IOCUNLOCK_001 */
+      status = IOC_E_OK;
     }
   }
 
-  return (Std_ReturnType) status;
-}                                                                                                                       /* PRQA S 6050 */ /* MD_MSR_STCAL */
+  return status;
+}
 
 
 /***********************************************************************************************************************
- *  Os_Ioc16EmptyQueue()
+ *  Os_Ioc32EmptyMultiQueue()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -3128,9 +5169,9 @@ FUNC(Std_ReturnType, OS_CODE) Os_Ioc16Receive
  *
  *
  */
-FUNC(Std_ReturnType, OS_CODE) Os_Ioc16EmptyQueue
+FUNC(Std_ReturnType, OS_CODE) Os_Ioc32EmptyMultiQueue                                                                   /* COV_OS_HALPLATFORMTESTEDASMULTICORE */
 (
-  P2CONST(Os_Ioc16ReceiveConfigType, TYPEDEF, OS_CONST) Ioc
+  P2CONST(Os_Ioc32MultiReceiveConfigType, TYPEDEF, OS_CONST) Ioc
 )
 {
   Std_ReturnType status;
@@ -3155,9 +5196,8 @@ FUNC(Std_ReturnType, OS_CODE) Os_Ioc16EmptyQueue
     }
     else
     {
-      /* #20 Redirect to FIFO. */
-      Os_Fifo16EmptyQueue(&(Ioc->FifoRead));                                                                            /* SBSW_OS_IOC_FIFO16EMPTYQUEUE_001 */
-
+      /* #20 Call the base class method. */
+      (void)Os_IocEmptyMultiQueue(&(Ioc->Ioc), Ioc32MultiReceive);                                                      /* SBSW_OS_FC_PRECONDITION */
       status = IOC_E_OK;
     }
   }
@@ -3167,7 +5207,7 @@ FUNC(Std_ReturnType, OS_CODE) Os_Ioc16EmptyQueue
 
 
 /***********************************************************************************************************************
- *  Os_Ioc16Send()
+ *  Os_Ioc32Send()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -3183,10 +5223,10 @@ FUNC(Std_ReturnType, OS_CODE) Os_Ioc16EmptyQueue
  *
  *
  */
-FUNC(Std_ReturnType, OS_CODE) Os_Ioc16Send
+FUNC(Std_ReturnType, OS_CODE) Os_Ioc32Send
 (
-  P2CONST(Os_Ioc16SendConfigType, TYPEDEF, OS_CONST) Ioc,
-  uint16 Data
+  P2CONST(Os_Ioc32SendConfigType, TYPEDEF, OS_CONST) Ioc,
+  uint32 Data
 )
 {
   Std_ReturnType status;
@@ -3224,12 +5264,12 @@ FUNC(Std_ReturnType, OS_CODE) Os_Ioc16Send
       {
         status = IOC_E_LIMIT;
       }
-      else if(OS_UNLIKELY((Os_IocChannelIsEnabled(&(Ioc->Ioc.Receive->Base)) == 0u)))                                   /* SBSW_OS_IOC_IOCCHANNELISENABLED_002 */ /* COV_OS_INVSTATE */
+      else if(OS_UNLIKELY((Os_IocChannelIsEnabled(&(Ioc->Ioc.Receive->Base)) == 0u)))                                   /* SBSW_OS_IOC_IOCCHANNELISENABLED_001 */ /* COV_OS_INVSTATE */
       {
         Os_IocSendCloseChannel(&(Ioc->Ioc));                                                                            /* SBSW_OS_FC_PRECONDITION */
         status = IOC_E_LIMIT;
       }
-      else if(OS_UNLIKELY((Os_Fifo16IndicesInRangeOnWrite(&(Ioc->FifoWrite)) == 0u)))                                   /* SBSW_OS_FC_PRECONDITION */ /* COV_OS_INVSTATE */
+      else if(OS_UNLIKELY((Os_Fifo32IndicesInRangeOnWrite(&(Ioc->FifoWrite)) == 0u)))                                   /* SBSW_OS_FC_PRECONDITION */ /* COV_OS_INVSTATE */
       {
         Os_IocSendCloseChannel(&(Ioc->Ioc));                                                                            /* SBSW_OS_FC_PRECONDITION */
         status = IOC_E_LIMIT;
@@ -3237,7 +5277,7 @@ FUNC(Std_ReturnType, OS_CODE) Os_Ioc16Send
       else
       {
         /* #40 Try to write to the IOC buffer. */
-        result = Os_Fifo16Enqueue(&(Ioc->FifoWrite), Data);                                                             /* SBSW_OS_FC_PRECONDITION */
+        result = Os_Fifo32Enqueue(&(Ioc->FifoWrite), Data, Os_IocIsLockFree(&(Ioc->Ioc.Base)));                         /* SBSW_OS_FC_PRECONDITION */
 
         /* #50 If FIFO is already full: */
         if(OS_UNLIKELY(result == OS_FIFOWRITERESULT_BUFFEROVERFLOW))
@@ -3246,6 +5286,9 @@ FUNC(Std_ReturnType, OS_CODE) Os_Ioc16Send
           Os_IocIncrementLostCounter(&(Ioc->Ioc));                                                                      /* SBSW_OS_FC_PRECONDITION */
           status = IOC_E_LIMIT;
         }
+
+        /* #65 Mark the channel at a multiple receive IOC, also after a data loss, which has to be reported. */
+        Os_IocNotifyReceiver(&(Ioc->Ioc));                                                                              /* SBSW_OS_FC_PRECONDITION */
       }
 
       /* #70 Release the locks. */
@@ -3265,10 +5308,41 @@ FUNC(Std_ReturnType, OS_CODE) Os_Ioc16Send
 
 
 /***********************************************************************************************************************
- *  IOC 32
+ *  Os_Ioc32SendN()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ *
+ *
+ *
+ *
+ *
+ *
+ *
+ *
+ */
+FUNC(Std_ReturnType, OS_CODE) Os_Ioc32SendN
+(
+  P2CONST(Os_Ioc32SendConfigType, TYPEDEF, OS_CONST) Ioc,
+  P2CONST(uint32, TYPEDEF, AUTOMATIC) Data,
+  uint32 Count,
+  P2VAR(uint32, TYPEDEF, AUTOMATIC) Sent
+)
+{
+  /* #10 Call the base class method. */
+  return Os_IocSendN(&(Ioc->Ioc), Ioc32Send, Data, Count, Sent);                                                        /* SBSW_OS_FC_PRECONDITION */
+}
+
+
+/***********************************************************************************************************************
+ *  IOC Ref
  **********************************************************************************************************************/
 /***********************************************************************************************************************
- *  Os_Ioc32ReceiveInit()
+ *  Os_IocRefReceiveInit()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -3276,21 +5350,21 @@ FUNC(Std_ReturnType, OS_CODE) Os_Ioc16Send
  *
  *
  */
-OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE, Os_Ioc32ReceiveInit,
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE, Os_IocRefReceiveInit,
 (
-  P2CONST(Os_Ioc32ReceiveConfigType, TYPEDEF, OS_CONST) Ioc
+  P2CONST(Os_IocRefReceiveConfigType, TYPEDEF, OS_CONST) Ioc
 ))
 {
   /* #10 Initialize the base class. */
   Os_IocReceiveInit(&(Ioc->Ioc));                                                                                       /* SBSW_OS_FC_PRECONDITION */
 
   /* #20 Initialize all fields. */
-  Os_Fifo32ReadInit(&(Ioc->FifoRead));                                                                                  /* SBSW_OS_FC_PRECONDITION */
+  Os_FifoRefReadInit(&(Ioc->FifoRead));                                                                                 /* SBSW_OS_FC_PRECONDITION */
 }
 
 
 /***********************************************************************************************************************
- *  Os_Ioc32SendInit()
+ *  Os_IocRefSendInit()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -3298,21 +5372,21 @@ OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE, Os
  *
  *
  */
-OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE, Os_Ioc32SendInit,
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE, Os_IocRefSendInit,
 (
-  P2CONST(Os_Ioc32SendConfigType, TYPEDEF, OS_CONST) Ioc
+  P2CONST(Os_IocRefSendConfigType, TYPEDEF, OS_CONST) Ioc
 ))
 {
   /* #10 Initialize the base class. */
   Os_IocSendInit(&(Ioc->Ioc));                                                                                          /* SBSW_OS_FC_PRECONDITION */
 
   /* #20 Initialize all fields. */
-  Os_Fifo32WriteInit(&(Ioc->FifoWrite));                                                                                /* SBSW_OS_FC_PRECONDITION */
+  Os_FifoRefWriteInit(&(Ioc->FifoWrite));                                                                               /* SBSW_OS_FC_PRECONDITION */
 }
 
 
 /***********************************************************************************************************************
- *  Os_Ioc32MultiReceive()
+ *  Os_IocRefMultiReceive()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -3326,12 +5400,11 @@ OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE, Os
  *
  *
  *
- *
  */
-FUNC(Std_ReturnType, OS_CODE) Os_Ioc32MultiReceive
+FUNC(Std_ReturnType, OS_CODE) Os_IocRefMultiReceive
 (
-  P2CONST(Os_Ioc32MultiReceiveConfigType, TYPEDEF, OS_CONST) Ioc,
-  P2VAR(uint32, TYPEDEF, AUTOMATIC) Data
+  P2CONST(Os_IocRefMultiReceiveConfigType, TYPEDEF, OS_CONST) Ioc,
+  P2VAR(void, TYPEDEF, AUTOMATIC) Data
 )
 {
   Os_IocInternalReturnType status;
@@ -3343,26 +5416,24 @@ FUNC(Std_ReturnType, OS_CODE) Os_Ioc32MultiReceive
   }
 
   {
+    OS_JUSTIFY_NOINIT(Os_IntStateType intState);
+    Os_ObjIdx_IteratorType currentReceiveIdx;
     P2CONST(Os_AppConfigType, TYPEDEF, OS_CONST) currentApplication;
     Os_AppAccessMaskType permittedApplications;
 
     currentApplication = Os_ThreadGetCurrentApplication(Os_CoreGetThread());                                            /* SBSW_OS_IOC_THREADGETCURRENTAPPLICATION_001 */
     permittedApplications = Os_IocGetAccessingApplications(&(Ioc->Ioc.Base));                                           /* SBSW_OS_FC_PRECONDITION */
 
-    /* #15 Perform static checks. */
+    /* #15 Perform checks. */
     if(OS_UNLIKELY(Os_AppCheckAccess(currentApplication, permittedApplications) == OS_CHECK_FAILED))                    /* SBSW_OS_IOC_APPCHECKACCESS_001 */
     {
       status = OS_IOC_E_INTERNAL_NOK;
     }
     else
     {
-      OS_JUSTIFY_NOINIT(Os_IntStateType intState);
-      Os_ObjIdx_IteratorType currentReceiveIdx;
-
       /* #20 Get the locks. */
       Os_IocLock(&(Ioc->Ioc.Base), &intState);                                                                          /* SBSW_OS_IOC_IOCLOCK_001 */
 
-      /* #30 Perform checks. */
       if(OS_UNLIKELY(Os_IocChannelIsEnabled(&(Ioc->Ioc.Base)) == 0u))                                                   /* SBSW_OS_FC_PRECONDITION */ /* COV_OS_INVSTATE */
       {
         /* OS_IOC_E_INTERNAL_CHANNEL_CLOSED makes no sense here as it is not stated to the caller anyhow. */
@@ -3378,27 +5449,35 @@ FUNC(Std_ReturnType, OS_CODE) Os_Ioc32MultiReceive
 
         status = OS_IOC_E_INTERNAL_NO_DATA;
 
-        /* #40 For each IOC channel, beginning from where last receive ended: */
-        for(receiveChannelCounter = 0; receiveChannelCounter < (Os_ObjIdx_IteratorType) Ioc->Ioc.ReceiveChannelCount;   /* COV_OS_HALPLATFORMTESTEDASMULTICORE */
-            receiveChannelCounter++)
+        /* #30 If the senders mark the channels, which may contain data, visit the marked channels only. */
+        if(Os_IocMultiReceiveUsesReadyMask(&(Ioc->Ioc)) != 0u)                                                          /* SBSW_OS_FC_PRECONDITION */
         {
-          /* #50 Read from the IOC channel. */
-          status = Os_Ioc32ReceiveInternal(&(Ioc->Receivers[currentReceiveIdx]), Data);                                 /* SBSW_OS_IOC_IOC32RECEIVEINTERNAL_001 */
-
-          /* #60 If the channel contained data or an error occurred, abort looking for data. */
-          if (status != OS_IOC_E_INTERNAL_NO_DATA)
+          status = Os_IocMultiReceiveReady(&(Ioc->Ioc), IocRefMultiReceive, Data);                                      /* SBSW_OS_FC_PRECONDITION */
+        }
+        else
+        {
+          /* #34 Otherwise, for each IOC channel, beginning from where last receive ended: */
+          for(receiveChannelCounter = 0; receiveChannelCounter < (Os_ObjIdx_IteratorType) Ioc->Ioc.ReceiveChannelCount; /* COV_OS_HALPLATFORMTESTEDASMULTICORE */
+              receiveChannelCounter++)
           {
-            break;
-          }
+            /* #40 Read from the IOC channel. */
+            status = Os_IocRefReceiveInternal(&(Ioc->Receivers[currentReceiveIdx]), Data);                              /* SBSW_OS_IOC_IOCREFRECEIVEINTERNAL_001 */
 
-          currentReceiveIdx++;
-          if (currentReceiveIdx >= (Os_ObjIdx_IteratorType) Ioc->Ioc.ReceiveChannelCount)                               /* COV_OS_HALPLATFORMTESTEDASMULTICORE */
-          {
-            currentReceiveIdx = 0;
+            /* #50 If the channel contained data or an error occurred, abort looking for data. */
+            if (status != OS_IOC_E_INTERNAL_NO_DATA)
+            {
+              break;
+            }
+
+            currentReceiveIdx++;
+            if (currentReceiveIdx >= (Os_ObjIdx_IteratorType) Ioc->Ioc.ReceiveChannelCount)                             /* COV_OS_HALPLATFORMTESTEDASMULTICORE */
+            {
+              currentReceiveIdx = 0;
+            }
           }
         }
 
-        /* #70 Close all channels if an error has been detected. */
+        /* #60 Close all channels if an error has been detected. */
         switch(status)
         {
           case OS_IOC_E_INTERNAL_OK:
@@ -3422,14 +5501,15 @@ FUNC(Std_ReturnType, OS_CODE) Os_Ioc32MultiReceive
             break;
         }
 
-        /* #80 Compute the channel index for next IOC receive call. */
+        /* #70 Compute the channel index for next IOC receive call. */
         dyn->NextReceiveChannel++;                                                                                      /* PRQA S 3387 */ /* MD_Os_Rule13.3_3387 */ /* SBSW_OS_IOC_IOCMULTIRECEIVEGETDYN_001 */
         if (dyn->NextReceiveChannel >= Ioc->Ioc.ReceiveChannelCount)
         {
           dyn->NextReceiveChannel = 0;                                                                                  /* SBSW_OS_IOC_IOCMULTIRECEIVEGETDYN_001 */
         }
       }
-      /* #90 Release the locks. */
+
+      /* #80 Release the locks. */
       Os_IocUnlock(&(Ioc->Ioc.Base), &intState);                                                                        /* SBSW_OS_IOC_IOCUNLOCK_001 */
     }
   }
@@ -3439,7 +5519,7 @@ FUNC(Std_ReturnType, OS_CODE) Os_Ioc32MultiReceive
 
 
 /***********************************************************************************************************************
- *  Os_Ioc32Receive()
+ *  Os_IocRefReceive()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -3451,10 +5531,10 @@ FUNC(Std_ReturnType, OS_CODE) Os_Ioc32MultiReceive
  *
  *
  */
-FUNC(Std_ReturnType, OS_CODE) Os_Ioc32Receive
+FUNC(Std_ReturnType, OS_CODE) Os_IocRefReceive
 (
-  P2CONST(Os_Ioc32ReceiveConfigType, TYPEDEF, OS_CONST) Ioc,
-  P2VAR(uint32, TYPEDEF, AUTOMATIC) Data
+  P2CONST(Os_IocRefReceiveConfigType, TYPEDEF, OS_CONST) Ioc,
+  P2VAR(void, TYPEDEF, AUTOMATIC) Data
 )
 {
   Os_IocInternalReturnType status;
@@ -3485,7 +5565,7 @@ FUNC(Std_ReturnType, OS_CODE) Os_Ioc32Receive
       Os_IocLock(&(Ioc->Ioc.Base), &interruptState);                                                                    /* SBSW_OS_IOC_IOCLOCK_001 */
 
       /* #30 Call internal receive function */
-      status = Os_Ioc32ReceiveInternal(Ioc, Data);                                                                      /* SBSW_OS_FC_PRECONDITION */
+      status = Os_IocRefReceiveInternal(Ioc, Data);                                                                     /* SBSW_OS_FC_PRECONDITION */
 
       /* #40 Correct the return value and close the channel if necessary */
       if(OS_UNLIKELY((status == OS_IOC_E_INTERNAL_CLOSE_CHANNEL)))                                                      /* COV_OS_INVSTATE */
@@ -3514,7 +5594,7 @@ FUNC(Std_ReturnType, OS_CODE) Os_Ioc32Receive
 
 
 /***********************************************************************************************************************
- *  Os_Ioc32EmptyQueue()
+ *  Os_IocRefEmptyQueue()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -3523,9 +5603,9 @@ FUNC(Std_ReturnType, OS_CODE) Os_Ioc32Receive
  *
  *
  */
-FUNC(Std_ReturnType, OS_CODE) Os_Ioc32EmptyQueue
+FUNC(Std_ReturnType, OS_CODE) Os_IocRefEmptyQueue
 (
-  P2CONST(Os_Ioc32ReceiveConfigType, TYPEDEF, OS_CONST) Ioc
+  P2CONST(Os_IocRefReceiveConfigType, TYPEDEF, OS_CONST) Ioc
 )
 {
   Std_ReturnType status;
@@ -3551,7 +5631,7 @@ FUNC(Std_ReturnType, OS_CODE) Os_Ioc32EmptyQueue
     else
     {
       /* #20 Redirect to FIFO. */
-      Os_Fifo32EmptyQueue(&(Ioc->FifoRead));                                                                            /* SBSW_OS_IOC_FIFO32EMPTYQUEUE_001 */
+      Os_FifoRefEmptyQueue(&(Ioc->FifoRead));                                                                           /* SBSW_OS_IOC_FIFOREFEMPTYQUEUE_001 */
 
       status = IOC_E_OK;
     }
@@ -3562,7 +5642,7 @@ FUNC(Std_ReturnType, OS_CODE) Os_Ioc32EmptyQueue
 
 
 /***********************************************************************************************************************
- *  Os_Ioc32EmptyMultiQueue()
+ *  Os_IocRefEmptyMultiQueue()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -3571,9 +5651,9 @@ FUNC(Std_ReturnType, OS_CODE) Os_Ioc32EmptyQueue
  *
  *
  */
-FUNC(Std_ReturnType, OS_CODE) Os_Ioc32EmptyMultiQueue                                                                   /* COV_OS_HALPLATFORMTESTEDASMULTICORE */
+FUNC(Std_ReturnType, OS_CODE) Os_IocRefEmptyMultiQueue                                                                  /* COV_OS_HALPLATFORMTESTEDASMULTICORE */
 (
-  P2CONST(Os_Ioc32MultiReceiveConfigType, TYPEDEF, OS_CONST) Ioc
+  P2CONST(Os_IocRefMultiReceiveConfigType, TYPEDEF, OS_CONST) Ioc
 )
 {
   Std_ReturnType status;
@@ -3599,7 +5679,7 @@ FUNC(Std_ReturnType, OS_CODE) Os_Ioc32EmptyMultiQueue
     else
     {
       /* #20 Call the base class method. */
-      (void)Os_IocEmptyMultiQueue(&(Ioc->Ioc), Ioc32MultiReceive);                                                      /* SBSW_OS_FC_PRECONDITION */
+      (void)Os_IocEmptyMultiQueue(&(Ioc->Ioc), IocRefMultiReceive);                                                     /* SBSW_OS_FC_PRECONDITION */
       status = IOC_E_OK;
     }
   }
@@ -3609,7 +5689,7 @@ FUNC(Std_ReturnType, OS_CODE) Os_Ioc32EmptyMultiQueue
 
 
 /***********************************************************************************************************************
- *  Os_Ioc32Send()
+ *  Os_IocRefSend()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -3625,10 +5705,10 @@ FUNC(Std_ReturnType, OS_CODE) Os_Ioc32EmptyMultiQueue
  *
  *
  */
-FUNC(Std_ReturnType, OS_CODE) Os_Ioc32Send
+FUNC(Std_ReturnType, OS_CODE) Os_IocRefSend
 (
-  P2CONST(Os_Ioc32SendConfigType, TYPEDEF, OS_CONST) Ioc,
-  uint32 Data
+  P2CONST(Os_IocRefSendConfigType, TYPEDEF, OS_CONST) Ioc,
+  P2CONST(void, TYPEDEF, AUTOMATIC) Data
 )
 {
   Std_ReturnType status;
@@ -3666,220 +5746,56 @@ FUNC(Std_ReturnType, OS_CODE) Os_Ioc32Send
       {
         status = IOC_E_LIMIT;
       }
-      else if(OS_UNLIKELY((Os_IocChannelIsEnabled(&(Ioc->Ioc.Receive->Base)) == 0u)))                                   /* SBSW_OS_IOC_IOCCHANNELISENABLED_001 */ /* COV_OS_INVSTATE */
-      {
-        Os_IocSendCloseChannel(&(Ioc->Ioc));                                                                            /* SBSW_OS_FC_PRECONDITION */
-        status = IOC_E_LIMIT;
-      }
-      else if(OS_UNLIKELY((Os_Fifo32IndicesInRangeOnWrite(&(Ioc->FifoWrite)) == 0u)))                                   /* SBSW_OS_FC_PRECONDITION */ /* COV_OS_INVSTATE */
-      {
-        Os_IocSendCloseChannel(&(Ioc->Ioc));                                                                            /* SBSW_OS_FC_PRECONDITION */
-        status = IOC_E_LIMIT;
-      }
-      else
-      {
-        /* #40 Try to write to the IOC buffer. */
-        result = Os_Fifo32Enqueue(&(Ioc->FifoWrite), Data);                                                             /* SBSW_OS_FC_PRECONDITION */
-
-        /* #50 If FIFO is already full: */
-        if(OS_UNLIKELY(result == OS_FIFOWRITERESULT_BUFFEROVERFLOW))
-        {
-          /* #60 Increment lost counter. */
-          Os_IocIncrementLostCounter(&(Ioc->Ioc));                                                                      /* SBSW_OS_FC_PRECONDITION */
-          status = IOC_E_LIMIT;
-        }
-      }
-
-      /* #70 Release the locks. */
-      Os_IocUnlock(&(Ioc->Ioc.Base), &interruptState);                                                                  /* SBSW_OS_IOC_IOCUNLOCK_001 */
-
-      /* #80 If no error detected: */
-      if(OS_LIKELY(status == IOC_E_OK))
-      {
-        /* #90 Tell base class object, that sending is completed by calling the callbacks, when configured. */
-        status = Os_IocCallCallbacks(&(Ioc->Ioc.Callbacks));                                                            /* SBSW_OS_FC_PRECONDITION */
-      }
-    }
-  }
-
-  return status;
-}                                                                                                                       /* PRQA S 6050, 6080 */ /* MD_MSR_STCAL, MD_MSR_STMIF */
-
-
-/***********************************************************************************************************************
- *  IOC Ref
- **********************************************************************************************************************/
-/***********************************************************************************************************************
- *  Os_IocRefReceiveInit()
- **********************************************************************************************************************/
-/*!
- * Internal comment removed.
- *
- *
- *
- */
-OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE, Os_IocRefReceiveInit,
-(
-  P2CONST(Os_IocRefReceiveConfigType, TYPEDEF, OS_CONST) Ioc
-))
-{
-  /* #10 Initialize the base class. */
-  Os_IocReceiveInit(&(Ioc->Ioc));                                                                                       /* SBSW_OS_FC_PRECONDITION */
-
-  /* #20 Initialize all fields. */
-  Os_FifoRefReadInit(&(Ioc->FifoRead));                                                                                 /* SBSW_OS_FC_PRECONDITION */
-}
-
-
-/***********************************************************************************************************************
- *  Os_IocRefSendInit()
- **********************************************************************************************************************/
-/*!
- * Internal comment removed.
- *
- *
- *
- */
-OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE, Os_IocRefSendInit,
-(
-  P2CONST(Os_IocRefSendConfigType, TYPEDEF, OS_CONST) Ioc
-))
-{
-  /* #10 Initialize the base class. */
-  Os_IocSendInit(&(Ioc->Ioc));                                                                                          /* SBSW_OS_FC_PRECONDITION */
-
-  /* #20 Initialize all fields. */
-  Os_FifoRefWriteInit(&(Ioc->FifoWrite));                                                                               /* SBSW_OS_FC_PRECONDITION */
-}
-
-
-/***********************************************************************************************************************
- *  Os_IocRefMultiReceive()
- **********************************************************************************************************************/
-/*!
- * Internal comment removed.
- *
- *
- *
- *
- *
- *
- *
- *
- *
- *
- */
-FUNC(Std_ReturnType, OS_CODE) Os_IocRefMultiReceive
-(
-  P2CONST(Os_IocRefMultiReceiveConfigType, TYPEDEF, OS_CONST) Ioc,
-  P2VAR(void, TYPEDEF, AUTOMATIC) Data
-)
-{
-  Os_IocInternalReturnType status;
-
-  /* #10 If Ioc is not enabled: KernelPanic. */
-  if(Os_IocIsEnabled() == 0u)                                                                                           /* COV_OS_INVSTATE */ /* PRQA S 2992, 2996 */ /* MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2996 */
-  {
-    Os_ErrKernelPanic();
-  }
-
-  {
-    OS_JUSTIFY_NOINIT(Os_IntStateType intState);
-    Os_ObjIdx_IteratorType currentReceiveIdx;
-    P2CONST(Os_AppConfigType, TYPEDEF, OS_CONST) currentApplication;
-    Os_AppAccessMaskType permittedApplications;
-
-    currentApplication = Os_ThreadGetCurrentApplication(Os_CoreGetThread());                                            /* SBSW_OS_IOC_THREADGETCURRENTAPPLICATION_001 */
-    permittedApplications = Os_IocGetAccessingApplications(&(Ioc->Ioc.Base));                                           /* SBSW_OS_FC_PRECONDITION */
-
-    /* #15 Perform checks. */
-    if(OS_UNLIKELY(Os_AppCheckAccess(currentApplication, permittedApplications) == OS_CHECK_FAILED))                    /* SBSW_OS_IOC_APPCHECKACCESS_001 */
-    {
-      status = OS_IOC_E_INTERNAL_NOK;
-    }
-    else
-    {
-      /* #20 Get the locks. */
-      Os_IocLock(&(Ioc->Ioc.Base), &intState);                                                                          /* SBSW_OS_IOC_IOCLOCK_001 */
-
-      if(OS_UNLIKELY(Os_IocChannelIsEnabled(&(Ioc->Ioc.Base)) == 0u))                                                   /* SBSW_OS_FC_PRECONDITION */ /* COV_OS_INVSTATE */
-      {
-        /* OS_IOC_E_INTERNAL_CHANNEL_CLOSED makes no sense here as it is not stated to the caller anyhow. */
-        status = OS_IOC_E_INTERNAL_NO_DATA;
-      }
-      else
-      {
-        P2VAR(Os_IocMultiReceiveType volatile, AUTOMATIC, OS_VAR_NOINIT) dyn;
-        Os_ObjIdx_IteratorType receiveChannelCounter;
-
-        dyn = Os_IocMultiReceiveGetDyn(&(Ioc->Ioc));                                                                    /* SBSW_OS_FC_PRECONDITION */
-        currentReceiveIdx = (Os_ObjIdx_IteratorType) dyn->NextReceiveChannel;
-
-        status = OS_IOC_E_INTERNAL_NO_DATA;
-
-        /* #30 For each IOC channel, beginning from where last receive ended: */
-        for(receiveChannelCounter = 0; receiveChannelCounter < (Os_ObjIdx_IteratorType) Ioc->Ioc.ReceiveChannelCount;   /* COV_OS_HALPLATFORMTESTEDASMULTICORE */
-            receiveChannelCounter++)
-        {
-          /* #40 Read from the IOC channel. */
-          status = Os_IocRefReceiveInternal(&(Ioc->Receivers[currentReceiveIdx]), Data);                                /* SBSW_OS_IOC_IOCREFRECEIVEINTERNAL_001 */
-
-          /* #50 If the channel contained data or an error occurred, abort looking for data. */
-          if (status != OS_IOC_E_INTERNAL_NO_DATA)
-          {
-            break;
-          }
-
-          currentReceiveIdx++;
-          if (currentReceiveIdx >= (Os_ObjIdx_IteratorType) Ioc->Ioc.ReceiveChannelCount)                               /* COV_OS_HALPLATFORMTESTEDASMULTICORE */
-          {
-            currentReceiveIdx = 0;
-          }
-        }
-
-        /* #60 Close all channels if an error has been detected. */
-        switch(status)
-        {
-          case OS_IOC_E_INTERNAL_OK:
-            /* intentionally no break */
-          case OS_IOC_E_INTERNAL_LOST_DATA:
-            /* intentionally no break */
-          case OS_IOC_E_INTERNAL_LOST_AND_NO_DATA:
-            /* intentionally no break */
-          case OS_IOC_E_INTERNAL_NO_DATA:
-            /* no error to be handled inside this function */
-            break;
-          default:                                                                                                      /* COV_OS_INVSTATE */
-            /* an internal error has occurred, close all channels */
-            for(currentReceiveIdx = 0; currentReceiveIdx < (Os_ObjIdx_IteratorType) Ioc->Ioc.ReceiveChannelCount;       /* COV_OS_INVSTATE */
-                currentReceiveIdx++)
-            {
-              Os_IocReceiveCloseChannel(&(Ioc->Receivers[currentReceiveIdx].Ioc));                                      /* SBSW_OS_IOC_IOCRECEIVECLOSECHANNEL_001 */
-            }
-            /* The caller cannot handle internal error codes */
-            status = OS_IOC_E_INTERNAL_NO_DATA;
-            break;
-        }
+      else if(OS_UNLIKELY((Os_IocChannelIsEnabled(&(Ioc->Ioc.Receive->Base)) == 0u)))                                   /* SBSW_OS_IOC_IOCCHANNELISENABLED_002 */ /* COV_OS_INVSTATE */
+      {
+        Os_IocSendCloseChannel(&(Ioc->Ioc));                                                                            /* SBSW_OS_FC_PRECONDITION */
+        status = IOC_E_LIMIT;
+      }
+      else if(OS_UNLIKELY((Os_FifoRefIndicesInRangeOnWrite(&(Ioc->FifoWrite)) == 0u)))                                  /* SBSW_OS_FC_PRECONDITION */ /* COV_OS_INVSTATE */
+      {
+        Os_IocSendCloseChannel(&(Ioc->Ioc));                                                                            /* SBSW_OS_FC_PRECONDITION */
+        status = IOC_E_LIMIT;
+      }
+      else if(OS_UNLIKELY(Os_FifoRefIsLoaned(&(Ioc->FifoWrite)) != 0u))                                                 /* SBSW_OS_FC_PRECONDITION */
+      {
+        /* #35 The next element is loaned by Os_IocRefSendLoan(), it must not be overwritten. */
+        status = IOC_E_NOK;
+      }
+      else
+      {
+        /* #40 Try to write to the IOC buffer. */
+        result = Os_FifoRefEnqueue(&(Ioc->FifoWrite), Data, Os_IocIsLockFree(&(Ioc->Ioc.Base)));                        /* SBSW_OS_FC_PRECONDITION */
 
-        /* #70 Compute the channel index for next IOC receive call. */
-        dyn->NextReceiveChannel++;                                                                                      /* PRQA S 3387 */ /* MD_Os_Rule13.3_3387 */ /* SBSW_OS_IOC_IOCMULTIRECEIVEGETDYN_001 */
-        if (dyn->NextReceiveChannel >= Ioc->Ioc.ReceiveChannelCount)
+        /* #50 If FIFO is already full: */
+        if(OS_UNLIKELY(result == OS_FIFOWRITERESULT_BUFFEROVERFLOW))
         {
-          dyn->NextReceiveChannel = 0;                                                                                  /* SBSW_OS_IOC_IOCMULTIRECEIVEGETDYN_001 */
+          /* #60 Increment lost counter. */
+          Os_IocIncrementLostCounter(&(Ioc->Ioc));                                                                      /* SBSW_OS_FC_PRECONDITION */
+          status = IOC_E_LIMIT;
         }
+
+        /* #65 Mark the channel at a multiple receive IOC, also after a data loss, which has to be reported. */
+        Os_IocNotifyReceiver(&(Ioc->Ioc));                                                                              /* SBSW_OS_FC_PRECONDITION */
       }
 
-      /* #80 Release the locks. */
-      Os_IocUnlock(&(Ioc->Ioc.Base), &intState);                                                                        /* SBSW_OS_IOC_IOCUNLOCK_001 */
+      /* #70 Release the locks. */
+      Os_IocUnlock(&(Ioc->Ioc.Base), &interruptState);                                                                  /* SBSW_OS_IOC_IOCUNLOCK_001 */
+
+      /* #80 If no error detected: */
+      if(OS_LIKELY(status == IOC_E_OK))
+      {
+        /* #90 Tell base class object, that sending is completed by calling the callbacks, when configured. */
+        status = Os_IocCallCallbacks(&(Ioc->Ioc.Callbacks));                                                            /* SBSW_OS_FC_PRECONDITION */
+      }
     }
   }
 
-  return (Std_ReturnType) status;
-}                                                                                                                       /* PRQA S 6050 */ /* MD_MSR_STCAL */
+  return status;
+}                                                                                                                       /* PRQA S 6050, 6080 */ /* MD_MSR_STCAL, MD_MSR_STMIF */
 
 
 /***********************************************************************************************************************
- *  Os_IocRefReceive()
+ *  Os_IocRefSendLoan()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -3890,14 +5806,16 @@ FUNC(Std_ReturnType, OS_CODE) Os_IocRefMultiReceive
  *
  *
  *
+ *
  */
-FUNC(Std_ReturnType, OS_CODE) Os_IocRefReceive
+FUNC(Std_ReturnType, OS_CODE) Os_IocRefSendLoan
 (
-  P2CONST(Os_IocRefReceiveConfigType, TYPEDEF, OS_CONST) Ioc,
-  P2VAR(void, TYPEDEF, AUTOMATIC) Data
+  P2CONST(Os_IocRefSendConfigType, TYPEDEF, OS_CONST) Ioc,
+  P2VAR(P2VAR(void, TYPEDEF, AUTOMATIC), TYPEDEF, AUTOMATIC) Slot
 )
 {
-  Os_IocInternalReturnType status;
+  Std_ReturnType status;
+  P2VAR(void, TYPEDEF, AUTOMATIC) slot = NULL_PTR;
 
   /* #10 If Ioc is not enabled: KernelPanic. */
   if(Os_IocIsEnabled() == 0u)                                                                                           /* COV_OS_INVSTATE */ /* PRQA S 2992, 2996 */ /* MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2996 */
@@ -3912,10 +5830,11 @@ FUNC(Std_ReturnType, OS_CODE) Os_IocRefReceive
     currentApplication = Os_ThreadGetCurrentApplication(Os_CoreGetThread());                                            /* SBSW_OS_IOC_THREADGETCURRENTAPPLICATION_001 */
     permittedApplications = Os_IocGetAccessingApplications(&(Ioc->Ioc.Base));                                           /* SBSW_OS_FC_PRECONDITION */
 
-    /* #15 Perform checks. */
-    if(OS_UNLIKELY(Os_AppCheckAccess(currentApplication, permittedApplications) == OS_CHECK_FAILED))                    /* SBSW_OS_IOC_APPCHECKACCESS_001 */
+    /* #15 Perform static checks. Only trusted applications may access the IOC buffer in place. */
+    if(OS_UNLIKELY((Os_AppCheckAccess(currentApplication, permittedApplications) == OS_CHECK_FAILED)                    /* SBSW_OS_IOC_APPCHECKACCESS_001 */
+                   || (Os_AppIsTrusted(currentApplication) == 0u)))                                                     /* SBSW_OS_IOC_APPISTRUSTED_001 */
     {
-      status = OS_IOC_E_INTERNAL_NOK;
+      status = IOC_E_NOK;
     }
     else
     {
@@ -3924,37 +5843,58 @@ FUNC(Std_ReturnType, OS_CODE) Os_IocRefReceive
       /* #20 Get the locks. */
       Os_IocLock(&(Ioc->Ioc.Base), &interruptState);                                                                    /* SBSW_OS_IOC_IOCLOCK_001 */
 
-      /* #30 Call internal receive function */
-      status = Os_IocRefReceiveInternal(Ioc, Data);                                                                     /* SBSW_OS_FC_PRECONDITION */
-
-      /* #40 Correct the return value and close the channel if necessary */
-      if(OS_UNLIKELY((status == OS_IOC_E_INTERNAL_CLOSE_CHANNEL)))                                                      /* COV_OS_INVSTATE */
+      /* #30 Check that the channel is enabled and that the FIFO indices are in range. If not close the channel. */
+      if(OS_UNLIKELY((Os_IocChannelIsEnabled(&(Ioc->Ioc.Base)) == 0u)))                                                 /* SBSW_OS_FC_PRECONDITION */ /* COV_OS_INVSTATE */
       {
-        Os_IocReceiveCloseChannel(&(Ioc->Ioc));                                                                         /* SBSW_OS_FC_PRECONDITION */
-        /* OS_IOC_E_INTERNAL_CLOSE_CHANNEL in not known externally, other return values are numerical identical */
-        status = OS_IOC_E_INTERNAL_NO_DATA;
+        status = IOC_E_LIMIT;
       }
-      else if(OS_UNLIKELY((status == OS_IOC_E_INTERNAL_CHANNEL_CLOSED)))                                                /* COV_OS_INVSTATE */
+      else if(OS_UNLIKELY((Os_IocChannelIsEnabled(&(Ioc->Ioc.Receive->Base)) == 0u)))                                   /* SBSW_OS_IOC_IOCCHANNELISENABLED_002 */ /* COV_OS_INVSTATE */
       {
-        /* OS_IOC_E_INTERNAL_CHANNEL_CLOSED in not known externally, other return values are numerical identical */
-        status = OS_IOC_E_INTERNAL_NO_DATA;
+        Os_IocSendCloseChannel(&(Ioc->Ioc));                                                                            /* SBSW_OS_FC_PRECONDITION */
+        status = IOC_E_LIMIT;
+      }
+      else if(OS_UNLIKELY((Os_FifoRefIndicesInRangeOnWrite(&(Ioc->FifoWrite)) == 0u)))                                  /* SBSW_OS_FC_PRECONDITION */ /* COV_OS_INVSTATE */
+      {
+        Os_IocSendCloseChannel(&(Ioc->Ioc));                                                                            /* SBSW_OS_FC_PRECONDITION */
+        status = IOC_E_LIMIT;
+      }
+      else if(OS_UNLIKELY(Os_FifoRefIsLoaned(&(Ioc->FifoWrite)) != 0u))                                                 /* SBSW_OS_FC_PRECONDITION */
+      {
+        /* #40 Only one element may be loaned at a time. */
+        status = IOC_E_NOK;
       }
       else
       {
-        /* status does not need to be changed. MISRA 14.10 */
+        /* #50 Try to loan the next element of the IOC buffer. */
+        slot = Os_FifoRefLoan(&(Ioc->FifoWrite), Os_IocIsLockFree(&(Ioc->Ioc.Base)));                                   /* SBSW_OS_FC_PRECONDITION */
+
+        /* #60 If FIFO is already full, increment lost counter and notify a multiple receive IOC. */
+        if(OS_UNLIKELY(slot == NULL_PTR))
+        {
+          Os_IocIncrementLostCounter(&(Ioc->Ioc));                                                                      /* SBSW_OS_FC_PRECONDITION */
+          Os_IocNotifyReceiver(&(Ioc->Ioc));                                                                            /* SBSW_OS_FC_PRECONDITION */
+          status = IOC_E_LIMIT;
+        }
+        else
+        {
+          status = IOC_E_OK;
+        }
       }
 
-      /* #50 Release the locks. */
+      /* #70 Release the locks. */
       Os_IocUnlock(&(Ioc->Ioc.Base), &interruptState);                                                                  /* SBSW_OS_IOC_IOCUNLOCK_001 */
     }
   }
 
-  return (Std_ReturnType) status;
-}                                                                                                                       /* PRQA S 6050 */ /* MD_MSR_STCAL */
+  /* #80 Return the loaned element. */
+  (*Slot) = slot;                                                                                                       /* SBSW_OS_PWA_PRECONDITION */
+
+  return status;
+}                                                                                                                       /* PRQA S 6050, 6080 */ /* MD_MSR_STCAL, MD_MSR_STMIF */
 
 
 /***********************************************************************************************************************
- *  Os_IocRefEmptyQueue()
+ *  Os_IocRefSendCommit()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -3962,10 +5902,14 @@ FUNC(Std_ReturnType, OS_CODE) Os_IocRefReceive
  *
  *
  *
+ *
+ *
+ *
+ *
  */
-FUNC(Std_ReturnType, OS_CODE) Os_IocRefEmptyQueue
+FUNC(Std_ReturnType, OS_CODE) Os_IocRefSendCommit
 (
-  P2CONST(Os_IocRefReceiveConfigType, TYPEDEF, OS_CONST) Ioc
+  P2CONST(Os_IocRefSendConfigType, TYPEDEF, OS_CONST) Ioc
 )
 {
   Std_ReturnType status;
@@ -3983,26 +5927,49 @@ FUNC(Std_ReturnType, OS_CODE) Os_IocRefEmptyQueue
     currentApplication = Os_ThreadGetCurrentApplication(Os_CoreGetThread());                                            /* SBSW_OS_IOC_THREADGETCURRENTAPPLICATION_001 */
     permittedApplications = Os_IocGetAccessingApplications(&(Ioc->Ioc.Base));                                           /* SBSW_OS_FC_PRECONDITION */
 
-    /* #15 Perform checks. */
-    if(OS_UNLIKELY(Os_AppCheckAccess(currentApplication, permittedApplications) == OS_CHECK_FAILED))                    /* SBSW_OS_IOC_APPCHECKACCESS_001 */
+    /* #15 Perform static checks. Only trusted applications may access the IOC buffer in place. */
+    if(OS_UNLIKELY((Os_AppCheckAccess(currentApplication, permittedApplications) == OS_CHECK_FAILED)                    /* SBSW_OS_IOC_APPCHECKACCESS_001 */
+                   || (Os_AppIsTrusted(currentApplication) == 0u)))                                                     /* SBSW_OS_IOC_APPISTRUSTED_001 */
     {
       status = IOC_E_NOK;
     }
     else
     {
-      /* #20 Redirect to FIFO. */
-      Os_FifoRefEmptyQueue(&(Ioc->FifoRead));                                                                           /* SBSW_OS_IOC_FIFOREFEMPTYQUEUE_001 */
+      OS_JUSTIFY_NOINIT(Os_IntStateType interruptState);
 
-      status = IOC_E_OK;
+      /* #20 Get the locks. */
+      Os_IocLock(&(Ioc->Ioc.Base), &interruptState);                                                                    /* SBSW_OS_IOC_IOCLOCK_001 */
+
+      /* #30 If no element is loaned, there is nothing to commit. */
+      if(OS_UNLIKELY(Os_FifoRefIsLoaned(&(Ioc->FifoWrite)) == 0u))                                                      /* SBSW_OS_FC_PRECONDITION */
+      {
+        status = IOC_E_NOK;
+      }
+      else
+      {
+        /* #40 Pass the element to the receiver and notify a multiple receive IOC. */
+        Os_FifoRefCommit(&(Ioc->FifoWrite), Os_IocIsLockFree(&(Ioc->Ioc.Base)));                                        /* SBSW_OS_FC_PRECONDITION */
+        Os_IocNotifyReceiver(&(Ioc->Ioc));                                                                              /* SBSW_OS_FC_PRECONDITION */
+        status = IOC_E_OK;
+      }
+
+      /* #50 Release the locks. */
+      Os_IocUnlock(&(Ioc->Ioc.Base), &interruptState);                                                                  /* SBSW_OS_IOC_IOCUNLOCK_001 */
+
+      /* #60 If the element has been committed, call the callbacks, when configured. */
+      if(OS_LIKELY(status == IOC_E_OK))
+      {
+        status = Os_IocCallCallbacks(&(Ioc->Ioc.Callbacks));                                                            /* SBSW_OS_FC_PRECONDITION */
+      }
     }
   }
 
   return status;
-}
+}                                                                                                                       /* PRQA S 6050 */ /* MD_MSR_STCAL */
 
 
 /***********************************************************************************************************************
- *  Os_IocRefEmptyMultiQueue()
+ *  Os_IocRefReceiveBorrow()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -4010,13 +5977,19 @@ FUNC(Std_ReturnType, OS_CODE) Os_IocRefEmptyQueue
  *
  *
  *
+ *
+ *
+ *
+ *
  */
-FUNC(Std_ReturnType, OS_CODE) Os_IocRefEmptyMultiQueue                                                                  /* COV_OS_HALPLATFORMTESTEDASMULTICORE */
+FUNC(Std_ReturnType, OS_CODE) Os_IocRefReceiveBorrow
 (
-  P2CONST(Os_IocRefMultiReceiveConfigType, TYPEDEF, OS_CONST) Ioc
+  P2CONST(Os_IocRefReceiveConfigType, TYPEDEF, OS_CONST) Ioc,
+  P2VAR(P2CONST(void, TYPEDEF, AUTOMATIC), TYPEDEF, AUTOMATIC) Slot
 )
 {
-  Std_ReturnType status;
+  Os_IocInternalReturnType status;
+  P2CONST(void, TYPEDEF, AUTOMATIC) slot = NULL_PTR;
 
   /* #10 If Ioc is not enabled: KernelPanic. */
   if(Os_IocIsEnabled() == 0u)                                                                                           /* COV_OS_INVSTATE */ /* PRQA S 2992, 2996 */ /* MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2996 */
@@ -4031,25 +6004,55 @@ FUNC(Std_ReturnType, OS_CODE) Os_IocRefEmptyMultiQueue
     currentApplication = Os_ThreadGetCurrentApplication(Os_CoreGetThread());                                            /* SBSW_OS_IOC_THREADGETCURRENTAPPLICATION_001 */
     permittedApplications = Os_IocGetAccessingApplications(&(Ioc->Ioc.Base));                                           /* SBSW_OS_FC_PRECONDITION */
 
-    /* #15 Perform static checks. */
-    if(OS_UNLIKELY(Os_AppCheckAccess(currentApplication, permittedApplications) == OS_CHECK_FAILED))                    /* SBSW_OS_IOC_APPCHECKACCESS_001 */
+    /* #15 Perform static checks. Only trusted applications may access the IOC buffer in place. */
+    if(OS_UNLIKELY((Os_AppCheckAccess(currentApplication, permittedApplications) == OS_CHECK_FAILED)                    /* SBSW_OS_IOC_APPCHECKACCESS_001 */
+                   || (Os_AppIsTrusted(currentApplication) == 0u)))                                                     /* SBSW_OS_IOC_APPISTRUSTED_001 */
     {
-      status = IOC_E_NOK;
+      status = OS_IOC_E_INTERNAL_NOK;
     }
     else
     {
-      /* #20 Call the base class method. */
-      (void)Os_IocEmptyMultiQueue(&(Ioc->Ioc), IocRefMultiReceive);                                                     /* SBSW_OS_FC_PRECONDITION */
-      status = IOC_E_OK;
+      OS_JUSTIFY_NOINIT(Os_IntStateType interruptState);
+
+      /* #20 Get the locks. */
+      Os_IocLock(&(Ioc->Ioc.Base), &interruptState);                                                                    /* SBSW_OS_IOC_IOCLOCK_001 */
+
+      /* #30 Check whether an element is available. */
+      status = Os_IocRefReceiveCheck(Ioc);                                                                              /* SBSW_OS_FC_PRECONDITION */
+
+      /* #40 If so, borrow it. Otherwise correct the return value and close the channel if necessary. */
+      if(Os_IocIsDataReceived(status) != 0u)
+      {
+        slot = Os_FifoRefBorrow(&(Ioc->FifoRead), Os_IocIsLockFree(&(Ioc->Ioc.Base)));                                  /* SBSW_OS_FC_PRECONDITION */
+      }
+      else if(OS_UNLIKELY((status == OS_IOC_E_INTERNAL_CLOSE_CHANNEL)))                                                 /* COV_OS_INVSTATE */
+      {
+        Os_IocReceiveCloseChannel(&(Ioc->Ioc));                                                                         /* SBSW_OS_FC_PRECONDITION */
+        status = OS_IOC_E_INTERNAL_NO_DATA;
+      }
+      else if(OS_UNLIKELY((status == OS_IOC_E_INTERNAL_CHANNEL_CLOSED)))                                                /* COV_OS_INVSTATE */
+      {
+        status = OS_IOC_E_INTERNAL_NO_DATA;
+      }
+      else
+      {
+        /* status does not need to be changed. MISRA 14.10 */
+      }
+
+      /* #50 Release the locks. */
+      Os_IocUnlock(&(Ioc->Ioc.Base), &interruptState);                                                                  /* SBSW_OS_IOC_IOCUNLOCK_001 */
     }
   }
 
-  return status;
-}
+  /* #60 Return the borrowed element. */
+  (*Slot) = slot;                                                                                                       /* SBSW_OS_PWA_PRECONDITION */
+
+  return (Std_ReturnType) status;
+}                                                                                                                       /* PRQA S 6050, 6080 */ /* MD_MSR_STCAL, MD_MSR_STMIF */
 
 
 /***********************************************************************************************************************
- *  Os_IocRefSend()
+ *  Os_IocRefReceiveRelease()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -4061,14 +6064,10 @@ FUNC(Std_ReturnType, OS_CODE) Os_IocRefEmptyMultiQueue
  *
  *
  *
- *
- *
- *
  */
-FUNC(Std_ReturnType, OS_CODE) Os_IocRefSend
+FUNC(Std_ReturnType, OS_CODE) Os_IocRefReceiveRelease
 (
-  P2CONST(Os_IocRefSendConfigType, TYPEDEF, OS_CONST) Ioc,
-  P2CONST(void, TYPEDEF, AUTOMATIC) Data
+  P2CONST(Os_IocRefReceiveConfigType, TYPEDEF, OS_CONST) Ioc
 )
 {
   Std_ReturnType status;
@@ -4086,64 +6085,38 @@ FUNC(Std_ReturnType, OS_CODE) Os_IocRefSend
     currentApplication = Os_ThreadGetCurrentApplication(Os_CoreGetThread());                                            /* SBSW_OS_IOC_THREADGETCURRENTAPPLICATION_001 */
     permittedApplications = Os_IocGetAccessingApplications(&(Ioc->Ioc.Base));                                           /* SBSW_OS_FC_PRECONDITION */
 
-    /* #15 Perform static checks. */
-    if(OS_UNLIKELY(Os_AppCheckAccess(currentApplication, permittedApplications) == OS_CHECK_FAILED))                    /* SBSW_OS_IOC_APPCHECKACCESS_001 */
+    /* #15 Perform static checks. Only trusted applications may access the IOC buffer in place. */
+    if(OS_UNLIKELY((Os_AppCheckAccess(currentApplication, permittedApplications) == OS_CHECK_FAILED)                    /* SBSW_OS_IOC_APPCHECKACCESS_001 */
+                   || (Os_AppIsTrusted(currentApplication) == 0u)))                                                     /* SBSW_OS_IOC_APPISTRUSTED_001 */
     {
       status = IOC_E_NOK;
     }
     else
     {
-      Os_FifoWriteResultType result;
       OS_JUSTIFY_NOINIT(Os_IntStateType interruptState);
 
-      status = IOC_E_OK;
-
       /* #20 Get the locks. */
       Os_IocLock(&(Ioc->Ioc.Base), &interruptState);                                                                    /* SBSW_OS_IOC_IOCLOCK_001 */
 
-      /* #30 Check that the channel is enabled and that the FIFO indices are in range. If not close the channel. */
-      if(OS_UNLIKELY((Os_IocChannelIsEnabled(&(Ioc->Ioc.Base)) == 0u)))                                                 /* SBSW_OS_FC_PRECONDITION */ /* COV_OS_INVSTATE */
-      {
-        status = IOC_E_LIMIT;
-      }
-      else if(OS_UNLIKELY((Os_IocChannelIsEnabled(&(Ioc->Ioc.Receive->Base)) == 0u)))                                   /* SBSW_OS_IOC_IOCCHANNELISENABLED_002 */ /* COV_OS_INVSTATE */
-      {
-        Os_IocSendCloseChannel(&(Ioc->Ioc));                                                                            /* SBSW_OS_FC_PRECONDITION */
-        status = IOC_E_LIMIT;
-      }
-      else if(OS_UNLIKELY((Os_FifoRefIndicesInRangeOnWrite(&(Ioc->FifoWrite)) == 0u)))                                  /* SBSW_OS_FC_PRECONDITION */ /* COV_OS_INVSTATE */
+      /* #30 If no element is borrowed, there is nothing to release. */
+      if(OS_UNLIKELY(Os_FifoRefIsBorrowed(&(Ioc->FifoRead)) == 0u))                                                     /* SBSW_OS_FC_PRECONDITION */
       {
-        Os_IocSendCloseChannel(&(Ioc->Ioc));                                                                            /* SBSW_OS_FC_PRECONDITION */
-        status = IOC_E_LIMIT;
+        status = IOC_E_NOK;
       }
       else
       {
-        /* #40 Try to write to the IOC buffer. */
-        result = Os_FifoRefEnqueue(&(Ioc->FifoWrite), Data);                                                            /* SBSW_OS_FC_PRECONDITION */
-
-        /* #50 If FIFO is already full: */
-        if(OS_UNLIKELY(result == OS_FIFOWRITERESULT_BUFFEROVERFLOW))
-        {
-          /* #60 Increment lost counter. */
-          Os_IocIncrementLostCounter(&(Ioc->Ioc));                                                                      /* SBSW_OS_FC_PRECONDITION */
-          status = IOC_E_LIMIT;
-        }
+        /* #40 Remove the element from the IOC buffer. */
+        Os_FifoRefRelease(&(Ioc->FifoRead), Os_IocIsLockFree(&(Ioc->Ioc.Base)));                                        /* SBSW_OS_FC_PRECONDITION */
+        status = IOC_E_OK;
       }
 
-      /* #70 Release the locks. */
+      /* #50 Release the locks. */
       Os_IocUnlock(&(Ioc->Ioc.Base), &interruptState);                                                                  /* SBSW_OS_IOC_IOCUNLOCK_001 */
-
-      /* #80 If no error detected: */
-      if(OS_LIKELY(status == IOC_E_OK))
-      {
-        /* #90 Tell base class object, that sending is completed by calling the callbacks, when configured. */
-        status = Os_IocCallCallbacks(&(Ioc->Ioc.Callbacks));                                                            /* SBSW_OS_FC_PRECONDITION */
-      }
     }
   }
 
   return status;
-}                                                                                                                       /* PRQA S 6050, 6080 */ /* MD_MSR_STCAL, MD_MSR_STMIF */
+}                                                                                                                       /* PRQA S 6050 */ /* MD_MSR_STCAL */
 
 
 /***********************************************************************************************************************
@@ -4170,6 +6143,12 @@ OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE, Os
   /* #10 Initialize Base Data. */
   Os_IocInitBase(&(Ioc->Ioc));                                                                                          /* SBSW_OS_FC_PRECONDITION */
 
+  /* #15 Reset the sequence counter, if configured. */
+  if(Ioc->Sequence != NULL_PTR)
+  {
+    *(Ioc->Sequence) = 0u;                                                                                              /* SBSW_OS_IOC_IOCWRITESEQUENCE_001 */
+  }
+
   /* #20 If a callback function is configured: */
   if(Ioc->InitCbk != NULL_PTR)
   {
@@ -4226,17 +6205,50 @@ FUNC(Std_ReturnType, OS_CODE) Os_IocRead
     {
       status = IOC_E_NOK;
     }
+    else if(Ioc->Sequence != NULL_PTR)
+    {
+      Os_IocSequenceType begin;
+      Os_IocSequenceType end;
+      uint32 retries = 0u;
+      OS_JUSTIFY_NOINIT(Os_IntStateType interruptState);
+
+      status = IOC_E_NOK;
+
+      /* #20 If a sequence counter is configured, copy data from the IOC buffer into the snapshot buffer without
+       *     spinlock. Lock interrupts, so that no other reader on this core uses the snapshot buffer meanwhile. */
+      do
+      {
+        Os_IntSuspend(&interruptState);                                                                                 /* SBSW_OS_FC_POINTER2LOCAL */
+        begin = *(Ioc->Sequence);
+        Os_Hal_Dsync();
+        Ioc->CopyCbk(Ioc->Data, Ioc->Snapshot);                                                                         /* SBSW_OS_IOC_IOCREADCOPYCBK_002 */
+        Os_Hal_Dsync();
+        end = *(Ioc->Sequence);
+
+        /* #25 Pass the snapshot to the caller, if no write was in progress at the beginning and none has started
+         *     meanwhile. Otherwise repeat the copy. If all copies are torn, Data is not changed and IOC_E_NOK is
+         *     reported. */
+        if(OS_LIKELY((begin == end) && ((begin & 1u) == 0u)))
+        {
+          Ioc->CopyCbk(Ioc->Snapshot, Data);                                                                            /* SBSW_OS_IOC_IOCREADCOPYCBK_002 */
+          status = IOC_E_OK;
+        }
+
+        Os_IntResume(&interruptState);                                                                                  /* SBSW_OS_FC_POINTER2LOCAL */
+        retries++;
+      } while((status != IOC_E_OK) && (retries < (uint32)OS_CFG_IOC_SEQUENCE_RETRIES));
+    }
     else
     {
       OS_JUSTIFY_NOINIT(Os_IntStateType interruptState);
 
-      /* #20 Get the locks. */
+      /* #30 Otherwise, get the locks. */
       Os_IocLock(&(Ioc->Ioc), &interruptState);                                                                         /* SBSW_OS_IOC_IOCLOCK_001 */
 
-      /* #30 Copy data from the IOC buffer. */
+      /* #40 Copy data from the IOC buffer. */
       Ioc->CopyCbk(Ioc->Data, Data);                                                                                    /* SBSW_OS_IOC_IOCREADCOPYCBK_001 */
 
-      /* #40 Release the locks. */
+      /* #50 Release the locks. */
       Os_IocUnlock(&(Ioc->Ioc), &interruptState);                                                                       /* SBSW_OS_IOC_IOCUNLOCK_001 */
 
       status = IOC_E_OK;
@@ -4293,9 +6305,23 @@ FUNC(Std_ReturnType, OS_CODE) Os_IocWrite
       /* #20 Get the locks. */
       Os_IocLock(&(Ioc->Ioc), &interruptState);                                                                         /* SBSW_OS_IOC_IOCLOCK_001 */
 
+      /* #25 If a sequence counter is configured, make it odd, so that lock-free readers repeat their copy. */
+      if(Ioc->Sequence != NULL_PTR)
+      {
+        *(Ioc->Sequence) = *(Ioc->Sequence) + 1u;                                                                       /* SBSW_OS_IOC_IOCWRITESEQUENCE_001 */
+        Os_Hal_Dsync();
+      }
+
       /* #30 Copy data into the IOC buffer. */
       Ioc->CopyCbk(Data, Ioc->Data);                                                                                    /* SBSW_OS_IOC_IOCWRITECOPYCBK */
 
+      /* #35 If a sequence counter is configured, make it even again to publish the data. */
+      if(Ioc->Sequence != NULL_PTR)
+      {
+        Os_Hal_Dsync();
+        *(Ioc->Sequence) = *(Ioc->Sequence) + 1u;                                                                       /* SBSW_OS_IOC_IOCWRITESEQUENCE_001 */
+      }
+
       /* #40 Release the locks. */
       Os_IocUnlock(&(Ioc->Ioc), &interruptState);                                                                       /* SBSW_OS_IOC_IOCUNLOCK_001 */
 
@@ -4525,6 +6551,44 @@ FUNC(Std_ReturnType, OS_CODE) Os_IocWrite
                   precondition is check during review.
   \COUNTERMEASURE \M [CM_OS_IOC32MULTIRECEIVE_RECEIVERS_M]
 
+\ID SBSW_OS_IOC_IOC08RECEIVEINTERNAL_002
+  \DESCRIPTION    Os_Ioc08ReceiveInternal is called with the Ioc object and an element of the Data array. Ioc is
+                  derived from the base class object according to the SubClass, which is set by the module internal
+                  caller. The element index is limited to Count, the number of elements of Data. The correctness of
+                  the parameters is ensured by precondition. The compliance of the precondition is check during
+                  review.
+  \COUNTERMEASURE \N [CM_OS_PRECONDITION_N]
+
+\ID SBSW_OS_IOC_IOC16RECEIVEINTERNAL_002
+  \DESCRIPTION    Os_Ioc16ReceiveInternal is called with the Ioc object and an element of the Data array. Ioc is
+                  derived from the base class object according to the SubClass, which is set by the module internal
+                  caller. The element index is limited to Count, the number of elements of Data. The correctness of
+                  the parameters is ensured by precondition. The compliance of the precondition is check during
+                  review.
+  \COUNTERMEASURE \N [CM_OS_PRECONDITION_N]
+
+\ID SBSW_OS_IOC_IOC32RECEIVEINTERNAL_002
+  \DESCRIPTION    Os_Ioc32ReceiveInternal is called with the Ioc object and an element of the Data array. Ioc is
+                  derived from the base class object according to the SubClass, which is set by the module internal
+                  caller. The element index is limited to Count, the number of elements of Data. The correctness of
+                  the parameters is ensured by precondition. The compliance of the precondition is check during
+                  review.
+  \COUNTERMEASURE \N [CM_OS_PRECONDITION_N]
+
+\ID SBSW_OS_IOC_RECEIVEELEMENT_001
+  \DESCRIPTION    Os_IocReceiveElement is called with the base class object of the Ioc, the Data array and an index.
+                  The index is limited to Count, the number of elements of Data. Ioc, Data and Count are passed as
+                  parameters to the calling function. The correctness of the parameters is ensured by precondition.
+                  The compliance of the precondition is check during review.
+  \COUNTERMEASURE \N [CM_OS_PRECONDITION_N]
+
+\ID SBSW_OS_IOC_SENDELEMENT_001
+  \DESCRIPTION    Os_IocSendElement is called with the base class object of the Ioc, the Data array and an index.
+                  The index is limited to Count, the number of elements of Data. Ioc, Data and Count are passed as
+                  parameters to the calling function. The correctness of the parameters is ensured by precondition.
+                  The compliance of the precondition is check during review.
+  \COUNTERMEASURE \N [CM_OS_PRECONDITION_N]
+
 \ID SBSW_OS_IOC_IOCREFRECEIVEINTERNAL_001
   \DESCRIPTION    Os_IocRefReceiveInternal is called with a receiver object and a Data object. The receiver object is
                   derived by an index from the Receivers array of an Ioc object. The index is limited to the
@@ -4560,6 +6624,11 @@ FUNC(Std_ReturnType, OS_CODE) Os_IocWrite
   \COUNTERMEASURE \M [CM_OS_IOCWRITE_DATA_M]
                   \R [CM_OS_IOCWRITE_INITCBK_R]
 
+\ID SBSW_OS_IOC_IOCWRITESEQUENCE_001
+  \DESCRIPTION    Write access to the sequence counter of an Os_IocWriteConfigType object. The pointer is checked
+                  against NULL_PTR before.
+  \COUNTERMEASURE \M [CM_OS_IOCWRITE_SEQUENCE_M]
+
 \ID SBSW_OS_IOC_IOCREADCOPYCBK_001
   \DESCRIPTION    CopyCbk function pointer call with caller argument Data and Ioc->Data. CopyCbk and Data are
                   derived from an Ioc object. Ioc and Data are passed as parameter to the calling
@@ -4568,6 +6637,16 @@ FUNC(Std_ReturnType, OS_CODE) Os_IocWrite
   \COUNTERMEASURE \M [CM_OS_IOCREAD_COPYCBK_M]
                   \M [CM_OS_IOCREAD_DATA_M]
 
+\ID SBSW_OS_IOC_IOCREADCOPYCBK_002
+  \DESCRIPTION    CopyCbk function pointer call with Ioc->Snapshot and either Ioc->Data or the caller argument Data.
+                  CopyCbk, Data and Snapshot are derived from an Ioc object, which has a sequence counter. Ioc and Data
+                  are passed as parameter to the calling function. The correctness of the parameters is ensured by
+                  precondition. The compliance of the precondition is check during review.
+  \COUNTERMEASURE \M [CM_OS_IOCREAD_COPYCBK_M]
+                  \M [CM_OS_IOCREAD_DATA_M]
+                  \R [CM_OS_IOCREAD_SNAPSHOT_R]
+                  \M [CM_OS_IOCREAD_SNAPSHOT_M]
+
 \ID SBSW_OS_IOC_THREADGETCURRENTAPPLICATION_001
  \DESCRIPTION    Os_ThreadGetCurrentApplication is called with the return value of Os_CoreGetThread.
  \COUNTERMEASURE \N [CM_OS_COREGETTHREAD_N]
@@ -4576,6 +6655,10 @@ FUNC(Std_ReturnType, OS_CODE) Os_IocWrite
  \DESCRIPTION    Os_AppCheckAccess is called with the return value of Os_ThreadGetCurrentApplication.
  \COUNTERMEASURE \N [CM_OS_THREADGETCURRENTAPPLICATION_N]
 
+\ID SBSW_OS_IOC_APPISTRUSTED_001
+ \DESCRIPTION    Os_AppIsTrusted is called with the return value of Os_ThreadGetCurrentApplication.
+ \COUNTERMEASURE \N [CM_OS_THREADGETCURRENTAPPLICATION_N]
+
 \ID SBSW_OS_IOC_FIFO08EMPTYQUEUE_001
  \DESCRIPTION    Os_Fifo08EmptyQueue is called with value derived from an Ioc object. Ioc is passed as parameter to the
                  calling function.
@@ -4722,6 +6805,19 @@ SBSW_JUSTIFICATION_END */
 \CM CM_OS_IOCREAD_DATA_M
       Verify that the Data pointer of each Os_IocReadConfigType object is initialized with a non NULL_PTR.
 
+\CM CM_OS_IOCREAD_SNAPSHOT_R
+      Os_IocInitInternal() panics, if the Snapshot pointer of an Os_IocReadConfigType object with sequence counter is
+      a NULL_PTR.
+
+\CM CM_OS_IOCREAD_SNAPSHOT_M
+      Verify that the Snapshot pointer of each Os_IocReadConfigType object with sequence counter references a buffer
+      of the size of Data, which is not used by any other object.
+
+\CM CM_OS_IOCWRITE_SEQUENCE_M
+      Verify that the Sequence pointer of each Os_IocWriteConfigType object is either a NULL_PTR or references the
+      sequence counter of the written data buffer, and that all readers and writers of that buffer reference the
+      same counter.
+
 \CM CM_OS_IOCCALLBACKSCONFIG_CALLBACKREFS_01_02_M
       Verify that
        1. the callback list of each Os_IocCallbacksConfigType object is a non NULL_PTR if the callback count as not
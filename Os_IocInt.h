@@ -52,6 +52,11 @@
  *
  *  Receiving is performed in the same way.
  *
+ *  If a sequence counter is configured, readers do not lock at all. The writer increments the counter before and
+ *  after writing to the buffer, so that it is odd while a write is in progress. A reader copies the buffer and
+ *  repeats the copy, if the counter was odd or has changed meanwhile. Readers neither block the writer nor each
+ *  other.
+ *
  *  ![Single Writer - Single Reader, non queued](Ioc_1to1_unqueued.png)
  *
  *  ###N:1 (Single and Group Parameter)
@@ -64,6 +69,11 @@
  *  the value from that queue. The receiver stores a start position for the next receive run which is identical to the
  *  last start position plus 1. The reception order of data sent from a single application equals the send order.
  *  The overall receive order may differ from the send order if all sending applications are considered.
+ *  If the receiver has at most OS_BITFIELD_BITWIDTH queues, each sender marks its queue in a ready mask of the
+ *  receiver after writing (or losing) data. The receiver then only visits marked queues: starting at the stored
+ *  position, the next marked queue is found by counting the leading zeros of the mask. The receiver unmarks a
+ *  queue before reading from it and marks it again, if the queue still contains data afterwards. So the round robin
+ *  order is kept, while empty queues cost nothing.
  *
  *  ![Multiple Sender - Single Receiver, queued, user space](Ioc_Nto1_queued.png)
  *
@@ -115,6 +125,12 @@
  *      - If all sender and the receiver are located on different cores, no interrupt locking is required and vice
  *        versa.
  *      - If all sender and the receiver are located on the same core no spinlock is required and vice versa.
+ *   - With a sequence counter, the readers need no spinlock. The writer and the readers have to use
+ *     OS_IOCLOCKMODE_INTERRUPTS or OS_IOCLOCKMODE_ALL, which is checked at initialization: a reader which preempts
+ *     the writer cannot complete its copy. A reader copies into its snapshot buffer with interrupts locked and passes
+ *     the data to the caller only, if the copy is consistent. It repeats at most OS_CFG_IOC_SEQUENCE_RETRIES copies
+ *     and reports IOC_E_NOK afterwards. A read object with sequence counter has to be used on a single core, as the
+ *     snapshot buffer is not shared between cores.
  *
  *   __Queued (one queue per sender 1:1 or N:1):__
  *   - No interrupt lock and no spinlocks are necessary as all sender and receivers are perfectly decoupled.
@@ -250,6 +266,7 @@
 # include "Os_Task_Types.h"
 # include "Os_TaskInt.h"
 # include "Os_HookInt.h"
+# include "Os_BitInt.h"
 
 /* Os hal dependencies */
 
@@ -259,6 +276,11 @@
  *  GLOBAL CONSTANT MACROS
  **********************************************************************************************************************/
 
+/*! Number of repeated copies, after which a reader with sequence counter gives up. */
+# ifndef OS_CFG_IOC_SEQUENCE_RETRIES
+#  define OS_CFG_IOC_SEQUENCE_RETRIES  (16u)
+# endif
+
 
 /***********************************************************************************************************************
  *  GLOBAL FUNCTION MACROS
@@ -501,6 +523,14 @@ struct Os_IocSendConfigType_Tag
 
   /*! The corresponding receiver */
   P2CONST(Os_IocReceiveConfigType, AUTOMATIC, TYPEDEF) Receive;
+
+  /*! \brief    The multiple receive IOC, which is fed by this sender.
+   *  \details  NULL_PTR, if the receiver is no multiple receive IOC. */
+  P2CONST(Os_IocMultiReceiveConfigType, AUTOMATIC, TYPEDEF) MultiReceive;
+
+  /*! \brief    The ready mask bit of this channel within MultiReceive (OS_BITFIELD_MASK_MSB >> channel index).
+   *  \details  Only used, if MultiReceive uses a ready mask. */
+  Os_BitFieldType ReadyBit;
 };
 
 
@@ -515,6 +545,11 @@ struct Os_IocMultiReceiveType_Tag
 
   /*! The index of the IOC channel from which is received next. */
   Os_ObjIdxType NextReceiveChannel;
+
+  /*! \brief    Marks the IOC channels, which may contain data. The MSb belongs to the first channel.
+   *  \details  Only used, if UsesReadyMask is set in the configuration. Set by the senders, cleared by the
+   *            receiver. */
+  Os_BitFieldType ReadyMask;
 };
 
 
@@ -529,6 +564,10 @@ struct Os_IocMultiReceiveConfigType_Tag
 
   /*! The number of incoming channels. */
   Os_ObjIdxType ReceiveChannelCount;
+
+  /*! \brief    Whether the senders mark their channel in the ready mask.
+   *  \details  Only allowed, if ReceiveChannelCount does not exceed OS_BITFIELD_BITWIDTH. */
+  boolean UsesReadyMask;
 };
 
 
@@ -861,6 +900,14 @@ struct Os_IocReadConfigType_Tag
 
   /*! The callback function to copy data with the correct type. */
   Os_IocCopyCbk CopyCbk;
+
+  /*! \brief    The sequence counter of the data buffer.
+   *  \details  If this pointer is not a NULL_PTR, the reader does not take the spinlock, but repeats torn reads. */
+  P2CONST(Os_IocSequenceType volatile, TYPEDEF, AUTOMATIC) Sequence;
+
+  /*! \brief    Buffer of the size of Data, which receives the copies of a reader with sequence counter.
+   *  \details  The data is passed to the caller only from a consistent copy. NULL_PTR, if Sequence is a NULL_PTR. */
+  P2VAR(void, TYPEDEF, AUTOMATIC) Snapshot;
 };
 
 
@@ -893,6 +940,10 @@ struct Os_IocWriteConfigType_Tag
 
   /*! The callback function to initialize the data buffer. */
   Os_IocInitCbk InitCbk;
+
+  /*! \brief    The sequence counter of the data buffer.
+   *  \details  NULL_PTR, if all readers lock. Otherwise it is shared with the readers and all writers of the buffer. */
+  P2VAR(Os_IocSequenceType volatile, TYPEDEF, AUTOMATIC) Sequence;
 };
 
 
@@ -1036,6 +1087,40 @@ FUNC(Std_ReturnType, OS_CODE) Os_Ioc08Receive
 );
 
 
+/***********************************************************************************************************************
+ *  Os_Ioc08ReceiveN()
+ **********************************************************************************************************************/
+/*! \brief          Reads up to Count items from the IOC.
+ *  \details        The access check and the lock are performed once for all items. Reading stops, if the IOC is
+ *                  empty. A data loss is reported once, as by consecutive calls of Os_Ioc08Receive().
+ *
+ *  \param[in,out]  Ioc        IOC to query. Parameter must not be NULL.
+ *  \param[out]     Data       Array to be filled with the received data elements. Parameter must not be NULL.
+ *                             The array must provide Count elements.
+ *  \param[in]      Count      Maximum number of elements to read.
+ *  \param[out]     Received   Number of elements written to Data. Parameter must not be NULL.
+ *
+ *  \retval         IOC_E_OK        Reading from the IOC succeeded.
+ *  \retval         IOC_E_LOST_DATA The sender was unable to write all data to the IOC because of a buffer overflow.
+ *  \retval         IOC_E_NO_DATA   The buffer is empty or Count is zero.
+ *  \retval         IOC_E_NOK       The current application may not use this IOC function.
+ *
+ *  \context        ANY
+ *
+ *  \reentrant      TRUE for different objects.
+ *  \synchronous    TRUE
+ *
+ *  \pre            Depending on the lock type the caller has to synchronize the access to the given IOC object.
+ **********************************************************************************************************************/
+FUNC(Std_ReturnType, OS_CODE) Os_Ioc08ReceiveN
+(
+  P2CONST(Os_Ioc08ReceiveConfigType, TYPEDEF, OS_CONST) Ioc,
+  P2VAR(uint8, TYPEDEF, AUTOMATIC) Data,
+  uint32 Count,
+  P2VAR(uint32, TYPEDEF, AUTOMATIC) Received
+);
+
+
 /***********************************************************************************************************************
  *  Os_Ioc08EmptyQueue()
  **********************************************************************************************************************/
@@ -1123,6 +1208,40 @@ FUNC(Std_ReturnType, OS_CODE) Os_Ioc08Send
 );
 
 
+/***********************************************************************************************************************
+ *  Os_Ioc08SendN()
+ **********************************************************************************************************************/
+/*! \brief          Writes up to Count items to the IOC.
+ *  \details        The access check, the lock and the callbacks are performed once for all items. Writing stops, if
+ *                  the buffer is full. The remaining items are lost and the lost counter is incremented once.
+ *
+ *  \param[in,out]  Ioc        IOC to query. Parameter must not be NULL.
+ *  \param[in]      Data       Array of the data elements to write. Parameter must not be NULL.
+ *                             The array must provide Count elements.
+ *  \param[in]      Count      Number of elements to write.
+ *  \param[out]     Sent       Number of elements written to the IOC. Parameter must not be NULL.
+ *
+ *  \retval         IOC_E_OK        Writing all elements to the IOC succeeded.
+ *  \retval         IOC_E_LIMIT     The sender was unable to write all data to the IOC because of a buffer overflow.
+ *  \retval         IOC_E_NOK       The current application may not use this IOC function or at least one of the
+ *                                  callbacks is not successfully triggered.
+ *
+ *  \context        ANY
+ *
+ *  \reentrant      TRUE for different objects.
+ *  \synchronous    TRUE
+ *
+ *  \pre            Depending on the lock type the caller has to synchronize the access to the given IOC object.
+ **********************************************************************************************************************/
+FUNC(Std_ReturnType, OS_CODE) Os_Ioc08SendN
+(
+  P2CONST(Os_Ioc08SendConfigType, TYPEDEF, OS_CONST) Ioc,
+  P2CONST(uint8, TYPEDEF, AUTOMATIC) Data,
+  uint32 Count,
+  P2VAR(uint32, TYPEDEF, AUTOMATIC) Sent
+);
+
+
 /***********************************************************************************************************************
  *  IOC uint16
  **********************************************************************************************************************/
@@ -1194,6 +1313,40 @@ FUNC(Std_ReturnType, OS_CODE) Os_Ioc16Receive
 );
 
 
+/***********************************************************************************************************************
+ *  Os_Ioc16ReceiveN()
+ **********************************************************************************************************************/
+/*! \brief          Reads up to Count items from the IOC.
+ *  \details        The access check and the lock are performed once for all items. Reading stops, if the IOC is
+ *                  empty. A data loss is reported once, as by consecutive calls of Os_Ioc16Receive().
+ *
+ *  \param[in,out]  Ioc        IOC to query. Parameter must not be NULL.
+ *  \param[out]     Data       Array to be filled with the received data elements. Parameter must not be NULL.
+ *                             The array must provide Count elements.
+ *  \param[in]      Count      Maximum number of elements to read.
+ *  \param[out]     Received   Number of elements written to Data. Parameter must not be NULL.
+ *
+ *  \retval         IOC_E_OK        Reading from the IOC succeeded.
+ *  \retval         IOC_E_LOST_DATA The sender was unable to write all data to the IOC because of a buffer overflow.
+ *  \retval         IOC_E_NO_DATA   The buffer is empty or Count is zero.
+ *  \retval         IOC_E_NOK       The current application may not use this IOC function.
+ *
+ *  \context        ANY
+ *
+ *  \reentrant      TRUE for different objects.
+ *  \synchronous    TRUE
+ *
+ *  \pre            Depending on the lock type the caller has to synchronize the access to the given IOC object.
+ **********************************************************************************************************************/
+FUNC(Std_ReturnType, OS_CODE) Os_Ioc16ReceiveN
+(
+  P2CONST(Os_Ioc16ReceiveConfigType, TYPEDEF, OS_CONST) Ioc,
+  P2VAR(uint16, TYPEDEF, AUTOMATIC) Data,
+  uint32 Count,
+  P2VAR(uint32, TYPEDEF, AUTOMATIC) Received
+);
+
+
 /***********************************************************************************************************************
  *  Os_Ioc16EmptyQueue()
  **********************************************************************************************************************/
@@ -1281,6 +1434,40 @@ FUNC(Std_ReturnType, OS_CODE) Os_Ioc16Send
 );
 
 
+/***********************************************************************************************************************
+ *  Os_Ioc16SendN()
+ **********************************************************************************************************************/
+/*! \brief          Writes up to Count items to the IOC.
+ *  \details        The access check, the lock and the callbacks are performed once for all items. Writing stops, if
+ *                  the buffer is full. The remaining items are lost and the lost counter is incremented once.
+ *
+ *  \param[in,out]  Ioc        IOC to query. Parameter must not be NULL.
+ *  \param[in]      Data       Array of the data elements to write. Parameter must not be NULL.
+ *                             The array must provide Count elements.
+ *  \param[in]      Count      Number of elements to write.
+ *  \param[out]     Sent       Number of elements written to the IOC. Parameter must not be NULL.
+ *
+ *  \retval         IOC_E_OK        Writing all elements to the IOC succeeded.
+ *  \retval         IOC_E_LIMIT     The sender was unable to write all data to the IOC because of a buffer overflow.
+ *  \retval         IOC_E_NOK       The current application may not use this IOC function or at least one of the
+ *                                  callbacks is not successfully triggered.
+ *
+ *  \context        ANY
+ *
+ *  \reentrant      TRUE for different objects.
+ *  \synchronous    TRUE
+ *
+ *  \pre            Depending on the lock type the caller has to synchronize the access to the given IOC object.
+ **********************************************************************************************************************/
+FUNC(Std_ReturnType, OS_CODE) Os_Ioc16SendN
+(
+  P2CONST(Os_Ioc16SendConfigType, TYPEDEF, OS_CONST) Ioc,
+  P2CONST(uint16, TYPEDEF, AUTOMATIC) Data,
+  uint32 Count,
+  P2VAR(uint32, TYPEDEF, AUTOMATIC) Sent
+);
+
+
 /***********************************************************************************************************************
  *  IOC uint32
  **********************************************************************************************************************/
@@ -1350,6 +1537,40 @@ FUNC(Std_ReturnType, OS_CODE) Os_Ioc32Receive
 );
 
 
+/***********************************************************************************************************************
+ *  Os_Ioc32ReceiveN()
+ **********************************************************************************************************************/
+/*! \brief          Reads up to Count items from the IOC.
+ *  \details        The access check and the lock are performed once for all items. Reading stops, if the IOC is
+ *                  empty. A data loss is reported once, as by consecutive calls of Os_Ioc32Receive().
+ *
+ *  \param[in,out]  Ioc        IOC to query. Parameter must not be NULL.
+ *  \param[out]     Data       Array to be filled with the received data elements. Parameter must not be NULL.
+ *                             The array must provide Count elements.
+ *  \param[in]      Count      Maximum number of elements to read.
+ *  \param[out]     Received   Number of elements written to Data. Parameter must not be NULL.
+ *
+ *  \retval         IOC_E_OK        Reading from the IOC succeeded.
+ *  \retval         IOC_E_LOST_DATA The sender was unable to write all data to the IOC because of a buffer overflow.
+ *  \retval         IOC_E_NO_DATA   The buffer is empty or Count is zero.
+ *  \retval         IOC_E_NOK       The current application may not use this IOC function.
+ *
+ *  \context        ANY
+ *
+ *  \reentrant      TRUE for different objects.
+ *  \synchronous    TRUE
+ *
+ *  \pre            Depending on the lock type the caller has to synchronize the access to the given IOC object.
+ **********************************************************************************************************************/
+FUNC(Std_ReturnType, OS_CODE) Os_Ioc32ReceiveN
+(
+  P2CONST(Os_Ioc32ReceiveConfigType, TYPEDEF, OS_CONST) Ioc,
+  P2VAR(uint32, TYPEDEF, AUTOMATIC) Data,
+  uint32 Count,
+  P2VAR(uint32, TYPEDEF, AUTOMATIC) Received
+);
+
+
 /***********************************************************************************************************************
  *  Os_Ioc32EmptyQueue()
  **********************************************************************************************************************/
@@ -1437,6 +1658,40 @@ FUNC(Std_ReturnType, OS_CODE) Os_Ioc32Send
 );
 
 
+/***********************************************************************************************************************
+ *  Os_Ioc32SendN()
+ **********************************************************************************************************************/
+/*! \brief          Writes up to Count items to the IOC.
+ *  \details        The access check, the lock and the callbacks are performed once for all items. Writing stops, if
+ *                  the buffer is full. The remaining items are lost and the lost counter is incremented once.
+ *
+ *  \param[in,out]  Ioc        IOC to query. Parameter must not be NULL.
+ *  \param[in]      Data       Array of the data elements to write. Parameter must not be NULL.
+ *                             The array must provide Count elements.
+ *  \param[in]      Count      Number of elements to write.
+ *  \param[out]     Sent       Number of elements written to the IOC. Parameter must not be NULL.
+ *
+ *  \retval         IOC_E_OK        Writing all elements to the IOC succeeded.
+ *  \retval         IOC_E_LIMIT     The sender was unable to write all data to the IOC because of a buffer overflow.
+ *  \retval         IOC_E_NOK       The current application may not use this IOC function or at least one of the
+ *                                  callbacks is not successfully triggered.
+ *
+ *  \context        ANY
+ *
+ *  \reentrant      TRUE for different objects.
+ *  \synchronous    TRUE
+ *
+ *  \pre            Depending on the lock type the caller has to synchronize the access to the given IOC object.
+ **********************************************************************************************************************/
+FUNC(Std_ReturnType, OS_CODE) Os_Ioc32SendN
+(
+  P2CONST(Os_Ioc32SendConfigType, TYPEDEF, OS_CONST) Ioc,
+  P2CONST(uint32, TYPEDEF, AUTOMATIC) Data,
+  uint32 Count,
+  P2VAR(uint32, TYPEDEF, AUTOMATIC) Sent
+);
+
+
 /***********************************************************************************************************************
  *  IOC Ref
  **********************************************************************************************************************/
@@ -1593,6 +1848,124 @@ FUNC(Std_ReturnType, OS_CODE) Os_IocRefSend
 );
 
 
+/***********************************************************************************************************************
+ *  Os_IocRefSendLoan()
+ **********************************************************************************************************************/
+/*! \brief          Loans the next free element of the IOC buffer to the caller.
+ *  \details        The caller fills the element in place and passes it to the receiver by Os_IocRefSendCommit().
+ *                  This avoids copying the data into the IOC buffer. While the element is loaned, Os_IocRefSend()
+ *                  and further loans are rejected.
+ *
+ *  \param[in,out]  Ioc        IOC to query. Parameter must not be NULL.
+ *  \param[out]     Slot       Returns the address of the loaned element, NULL_PTR on failure.
+ *                             Parameter must not be NULL.
+ *
+ *  \retval         IOC_E_OK        The element has been loaned.
+ *  \retval         IOC_E_LIMIT     The IOC buffer is full. The data loss is reported to the receiver.
+ *  \retval         IOC_E_NOK       The current application is not trusted or may not use this IOC function, or an
+ *                                  element is already loaned.
+ *
+ *  \context        ANY
+ *
+ *  \reentrant      TRUE for different objects.
+ *  \synchronous    TRUE
+ *
+ *  \pre            Depending on the lock type the caller has to synchronize the access to the given IOC object.
+ *  \pre            The IOC buffer is writable by the sending application. The function is available for trusted
+ *                  applications only and not via trap.
+ **********************************************************************************************************************/
+FUNC(Std_ReturnType, OS_CODE) Os_IocRefSendLoan
+(
+  P2CONST(Os_IocRefSendConfigType, TYPEDEF, OS_CONST) Ioc,
+  P2VAR(P2VAR(void, TYPEDEF, AUTOMATIC), TYPEDEF, AUTOMATIC) Slot
+);
+
+
+/***********************************************************************************************************************
+ *  Os_IocRefSendCommit()
+ **********************************************************************************************************************/
+/*! \brief          Passes the loaned element to the receiver.
+ *  \details        The caller must not access the element afterwards.
+ *
+ *  \param[in,out]  Ioc        IOC to query. Parameter must not be NULL.
+ *
+ *  \retval         IOC_E_OK        The element has been passed to the receiver.
+ *  \retval         IOC_E_NOK       The current application is not trusted or may not use this IOC function, no
+ *                                  element is loaned or at least one of the callbacks is not successfully triggered.
+ *
+ *  \context        ANY
+ *
+ *  \reentrant      TRUE for different objects.
+ *  \synchronous    TRUE
+ *
+ *  \pre            Depending on the lock type the caller has to synchronize the access to the given IOC object.
+ **********************************************************************************************************************/
+FUNC(Std_ReturnType, OS_CODE) Os_IocRefSendCommit
+(
+  P2CONST(Os_IocRefSendConfigType, TYPEDEF, OS_CONST) Ioc
+);
+
+
+/***********************************************************************************************************************
+ *  Os_IocRefReceiveBorrow()
+ **********************************************************************************************************************/
+/*! \brief          Lends the eldest element of the IOC buffer to the caller without copying it.
+ *  \details        The element stays in the buffer and is not overwritten by the sender, until it is returned by
+ *                  Os_IocRefReceiveRelease(). While the element is borrowed, Os_IocRefReceive() and further borrows
+ *                  are rejected.
+ *
+ *  \param[in,out]  Ioc        IOC to query. Parameter must not be NULL.
+ *  \param[out]     Slot       Returns the address of the borrowed element, NULL_PTR if no element is borrowed.
+ *                             Parameter must not be NULL.
+ *
+ *  \retval         IOC_E_OK        The element has been borrowed.
+ *  \retval         IOC_E_LOST_DATA The element has been borrowed. The sender was unable to write all data to the IOC
+ *                                  because of a buffer overflow.
+ *  \retval         IOC_E_NO_DATA   The buffer is empty.
+ *  \retval         IOC_E_NOK       The current application is not trusted or may not use this IOC function, or an
+ *                                  element is already borrowed.
+ *
+ *  \context        ANY
+ *
+ *  \reentrant      TRUE for different objects.
+ *  \synchronous    TRUE
+ *
+ *  \pre            Depending on the lock type the caller has to synchronize the access to the given IOC object.
+ *  \pre            The IOC buffer is readable by the receiving application. The function is available for trusted
+ *                  applications only and not via trap.
+ **********************************************************************************************************************/
+FUNC(Std_ReturnType, OS_CODE) Os_IocRefReceiveBorrow
+(
+  P2CONST(Os_IocRefReceiveConfigType, TYPEDEF, OS_CONST) Ioc,
+  P2VAR(P2CONST(void, TYPEDEF, AUTOMATIC), TYPEDEF, AUTOMATIC) Slot
+);
+
+
+/***********************************************************************************************************************
+ *  Os_IocRefReceiveRelease()
+ **********************************************************************************************************************/
+/*! \brief          Returns the borrowed element and removes it from the IOC buffer.
+ *  \details        The caller must not access the element afterwards.
+ *
+ *  \param[in,out]  Ioc        IOC to query. Parameter must not be NULL.
+ *
+ *  \retval         IOC_E_OK        The element has been removed.
+ *  \retval         IOC_E_NOK       The current application is not trusted or may not use this IOC function, or no
+ *                                  element is borrowed.
+ *
+ *  \context        ANY
+ *
+ *  \reentrant      TRUE for different objects.
+ *  \synchronous    TRUE
+ *
+ *  \pre            Depending on the lock type the caller has to synchronize the access to the given IOC object.
+ **********************************************************************************************************************/
+FUNC(Std_ReturnType, OS_CODE) Os_IocRefReceiveRelease
+(
+  P2CONST(Os_IocRefReceiveConfigType, TYPEDEF, OS_CONST) Ioc
+);
+
+
 /***********************************************************************************************************************
  *  IOC Single Buffer
  **********************************************************************************************************************/
@@ -1608,11 +1981,13 @@ FUNC(Std_ReturnType, OS_CODE) Os_IocRefSend
  *  \param[out]     Data       Data reference to be filled with the received data element. Parameter must not be NULL.
  *
  *  \retval         IOC_E_OK        Reading from the IOC succeeded.
- *  \retval         IOC_E_NOK       The current application may not use this IOC function.
+ *  \retval         IOC_E_NOK       The current application may not use this IOC function, or a sequence counter is
+ *                                  configured and OS_CFG_IOC_SEQUENCE_RETRIES copies were torn by writes. Data
+ *                                  is not changed in the latter case.
  *
  *  \context        ANY
  *
- *  \reentrant      TRUE for different objects.
+ *  \reentrant      TRUE for different objects. TRUE, if a sequence counter is configured.
  *  \synchronous    TRUE
  *
  *  \pre            Depending on the lock type the caller has to synchronize the access to the given IOC object.
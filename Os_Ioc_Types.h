@@ -59,7 +59,13 @@ typedef enum
   /*! Lock spinlocks. */
   OS_IOCLOCKMODE_SPINLOCKS,
   /*! Lock interrupts and spinlocks. */
-  OS_IOCLOCKMODE_ALL
+  OS_IOCLOCKMODE_ALL,
+  /*! \brief   Lock nothing. Sender and receiver synchronize by the ordered accesses to the FIFO indices.
+   *  \details Only for queued 1:1 channels, where the sending side and the receiving side are each accessed by one
+   *           context at a time (they may run concurrently on different cores). Other channels are rejected during
+   *           initialization. The lost counter is written by the sender only and is published together with the
+   *           write index. */
+  OS_IOCLOCKMODE_LOCKFREE
 }Os_IocLockModeType;
 
 
@@ -80,6 +86,9 @@ struct Os_Ioc32ReceiveConfigType_Tag;
 
 typedef uint8 Os_IocLostCounterType;
 
+/*! Sequence counter of a single buffered IOC. Odd values mark a write in progress. */
+typedef uint32 Os_IocSequenceType;
+
 typedef struct Os_IocConfigType_Tag Os_IocConfigType;
 typedef struct Os_IocType_Tag Os_IocType;
 
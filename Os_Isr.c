@@ -49,6 +49,7 @@
 #include "Os_Trace.h"
 #include "Os_Error.h"
 #include "Os_Core.h"
+#include "Os_AccessCheck.h"
 
 /* Os hal dependencies */
 #include "Os_Hal_Core.h"
@@ -396,6 +397,7 @@ FUNC(void, OS_CODE) Os_IsrInit
 )
 {
   Os_Assert(Os_ErrIsValueLo((uint32)Isr->Id, (uint32)OS_ISRID_COUNT));
+  Os_Assert(Os_AccessCheckIsSortingValid(Os_IsrGetAccessRights(Isr)));                                                  /* SBSW_OS_FC_PRECONDITION */ /* SBSW_OS_FC_PRECONDITION */
 
   /* #10 Initialize thread. */
   Os_ThreadInit(Os_IsrGetThread(Isr));                                                                                  /* SBSW_OS_ISR_THREADINIT_001 */ /* SBSW_OS_FC_PRECONDITION */
@@ -438,6 +440,9 @@ FUNC(void, OS_CODE) Os_IsrRun
   /* #10 Suspend interrupts. */
   Os_IntSuspend(&interruptState);                                                                                       /* SBSW_OS_FC_POINTER2LOCAL */
 
+  /* #12 Catch up the periodic ticks, which have been suppressed by tickless idle. */
+  Os_CoreTicklessLeave(core);                                                                                           /* SBSW_OS_ISR_CORETICKLESSLEAVE_001 */
+
   /* #15 Enable global interrupt flag if suspended to level previously. */
   if(Os_InterruptLockOnLevelIsNeeded() != 0u)                                                                           /* COV_OS_HALPLATFORMLEVELSUPPORT */ /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */
   {
@@ -1083,6 +1088,10 @@ FUNC(void, OS_CODE) Os_IsrKill
  \DESCRIPTION    Os_CoreAsrGetTimingProtection is called with the return value of Os_ThreadGetCore.
  \COUNTERMEASURE \M [CM_OS_THREADGETCORE_M]
 
+\ID SBSW_OS_ISR_CORETICKLESSLEAVE_001
+ \DESCRIPTION    Os_CoreTicklessLeave is called with the return value of Os_ThreadGetCore.
+ \COUNTERMEASURE \M [CM_OS_THREADGETCORE_M]
+
 \ID SBSW_OS_ISR_COREINITIALENABLEINTERRUPTSOURCES_001
  \DESCRIPTION    Os_CoreInitialEnableInterruptSources is called with the return value of Os_ThreadGetCore.
  \COUNTERMEASURE \M [CM_OS_THREADGETCORE_M]
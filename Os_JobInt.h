@@ -49,6 +49,7 @@
 # include "Os_CounterInt.h"
 # include "Os_CommonInt.h"
 # include "Os_Job_Types.h"
+# include "Os_TimingWheel_Types.h"
 # include "Os_ErrorInt.h"
 
 /* Os HAL dependencies */
@@ -105,6 +106,9 @@ struct Os_JobConfigType_Tag
 
   /*! Callback function which is executed when the job expires. */
   Os_JobCallbackType Callback;
+
+  /*! Timing wheel data of the job. NULL_PTR, if the underlying counter keeps its jobs in a priority queue. */
+  P2VAR(Os_TimingWheelJobType, TYPEDEF, OS_VAR_NOINIT) WheelJob;
 };
 
 
@@ -135,6 +135,60 @@ FUNC(void, OS_CODE) Os_MemFault
 }                                                                                                                       /* PRQA S 6050 */ /* MD_MSR_STCAL */
 
 
+/***********************************************************************************************************************
+ *  Os_Api_GetMpSkippedSwitches()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ */
+FUNC(uint32, OS_CODE) Os_Api_GetMpSkippedSwitches
+(
+  CoreIdType CoreID
+)
+{
+  uint32 result;
+  Os_StatusType status;
+
+  result = 0u;
+
+  /* #10 Perform error checks. */
+  if(Os_MpIsEnabled() == 0u)                                                                                            /* PRQA S 2992, 2996 */ /* MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2996 */
+  {
+    status = OS_STATUS_MP_DISABLED_BY_CONFIG;
+  }
+  else if(OS_UNLIKELY(Os_CoreCheckId(CoreID) == OS_CHECK_FAILED))
+  {
+    status = OS_STATUS_ID_1;
+  }
+  else
+  {
+    P2CONST(Os_CoreConfigType, AUTOMATIC, OS_CONST) core;
+
+    core = Os_CoreId2Core(CoreID);
+
+    if(OS_UNLIKELY(Os_CoreCheckIsAsrCore(core) == OS_CHECK_FAILED))                                                     /* SBSW_OS_MP_CORECHECKISASRCORE_001 */ /* COV_OS_HALPLATFORMMULTICOREUNSUPPORTED */
+    {
+      status = OS_STATUS_ID_TYPE_1;
+    }
+    /* #20 Read the counter of the given core. It is written by that core only, so no synchronization is needed. */
+    else
+    {
+      result = Os_CoreAsrGetMpActive(Os_Core2AsrCore(core))->SkippedSwitches;                                           /* SBSW_OS_MP_CORE2ASRCORE_002 */
+      status = OS_STATUS_OK;
+    }
+  }
+
+  /* #30 Report error if applicable. */
+  Os_ErrReportGetMpSkippedSwitches(status, CoreID);
+
+  return result;
+}                                                                                                                       /* PRQA S 6050 */ /* MD_MSR_STCAL */
+
+
 #define OS_STOP_SEC_CODE
 #include "Os_MemMap_OsCode.h"                                                                                           /* PRQA S 5087 */ /* MD_MSR_MemMap */
 
@@ -175,6 +229,14 @@ FUNC(void, OS_CODE) Os_MemFault
  \DESCRIPTION    Os_Core2AsrCore is called with the return value of Os_CoreGetCurrentCore.
  \COUNTERMEASURE \S [CM_OS_COREGETCURRENTCORE_S]
 
+\ID SBSW_OS_MP_CORE2ASRCORE_002
+ \DESCRIPTION    Os_Core2AsrCore is called with the return value of Os_CoreId2Core.
+ \COUNTERMEASURE \M [CM_OS_COREID2CORE_M]
+
+\ID SBSW_OS_MP_CORECHECKISASRCORE_001
+ \DESCRIPTION    Os_CoreCheckIsAsrCore is called with the return value of Os_CoreId2Core.
+ \COUNTERMEASURE \M [CM_OS_COREID2CORE_M]
+
 \ID SBSW_OS_MP_COREGETKERNELSTACK_001
  \DESCRIPTION    Os_CoreGetKernelStack is called with the return value of Os_Core2AsrCore.
  \COUNTERMEASURE \N [CM_OS_CORE2ASRCORE_N]
@@ -113,13 +113,19 @@ OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,
 Os_MpCoreInit,
 (
   P2CONST(Os_MpCoreConfigType, AUTOMATIC, OS_CONST) CoreConfig,
-  P2CONST(Os_Hal_ContextStackConfigType, AUTOMATIC, OS_VAR_NOINIT) InitialStackRegion
+  P2CONST(Os_Hal_ContextStackConfigType, AUTOMATIC, OS_VAR_NOINIT) InitialStackRegion,
+  P2VAR(Os_MpActiveType, AUTOMATIC, OS_VAR_NOINIT) Active
 ))
 {
   if(Os_MpIsEnabled() != 0u)                                                                                            /* PRQA S 2991, 2995 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule2.2_2995 */
   {
     /* #10 Initialize the core memory protection and the initial MPU stack window. */
     Os_Hal_MpCoreInit(CoreConfig->HwConfig, InitialStackRegion);                                                        /* SBSW_OS_MP_Hal_MPCOREINIT_001 */
+
+    /* #20 No application or thread access rights are active yet. */
+    Active->AppAccessRights = NULL_PTR;                                                                                 /* SBSW_OS_PWA_PRECONDITION */
+    Active->ThreadAccessRights = NULL_PTR;                                                                              /* SBSW_OS_PWA_PRECONDITION */
+    Active->SkippedSwitches = 0u;                                                                                       /* SBSW_OS_PWA_PRECONDITION */
   }
 }
 
@@ -193,28 +199,51 @@ OS_ALWAYS_INLINE, Os_MpIsEnabledForThreads,
 OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,                                           /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
 Os_MpSwitch,
 (
-  P2CONST(Os_MpAccessRightsType, AUTOMATIC, OS_CONST) Current,
+  P2VAR(Os_MpActiveType, AUTOMATIC, OS_VAR_NOINIT) Active,
   P2CONST(Os_MpAccessRightsType, AUTOMATIC, OS_CONST) Next
 ))
 {
   if(Os_MpIsEnabled() != 0u)                                                                                            /* PRQA S 2991, 2995 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule2.2_2995 */
   {
+    Os_StdReturnType isSkipped = 0u;
+
     if(Os_MpIsEnabledForApplications() != 0u)                                                                           /* PRQA S 2991, 2995 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule2.2_2995 */
     {
-      /* #10 If current and next application access rights are different: */
-      if(Current->AppAccessRights != Next->AppAccessRights)
+      /* #10 If active and next application access rights are different: */
+      if(Active->AppAccessRights != Next->AppAccessRights)
       {
         /* #20 Switch application access rights. */
         Os_Hal_MpAppSwitch(Next->AppAccessRights);                                                                      /* SBSW_OS_MP_Hal_MPAPPSWITCH_001 */
+        Active->AppAccessRights = Next->AppAccessRights;                                                                /* SBSW_OS_PWA_PRECONDITION */
+      }
+      /* #30 Otherwise remember that the switch has been skipped. */
+      else
+      {
+        isSkipped = !0u;                                                                                                /* PRQA S 4404, 4558 */ /* MD_Os_C90BooleanCompatibility, MD_Os_Rule10.1_4558 */
       }
     }
     if(Os_MpIsEnabledForThreads() != 0u)                                                                                /* PRQA S 2991, 2995 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule2.2_2995 */
     {
-      /* #30 Switch thread access rights. */
-      Os_Hal_MpThreadSwitch(Next->ThreadAccessRights);                                                                  /* SBSW_OS_MP_Hal_MPATHREADSWITCH_001 */
+      /* #40 If active and next thread access rights are different: */
+      if(Active->ThreadAccessRights != Next->ThreadAccessRights)
+      {
+        /* #50 Switch thread access rights. */
+        Os_Hal_MpThreadSwitch(Next->ThreadAccessRights);                                                                /* SBSW_OS_MP_Hal_MPATHREADSWITCH_001 */
+        Active->ThreadAccessRights = Next->ThreadAccessRights;                                                          /* SBSW_OS_PWA_PRECONDITION */
+      }
+      /* #60 Otherwise remember that the switch has been skipped. */
+      else
+      {
+        isSkipped = !0u;                                                                                                /* PRQA S 4404, 4558 */ /* MD_Os_C90BooleanCompatibility, MD_Os_Rule10.1_4558 */
+      }
+    }
+
+    /* #70 Count the switch once, if at least one part of the access rights has not been reprogrammed. */
+    if(isSkipped != 0u)
+    {
+      Active->SkippedSwitches++;                                                                                        /* SBSW_OS_PWA_PRECONDITION */
     }
   }
-
 }
 
 
@@ -230,6 +259,7 @@ Os_MpSwitch,
 OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,                                           /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
 Os_MpSwitchTo,
 (
+  P2VAR(Os_MpActiveType, AUTOMATIC, OS_VAR_NOINIT) Active,
   P2CONST(Os_MpAccessRightsType, AUTOMATIC, OS_CONST) AccessRights
 ))
 {
@@ -239,12 +269,14 @@ Os_MpSwitchTo,
     {
       /* #10 Switch application access rights. */
       Os_Hal_MpAppSwitch(AccessRights->AppAccessRights);                                                                /* SBSW_OS_MP_Hal_MPAPPSWITCH_001 */
+      Active->AppAccessRights = AccessRights->AppAccessRights;                                                          /* SBSW_OS_PWA_PRECONDITION */
     }
 
     if(Os_MpIsEnabledForThreads() != 0u)                                                                                /* PRQA S 2991, 2995 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule2.2_2995 */
     {
       /* #20 Switch thread access rights. */
       Os_Hal_MpThreadSwitch(AccessRights->ThreadAccessRights);                                                          /* SBSW_OS_MP_Hal_MPATHREADSWITCH_001 */
+      Active->ThreadAccessRights = AccessRights->ThreadAccessRights;                                                    /* SBSW_OS_PWA_PRECONDITION */
     }
   }
 }
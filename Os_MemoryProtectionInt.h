@@ -48,6 +48,15 @@
  *  ![MPU Example](MemProtExampleMpu.png)
  *
  *
+ *  ### Avoiding Redundant Reprogramming ###
+ *  Each core remembers the application and thread access rights, which are currently programmed into its memory
+ *  protection hardware. On a switch, only those parts of the access rights are reprogrammed which differ from the
+ *  active ones. Thread switches and service function calls within the same OS-application therefore do not touch the
+ *  application regions, and switches between threads sharing their thread access rights do not touch the hardware at
+ *  all. Each core counts the switches which have skipped at least one part of the reprogramming. The counter can be
+ *  read by \ref Os_GetMpSkippedSwitches().
+ *
+ *
  *  ### Memory Protection Violation Handling ###
  *  ![Memory Protection Violation Handling](MemoryProtection_MemFault.png)
  *
@@ -146,6 +155,21 @@ struct Os_MpAccessRightsType_Tag
 typedef P2CONST(Os_MpAccessRightsType, TYPEDEF, OS_CONST) Os_MpAccessRightsRefType;
 
 
+/*! Memory protection settings, which are currently programmed into the hardware of a core. */
+struct Os_MpActiveType_Tag
+{
+  /*! The active application access rights. NULL_PTR, if not known. */
+  P2CONST(Os_Hal_MpAppConfigType, TYPEDEF, OS_CONST) AppAccessRights;
+
+  /*! The active thread access rights. NULL_PTR, if not known. */
+  P2CONST(Os_Hal_MpThreadConfigType, TYPEDEF, OS_CONST) ThreadAccessRights;
+
+  /*! Number of switches, which have not reprogrammed the application or the thread access rights (or both),
+   *  because the requested access rights were already active. See \ref Os_GetMpSkippedSwitches(). */
+  uint32 SkippedSwitches;
+};
+
+
 /***********************************************************************************************************************
  *  GLOBAL DATA PROTOTYPES
  **********************************************************************************************************************/
@@ -189,7 +213,8 @@ OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE, O
  **********************************************************************************************************************/
 /*! \brief          Initializes core access rights.
  *  \details        Initializes the core's memory protection mechanism and set the passed memory protection settings
- *                  for the core. Initialize the initial MPU stack window.
+ *                  for the core. Initialize the initial MPU stack window. Mark the active access rights of the core
+ *                  as unknown.
  *
  *  \param[in]      CoreConfig   Core configuration for memory protection mechanism. Parameter must not be NULL,
  *                               if memory protection is enabled.
@@ -197,6 +222,9 @@ OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE, O
  *  \param[in]      InitialStackRegion  Stack configuration for memory protection mechanism. Parameter must not be NULL,
  *                                      if memory protection is enabled.
  *
+ *  \param[out]     Active       The active access rights of the core. Parameter must not be NULL, if memory
+ *                               protection is enabled.
+ *
  *  \context        OS_INTERNAL
  *
  *  \reentrant      TRUE
@@ -209,7 +237,8 @@ OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE, O
 OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE, Os_MpCoreInit,
 (
   P2CONST(Os_MpCoreConfigType, AUTOMATIC, OS_CONST) CoreConfig,
-  P2CONST(Os_Hal_ContextStackConfigType, AUTOMATIC, OS_VAR_NOINIT) InitialStackRegion
+  P2CONST(Os_Hal_ContextStackConfigType, AUTOMATIC, OS_VAR_NOINIT) InitialStackRegion,
+  P2VAR(Os_MpActiveType, AUTOMATIC, OS_VAR_NOINIT) Active
 ));
 
 
@@ -314,10 +343,11 @@ Os_MpIsEnabledForThreads,
  **********************************************************************************************************************/
 /*! \brief          Switches access rights.
  *  \details        Switches thread related access rights and application related access rights.
- *                  Application related access rights are only switched, if they are different to speed up thread
- *                  switching within the same application.
+ *                  Each of them is only switched, if it differs from the active one of the core, to speed up
+ *                  thread switching within the same application.
  *
- *  \param[in]      Current   Current access rights. Parameter must not be NULL, if Memory protection is enabled.
+ *  \param[in,out]  Active    The active access rights of the current core. Parameter must not be NULL, if Memory
+ *                            protection is enabled.
  *  \param[in]      Next      Access rights to switch to. Parameter must not be NULL, if Memory protection is enabled.
  *
  *  \context        OS_INTERNAL
@@ -326,7 +356,7 @@ Os_MpIsEnabledForThreads,
  *  \synchronous    TRUE
  *
  *  \pre            Concurrent access to memory protection hardware prevented by caller.
- *  \pre            Current is the active memory protection configuration.
+ *  \pre            Active has been initialized by Os_MpCoreInit() on the current core.
  *
  *  \trace          CREQ-41, CREQ-62
  *  \trace          SPEC-63794, SPEC-63893, SPEC-64006, SPEC-63740, SPEC-63931, SPEC-63705, SPEC-63978, SPEC-64037
@@ -334,7 +364,7 @@ Os_MpIsEnabledForThreads,
  **********************************************************************************************************************/
 OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE, Os_MpSwitch,
 (
-  P2CONST(Os_MpAccessRightsType, AUTOMATIC, OS_CONST) Current,
+  P2VAR(Os_MpActiveType, AUTOMATIC, OS_VAR_NOINIT) Active,
   P2CONST(Os_MpAccessRightsType, AUTOMATIC, OS_CONST) Next
 ));
 
@@ -343,8 +373,10 @@ OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE, O
  *  Os_MpSwitchTo()
  **********************************************************************************************************************/
 /*! \brief          Switch to given access rights.
- *  \details        Switch thread related access rights and application related access rights.
+ *  \details        Switch thread related access rights and application related access rights unconditionally.
  *
+ *  \param[out]     Active            The active access rights of the current core. Parameter must not be NULL,
+ *                                    if Memory protection is enabled.
  *  \param[in]      AccessRights      Access rights to switch to. Parameter must not be NULL, if Memory protection
  *                                    is enabled.
  *
@@ -357,6 +389,7 @@ OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE, O
  **********************************************************************************************************************/
 OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE, Os_MpSwitchTo,
 (
+  P2VAR(Os_MpActiveType, AUTOMATIC, OS_VAR_NOINIT) Active,
   P2CONST(Os_MpAccessRightsType, AUTOMATIC, OS_CONST) AccessRights
 ));
 
@@ -389,6 +422,29 @@ FUNC(void, OS_CODE) Os_MemFault
 );
 
 
+/***********************************************************************************************************************
+ *  Os_Api_GetMpSkippedSwitches()
+ **********************************************************************************************************************/
+/*! \brief        OS service Os_GetMpSkippedSwitches().
+ *  \details      For further details see Os_GetMpSkippedSwitches().
+ *
+ *  \param[in]    CoreID         See Os_GetMpSkippedSwitches().
+ *
+ *  \return       See Os_GetMpSkippedSwitches().
+ *
+ *  \context      ANY
+ *
+ *  \reentrant    TRUE
+ *  \synchronous  TRUE
+ *
+ *  \pre          See Os_GetMpSkippedSwitches().
+ **********************************************************************************************************************/
+FUNC(uint32, OS_CODE) Os_Api_GetMpSkippedSwitches
+(
+  CoreIdType CoreID
+);
+
+
 
 /***********************************************************************************************************************
  *  GLOBAL FUNCTIONS
@@ -59,6 +59,9 @@ typedef struct Os_MpCoreConfigType_Tag Os_MpCoreConfigType;
 struct Os_MpAccessRightsType_Tag;
 typedef struct Os_MpAccessRightsType_Tag Os_MpAccessRightsType;
 
+struct Os_MpActiveType_Tag;
+typedef struct Os_MpActiveType_Tag Os_MpActiveType;
+
 
 
 
@@ -59,13 +59,6 @@
 /***********************************************************************************************************************
  *  LOCAL DATA TYPES AND STRUCTURES
  **********************************************************************************************************************/
-/*! Sibling identifier */
-typedef enum
-{
-  OS_PRIORITYQUEUESIBLING_LEFT  = 1,    /*!< Left sibling selector */
-  OS_PRIORITYQUEUESIBLING_RIGHT = 2     /*!< Right sibling selector */
-}Os_PriorityQueueSiblingType;
-
 /***********************************************************************************************************************
  *  LOCAL DATA PROTOTYPES
  **********************************************************************************************************************/
@@ -90,28 +83,27 @@ typedef enum
 
 
 /***********************************************************************************************************************
- *  Os_PriorityQueueSiblingIndex()
+ *  Os_PriorityQueueChildIndex()
  **********************************************************************************************************************/
-/*! \brief          Returns the index of a child selected by parameter nodeIdx.
- *  \details        --no details--
+/*! \brief          Returns the index of the first child of the given node.
+ *  \details        The children of a node are stored adjacently. The last child is at
+ *                  index + OS_PRIORITYQUEUE_ARITY - 1.
  *
- *  \param[in]      NodeIdx     The index of the leaf.
- *  \param[in]      Sibling     The identifier of a sibling.
+ *  \param[in]      NodeIdx     The index of the node.
  *
- *  \return         The sibling's node index.
+ *  \return         The first child's node index.
  *
  *  \context        OS_INTERNAL
  *
  *  \reentrant      TRUE
  *  \synchronous    TRUE
  *
- *  \pre            (2 * NodeIdx) + Sibling must not exceed (2^15)-1.
+ *  \pre            (OS_PRIORITYQUEUE_ARITY * NodeIdx) + OS_PRIORITYQUEUE_ARITY must not exceed (2^15)-1.
  **********************************************************************************************************************/
 OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE Os_PriorityQueueNodeIdxType, OS_CODE, OS_ALWAYS_INLINE,
-Os_PriorityQueueSiblingIndex,
+Os_PriorityQueueChildIndex,
 (
-  Os_PriorityQueueNodeIdxType NodeIdx,
-  Os_PriorityQueueSiblingType Sibling
+  Os_PriorityQueueNodeIdxType NodeIdx
 ));
 
 
@@ -122,7 +114,7 @@ Os_PriorityQueueSiblingIndex,
  *  \details        --no details--
  *
  *  \param[in]      NodeIdx     The index of the leaf. NodeIdx must not be OS_PRIORITYQUEUE_ROOT_IDX and
- *                              (NodeIdx - 1) / 2 must be in range 0 .. (2^15)-1.
+ *                              (NodeIdx - 1) / OS_PRIORITYQUEUE_ARITY must be in range 0 .. (2^15)-1.
  *
  *  \return         The parant's node index.
  *
@@ -140,6 +132,35 @@ Os_PriorityQueueParentIndex,
 ));
 
 
+/***********************************************************************************************************************
+ *  Os_PriorityQueueNodeCompare()
+ **********************************************************************************************************************/
+/*! \brief          Returns whether the left node has a higher priority than the right node.
+ *  \details        The comparison uses the time stamps stored in the nodes. The data is not dereferenced.
+ *
+ *  \param[in]      Counter     The counter of both nodes' data. Parameter must not be NULL.
+ *  \param[in]      LeftNode    The left node. Parameter must not be NULL.
+ *  \param[in]      RightNode   The right node. Parameter must not be NULL.
+ *
+ *  \retval         !0          The left node has a higher priority.
+ *  \retval         0           The left node has an equal or lower priority.
+ *
+ *  \context        OS_INTERNAL
+ *
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *
+ *  \pre            -
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE Os_StdReturnType, OS_CODE, OS_ALWAYS_INLINE,
+Os_PriorityQueueNodeCompare,
+(
+  P2CONST(Os_CounterConfigType, AUTOMATIC, OS_CONST) Counter,
+  P2CONST(Os_PriorityQueueNodeType, AUTOMATIC, OS_VAR_NOINIT) LeftNode,
+  P2CONST(Os_PriorityQueueNodeType, AUTOMATIC, OS_VAR_NOINIT) RightNode
+));
+
+
 /***********************************************************************************************************************
  *  Os_PriorityQueueHeapUp()
  **********************************************************************************************************************/
@@ -174,7 +195,7 @@ Os_PriorityQueueHeapUp,
  **********************************************************************************************************************/
 /*! \brief           Moves down the node specified by NodeIdx until it is at the correct place.
  *  \details         Os_PriorityQueueHeapDown restores the heap's shape property for a single node, if one of the node's
- *                   siblings has a higher priority.
+ *                   children has a higher priority.
  *
  *  \param[in,out]   PriorityQueue The priority queue. Parameter must not be NULL.
  *  \param[in]       NodeIdx       The index of the node which may have to be moved down.
@@ -187,10 +208,7 @@ Os_PriorityQueueHeapUp,
  *  \reentrant       TRUE
  *  \synchronous     TRUE
  *
- *  \pre             (2 * NodeIdx) + OS_PRIORITYQUEUESIBLING_LEFT and (2 * NodeIdx) + OS_PRIORITYQUEUESIBLING_RIGHT
- *                   must not exceed (2^15)-1.
- *  \pre             The first unused priority queue node contains a stopper element which is a copy of the element at
- *                   NodeIdx. Therefore, we can ignore the special case that a left sibling exists but no right one.
+ *  \pre             (OS_PRIORITYQUEUE_ARITY * NodeIdx) + OS_PRIORITYQUEUE_ARITY must not exceed (2^15)-1.
  *  \pre             Concurrent access to given object is prevented by caller.
  **********************************************************************************************************************/
 OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE Os_PriorityQueuePositionType, OS_CODE, OS_ALWAYS_INLINE,
@@ -207,7 +225,7 @@ Os_PriorityQueueHeapDown,
 
 
 /***********************************************************************************************************************
- *  Os_PriorityQueueSiblingIndex()
+ *  Os_PriorityQueueChildIndex()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -215,14 +233,13 @@ Os_PriorityQueueHeapDown,
  *
  */
 OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE Os_PriorityQueueNodeIdxType, OS_CODE, OS_ALWAYS_INLINE,
-Os_PriorityQueueSiblingIndex,
+Os_PriorityQueueChildIndex,
 (
-  Os_PriorityQueueNodeIdxType NodeIdx,
-  Os_PriorityQueueSiblingType Sibling
+  Os_PriorityQueueNodeIdxType NodeIdx
 ))
 {
-  /* #10   Calculate the sibling index and return the calculated value */
-  return (Os_PriorityQueueNodeIdxType)((2u * NodeIdx) + (uint16) Sibling);
+  /* #10   Calculate the index of the first child and return the calculated value */
+  return (Os_PriorityQueueNodeIdxType)((OS_PRIORITYQUEUE_ARITY * NodeIdx) + 1u);
 }
 
 
@@ -245,7 +262,28 @@ Os_PriorityQueueParentIndex,
   Os_Assert((Os_StdReturnType)(NodeIdx != OS_PRIORITYQUEUE_ROOT_IDX));                                                  /* PRQA S 4304 */ /* MD_Os_C90BooleanCompatibility */
 
   /* #20 Return the parent's node index. */
-  return ((NodeIdx - (uint16) 1) / (uint16) 2);
+  return (Os_PriorityQueueNodeIdxType)((NodeIdx - (uint16) 1) / (uint16) OS_PRIORITYQUEUE_ARITY);
+}
+
+
+/***********************************************************************************************************************
+ *  Os_PriorityQueueNodeCompare()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE Os_StdReturnType, OS_CODE, OS_ALWAYS_INLINE,
+Os_PriorityQueueNodeCompare,
+(
+  P2CONST(Os_CounterConfigType, AUTOMATIC, OS_CONST) Counter,
+  P2CONST(Os_PriorityQueueNodeType, AUTOMATIC, OS_VAR_NOINIT) LeftNode,
+  P2CONST(Os_PriorityQueueNodeType, AUTOMATIC, OS_VAR_NOINIT) RightNode
+))
+{
+  /* #10 If the right node is in the future of the left node, the left node has a higher priority. */
+  return Os_CounterIsFutureValue(Counter, RightNode->Timestamp, LeftNode->Timestamp);                                   /* SBSW_OS_FC_PRECONDITION */
 }
 
 
@@ -277,6 +315,8 @@ Os_PriorityQueueHeapUp,
   Os_PriorityQueuePositionType result = OS_PRIORITYQUEUEPOSITION_UNCHANGED;
   Os_PriorityQueueNodeIdxType parent;
   Os_PriorityQueueNodeIdxType current = NodeIdx;
+  Os_PriorityQueueNodeType node = PriorityQueue->Queue[NodeIdx];
+  P2CONST(Os_CounterConfigType, AUTOMATIC, OS_CONST) counter = node.Data->Counter;
 
   /* #20 Loop while NodeIdx is not equal to OS_PRIORITYQUEUE_ROOT_IDX. */
   while(current > OS_PRIORITYQUEUE_ROOT_IDX)
@@ -284,15 +324,11 @@ Os_PriorityQueueHeapUp,
     /* #30 Calculate the parentIdx. */
     parent = Os_PriorityQueueParentIndex(current);
 
-    /* #40 If the node[NodeIdx] has a higher priority than its parent: */
-    if(Os_JobPriorityCompare(PriorityQueue->Queue[current].Data, PriorityQueue->Queue[parent].Data) != 0u)              /* SBSW_OS_PQ_JOBPRIORITYCOMPARE_001 */
+    /* #40 If the node has a higher priority than its parent: */
+    if(Os_PriorityQueueNodeCompare(counter, &node, &(PriorityQueue->Queue[parent])) != 0u)                             /* SBSW_OS_PQ_NODECOMPARE_001 */
     {
-      P2CONST(Os_JobConfigType, AUTOMATIC, OS_APPL_DATA) tmpNode;
-
-      /* #50 Swap the node and its parent. */
-      tmpNode = PriorityQueue->Queue[parent].Data;
-      PriorityQueue->Queue[parent].Data = PriorityQueue->Queue[current].Data;                                           /* SBSW_OS_PQ_DATA_INDEX_001 */
-      PriorityQueue->Queue[current].Data = tmpNode;                                                                     /* SBSW_OS_PQ_DATA_INDEX_001 */
+      /* #50 Move the parent down into the current position. */
+      PriorityQueue->Queue[current] = PriorityQueue->Queue[parent];                                                     /* SBSW_OS_PQ_DATA_INDEX_001 */
 
       /* #60 Update nodeIdx to the parentIdx. */
       current = parent;
@@ -307,7 +343,11 @@ Os_PriorityQueueHeapUp,
       break;
     }
   }
-  /* #100 Return the result. */
+
+  /* #100 Store the node at its final position. */
+  PriorityQueue->Queue[current] = node;                                                                                 /* SBSW_OS_PQ_DATA_INDEX_001 */
+
+  /* #110 Return the result. */
   return result;
 }
 
@@ -341,63 +381,66 @@ Os_PriorityQueueHeapDown,
 {
   /* #10   Set result to OS_PRIORITYQUEUEPOSITION_UNCHANGED */
   Os_PriorityQueuePositionType result = OS_PRIORITYQUEUEPOSITION_UNCHANGED;
-  Os_PriorityQueueNodeIdxType left;
-  Os_PriorityQueueNodeIdxType right;
-  Os_PriorityQueueNodeIdxType highPrioSibling;
+  Os_PriorityQueueNodeIdxType usage = PriorityQueue->Dyn->QueueUsage;
+  Os_PriorityQueueNodeIdxType first;
   Os_PriorityQueueNodeIdxType current = NodeIdx;
+  Os_PriorityQueueNodeType node = PriorityQueue->Queue[NodeIdx];
+  P2CONST(Os_CounterConfigType, AUTOMATIC, OS_CONST) counter = node.Data->Counter;
 
-  /* #20   Calculate the index of the left sibling (leftIdx). */
-  left = Os_PriorityQueueSiblingIndex(current, OS_PRIORITYQUEUESIBLING_LEFT);
+  /* #20   Calculate the index of the first child. */
+  first = Os_PriorityQueueChildIndex(current);
 
-  /* #30   Loop while there is a left sibling. */
-  while(left < PriorityQueue->Dyn->QueueUsage)
+  /* #30   Loop while there is a child. */
+  while(first < usage)
   {
-    /* #40   Calculate the index of the right sibling (rightIdx). */
-    right = Os_PriorityQueueSiblingIndex(current, OS_PRIORITYQUEUESIBLING_RIGHT);
+    Os_PriorityQueueNodeIdx_IteratorType child;
+    Os_PriorityQueueNodeIdx_IteratorType end = (Os_PriorityQueueNodeIdx_IteratorType)first + OS_PRIORITYQUEUE_ARITY;
+    Os_PriorityQueueNodeIdxType highPrioChild = first;
 
-    /* Note: The right sibling may be no element of the priority queue. However, because of the precondition it
-     *       can be used anyhow. */
-    /* #50   Select the sibling with the highest priority */
-    if(Os_JobPriorityCompare(PriorityQueue->Queue[left].Data, PriorityQueue->Queue[right].Data) != 0u)                  /* SBSW_OS_PQ_JOBPRIORITYCOMPARE_001 */
+    if(end > usage)
     {
-      highPrioSibling = left;
+      end = usage;
     }
-    else
+
+    /* #40   Select the child with the highest priority. The children are adjacent. */
+    for(child = (Os_PriorityQueueNodeIdx_IteratorType)first + 1u; child < end; child++)
     {
-      highPrioSibling = right;
+      if(Os_PriorityQueueNodeCompare(counter,                                                                           /* SBSW_OS_PQ_NODECOMPARE_001 */
+                                     &(PriorityQueue->Queue[child]),
+                                     &(PriorityQueue->Queue[highPrioChild])) != 0u)
+      {
+        highPrioChild = (Os_PriorityQueueNodeIdxType)child;
+      }
     }
 
-    /* #60   If the selected sibling has a higher priority then the parent: */
-    if(Os_JobPriorityCompare(                                                                                           /* SBSW_OS_PQ_JOBPRIORITYCOMPARE_001 */
-          PriorityQueue->Queue[highPrioSibling].Data,
-          PriorityQueue->Queue[current].Data
-        ) != 0u)
+    /* #50   If the selected child has a higher priority then the node: */
+    if(Os_PriorityQueueNodeCompare(counter, &(PriorityQueue->Queue[highPrioChild]), &node) != 0u)                      /* SBSW_OS_PQ_NODECOMPARE_001 */
     {
-      P2CONST(Os_JobConfigType, AUTOMATIC, OS_APPL_DATA) tmpNode;
-
-      /* #70   Swap the node and the sibling with the higher priority. */
-      tmpNode = PriorityQueue->Queue[highPrioSibling].Data;
-      PriorityQueue->Queue[highPrioSibling].Data = PriorityQueue->Queue[current].Data;                                  /* SBSW_OS_PQ_DATA_INDEX_001 */
-      PriorityQueue->Queue[current].Data = tmpNode;                                                                     /* SBSW_OS_PQ_DATA_INDEX_001 */
+      /* #60   Move the child up into the current position. */
+      PriorityQueue->Queue[current] = PriorityQueue->Queue[highPrioChild];                                              /* SBSW_OS_PQ_DATA_INDEX_001 */
 
-      /* #80   Update nodeIdx to the new position. */
-      current = highPrioSibling;
+      /* #70   Update nodeIdx to the new position. */
+      current = highPrioChild;
 
-      /* #90   Set result to OS_PRIORITYQUEUEPOSITION_MOVED. */
+      /* #80   Set result to OS_PRIORITYQUEUEPOSITION_MOVED. */
       result = OS_PRIORITYQUEUEPOSITION_MOVED;
     }
-    /* #100   otherwise: */
+    /* #90   otherwise: */
     else
     {
-      /* #110  Shape property fulfilled -> abort */
+      /* #100  Shape property fulfilled -> abort */
       break;
     }
-    /* #120  Calculate the index of the left sibling (leftIdx). */
-    left = Os_PriorityQueueSiblingIndex(current, OS_PRIORITYQUEUESIBLING_LEFT);
+    /* #110  Calculate the index of the first child. */
+    first = Os_PriorityQueueChildIndex(current);
   }
+
+  /* #120  Store the node at its final position. */
+  PriorityQueue->Queue[current] = node;                                                                                 /* SBSW_OS_PQ_DATA_INDEX_001 */
+
   /* #130  Return the result. */
   return result;
-}
+}                                                                                                                       /* PRQA S 6080 */ /* MD_MSR_STMIF */
 
 
 
@@ -444,8 +487,9 @@ FUNC(void, OS_CODE) Os_PriorityQueueInsert
   /* #10  Assert that the queue has still capacity */
   Os_Assert((Os_StdReturnType)(PriorityQueue->Dyn->QueueUsage < PriorityQueue->QueueSize));                             /* PRQA S 4304 */ /* MD_Os_C90BooleanCompatibility */
 
-  /* #20  Append the element after the last used node. */
+  /* #20  Append the element and a copy of its expiration time stamp after the last used node. */
   PriorityQueue->Queue[PriorityQueue->Dyn->QueueUsage].Data = Data;                                                     /* SBSW_OS_PQ_DATA_INDEX_001 */
+  PriorityQueue->Queue[PriorityQueue->Dyn->QueueUsage].Timestamp = Os_JobGetExpirationTimestamp(Data);                  /* SBSW_OS_PQ_DATA_INDEX_001 */ /* SBSW_OS_FC_PRECONDITION */
 
   /* #30  Increment the queueUsage counter. */
   PriorityQueue->Dyn->QueueUsage++;                                                                                     /* SBSW_OS_PQ_PRIORITYQUEUEGETDYN_001 */
@@ -477,12 +521,15 @@ FUNC(void, OS_CODE) Os_PriorityQueueDeleteTop
   /* #20   Decrement the number of nodes by one. */
   PriorityQueue->Dyn->QueueUsage--;                                                                                     /* SBSW_OS_PQ_PRIORITYQUEUEGETDYN_001 */
 
-  /* #30   Copy the data pointer of the last node into the deleted node. */
-  PriorityQueue->Queue[OS_PRIORITYQUEUE_ROOT_IDX].Data = PriorityQueue->Queue[PriorityQueue->Dyn->QueueUsage].Data;     /* SBSW_OS_PQ_DATA_INDEX_001 */
+  /* #30   If the queue is not empty now: */
+  if(PriorityQueue->Dyn->QueueUsage > 0u)
+  {
+    /* #40   Copy the last node into the deleted node. */
+    PriorityQueue->Queue[OS_PRIORITYQUEUE_ROOT_IDX] = PriorityQueue->Queue[PriorityQueue->Dyn->QueueUsage];             /* SBSW_OS_PQ_DATA_INDEX_001 */
 
-  /* Note: The line above covers the precondition of Os_PriorityQueueHeapDown below */
-  /* #40   Restore the shape property by calling Os_PriorityQueueHeapDown(deletedIdx). */
-  (void)Os_PriorityQueueHeapDown(PriorityQueue, OS_PRIORITYQUEUE_ROOT_IDX);                                             /* SBSW_OS_FC_PRECONDITION */
+    /* #50   Restore the shape property by calling Os_PriorityQueueHeapDown(deletedIdx). */
+    (void)Os_PriorityQueueHeapDown(PriorityQueue, OS_PRIORITYQUEUE_ROOT_IDX);                                           /* SBSW_OS_FC_PRECONDITION */
+  }
 }
 
 
@@ -540,10 +587,9 @@ FUNC(Os_PriorityQueueDeleteResultType, OS_CODE) Os_PriorityQueueDelete
     /* #60 If the deleted node is not the last node: */
     if (OS_LIKELY(idx < (Os_PriorityQueueNodeIdx_IteratorType) PriorityQueue->Dyn->QueueUsage))
     {
-      /* #70 Copy the data pointer of the last node into the deleted node. */
+      /* #70 Copy the last node into the deleted node. */
       PriorityQueue->Queue[idx] = PriorityQueue->Queue[PriorityQueue->Dyn->QueueUsage];                                 /* SBSW_OS_PQ_DATA_INDEX_001 */
 
-      /* Note: The line above covers the precondition of Os_PriorityQueueHeapDown below */
       /* #80 Restore the shape property by calling Os_PriorityQueueHeapDown(deletedIdx). */
       heapDownRetVal = Os_PriorityQueueHeapDown(PriorityQueue, (Os_PriorityQueueNodeIdxType) idx);                      /* SBSW_OS_FC_PRECONDITION */
 
@@ -562,6 +608,114 @@ FUNC(Os_PriorityQueueDeleteResultType, OS_CODE) Os_PriorityQueueDelete
 }
 
 
+/***********************************************************************************************************************
+ *  Os_PriorityQueueDeleteDue()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ *
+ *
+ *
+ *
+ *
+ *
+ *
+ */
+FUNC(Os_PriorityQueueNodeIdxType, OS_CODE) Os_PriorityQueueDeleteDue
+(
+  P2CONST(Os_PriorityQueueConfigType, AUTOMATIC, OS_CONST) PriorityQueue,
+  Os_TickType Now,
+  P2VAR(Os_PriorityQueueNodeType, AUTOMATIC, OS_VAR_NOINIT) Nodes,
+  Os_PriorityQueueNodeIdxType MaxCount
+)
+{
+  Os_PriorityQueueNodeIdx_IteratorType idx;
+  Os_PriorityQueueNodeIdx_IteratorType scanEnd;
+  Os_PriorityQueueNodeIdx_IteratorType last;
+  Os_PriorityQueueNodeIdxType count = 0u;
+  Os_PriorityQueueNodeIdxType usage = PriorityQueue->Dyn->QueueUsage;
+
+  /* #10 Walk the queue in index order. Only the root and children of removed nodes may be expired, because the
+   *     expired nodes form a subtree which contains the root. Stop behind the last child of a removed node. */
+  scanEnd = (Os_PriorityQueueNodeIdx_IteratorType)OS_PRIORITYQUEUE_ROOT_IDX + 1u;
+  for(idx = OS_PRIORITYQUEUE_ROOT_IDX; (idx < scanEnd) && (idx < usage) && (count < MaxCount); idx++)
+  {
+    if((idx == OS_PRIORITYQUEUE_ROOT_IDX) ||
+       (PriorityQueue->Queue[Os_PriorityQueueParentIndex((Os_PriorityQueueNodeIdxType)idx)].Data == NULL_PTR))
+    {
+      P2CONST(Os_JobConfigType, AUTOMATIC, OS_APPL_DATA) data = PriorityQueue->Queue[idx].Data;
+
+      /* #20 If the node is expired, return it and mark it as hole. */
+      if(Os_CounterIsFutureValue(data->Counter, PriorityQueue->Queue[idx].Timestamp, Now) == 0u)                        /* SBSW_OS_PQ_COUNTERISFUTUREVALUE_001 */
+      {
+        Nodes[count] = PriorityQueue->Queue[idx];                                                                       /* SBSW_OS_PQ_NODES_INDEX_001 */
+        count++;
+        PriorityQueue->Queue[idx].Data = NULL_PTR;                                                                      /* SBSW_OS_PQ_DATA_INDEX_001 */
+        scanEnd = (Os_PriorityQueueNodeIdx_IteratorType)Os_PriorityQueueChildIndex((Os_PriorityQueueNodeIdxType)idx)
+                  + OS_PRIORITYQUEUE_ARITY;
+      }
+    }
+  }
+
+  /* #30 If nodes have been removed: */
+  if(count > 0u)
+  {
+    Os_PriorityQueueNodeIdx_IteratorType tail = usage;
+
+    /* #40 Shrink the queue. All holes are located in front of the scan end. */
+    usage = usage - count;
+    PriorityQueue->Dyn->QueueUsage = usage;                                                                             /* SBSW_OS_PQ_PRIORITYQUEUEGETDYN_001 */
+    last = idx;
+    if(last > usage)
+    {
+      last = usage;
+    }
+
+    /* #50 Fill each hole in front of the new end with one of the remaining last nodes. */
+    for(idx = OS_PRIORITYQUEUE_ROOT_IDX; idx < last; idx++)
+    {
+      if(PriorityQueue->Queue[idx].Data == NULL_PTR)
+      {
+        do
+        {
+          tail--;
+        } while(PriorityQueue->Queue[tail].Data == NULL_PTR);
+
+        PriorityQueue->Queue[idx] = PriorityQueue->Queue[tail];                                                         /* SBSW_OS_PQ_DATA_INDEX_001 */
+      }
+    }
+
+    /* #60 Restore the shape property once, from the last filled node up to the root. The subtrees of all other
+     *     nodes are unchanged. */
+    for(idx = last; idx > OS_PRIORITYQUEUE_ROOT_IDX; idx--)
+    {
+      (void)Os_PriorityQueueHeapDown(PriorityQueue, (Os_PriorityQueueNodeIdxType)(idx - 1u));                          /* SBSW_OS_FC_PRECONDITION */
+    }
+
+    /* #70 Sort the returned nodes by expiration time (insertion sort, the number of nodes is small). */
+    for(idx = 1u; idx < count; idx++)
+    {
+      Os_PriorityQueueNodeType node = Nodes[idx];
+      Os_PriorityQueueNodeIdx_IteratorType pos = idx;
+
+      while((pos > 0u) && (Os_PriorityQueueNodeCompare(node.Data->Counter, &node, &(Nodes[pos - 1u])) != 0u))         /* SBSW_OS_PQ_NODECOMPARE_002 */
+      {
+        Nodes[pos] = Nodes[pos - 1u];                                                                                   /* SBSW_OS_PQ_NODES_INDEX_001 */
+        pos--;
+      }
+      Nodes[pos] = node;                                                                                                /* SBSW_OS_PQ_NODES_INDEX_001 */
+    }
+  }
+
+  /* #80 Return the number of removed nodes. */
+  return count;
+}                                                                                                                       /* PRQA S 6010, 6030, 6080 */ /* MD_MSR_STPTH, MD_MSR_STCYC, MD_MSR_STMIF */
+
+
 #define OS_STOP_SEC_CODE
 #include "Os_MemMap_OsCode.h"                                                                                           /* PRQA S 5087 */ /* MD_MSR_MemMap */
 
@@ -572,8 +726,8 @@ FUNC(Os_PriorityQueueDeleteResultType, OS_CODE) Os_PriorityQueueDelete
 
 /* SBSW_JUSTIFICATION_BEGIN
 
-\ID SBSW_OS_PQ_JOBPRIORITYCOMPARE_001
- \DESCRIPTION    Os_JobPriorityCompare is called with values derived from a Queue. The Queue is part of a
+\ID SBSW_OS_PQ_NODECOMPARE_001
+ \DESCRIPTION    Os_PriorityQueueNodeCompare is called with nodes and a counter derived from a Queue. The Queue is part of a
                  PriorityQueue which is passed as argument. Precondition ensures that the PriorityQueue pointer is
                  valid. The compliance of the precondition is check during review.
  \COUNTERMEASURE \T [CM_OS_PRIORITYQUEUE_QUEUE_DATA_T]
@@ -593,10 +747,31 @@ FUNC(Os_PriorityQueueDeleteResultType, OS_CODE) Os_PriorityQueueDelete
  \COUNTERMEASURE \T [CM_OS_PRIORITYQUEUE_QUEUE_DATA_T]
                  \M [CM_OS_PRIORITYQUEUE_DYN_M]
 
+\ID SBSW_OS_PQ_COUNTERISFUTUREVALUE_001
+ \DESCRIPTION    Os_CounterIsFutureValue is called with the Counter of a Data element, which is derived from a Queue
+                 object. The Queue is derived from a PriorityQueue which is passed as argument. Precondition ensures
+                 that the PriorityQueue pointer is valid. The compliance of the precondition is check during review.
+ \COUNTERMEASURE \T [CM_OS_PRIORITYQUEUE_QUEUE_DATA_T]
+                 \M [CM_OS_PRIORITYQUEUE_QUEUE_DATA_M]
+
+\ID SBSW_OS_PQ_NODES_INDEX_001
+ \DESCRIPTION    Write access to an element of the Nodes array, which is passed as argument. The index is lower than
+                 MaxCount. Precondition ensures that Nodes provides space for MaxCount elements.
+ \COUNTERMEASURE \N [CM_OS_PRIORITYQUEUE_NODES_N]
+
+\ID SBSW_OS_PQ_NODECOMPARE_002
+ \DESCRIPTION    Os_PriorityQueueNodeCompare is called with values from the Nodes array, which have been copied from
+                 the Queue before.
+ \COUNTERMEASURE \T [CM_OS_PRIORITYQUEUE_QUEUE_DATA_T]
+                 \M [CM_OS_PRIORITYQUEUE_QUEUE_DATA_M]
+
 SBSW_JUSTIFICATION_END */
 
 
 /*
+\CM CM_OS_PRIORITYQUEUE_NODES_N
+      The caller passes a local array with at least MaxCount elements.
+
 \CM CM_OS_PRIORITYQUEUE_QUEUE_DATA_T
       TCASE-345828 ensures consistent management of Data handled by the priority queue class and that the used indieces
       are in a valid range.
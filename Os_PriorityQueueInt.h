@@ -21,10 +21,15 @@
  * The queue is based on a binary heap. The type of the heap (minimum or maximum) is defined by the compare function
  * provided by the user of the heap.
  *
+ * The arity of the heap may be raised to 4 or 8 by OS_CFG_PRIORITYQUEUE_ARITY. A d-ary heap is flatter, so that
+ * HeapUp needs fewer steps. HeapDown compares more children per level, but these are adjacent in memory.
+ * Each node holds a copy of the job's expiration time stamp, so that comparisons do not dereference the job.
+ *
  * Operations which are provided:
  * - Insert a new node.
  * - Get and delete the node with minimum key.
  * - Remove an arbitrary element in the heap.
+ * - Remove all expired nodes with a single repair of the heap.
  *
  * ####Alternatives####
  * We may use a [red-black tree](http:\\en.wikipedia.org/wiki/Red%E2%80%93black_tree) here.
@@ -220,6 +225,40 @@ FUNC(Os_PriorityQueueDeleteResultType, OS_CODE) Os_PriorityQueueDelete
 );
 
 
+/***********************************************************************************************************************
+ *  Os_PriorityQueueDeleteDue()
+ **********************************************************************************************************************/
+/*! \brief          Removes up to MaxCount expired nodes with a single repair of the heap.
+ *  \details        Expired nodes form a subtree which contains the root. This subtree is collected in one pass over
+ *                  the queue, starting at the root. The resulting holes are filled with the last nodes, before the
+ *                  shape property is restored once from the bottom up.
+ *                  The removed data pointers are returned in expiration order.
+ *
+ *  \param[in,out]  PriorityQueue The priority queue. Parameter must not be NULL.
+ *  \param[in]      Now           The current counter value. Nodes which are not in the future of Now are expired.
+ *  \param[out]     Nodes         Receives the data pointers of the removed nodes. Parameter must not be NULL.
+ *  \param[in]      MaxCount      The maximum number of nodes to remove. Nodes must provide space for MaxCount
+ *                                elements.
+ *
+ *  \return         The number of removed nodes.
+ *
+ *  \context        OS_INTERNAL
+ *
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *
+ *  \pre            Concurrent access to given object is prevented by caller.
+ *  \pre            All elements of the queue belong to the same counter.
+ **********************************************************************************************************************/
+FUNC(Os_PriorityQueueNodeIdxType, OS_CODE) Os_PriorityQueueDeleteDue
+(
+  P2CONST(Os_PriorityQueueConfigType, AUTOMATIC, OS_CONST) PriorityQueue,
+  Os_TickType Now,
+  P2VAR(Os_PriorityQueueNodeType, AUTOMATIC, OS_VAR_NOINIT) Nodes,
+  Os_PriorityQueueNodeIdxType MaxCount
+);
+
+
 
 # define OS_STOP_SEC_CODE
 # include "Os_MemMap_OsCode.h"                                                                                          /* PRQA S 5087 */ /* MD_MSR_MemMap */
@@ -39,6 +39,8 @@
 /* Os module declarations */
 
 /* Os kernel module dependencies */
+# include "Os_Cfg.h"
+# include "Os_Types.h"
 # include "Os_Job_Types.h"
 
 
@@ -49,6 +51,19 @@
 /*! Index of the root node */
 # define  OS_PRIORITYQUEUE_ROOT_IDX              ((Os_PriorityQueueNodeIdxType)0)
 
+/*! Number of children of each node (heap arity).
+ *  A higher arity gives a flatter heap. All children of a node are adjacent, so that the comparisons of HeapDown hit
+ *  few cache lines. The arity may be configured with OS_CFG_PRIORITYQUEUE_ARITY to 2, 4 or 8. */
+# if defined (OS_CFG_PRIORITYQUEUE_ARITY)                                                                               /* COV_OS_PRIORITYQUEUEARITY */
+#  define OS_PRIORITYQUEUE_ARITY                 (OS_CFG_PRIORITYQUEUE_ARITY)
+# else
+#  define OS_PRIORITYQUEUE_ARITY                 (2u)
+# endif
+
+# if (OS_PRIORITYQUEUE_ARITY != 2u) && (OS_PRIORITYQUEUE_ARITY != 4u) && (OS_PRIORITYQUEUE_ARITY != 8u)
+#  error "The configured priority queue arity is not supported!"
+# endif
+
 
 /***********************************************************************************************************************
  *  GLOBAL FUNCTION MACROS
@@ -77,6 +92,8 @@ typedef uint16_least Os_PriorityQueueNodeIdx_IteratorType;
 typedef struct
 {
   P2CONST(Os_JobConfigType, AUTOMATIC, OS_APPL_DATA) Data;      /*!< A pointer to the managed data. */
+  Os_TickType Timestamp;                                        /*!< Copy of the data's expiration time stamp, so that
+                                                                 *   comparisons need no dereferencing of Data. */
 } Os_PriorityQueueNodeType;
 
 
@@ -2262,19 +2262,22 @@ Os_SchTExPoWorkAction,
 {
   Os_StatusType status;
 
-  /* #10 Activate all configured tasks. */
+  /* #10 Activate all configured tasks as one group, so that the scheduling decision is taken once. */
   {
     Os_SchTTaskIdxType taskIdx;
+    Os_TaskSetActivationType activation;
     P2CONST(Os_TaskConfigType, AUTOMATIC, OS_CONST) task;
     P2CONST(Os_SchTExPoActionTaskConfigType, AUTOMATIC, OS_CONST) actionTask = ExPo->Tasks;
 
+    Os_TaskActivateSetBegin(&activation);                                                                               /* SBSW_OS_FC_POINTER2LOCAL */
     for(taskIdx = ((Os_SchTTaskIdxType)0); taskIdx < ExPo->TaskCount; ++taskIdx)
     {
       task = actionTask[taskIdx].Task;
-      status = Os_TaskActivateTaskInternal(task);                                                                       /* SBSW_OS_SCHT_TASKACTIVATETASKINTERNAL_001 */
+      status = Os_TaskActivateSetMember(&activation, task);                                                             /* SBSW_OS_SCHT_TASKACTIVATESETMEMBER_001 */
 
       Os_ErrReportSchTExPoActivateTask(status, Os_TaskGetId(task));                                                     /* SBSW_OS_SCHT_TASKGETID_001 */
     }
+    Os_TaskActivateSetEnd(&activation);                                                                                 /* SBSW_OS_FC_POINTER2LOCAL */
   }
 
   /* #20 Set each configured event. */
@@ -3870,9 +3873,9 @@ FUNC(void, OS_CODE) Os_SchTWorkScheduleTable
  \DESCRIPTION    Os_SchTSyncSub is called with the return value of Os_SchTSyncGet.
  \COUNTERMEASURE \R [CM_OS_SCHTSYNCGET_R]
 
-\ID SBSW_OS_SCHT_TASKACTIVATETASKINTERNAL_001
- \DESCRIPTION    Os_TaskActivateTaskInternal is called with a Task pointer. The Task pointer is derived from
-                 from an index and an array of Tasks. The index is incremented in a loop. The array is derived
+\ID SBSW_OS_SCHT_TASKACTIVATESETMEMBER_001
+ \DESCRIPTION    Os_TaskActivateSetMember is called with a pointer to a local variable and with a Task pointer.
+                 The Task pointer is derived from an index and an array of Tasks. The index is incremented in a loop. The array is derived
                  from the Tasks pointer of an expiry point. The expiry point is passed as argument to the caller.
  \COUNTERMEASURE \M [CM_OS_EXPO_TASKS_M]
                  \R [CM_OS_SCHT_INDEX_R]
@@ -44,6 +44,8 @@
 # include "Os_BitArray.h"
 # include "Os_Deque.h"
 # include "Os_Task.h"
+# include "Os_Job.h"
+# include "Os_PriorityQueue.h"
 
 
 /***********************************************************************************************************************
@@ -103,6 +105,106 @@ OS_CODE, OS_ALWAYS_INLINE, Os_SchedulerPriority2Deque,
 ));
 
 
+/***********************************************************************************************************************
+ *  Os_SchedulerEdfIsBand()
+ **********************************************************************************************************************/
+/*! \brief          Returns whether the given priority is the EDF band of the given scheduler.
+ *  \details        --no details--
+ *
+ *  \param[in]      Scheduler     The scheduler to query. Parameter must not be NULL.
+ *  \param[in]      Priority      The priority to check.
+ *
+ *  \retval         !0    The priority is the EDF band.
+ *  \retval         0     The priority is not the EDF band or EDF scheduling is disabled.
+ *
+ *  \context        OS_INTERNAL
+ *
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *
+ *  \pre            -
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE Os_StdReturnType, OS_CODE, OS_ALWAYS_INLINE, Os_SchedulerEdfIsBand,
+(
+  P2CONST(Os_SchedulerConfigType, AUTOMATIC, OS_CONST) Scheduler,
+  Os_TaskPrioType Priority
+));
+
+
+/***********************************************************************************************************************
+ *  Os_SchedulerEdfPeek()
+ **********************************************************************************************************************/
+/*! \brief          Returns the ready band task with the earliest deadline, which has not yet been started.
+ *  \details        --no details--
+ *
+ *  \param[in]      Scheduler     The scheduler to query. Parameter must not be NULL.
+ *
+ *  \return         The task at the top of the EDF ready queue.
+ *  \retval         NULL_PTR      The EDF ready queue is empty.
+ *
+ *  \context        OS_INTERNAL
+ *
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *
+ *  \pre            EDF scheduling is enabled.
+ *  \pre            Concurrent access to given object is prevented by caller.
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE P2CONST(Os_TaskConfigType, AUTOMATIC, OS_CONST), OS_CODE,
+OS_ALWAYS_INLINE, Os_SchedulerEdfPeek,
+(
+  P2CONST(Os_SchedulerConfigType, AUTOMATIC, OS_CONST) Scheduler
+));
+
+
+/***********************************************************************************************************************
+ *  Os_SchedulerIsQueueEmpty()
+ **********************************************************************************************************************/
+/*! \brief          Returns whether there is no ready task on the given priority.
+ *  \details        On the EDF band, the EDF ready queue is checked in addition to the task queue.
+ *
+ *  \param[in]      Scheduler     The scheduler to query. Parameter must not be NULL.
+ *  \param[in]      Priority      The priority to check. Priority must be < Scheduler->NumberOfPriorities.
+ *
+ *  \retval         !0    There is no ready task on the given priority.
+ *  \retval         0     There is at least one ready task on the given priority.
+ *
+ *  \context        OS_INTERNAL
+ *
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *
+ *  \pre            Concurrent access to given object is prevented by caller.
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE Os_StdReturnType, OS_CODE, OS_ALWAYS_INLINE, Os_SchedulerIsQueueEmpty,
+(
+  P2CONST(Os_SchedulerConfigType, AUTOMATIC, OS_CONST) Scheduler,
+  Os_TaskPrioType Priority
+));
+
+
+/***********************************************************************************************************************
+ *  Os_SchedulerEdfDispatch()
+ **********************************************************************************************************************/
+/*! \brief          Moves the next task from the EDF ready queue to the head of the task queue of the band.
+ *  \details        This is done, if the next task is a band task, which has not yet been started. Afterwards, the
+ *                  next task is located at the head of the task queue of its home priority, as any other started task.
+ *
+ *  \param[in,out]  Scheduler     The scheduler to modify. Parameter must not be NULL.
+ *
+ *  \context        OS_INTERNAL
+ *
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *
+ *  \pre            Concurrent access to given object is prevented by caller.
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE, Os_SchedulerEdfDispatch,
+(
+  P2CONST(Os_SchedulerConfigType, AUTOMATIC, OS_CONST) Scheduler
+));
+
+
 /***********************************************************************************************************************
  *  Os_SchedulerDequeueTask()
  **********************************************************************************************************************/
@@ -248,6 +350,101 @@ OS_CODE, OS_ALWAYS_INLINE, Os_SchedulerPriority2Deque,
 }
 
 
+/***********************************************************************************************************************
+ *  Os_SchedulerEdfIsBand()
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE Os_StdReturnType, OS_CODE, OS_ALWAYS_INLINE, Os_SchedulerEdfIsBand,
+(
+  P2CONST(Os_SchedulerConfigType, AUTOMATIC, OS_CONST) Scheduler,
+  Os_TaskPrioType Priority
+))
+{
+  Os_StdReturnType result = 0u;
+
+  if(Os_SchedulerIsEdfEnabled() != 0u)                                                                                  /* PRQA S 2991, 2995 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule2.2_2995 */
+  {
+    result = (Os_StdReturnType)(Priority == Scheduler->Edf->Priority);                                                  /* PRQA S 4304 */ /* MD_Os_C90BooleanCompatibility */
+  }
+
+  return result;
+}
+
+
+/***********************************************************************************************************************
+ *  Os_SchedulerEdfPeek()
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE P2CONST(Os_TaskConfigType, AUTOMATIC, OS_CONST), OS_CODE,
+OS_ALWAYS_INLINE, Os_SchedulerEdfPeek,
+(
+  P2CONST(Os_SchedulerConfigType, AUTOMATIC, OS_CONST) Scheduler
+))
+{
+  P2CONST(Os_JobConfigType, AUTOMATIC, OS_CONST) job;
+  P2CONST(Os_TaskConfigType, AUTOMATIC, OS_CONST) task = NULL_PTR;
+
+  job = Os_PriorityQueueTopGet(&(Scheduler->Edf->ReadyQueue));                                                          /* SBSW_OS_SDR_PRIORITYQUEUE_001 */
+
+  /* #10 The jobs of the EDF ready queue are the first members of task deadlines. */
+  if(job != NULL_PTR)
+  {
+    task = ((P2CONST(Os_TaskDeadlineConfigType, AUTOMATIC, OS_CONST))job)->Task;                                        /* PRQA S 0310 */ /* MD_Os_Rule11.3_0310 */
+  }
+
+  return task;
+}
+
+
+/***********************************************************************************************************************
+ *  Os_SchedulerIsQueueEmpty()
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE Os_StdReturnType, OS_CODE, OS_ALWAYS_INLINE, Os_SchedulerIsQueueEmpty,
+(
+  P2CONST(Os_SchedulerConfigType, AUTOMATIC, OS_CONST) Scheduler,
+  Os_TaskPrioType Priority
+))
+{
+  Os_StdReturnType isEmpty;
+
+  isEmpty = Os_DequeIsEmpty(Os_SchedulerPriority2Deque(Scheduler, Priority));                                           /* SBSW_OS_SDR_DEQUEISEMPTY_001 */ /* SBSW_OS_FC_PRECONDITION */
+
+  /* #10 On the EDF band, also check the EDF ready queue. */
+  if((isEmpty != 0u) && (Os_SchedulerEdfIsBand(Scheduler, Priority) != 0u))                                             /* SBSW_OS_FC_PRECONDITION */
+  {
+    isEmpty = (Os_StdReturnType)(Os_SchedulerEdfPeek(Scheduler) == NULL_PTR);                                           /* PRQA S 4304 */ /* MD_Os_C90BooleanCompatibility */ /* SBSW_OS_FC_PRECONDITION */
+  }
+
+  return isEmpty;
+}
+
+
+/***********************************************************************************************************************
+ *  Os_SchedulerEdfDispatch()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE, Os_SchedulerEdfDispatch,
+(
+  P2CONST(Os_SchedulerConfigType, AUTOMATIC, OS_CONST) Scheduler
+))
+{
+  /* #10 If the next task is taken from the EDF band: */
+  if(Os_SchedulerEdfIsBand(Scheduler, Scheduler->Dyn->NextPriority) != 0u)                                              /* SBSW_OS_FC_PRECONDITION */
+  {
+    /* #20 If the next task has not yet been started, move it from the EDF ready queue to the task queue head. */
+    if(Os_SchedulerEdfPeek(Scheduler) == Scheduler->Dyn->NextTask)                                                      /* SBSW_OS_FC_PRECONDITION */
+    {
+      Os_PriorityQueueDeleteTop(&(Scheduler->Edf->ReadyQueue));                                                         /* SBSW_OS_SDR_PRIORITYQUEUE_001 */
+      (void)Os_DequePrepend(Os_SchedulerPriority2Deque(Scheduler, Scheduler->Dyn->NextPriority),                        /* SBSW_OS_SDR_DEQUEPREPEND_001 */ /* SBSW_OS_FC_PRECONDITION */
+                            Scheduler->Dyn->NextTask);
+    }
+  }
+}
+
+
 /***********************************************************************************************************************
  *  Os_SchedulerDequeueTask()
  **********************************************************************************************************************/
@@ -261,7 +458,7 @@ OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE, Os
   taskQueue = Os_SchedulerPriority2Deque(Scheduler, Priority);                                                          /* SBSW_OS_FC_PRECONDITION */
 
   Os_DequeDeleteTop(taskQueue);                                                                                         /* SBSW_OS_SDR_DEQUEDELETETOP_001  */
-  if(Os_DequeIsEmpty(taskQueue) != 0u)                                                                                  /* SBSW_OS_SDR_DEQUEISEMPTY_001 */
+  if(Os_SchedulerIsQueueEmpty(Scheduler, Priority) != 0u)                                                               /* SBSW_OS_FC_PRECONDITION */
   {
     Os_BitArrayClearBit(&Scheduler->BitArray, (Os_BitArrayIndexType)Priority);                                          /* SBSW_OS_FC_PRECONDITION */
   }
@@ -276,8 +473,28 @@ OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,  O
   P2CONST(Os_SchedulerConfigType, AUTOMATIC, OS_CONST) Scheduler
 ))
 {
+  P2CONST(Os_DequeConfigType, AUTOMATIC, OS_CONST) taskQueue;
+
+  /* #10 Take the head of the non-empty task queue with the highest priority. */
   Scheduler->Dyn->NextPriority = Os_BitArrayCountLeadingZeros(&Scheduler->BitArray);                                    /* SBSW_OS_SDR_SCHEDULERGETDYN_001 */ /* SBSW_OS_FC_PRECONDITION */
-  Scheduler->Dyn->NextTask = Os_DequePeek(Os_SchedulerPriority2Deque(Scheduler, Scheduler->Dyn->NextPriority));         /* SBSW_OS_SDR_SCHEDULERGETDYN_001 */ /* SBSW_OS_SDR_DEQUEPEEK_001 */ /* SBSW_OS_FC_PRECONDITION */
+  taskQueue = Os_SchedulerPriority2Deque(Scheduler, Scheduler->Dyn->NextPriority);                                      /* SBSW_OS_FC_PRECONDITION */
+  Scheduler->Dyn->NextTask = Os_DequePeek(taskQueue);                                                                   /* SBSW_OS_SDR_SCHEDULERGETDYN_001 */ /* SBSW_OS_SDR_DEQUEPEEK_001 */
+
+  /* #20 On the EDF band, take the ready band task with the earliest deadline instead, if it is due before the head. */
+  if(Os_SchedulerEdfIsBand(Scheduler, Scheduler->Dyn->NextPriority) != 0u)                                              /* SBSW_OS_FC_PRECONDITION */
+  {
+    P2CONST(Os_TaskConfigType, AUTOMATIC, OS_CONST) edfTask = Os_SchedulerEdfPeek(Scheduler);                           /* SBSW_OS_FC_PRECONDITION */
+
+    if(edfTask != NULL_PTR)
+    {
+      if((Os_DequeIsEmpty(taskQueue) != 0u)                                                                             /* SBSW_OS_SDR_DEQUEISEMPTY_001 */
+         || (Os_JobPriorityCompare(&(Os_TaskGetDeadline(edfTask)->Job),                                                 /* SBSW_OS_SDR_JOBPRIORITYCOMPARE_001 */
+                                   &(Os_TaskGetDeadline(Scheduler->Dyn->NextTask)->Job)) != 0u))
+      {
+        Scheduler->Dyn->NextTask = edfTask;                                                                             /* SBSW_OS_SDR_SCHEDULERGETDYN_001 */
+      }
+    }
+  }
 }
 
 
@@ -402,6 +619,12 @@ FUNC(void, OS_CODE) Os_SchedulerInit
     Os_DequeInit(Os_SchedulerPriority2Deque(Scheduler, priority));                                                      /* SBSW_OS_SDR_DEQUEINIT_001 */ /* SBSW_OS_FC_PRECONDITION */
   }
 
+  /* #25 Initialize the EDF ready queue. */
+  if(Os_SchedulerIsEdfEnabled() != 0u)                                                                                  /* PRQA S 2991, 2995 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule2.2_2995 */
+  {
+    Os_PriorityQueueInit(&(Scheduler->Edf->ReadyQueue));                                                                /* SBSW_OS_SDR_PRIORITYQUEUE_001 */
+  }
+
   /* #30 Set scheduler's next and current task and queue references to given task. */
   Scheduler->Dyn->NextTask = IdleTask;                                                                                  /* SBSW_OS_SDR_SCHEDULERGETDYN_001 */
   Scheduler->Dyn->NextPriority = Os_TaskGetHomePriority(IdleTask);                                                      /* SBSW_OS_SDR_SCHEDULERGETDYN_001 */ /* SBSW_OS_FC_PRECONDITION */
@@ -421,40 +644,111 @@ FUNC(void, OS_CODE) Os_SchedulerInit
  *
  *
  *
+ */
+FUNC(void, OS_CODE) Os_SchedulerInsert
+(
+  P2CONST(Os_SchedulerConfigType, AUTOMATIC, OS_CONST) Scheduler,
+  P2CONST(Os_TaskConfigType, AUTOMATIC, OS_CONST) Task
+)
+{
+  /* #10 Add the task to the task queue of its home priority. */
+  Os_SchedulerEnqueue(Scheduler, Task);                                                                                 /* SBSW_OS_FC_PRECONDITION */
+
+  /* #20 Update the next task, if the inserted task has higher priority. */
+  Os_SchedulerSelect(Scheduler, Task);                                                                                  /* SBSW_OS_FC_PRECONDITION */
+}
+
+
+/***********************************************************************************************************************
+ *  Os_SchedulerEnqueue()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
  *
  *
  *
  */
-FUNC(void, OS_CODE) Os_SchedulerInsert
+FUNC(void, OS_CODE) Os_SchedulerEnqueue
 (
   P2CONST(Os_SchedulerConfigType, AUTOMATIC, OS_CONST) Scheduler,
   P2CONST(Os_TaskConfigType, AUTOMATIC, OS_CONST) Task
 )
 {
   Os_TaskPrioType taskHomePriority;
-  Os_TaskPrioType nextTaskPriority;
-  P2CONST(Os_DequeConfigType, AUTOMATIC, OS_CONST) taskQueue;
 
   taskHomePriority = Os_TaskGetHomePriority(Task);                                                                      /* SBSW_OS_FC_PRECONDITION */
-  taskQueue = Os_SchedulerPriority2Deque(Scheduler, taskHomePriority);                                                  /* SBSW_OS_FC_PRECONDITION */
 
-  /* #10 Insert the task at the tail of this task queue. */
-  Os_DequeEnqueue(taskQueue, Task);                                                                                     /* SBSW_OS_SDR_DEQUEENQUEUE_001 */
+  /* #05 If the task belongs to the EDF band, insert it into the EDF ready queue, ordered by its deadline. */
+  if(Os_SchedulerEdfIsBand(Scheduler, taskHomePriority) != 0u)                                                          /* SBSW_OS_FC_PRECONDITION */
+  {
+    Os_PriorityQueueInsert(&(Scheduler->Edf->ReadyQueue), &(Os_TaskGetDeadline(Task)->Job));                            /* SBSW_OS_SDR_PRIORITYQUEUE_001 */ /* SBSW_OS_FC_PRECONDITION */
+  }
+  /* #10 Otherwise, insert the task at the tail of the task queue of its home priority. */
+  else
+  {
+    Os_DequeEnqueue(Os_SchedulerPriority2Deque(Scheduler, taskHomePriority), Task);                                     /* SBSW_OS_SDR_DEQUEENQUEUE_001 */ /* SBSW_OS_FC_PRECONDITION */
+  }
 
   /* #15 Initialize the round robin event counter. */
   Os_TaskInitRoundRobinCounter(Task);                                                                                   /* SBSW_OS_FC_PRECONDITION */
 
   /* #20 Remember in bit array, that task queue contains ready tasks. */
   Os_BitArraySetBit(&(Scheduler->BitArray), (Os_BitArrayIndexType)taskHomePriority);                                    /* SBSW_OS_FC_PRECONDITION */
+}
 
-  /* #30 If the inserted task has higher priority than the next task: */
+
+/***********************************************************************************************************************
+ *  Os_SchedulerSelect()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ */
+FUNC(void, OS_CODE) Os_SchedulerSelect
+(
+  P2CONST(Os_SchedulerConfigType, AUTOMATIC, OS_CONST) Scheduler,
+  P2CONST(Os_TaskConfigType, AUTOMATIC, OS_CONST) Task
+)
+{
+  P2CONST(Os_TaskConfigType, AUTOMATIC, OS_CONST) candidate;
+  Os_TaskPrioType taskHomePriority;
+  Os_TaskPrioType nextTaskPriority;
+
+  candidate = Task;
+  taskHomePriority = Os_TaskGetHomePriority(Task);                                                                      /* SBSW_OS_FC_PRECONDITION */
+
+  /* #05 If the given task belongs to the EDF band, consider the ready band task with the earliest deadline. */
+  if(Os_SchedulerEdfIsBand(Scheduler, taskHomePriority) != 0u)                                                          /* SBSW_OS_FC_PRECONDITION */
+  {
+    candidate = Os_SchedulerEdfPeek(Scheduler);                                                                         /* SBSW_OS_FC_PRECONDITION */
+    Os_Assert((Os_StdReturnType)(candidate != NULL_PTR));                                                               /* PRQA S 4304 */ /* MD_Os_C90BooleanCompatibility */
+  }
+
+  /* #10 If the given task has higher priority than the next task: */
   nextTaskPriority = Os_TaskGetPriority(Scheduler->Dyn->NextTask);                                                      /* SBSW_OS_SDR_TASKGETPRIORITY_001 */
   if(Os_SchedulerPriorityIsHigher(taskHomePriority, nextTaskPriority) != 0u)
   {
-    /* #40 Set the next task and the next priority in accordance to the inserted task. */
-    Scheduler->Dyn->NextTask = Task;                                                                                    /* SBSW_OS_SDR_SCHEDULERGETDYN_001 */
+    /* #20 Set the next task and the next priority in accordance to the given task. */
+    Scheduler->Dyn->NextTask = candidate;                                                                               /* SBSW_OS_SDR_SCHEDULERGETDYN_001 */
     Scheduler->Dyn->NextPriority = taskHomePriority;                                                                    /* SBSW_OS_SDR_SCHEDULERGETDYN_001 */
   }
+  /* #30 Otherwise, if both tasks are on the EDF band and the candidate has an earlier deadline: */
+  else if((taskHomePriority == nextTaskPriority)
+          && (Os_SchedulerEdfIsBand(Scheduler, nextTaskPriority) != 0u))                                                /* SBSW_OS_FC_PRECONDITION */
+  {
+    if(Os_JobPriorityCompare(&(Os_TaskGetDeadline(candidate)->Job),                                                     /* SBSW_OS_SDR_JOBPRIORITYCOMPARE_001 */
+                             &(Os_TaskGetDeadline(Scheduler->Dyn->NextTask)->Job)) != 0u)
+    {
+      /* #40 Let the candidate preempt the next task. */
+      Scheduler->Dyn->NextTask = candidate;                                                                             /* SBSW_OS_SDR_SCHEDULERGETDYN_001 */
+    }
+  }
+  else
+  {
+    /* The next task remains. */
+  }
 }
 
 
@@ -621,7 +915,14 @@ FUNC(void, OS_CODE) Os_SchedulerDeleteTask
   taskQueue = Os_SchedulerPriority2Deque(Scheduler, Priority);                                                          /* SBSW_OS_FC_PRECONDITION */
 
   Os_DequeDelete(taskQueue, Task);                                                                                      /* SBSW_OS_SDR_DEQUEDELETE_001 */
-  if(Os_DequeIsEmpty(taskQueue) != 0u)                                                                                  /* SBSW_OS_SDR_DEQUEISEMPTY_001 */
+
+  /* On the EDF band, the task may still wait in the EDF ready queue. */
+  if(Os_SchedulerEdfIsBand(Scheduler, Priority) != 0u)                                                                  /* SBSW_OS_FC_PRECONDITION */
+  {
+    (void)Os_PriorityQueueDelete(&(Scheduler->Edf->ReadyQueue), &(Os_TaskGetDeadline(Task)->Job));                      /* SBSW_OS_SDR_PRIORITYQUEUE_001 */ /* SBSW_OS_FC_PRECONDITION */
+  }
+
+  if(Os_SchedulerIsQueueEmpty(Scheduler, Priority) != 0u)                                                               /* SBSW_OS_FC_PRECONDITION */
   {
     Os_BitArrayClearBit(&Scheduler->BitArray, (Os_BitArrayIndexType)Priority);                                          /* SBSW_OS_FC_PRECONDITION */
   }
@@ -715,7 +1016,12 @@ FUNC(P2CONST(Os_TaskConfigType, AUTOMATIC, OS_CONST), OS_CODE) Os_SchedulerInter
   P2CONST(Os_SchedulerConfigType, AUTOMATIC, OS_CONST) Scheduler
 )
 {
-  Os_TaskPrioType runningPriority = Os_TaskGetRunningPriority(Scheduler->Dyn->NextTask);                                /* SBSW_OS_SDR_TASKGETRUNNINGPRIORITY_001 */
+  Os_TaskPrioType runningPriority;
+
+  /* #05 If the next task is a band task, which has not yet been started, move it to its task queue. */
+  Os_SchedulerEdfDispatch(Scheduler);                                                                                   /* SBSW_OS_FC_PRECONDITION */
+
+  runningPriority = Os_TaskGetRunningPriority(Scheduler->Dyn->NextTask);                                                /* SBSW_OS_SDR_TASKGETRUNNINGPRIORITY_001 */
 
   /* #10 If the next task's running priority is higher than its current priority: */
   if(Os_SchedulerPriorityIsHigher(runningPriority, Os_TaskGetPriority(Scheduler->Dyn->NextTask)) != 0u)                 /* SBSW_OS_SDR_TASKGETPRIORITY_001 */
@@ -923,6 +1229,16 @@ FUNC(Os_StdReturnType, OS_CONST) Os_SchedulerReleaseRunningPrio
  \DESCRIPTION    Os_SchedulerRobRoundInternal is called with the return value of Os_CoreGetScheduler.
  \COUNTERMEASURE \M [CM_OS_COREGETSCHEDULER_M]
 
+\ID SBSW_OS_SDR_PRIORITYQUEUE_001
+ \DESCRIPTION    A priority queue function is called with the EDF ready queue of a scheduler and the job of a task
+                 deadline. The Edf reference of the scheduler is only used, if EDF scheduling is enabled. The deadline
+                 reference of a task is only used, if the task belongs to the EDF band.
+ \COUNTERMEASURE \M [CM_OS_SCHEDULEREDF_M]
+
+\ID SBSW_OS_SDR_JOBPRIORITYCOMPARE_001
+ \DESCRIPTION    Os_JobPriorityCompare is called with the jobs of the deadlines of two tasks of the EDF band.
+ \COUNTERMEASURE \M [CM_OS_SCHEDULEREDF_M]
+
 SBSW_JUSTIFICATION_END */
 
 /*
@@ -950,6 +1266,16 @@ SBSW_JUSTIFICATION_END */
 \CM CM_SCHEDULERINTERNALSCHEDULE_T
       [CM_OS_SCHEDULER_CURRENT_T]
 
+\CM CM_OS_SCHEDULEREDF_M
+      Verify that:
+        1. the Edf reference of each scheduler is a non NULL_PTR, if OS_CFG_SCHEDULER_EDF is STD_ON,
+        2. the Priority of each Edf band is < NumberOfPriorities of its scheduler,
+        3. the Deadline reference of each task with a home priority equal to the Edf band priority of its scheduler
+           is a non NULL_PTR,
+        4. the Task reference of each task deadline refers to the task, which references the deadline,
+        5. the QueueSize of the Edf ReadyQueue is greater or equal to the number of tasks of the band and
+        6. the Counter of the Job of each task deadline is assigned to the core of the task.
+
 \CM CM_OS_SCHEDULERREMOVECURRENTTASK_R
       Idle task may not be unscheduled, so there is at least the Idle Task which is returned as NextTask.
 
@@ -95,6 +95,17 @@ Os_SchedulerIsRoundRobinEnabled,
 }
 
 
+/***********************************************************************************************************************
+ *  Os_SchedulerIsEdfEnabled()
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE Os_StdReturnType, OS_CODE, OS_ALWAYS_INLINE,
+Os_SchedulerIsEdfEnabled,
+( void ))
+{
+  return (Os_StdReturnType)(OS_CFG_SCHEDULER_EDF == STD_ON);                                                            /* PRQA S 4304, 2995 */ /* MD_Os_C90BooleanCompatibility, MD_Os_Rule2.2_2995 */
+}
+
+
 /***********************************************************************************************************************
  *  Os_SchedulerPriorityIsHigher()
  **********************************************************************************************************************/
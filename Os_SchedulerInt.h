@@ -117,11 +117,41 @@
  *    - No stack sharing (as they can be preempted by other tasks)
  *    - Same scheduling strategy for all tasks on one priority (as the queue is manipulated)
  *
+ *  ###Earliest Deadline First Scheduling
+ *
+ *  Optionally (OS_CFG_SCHEDULER_EDF), one priority level of each scheduler may be configured as EDF band. The
+ *  generator maps the OS priorities of all tasks, which are scheduled by earliest deadline first, to this single
+ *  internal priority. Above and below the band, scheduling stays fixed-priority pre-emptive. Within the band, the
+ *  ready task with the earliest absolute deadline is scheduled. A task of the band preempts the running band task, if
+ *  its deadline is earlier.
+ *
+ *  The absolute deadline of a task is set on activation (activation time + relative deadline). It is stored as
+ *  expiration time stamp of a job, so that ready tasks of the band, which have not yet been started, are kept in a
+ *  binary heap (\ref Os_PriorityQueue), ordered by deadline. Once such a task is dispatched, it is moved from the heap
+ *  to the head of the task queue of the band. Preempted band tasks therefore remain in the task queue, sorted by
+ *  deadline, and the scheduler only has to compare the head of the task queue with the top of the heap.
+ *
+ *  A band task, which terminates after its deadline, is reported to the protection hook with E_OS_PROTECTION_TIME.
+ *
+ *  ####Constraints
+ *
+ *  For EDF Band Tasks
+ *    - No multiple activations (each activation has its own deadline)
+ *    - No round robin scheduling
+ *    - No autostart (the deadline counter is not yet running during task initialization)
+ *    - All tasks of a band share one deadline counter, which belongs to the core of the scheduler
+ *    - Relative deadlines must not exceed the MaxAllowedValue of the deadline counter (a deadline miss is detected,
+ *      as long as the deadline has not passed by more than MaxAllowedValue)
+ *    - No resource, spinlock or internal resource with a ceiling priority equal to the band priority
+ *
+ *  The task queue of the band has to hold all band tasks, as each of them may be preempted by another one.
+ *
  *  \see \ref Os_BitArray
  *  \see \ref Os_Deque
  *  \see [Bit-Array](http:\\en.wikipedia.org/wiki/Bit_array)
  *  \see [Fixed-priority pre-emptive scheduling](http:\\en.wikipedia.org/wiki/Fixed-priority_pre-emptive_scheduling)
  *  \see [Round robin scheduling](https:\\en.wikipedia.org/wiki/Round-robin_scheduling)
+ *  \see [Earliest deadline first scheduling](https:\\en.wikipedia.org/wiki/Earliest_deadline_first_scheduling)
  *
  *
  *  \trace CREQ-124, CREQ-30, CREQ-86, CREQ-229342
@@ -158,6 +188,7 @@
 # include "Os_Task_Types.h"
 # include "Os_BitArrayInt.h"
 # include "Os_DequeInt.h"
+# include "Os_PriorityQueue_Types.h"
 
 /* Os HAL dependencies */
 # include "Os_Hal_CompilerInt.h"
@@ -167,6 +198,10 @@
 /***********************************************************************************************************************
  *  GLOBAL CONSTANT MACROS
  **********************************************************************************************************************/
+/*! No priority level is scheduled as EDF band, unless enabled by the configuration. */
+# ifndef OS_CFG_SCHEDULER_EDF
+#  define OS_CFG_SCHEDULER_EDF  STD_OFF
+# endif
 
 
 /***********************************************************************************************************************
@@ -192,6 +227,16 @@ struct Os_SchedulerType_Tag
   P2CONST(Os_TaskConfigType, AUTOMATIC, OS_CONST) CurrentTask;
 };
 
+/*! Configuration information of the EDF band of a scheduler. */
+typedef struct
+{
+  /*! Ready tasks of the band, which have not yet been started, ordered by their absolute deadline. */
+  Os_PriorityQueueConfigType ReadyQueue;
+
+  /*! The internal priority of the band. */
+  Os_TaskPrioType Priority;
+} Os_SchedulerEdfConfigType;
+
 /*! Configuration information of a scheduler. */
 struct Os_SchedulerConfigType_Tag
 {
@@ -206,6 +251,9 @@ struct Os_SchedulerConfigType_Tag
 
   /*! Number of task queues. */
   Os_TaskPrioType NumberOfPriorities;
+
+  /*! The EDF band of this scheduler. NULL_PTR, if earliest deadline first scheduling is disabled. */
+  P2CONST(Os_SchedulerEdfConfigType, AUTOMATIC, OS_CONST) Edf;
 };
 
 
@@ -242,6 +290,27 @@ Os_SchedulerIsRoundRobinEnabled,
 ( void ));
 
 
+/***********************************************************************************************************************
+ *  Os_SchedulerIsEdfEnabled()
+ **********************************************************************************************************************/
+/*! \brief        Returns whether earliest deadline first scheduling is enabled or not.
+ *  \details      --no details--
+ *
+ *  \retval       !0    EDF scheduling is enabled.
+ *  \retval       0     EDF scheduling is disabled.
+ *
+ *  \context      OS_INTERNAL
+ *
+ *  \reentrant    TRUE
+ *  \synchronous  TRUE
+ *
+ *  \pre          -
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE Os_StdReturnType, OS_CODE, OS_ALWAYS_INLINE,
+Os_SchedulerIsEdfEnabled,
+( void ));
+
+
 /***********************************************************************************************************************
  *  Os_SchedulerInit()
  **********************************************************************************************************************/
@@ -377,6 +446,54 @@ FUNC(void, OS_CODE) Os_SchedulerInsert
 );
 
 
+/***********************************************************************************************************************
+ *  Os_SchedulerEnqueue()
+ **********************************************************************************************************************/
+/*! \brief          Add the given task into the scheduler data structures without updating the next task.
+ *  \details        Used to insert several tasks at once. The caller has to call Os_SchedulerSelect() afterwards with
+ *                  the enqueued task of the highest home priority.
+ *
+ *  \param[in,out]  Scheduler   Reference to the scheduler configuration structure. Parameter must not be NULL.
+ *  \param[in]      Task        The task to add. Parameter must not be NULL.
+ *
+ *  \context        OS_INTERNAL
+ *
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *
+ *  \pre            Task data has already been updated.
+ *  \pre            Concurrent access to given object is prevented by caller.
+ **********************************************************************************************************************/
+FUNC(void, OS_CODE) Os_SchedulerEnqueue
+(
+  P2CONST(Os_SchedulerConfigType, AUTOMATIC, OS_CONST) Scheduler,
+  P2CONST(Os_TaskConfigType, AUTOMATIC, OS_CONST) Task
+);
+
+
+/***********************************************************************************************************************
+ *  Os_SchedulerSelect()
+ **********************************************************************************************************************/
+/*! \brief          Update the next task reference, if the given enqueued task has higher priority.
+ *  \details        Current task reference is not modified.
+ *
+ *  \param[in,out]  Scheduler   Reference to the scheduler configuration structure. Parameter must not be NULL.
+ *  \param[in]      Task        A task which has been enqueued by Os_SchedulerEnqueue(). Parameter must not be NULL.
+ *
+ *  \context        OS_INTERNAL
+ *
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *
+ *  \pre            Concurrent access to given object is prevented by caller.
+ **********************************************************************************************************************/
+FUNC(void, OS_CODE) Os_SchedulerSelect
+(
+  P2CONST(Os_SchedulerConfigType, AUTOMATIC, OS_CONST) Scheduler,
+  P2CONST(Os_TaskConfigType, AUTOMATIC, OS_CONST) Task
+);
+
+
 /***********************************************************************************************************************
  *  Os_SchedulerRobRound()
  **********************************************************************************************************************/
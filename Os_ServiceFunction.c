@@ -479,13 +479,34 @@ OS_LOCAL_INLINE FUNC(P2CONST(Os_ServiceStackConfigType, AUTOMATIC, OS_CONST), OS
 );
 
 
+/***********************************************************************************************************************
+ *  Os_ServiceStackPoolCountDenial()
+ **********************************************************************************************************************/
+/*! \brief          Counts a call which did not get a stack from the given pool.
+ *  \details        --no details--
+ *
+ *  \param[in,out]  StackPool           Stack pool which denied the stack. Parameter must not be NULL.
+ *
+ *  \context        OS_INTERNAL
+ *
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *
+ *  \pre            Concurrent access to given object is prevented by caller.
+ **********************************************************************************************************************/
+OS_LOCAL_INLINE FUNC(void, OS_CODE) Os_ServiceStackPoolCountDenial
+(
+  P2CONST(Os_ServiceStackPoolConfigType, AUTOMATIC, OS_CONST) StackPool
+);
+
+
 /***********************************************************************************************************************
  *  Os_ServiceStackPoolReleaseStack()
  **********************************************************************************************************************/
-/*! \brief          Returns a stack object from the stack pool.
+/*! \brief          Returns a stack object to the stack pool.
  *  \details        --no details--
  *
- *  \param[in,out]  StackPool     Stack pool to get the stack from. Parameter must not be NULL.
+ *  \param[in,out]  StackPool     Stack pool to return the stack to. Parameter must not be NULL.
  *  \param[in]      Stack         Stack which shall be released. Stack has to belong to the StackPool.
  *                                Parameter must not be NULL.
  *  \param[in]      Application   Application which wants to release the stack. Parameter must be < OS_APPID_COUNT.
@@ -653,19 +674,22 @@ OS_LOCAL_INLINE FUNC(void, OS_CODE) Os_ServiceStackPoolInit
   P2CONST(Os_ServiceStackPoolConfigType, AUTOMATIC, OS_CONST) StackPool
 )
 {
-  /* #10 Initialize availability map. */
-  Os_BitArrayInit(&StackPool->AvailabilityMap);                                                                         /* SBSW_OS_FC_PRECONDITION */
-
-  /* #20 Set all stacks to available. */
+  /* #10 Put all stacks onto the free stack list, so that the stack with the lowest index is taken first. */
   {
     uint8_least index;
 
     for(index = 0; index < StackPool->StackCount; index++)
     {
-      Os_BitArraySetBit(&(StackPool->AvailabilityMap), (Os_BitArrayIndexType)index);                                    /* SBSW_OS_FC_PRECONDITION */
+      StackPool->FreeStacks[index] = (uint8)((StackPool->StackCount - 1u) - index);                                     /* SBSW_OS_SF_SERVICESTACKPOOL_FREESTACKS_001 */
     }
+
+    StackPool->Dyn->FreeCount = StackPool->StackCount;                                                                  /* SBSW_OS_SF_SERVICESTACKPOOL_DYN_001 */
   }
 
+  /* #20 Reset the usage statistics. */
+  StackPool->Dyn->PeakInUse = 0u;                                                                                       /* SBSW_OS_SF_SERVICESTACKPOOL_DYN_001 */
+  StackPool->Dyn->Denials = 0u;                                                                                         /* SBSW_OS_SF_SERVICESTACKPOOL_DYN_001 */
+
   /* #30 Set access counters to configured values. */
   {
     Os_ObjIdx_IteratorType index;
@@ -903,7 +927,7 @@ OS_LOCAL_INLINE FUNC(void, OS_CODE) Os_ServicePrologue
 
   /* #70 Set memory protection settings to service's memory protection settings. */
   Os_ThreadSetMpAccessRights(CurrentThread, Service->MpAccessRights);                                                   /* SBSW_OS_SF_THREADSETMPACCESSRIGHTS_001 */
-  Os_MpSwitch(ServiceCall->PrevMpAccessRights, Service->MpAccessRights);                                                /* SBSW_OS_SF_MPSWITCH_001 */
+  Os_MpSwitch(Os_CoreAsrGetMpActive(Os_ThreadGetCore(CurrentThread)), Service->MpAccessRights);                         /* SBSW_OS_SF_MPSWITCH_001 */
 
   /* #80 Set stack monitoring stack to service's stack. */
   /* Thread->Dyn->Stack = Service->Stack <- For software based stack checks. */
@@ -934,7 +958,7 @@ OS_LOCAL_INLINE FUNC(void, OS_CODE) Os_ServiceEpilogue
 
   /* #20 Restore memory protection settings. */
   Os_ThreadSetMpAccessRights(CurrentThread, ServiceCall->PrevMpAccessRights);                                           /* SBSW_OS_SF_THREADSETMPACCESSRIGHTS_002 */
-  Os_MpSwitch(ServiceCall->Service->MpAccessRights, ServiceCall->PrevMpAccessRights);                                   /* SBSW_OS_SF_MPSWITCH_002 */
+  Os_MpSwitch(Os_CoreAsrGetMpActive(Os_ThreadGetCore(CurrentThread)), ServiceCall->PrevMpAccessRights);                 /* SBSW_OS_SF_MPSWITCH_002 */
 
   /*! \note Restore current stack. */
   /* Thread->Dyn->Stack = ServiceCall->PrevStack <- For software based stack checks. */
@@ -957,7 +981,6 @@ OS_LOCAL_INLINE FUNC(void, OS_CODE) Os_ServiceEpilogue
  *
  *
  *
- *
  */
 OS_LOCAL_INLINE FUNC(P2CONST( Os_ServiceStackConfigType, AUTOMATIC, OS_CONST), OS_CODE) Os_ServiceStackPoolGetStack
 (
@@ -966,31 +989,36 @@ OS_LOCAL_INLINE FUNC(P2CONST( Os_ServiceStackConfigType, AUTOMATIC, OS_CONST), O
 )
 {
   P2CONST( Os_ServiceStackConfigType, AUTOMATIC, OS_CONST) stack;
-  Os_BitArrayIndexType index;
+  P2VAR(Os_ServiceStackPoolType, AUTOMATIC, OS_VAR_NOINIT) dyn = StackPool->Dyn;
 
-  /* #10 Check whether the current application is allowed to get a stack from the given pool. */
+  /* #10 Check whether the pool belongs to the current core and the current application is valid. */
+  Os_Assert((Os_StdReturnType)(Os_Core2AsrCore(Os_CoreGetCurrentCore()) == StackPool->Core));                           /* PRQA S 4304 */ /* MD_Os_C90BooleanCompatibility */ /* SBSW_OS_SF_CORE2ASRCORE_001 */
   Os_Assert(Os_ErrIsValueLo((uint32)CurrentApplication, (uint32)OS_APPID_COUNT));
 
-  /* #20 Find first free stack. */
-  index = Os_BitArrayCountLeadingZeros(&StackPool->AvailabilityMap);                                                    /* SBSW_OS_FC_PRECONDITION */
-
-  /* #30 If there is no empty stack left:*/
-  if(OS_UNLIKELY(index >= StackPool->StackCount))
+  /* #20 If there is no empty stack left:*/
+  if(OS_UNLIKELY(dyn->FreeCount == 0u))
   {
-    /* #40 Return NULL pointer.*/
+    /* #30 Return NULL pointer.*/
     stack = NULL_PTR;
   }
-  /* #50 Otherwise: */
+  /* #40 Otherwise: */
   else
   {
-    /* #60 Mark the stack as occupied. */
-    Os_BitArrayClearBit(&StackPool->AvailabilityMap, index);                                                            /* SBSW_OS_FC_PRECONDITION */
+    uint8 inUse;
 
-    /* #70 Decrement access counter of current application. */
-    StackPool->Dyn->AccessCounter[CurrentApplication]--;                                                                /* PRQA S 2842 */ /* MD_Os_Rule18.1_2842 */ /* SBSW_OS_SF_ACCESSCOUNTER_001 */
+    /* #50 Pop the most recently released stack from the free stack list. */
+    dyn->FreeCount--;                                                                                                   /* SBSW_OS_SF_SERVICESTACKPOOL_DYN_001 */
+    stack = &(StackPool->Stacks[StackPool->FreeStacks[dyn->FreeCount]]);
 
-    /* #80 Return pointer to stack object. */
-    stack = &(StackPool->Stacks[index]);
+    /* #60 Decrement access counter of current application. */
+    dyn->AccessCounter[CurrentApplication]--;                                                                           /* PRQA S 2842 */ /* MD_Os_Rule18.1_2842 */ /* SBSW_OS_SF_ACCESSCOUNTER_001 */
+
+    /* #70 Update the peak usage of the pool. */
+    inUse = (uint8)(StackPool->StackCount - dyn->FreeCount);
+    if(inUse > dyn->PeakInUse)
+    {
+      dyn->PeakInUse = inUse;                                                                                           /* SBSW_OS_SF_SERVICESTACKPOOL_DYN_001 */
+    }
   }
 
   return stack;
@@ -1013,14 +1041,30 @@ OS_LOCAL_INLINE FUNC(void, OS_CODE) Os_ServiceStackPoolReleaseStack
   ApplicationType Application
 )
 {
-  /* #10 Mark stack as free. */
-  Os_BitArraySetBit(&(StackPool->AvailabilityMap), Stack->PoolIndex);                                                   /* SBSW_OS_FC_PRECONDITION */
+  /* #10 Check that the pool belongs to the current core. */
+  Os_Assert((Os_StdReturnType)(Os_Core2AsrCore(Os_CoreGetCurrentCore()) == StackPool->Core));                           /* PRQA S 4304 */ /* MD_Os_C90BooleanCompatibility */ /* SBSW_OS_SF_CORE2ASRCORE_001 */
 
-  /* #20 Increment access counter of the given application. */
+  /* #20 Push the stack onto the free stack list. */
+  StackPool->FreeStacks[StackPool->Dyn->FreeCount] = Stack->PoolIndex;                                                  /* SBSW_OS_SF_SERVICESTACKPOOL_FREESTACKS_002 */
+  StackPool->Dyn->FreeCount++;                                                                                          /* SBSW_OS_SF_SERVICESTACKPOOL_DYN_001 */
+
+  /* #30 Increment access counter of the given application. */
   StackPool->Dyn->AccessCounter[Application]++;                                                                         /* PRQA S 2842 */ /* MD_Os_Rule18.1_2842 */ /* SBSW_OS_SF_ACCESSCOUNTER_001 */
 }
 
 
+/***********************************************************************************************************************
+ *  Os_ServiceStackPoolCountDenial()
+ **********************************************************************************************************************/
+OS_LOCAL_INLINE FUNC(void, OS_CODE) Os_ServiceStackPoolCountDenial
+(
+  P2CONST(Os_ServiceStackPoolConfigType, AUTOMATIC, OS_CONST) StackPool
+)
+{
+  StackPool->Dyn->Denials++;                                                                                            /* SBSW_OS_SF_SERVICESTACKPOOL_DYN_001 */
+}
+
+
 /***********************************************************************************************************************
  *  Os_ServiceTfCall()
  **********************************************************************************************************************/
@@ -1187,6 +1231,7 @@ OS_LOCAL_INLINE FUNC(Os_StatusType, OS_CODE) Os_ServiceNtfCall
   else if(OS_UNLIKELY(Os_ServiceStackPoolCheckIsAllowedToGet(NonTrustedFunction->StackPool, currentApplication)         /* SBSW_OS_SF_SERVICESTACKPOOLCHECKISALLOWEDTOGET_001 */
                                                       == OS_CHECK_FAILED))
   {
+    Os_ServiceStackPoolCountDenial(NonTrustedFunction->StackPool);                                                      /* SBSW_OS_SF_SERVICESTACKPOOLCOUNTDENIAL_001 */
     status = OS_STATUS_NO_NTFSTACK_APPLIMIT_EXCEEDED;
   }
   else
@@ -1196,6 +1241,7 @@ OS_LOCAL_INLINE FUNC(Os_StatusType, OS_CODE) Os_ServiceNtfCall
 
     if(OS_UNLIKELY(ntfCall.Stack == NULL_PTR))
     {
+      Os_ServiceStackPoolCountDenial(NonTrustedFunction->StackPool);                                                    /* SBSW_OS_SF_SERVICESTACKPOOLCOUNTDENIAL_001 */
       status = OS_STATUS_NO_NTFSTACK_POOL_EMPTY;
     }
     /* #50 If there was a stack available: */
@@ -1622,6 +1668,68 @@ FUNC(Os_StatusType, OS_CODE) Os_Api_CallNonTrustedFunction
 }                                                                                                                       /* PRQA S 6050 */ /* MD_MSR_STCAL */
 
 
+/***********************************************************************************************************************
+ *  Os_Api_GetNtfStackPoolStatistics()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ */
+FUNC(Os_StatusType, OS_CODE) Os_Api_GetNtfStackPoolStatistics
+(
+  Os_NonTrustedFunctionIndexType FunctionIndex,
+  Os_NtfStackPoolStatisticsRefType Statistics
+)
+{
+  Os_StatusType status;
+
+  /* #10 Perform error checks. */
+  if(Os_ServiceNtfIsEnabled() == 0u)                                                                                    /* PRQA S 2992, 2996 */ /* MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2996 */
+  {
+    status = Os_ErrSetOkInStdStatus(OS_STATUS_SERVICEID);
+  }
+  else if(OS_UNLIKELY(Os_ServiceCheckNtfId(FunctionIndex) == OS_CHECK_FAILED))
+  {
+    status = OS_STATUS_SERVICEID;
+  }
+  else
+  {
+    P2CONST(Os_ServiceStackPoolConfigType, AUTOMATIC, OS_CONST) stackPool;
+    P2CONST(Os_ServiceNtfConfigType, AUTOMATIC, OS_CONST) nonTrustedFunction;
+    P2CONST(Os_CoreAsrConfigType, AUTOMATIC, OS_CONST) ownerCore;
+
+    nonTrustedFunction = Os_ServiceNtfId2Ntf(FunctionIndex);
+    ownerCore = Os_AppGetCore(nonTrustedFunction->Base.OwnerApplication);                                               /* SBSW_OS_SF_APPGETCORE_001 */
+
+    if(OS_UNLIKELY(Os_CoreAsrCheckIsCoreLocal(ownerCore) == OS_CHECK_FAILED))                                           /* SBSW_OS_SF_COREASRCHECKISCORELOCAL_001 */ /* COV_OS_HALPLATFORMMULTICOREUNSUPPORTED */ /* PRQA S 2992, 2996 */ /* MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2996 */
+    {
+      status = OS_STATUS_ACCESSRIGHTS_1;
+    }
+    else
+    {
+      Os_IntStateType interruptState;
+
+      stackPool = nonTrustedFunction->StackPool;
+
+      /* #20 Copy the statistics consistently with respect to local NTF calls. */
+      Os_IntSuspend(&interruptState);                                                                                   /* SBSW_OS_FC_POINTER2LOCAL */
+      Statistics->StackCount = stackPool->StackCount;                                                                   /* SBSW_OS_PWA_PRECONDITION */
+      Statistics->InUse = (uint8)(stackPool->StackCount - stackPool->Dyn->FreeCount);                                   /* SBSW_OS_PWA_PRECONDITION */
+      Statistics->PeakInUse = stackPool->Dyn->PeakInUse;                                                                /* SBSW_OS_PWA_PRECONDITION */
+      Statistics->Denials = stackPool->Dyn->Denials;                                                                    /* SBSW_OS_PWA_PRECONDITION */
+      Os_IntResume(&interruptState);                                                                                    /* SBSW_OS_FC_POINTER2LOCAL */
+
+      status = OS_STATUS_OK;
+    }
+  }
+
+  return status;
+}                                                                                                                       /* PRQA S 6050 */ /* MD_MSR_STCAL */
+
+
 /***********************************************************************************************************************
  *  Os_Api_CallFastTrustedFunction()
  **********************************************************************************************************************/
@@ -1709,19 +1817,22 @@ FUNC(Os_StatusType, OS_CODE) Os_Api_CallFastTrustedFunction
  \COUNTERMEASURE \M [CM_OS_SF_OWNERAPPLICATION_M]
 
 \ID SBSW_OS_SF_MPSWITCH_001
- \DESCRIPTION    Os_MpSwitch is called with a MpAccessRights object and a PrevMpAccessRights object.
-                 The MpAccessRights object is derived from a Service object. The PrevMpAccessRights is initialized with
-                 the return value of Os_ThreadGetMpAccessRights. The PrevMpAccessRights object is derived
-                 from a ServiceCall object. Service and ServiceCall are passed as argument to the caller.
-                 The correctness of the caller arguments is ensured by precondition. The compliance of the precondition
-                 is check during review.
+ \DESCRIPTION    Os_MpSwitch is called with the active access rights of the core of CurrentThread and a
+                 MpAccessRights object. The MpAccessRights object is derived from a Service object. The active access
+                 rights are returned by Os_CoreAsrGetMpActive for the core returned by Os_ThreadGetCore. Service and
+                 CurrentThread are passed as argument to the caller. The correctness of the caller arguments is
+                 ensured by precondition. The compliance of the precondition is check during review.
  \COUNTERMEASURE \M [CM_OS_SF_MPACCESSRIGHTS_M]
+                 \M [CM_OS_THREADGETCORE_M]
 
 \ID SBSW_OS_SF_MPSWITCH_002
- \DESCRIPTION    Os_MpSwitch is called with values derived from a ServiceCall object. This object hierarchy is
-                 initialized in Os_ServicePrologue. Preconditions ensures, that Os_ServicePrologue is called before.
-                 The compliance of the precondition is check during review.
+ \DESCRIPTION    Os_MpSwitch is called with the active access rights of the core of CurrentThread and a value
+                 derived from a ServiceCall object. This object hierarchy is initialized in Os_ServicePrologue.
+                 Preconditions ensures, that Os_ServicePrologue is called before. The active access rights are
+                 returned by Os_CoreAsrGetMpActive for the core returned by Os_ThreadGetCore. The compliance of the
+                 precondition is check during review.
  \COUNTERMEASURE \N [CM_OS_PRECONDITION_N]
+                 \M [CM_OS_THREADGETCORE_M]
 
 \ID SBSW_OS_SF_THREADSETSERVICECALLS_001
  \DESCRIPTION    Os_ThreadSetServiceCalls is called with a CurrentThread and a PrevServiceCalls object. The
@@ -1830,6 +1941,31 @@ FUNC(Os_StatusType, OS_CODE) Os_Api_CallFastTrustedFunction
                  The compliance of the precondition is check during review.
  \COUNTERMEASURE \M [CM_OS_SERVICESTACKPOOL_M]
 
+\ID SBSW_OS_SF_SERVICESTACKPOOLCOUNTDENIAL_001
+ \DESCRIPTION    Os_ServiceStackPoolCountDenial is called with a StackPool. StackPool is derived from an argument of
+                 the caller function. The correctness of the caller argument is ensured by precondition. The
+                 compliance of the precondition is check during review.
+ \COUNTERMEASURE \M [CM_OS_SERVICESTACKPOOL_M]
+
+\ID SBSW_OS_SF_SERVICESTACKPOOL_DYN_001
+ \DESCRIPTION    Write access to the Dyn object of a StackPool. StackPool is passed as argument to the caller. The
+                 correctness of the caller argument is ensured by precondition. The compliance of the precondition is
+                 check during review.
+ \COUNTERMEASURE \M [CM_OS_SF_STACKPOOL_DYN_M]
+
+\ID SBSW_OS_SF_SERVICESTACKPOOL_FREESTACKS_001
+ \DESCRIPTION    Write access to the FreeStacks array of a StackPool. StackPool is passed as argument to the caller.
+                 The correctness of the caller argument is ensured by precondition. The compliance of the precondition
+                 is check during review. The index is lower than StackCount.
+ \COUNTERMEASURE \M [CM_OS_SF_STACKPOOL_FREESTACKS_M]
+
+\ID SBSW_OS_SF_SERVICESTACKPOOL_FREESTACKS_002
+ \DESCRIPTION    Write access to the FreeStacks array of a StackPool with the index FreeCount. StackPool is passed as
+                 argument to the caller. The correctness of the caller argument is ensured by precondition. The
+                 compliance of the precondition is check during review.
+ \COUNTERMEASURE \M [CM_OS_SF_STACKPOOL_FREESTACKS_M]
+                 \R [CM_OS_SF_STACKPOOL_FREECOUNT_R]
+
 \ID SBSW_OS_SF_APPGETID_001
  \DESCRIPTION    Os_AppGetId is called with the return value of Os_ThreadGetCurrentApplication.
  \COUNTERMEASURE \N [CM_OS_THREADGETCURRENTAPPLICATION_N]
@@ -1853,6 +1989,10 @@ FUNC(Os_StatusType, OS_CODE) Os_Api_CallFastTrustedFunction
  \DESCRIPTION    Os_ThreadGetCore is called with the return value of Os_CoreGetThread.
  \COUNTERMEASURE \N [CM_OS_COREGETTHREAD_N]
 
+\ID SBSW_OS_SF_CORE2ASRCORE_001
+ \DESCRIPTION    Os_Core2AsrCore is called with the return value of Os_CoreGetCurrentCore.
+ \COUNTERMEASURE \S [CM_OS_COREGETCURRENTCORE_S]
+
 \ID SBSW_OS_SF_SERVICETFCALL_001
  \DESCRIPTION    Os_ServiceTfCall is called with the return value of Os_ServiceTfId2Tf and an argument passed to the
                  caller. The correctness of the caller argument is ensured by precondition. The compliance of the
@@ -2020,6 +2160,14 @@ SBSW_JUSTIFICATION_END */
 \CM CM_OS_SF_STACKPOOL_DYN_M
       Verify that the Dyn pointer of each StackPoolConfigType object is a non NULL_PTR.
 
+\CM CM_OS_SF_STACKPOOL_FREESTACKS_M
+      Verify that the FreeStacks pointer of each StackPoolConfigType object is a non NULL_PTR and refers to an
+      array with a size equal to StackCount.
+
+\CM CM_OS_SF_STACKPOOL_FREECOUNT_R
+      A stack is only released, if it has been taken from the same pool before. So FreeCount is lower than
+      StackCount, when a stack is released.
+
 \CM CM_OS_SF_INDEX_R
       Caller ensures by implementation that the used index is valid.
 
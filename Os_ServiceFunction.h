@@ -42,7 +42,6 @@
 
 /* Os kernel module dependencies */
 # include "Os_Lcfg.h"
-# include "Os_BitArray.h"
 # include "Os_Application.h"
 # include "Os_Error.h"
 # include "Os_MemoryProtection.h"
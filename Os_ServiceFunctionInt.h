@@ -76,9 +76,9 @@
 
 /* Os kernel module dependencies */
 # include "Os_Application_Types.h"
+# include "Os_Core_Types.h"
 # include "Os_MemoryProtection_Types.h"
 # include "Os_Stack_Types.h"
-# include "Os_BitArrayInt.h"
 # include "Os_Lcfg.h"
 # include "OsInt.h"
 
@@ -286,11 +286,22 @@ struct  Os_ServiceStackConfigType_Tag
 };
 
 
-/*! Dynamic data of a stack pool. */
+/*! Dynamic data of a stack pool.
+ *  A pool is only used by the core which owns its non-trusted functions, so no further synchronization than
+ *  suspending the local interrupts is needed. Getting and releasing stacks assert that they run on this core. */
 struct Os_ServiceStackPoolType_Tag
 {
-  /*! Access counter per application. */
+  /*! Remaining number of stacks each application may get from this pool. */
   uint8 AccessCounter[OS_APPID_COUNT];
+
+  /*! Number of valid entries in the free stack list. The top of the list is at FreeCount - 1. */
+  uint8 FreeCount;
+
+  /*! Highest number of stacks which have been in use at the same time. */
+  uint8 PeakInUse;
+
+  /*! Number of calls which did not get a stack, either due to the application limit or an empty pool. */
+  uint32 Denials;
 };
 
 
@@ -300,13 +311,16 @@ struct Os_ServiceStackPoolConfigType_Tag
   /*! Dynamic data of the stack pool. */
   P2VAR(Os_ServiceStackPoolType, TYPEDEF, OS_VAR_NOINIT) Dyn;
 
-  /*! References to free stacks. */
-  Os_BitArrayConfigType AvailabilityMap;
+  /*! Free stack list (LIFO) holding the pool indices of all free stacks. Array size is StackCount. */
+  P2VAR(uint8, TYPEDEF, OS_VAR_NOINIT) FreeStacks;
 
   /*! Pointer to stacks. */
   P2CONST(Os_ServiceStackConfigType, TYPEDEF, OS_CONST) Stacks;
 
-  /*! Pointer to stacks. */
+  /*! The core which owns the non-trusted functions of this pool. */
+  P2CONST(Os_CoreAsrConfigType, TYPEDEF, OS_CONST) Core;
+
+  /*! Number of stacks in this pool. */
   uint8 StackCount;
 
   /*! Configured access counter per application. */
@@ -677,6 +691,33 @@ FUNC(Os_StatusType, OS_CODE) Os_Api_CallNonTrustedFunction
 );
 
 
+/***********************************************************************************************************************
+ *  Os_Api_GetNtfStackPoolStatistics()
+ **********************************************************************************************************************/
+/*! \brief        OS service Os_GetNtfStackPoolStatistics().
+ *  \details      For further details see Os_GetNtfStackPoolStatistics().
+ *
+ *  \param[in]    FunctionIndex   See Os_GetNtfStackPoolStatistics().
+ *  \param[out]   Statistics      See Os_GetNtfStackPoolStatistics(). Parameter must not be NULL.
+ *
+ *  \retval       OS_STATUS_OK              No error.
+ *  \retval       OS_STATUS_SERVICEID       No function defined for this index.
+ *  \retval       OS_STATUS_ACCESSRIGHTS_1  (EXTENDED status:) The given object belongs to a foreign core.
+ *
+ *  \context      TASK|ISR2
+ *
+ *  \reentrant    TRUE
+ *  \synchronous  TRUE
+ *
+ *  \pre          See Os_GetNtfStackPoolStatistics().
+ **********************************************************************************************************************/
+FUNC(Os_StatusType, OS_CODE) Os_Api_GetNtfStackPoolStatistics
+(
+  Os_NonTrustedFunctionIndexType FunctionIndex,
+  Os_NtfStackPoolStatisticsRefType Statistics
+);
+
+
 /***********************************************************************************************************************
  *  Os_Api_CallFastTrustedFunction()
  **********************************************************************************************************************/
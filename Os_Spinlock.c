@@ -628,26 +628,65 @@ Os_SpinlockTraceOwnerGet,
   P2CONST(Os_SpinlockConfigType, AUTOMATIC, OS_CONST) Spinlock
 ))
 {
-  P2CONST(Os_SpinlockType, AUTOMATIC, OS_VAR_NOINIT) spinlockDyn;
+  P2VAR(Os_SpinlockType, AUTOMATIC, OS_VAR_NOINIT) spinlockDyn;
+  Os_Hal_TimerFrtTickType requestTime;
+  Os_StdReturnType contended;
 
   spinlockDyn = Os_SpinlockGetDyn(Spinlock);                                                                            /* SBSW_OS_FC_PRECONDITION */
 
-  /* #10 Inform the trace module. */
+  /* #10 Inform the trace module and take the time of the request. */
   Os_TraceSpinlockRequested(Spinlock->TimingHookTrace);                                                                 /* SBSW_OS_SL_TRACESPINLOCKREQUESTED_001 */
+  requestTime = Os_SpinlockStatisticsGetTime(Spinlock);                                                                 /* SBSW_OS_FC_PRECONDITION */
+
+  /* #20 If the spinlock uses a queue based algorithm: */
+  if(Spinlock->Algorithm != OS_SPINLOCKALGORITHM_TAS)
+  {
+    Os_IntStateType interruptState;
 
-  /* #20 Loop: */
-  do
+    /* #30 Suspend timing protection interrupts, so that the waiter is not killed while it is enqueued. */
+    Os_IntSuspend(&interruptState);                                                                                     /* SBSW_OS_FC_POINTER2LOCAL */
+
+    /* #40 Wait for the grant. */
+    contended = Os_SpinlockAlgorithmLock(Spinlock);                                                                     /* SBSW_OS_FC_PRECONDITION */
+
+    /* #50 Inform the trace module, set the lock owner and add the lock to the list of locks. */
+    Os_TraceSpinlockTaken(Spinlock->TimingHookTrace);                                                                   /* SBSW_OS_SL_TRACESPINLOCKTAKEN_001 */
+    spinlockDyn->OwnerThread = Os_CoreGetThread();                                                                      /* SBSW_OS_SL_SPINLOCKGETDYN_001 */
+    Os_SpinlockListPush(Spinlock);                                                                                      /* SBSW_OS_FC_PRECONDITION */
+
+    /* #60 Resume interrupts. */
+    Os_IntResume(&interruptState);                                                                                      /* SBSW_OS_FC_POINTER2LOCAL */
+  }
+  else
   {
-    /* #30 Spin while the spinlock is locked. */
-    while(Os_Hal_SpinIsLocked(&(spinlockDyn->Spinlock)) != 0u)                                                          /* PRQA S 2994, 2996 */ /* MD_Os_Rule14.3_2994, MD_Os_Rule2.2_2996 */ /* SBSW_OS_SL_HAL_SPINISLOCKED_001 */
+    Os_Hal_SpinlockResultType result;
+
+    contended = 0u;
+
+    /* #70 Otherwise loop: */
+    do
     {
-      Os_Hal_CoreNop();
-    }
+      /* #80 Spin while the spinlock is locked. */
+      while(Os_Hal_SpinIsLocked(&(spinlockDyn->Spinlock)) != 0u)                                                        /* PRQA S 2994, 2996 */ /* MD_Os_Rule14.3_2994, MD_Os_Rule2.2_2996 */ /* SBSW_OS_SL_HAL_SPINISLOCKED_001 */
+      {
+        Os_Hal_CoreNop();
+        contended = !0u;                                                                                                /* PRQA S 4404, 4558 */ /* MD_Os_C90BooleanCompatibility, MD_Os_Rule10.1_4558 */
+      }
 
-    /* #40 Try to get the lock atomic. */
-    /* #50 Loop until the current thread becomes the owner. */
-  } while(Os_SpinlockTraceOwnerTryGet(Spinlock) != OS_HAL_SPINLOCKSUCCEEDED);                                           /* PRQA S 2993, 2996 */ /* MD_Os_Rule14.3_2993, MD_Os_Rule2.2_2996 */ /* SBSW_OS_FC_PRECONDITION */ /* COV_OS_HALPLATFORMGETSPINLOCK */
-}
+      /* #90 Try to get the lock atomic. */
+      result = Os_SpinlockTraceOwnerTryGet(Spinlock);                                                                   /* SBSW_OS_FC_PRECONDITION */
+      if(result != OS_HAL_SPINLOCKSUCCEEDED)                                                                            /* PRQA S 2991, 2995 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule2.2_2995 */ /* COV_OS_HALPLATFORMGETSPINLOCK */
+      {
+        contended = !0u;                                                                                                /* PRQA S 4404, 4558 */ /* MD_Os_C90BooleanCompatibility, MD_Os_Rule10.1_4558 */
+      }
+
+      /* #100 Loop until the current thread becomes the owner. */
+    } while(result != OS_HAL_SPINLOCKSUCCEEDED);                                                                        /* PRQA S 2993, 2996 */ /* MD_Os_Rule14.3_2993, MD_Os_Rule2.2_2996 */ /* COV_OS_HALPLATFORMGETSPINLOCK */
+  }
+
+  /* #110 Record the grant in the statistics. */
+  Os_SpinlockStatisticsTaken(Spinlock, requestTime, contended);                                                         /* SBSW_OS_FC_PRECONDITION */
+}                                                                                                                       /* PRQA S 6050 */ /* MD_MSR_STCAL */
 
 
 /***********************************************************************************************************************
@@ -677,6 +716,9 @@ Os_SpinlockTraceOwnerRelease,
   /* #10 Suspend timing protection interrupts. */
   Os_IntSuspend(&interruptState);                                                                                       /* SBSW_OS_FC_POINTER2LOCAL */
 
+  /* #15 Record the hold time, while the spinlock is still held. */
+  Os_SpinlockStatisticsReleased(Spinlock);                                                                              /* SBSW_OS_FC_PRECONDITION */
+
   /* #20 Remove the lock from the list of locks. */
   Os_SpinlockListPop();                                                                                                 /* PRQA S 2987 */ /* MD_Os_Rule2.2_2987_Global */
 
@@ -687,7 +729,7 @@ Os_SpinlockTraceOwnerRelease,
   Os_TraceSpinlockReleased(Spinlock->TimingHookTrace);                                                                  /* SBSW_OS_SL_TRACESPINLOCKRELEASED_001 */
 
   /* #50 Release the lock. */
-  Os_Hal_SpinUnlock(&(spinlockDyn->Spinlock));                                                                          /* SBSW_OS_SL_HAL_SPINUNLOCKED_001 */
+  Os_SpinlockAlgorithmUnlock(Spinlock);                                                                                 /* SBSW_OS_FC_PRECONDITION */
 
   /* #60 Resume interrupts. */
   Os_IntResume(&interruptState);                                                                                        /* SBSW_OS_FC_POINTER2LOCAL */
@@ -724,7 +766,7 @@ Os_SpinlockTraceOwnerTryGet,
   Os_IntSuspend(&interruptState);                                                                                       /* SBSW_OS_FC_POINTER2LOCAL */
 
   /* #20 Try to get the lock. */
-  result = Os_Hal_SpinTryLock(&(spinlockDyn->Spinlock));                                                                /* SBSW_OS_SL_HAL_SPINTRYLOCK_001 */
+  result = Os_SpinlockAlgorithmTryLock(Spinlock);                                                                       /* SBSW_OS_FC_PRECONDITION */
 
   /* #30 On success: */
   if(result == OS_HAL_SPINLOCKSUCCEEDED)                                                                                /* PRQA S 2991, 2995 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule2.2_2995 */
@@ -1018,7 +1060,7 @@ FUNC(void, OS_CODE) Os_SpinlockForciblyReleaseThreadLocks
 
           Os_LockListDelete(locks, &(spinlock->Lock));                                                                  /* SBSW_OS_SL_LOCKLISTDELETE_001 */
 
-          Os_Hal_SpinUnlock(&(spinlockDyn->Spinlock));                                                                  /* SBSW_OS_SL_HAL_SPINUNLOCKED_001 */
+          Os_SpinlockAlgorithmUnlock(spinlock);                                                                         /* SBSW_OS_SL_SPINLOCKALGORITHMUNLOCK_001 */
         }
       }
     }
@@ -1282,9 +1324,11 @@ FUNC(Os_StatusType, OS_CODE) Os_SpinlockTryGet
   {
     Os_StdReturnType result;
     Os_TaskPrioType previousPriority;
+    Os_Hal_TimerFrtTickType requestTime;
 
     /* #20 Lock the configured interrupt/task level. */
     previousPriority = Os_SpinlockSuspendByMethod(Spinlock);                                                            /* SBSW_OS_FC_PRECONDITION */
+    requestTime = Os_SpinlockStatisticsGetTime(Spinlock);                                                               /* SBSW_OS_FC_PRECONDITION */
 
     /* #30 If the spinlock owner is traced: */
     /* Enhance performance of spinlocks without tracing by using OS_UNLIKELY. */
@@ -1304,8 +1348,9 @@ FUNC(Os_StatusType, OS_CODE) Os_SpinlockTryGet
     /* #70 If get lock succeeded: */
     if(OS_LIKELY(result == OS_HAL_SPINLOCKSUCCEEDED))                                                                   /* PRQA S 2991, 2995 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule2.2_2995 */ /* COV_OS_HALPLATFORMMULTICOREUNSUPPORTED */
     {
-      /* #80 Save task priority. */
+      /* #80 Save task priority and record the uncontended grant in the statistics. */
       Os_SpinlockGetDyn(Spinlock)->PreviousPriority = previousPriority;                                                 /* SBSW_OS_SL_SPINLOCKGETDYN_001 */ /* SBSW_OS_FC_PRECONDITION */
+      Os_SpinlockStatisticsTaken(Spinlock, requestTime, 0u);                                                            /* SBSW_OS_FC_PRECONDITION */
       *Success = TRYTOGETSPINLOCK_SUCCESS;                                                                              /* SBSW_OS_PWA_PRECONDITION */
     }
     /* #90 Otherwise: */
@@ -1463,10 +1508,14 @@ FUNC(Os_StatusType, OS_CODE) Os_Api_TryToGetSpinlock
     if(OS_LIKELY(spinlock->Mode == OS_SPINLOCKMODE_USER))                                                               /* COV_OS_HALPLATFORMMULTICOREUNSUPPORTED */
     {
       Os_StdReturnType result;
+      Os_Hal_TimerFrtTickType requestTime;
+
+      requestTime = Os_SpinlockStatisticsGetTime(spinlock);                                                             /* SBSW_OS_SL_SPINLOCKSTATISTICS_001 */
       result = Os_SpinlockInternalTryGet(spinlock);                                                                     /* SBSW_OS_SL_SPINLOCKINTERNALTRYGET_001 */
 
       if(result == OS_HAL_SPINLOCKSUCCEEDED)                                                                            /* PRQA S 2991, 2995 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule2.2_2995 */ /* COV_OS_HALPLATFORMMULTICOREUNSUPPORTED */
       {
+        Os_SpinlockStatisticsTaken(spinlock, requestTime, 0u);                                                          /* SBSW_OS_SL_SPINLOCKSTATISTICS_001 */
         *Success = TRYTOGETSPINLOCK_SUCCESS;                                                                            /* SBSW_OS_PWA_PRECONDITION */
       }
       else
@@ -1487,6 +1536,71 @@ FUNC(Os_StatusType, OS_CODE) Os_Api_TryToGetSpinlock
 }
 
 
+/***********************************************************************************************************************
+ *  Os_Api_GetSpinlockStatistics()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ *
+ *
+ */
+FUNC(Os_StatusType, OS_CODE) Os_Api_GetSpinlockStatistics
+(
+  SpinlockIdType SpinlockId,
+  CoreIdType CoreId,
+  Os_SpinlockStatisticsRefType Statistics
+)
+{
+  Os_StatusType status;
+
+  /* #10 Perform error checks. */
+  if(Os_SpinlockStatisticsIsEnabled() == 0u)                                                                            /* PRQA S 2992, 2996 */ /* MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2996 */
+  {
+    status = OS_STATUS_SPINLOCKSTATISTICS_DISABLED_BY_CONFIG;
+  }
+  else if(Os_SpinlockIsEnabled() == 0u)                                                                                 /* PRQA S 2992, 2996 */ /* MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2996 */
+  {
+    status = Os_ErrSetOkInStdStatus(OS_STATUS_ID_1);                                                                    /* PRQA S 2880 */ /* MD_Os_Rule2.1_2880 */
+  }
+  else if(OS_UNLIKELY(Os_SpinlockCheckId(SpinlockId) == OS_CHECK_FAILED))
+  {
+    status = OS_STATUS_ID_1;
+  }
+  else if(OS_UNLIKELY(Os_CoreCheckId(CoreId) == OS_CHECK_FAILED))
+  {
+    status = OS_STATUS_ID_2;
+  }
+  /* #20 If checks succeeded: */
+  else
+  {
+    P2CONST(Os_SpinlockConfigType, AUTOMATIC, OS_CONST) spinlock;
+    P2CONST(Os_AppConfigType, AUTOMATIC, OS_CONST) currentApplication;
+
+    spinlock = Os_SpinlockId2Spinlock(SpinlockId);
+    currentApplication = Os_ThreadGetCurrentApplication(Os_CoreGetThread());                                            /* SBSW_OS_SL_THREADGETCURRENTAPPLICATION_001 */
+
+    /* #30 Check that the caller has access to the spinlock. */
+    if(OS_UNLIKELY(Os_AppCheckAccess(currentApplication,                                                                /* SBSW_OS_SL_APPCHECKACCESS_001 */ /* SBSW_OS_SL_SPINLOCKSTATISTICS_001 */
+                                     Os_SpinlockGetAccessingApplications(spinlock)) == OS_CHECK_FAILED))
+    {
+      status = OS_STATUS_ACCESSRIGHTS_1;
+    }
+    /* #40 Copy the statistics of the given core. The copy is not atomic with respect to the recording core. */
+    else
+    {
+      *Statistics = spinlock->Statistics[CoreId].Statistics;                                                            /* SBSW_OS_PWA_PRECONDITION */
+      status = OS_STATUS_OK;
+    }
+  }
+
+  return status;
+}
+
+
 #define OS_STOP_SEC_CODE
 #include "Os_MemMap_OsCode.h"                                                                                           /* PRQA S 5087 */ /* MD_MSR_MemMap */
 
@@ -1598,6 +1712,24 @@ FUNC(Os_StatusType, OS_CODE) Os_Api_TryToGetSpinlock
  \DESCRIPTION    Os_Hal_SpinUnlock is called with a pointer derived from the return value of Os_SpinlockGetDyn.
  \COUNTERMEASURE \M [CM_OS_SPINLOCKGETDYN_M]
 
+\ID SBSW_OS_SL_SPINLOCKALGORITHMUNLOCK_001
+ \DESCRIPTION    Os_SpinlockAlgorithmUnlock is called with the return value of Os_SpinlockId2Spinlock.
+ \COUNTERMEASURE \M [CM_OS_SPINLOCKID2SPINLOCK_M]
+                 \R [CM_OS_SPINLOCK_ID_R]
+
+\ID SBSW_OS_SL_MCSNODES_001
+ \DESCRIPTION    Write access to the MCS node of the current core. The node array is derived from an argument of the
+                 caller function. Precondition ensures that the argument pointer is valid. The compliance of the
+                 precondition is check during review. The index is the ID of the current core.
+ \COUNTERMEASURE \M [CM_OS_SPINLOCK_MCSNODES_M]
+
+\ID SBSW_OS_SL_MCSNODES_002
+ \DESCRIPTION    Write access to the MCS node of another core. The node array is derived from an argument of the
+                 caller function. Precondition ensures that the argument pointer is valid. The compliance of the
+                 precondition is check during review. The index is read from the queue links, which only hold core
+                 IDs + 1 written by the MCS functions or OS_SPINLOCK_MCS_NONE, which is checked before.
+ \COUNTERMEASURE \M [CM_OS_SPINLOCK_MCSNODES_M]
+
 \ID SBSW_OS_SL_THREADCHECKCALLCONTEXT_001
  \DESCRIPTION    Os_ThreadCheckCallContext is called with the return value of Os_CoreGetThread.
  \COUNTERMEASURE \N [CM_OS_COREGETTHREAD_N]
@@ -1658,6 +1790,29 @@ FUNC(Os_StatusType, OS_CODE) Os_Api_TryToGetSpinlock
                  during review.
  \COUNTERMEASURE \M [CM_OS_SL_SPINLOCK_TIMINGHOOKTRACE_M]
 
+\ID SBSW_OS_SL_SPINLOCKSTATISTICS_001
+ \DESCRIPTION    A spinlock statistics function is called with the return value of Os_SpinlockId2Spinlock.
+ \COUNTERMEASURE \M [CM_OS_SPINLOCKID2SPINLOCK_M]
+                 \R [CM_OS_SPINLOCK_ID_R]
+
+\ID SBSW_OS_SL_STATISTICS_001
+ \DESCRIPTION    Write access to the statistics record of the current core. The record array is derived from an
+                 argument of the caller function. Precondition ensures that the argument pointer is valid. The
+                 compliance of the precondition is check during review. The index is the ID of the current core.
+ \COUNTERMEASURE \M [CM_OS_SPINLOCK_STATISTICS_M]
+
+\ID SBSW_OS_SL_STATISTICS_002
+ \DESCRIPTION    Write access to the wait time histogram of the statistics record of the current core. See
+                 SBSW_OS_SL_STATISTICS_001 for the record. The index is limited to
+                 OS_SPINLOCKSTATISTICS_BUCKET_COUNT - 1 before the access.
+ \COUNTERMEASURE \M [CM_OS_SPINLOCK_STATISTICS_M]
+
+\ID SBSW_OS_SL_HAL_TIMERFRTGETCOUNTERVALUE_001
+ \DESCRIPTION    Os_Hal_TimerFrtGetCounterValue is called with a pointer derived from an argument of the caller
+                 function. Precondition ensures that the argument pointer is valid. The compliance of the
+                 precondition is check during review.
+ \COUNTERMEASURE \M [CM_OS_SPINLOCK_STATISTICS_M]
+
 \ID SBSW_OS_SL_TRACESPINLOCKRELEASED_001
  \DESCRIPTION    Os_TraceSpinlockReleased is called with a pointer derived from an argument of the caller function.
                  Precondition ensures that the argument pointer is valid. The compliance of the precondition is check
@@ -1687,6 +1842,14 @@ SBSW_JUSTIFICATION_END */
 \CM CM_OS_SL_SPINLOCK_TIMINGHOOKTRACE_M
       Verify that the TimingHookTrace of each Spinlock is a non NULL_PTR, if TimingHook tracing is enabled.
 
+\CM CM_OS_SPINLOCK_STATISTICS_M
+      Verify that, if OS_CFG_SPINLOCK_STATISTICS is STD_ON, the Statistics of each Spinlock is a non NULL_PTR which
+      points to an array of OS_COREID_COUNT elements and the StatisticsTimer of each Spinlock is a non NULL_PTR.
+
+\CM CM_OS_SPINLOCK_MCSNODES_M
+      Verify that the McsNodes of each Spinlock with Algorithm OS_SPINLOCKALGORITHM_MCS is a non NULL_PTR and
+      points to an array of OS_COREID_COUNT elements.
+
 */
 
 
@@ -45,6 +45,7 @@
 # include "OsInt.h"
 # include "Os_Lcfg.h"
 # include "Os_Common.h"
+# include "Os_Bit.h"
 # include "Os_Lock.h"
 # include "Os_Error.h"
 # include "Os_Core.h"
@@ -56,6 +57,7 @@
 /* Os hal dependencies */
 # include "Os_Hal_Compiler.h"
 # include "Os_Hal_Core.h"
+# include "Os_Hal_Timer.h"
 
 
 
@@ -141,6 +143,12 @@ Os_SpinlockInit,
 
   /* #30 Initialize the HAL spinlock. */
   Os_Hal_SpinInit(&(spinlockDyn->Spinlock));                                                                            /* SBSW_OS_SL_HAL_SPININIT_001 */
+
+  /* #40 Initialize the state of the queue based algorithms. */
+  spinlockDyn->TicketNext = 0uL;                                                                                        /* SBSW_OS_SL_SPINLOCKGETDYN_001 */
+  spinlockDyn->TicketServing = 0uL;                                                                                     /* SBSW_OS_SL_SPINLOCKGETDYN_001 */
+  spinlockDyn->McsTail = OS_SPINLOCK_MCS_NONE;                                                                          /* SBSW_OS_SL_SPINLOCKGETDYN_001 */
+  spinlockDyn->McsHolder = 0uL;                                                                                         /* SBSW_OS_SL_SPINLOCKGETDYN_001 */
 }
 
 
@@ -199,48 +207,580 @@ OS_ALWAYS_INLINE, Os_SpinlockGetAccessingApplications,
 
 
 /***********************************************************************************************************************
- *  Os_SpinlockInternalGet()
+ *  Os_SpinlockTicketTryLock()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
  *
  *
  *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE Os_Hal_SpinlockResultType, OS_CODE, OS_ALWAYS_INLINE,                      /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+Os_SpinlockTicketTryLock,
+(
+  P2CONST(Os_SpinlockConfigType, AUTOMATIC, OS_CONST) Spinlock
+))
+{
+  P2VAR(Os_SpinlockType, AUTOMATIC, OS_VAR_NOINIT) spinlockDyn;
+  Os_Hal_SpinlockResultType result;
+  uint32 serving;
+
+  spinlockDyn = Os_SpinlockGetDyn(Spinlock);                                                                            /* SBSW_OS_FC_PRECONDITION */
+  serving = spinlockDyn->TicketServing;
+
+  /* #10 Draw the served ticket, if no other ticket has been drawn. */
+  if(Os_Hal_BitFieldCmpSwap(&(spinlockDyn->TicketNext), serving + 1uL, serving) == serving)                             /* SBSW_OS_SL_SPINLOCKGETDYN_001 */
+  {
+    result = OS_HAL_SPINLOCKSUCCEEDED;
+  }
+  else
+  {
+    result = OS_SPINLOCK_TRYLOCK_FAILED;
+  }
+
+  return result;
+}
+
+
+/***********************************************************************************************************************
+ *  Os_SpinlockTicketLock()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
  *
  *
  *
  */
-OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,                                           /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */ /* COV_OS_HALPLATFORMMULTICOREUNSUPPORTED */
-Os_SpinlockInternalGet,
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE Os_StdReturnType, OS_CODE, OS_ALWAYS_INLINE,                               /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+Os_SpinlockTicketLock,
 (
   P2CONST(Os_SpinlockConfigType, AUTOMATIC, OS_CONST) Spinlock
-))                                                                                                                      /* COV_OS_HALPLATFORMMULTICOREUNSUPPORTED */
+))
+{
+  P2VAR(Os_SpinlockType, AUTOMATIC, OS_VAR_NOINIT) spinlockDyn;
+  Os_StdReturnType contended;
+  uint32 expected;
+  uint32 ticket;
+
+  spinlockDyn = Os_SpinlockGetDyn(Spinlock);                                                                            /* SBSW_OS_FC_PRECONDITION */
+  ticket = spinlockDyn->TicketNext;
+
+  /* #10 Draw a ticket. Retry until no other core has drawn a ticket in between. */
+  do
+  {
+    expected = ticket;
+    ticket = Os_Hal_BitFieldCmpSwap(&(spinlockDyn->TicketNext), expected + 1uL, expected);                              /* SBSW_OS_SL_SPINLOCKGETDYN_001 */
+  } while(ticket != expected);                                                                                          /* COV_OS_SPINLOCKRACECONDITION */
+
+  /* #20 Spin until the ticket is served. The lock is contended, if the ticket is not served immediately. */
+  contended = (Os_StdReturnType)(spinlockDyn->TicketServing != ticket);                                                 /* PRQA S 4304 */ /* MD_Os_C90BooleanCompatibility */
+  while(spinlockDyn->TicketServing != ticket)                                                                           /* COV_OS_SPINLOCKRACECONDITION */
+  {
+    Os_Hal_CoreNop();
+  }
+
+  /* #30 Order the accesses of the critical section after the grant. */
+  Os_Hal_Dsync();
+
+  return contended;
+}
+
+
+/***********************************************************************************************************************
+ *  Os_SpinlockTicketUnlock()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,                                           /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+Os_SpinlockTicketUnlock,
+(
+  P2CONST(Os_SpinlockConfigType, AUTOMATIC, OS_CONST) Spinlock
+))
+{
+  P2VAR(Os_SpinlockType, AUTOMATIC, OS_VAR_NOINIT) spinlockDyn;
+
+  spinlockDyn = Os_SpinlockGetDyn(Spinlock);                                                                            /* SBSW_OS_FC_PRECONDITION */
+
+  /* #10 Publish the accesses of the critical section, then serve the next ticket. Only the lock holder writes
+   *     the served ticket. */
+  Os_Hal_Dsync();
+  spinlockDyn->TicketServing = spinlockDyn->TicketServing + 1uL;                                                        /* SBSW_OS_SL_SPINLOCKGETDYN_001 */
+  Os_Hal_Dsync();
+}
+
+
+/***********************************************************************************************************************
+ *  Os_SpinlockMcsTryLock()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE Os_Hal_SpinlockResultType, OS_CODE, OS_ALWAYS_INLINE,                      /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+Os_SpinlockMcsTryLock,
+(
+  P2CONST(Os_SpinlockConfigType, AUTOMATIC, OS_CONST) Spinlock
+))
 {
-  P2CONST(Os_SpinlockType, AUTOMATIC, OS_VAR_NOINIT) spinlockDyn;
+  P2VAR(Os_SpinlockType, AUTOMATIC, OS_VAR_NOINIT) spinlockDyn;
   Os_Hal_SpinlockResultType result;
+  uint32 coreIdx;
 
   spinlockDyn = Os_SpinlockGetDyn(Spinlock);                                                                            /* SBSW_OS_FC_PRECONDITION */
+  coreIdx = (uint32)Os_CoreGetId(Os_CoreGetCurrentCore());                                                              /* SBSW_OS_FC_PRECONDITION */
 
-  /* #10 Inform the trace module */
-  Os_TraceSpinlockRequested(Spinlock->TimingHookTrace);                                                                 /* SBSW_OS_SL_TRACESPINLOCKREQUESTED_001 */
+  /* #10 Prepare the node of the current core as the last node in the queue. */
+  Spinlock->McsNodes[coreIdx].Next = OS_SPINLOCK_MCS_NONE;                                                              /* SBSW_OS_SL_MCSNODES_001 */
 
-  /* #20 Loop. */
+  /* #20 Append the node, if the queue is empty. */
+  if(Os_Hal_BitFieldCmpSwap(&(spinlockDyn->McsTail), coreIdx + 1uL, OS_SPINLOCK_MCS_NONE) == OS_SPINLOCK_MCS_NONE)      /* SBSW_OS_SL_SPINLOCKGETDYN_001 */
+  {
+    spinlockDyn->McsHolder = coreIdx;                                                                                   /* SBSW_OS_SL_SPINLOCKGETDYN_001 */
+    result = OS_HAL_SPINLOCKSUCCEEDED;
+  }
+  else
+  {
+    result = OS_SPINLOCK_TRYLOCK_FAILED;
+  }
+
+  return result;
+}
+
+
+/***********************************************************************************************************************
+ *  Os_SpinlockMcsLock()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE Os_StdReturnType, OS_CODE, OS_ALWAYS_INLINE,                               /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+Os_SpinlockMcsLock,
+(
+  P2CONST(Os_SpinlockConfigType, AUTOMATIC, OS_CONST) Spinlock
+))
+{
+  P2VAR(Os_SpinlockType, AUTOMATIC, OS_VAR_NOINIT) spinlockDyn;
+  P2VAR(Os_SpinlockMcsNodeType, AUTOMATIC, OS_VAR_NOINIT) node;
+  uint32 coreIdx;
+  uint32 expected;
+  uint32 predecessor;
+
+  spinlockDyn = Os_SpinlockGetDyn(Spinlock);                                                                            /* SBSW_OS_FC_PRECONDITION */
+  coreIdx = (uint32)Os_CoreGetId(Os_CoreGetCurrentCore());                                                              /* SBSW_OS_FC_PRECONDITION */
+  node = &(Spinlock->McsNodes[coreIdx]);
+
+  /* #10 Prepare the node of the current core as the last waiting node. */
+  node->Next = OS_SPINLOCK_MCS_NONE;                                                                                    /* SBSW_OS_SL_MCSNODES_001 */
+  node->Locked = 1uL;                                                                                                   /* SBSW_OS_SL_MCSNODES_001 */
+
+  /* #20 Append the node to the queue. Retry until no other core has modified the tail in between. */
+  predecessor = spinlockDyn->McsTail;
   do
   {
-    /* #30 Spin while the spinlock is locked. */
-    while(Os_Hal_SpinIsLocked(&(spinlockDyn->Spinlock)) != 0u)                                                          /* PRQA S 2994, 2996 */ /* MD_Os_Rule14.3_2994, MD_Os_Rule2.2_2996 */ /* SBSW_OS_SL_HAL_SPINISLOCKED_001 */
+    expected = predecessor;
+    predecessor = Os_Hal_BitFieldCmpSwap(&(spinlockDyn->McsTail), coreIdx + 1uL, expected);                             /* SBSW_OS_SL_SPINLOCKGETDYN_001 */
+  } while(predecessor != expected);                                                                                     /* COV_OS_SPINLOCKRACECONDITION */
+
+  /* #30 If there is a predecessor, link the node and spin on it until the predecessor passes the lock. */
+  if(predecessor != OS_SPINLOCK_MCS_NONE)                                                                               /* COV_OS_SPINLOCKRACECONDITION */
+  {
+    Spinlock->McsNodes[predecessor - 1uL].Next = coreIdx + 1uL;                                                         /* SBSW_OS_SL_MCSNODES_002 */
+    Os_Hal_Dsync();
+
+    while(node->Locked != 0uL)                                                                                          /* COV_OS_SPINLOCKRACECONDITION */
     {
       Os_Hal_CoreNop();
     }
+  }
 
-    /* #40 Try to get the lock. */
-    result = Os_SpinlockInternalTryGet(Spinlock);                                                                       /* SBSW_OS_FC_PRECONDITION */
+  /* #40 Remember the node of the lock holder and order the accesses of the critical section after the grant. */
+  spinlockDyn->McsHolder = coreIdx;                                                                                     /* SBSW_OS_SL_SPINLOCKGETDYN_001 */
+  Os_Hal_Dsync();
 
-  /* #50 Loop while locking failed. */
-  } while(result != OS_HAL_SPINLOCKSUCCEEDED);                                                                          /* PRQA S 2993, 2996 */ /* MD_Os_Rule14.3_2993, MD_Os_Rule2.2_2996 */ /* COV_OS_SPINLOCKRACECONDITION */
+  /* #50 The lock is contended, if the node has been queued behind a predecessor. */
+  return (Os_StdReturnType)(predecessor != OS_SPINLOCK_MCS_NONE);                                                       /* PRQA S 4304 */ /* MD_Os_C90BooleanCompatibility */
 }
 
 
+/***********************************************************************************************************************
+ *  Os_SpinlockMcsUnlock()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,                                           /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+Os_SpinlockMcsUnlock,
+(
+  P2CONST(Os_SpinlockConfigType, AUTOMATIC, OS_CONST) Spinlock
+))
+{
+  P2VAR(Os_SpinlockType, AUTOMATIC, OS_VAR_NOINIT) spinlockDyn;
+  P2CONST(Os_SpinlockMcsNodeType, AUTOMATIC, OS_VAR_NOINIT) node;
+  uint32 holderIdx;
+  uint32 successor;
+
+  spinlockDyn = Os_SpinlockGetDyn(Spinlock);                                                                            /* SBSW_OS_FC_PRECONDITION */
+  holderIdx = spinlockDyn->McsHolder;
+  node = &(Spinlock->McsNodes[holderIdx]);
+  successor = node->Next;
+
+  /* #10 If no successor is linked, try to free the lock. If another core has appended its node in between, wait
+   *     until it is linked. */
+  if(successor == OS_SPINLOCK_MCS_NONE)
+  {
+    if(Os_Hal_BitFieldCmpSwap(&(spinlockDyn->McsTail), OS_SPINLOCK_MCS_NONE, holderIdx + 1uL) != (holderIdx + 1uL))     /* SBSW_OS_SL_SPINLOCKGETDYN_001 */ /* COV_OS_SPINLOCKRACECONDITION */
+    {
+      do
+      {
+        Os_Hal_CoreNop();
+        successor = node->Next;
+      } while(successor == OS_SPINLOCK_MCS_NONE);                                                                       /* COV_OS_SPINLOCKRACECONDITION */
+    }
+  }
+
+  /* #20 If there is a successor, publish the accesses of the critical section and pass the lock. */
+  if(successor != OS_SPINLOCK_MCS_NONE)                                                                                 /* COV_OS_SPINLOCKRACECONDITION */
+  {
+    Os_Hal_Dsync();
+    Spinlock->McsNodes[successor - 1uL].Locked = 0uL;                                                                   /* SBSW_OS_SL_MCSNODES_002 */
+    Os_Hal_Dsync();
+  }
+}
+
+
+/***********************************************************************************************************************
+ *  Os_SpinlockAlgorithmTryLock()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE Os_Hal_SpinlockResultType, OS_CODE, OS_ALWAYS_INLINE,                      /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+Os_SpinlockAlgorithmTryLock,
+(
+  P2CONST(Os_SpinlockConfigType, AUTOMATIC, OS_CONST) Spinlock
+))
+{
+  Os_Hal_SpinlockResultType result;
+
+  /* #10 Delegate to the configured algorithm. */
+  switch(Spinlock->Algorithm)
+  {
+    case OS_SPINLOCKALGORITHM_TAS:
+      result = Os_Hal_SpinTryLock(&(Os_SpinlockGetDyn(Spinlock)->Spinlock));                                            /* SBSW_OS_SL_HAL_SPINTRYLOCK_001 */
+      break;
+
+    case OS_SPINLOCKALGORITHM_TICKET:
+      result = Os_SpinlockTicketTryLock(Spinlock);                                                                      /* SBSW_OS_FC_PRECONDITION */
+      break;
+
+    case OS_SPINLOCKALGORITHM_MCS:
+      result = Os_SpinlockMcsTryLock(Spinlock);                                                                         /* SBSW_OS_FC_PRECONDITION */
+      break;
+
+    default:                                                                                                            /* COV_OS_INVSTATE */
+      result = OS_SPINLOCK_TRYLOCK_FAILED;
+      Os_ErrKernelPanic();
+      break;                                                                                                            /* PRQA S 2880 */ /* MD_Os_Rule2.1_2880_NonReturning */
+  }
+
+  return result;
+}
+
+
+/***********************************************************************************************************************
+ *  Os_SpinlockAlgorithmLock()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE Os_StdReturnType, OS_CODE, OS_ALWAYS_INLINE,                               /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+Os_SpinlockAlgorithmLock,
+(
+  P2CONST(Os_SpinlockConfigType, AUTOMATIC, OS_CONST) Spinlock
+))
+{
+  Os_StdReturnType contended;
+
+  /* #10 Delegate to the configured queue based algorithm. */
+  switch(Spinlock->Algorithm)
+  {
+    case OS_SPINLOCKALGORITHM_TICKET:
+      contended = Os_SpinlockTicketLock(Spinlock);                                                                      /* SBSW_OS_FC_PRECONDITION */
+      break;
+
+    case OS_SPINLOCKALGORITHM_MCS:
+      contended = Os_SpinlockMcsLock(Spinlock);                                                                         /* SBSW_OS_FC_PRECONDITION */
+      break;
+
+    default:                                                                                                            /* COV_OS_INVSTATE */
+      contended = 0u;
+      Os_ErrKernelPanic();
+      break;                                                                                                            /* PRQA S 2880 */ /* MD_Os_Rule2.1_2880_NonReturning */
+  }
+
+  return contended;
+}
+
+
+/***********************************************************************************************************************
+ *  Os_SpinlockAlgorithmUnlock()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,                                           /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+Os_SpinlockAlgorithmUnlock,
+(
+  P2CONST(Os_SpinlockConfigType, AUTOMATIC, OS_CONST) Spinlock
+))
+{
+  /* #10 Delegate to the configured algorithm. */
+  switch(Spinlock->Algorithm)
+  {
+    case OS_SPINLOCKALGORITHM_TAS:
+      Os_Hal_SpinUnlock(&(Os_SpinlockGetDyn(Spinlock)->Spinlock));                                                      /* SBSW_OS_SL_HAL_SPINUNLOCKED_001 */
+      break;
+
+    case OS_SPINLOCKALGORITHM_TICKET:
+      Os_SpinlockTicketUnlock(Spinlock);                                                                                /* SBSW_OS_FC_PRECONDITION */
+      break;
+
+    case OS_SPINLOCKALGORITHM_MCS:
+      Os_SpinlockMcsUnlock(Spinlock);                                                                                   /* SBSW_OS_FC_PRECONDITION */
+      break;
+
+    default:                                                                                                            /* COV_OS_INVSTATE */
+      Os_ErrKernelPanic();
+      break;                                                                                                            /* PRQA S 2880 */ /* MD_Os_Rule2.1_2880_NonReturning */
+  }
+}
+
+
+/***********************************************************************************************************************
+ *  Os_SpinlockStatisticsIsEnabled()
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE Os_StdReturnType, OS_CODE,                                                 /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+OS_ALWAYS_INLINE, Os_SpinlockStatisticsIsEnabled, (void))
+{
+  return (OS_CFG_SPINLOCK_STATISTICS == STD_ON);                                                                        /* PRQA S 4304, 4404, 2995, 2996 */ /* MD_Os_C90BooleanCompatibility, MD_Os_C90BooleanCompatibility, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */
+}
+
+
+/***********************************************************************************************************************
+ *  Os_SpinlockStatisticsGetTime()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE Os_Hal_TimerFrtTickType, OS_CODE, OS_ALWAYS_INLINE,                        /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+Os_SpinlockStatisticsGetTime,
+(
+  P2CONST(Os_SpinlockConfigType, AUTOMATIC, OS_CONST) Spinlock
+))
+{
+  Os_Hal_TimerFrtTickType result;
+
+  /* #10 If statistics are enabled, read the statistics timer. */
+  if(Os_SpinlockStatisticsIsEnabled() != 0u)                                                                            /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */ /* COV_OS_INVSTATE */
+  {
+    result = Os_Hal_TimerFrtGetCounterValue(Spinlock->StatisticsTimer);                                                 /* SBSW_OS_SL_HAL_TIMERFRTGETCOUNTERVALUE_001 */
+  }
+  else
+  {
+    result = 0u;
+  }
+
+  return result;
+}
+
+
+/***********************************************************************************************************************
+ *  Os_SpinlockStatisticsTaken()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,                                           /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+Os_SpinlockStatisticsTaken,
+(
+  P2CONST(Os_SpinlockConfigType, AUTOMATIC, OS_CONST) Spinlock,
+  Os_Hal_TimerFrtTickType RequestTime,
+  Os_StdReturnType Contended
+))
+{
+  /* #10 If statistics are enabled: */
+  if(Os_SpinlockStatisticsIsEnabled() != 0u)                                                                            /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */ /* COV_OS_INVSTATE */
+  {
+    P2VAR(Os_SpinlockStatisticsRecordType, AUTOMATIC, OS_VAR_NOINIT) record;
+    Os_Hal_TimerFrtTickType now;
+    Os_Hal_TimerFrtTickType waitTime;
+    uint32 bucket;
+
+    record = &(Spinlock->Statistics[Os_CoreGetId(Os_CoreGetCurrentCore())]);                                            /* SBSW_OS_FC_PRECONDITION */
+    now = Os_SpinlockStatisticsGetTime(Spinlock);                                                                       /* SBSW_OS_FC_PRECONDITION */
+    waitTime = (Os_Hal_TimerFrtTickType)(now - RequestTime);
+
+    /* #20 Count the grant and the contention. */
+    record->Statistics.AcquisitionCount++;                                                                              /* SBSW_OS_SL_STATISTICS_001 */
+    if(Contended != 0u)
+    {
+      record->Statistics.ContendedCount++;                                                                              /* SBSW_OS_SL_STATISTICS_001 */
+    }
+
+    /* #30 Count the wait time in the bucket of its bit width. Longer waits are counted in the last bucket. */
+    bucket = (uint32)Os_Bit_GetBitfieldWidth() - (uint32)Os_Bit_CountLeadingZeros((Os_BitFieldType)waitTime);
+    if(bucket >= OS_SPINLOCKSTATISTICS_BUCKET_COUNT)
+    {
+      bucket = OS_SPINLOCKSTATISTICS_BUCKET_COUNT - 1u;
+    }
+    record->Statistics.WaitHistogram[bucket]++;                                                                         /* SBSW_OS_SL_STATISTICS_002 */
+
+    /* #40 Update the longest wait time. */
+    if(waitTime > record->Statistics.MaxWaitTime)
+    {
+      record->Statistics.MaxWaitTime = waitTime;                                                                        /* SBSW_OS_SL_STATISTICS_001 */
+    }
+
+    /* #50 Remember the time of the grant for the hold time. */
+    record->TakenTime = now;                                                                                            /* SBSW_OS_SL_STATISTICS_001 */
+  }
+}
+
+
+/***********************************************************************************************************************
+ *  Os_SpinlockStatisticsReleased()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,                                           /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+Os_SpinlockStatisticsReleased,
+(
+  P2CONST(Os_SpinlockConfigType, AUTOMATIC, OS_CONST) Spinlock
+))
+{
+  /* #10 If statistics are enabled: */
+  if(Os_SpinlockStatisticsIsEnabled() != 0u)                                                                            /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */ /* COV_OS_INVSTATE */
+  {
+    P2VAR(Os_SpinlockStatisticsRecordType, AUTOMATIC, OS_VAR_NOINIT) record;
+    Os_Hal_TimerFrtTickType holdTime;
+
+    record = &(Spinlock->Statistics[Os_CoreGetId(Os_CoreGetCurrentCore())]);                                            /* SBSW_OS_FC_PRECONDITION */
+
+    /* #20 Update the longest hold time. */
+    holdTime = (Os_Hal_TimerFrtTickType)(Os_SpinlockStatisticsGetTime(Spinlock) - record->TakenTime);                   /* SBSW_OS_FC_PRECONDITION */
+    if(holdTime > record->Statistics.MaxHoldTime)
+    {
+      record->Statistics.MaxHoldTime = holdTime;                                                                        /* SBSW_OS_SL_STATISTICS_001 */
+    }
+  }
+}
+
+
+/***********************************************************************************************************************
+ *  Os_SpinlockInternalGet()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,                                           /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */ /* COV_OS_HALPLATFORMMULTICOREUNSUPPORTED */
+Os_SpinlockInternalGet,
+(
+  P2CONST(Os_SpinlockConfigType, AUTOMATIC, OS_CONST) Spinlock
+))                                                                                                                      /* COV_OS_HALPLATFORMMULTICOREUNSUPPORTED */
+{
+  P2VAR(Os_SpinlockType, AUTOMATIC, OS_VAR_NOINIT) spinlockDyn;
+  Os_Hal_SpinlockResultType result;
+  Os_Hal_TimerFrtTickType requestTime;
+  Os_StdReturnType contended;
+  Os_IntStateType interruptState;
+
+  spinlockDyn = Os_SpinlockGetDyn(Spinlock);                                                                            /* SBSW_OS_FC_PRECONDITION */
+
+  /* #10 Inform the trace module and take the time of the request. */
+  Os_TraceSpinlockRequested(Spinlock->TimingHookTrace);                                                                 /* SBSW_OS_SL_TRACESPINLOCKREQUESTED_001 */
+  requestTime = Os_SpinlockStatisticsGetTime(Spinlock);                                                                 /* SBSW_OS_FC_PRECONDITION */
+
+  /* #20 If the spinlock uses a queue based algorithm: */
+  if(Spinlock->Algorithm != OS_SPINLOCKALGORITHM_TAS)
+  {
+    /* #30 Wait with suspended interrupts, so that the waiter is neither preempted nor killed while it is enqueued
+     *     and does not stall the waiters behind it. Set the lock owner once the lock has been granted. */
+    Os_IntSuspend(&interruptState);                                                                                     /* SBSW_OS_FC_POINTER2LOCAL */
+    contended = Os_SpinlockAlgorithmLock(Spinlock);                                                                     /* SBSW_OS_FC_PRECONDITION */
+    spinlockDyn->OwnerThread = Os_CoreGetThread();                                                                      /* SBSW_OS_SL_SPINLOCKGETDYN_001 */
+    Os_IntResume(&interruptState);                                                                                      /* SBSW_OS_FC_POINTER2LOCAL */
+
+    /* #40 Inform the trace module. */
+    Os_TraceSpinlockTaken(Spinlock->TimingHookTrace);                                                                   /* SBSW_OS_SL_TRACESPINLOCKTAKEN_001 */
+  }
+  else
+  {
+    contended = 0u;
+
+    /* #50 Otherwise loop. */
+    do
+    {
+      /* #60 Spin while the spinlock is locked. */
+      while(Os_Hal_SpinIsLocked(&(spinlockDyn->Spinlock)) != 0u)                                                        /* PRQA S 2994, 2996 */ /* MD_Os_Rule14.3_2994, MD_Os_Rule2.2_2996 */ /* SBSW_OS_SL_HAL_SPINISLOCKED_001 */
+      {
+        Os_Hal_CoreNop();
+        contended = !0u;                                                                                                /* PRQA S 4404, 4558 */ /* MD_Os_C90BooleanCompatibility, MD_Os_Rule10.1_4558 */
+      }
+
+      /* #70 Try to get the lock. */
+      result = Os_SpinlockInternalTryGet(Spinlock);                                                                     /* SBSW_OS_FC_PRECONDITION */
+      if(result != OS_HAL_SPINLOCKSUCCEEDED)                                                                            /* PRQA S 2991, 2995 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule2.2_2995 */ /* COV_OS_SPINLOCKRACECONDITION */
+      {
+        contended = !0u;                                                                                                /* PRQA S 4404, 4558 */ /* MD_Os_C90BooleanCompatibility, MD_Os_Rule10.1_4558 */
+      }
+
+    /* #80 Loop while locking failed. */
+    } while(result != OS_HAL_SPINLOCKSUCCEEDED);                                                                        /* PRQA S 2993, 2996 */ /* MD_Os_Rule14.3_2993, MD_Os_Rule2.2_2996 */ /* COV_OS_SPINLOCKRACECONDITION */
+  }
+
+  /* #90 Record the grant in the statistics. */
+  Os_SpinlockStatisticsTaken(Spinlock, requestTime, contended);                                                         /* SBSW_OS_FC_PRECONDITION */
+}                                                                                                                       /* PRQA S 6050 */ /* MD_MSR_STCAL */
+
+
 /***********************************************************************************************************************
  *  Os_SpinlockInternalTryGet()
  **********************************************************************************************************************/
@@ -277,7 +817,7 @@ OS_ALWAYS_INLINE, Os_SpinlockInternalTryGet,
     Os_IntSuspend(&interruptState);                                                                                     /* SBSW_OS_FC_POINTER2LOCAL */
 
     /* #30 Try to get the lock. */
-    result = Os_Hal_SpinTryLock(&(spinlockDyn->Spinlock));                                                              /* SBSW_OS_SL_HAL_SPINTRYLOCK_001 */
+    result = Os_SpinlockAlgorithmTryLock(Spinlock);                                                                     /* SBSW_OS_FC_PRECONDITION */
 
     /* #40 On success: */
     if(result == OS_HAL_SPINLOCKSUCCEEDED)                                                                              /* PRQA S 2991, 2995 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule2.2_2995 */
@@ -292,7 +832,7 @@ OS_ALWAYS_INLINE, Os_SpinlockInternalTryGet,
   /* #70 Else try to get the lock. */
   else
   {
-    result = Os_Hal_SpinTryLock(&(spinlockDyn->Spinlock));                                                              /* SBSW_OS_SL_HAL_SPINTRYLOCK_001 */
+    result = Os_SpinlockAlgorithmTryLock(Spinlock);                                                                     /* SBSW_OS_FC_PRECONDITION */
   }
 
   /* #80 On Success inform the trace module. */
@@ -331,6 +871,9 @@ Os_SpinlockInternalRelease,
 
   spinlockDyn = Os_SpinlockGetDyn(Spinlock);                                                                            /* SBSW_OS_FC_PRECONDITION */
 
+  /* #5 Record the hold time, while the spinlock is still held. */
+  Os_SpinlockStatisticsReleased(Spinlock);                                                                              /* SBSW_OS_FC_PRECONDITION */
+
   /* #10 If killing is enabled: */
   if(Os_ErrIsKillingEnabled() != 0u)                                                                                    /* COV_OS_HALPLATFORMTESTEDASMULTICORE */ /* PRQA S 2991, 2995 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule2.2_2995 */
   {
@@ -344,8 +887,8 @@ Os_SpinlockInternalRelease,
     /* #30 Inform the trace module. */
     Os_TraceSpinlockReleased(Spinlock->TimingHookTrace);                                                                /* SBSW_OS_SL_TRACESPINLOCKRELEASED_001 */
 
-    /* #40 Delegate to the HAL. */
-    Os_Hal_SpinUnlock(&(spinlockDyn->Spinlock));                                                                        /* SBSW_OS_SL_HAL_SPINUNLOCKED_001 */
+    /* #40 Unlock the lock variable. */
+    Os_SpinlockAlgorithmUnlock(Spinlock);                                                                               /* SBSW_OS_FC_PRECONDITION */
 
     /* #50 Clear the owner. */
     spinlockDyn->OwnerThread = NULL_PTR;                                                                                /* SBSW_OS_SL_SPINLOCKGETDYN_001 */
@@ -358,8 +901,8 @@ Os_SpinlockInternalRelease,
     /* #70 Else inform the trace module. */
     Os_TraceSpinlockReleased(Spinlock->TimingHookTrace);                                                                /* SBSW_OS_SL_TRACESPINLOCKRELEASED_001 */
 
-    /* #80 Delegate to the HAL. */
-    Os_Hal_SpinUnlock(&(spinlockDyn->Spinlock));                                                                        /* SBSW_OS_SL_HAL_SPINUNLOCKED_001 */
+    /* #80 Unlock the lock variable. */
+    Os_SpinlockAlgorithmUnlock(Spinlock);                                                                               /* SBSW_OS_FC_PRECONDITION */
   }
 
 }                                                                                                                       /* PRQA S 6050 */ /* MD_MSR_STCAL */
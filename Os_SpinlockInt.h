@@ -51,6 +51,31 @@
  * If optimized spinlocks are used, the application is responsible for the correct mapping of the spinlock variable.
  * For each optimized spinlock a separate section is provided (see \ref SectionDescription_SPINLOCK_x_VAR_NOCACHE).
  *
+ * ### Lock Algorithms
+ * Each spinlock selects the algorithm of its lock variable (\ref Os_SpinlockAlgorithmType):
+ *  - TAS: Test and test-and-set on the HAL spinlock variable. On release, all waiting cores compete for the lock,
+ *    so the core with the shortest path to the lock variable may win repeatedly.
+ *  - TICKET: Each waiter draws a ticket and the lock is granted in ticket order. All waiters spin on the same
+ *    variable.
+ *  - MCS: Waiters are queued in FIFO order. Each core spins on its own cache line aligned node, so a release only
+ *    invalidates the cache line of the next waiter.
+ *
+ * The queue based algorithms (TICKET, MCS) hand the lock over to a waiter which has already been enqueued. A thread
+ * which is preempted or killed while it waits would therefore block all following waiters. For that reason:
+ *  - Waiting is always performed with suspended interrupts, so a waiter is neither preempted nor killed while it is
+ *    enqueued.
+ *  - The lock holder must not be preempted by other accessors of the spinlock on the same core. This is ensured by a
+ *    lock method which prevents that preemption (e.g. ALL_INT).
+ *  - MCS spinlocks use one node per core (see \ref Os_SpinlockConfigType_Tag::McsNodes).
+ *
+ * ### Contention Statistics
+ * If OS_CFG_SPINLOCK_STATISTICS is enabled, each spinlock records per core how often it has been taken, how often it
+ * has been found locked, a histogram of the wait times and the longest wait and hold times (see
+ * \ref Os_SpinlockStatisticsType). The time stamps are taken from the timer configured for the spinlock
+ * (\ref Os_SpinlockConfigType_Tag::StatisticsTimer). Each record is only written by its own core while it holds the
+ * spinlock. Forcibly released spinlocks do not record a hold time. The statistics can be requested by
+ * \ref Os_GetSpinlockStatistics().
+ *
  * ### Spinlock Order
  * To avoid deadlocks, Spinlocks have to be locked in a defined sequence. This sequence is defined by the spinlock
  * order number. Spinlocks with lower order numbers may not be locked by threads which already hold locks of higher
@@ -109,6 +134,7 @@
 /* Os hal dependencies */
 # include "Os_Hal_CoreInt.h"
 # include "Os_Hal_CompilerInt.h"
+# include "Os_Hal_TimerInt.h"
 
 
 
@@ -119,6 +145,20 @@
 /*! End marker of linked list of spinlocks. */
 #define OS_SPINLOCK_LIST_END            ((P2CONST(Os_SpinlockConfigType, AUTOMATIC, OS_CONST))(NULL_PTR))
 
+/*! Result of a failed lock attempt of a queue based spinlock. Differs from OS_HAL_SPINLOCKSUCCEEDED. */
+#define OS_SPINLOCK_TRYLOCK_FAILED      ((Os_Hal_SpinlockResultType)0uL)
+
+/*! Number of padding words, which fill an MCS node up to a 32 byte cache line. */
+#define OS_SPINLOCK_MCSNODE_PADDING     (6u)
+
+/*! Marks an empty link of the MCS queue. Links hold the node index + 1. */
+#define OS_SPINLOCK_MCS_NONE            (0uL)
+
+/*! Spinlock contention statistics are not recorded, unless enabled by the configuration. */
+# ifndef OS_CFG_SPINLOCK_STATISTICS
+#  define OS_CFG_SPINLOCK_STATISTICS  STD_OFF
+# endif
+
 /***********************************************************************************************************************
  *  GLOBAL FUNCTION MACROS
  **********************************************************************************************************************/
@@ -180,10 +220,49 @@ typedef enum
 }Os_SpinlockCheckType;
 
 
+/*! Algorithm of the lock variable of a spinlock. */
+typedef enum
+{
+  /*! Test and test-and-set on the HAL spinlock variable. */
+  OS_SPINLOCKALGORITHM_TAS,
+  /*! Ticket lock. The lock is granted in the order of the lock requests. */
+  OS_SPINLOCKALGORITHM_TICKET,
+  /*! MCS queue lock. The lock is granted in the order of the lock requests and each core spins on its own node. */
+  OS_SPINLOCKALGORITHM_MCS
+}Os_SpinlockAlgorithmType;
+
+
+/*! Queue node of a core waiting for or holding an MCS spinlock.
+ * \details The generator places each node array aligned to the cache line size, so that each core spins on its
+ *          own cache line. */
+typedef struct
+{
+  /*! Link to the node of the next waiter (node index + 1) or OS_SPINLOCK_MCS_NONE. */
+  volatile uint32 Next;
+
+  /*! Tells whether the owner of this node still has to wait (!0) or has been granted the lock (0). */
+  volatile uint32 Locked;
+
+  /*! Fills the node up to one cache line. */
+  uint32 Padding[OS_SPINLOCK_MCSNODE_PADDING];
+}Os_SpinlockMcsNodeType;
+
+
 /*! Type which specifies the order number of a spinlock. */
 typedef uint8 Os_SpinlockOrderType;
 
 
+/*! Contention statistics of a spinlock on one core. */
+typedef struct
+{
+  /*! The recorded statistics. */
+  Os_SpinlockStatisticsType Statistics;
+
+  /*! Timer value at the last lock grant on this core. */
+  Os_Hal_TimerFrtTickType TakenTime;
+}Os_SpinlockStatisticsRecordType;
+
+
 /*! Dynamic information of a spinlock.
  * \extends Os_LockType */
 struct Os_SpinlockType_Tag
@@ -206,6 +285,19 @@ struct Os_SpinlockType_Tag
 
   /*! The priority of the task before the spinlock was locked. */
   Os_TaskPrioType PreviousPriority;
+
+  /*! The next ticket to be drawn (OS_SPINLOCKALGORITHM_TICKET). */
+  volatile uint32 TicketNext;
+
+  /*! The ticket which currently holds the lock (OS_SPINLOCKALGORITHM_TICKET). */
+  volatile uint32 TicketServing;
+
+  /*! Link to the last node in the queue (node index + 1) or OS_SPINLOCK_MCS_NONE if the lock is free
+   *  (OS_SPINLOCKALGORITHM_MCS). */
+  volatile uint32 McsTail;
+
+  /*! Index of the node of the current lock holder (OS_SPINLOCKALGORITHM_MCS). */
+  uint32 McsHolder;
 };
 
 
@@ -236,6 +328,21 @@ struct Os_SpinlockConfigType_Tag
 
   /*! Pointer to the configured trace data. */
   P2CONST(Os_TraceSpinlockConfigType, TYPEDEF, OS_CONST) TimingHookTrace;
+
+  /*! Algorithm of the lock variable. */
+  Os_SpinlockAlgorithmType Algorithm;
+
+  /*! MCS queue nodes, indexed by the core ID. The array has OS_COREID_COUNT elements.
+   *  NULL_PTR if Algorithm is not OS_SPINLOCKALGORITHM_MCS. */
+  P2VAR(Os_SpinlockMcsNodeType, TYPEDEF, OS_VAR_NOINIT) McsNodes;
+
+  /*! Statistics records, indexed by the core ID. The array has OS_COREID_COUNT elements and has to be writable by
+   *  all accessors of the spinlock. NULL_PTR if OS_CFG_SPINLOCK_STATISTICS is disabled. */
+  P2VAR(Os_SpinlockStatisticsRecordType, TYPEDEF, OS_VAR_NOINIT) Statistics;
+
+  /*! Timer which provides the time stamps of the statistics. It has to be readable by all accessors of the
+   *  spinlock. NULL_PTR if OS_CFG_SPINLOCK_STATISTICS is disabled. */
+  P2CONST(Os_Hal_TimerFrtConfigType, TYPEDEF, OS_CONST) StatisticsTimer;
 };
 
 
@@ -530,7 +637,8 @@ FUNC(void, OS_CODE) Os_SpinlockForciblyReleaseThreadLocks
 /*! \brief          Busy wait for spinlock, occupy if spinlock is free.
  *  \details        Spinlock based on just test-and-set, can lead to resource contention in busy lock
  *                  (caused by bus locking and cache invalidation). Therefore this function is based on
- *                  the test and test-and-set algorithm.
+ *                  the test and test-and-set algorithm, unless the spinlock is configured to use a queue based
+ *                  algorithm (see \ref Os_SpinlockAlgorithmType).
  *
  *                  \see          [Test and Test-and-set](https:\\en.wikipedia.org/wiki/Test_and_Test-and-set)
  *
@@ -599,6 +707,322 @@ Os_SpinlockInternalRelease,
 ));
 
 
+/***********************************************************************************************************************
+ *  Os_SpinlockTicketTryLock()
+ **********************************************************************************************************************/
+/*! \brief          Tries once to draw the ticket which is currently served.
+ *  \details        Fails, if the lock is held or another core has drawn a ticket.
+ *
+ *  \param[in,out]  Spinlock  The spinlock. Parameter must not be NULL.
+ *
+ *  \retval         OS_HAL_SPINLOCKSUCCEEDED     If locking succeeded.
+ *  \retval         !OS_HAL_SPINLOCKSUCCEEDED    If locking failed.
+ *
+ *  \context        OS_INTERNAL
+ *
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *
+ *  \pre            Spinlock uses OS_SPINLOCKALGORITHM_TICKET.
+ *  \pre            No other thread of the current core waits for or holds the spinlock.
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE Os_Hal_SpinlockResultType, OS_CODE, OS_ALWAYS_INLINE,
+Os_SpinlockTicketTryLock,
+(
+  P2CONST(Os_SpinlockConfigType, AUTOMATIC, OS_CONST) Spinlock
+));
+
+
+/***********************************************************************************************************************
+ *  Os_SpinlockTicketLock()
+ **********************************************************************************************************************/
+/*! \brief          Draws a ticket and waits until it is served.
+ *  \details        Waiters are granted the lock in the order in which they have drawn their tickets.
+ *
+ *  \param[in,out]  Spinlock  The spinlock. Parameter must not be NULL.
+ *
+ *  \retval         0    The lock has been granted without waiting.
+ *  \retval         !0   The lock has been held or requested by another core.
+ *
+ *  \context        OS_INTERNAL
+ *
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *
+ *  \pre            Spinlock uses OS_SPINLOCKALGORITHM_TICKET.
+ *  \pre            No other thread of the current core waits for or holds the spinlock.
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE Os_StdReturnType, OS_CODE, OS_ALWAYS_INLINE,
+Os_SpinlockTicketLock,
+(
+  P2CONST(Os_SpinlockConfigType, AUTOMATIC, OS_CONST) Spinlock
+));
+
+
+/***********************************************************************************************************************
+ *  Os_SpinlockTicketUnlock()
+ **********************************************************************************************************************/
+/*! \brief          Serves the next ticket.
+ *  \details        --no details--
+ *
+ *  \param[in,out]  Spinlock  The spinlock. Parameter must not be NULL.
+ *
+ *  \context        OS_INTERNAL
+ *
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *
+ *  \pre            Spinlock uses OS_SPINLOCKALGORITHM_TICKET.
+ *  \pre            The spinlock is held.
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,
+Os_SpinlockTicketUnlock,
+(
+  P2CONST(Os_SpinlockConfigType, AUTOMATIC, OS_CONST) Spinlock
+));
+
+
+/***********************************************************************************************************************
+ *  Os_SpinlockMcsTryLock()
+ **********************************************************************************************************************/
+/*! \brief          Tries once to take the MCS lock with the node of the current core.
+ *  \details        Succeeds only if the queue is empty.
+ *
+ *  \param[in,out]  Spinlock  The spinlock. Parameter must not be NULL.
+ *
+ *  \retval         OS_HAL_SPINLOCKSUCCEEDED     If locking succeeded.
+ *  \retval         !OS_HAL_SPINLOCKSUCCEEDED    If locking failed.
+ *
+ *  \context        OS_INTERNAL
+ *
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *
+ *  \pre            Spinlock uses OS_SPINLOCKALGORITHM_MCS.
+ *  \pre            No other thread of the current core waits for or holds the spinlock.
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE Os_Hal_SpinlockResultType, OS_CODE, OS_ALWAYS_INLINE,
+Os_SpinlockMcsTryLock,
+(
+  P2CONST(Os_SpinlockConfigType, AUTOMATIC, OS_CONST) Spinlock
+));
+
+
+/***********************************************************************************************************************
+ *  Os_SpinlockMcsLock()
+ **********************************************************************************************************************/
+/*! \brief          Appends the node of the current core to the MCS queue and waits for the grant.
+ *  \details        While waiting, the current core only reads its own node.
+ *
+ *  \param[in,out]  Spinlock  The spinlock. Parameter must not be NULL.
+ *
+ *  \retval         0    The lock has been granted without waiting.
+ *  \retval         !0   The lock has been held or requested by another core.
+ *
+ *  \context        OS_INTERNAL
+ *
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *
+ *  \pre            Spinlock uses OS_SPINLOCKALGORITHM_MCS.
+ *  \pre            No other thread of the current core waits for or holds the spinlock.
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE Os_StdReturnType, OS_CODE, OS_ALWAYS_INLINE,
+Os_SpinlockMcsLock,
+(
+  P2CONST(Os_SpinlockConfigType, AUTOMATIC, OS_CONST) Spinlock
+));
+
+
+/***********************************************************************************************************************
+ *  Os_SpinlockMcsUnlock()
+ **********************************************************************************************************************/
+/*! \brief          Passes the MCS lock to the next waiter or frees it.
+ *  \details        The node of the lock holder is used, so the lock may also be released on behalf of a killed holder.
+ *
+ *  \param[in,out]  Spinlock  The spinlock. Parameter must not be NULL.
+ *
+ *  \context        OS_INTERNAL
+ *
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *
+ *  \pre            Spinlock uses OS_SPINLOCKALGORITHM_MCS.
+ *  \pre            The spinlock is held.
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,
+Os_SpinlockMcsUnlock,
+(
+  P2CONST(Os_SpinlockConfigType, AUTOMATIC, OS_CONST) Spinlock
+));
+
+
+/***********************************************************************************************************************
+ *  Os_SpinlockAlgorithmTryLock()
+ **********************************************************************************************************************/
+/*! \brief          Tries once to lock the lock variable with the configured algorithm.
+ *  \details        Does neither set the owner nor inform the trace module.
+ *
+ *  \param[in,out]  Spinlock  The spinlock. Parameter must not be NULL.
+ *
+ *  \retval         OS_HAL_SPINLOCKSUCCEEDED     If locking succeeded.
+ *  \retval         !OS_HAL_SPINLOCKSUCCEEDED    If locking failed.
+ *
+ *  \context        OS_INTERNAL
+ *
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *
+ *  \pre            No other thread of the current core waits for or holds the spinlock.
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE Os_Hal_SpinlockResultType, OS_CODE, OS_ALWAYS_INLINE,
+Os_SpinlockAlgorithmTryLock,
+(
+  P2CONST(Os_SpinlockConfigType, AUTOMATIC, OS_CONST) Spinlock
+));
+
+
+/***********************************************************************************************************************
+ *  Os_SpinlockAlgorithmLock()
+ **********************************************************************************************************************/
+/*! \brief          Waits until the queue based lock variable is granted.
+ *  \details        Does neither set the owner nor inform the trace module.
+ *
+ *  \param[in,out]  Spinlock  The spinlock. Parameter must not be NULL.
+ *
+ *  \retval         0    The lock has been granted without waiting.
+ *  \retval         !0   The lock has been held or requested by another core.
+ *
+ *  \context        OS_INTERNAL
+ *
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *
+ *  \pre            Spinlock uses a queue based algorithm (not OS_SPINLOCKALGORITHM_TAS).
+ *  \pre            No other thread of the current core waits for or holds the spinlock.
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE Os_StdReturnType, OS_CODE, OS_ALWAYS_INLINE,
+Os_SpinlockAlgorithmLock,
+(
+  P2CONST(Os_SpinlockConfigType, AUTOMATIC, OS_CONST) Spinlock
+));
+
+
+/***********************************************************************************************************************
+ *  Os_SpinlockAlgorithmUnlock()
+ **********************************************************************************************************************/
+/*! \brief          Unlocks the lock variable with the configured algorithm.
+ *  \details        Does neither clear the owner nor inform the trace module.
+ *
+ *  \param[in,out]  Spinlock  The spinlock. Parameter must not be NULL.
+ *
+ *  \context        OS_INTERNAL
+ *
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *
+ *  \pre            The spinlock is held.
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,
+Os_SpinlockAlgorithmUnlock,
+(
+  P2CONST(Os_SpinlockConfigType, AUTOMATIC, OS_CONST) Spinlock
+));
+
+
+/***********************************************************************************************************************
+ *  Os_SpinlockStatisticsIsEnabled()
+ **********************************************************************************************************************/
+/*! \brief          Returns whether spinlock contention statistics are recorded.
+ *  \details        Returns current state of OS_CFG_SPINLOCK_STATISTICS.
+ *
+ *  \retval         0    Statistics are not recorded.
+ *  \retval         !0   Statistics are recorded.
+ *
+ *  \context        ANY
+ *
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *
+ *  \pre            -
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE Os_StdReturnType, OS_CODE,
+OS_ALWAYS_INLINE, Os_SpinlockStatisticsIsEnabled, (void));
+
+
+/***********************************************************************************************************************
+ *  Os_SpinlockStatisticsGetTime()
+ **********************************************************************************************************************/
+/*! \brief          Returns the current time stamp for the statistics of the given spinlock.
+ *  \details        Returns 0, if statistics are disabled.
+ *
+ *  \param[in]      Spinlock  The spinlock. Parameter must not be NULL.
+ *
+ *  \return         The counter value of the statistics timer.
+ *
+ *  \context        ANY
+ *
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *
+ *  \pre            -
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE Os_Hal_TimerFrtTickType, OS_CODE, OS_ALWAYS_INLINE,
+Os_SpinlockStatisticsGetTime,
+(
+  P2CONST(Os_SpinlockConfigType, AUTOMATIC, OS_CONST) Spinlock
+));
+
+
+/***********************************************************************************************************************
+ *  Os_SpinlockStatisticsTaken()
+ **********************************************************************************************************************/
+/*! \brief          Records a lock grant in the statistics of the current core.
+ *  \details        Updates the counters, the wait time histogram and the longest wait time and stores the time of the
+ *                  grant for the hold time. Does nothing, if statistics are disabled.
+ *
+ *  \param[in,out]  Spinlock      The spinlock. Parameter must not be NULL.
+ *  \param[in]      RequestTime   Time stamp of the lock request (see \ref Os_SpinlockStatisticsGetTime()).
+ *  \param[in]      Contended     Tells whether the spinlock has been found locked (!0) or not (0).
+ *
+ *  \context        OS_INTERNAL
+ *
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *
+ *  \pre            The spinlock is held by the current core.
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,
+Os_SpinlockStatisticsTaken,
+(
+  P2CONST(Os_SpinlockConfigType, AUTOMATIC, OS_CONST) Spinlock,
+  Os_Hal_TimerFrtTickType RequestTime,
+  Os_StdReturnType Contended
+));
+
+
+/***********************************************************************************************************************
+ *  Os_SpinlockStatisticsReleased()
+ **********************************************************************************************************************/
+/*! \brief          Records the hold time of a lock release in the statistics of the current core.
+ *  \details        Does nothing, if statistics are disabled.
+ *
+ *  \param[in,out]  Spinlock      The spinlock. Parameter must not be NULL.
+ *
+ *  \context        OS_INTERNAL
+ *
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *
+ *  \pre            The spinlock is still held by the current core.
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,
+Os_SpinlockStatisticsReleased,
+(
+  P2CONST(Os_SpinlockConfigType, AUTOMATIC, OS_CONST) Spinlock
+));
+
+
 /***********************************************************************************************************************
  *  Os_Api_GetSpinlock()
  **********************************************************************************************************************/
@@ -684,6 +1108,38 @@ FUNC(Os_StatusType, OS_CODE) Os_Api_TryToGetSpinlock
 );
 
 
+/***********************************************************************************************************************
+ *  Os_Api_GetSpinlockStatistics()
+ **********************************************************************************************************************/
+/*! \brief        OS service Os_GetSpinlockStatistics().
+ *  \details      For further details see Os_GetSpinlockStatistics().
+ *
+ *  \param[in]    SpinlockId        See Os_GetSpinlockStatistics().
+ *  \param[in]    CoreId            See Os_GetSpinlockStatistics().
+ *  \param[out]   Statistics        See Os_GetSpinlockStatistics().
+ *
+ *  \retval       OS_STATUS_OK                                      No error.
+ *  \retval       OS_STATUS_SPINLOCKSTATISTICS_DISABLED_BY_CONFIG   Statistics are not enabled in the configuration.
+ *  \retval       OS_STATUS_ID_1                                    (EXTENDED status:) Invalid SpinlockID.
+ *  \retval       OS_STATUS_ID_2                                    (EXTENDED status:) Invalid CoreID.
+ *  \retval       OS_STATUS_ACCESSRIGHTS_1                          (SERVICE protection:) The caller has no access to
+ *                                                                  the spinlock.
+ *
+ *  \context      TASK|ISR2
+ *
+ *  \reentrant    TRUE
+ *  \synchronous  TRUE
+ *
+ *  \pre          Statistics points to a writable object.
+ **********************************************************************************************************************/
+FUNC(Os_StatusType, OS_CODE) Os_Api_GetSpinlockStatistics
+(
+  SpinlockIdType SpinlockId,
+  CoreIdType CoreId,
+  Os_SpinlockStatisticsRefType Statistics
+);
+
+
 /***********************************************************************************************************************
  *  GLOBAL FUNCTIONS
  **********************************************************************************************************************/
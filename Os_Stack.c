@@ -49,6 +49,8 @@
 #include "Os_Hook.h"
 #include "Os_Application.h"
 #include "Os_ServiceFunction.h"
+#include "Os_Core.h"
+#include "Os_Interrupt.h"
 
 /* Os hal dependencies */
 
@@ -176,6 +178,51 @@ OS_ALWAYS_INLINE, Os_StackFill,
 ));
 
 
+/***********************************************************************************************************************
+ *  Os_StackMeasurementInit()
+ **********************************************************************************************************************/
+/*! \brief        Initializes the incremental stack usage measurement state of the given stack.
+ *  \details      The high-water mark is set behind the stack bottom (no usage) and the scan starts at the stack end.
+ *
+ *  \param[in]    Stack   The stack which shall be initialized. Parameter must not be NULL.
+ *
+ *  \context      OS_INTERNAL
+ *
+ *  \reentrant    TRUE for different stacks.
+ *  \synchronous  TRUE
+ *
+ *  \pre          Concurrent access to given object is prevented by caller.
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE void, OS_CODE,
+OS_ALWAYS_INLINE, Os_StackMeasurementInit,
+(
+  P2CONST(Os_StackConfigType, AUTOMATIC, OS_CONST) Stack
+));
+
+
+/***********************************************************************************************************************
+ *  Os_StackScanStep()
+ **********************************************************************************************************************/
+/*! \brief        Refines the high-water mark of the given stack by checking a bounded number of stack entries.
+ *  \details      At most OS_CFG_STACKMEASUREMENT_CHUNK entries are checked.
+ *
+ *  \param[in]    Stack   The stack to scan. Parameter must not be NULL.
+ *
+ *  \context      OS_INTERNAL
+ *
+ *  \reentrant    TRUE
+ *  \synchronous  TRUE
+ *
+ *  \pre          The given stack is assigned to the local core.
+ *  \pre          Incremental stack usage measurement is enabled.
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE void, OS_CODE,
+OS_ALWAYS_INLINE, Os_StackScanStep,
+(
+  P2CONST(Os_StackConfigType, AUTOMATIC, OS_CONST) Stack
+));
+
+
 /***********************************************************************************************************************
  *  Os_StackGetUsageLocal()
  **********************************************************************************************************************/
@@ -184,7 +231,8 @@ OS_ALWAYS_INLINE, Os_StackFill,
  *
  *  \param[in]    Stack           The stack to query. Parameter must not be NULL.
  *
- *  \return       Stack usage in bytes.
+ *  \return       Stack usage in bytes. If incremental stack usage measurement is enabled, the high-water mark found so
+ *                far, which may be lower than the actual usage until a complete pass has been made.
  *
  *  \context      OS_INTERNAL
  *
@@ -295,6 +343,91 @@ OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE, Os
 }
 
 
+/***********************************************************************************************************************
+ *  Os_StackMeasurementInit()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE, Os_StackMeasurementInit,
+(
+  P2CONST(Os_StackConfigType, AUTOMATIC, OS_CONST) Stack
+))
+{
+  if(Os_StackIsIncrementalMeasurementEnabled() != 0u)                                                                   /* PRQA S 2991, 2995 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule2.2_2995 */
+  {
+    P2VAR(Os_Hal_StackType, AUTOMATIC, OS_VAR_NOINIT) stackBottom;
+
+    /* #10 Set the high-water mark behind the stack bottom and start the scan at the stack end. */
+    stackBottom = Os_Hal_StackBottomGet(Stack->LowAddress, Stack->HighAddress);                                         /* SBSW_OS_ST_HAL_STACKBOTTOMGET_001 */
+    Stack->Dyn->HighWaterMark = Os_Hal_StackPointerMoveDown(stackBottom);                                               /* SBSW_OS_ST_STACK_DYN_001 */ /* SBSW_OS_ST_HAL_STACKPOINTERMOVEDOWN_001 */
+    Stack->Dyn->Cursor = Os_Hal_StackEndGet(Stack->LowAddress, Stack->HighAddress);                                     /* SBSW_OS_ST_STACK_DYN_001 */ /* SBSW_OS_ST_HAL_STACKENDGET_001 */
+  }
+}
+
+
+/***********************************************************************************************************************
+ *  Os_StackScanStep()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE, Os_StackScanStep,
+(
+  P2CONST(Os_StackConfigType, AUTOMATIC, OS_CONST) Stack
+))
+{
+  P2VAR(Os_Hal_StackType, AUTOMATIC, OS_VAR_NOINIT) stackEnd;
+  P2VAR(Os_Hal_StackType, AUTOMATIC, OS_VAR_NOINIT) cursor;
+  P2VAR(Os_Hal_StackType, AUTOMATIC, OS_VAR_NOINIT) highWaterMark;
+  Os_IntStateType intState;
+  uint32 remaining;
+
+  stackEnd = Os_Hal_StackEndGet(Stack->LowAddress, Stack->HighAddress);                                                 /* SBSW_OS_ST_HAL_STACKENDGET_001 */
+
+  /* #10 Prevent concurrent modification of the measurement state on the local core. */
+  Os_IntSuspend(&intState);                                                                                             /* SBSW_OS_FC_POINTER2LOCAL */
+
+  cursor = Stack->Dyn->Cursor;
+  highWaterMark = Stack->Dyn->HighWaterMark;
+
+  /* #20 Check at most OS_CFG_STACKMEASUREMENT_CHUNK entries between the stack end and the high-water mark. */
+  for(remaining = OS_CFG_STACKMEASUREMENT_CHUNK; (remaining > 0u) && (cursor != highWaterMark); remaining--)
+  {
+    /* #30 If the entry is used, it becomes the new high-water mark. Restart the pass at the stack end. */
+    if(*cursor != OS_HAL_STACK_FILL_PATTERN)
+    {
+      highWaterMark = cursor;
+      cursor = stackEnd;
+    }
+    /* #40 Otherwise continue with the next entry towards the stack bottom. */
+    else
+    {
+      cursor = Os_Hal_StackPointerMoveDown(cursor);                                                                     /* SBSW_OS_ST_HAL_STACKPOINTERMOVEDOWN_001 */
+    }
+  }
+
+  /* #50 If the pass has reached the high-water mark, start the next pass at the stack end. */
+  if(cursor == highWaterMark)
+  {
+    cursor = stackEnd;
+  }
+
+  Stack->Dyn->Cursor = cursor;                                                                                          /* SBSW_OS_ST_STACK_DYN_001 */
+  Stack->Dyn->HighWaterMark = highWaterMark;                                                                            /* SBSW_OS_ST_STACK_DYN_001 */
+
+  /* #60 Leave the critical section. */
+  Os_IntResume(&intState);                                                                                              /* SBSW_OS_FC_POINTER2LOCAL */
+}
+
+
 /***********************************************************************************************************************
  *  Os_StackGetUsage()
  **********************************************************************************************************************/
@@ -328,17 +461,27 @@ OS_LOCAL FUNC(uint32, OS_CODE) Os_StackGetUsageLocal
   /* The iteration is aborted after the bottom address has been checked. */
   iteratorEnd = Os_Hal_StackPointerMoveDown(iteratorEnd);                                                               /* SBSW_OS_ST_HAL_STACKPOINTERMOVEDOWN_001 */
 
-  /* #20 Iterate from the stack's top to the bottom, while the iterator dereferences to the stack fill pattern. */
-  while(iterator != iteratorEnd)
+  /* #17 If incremental measurement is enabled, refine and use the high-water mark. */
+  if(Os_StackIsIncrementalMeasurementEnabled() != 0u)                                                                   /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */
   {
-    if(*iterator == OS_HAL_STACK_FILL_PATTERN)
-    {
-      /* #30 Move the iterator one stack entry down. */
-      iterator = Os_Hal_StackPointerMoveDown(iterator);                                                                 /* SBSW_OS_ST_HAL_STACKPOINTERMOVEDOWN_001 */
-    }
-    else
+    Os_StackScanStep(Stack);                                                                                            /* SBSW_OS_FC_PRECONDITION */
+    iterator = Stack->Dyn->HighWaterMark;
+  }
+  else
+  {
+    /* #20 Otherwise iterate from the stack's top to the bottom, while the iterator dereferences to the stack fill
+     *     pattern. */
+    while(iterator != iteratorEnd)
     {
-      break;
+      if(*iterator == OS_HAL_STACK_FILL_PATTERN)
+      {
+        /* #30 Move the iterator one stack entry down. */
+        iterator = Os_Hal_StackPointerMoveDown(iterator);                                                               /* SBSW_OS_ST_HAL_STACKPOINTERMOVEDOWN_001 */
+      }
+      else
+      {
+        break;
+      }
     }
   }
 
@@ -369,6 +512,9 @@ FUNC(void, OS_CODE) Os_StackInitInternal
 
   /* #20 Initialize stack monitoring. */
   Os_StackMonitoringInit(Stack);                                                                                        /* SBSW_OS_FC_PRECONDITION */
+
+  /* #30 Initialize incremental stack usage measurement. */
+  Os_StackMeasurementInit(Stack);                                                                                       /* SBSW_OS_FC_PRECONDITION */
 }
 
 
@@ -1200,6 +1346,47 @@ FUNC(uint32, OS_CODE) Os_Api_GetNonTrustedFunctionStackUsage
 }                                                                                                                       /* PRQA S 6050 */ /* MD_MSR_STCAL */
 
 
+/***********************************************************************************************************************
+ *  Os_Api_ScanStackUsage()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ */
+FUNC(Os_StatusType, OS_CODE) Os_Api_ScanStackUsage
+(
+  void
+)
+{
+  Os_StatusType status;
+
+  /* #10 Perform error checks. */
+  if(Os_StackIsIncrementalMeasurementEnabled() == 0u)                                                                   /* PRQA S 2992, 2996 */ /* MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2996 */
+  {
+    status = OS_STATUS_STACKUSAGE_DISABLED_BY_CONFIG;
+  }
+  /* #20 Otherwise refine the high-water mark of each stack of the local core. */
+  else
+  {
+    P2CONST(Os_CoreAsrConfigType, AUTOMATIC, OS_CONST) core;
+    Os_ObjIdx_IteratorType stackIdx;
+
+    core = Os_Core2AsrCore(Os_CoreGetCurrentCore());                                                                    /* SBSW_OS_ST_CORE2ASRCORE_002 */
+
+    for(stackIdx = 0; stackIdx < (Os_ObjIdx_IteratorType)core->StackCount; ++stackIdx)
+    {
+      Os_StackScanStep(core->StackRefs[stackIdx]);                                                                      /* SBSW_OS_ST_STACKSCANSTEP_001 */
+    }
+
+    status = OS_STATUS_OK;
+  }
+
+  return status;
+}
+
+
 # define OS_STOP_SEC_CODE
 # include "Os_MemMap_OsCode.h"                                                                                          /* PRQA S 5087 */ /* MD_MSR_MemMap */
 
@@ -1406,6 +1593,22 @@ FUNC(uint32, OS_CODE) Os_Api_GetNonTrustedFunctionStackUsage
  \DESCRIPTION    Os_StackGetNonTrustedFunctionStackUsageLocal is called with the return value of Os_ServiceNtfId2Ntf.
  \COUNTERMEASURE \M [CM_OS_SERVICENTFID2NTF_M]
 
+\ID SBSW_OS_ST_STACK_DYN_001
+ \DESCRIPTION    Write access to the Dyn object of a stack. The stack is passed as argument to the caller function.
+                 Precondition ensures that the pointer is valid. The compliance of the precondition is check during
+                 review.
+ \COUNTERMEASURE \M [CM_OS_STACK_DYN_M]
+
+\ID SBSW_OS_ST_CORE2ASRCORE_002
+ \DESCRIPTION    Os_Core2AsrCore is called with the return value of Os_CoreGetCurrentCore.
+ \COUNTERMEASURE \S [CM_OS_COREGETCURRENTCORE_S]
+
+\ID SBSW_OS_ST_STACKSCANSTEP_001
+ \DESCRIPTION    Os_StackScanStep is called with an entry of StackRefs. The used StackRefs index is limited to
+                 StackCount. StackRefs is derived from a core object returned from Os_Core2AsrCore.
+ \COUNTERMEASURE \N [CM_OS_CORE2ASRCORE_N]
+                 \M [CM_OS_COREASR_STACKREFS_M]
+
 SBSW_JUSTIFICATION_END */
 
 /*
@@ -1417,6 +1620,10 @@ SBSW_JUSTIFICATION_END */
       Verify that the HighAddress of each Os_StackConfigType object is initialized with the macro
       OS_STACK_GETHIGHADDRESS and a non NULL_PTR.
 
+\CM CM_OS_STACK_DYN_M
+      Verify that the Dyn of each Os_StackConfigType object is a non NULL_PTR and is not shared with other stacks,
+      if incremental stack usage measurement is enabled.
+
 \CM CM_OS_HAL_STACKPOINTERMOVEDOWN_T
       TCASE-359605 ensures that returned pointer is in a valid range.
 
@@ -107,6 +107,17 @@ OS_ALWAYS_INLINE, Os_StackIsMonitoringEnabled, ( void ))
 }
 
 
+/***********************************************************************************************************************
+ *  Os_StackIsIncrementalMeasurementEnabled()
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE Os_StdReturnType, OS_CODE,                                                 /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+OS_ALWAYS_INLINE, Os_StackIsIncrementalMeasurementEnabled, ( void ))
+{
+  return (Os_StdReturnType)((OS_CFG_STACKMEASUREMENT == STD_ON)                                                         /* PRQA S 4304, 2995 */ /* MD_Os_C90BooleanCompatibility, MD_Os_Rule2.2_2995 */
+                         && (OS_CFG_STACKMEASUREMENT_INCREMENTAL == STD_ON));
+}
+
+
 /***********************************************************************************************************************
  *  Os_StackInit()
  **********************************************************************************************************************/
@@ -90,6 +90,16 @@
 #  define OS_CFG_STACKMODULE           STD_OFF
 # endif
 
+/*! Stack usage is not measured incrementally, unless enabled by the configuration. */
+# ifndef OS_CFG_STACKMEASUREMENT_INCREMENTAL
+#  define OS_CFG_STACKMEASUREMENT_INCREMENTAL  STD_OFF
+# endif
+
+/*! Number of stack entries, which are checked per stack and call in incremental stack usage measurement. */
+# ifndef OS_CFG_STACKMEASUREMENT_CHUNK
+#  define OS_CFG_STACKMEASUREMENT_CHUNK  (32u)
+# endif
+
 
 /***********************************************************************************************************************
  *  GLOBAL FUNCTION MACROS
@@ -101,6 +111,20 @@
  *  GLOBAL DATA TYPES AND STRUCTURES
  *********************************************************************************************************************/
 
+/*! Incremental stack usage measurement state.
+ *  The high-water mark is the stack entry nearest to the stack end, which has been found to be used so far. It only
+ *  moves towards the stack end. Each measurement step checks a bounded number of entries, starting at the stack end
+ *  and moving towards the high-water mark. If a used entry is found, it becomes the new high-water mark and the scan
+ *  restarts at the stack end. After a complete pass without findings, the high-water mark is exact. */
+struct Os_StackType_Tag
+{
+  /*! The high-water mark. Points behind the stack bottom, if no used entry has been found yet. */
+  P2VAR(Os_Hal_StackType, TYPEDEF, OS_VAR_NOINIT) HighWaterMark;
+  /*! The next entry to be checked. */
+  P2VAR(Os_Hal_StackType, TYPEDEF, OS_VAR_NOINIT) Cursor;
+};
+
+
 /*! General stack representation. */
 struct Os_StackConfigType_Tag
 {
@@ -108,6 +132,8 @@ struct Os_StackConfigType_Tag
   P2VAR(Os_Hal_StackType, TYPEDEF, OS_VAR_NOINIT) LowAddress;
   /*! Last writable address. */
   P2VAR(Os_Hal_StackType, TYPEDEF, OS_VAR_NOINIT) HighAddress;
+  /*! Incremental measurement state. Only valid, if incremental stack usage measurement is enabled. */
+  P2VAR(Os_StackType, TYPEDEF, OS_VAR_NOINIT) Dyn;
 };
 
 
@@ -183,6 +209,27 @@ OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE Os_StdReturnType, OS_CODE, OS_ALWA
 ( void ));
 
 
+/***********************************************************************************************************************
+ *  Os_StackIsIncrementalMeasurementEnabled()
+ **********************************************************************************************************************/
+/*! \brief        Returns whether incremental stack usage measurement is enabled or not.
+ *  \details      If enabled, stack usage queries return a cached high-water mark, which is refined by a bounded
+ *                number of checks per call, instead of scanning the whole stack.
+ *
+ *  \retval       !0    Incremental stack usage measurement is enabled.
+ *  \retval       0     Incremental stack usage measurement is disabled.
+ *
+ *  \context      OS_INTERNAL
+ *
+ *  \reentrant    TRUE
+ *  \synchronous  TRUE
+ *
+ *  \pre          -
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE Os_StdReturnType, OS_CODE, OS_ALWAYS_INLINE,
+Os_StackIsIncrementalMeasurementEnabled, ( void ));
+
+
 /***********************************************************************************************************************
  *  Os_StackInit()
  **********************************************************************************************************************/
@@ -453,6 +500,28 @@ FUNC(uint32, OS_CODE) Os_Api_GetNonTrustedFunctionStackUsage
 );
 
 
+/***********************************************************************************************************************
+ *  Os_Api_ScanStackUsage()
+ **********************************************************************************************************************/
+/*! \brief        OS service Os_ScanStackUsage().
+ *  \details      For further details see Os_ScanStackUsage().
+ *
+ *  \retval       OS_STATUS_OK                              No error.
+ *  \retval       OS_STATUS_STACKUSAGE_DISABLED_BY_CONFIG   Incremental stack usage measurement is not enabled.
+ *
+ *  \context      TASK|ISR2
+ *
+ *  \reentrant    TRUE
+ *  \synchronous  TRUE
+ *
+ *  \pre          -
+ **********************************************************************************************************************/
+FUNC(Os_StatusType, OS_CODE) Os_Api_ScanStackUsage
+(
+  void
+);
+
+
 /***********************************************************************************************************************
  *  Os_StackGetTaskStackUsageLocal()
  **********************************************************************************************************************/
@@ -139,6 +139,9 @@ StackLabel[(ByteSize + OS_HAL_STACK_GAP_SIZE)/sizeof(Os_Hal_StackType)]
 struct Os_StackConfigType_Tag;
 typedef struct Os_StackConfigType_Tag Os_StackConfigType;
 
+struct Os_StackType_Tag;
+typedef struct Os_StackType_Tag Os_StackType;
+
 
 /***********************************************************************************************************************
  *  GLOBAL DATA PROTOTYPES
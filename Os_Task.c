@@ -43,11 +43,14 @@
 # include "Os_Task_Lcfg.h"
 
 /* Os kernel module dependencies */
+# include "Os_AccessCheck.h"
 # include "Os_Application.h"
 # include "Os_Common.h"
 # include "Os_Core.h"
+# include "Os_Counter.h"
 # include "Os_Error.h"
 # include "Os_Interrupt.h"
+# include "Os_Job.h"
 # include "Os_Scheduler.h"
 # include "Os_Thread.h"
 # include "Os_Trace.h"
@@ -206,6 +209,83 @@ OS_LOCAL FUNC(void, OS_CODE) Os_TaskInternalInit
 );
 
 
+/***********************************************************************************************************************
+ *  Os_TaskEnqueueLocalTask()
+ **********************************************************************************************************************/
+/*! \brief          Checks and enqueues the given local task without updating the next task of the scheduler.
+ *  \details        If the task is enqueued and has a higher home priority than all tasks enqueued before within the
+ *                  given activation, it is remembered as the highest task of the activation.
+ *
+ *  \param[in,out]  Activation  The activation state. Parameter must not be NULL.
+ *  \param[in,out]  Task        The task which shall be activated. Parameter must not be NULL.
+ *
+ *  \retval         OS_STATUS_OK              No errors.<br>
+ *                                            Interarrival time not met.
+ *  \retval         OS_STATUS_LIMIT           Too many task activations.
+ *  \retval         OS_STATUS_NOTACCESSIBLE_1 (Service Protection:) Given object's owner application is not accessible.
+ *
+ *  \context        TASK|ISR2|OS_INTERNAL
+ *
+ *  \reentrant      TRUE for different tasks.
+ *  \synchronous    TRUE
+ *
+ *  \pre            Concurrent access to given object is prevented by caller.
+ *  \pre            The given task is assigned to the local core.
+ **********************************************************************************************************************/
+OS_LOCAL FUNC(Os_StatusType, OS_CODE) Os_TaskEnqueueLocalTask
+(
+  P2VAR(Os_TaskSetActivationType, AUTOMATIC, OS_VAR_NOINIT) Activation,
+  P2CONST(Os_TaskConfigType, AUTOMATIC, OS_CONST) Task
+);
+
+
+/***********************************************************************************************************************
+ *  Os_TaskDeadlineStart()
+ **********************************************************************************************************************/
+/*! \brief          Sets the absolute deadline of a new activation of the given task.
+ *  \details        The absolute deadline is the current value of the deadline counter plus the relative deadline.
+ *                  Nothing is done, if the task is not scheduled by earliest deadline first.
+ *
+ *  \param[in]      Task        The activated task. Parameter must not be NULL.
+ *
+ *  \context        OS_INTERNAL
+ *
+ *  \reentrant      TRUE for different tasks.
+ *  \synchronous    TRUE
+ *
+ *  \pre            Concurrent access to given object is prevented by caller.
+ *  \pre            The task is not part of the scheduler's data structures.
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE, Os_TaskDeadlineStart,
+(
+  P2CONST(Os_TaskConfigType, AUTOMATIC, OS_CONST) Task
+));
+
+
+/***********************************************************************************************************************
+ *  Os_TaskDeadlineCheck()
+ **********************************************************************************************************************/
+/*! \brief          Reports a protection error, if the current activation of the given task missed its deadline.
+ *  \details        The deadline is missed, if the deadline counter has reached the absolute deadline. The error is
+ *                  reported with E_OS_PROTECTION_TIME. Nothing is done, if the task is not scheduled by earliest
+ *                  deadline first.
+ *
+ *  \param[in]      Task        The terminating task. Parameter must not be NULL.
+ *
+ *  \context        OS_INTERNAL
+ *
+ *  \reentrant      TRUE for different tasks.
+ *  \synchronous    TRUE
+ *
+ *  \pre            Interrupts are disabled.
+ *  \pre            The given task is the current task.
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE, Os_TaskDeadlineCheck,
+(
+  P2CONST(Os_TaskConfigType, AUTOMATIC, OS_CONST) Task
+));
+
+
 /***********************************************************************************************************************
  *  LOCAL FUNCTIONS
  **********************************************************************************************************************/
@@ -304,6 +384,7 @@ OS_LOCAL FUNC(void, OS_CODE) Os_TaskInternalInit
   Os_Assert(Os_SchedulerPriorityIsHigherOrEqual(Os_TaskGetRunningPriority(Task), Os_TaskGetHomePriority(Task)));        /* SBSW_OS_FC_PRECONDITION */ /* SBSW_OS_FC_PRECONDITION */
   Os_Assert((Os_StdReturnType)(Os_TaskGetMaxActivations(Task) > 0u ));                                                  /* PRQA S 2812, 4304 */ /* MD_Os_Dir4.1_2812, MD_Os_C90BooleanCompatibility */ /* SBSW_OS_FC_PRECONDITION */
   Os_Assert((Os_StdReturnType)(Os_TaskGetDyn(Task) != NULL_PTR));                                                       /* PRQA S 4304 */ /* MD_Os_C90BooleanCompatibility */ /* SBSW_OS_FC_PRECONDITION */
+  Os_Assert(Os_AccessCheckIsSortingValid(Os_TaskGetAccessRights(Task)));                                                /* SBSW_OS_FC_PRECONDITION */ /* SBSW_OS_FC_PRECONDITION */
 
   /* #20 Initialize all task attributes and all its children. */
   Os_TaskGetDyn(Task)->ActivationsAllowed = Os_TaskGetMaxActivations(Task);                                             /* SBSW_OS_FC_PRECONDITION */ /* SBSW_OS_FC_PRECONDITION */ /* SBSW_OS_TASK_TASKGETDYN_002 */
@@ -317,11 +398,156 @@ OS_LOCAL FUNC(void, OS_CODE) Os_TaskInternalInit
 }                                                                                                                       /* PRQA S 6050 */ /* MD_MSR_STCAL */
 
 
+/***********************************************************************************************************************
+ *  Os_TaskEnqueueLocalTask()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ *
+ *
+ *
+ *
+ *
+ *
+ *
+ */
+OS_LOCAL FUNC(Os_StatusType, OS_CODE) Os_TaskEnqueueLocalTask
+(
+  P2VAR(Os_TaskSetActivationType, AUTOMATIC, OS_VAR_NOINIT) Activation,
+  P2CONST(Os_TaskConfigType, AUTOMATIC, OS_CONST) Task
+)
+{
+  Os_StatusType status;
+  P2CONST(Os_ThreadConfigType, AUTOMATIC, OS_CONST) taskThread;
+  P2CONST(Os_TpConfigType, TYPEDEF, OS_CONST) timingProtection;
+
+  taskThread = Os_TaskGetThread(Task);                                                                                  /* SBSW_OS_FC_PRECONDITION */
+  timingProtection = Os_CoreAsrGetTimingProtection(Os_ThreadGetCore(taskThread));                                       /* SBSW_OS_TASK_COREASRGETTIMINGPROTECTION_001 */ /* SBSW_OS_TASK_THREADGETCORE_002 */
+
+  /* #10 Check whether the given task's activation counter allows further activation. */
+  if(OS_UNLIKELY(Os_TaskCheckIsActivationAllowed(Task) == OS_CHECK_FAILED))                                             /* SBSW_OS_FC_PRECONDITION */
+  {
+    status = OS_STATUS_LIMIT;
+    /* #20 Inform the trace object about this. */
+    Os_TraceTaskActivateLimit(Os_ThreadGetTrace(taskThread));                                                           /* SBSW_OS_TASK_TRACETASKACTIVATELIMIT_001 */ /* SBSW_OS_TASK_THREADGETTRACE_001 */
+  }
+  /*  #30 Check whether the owner application of the given task is accessible. */
+  else if(OS_UNLIKELY(Os_AppCheckIsAccessible(Os_ThreadGetOwnerApplication(taskThread)) == OS_CHECK_FAILED))            /* SBSW_OS_TASK_APPCHECKISACCESSIBLE_001 */ /* SBSW_OS_TASK_THREADGETOWNERAPPLICATION_001 */
+  {
+    status = OS_STATUS_NOTACCESSIBLE_1;
+  }
+  /* #40 Check whether inter-arrival time is okay. */
+  else if(OS_UNLIKELY(Os_TpCheckInterArrival(timingProtection, Os_ThreadGetTpConfig(taskThread)) == OS_CHECK_FAILED))   /* SBSW_OS_TASK_TPCHECKINTERARRIVAL_001 */ /* SBSW_OS_TASK_THREADGETTPCONFIG_001 */ /* COV_OS_HALPLATFORMTPUNSUPPORTED_XF */ /* PRQA S 2992, 2996 */ /* MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2996 */
+  {
+    status = OS_STATUS_OK;
+  }
+  else
+  {
+    P2VAR(Os_TaskType, AUTOMATIC, OS_VAR_NOINIT) taskDyn;
+
+    taskDyn = Os_TaskGetDyn(Task);                                                                                      /* SBSW_OS_FC_PRECONDITION */
+    /* #50 Decrement the task's activation counter. */
+    --(taskDyn->ActivationsAllowed);                                                                                    /* SBSW_OS_TASK_TASKGETDYN_002 */
+
+    /* #60 Set the task's scheduling state to READY and start the deadline of the new activation. */
+    if(taskDyn->State == SUSPENDED)
+    {
+      Os_TaskSetState(Task, READY);                                                                                     /* SBSW_OS_FC_PRECONDITION */
+      Os_TaskDeadlineStart(Task);                                                                                       /* SBSW_OS_FC_PRECONDITION */
+    }
+
+    /* #70 Add the task to the scheduler's ready queue. */
+    Os_SchedulerEnqueue(Os_TaskGetScheduler(Task), Task);                                                               /* SBSW_OS_TASK_SCHEDULERENQUEUE_001 */ /* SBSW_OS_FC_PRECONDITION */
+
+    /* #80 Remember the task, if it has the highest home priority within the activation. */
+    if((Activation->Highest == NULL_PTR)
+       || (Os_SchedulerPriorityIsHigher(Os_TaskGetHomePriority(Task),                                                   /* SBSW_OS_FC_PRECONDITION */
+                                        Os_TaskGetHomePriority(Activation->Highest)) != 0u))                            /* SBSW_OS_TASK_TASKGETHOMEPRIORITY_001 */
+    {
+      Activation->Highest = Task;                                                                                       /* SBSW_OS_PWA_PRECONDITION */
+    }
+
+    /* #90 Inform the trace object */
+    Os_TraceTaskActivate(Os_ThreadGetTrace(taskThread));                                                                /* SBSW_OS_TASK_TRACETASKACTIVATE_001 */ /* SBSW_OS_TASK_THREADGETTRACE_001 */
+
+    status = OS_STATUS_OK;
+  }
+  /* #100 Return the activation status. */
+  return status;
+}                                                                                                                       /* PRQA S 6050 */ /* MD_MSR_STCAL */
+
+
 /***********************************************************************************************************************
  *  GLOBAL FUNCTIONS
  **********************************************************************************************************************/
 
 
+/***********************************************************************************************************************
+ *  Os_TaskDeadlineStart()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE, Os_TaskDeadlineStart,
+(
+  P2CONST(Os_TaskConfigType, AUTOMATIC, OS_CONST) Task
+))
+{
+  if(Os_SchedulerIsEdfEnabled() != 0u)                                                                                  /* PRQA S 2991, 2995 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule2.2_2995 */
+  {
+    P2CONST(Os_TaskDeadlineConfigType, AUTOMATIC, OS_CONST) deadline = Os_TaskGetDeadline(Task);                        /* SBSW_OS_FC_PRECONDITION */
+
+    /* #10 If the task is scheduled by earliest deadline first, set its deadline to mod(now + relative deadline). */
+    if(deadline != NULL_PTR)
+    {
+      Os_JobSetExpirationTimestamp(&(deadline->Job),                                                                    /* SBSW_OS_TASK_JOBSETEXPIRATIONTIMESTAMP_001 */
+                                   Os_CounterGetTimestamp(deadline->Job.Counter, deadline->RelativeDeadline));          /* SBSW_OS_TASK_COUNTERGETTIMESTAMP_001 */
+    }
+  }
+}
+
+
+/***********************************************************************************************************************
+ *  Os_TaskDeadlineCheck()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE, Os_TaskDeadlineCheck,
+(
+  P2CONST(Os_TaskConfigType, AUTOMATIC, OS_CONST) Task
+))
+{
+  if(Os_SchedulerIsEdfEnabled() != 0u)                                                                                  /* PRQA S 2991, 2995 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule2.2_2995 */
+  {
+    P2CONST(Os_TaskDeadlineConfigType, AUTOMATIC, OS_CONST) deadline = Os_TaskGetDeadline(Task);                        /* SBSW_OS_FC_PRECONDITION */
+
+    /* #10 If the task is scheduled by earliest deadline first: */
+    if(deadline != NULL_PTR)
+    {
+      Os_TickType now = Os_CounterGetTimestamp(deadline->Job.Counter, 0u);                                              /* SBSW_OS_TASK_COUNTERGETTIMESTAMP_001 */
+
+      /* #20 If the deadline is not in the future any more, report a protection error. This may kill the task. */
+      if(OS_UNLIKELY(Os_CounterIsFutureValue(deadline->Job.Counter,                                                     /* SBSW_OS_TASK_COUNTERGETTIMESTAMP_001 */
+                                             Os_JobGetExpirationTimestamp(&(deadline->Job)),
+                                             now) == 0u))
+      {
+        Os_ErrProtectionError(OS_STATUS_PROTECTION_TIME);
+      }
+    }
+  }
+}
+
+
 /***********************************************************************************************************************
  *  Os_Api_ActivateTask()
  **********************************************************************************************************************/
@@ -427,7 +653,7 @@ FUNC(Os_StatusType, OS_CODE) Os_Api_ActivateTask
 
 
 /***********************************************************************************************************************
- *  Os_TaskActivateLocalTask()
+ *  Os_Api_ActivateTaskSet()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -439,63 +665,198 @@ FUNC(Os_StatusType, OS_CODE) Os_Api_ActivateTask
  *
  *
  *
- *
- *
  */
-FUNC(Os_StatusType, OS_CODE) Os_TaskActivateLocalTask
+FUNC(Os_StatusType, OS_CODE) Os_Api_ActivateTaskSet
 (
-  P2CONST(Os_TaskConfigType, AUTOMATIC, OS_CONST) Task
+  Os_TaskSetIdType TaskSetID
 )
 {
   Os_StatusType status;
-  P2CONST(Os_ThreadConfigType, AUTOMATIC, OS_CONST) taskThread;
-  P2CONST(Os_TpConfigType, TYPEDEF, OS_CONST) timingProtection;
+  P2CONST(Os_ThreadConfigType, AUTOMATIC, OS_CONST) currentThread;
 
-  taskThread = Os_TaskGetThread(Task);                                                                                  /* SBSW_OS_FC_PRECONDITION */
-  timingProtection = Os_CoreAsrGetTimingProtection(Os_ThreadGetCore(taskThread));                                       /* SBSW_OS_TASK_COREASRGETTIMINGPROTECTION_001 */ /* SBSW_OS_TASK_THREADGETCORE_002 */
+  currentThread = Os_CoreGetThread();
 
-  /* #10 Check whether the given task's activation counter allows further activation. */
-  if(OS_UNLIKELY(Os_TaskCheckIsActivationAllowed(Task) == OS_CHECK_FAILED))                                             /* SBSW_OS_FC_PRECONDITION */
+  /* #10 Perform error checks. */
+  if(OS_UNLIKELY(Os_ThreadCheckCallContext(currentThread, OS_APICONTEXT_ACTIVATETASK) == OS_CHECK_FAILED))              /* SBSW_OS_TASK_THREADCHECKCALLCONTEXT_001 */
   {
-    status = OS_STATUS_LIMIT;
-    /* #20 Inform the trace object about this. */
-    Os_TraceTaskActivateLimit(Os_ThreadGetTrace(taskThread));                                                           /* SBSW_OS_TASK_TRACETASKACTIVATELIMIT_001 */ /* SBSW_OS_TASK_THREADGETTRACE_001 */
+    status = OS_STATUS_CALLEVEL;
   }
-  /*  #30 Check whether the owner application of the given task is accessible. */
-  else if(OS_UNLIKELY(Os_AppCheckIsAccessible(Os_ThreadGetOwnerApplication(taskThread)) == OS_CHECK_FAILED))            /* SBSW_OS_TASK_APPCHECKISACCESSIBLE_001 */ /* SBSW_OS_TASK_THREADGETOWNERAPPLICATION_001 */
+  else if(OS_UNLIKELY(Os_TaskSetCheckId(TaskSetID) == OS_CHECK_FAILED))
   {
-    status = OS_STATUS_NOTACCESSIBLE_1;
+    status = OS_STATUS_ID_1;
   }
-  /* #40 Check whether inter-arrival time is okay. */
-  else if(OS_UNLIKELY(Os_TpCheckInterArrival(timingProtection, Os_ThreadGetTpConfig(taskThread)) == OS_CHECK_FAILED))   /* SBSW_OS_TASK_TPCHECKINTERARRIVAL_001 */ /* SBSW_OS_TASK_THREADGETTPCONFIG_001 */ /* COV_OS_HALPLATFORMTPUNSUPPORTED_XF */ /* PRQA S 2992, 2996 */ /* MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2996 */
+  else if(OS_UNLIKELY(Os_ThreadCheckAreInterruptsEnabled(currentThread) == OS_CHECK_FAILED))                            /* SBSW_OS_TASK_THREADCHECKAREINTERRUPTSENABLED_001 */
   {
-    status = OS_STATUS_OK;
+    status = OS_STATUS_DISABLEDINT;
   }
   else
   {
-    P2VAR(Os_TaskType, AUTOMATIC, OS_VAR_NOINIT) taskDyn;
+    P2CONST(Os_AppConfigType, TYPEDEF, OS_CONST) currentApplication;
+    P2CONST(Os_TaskSetConfigType, AUTOMATIC, OS_CONST) taskSet;
 
-    taskDyn = Os_TaskGetDyn(Task);                                                                                      /* SBSW_OS_FC_PRECONDITION */
-    /* #50 Decrement the task's activation counter. */
-    --(taskDyn->ActivationsAllowed);                                                                                    /* SBSW_OS_TASK_TASKGETDYN_002 */
+    taskSet = Os_TaskSetId2TaskSet(TaskSetID);
+    currentApplication = Os_ThreadGetCurrentApplication(currentThread);                                                 /* SBSW_OS_TASK_THREADGETCURRENTAPPLICATION_001 */
 
-    /* #60 Set the task's scheduling state to READY. */
-    if(taskDyn->State == SUSPENDED)
+    /* #20 Check the access rights once for the whole set. */
+    if(OS_UNLIKELY(Os_AppCheckAccess(currentApplication, taskSet->AccessingApplications) == OS_CHECK_FAILED))           /* SBSW_OS_TASK_APPCHECKACCESS_001 */
     {
-      Os_TaskSetState(Task, READY);                                                                                     /* SBSW_OS_FC_PRECONDITION */
+      status = OS_STATUS_ACCESSRIGHTS_1;
     }
+    else
+    {
+      Os_TaskSetActivationType activation;
+      Os_IntStateType interruptState;
+      uint32 taskIdx;
 
-    /* #70 Tell the scheduler to schedule the task. */
-    Os_SchedulerInsert(Os_TaskGetScheduler(Task), Task);                                                                /* SBSW_OS_TASK_SCHEDULERINSERT_001 */ /* SBSW_OS_FC_PRECONDITION */
+      status = OS_STATUS_OK;
 
-    /* #80 Inform the trace object */
-    Os_TraceTaskActivate(Os_ThreadGetTrace(taskThread));                                                                /* SBSW_OS_TASK_TRACETASKACTIVATE_001 */ /* SBSW_OS_TASK_THREADGETTRACE_001 */
+      /* #30 Suspend interrupts. */
+      Os_IntSuspend(&interruptState);                                                                                   /* SBSW_OS_FC_POINTER2LOCAL */
 
-    status = OS_STATUS_OK;
+      /* #40 Activate all tasks of the set. Keep the first error. */
+      Os_TaskActivateSetBegin(&activation);                                                                             /* SBSW_OS_FC_POINTER2LOCAL */
+      for(taskIdx = 0u; taskIdx < taskSet->TaskCount; taskIdx++)
+      {
+        Os_StatusType taskStatus;
+
+        taskStatus = Os_TaskActivateSetMember(&activation, taskSet->Tasks[taskIdx]);                                    /* SBSW_OS_TASK_TASKACTIVATESETMEMBER_001 */
+        if(status == OS_STATUS_OK)
+        {
+          status = taskStatus;
+        }
+      }
+
+      /* #50 Take the scheduling decision once. */
+      Os_TaskActivateSetEnd(&activation);                                                                               /* SBSW_OS_FC_POINTER2LOCAL */
+
+      /* #60 If the caller is a task and the activation leads to a task switch, perform the task switch. */
+      if(Os_ThreadIsTask(currentThread) != 0u)                                                                          /* SBSW_OS_TASK_THREADISTASK_001 */
+      {
+        P2CONST(Os_CoreAsrConfigType, AUTOMATIC, OS_CONST) localCore = Os_ThreadGetCore(currentThread);                 /* SBSW_OS_TASK_THREADGETCORE_001 */
+        P2CONST(Os_SchedulerConfigType, AUTOMATIC, OS_CONST) scheduler = Os_CoreGetScheduler(localCore);                /* SBSW_OS_TASK_COREGETSCHEDULER_001 */
+
+        if(Os_SchedulerTaskSwitchIsNeeded(scheduler) != 0u)                                                             /* SBSW_OS_TASK_SCHEDULERTASKSWITCHISNEEDED_001 */
+        {
+          Os_TaskSwitch(scheduler, currentThread);                                                                      /* SBSW_OS_TASK_TASKSWITCH_001 */
+        }
+      }
+
+      /* #70 Resume interrupts. */
+      Os_IntResume(&interruptState);                                                                                    /* SBSW_OS_FC_POINTER2LOCAL */
+    }
   }
-  /* #90 Return whether a task switch is needed. */
+
   return status;
-}                                                                                                                       /* PRQA S 6050 */ /* MD_MSR_STCAL */
+}                                                                                                                       /* PRQA S 6050, 6080 */ /* MD_MSR_STCAL, MD_MSR_STMIF */
+
+
+/***********************************************************************************************************************
+ *  Os_TaskActivateLocalTask()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ */
+FUNC(Os_StatusType, OS_CODE) Os_TaskActivateLocalTask
+(
+  P2CONST(Os_TaskConfigType, AUTOMATIC, OS_CONST) Task
+)
+{
+  Os_StatusType status;
+  Os_TaskSetActivationType activation;
+
+  activation.Highest = NULL_PTR;
+
+  /* #10 Check and enqueue the given task. */
+  status = Os_TaskEnqueueLocalTask(&activation, Task);                                                                  /* SBSW_OS_FC_POINTER2LOCAL */ /* SBSW_OS_FC_PRECONDITION */
+
+  /* #20 If the task has been enqueued, update the next task of the scheduler. */
+  if(activation.Highest != NULL_PTR)
+  {
+    Os_SchedulerSelect(Os_TaskGetScheduler(Task), Task);                                                                /* SBSW_OS_TASK_SCHEDULERSELECT_001 */ /* SBSW_OS_FC_PRECONDITION */
+  }
+
+  return status;
+}
+
+
+/***********************************************************************************************************************
+ *  Os_TaskActivateSetBegin()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ */
+FUNC(void, OS_CODE) Os_TaskActivateSetBegin
+(
+  P2VAR(Os_TaskSetActivationType, AUTOMATIC, OS_VAR_NOINIT) Activation
+)
+{
+  /* #10 No task has been enqueued yet. */
+  Activation->Highest = NULL_PTR;                                                                                       /* SBSW_OS_PWA_PRECONDITION */
+
+  /* #20 Collect activation requests to foreign cores. */
+  Os_XSigBatchBegin(Os_CoreGetThread());                                                                                /* SBSW_OS_TASK_XSIGBATCH_001 */
+}
+
+
+/***********************************************************************************************************************
+ *  Os_TaskActivateSetMember()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ */
+FUNC(Os_StatusType, OS_CODE) Os_TaskActivateSetMember
+(
+  P2VAR(Os_TaskSetActivationType, AUTOMATIC, OS_VAR_NOINIT) Activation,
+  P2CONST(Os_TaskConfigType, AUTOMATIC, OS_CONST) Task
+)
+{
+  Os_StatusType status;
+
+  /* #10 If the given task belongs to the local core, enqueue it. */
+  if(OS_LIKELY(Os_TaskIsCoreLocal(Task) != 0u))                                                                         /* SBSW_OS_FC_PRECONDITION */ /* COV_OS_HALPLATFORMMULTICOREUNSUPPORTED */ /* PRQA S 2991, 2995 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule2.2_2995 */
+  {
+    status = Os_TaskEnqueueLocalTask(Activation, Task);                                                                 /* SBSW_OS_FC_PRECONDITION */ /* SBSW_OS_FC_PRECONDITION */
+  }
+  /* #20 Otherwise, send an asynchronous activation request to the responsible core. */
+  else
+  {
+    status = Os_XSigSend_ActivateTaskAsync(Os_TaskGetCore(Task), Os_CoreGetThread(), Os_TaskGetId(Task));               /* SBSW_OS_FC_PRECONDITION */ /* SBSW_OS_TASK_XSIGSEND_001 */ /* SBSW_OS_FC_PRECONDITION */
+  }
+
+  return status;
+}
+
+
+/***********************************************************************************************************************
+ *  Os_TaskActivateSetEnd()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ */
+FUNC(void, OS_CODE) Os_TaskActivateSetEnd
+(
+  P2CONST(Os_TaskSetActivationType, AUTOMATIC, OS_VAR_NOINIT) Activation
+)
+{
+  /* #10 Take the scheduling decision once for all enqueued tasks. */
+  if(Activation->Highest != NULL_PTR)
+  {
+    Os_SchedulerSelect(Os_TaskGetScheduler(Activation->Highest), Activation->Highest);                                  /* SBSW_OS_TASK_SCHEDULERSELECT_002 */ /* SBSW_OS_TASK_TASKGETSCHEDULER_003 */
+  }
+
+  /* #20 Signal the collected requests to foreign cores. */
+  Os_XSigBatchFlush(Os_CoreGetThread());                                                                                /* SBSW_OS_TASK_XSIGBATCH_001 */
+}
 
 
 /***********************************************************************************************************************
@@ -536,8 +897,9 @@ FUNC(Os_StatusType, OS_CODE) Os_TaskActivateRestartTask
     /* #30 Decrement the task's activation counter. */
     Os_TaskGetDyn(Task)->ActivationsAllowed--;                                                                          /* PRQA S 3387 */ /* MD_Os_Rule13.3_3387 */ /* SBSW_OS_FC_PRECONDITION */ /* SBSW_OS_TASK_TASKGETDYN_002 */
 
-    /* #40 Set the task's scheduling state to READY. */
+    /* #40 Set the task's scheduling state to READY and start the deadline of the new activation. */
     Os_TaskSetState(Task, READY);                                                                                       /* SBSW_OS_FC_PRECONDITION */
+    Os_TaskDeadlineStart(Task);                                                                                         /* SBSW_OS_FC_PRECONDITION */
 
     /* #50 Tell the scheduler to schedule the task. */
     Os_SchedulerInsert(Os_TaskGetScheduler(Task), Task);                                                                /* SBSW_OS_TASK_SCHEDULERINSERT_001 */ /* SBSW_OS_FC_PRECONDITION */
@@ -597,6 +959,9 @@ FUNC(Os_StatusType, OS_CODE) Os_Api_TerminateTask(void)
     /* #20 Disable interrupts. */
     Os_IntDisable();
 
+    /* #25 Report a missed deadline. */
+    Os_TaskDeadlineCheck(currentTask);                                                                                  /* SBSW_OS_TASK_TASKDEADLINE_001 */
+
     /* #30 Reset the current task for the next time. */
     Os_TaskGetDyn(currentTask)->ActivationsAllowed++;                                                                   /* PRQA S 3387 */ /* MD_Os_Rule13.3_3387 */ /* SBSW_OS_TASK_TASKGETDYN_003 */ /* SBSW_OS_TASK_TASKGETDYN_002 */
     Os_TaskReset(currentTask);                                                                                          /* SBSW_OS_TASK_TASKRESET_001 */
@@ -712,6 +1077,9 @@ FUNC(Os_StatusType, OS_CODE) Os_Api_ChainTask
         /* #30 Suspend interrupts. */
         Os_IntSuspend(&interruptState);                                                                                 /* SBSW_OS_FC_POINTER2LOCAL */
 
+        /* #35 Report a missed deadline of the terminating activation. */
+        Os_TaskDeadlineCheck(currentTask);                                                                              /* SBSW_OS_TASK_TASKDEADLINE_001 */
+
         /* #40 In case of arrival time violation. */
         if(OS_UNLIKELY(Os_TpCheckInterArrival(timingProtection, Os_ThreadGetTpConfig(currentThread)                     /* SBSW_OS_TASK_TPCHECKINTERARRIVAL_001 */ /* SBSW_OS_TASK_THREADGETTPCONFIG_001 */ /* COV_OS_HALPLATFORMTPUNSUPPORTED_XF */ /* PRQA S 2992, 2996 */ /* MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2996 */
                                               ) == OS_CHECK_FAILED))
@@ -734,8 +1102,9 @@ FUNC(Os_StatusType, OS_CODE) Os_Api_ChainTask
           /* #90 Inform the trace object. */
           Os_TraceTaskActivate(Os_ThreadGetTrace(currentThread));                                                       /* SBSW_OS_TASK_TRACETASKACTIVATE_001 */ /* SBSW_OS_TASK_THREADGETTRACE_002 */
 
-          /* #100 Reset the task. */
+          /* #100 Reset the task and start the deadline of the new activation. */
           Os_TaskReset(currentTask);                                                                                    /* SBSW_OS_TASK_TASKRESET_001 */
+          Os_TaskDeadlineStart(currentTask);                                                                            /* SBSW_OS_TASK_TASKDEADLINE_001 */
 
           /* #110 Re-insert it to the scheduler. */
           /* Add the task to the scheduler on it's home priority. */
@@ -769,6 +1138,9 @@ FUNC(Os_StatusType, OS_CODE) Os_Api_ChainTask
 
         if(OS_LIKELY(status == OS_STATUS_OK))
         {
+          /* #185 Report a missed deadline. */
+          Os_TaskDeadlineCheck(currentTask);                                                                            /* SBSW_OS_TASK_TASKDEADLINE_001 */
+
           /* #190 Reset the current task for the next time. */
           Os_TaskGetDyn(currentTask)->ActivationsAllowed++;                                                             /* PRQA S 3387 */ /* MD_Os_Rule13.3_3387 */ /* SBSW_OS_TASK_TASKGETDYN_003 */ /* SBSW_OS_TASK_TASKGETDYN_002 */
           Os_TaskReset(currentTask);                                                                                    /* SBSW_OS_TASK_TASKRESET_001 */
@@ -912,6 +1284,9 @@ FUNC(void, OS_CODE) Os_TaskInit
     /* #30 If the given mode is one of the given task's autostart modes: */
     if((Task->AutostartModes & AppMode) != 0u)
     {
+      /* Tasks scheduled by earliest deadline first may not be autostarted, as the deadline counter is not running. */
+      Os_Assert((Os_StdReturnType)(Os_TaskGetDeadline(Task) == NULL_PTR));                                              /* PRQA S 4304 */ /* MD_Os_C90BooleanCompatibility */ /* SBSW_OS_FC_PRECONDITION */
+
       /* #40 Inform the trace object. */
       Os_TraceTaskActivate(Os_ThreadGetTrace(taskThread));                                                              /* SBSW_OS_TASK_TRACETASKACTIVATE_001 */ /* SBSW_OS_TASK_THREADGETTRACE_001 */
 
@@ -1179,6 +1554,86 @@ FUNC(Os_StatusType, OS_CODE) Os_Api_GetTaskState
 }                                                                                                                       /* PRQA S 6050, 6080 */ /* MD_MSR_STCAL, MD_MSR_STMIF */
 
 
+/***********************************************************************************************************************
+ *  Os_Api_GetTaskStateAsync()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ *
+ */
+FUNC(Os_StatusType, OS_CODE) Os_Api_GetTaskStateAsync
+(
+  TaskType TaskID,
+  EventMaskType Mask,
+  Os_AsyncCallRefType Call
+)
+{
+  Os_StatusType status;
+  P2CONST(Os_ThreadConfigType, AUTOMATIC, OS_CONST) currentThread;
+
+  currentThread = Os_CoreGetThread();                                                                                   /* PRQA S 1527 */ /* MD_Os_Rule5.9_1527 */
+
+  /* #10 Perform error checks. */
+  if(OS_UNLIKELY(Os_TaskCheckId(TaskID) == OS_CHECK_FAILED))
+  {
+    status = OS_STATUS_ID_1;
+  }
+  else if(OS_UNLIKELY(Os_ThreadCheckCallContext(currentThread, OS_APICONTEXT_GETTASKSTATE) == OS_CHECK_FAILED))         /* SBSW_OS_TASK_THREADCHECKCALLCONTEXT_001 */
+  {
+    status = OS_STATUS_CALLEVEL;
+  }
+  else if(OS_UNLIKELY(Os_ThreadCheckAreInterruptsEnabled(currentThread) == OS_CHECK_FAILED))                            /* SBSW_OS_TASK_THREADCHECKAREINTERRUPTSENABLED_001 */
+  {
+    status = OS_STATUS_DISABLEDINT;
+  }
+  else
+  {
+    P2CONST(Os_TaskConfigType, AUTOMATIC, OS_CONST) targetTask;
+    P2CONST(Os_AppConfigType, TYPEDEF, OS_CONST) currentApplication;
+    Os_AppAccessMaskType permittedApplications;
+
+    targetTask = Os_TaskId2Task(TaskID);
+
+    currentApplication = Os_ThreadGetCurrentApplication(currentThread);                                                 /* SBSW_OS_TASK_THREADGETCURRENTAPPLICATION_001 */
+    permittedApplications = Os_TaskGetAccessingApplications(targetTask);                                                /* SBSW_OS_TASK_TASKGETACCESSINGAPPLICATIONS_001 */
+
+    if( OS_UNLIKELY(Os_AppCheckAccess(currentApplication, permittedApplications) == OS_CHECK_FAILED) )                  /* SBSW_OS_TASK_APPCHECKACCESS_001 */
+    {
+      status = OS_STATUS_ACCESSRIGHTS_1;
+    }
+    else
+    {
+      status = Os_XSigCheckNotification(currentThread, Mask);                                                           /* SBSW_OS_TASK_XSIGCHECKNOTIFICATION_001 */
+    }
+
+    if(status == OS_STATUS_OK)
+    {
+      /* #20 If the task belongs to the local core, get the task state and complete the call immediately. */
+      if(OS_LIKELY(Os_TaskIsCoreLocal(targetTask) != 0u))                                                               /* SBSW_OS_TASK_TASKISCORELOCAL_001 */ /* COV_OS_HALPLATFORMMULTICOREUNSUPPORTED */ /* PRQA S 2991, 2995 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule2.2_2995 */
+      {
+        status = Os_TaskGetStateLocal(targetTask, &(Call->State));                                                      /* SBSW_OS_TASK_TASKGETSTATELOCAL_002 */
+
+        if(status == OS_STATUS_OK)
+        {
+          Os_XSigCompleteLocal(currentThread, Mask, Call);                                                              /* SBSW_OS_TASK_XSIGCOMPLETELOCAL_001 */
+        }
+      }
+      /* #30 Otherwise, send the request to the responsible core without waiting for the result. */
+      else
+      {
+        status = Os_XSigSendRequest_GetTaskState(Os_TaskGetCore(targetTask), currentThread, TaskID, Mask, Call);        /* SBSW_OS_TASK_XSIGSEND_002 */
+      }
+    }
+  }
+
+  return status;
+}                                                                                                                       /* PRQA S 6050, 6080 */ /* MD_MSR_STCAL, MD_MSR_STMIF */
+
+
 /***********************************************************************************************************************
  *  Os_TaskMissingTerminateTask()
  **********************************************************************************************************************/
@@ -1560,6 +2015,57 @@ FUNC(void, OS_CODE) Os_TaskCallPreTaskHook(void)
                  pointer is valid. The compliance of the precondition is check during review.
  \COUNTERMEASURE \M [CM_OS_TASKGETSCHEDULER_M]
 
+\ID SBSW_OS_TASK_SCHEDULERENQUEUE_001
+ \DESCRIPTION    Os_SchedulerEnqueue is called with the return value of Os_TaskGetScheduler and a value passed as
+                 argument to the caller function. Precondition ensures that the argument
+                 pointer is valid. The compliance of the precondition is check during review.
+ \COUNTERMEASURE \M [CM_OS_TASKGETSCHEDULER_M]
+
+\ID SBSW_OS_TASK_SCHEDULERSELECT_001
+ \DESCRIPTION    Os_SchedulerSelect is called with the return value of Os_TaskGetScheduler and a value passed as
+                 argument to the caller function. Precondition ensures that the argument
+                 pointer is valid. The compliance of the precondition is check during review.
+ \COUNTERMEASURE \M [CM_OS_TASKGETSCHEDULER_M]
+
+\ID SBSW_OS_TASK_SCHEDULERSELECT_002
+ \DESCRIPTION    Os_SchedulerSelect is called with the return value of Os_TaskGetScheduler and the highest task of
+                 an activation. The highest task is either NULL_PTR (checked before) or a task which has been passed
+                 to Os_TaskEnqueueLocalTask.
+ \COUNTERMEASURE \M [CM_OS_TASKGETSCHEDULER_M]
+
+\ID SBSW_OS_TASK_TASKGETSCHEDULER_003
+ \DESCRIPTION    Os_TaskGetScheduler is called with the highest task of an activation. The highest task is either
+                 NULL_PTR (checked before) or a task which has been passed to Os_TaskEnqueueLocalTask.
+ \COUNTERMEASURE \R [CM_OS_TASKACTIVATION_HIGHEST_R]
+
+\ID SBSW_OS_TASK_TASKGETHOMEPRIORITY_001
+ \DESCRIPTION    Os_TaskGetHomePriority is called with the highest task of an activation. The highest task is
+                 either NULL_PTR (checked before) or a task which has been passed to Os_TaskEnqueueLocalTask.
+ \COUNTERMEASURE \R [CM_OS_TASKACTIVATION_HIGHEST_R]
+
+\ID SBSW_OS_TASK_TASKACTIVATESETMEMBER_001
+ \DESCRIPTION    Os_TaskActivateSetMember is called with a pointer to a local variable and a task of the task set
+                 returned by Os_TaskSetId2TaskSet.
+ \COUNTERMEASURE \M [CM_OS_TASKSETID2TASKSET_M]
+
+\ID SBSW_OS_TASK_XSIGBATCH_001
+ \DESCRIPTION    An XSignal batch function is called with the return value of Os_CoreGetThread.
+ \COUNTERMEASURE \N [CM_OS_COREGETTHREAD_N]
+
+\ID SBSW_OS_TASK_TASKDEADLINE_001
+ \DESCRIPTION    A task deadline function is called with the return value of Os_TaskThread2Task.
+ \COUNTERMEASURE \R [CM_OS_TASKTHREAD2TASK_R]
+
+\ID SBSW_OS_TASK_JOBSETEXPIRATIONTIMESTAMP_001
+ \DESCRIPTION    Os_JobSetExpirationTimestamp is called with the job of the return value of Os_TaskGetDeadline. The
+                 deadline is checked against NULL_PTR before.
+ \COUNTERMEASURE \M [CM_OS_SCHEDULEREDF_M]
+
+\ID SBSW_OS_TASK_COUNTERGETTIMESTAMP_001
+ \DESCRIPTION    A counter function is called with the counter of the job of the return value of Os_TaskGetDeadline.
+                 The deadline is checked against NULL_PTR before.
+ \COUNTERMEASURE \M [CM_OS_SCHEDULEREDF_M]
+
 \ID SBSW_OS_TASK_SCHEDULERINSERT_002
  \DESCRIPTION    Os_SchedulerInsert is called with the return value of Os_TaskGetScheduler and the return value of
                  Os_TaskThread2Task.
@@ -1626,6 +2132,29 @@ FUNC(void, OS_CODE) Os_TaskCallPreTaskHook(void)
  \DESCRIPTION    Os_TaskIsCoreLocal is called with the return value of Os_TaskId2Task.
  \COUNTERMEASURE \M [CM_OS_TASKID2TASK_M]
 
+\ID SBSW_OS_TASK_XSIGCHECKNOTIFICATION_001
+ \DESCRIPTION    Os_XSigCheckNotification is called with the return value of Os_CoreGetThread.
+ \COUNTERMEASURE \N [CM_OS_COREGETTHREAD_N]
+
+\ID SBSW_OS_TASK_TASKGETSTATELOCAL_002
+ \DESCRIPTION    Os_TaskGetStateLocal is called with the return value of Os_TaskId2Task and a member of the call handle
+                 passed as argument to the caller function. Precondition ensures that the handle pointer is valid.
+                 The compliance of the precondition is check during review.
+ \COUNTERMEASURE \M [CM_OS_TASKID2TASK_M]
+
+\ID SBSW_OS_TASK_XSIGCOMPLETELOCAL_001
+ \DESCRIPTION    Os_XSigCompleteLocal is called with the return value of Os_CoreGetThread and a call handle passed as
+                 argument to the caller function. Precondition ensures that the handle pointer is valid.
+                 The compliance of the precondition is check during review.
+ \COUNTERMEASURE \N [CM_OS_COREGETTHREAD_N]
+
+\ID SBSW_OS_TASK_XSIGSEND_002
+ \DESCRIPTION    A cross core request function is called, with the return values of Os_TaskGetCore() and
+                 Os_CoreGetThread() and a call handle passed as argument to the caller function. Correctness of
+                 Os_CoreGetThread() and of the handle pointer is ensured by preconditions.
+                 The compliance of the precondition is check during review.
+ \COUNTERMEASURE \M [CM_OS_TASKGETCORE_M]
+
 \ID SBSW_OS_TASK_CORESETTHREAD_001
  \DESCRIPTION    Os_CoreSetThread is called with the return value of Os_CoreGetThread.
  \COUNTERMEASURE \N [CM_OS_COREGETTHREAD_N]
@@ -1643,6 +2172,18 @@ SBSW_JUSTIFICATION_END */
         2. the size of OsCfg_TaskRefs is equal to OS_TASKID_COUNT + 1 and
         3. each element in TaskType has a lower value than OS_TASKID_COUNT.
 
+\CM CM_OS_TASKSETID2TASKSET_M
+      Verify that:
+        1. each task set pointer in OsCfg_TaskSetRefs except the last is no NULL_PTR,
+        2. the size of OsCfg_TaskSetRefs is equal to OS_TASKSETID_COUNT + 1,
+        3. each element in Os_TaskSetIdType has a lower value than OS_TASKSETID_COUNT,
+        4. the Tasks array of each task set has TaskCount elements and
+        5. each element of the Tasks array is a non NULL_PTR task of OsCfg_TaskRefs.
+
+\CM CM_OS_TASKACTIVATION_HIGHEST_R
+      Os_TaskActivateSetBegin and Os_TaskActivateLocalTask initialize the highest task with NULL_PTR. Only
+      Os_TaskEnqueueLocalTask sets it, with the task passed as argument.
+
 \CM CM_OS_TASKGETTHREAD_N
       Precondition ensures that the pointer is valid. The compliance of the precondition is check during review.
 
@@ -105,6 +105,20 @@ P2CONST(Os_TaskConfigType, AUTOMATIC, OS_CONST), OS_CODE, OS_ALWAYS_INLINE, Os_T
 }
 
 
+/***********************************************************************************************************************
+ *  Os_TaskSetId2TaskSet()
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE                                                                            /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+P2CONST(Os_TaskSetConfigType, AUTOMATIC, OS_CONST), OS_CODE, OS_ALWAYS_INLINE, Os_TaskSetId2TaskSet,
+(
+  Os_TaskSetIdType TaskSetId
+))
+{
+  Os_Assert(Os_ErrIsValueLo((uint32)TaskSetId, (uint32)OS_TASKSETID_COUNT));
+  return OsCfg_TaskSetRefs[TaskSetId];                                                                                  /* PRQA S 2842 */ /* MD_Os_Rule18.1_2842 */
+}
+
+
 /***********************************************************************************************************************
  *  Os_TaskGetThread()
  **********************************************************************************************************************/
@@ -213,6 +227,20 @@ OS_ALWAYS_INLINE, Os_TaskGetHomePriority,
 }
 
 
+/***********************************************************************************************************************
+ *  Os_TaskGetDeadline()
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DEFINITION(                                                                                           /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+OS_LOCAL_INLINE P2CONST(Os_TaskDeadlineConfigType, AUTOMATIC, OS_CONST), OS_CODE, OS_ALWAYS_INLINE,
+Os_TaskGetDeadline,
+(
+  P2CONST(Os_TaskConfigType, AUTOMATIC, OS_CONST) Task
+))
+{
+  return Task->Deadline;
+}
+
+
 /***********************************************************************************************************************
  *  Os_TaskGetId()
  **********************************************************************************************************************/
@@ -315,6 +343,19 @@ OS_ALWAYS_INLINE, Os_TaskCheckId,
 }
 
 
+/***********************************************************************************************************************
+ *  Os_TaskSetCheckId()
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE Os_StdReturnType, OS_CODE,                                                 /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+OS_ALWAYS_INLINE, Os_TaskSetCheckId,
+(
+  Os_TaskSetIdType TaskSetId
+))
+{
+  return Os_ErrExtendedCheck(Os_ErrIsValueLo((uint32)TaskSetId, (uint32)OS_TASKSETID_COUNT));
+}
+
+
 /***********************************************************************************************************************
  *  Os_TaskCheckIsExtendedTask()
  **********************************************************************************************************************/
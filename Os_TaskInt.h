@@ -72,6 +72,7 @@
 # include "Os_EventInt.h"
 # include "Os_XSignalInt.h"
 # include "Os_AccessCheck_Types.h"
+# include "Os_JobInt.h"
 
 /* Os Hal dependencies */
 # include "Os_Hal_CompilerInt.h"
@@ -135,6 +136,26 @@ struct Os_TaskType_Tag
   uint32 NumRemainScheduleEventsRoundRobin;
 };
 
+/*! Deadline configuration of a task, which is scheduled by earliest deadline first.
+ * \details
+ * The expiration time stamp of the job holds the absolute deadline of the current activation. The job is never added
+ * to a counter. It is only used as element of the EDF ready queue of the scheduler, which is ordered by the
+ * expiration time stamps of its jobs.
+ * \extends Os_JobConfigType_Tag
+ */
+struct Os_TaskDeadlineConfigType_Tag
+{
+  /*! The job, which holds the absolute deadline. Its counter is the deadline counter.
+   * This attribute must come first! */
+  Os_JobConfigType Job;
+
+  /*! The task, which owns this deadline. */
+  P2CONST(Os_TaskConfigType, AUTOMATIC, OS_CONST) Task;
+
+  /*! The deadline of each activation relative to the activation time in ticks of the deadline counter. */
+  Os_TickType RelativeDeadline;
+};
+
 /*! Configuration information of a task.
  * \details
  * The dynamic data pointer a task can be fetched with Os_TaskGetDyn().
@@ -177,8 +198,37 @@ struct Os_TaskConfigType_Tag
 
   /*! Tells whether the API function Schedule() may be called from the given task. */
   Os_TaskScheduleType Reschedule;
+
+  /*! The deadline of the task. NULL_PTR, if the task is not scheduled by earliest deadline first. */
+  P2CONST(Os_TaskDeadlineConfigType, AUTOMATIC, OS_CONST) Deadline;
+};
+
+/*! Configuration information of a task set.
+ * \details
+ * A task set is a group of tasks, which are activated together by one call. The tasks are sorted by descending home
+ * priority.
+ */
+struct Os_TaskSetConfigType_Tag
+{
+  /*! The tasks of this set. */
+  P2CONST(P2CONST(Os_TaskConfigType, AUTOMATIC, OS_CONST), AUTOMATIC, OS_CONST) Tasks;
+
+  /*! Number of tasks in Tasks. */
+  uint32 TaskCount;
+
+  /*! Applications which have access to all tasks of this set (intersection of the tasks' access masks). */
+  Os_AppAccessMaskType AccessingApplications;
 };
 
+/*! State of a running task set activation.
+ * \details
+ * A task set activation enqueues all local tasks first and updates the next task of the scheduler once at the end. */
+typedef struct
+{
+  /*! The enqueued local task with the highest home priority. NULL_PTR, if no local task has been enqueued. */
+  P2CONST(Os_TaskConfigType, AUTOMATIC, OS_CONST) Highest;
+} Os_TaskSetActivationType;
+
 
 /***********************************************************************************************************************
  *  GLOBAL DATA PROTOTYPES
@@ -236,6 +286,30 @@ OS_ALWAYS_INLINE, Os_TaskId2Task,
 ));
 
 
+/***********************************************************************************************************************
+ *  Os_TaskSetId2TaskSet()
+ **********************************************************************************************************************/
+/*! \brief          Returns the task set belonging to the given id.
+ *  \details        --no details--
+ *
+ *  \param[in]      TaskSetId     The id of the searched task set. Parameter must be < OS_TASKSETID_COUNT.
+ *
+ *  \return         The task set belonging to the given id.
+ *
+ *  \context        ANY
+ *
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *
+ *  \pre            -
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE P2CONST(Os_TaskSetConfigType, AUTOMATIC, OS_CONST), OS_CODE,
+OS_ALWAYS_INLINE, Os_TaskSetId2TaskSet,
+(
+  Os_TaskSetIdType TaskSetId
+));
+
+
 /***********************************************************************************************************************
  *  Os_TaskGetThread()
  **********************************************************************************************************************/
@@ -423,6 +497,31 @@ OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE Os_TaskPrioType, OS_CODE, OS_ALWAY
 ));
 
 
+/***********************************************************************************************************************
+ *  Os_TaskGetDeadline()
+ **********************************************************************************************************************/
+/*! \brief          Returns the deadline configuration of a task.
+ *  \details        --no details--
+ *
+ *  \param[in]      Task        Task to query. Parameter must not be NULL.
+ *
+ *  \return         Deadline configuration of the task.
+ *  \retval         NULL_PTR    The task is not scheduled by earliest deadline first.
+ *
+ *  \context        ANY
+ *
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *
+ *  \pre            -
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE P2CONST(Os_TaskDeadlineConfigType, AUTOMATIC, OS_CONST), OS_CODE,
+OS_ALWAYS_INLINE, Os_TaskGetDeadline,
+(
+  P2CONST(Os_TaskConfigType, AUTOMATIC, OS_CONST) Task
+));
+
+
 /***********************************************************************************************************************
  *  Os_TaskGetId()
  **********************************************************************************************************************/
@@ -614,6 +713,31 @@ OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE Os_StdReturnType, OS_CODE, OS_ALWA
 ));
 
 
+/***********************************************************************************************************************
+ *  Os_TaskSetCheckId()
+ **********************************************************************************************************************/
+/*! \brief          Returns whether the given task set ID is valid (Not OS_CHECK_FAILED) or not (OS_CHECK_FAILED).
+ *  \details        In case that extended checks are disabled, the default result of \ref Os_ErrExtendedCheck() is
+ *                  returned.
+ *
+ *  \param[in]      TaskSetId     The ID to check.
+ *
+ *  \retval         Not OS_CHECK_FAILED   If the given ID is valid.
+ *  \retval         OS_CHECK_FAILED       If the given ID is not valid.
+ *
+ *  \context        ANY
+ *
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *
+ *  \pre            -
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE Os_StdReturnType, OS_CODE, OS_ALWAYS_INLINE, Os_TaskSetCheckId,
+(
+  Os_TaskSetIdType TaskSetId
+));
+
+
 /***********************************************************************************************************************
  *  Os_TaskCheckIsExtendedTask()
  **********************************************************************************************************************/
@@ -753,6 +877,86 @@ FUNC(Os_StatusType, OS_CODE) Os_TaskActivateLocalTask
 );
 
 
+/***********************************************************************************************************************
+ *  Os_TaskActivateSetBegin()
+ **********************************************************************************************************************/
+/*! \brief          Starts the activation of a group of tasks.
+ *  \details        Tasks activated by Os_TaskActivateSetMember() are enqueued, but the scheduling decision is taken
+ *                  once by Os_TaskActivateSetEnd(). Activation requests to foreign cores are sent as one batch, which
+ *                  triggers each receiver core with its first request.
+ *
+ *  \param[out]     Activation  The activation state to initialize. Parameter must not be NULL.
+ *
+ *  \context        TASK|ISR2|OS_INTERNAL
+ *
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *
+ *  \pre            Interrupts are disabled.
+ *  \pre            Each call is followed by a call of Os_TaskActivateSetEnd() with the same activation state.
+ **********************************************************************************************************************/
+FUNC(void, OS_CODE) Os_TaskActivateSetBegin
+(
+  P2VAR(Os_TaskSetActivationType, AUTOMATIC, OS_VAR_NOINIT) Activation
+);
+
+
+/***********************************************************************************************************************
+ *  Os_TaskActivateSetMember()
+ **********************************************************************************************************************/
+/*! \brief          Activates one task of a group of tasks.
+ *  \details        Performs the same checks as Os_TaskActivateTaskInternal(). A local task is enqueued without
+ *                  updating the next task of the scheduler. A foreign task is activated asynchronously: Only errors
+ *                  of sending the request are returned. Errors of the activation itself are reported later on the
+ *                  calling core, when the result of the request is handled.
+ *
+ *  \param[in,out]  Activation  The activation state. Parameter must not be NULL.
+ *  \param[in,out]  Task        The task which shall be activated. Parameter must not be NULL.
+ *
+ *  \retval         OS_STATUS_OK              No errors.<br>
+ *                                            Interarrival time not met.
+ *  \retval         OS_STATUS_LIMIT           Too many task activations.
+ *  \retval         OS_STATUS_NOTACCESSIBLE_1 (Service Protection:) Given object's owner application is not accessible.
+ *  \retval         Others                    See Os_XSigSend_ActivateTaskAsync().
+ *
+ *  \context        TASK|ISR2|OS_INTERNAL
+ *
+ *  \reentrant      TRUE for different tasks.
+ *  \synchronous    TRUE, if the given task belongs to the local core.
+ *
+ *  \pre            Interrupts are disabled.
+ *  \pre            The activation has been started by Os_TaskActivateSetBegin().
+ **********************************************************************************************************************/
+FUNC(Os_StatusType, OS_CODE) Os_TaskActivateSetMember
+(
+  P2VAR(Os_TaskSetActivationType, AUTOMATIC, OS_VAR_NOINIT) Activation,
+  P2CONST(Os_TaskConfigType, AUTOMATIC, OS_CONST) Task
+);
+
+
+/***********************************************************************************************************************
+ *  Os_TaskActivateSetEnd()
+ **********************************************************************************************************************/
+/*! \brief          Finishes the activation of a group of tasks.
+ *  \details        Updates the next task of the scheduler once and signals the batched requests to foreign cores.
+ *                  The caller is responsible to perform a task switch, if needed.
+ *
+ *  \param[in]      Activation  The activation state. Parameter must not be NULL.
+ *
+ *  \context        TASK|ISR2|OS_INTERNAL
+ *
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *
+ *  \pre            Interrupts are disabled.
+ *  \pre            The activation has been started by Os_TaskActivateSetBegin().
+ **********************************************************************************************************************/
+FUNC(void, OS_CODE) Os_TaskActivateSetEnd
+(
+  P2CONST(Os_TaskSetActivationType, AUTOMATIC, OS_VAR_NOINIT) Activation
+);
+
+
 /***********************************************************************************************************************
  *  Os_TaskActivateRestartTask()
  **********************************************************************************************************************/
@@ -1351,6 +1555,33 @@ OS_FUNC_ATTRIBUTE_DECLARATION(void, OS_CODE, OS_NORETURN, Os_TaskMissingTerminat
 FUNC(Os_StatusType, OS_CODE) Os_Api_ActivateTask(TaskType TaskID);
 
 
+/***********************************************************************************************************************
+ *  Os_Api_ActivateTaskSet()
+ **********************************************************************************************************************/
+/*! \brief        OS service Os_ActivateTaskSet().
+ *  \details      For further details see Os_ActivateTaskSet().
+ *
+ *  \param[in]    TaskSetID         See Os_ActivateTaskSet()
+ *
+ *  \retval       OS_STATUS_OK              No error.
+ *  \retval       OS_STATUS_LIMIT           Too many task activations of at least one task.
+ *  \retval       OS_STATUS_ID_1            (EXTENDED status:) Invalid TaskSetID.
+ *  \retval       OS_STATUS_CALLEVEL        (EXTENDED status:) Called from invalid context.
+ *  \retval       OS_STATUS_DISABLEDINT     (Service Protection:) Caller is in interrupt API sequence.
+ *  \retval       OS_STATUS_ACCESSRIGHTS_1  (Service Protection:) Caller's access rights are not sufficient.
+ *  \retval       OS_STATUS_NOTACCESSIBLE_1 (Service Protection:) Owner application of at least one task is not
+ *                                          accessible.
+ *
+ *  \context      TASK|ISR2
+ *
+ *  \reentrant    TRUE
+ *  \synchronous  TRUE, if all tasks of the set belong to the local core.
+ *
+ *  \pre          See Os_ActivateTaskSet().
+ **********************************************************************************************************************/
+FUNC(Os_StatusType, OS_CODE) Os_Api_ActivateTaskSet(Os_TaskSetIdType TaskSetID);
+
+
 /***********************************************************************************************************************
  *  Os_Api_TerminateTask()
  **********************************************************************************************************************/
@@ -1491,6 +1722,34 @@ FUNC(Os_StatusType, OS_CODE) Os_Api_GetTaskID(TaskRefType TaskID);
 FUNC(Os_StatusType, OS_CODE) Os_Api_GetTaskState(TaskType TaskID, TaskStateRefType State);
 
 
+/***********************************************************************************************************************
+ *  Os_Api_GetTaskStateAsync()
+ **********************************************************************************************************************/
+/*! \brief        OS service Os_GetTaskStateAsync().
+ *  \details      For further details see Os_GetTaskStateAsync().
+ *
+ *  \param[in]    TaskID          See Os_GetTaskStateAsync().
+ *  \param[in]    Mask            See Os_GetTaskStateAsync().
+ *  \param[out]   Call            See Os_GetTaskStateAsync().
+ *
+ *  \retval       OS_STATUS_OK              No error.
+ *  \retval       OS_STATUS_CALLEVEL        (EXTENDED status:) Called from invalid context.
+ *  \retval       OS_STATUS_ID_1            (EXTENDED status:) Invalid TaskID.
+ *  \retval       OS_STATUS_DISABLEDINT     (Service Protection:) Caller is in interrupt API sequence.
+ *  \retval       OS_STATUS_ACCESSRIGHTS_1  (Service Protection:) Caller's access rights are not sufficient.
+ *  \retval       OS_STATUS_NOEXTENDEDTASK_CALLER  A notification is requested, but the caller is no extended task.
+ *  \retval       other                     See \ref Os_XSigSendRequest().
+ *
+ *  \context      TASK|ISR2|ERRHOOK|PRETHOOK|POSTTHOOK
+ *
+ *  \reentrant    TRUE
+ *  \synchronous  TRUE
+ *
+ *  \pre          Supervisor mode.
+ **********************************************************************************************************************/
+FUNC(Os_StatusType, OS_CODE) Os_Api_GetTaskStateAsync(TaskType TaskID, EventMaskType Mask, Os_AsyncCallRefType Call);
+
+
 # define OS_STOP_SEC_CODE
 # include "Os_MemMap_OsCode.h"                                                                                          /* PRQA S 5087 */ /* MD_MSR_MemMap */
 
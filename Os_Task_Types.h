@@ -53,6 +53,8 @@
  **********************************************************************************************************************/
 struct Os_TaskType_Tag;
 struct Os_TaskConfigType_Tag;
+struct Os_TaskSetConfigType_Tag;
+struct Os_TaskDeadlineConfigType_Tag;
 
 /*! Dynamic management information of a task */
 typedef struct Os_TaskType_Tag Os_TaskType;
@@ -60,6 +62,12 @@ typedef struct Os_TaskType_Tag Os_TaskType;
 /*! Configuration information of a task. */
 typedef struct Os_TaskConfigType_Tag Os_TaskConfigType;
 
+/*! Configuration information of a task set. */
+typedef struct Os_TaskSetConfigType_Tag Os_TaskSetConfigType;
+
+/*! Deadline configuration of a task, which is scheduled by earliest deadline first. */
+typedef struct Os_TaskDeadlineConfigType_Tag Os_TaskDeadlineConfigType;
+
 /*! Function pointer data type for task user function callbacks. */
 typedef P2FUNC(void, OS_CODE, Os_TaskVoidTaskCbkType)(void);
 
@@ -251,24 +251,31 @@ OS_FUNC_ATTRIBUTE_DEFINITION(void, OS_CODE, OS_NORETURN, Os_ThreadSuicide, (void
                  \M [CM_OS_THREADGETMPACCESSRIGHTSINITIAL_M]
 
 \ID SBSW_OS_TRD_MPSWITCH_001
- \DESCRIPTION    Os_MpSwitch is called with the dynamic MpAccessRights data of two threads. The first thread is
-                 the return value of Os_CoreGetThread. Precondition ensures that the pointer
-                 returned by Os_CoreGetThread is valid. The second thread is passed as argument to the caller function.
-                 Precondition ensures that the argument pointer is valid. The compliance of the preconditions is check
-                 during review.
+ \DESCRIPTION    Os_MpSwitch is called with the active access rights of the core of the next thread and the dynamic
+                 MpAccessRights data of the next thread. The next thread is passed as argument to the caller function.
+                 Precondition ensures that the argument pointer is valid. The active access rights are returned by
+                 Os_CoreAsrGetMpActive for the core returned by Os_ThreadGetCore. The compliance of the preconditions
+                 is check during review.
  \COUNTERMEASURE \T [CM_OS_THREADGETMPACCESSRIGHTS_T]
+                 \M [CM_OS_THREADGETCORE_M]
 
 \ID SBSW_OS_TRD_MPSWITCH_002
- \DESCRIPTION    Os_MpSwitch is called with the dynamic MpAccessRights data of two threads. Both are passed as
-                 arguments to the caller function. Precondition ensures that the argument pointer is valid.
-                 The compliance of the preconditions is check during review.
+ \DESCRIPTION    Os_MpSwitch is called with the active access rights of the core of the next thread and the dynamic
+                 MpAccessRights data of the next thread. Both threads are passed as arguments to the caller function.
+                 Precondition ensures that the argument pointers are valid. The active access rights are returned by
+                 Os_CoreAsrGetMpActive for the core returned by Os_ThreadGetCore. The compliance of the preconditions
+                 is check during review.
  \COUNTERMEASURE \T [CM_OS_THREADGETMPACCESSRIGHTS_T]
+                 \M [CM_OS_THREADGETCORE_M]
 
 \ID SBSW_OS_TRD_MPSWITCHTO_001
- \DESCRIPTION    Os_MpSwitchTo is called with the dynamic MpAccessRights data of a thread. The thread is passed as
-                 argument to the caller function. Precondition ensures that the argument pointer is valid.
-                 The compliance of the preconditions is check during review.
+ \DESCRIPTION    Os_MpSwitchTo is called with the active access rights of the core of a thread and the dynamic
+                 MpAccessRights data of the thread. The thread is passed as argument to the caller function.
+                 Precondition ensures that the argument pointer is valid. The active access rights are returned by
+                 Os_CoreAsrGetMpActive for the core returned by Os_ThreadGetCore. The compliance of the preconditions
+                 is check during review.
  \COUNTERMEASURE \T [CM_OS_THREADGETMPACCESSRIGHTS_T]
+                 \M [CM_OS_THREADGETCORE_M]
 
 \ID SBSW_OS_TRD_HAL_CONTEXTINIT_001
  \DESCRIPTION    Os_Hal_ContextInit is called with ContextConfig and Context of a thread which
@@ -770,7 +770,7 @@ Os_ThreadResetAndResume,
   }
 
   /* #40 Resume memory protection access rights of Next. */
-  Os_MpSwitch(current->Dyn->MpAccessRights, Next->Dyn->MpAccessRights);                                                 /* SBSW_OS_TRD_MPSWITCH_001 */
+  Os_MpSwitch(Os_CoreAsrGetMpActive(Os_ThreadGetCore(Next)), Next->Dyn->MpAccessRights);                                /* SBSW_OS_TRD_MPSWITCH_001 */
 
   /* #45 Set the current thread pointer. */
   Os_CoreSetThread(Next);                                                                                               /* SBSW_OS_FC_PRECONDITION */
@@ -828,7 +828,7 @@ Os_ThreadStartFirst,
   Os_TpResetAndResume(configTp, currentTp, nextTp, Next);                                                               /* SBSW_OS_TRD_TPRESETANDRESUME_001 */
 
   /* #20 Set memory protection access rights of Next. */
-  Os_MpSwitchTo(Next->Dyn->MpAccessRights);                                                                             /* SBSW_OS_TRD_MPSWITCHTO_001 */
+  Os_MpSwitchTo(Os_CoreAsrGetMpActive(Os_ThreadGetCore(Next)), Next->Dyn->MpAccessRights);                              /* SBSW_OS_TRD_MPSWITCHTO_001 */
 
   /* #25 Set the current thread pointer. */
   Os_CoreSetThread(Next);                                                                                               /* SBSW_OS_FC_PRECONDITION */
@@ -902,7 +902,7 @@ Os_ThreadCleanupAndResume,
   }
 
   /* #40 Resume memory protection access rights of Next. */
-  Os_MpSwitch(current->Dyn->MpAccessRights, Next->Dyn->MpAccessRights);                                                 /* SBSW_OS_TRD_MPSWITCH_001 */
+  Os_MpSwitch(Os_CoreAsrGetMpActive(Os_ThreadGetCore(Next)), Next->Dyn->MpAccessRights);                                /* SBSW_OS_TRD_MPSWITCH_001 */
 
   /* #45 Set the current thread pointer. */
   Os_CoreSetThread(Next);                                                                                               /* SBSW_OS_FC_PRECONDITION */
@@ -964,6 +964,12 @@ Os_ThreadKill,
   /* #40 Release all locks and resources, which are hold by the thread. */
   Os_ThreadLocksForceRelease(Thread);                                                                                   /* SBSW_OS_FC_PRECONDITION */
 
+  /* #45 Close a cross core request batch, which is open by the thread. */
+  Os_XSigBatchAbort(Thread);                                                                                            /* SBSW_OS_FC_PRECONDITION */
+
+  /* #47 Free the communication elements of cross core requests, which are held by the thread. */
+  Os_XSigRequestAbort(Thread);                                                                                          /* SBSW_OS_FC_PRECONDITION */
+
   /* #50 Reset timing protection. */
   {
     P2CONST(Os_TpThreadConfigType, AUTOMATIC, OS_CONST) currentTp;
@@ -1055,7 +1061,7 @@ Os_ThreadSwitch,
   }
 
   /* #30 Resume memory protection access rights of Next. */
-  Os_MpSwitch(Current->Dyn->MpAccessRights, Next->Dyn->MpAccessRights);                                                 /* SBSW_OS_TRD_MPSWITCH_002 */
+  Os_MpSwitch(Os_CoreAsrGetMpActive(Os_ThreadGetCore(Next)), Next->Dyn->MpAccessRights);                                /* SBSW_OS_TRD_MPSWITCH_002 */
 
   /* #35 Switch current thread pointer. */
   Os_CoreSetThread(Next);                                                                                               /* SBSW_OS_FC_PRECONDITION */
@@ -1124,7 +1130,7 @@ Os_ThreadSuspendAndStart,
   Os_ThreadStoreFpuContext(Current);                                                                                    /* SBSW_OS_FC_PRECONDITION */
 
   /* #20 Resume memory protection access rights of Next. */
-  Os_MpSwitch(Current->Dyn->MpAccessRights, Next->Dyn->MpAccessRights);                                                 /* SBSW_OS_TRD_MPSWITCH_002 */
+  Os_MpSwitch(Os_CoreAsrGetMpActive(Os_ThreadGetCore(Next)), Next->Dyn->MpAccessRights);                                /* SBSW_OS_TRD_MPSWITCH_002 */
 
   /* #25 Switch current thread pointer. */
   Os_CoreSetThread(Next);                                                                                               /* SBSW_OS_FC_PRECONDITION */
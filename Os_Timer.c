@@ -379,12 +379,169 @@ FUNC(void, OS_CODE) Os_TimerPfrtStart
   /* #30 Set the compare value stored in software to now. */
   dyn = Os_TimerPfrtGetDyn(Timer);                                                                                      /* SBSW_OS_FC_PRECONDITION */
   dyn->Compare = (Os_TickType)Os_Hal_TimerFrtGetCounterValue(Timer->HwConfig);                                          /* SBSW_OS_TIMER_TIMERGETDYN_001 */ /* SBSW_OS_TIMER_HAL_TIMERFRTGETCOUNTERVALUE_001 */
+  dyn->Skipped = 0;                                                                                                     /* SBSW_OS_TIMER_TIMERGETDYN_001 */
 
   /* #40 Move compare value one period into the future. */
   Os_TimerPfrtSetNextHardwareCompareValue(Timer);                                                                       /* SBSW_OS_FC_PRECONDITION */
 }
 
 
+/***********************************************************************************************************************
+ *  Os_TimerPfrtTicklessEnter()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ *
+ *
+ *
+ *
+ */
+FUNC(boolean, OS_CODE) Os_TimerPfrtTicklessEnter                                                                        /* COV_OS_HALPLATFORMPFRTUNSUPPORTED_XX */
+(
+  P2CONST(Os_TimerPfrtConfigType, AUTOMATIC, OS_CONST) Timer
+)
+{
+  P2VAR(Os_TimerPfrtType, AUTOMATIC, OS_VAR_NOINIT) dyn;
+  Os_TickType distance;
+  Os_TickType maxSkip;
+  Os_TickType skip;
+  Os_TickType original;
+  Os_TickType now;
+  boolean isStretched;
+
+  if(Os_CounterHasPfrtCounter() == 0u)                                                                                  /* COV_OS_INVSTATE */ /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */
+  {
+    Os_ErrKernelPanic();
+  }
+
+  dyn = Os_TimerPfrtGetDyn(Timer);                                                                                      /* SBSW_OS_FC_PRECONDITION */
+  original = dyn->Compare;
+  isStretched = FALSE;
+
+  /* #10 Get the number of ticks until the software counter reaches its compare value (the next expiry). The tick
+   *     which reaches the compare value is handled by the timer ISR, all ticks before may be skipped. */
+  distance = Os_TimerSub(Timer->SwCounter.Counter.Characteristics.MaxCountingValue,
+                         dyn->Base.Compare,
+                         dyn->Base.Value);
+  skip = 0;
+  if(distance > 1u)
+  {
+    skip = distance - 1u;
+  }
+
+  /* #20 Limit the skipped ticks, so that the new compare value stays within the differential range of the FRT. */
+  maxSkip = Timer->MaxDifferentialValue / Timer->Period;
+  if(maxSkip > 0u)
+  {
+    maxSkip--;
+  }
+  if(skip > maxSkip)
+  {
+    skip = maxSkip;
+  }
+
+  /* #30 If ticks can be skipped and a passed compare value can be recovered by triggering the interrupt: */
+  if((skip > 0u) && (Os_Hal_IntIsPeripheralInterruptTriggerSupported() != 0u))                                          /* COV_OS_HALPLATFORMPERIPHERALINTTRIGGERSUPPORTED */ /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */
+  {
+    /* #40 Move the hardware compare value to the tick which reaches the next expiry. */
+    dyn->Compare = Os_TimerAdd(Timer->MaxCountingValue,                                                                 /* SBSW_OS_TIMER_TIMERGETDYN_001 */
+                               original,
+                               (skip - 1u) * Timer->Period);
+    Os_TimerPfrtSetNextHardwareCompareValue(Timer);                                                                     /* SBSW_OS_FC_PRECONDITION */
+
+    /* #50 If the next periodic tick has passed meanwhile, its interrupt may already be pending. Restore the periodic
+     *     compare value, which triggers the interrupt once. */
+    now = Os_TimerFrtTickType2TickType(Os_Hal_TimerFrtGetCounterValue(Timer->HwConfig));                                /* SBSW_OS_TIMER_HAL_TIMERFRTGETCOUNTERVALUE_001 */
+    if(OS_UNLIKELY(
+        Os_CounterIsFutureValueInternal(Timer->MaxCountingValue, Timer->MaxDifferentialValue, original, now) == 0u))
+    {
+      dyn->Compare = Os_TimerSub(Timer->MaxCountingValue, original, Timer->Period);                                     /* SBSW_OS_TIMER_TIMERGETDYN_001 */
+      Os_TimerPfrtSetNextHardwareCompareValue(Timer);                                                                   /* SBSW_OS_FC_PRECONDITION */
+    }
+    /* #60 Otherwise remember the skipped ticks. */
+    else
+    {
+      dyn->Skipped = skip;                                                                                              /* SBSW_OS_TIMER_TIMERGETDYN_001 */
+      isStretched = TRUE;
+    }
+  }
+
+  return isStretched;
+}                                                                                                                       /* PRQA S 6050 */ /* MD_MSR_STCAL */
+
+
+/***********************************************************************************************************************
+ *  Os_TimerPfrtTicklessLeave()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ *
+ *
+ */
+FUNC(void, OS_CODE) Os_TimerPfrtTicklessLeave                                                                           /* COV_OS_HALPLATFORMPFRTUNSUPPORTED_XX */
+(
+  P2CONST(Os_TimerPfrtConfigType, AUTOMATIC, OS_CONST) Timer
+)
+{
+  P2VAR(Os_TimerPfrtType, AUTOMATIC, OS_VAR_NOINIT) dyn;
+
+  if(Os_CounterHasPfrtCounter() == 0u)                                                                                  /* COV_OS_INVSTATE */ /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */
+  {
+    Os_ErrKernelPanic();
+  }
+
+  dyn = Os_TimerPfrtGetDyn(Timer);                                                                                      /* SBSW_OS_FC_PRECONDITION */
+
+  /* #10 If ticks of the timer are skipped: */
+  if(dyn->Skipped > 0u)
+  {
+    Os_TickType original;
+    Os_TickType now;
+    Os_TickType elapsed;
+
+    /* #20 Get the hardware time of the first skipped tick. */
+    original = Os_TimerSub(Timer->MaxCountingValue, dyn->Compare, dyn->Skipped * Timer->Period);
+    now = Os_TimerFrtTickType2TickType(Os_Hal_TimerFrtGetCounterValue(Timer->HwConfig));                                /* SBSW_OS_TIMER_HAL_TIMERFRTGETCOUNTERVALUE_001 */
+
+    /* #30 Count the skipped ticks, which have elapsed. */
+    elapsed = 0;
+    if(Os_CounterIsFutureValueInternal(Timer->MaxCountingValue, Timer->MaxDifferentialValue, original, now) == 0u)
+    {
+      elapsed = (Os_TimerSub(Timer->MaxCountingValue, now, original) / Timer->Period) + 1u;
+      if(elapsed > dyn->Skipped)
+      {
+        elapsed = dyn->Skipped;
+      }
+    }
+
+    /* #40 Add the elapsed ticks to the counter value in one step. As the skipped ticks end before the compare value
+     *     of the software counter, no job expires. */
+    dyn->Base.Value = Os_TimerAdd(Timer->SwCounter.Counter.Characteristics.MaxCountingValue,                            /* SBSW_OS_TIMER_TIMERGETDYN_001 */
+                                  dyn->Base.Value,
+                                  elapsed);
+
+    /* #50 If not all skipped ticks have elapsed, move the hardware compare value back to the next periodic tick. */
+    if(elapsed < dyn->Skipped)
+    {
+      dyn->Compare = Os_TimerAdd(Timer->MaxCountingValue,                                                               /* SBSW_OS_TIMER_TIMERGETDYN_001 */
+                                 Os_TimerSub(Timer->MaxCountingValue, original, Timer->Period),
+                                 elapsed * Timer->Period);
+      Os_TimerPfrtSetNextHardwareCompareValue(Timer);                                                                   /* SBSW_OS_FC_PRECONDITION */
+    }
+
+    dyn->Skipped = 0;                                                                                                   /* SBSW_OS_TIMER_TIMERGETDYN_001 */
+  }
+}                                                                                                                       /* PRQA S 6050 */ /* MD_MSR_STCAL */
+
+
 /***********************************************************************************************************************
  *  ISR(Os_TimerPitIsr)
  **********************************************************************************************************************/
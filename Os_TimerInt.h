@@ -306,6 +306,9 @@ typedef struct
 
   /*! Helds a copy of the compare value stored in hardware. */
   Os_TickType Compare;
+
+  /*! Number of periodic ticks, which are suppressed by tickless idle and not yet added to the counter value. */
+  Os_TickType Skipped;
 } Os_TimerPfrtType;
 
 
@@ -634,6 +637,59 @@ FUNC(void, OS_CODE) Os_TimerPfrtStart
 );
 
 
+/***********************************************************************************************************************
+ *  Os_TimerPfrtTicklessEnter()
+ **********************************************************************************************************************/
+/*! \brief          Suppresses the periodic ticks of a PFRT driven counter until its next expiry.
+ *  \details        The hardware compare value is moved to the tick which reaches the compare value of the software
+ *                  counter, limited by the maximum differential value of the FRT. The ticks in between are skipped.
+ *                  Nothing is done, if no tick can be skipped.
+ *
+ *  \param[in,out]  Timer           The timer to stretch. Parameter must not be NULL.
+ *
+ *  \retval         TRUE            Ticks are skipped. Os_TimerPfrtTicklessLeave() has to be called before the counter
+ *                                  is accessed again.
+ *  \retval         FALSE           The timer is unchanged.
+ *
+ *  \context        OS_INTERNAL
+ *
+ *  \reentrant      TRUE for different timers.
+ *  \synchronous    TRUE
+ *
+ *  \pre            Interrupts are disabled.
+ *  \pre            Timer belongs to the local core.
+ *  \pre            No ticks of the timer are skipped.
+ **********************************************************************************************************************/
+FUNC(boolean, OS_CODE) Os_TimerPfrtTicklessEnter
+(
+  P2CONST(Os_TimerPfrtConfigType, AUTOMATIC, OS_CONST) Timer
+);
+
+
+/***********************************************************************************************************************
+ *  Os_TimerPfrtTicklessLeave()
+ **********************************************************************************************************************/
+/*! \brief          Resumes the periodic ticks of a PFRT driven counter.
+ *  \details        The skipped ticks which have elapsed are added to the counter value in one step. If not all of them
+ *                  have elapsed, the hardware compare value is moved back to the next periodic tick.
+ *                  Nothing is done, if no ticks are skipped.
+ *
+ *  \param[in,out]  Timer           The timer to resume. Parameter must not be NULL.
+ *
+ *  \context        OS_INTERNAL
+ *
+ *  \reentrant      TRUE for different timers.
+ *  \synchronous    TRUE
+ *
+ *  \pre            Interrupts are disabled.
+ *  \pre            Timer belongs to the local core.
+ **********************************************************************************************************************/
+FUNC(void, OS_CODE) Os_TimerPfrtTicklessLeave
+(
+  P2CONST(Os_TimerPfrtConfigType, AUTOMATIC, OS_CONST) Timer
+);
+
+
 /***********************************************************************************************************************
  *  Os_TimerPitGetValue()
  **********************************************************************************************************************/
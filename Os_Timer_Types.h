@@ -67,6 +67,9 @@ typedef struct Os_TimerHrtConfigType_Tag Os_TimerHrtConfigType;
 struct Os_TimerPfrtConfigType_Tag;
 typedef struct Os_TimerPfrtConfigType_Tag Os_TimerPfrtConfigType;
 
+/*! Pointer to a PFRT driven counter configuration. */
+typedef P2CONST(Os_TimerPfrtConfigType, TYPEDEF, OS_CONST) Os_TimerPfrtConfigRefType;
+
 struct Os_TimerIsrConfigType_Tag;
 typedef struct Os_TimerIsrConfigType_Tag Os_TimerIsrConfigType;
 
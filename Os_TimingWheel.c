@@ -0,0 +1,680 @@
+/***********************************************************************************************************************
+ *  COPYRIGHT
+ *  --------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2021 by Vector Informatik GmbH.                                              All rights reserved.
+ *
+ *                This software is copyright protected and proprietary to Vector Informatik GmbH.
+ *                Vector Informatik GmbH grants to you only those rights as set out in the license conditions.
+ *                All other rights remain with Vector Informatik GmbH.
+ *  \endverbatim
+ *  --------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  ------------------------------------------------------------------------------------------------------------------*/
+/**
+ * \addtogroup Os_TimingWheel
+ * \{
+ *
+ * \file        Os_TimingWheel.c
+ * \brief       General implementation of the hierarchical timing wheel.
+ *
+ *
+ **********************************************************************************************************************/
+/***********************************************************************************************************************
+ *  REVISION HISTORY
+ *  --------------------------------------------------------------------------------------------------------------------
+ *  Refer to Os.h.
+ **********************************************************************************************************************/
+
+                                                                                                                        /* PRQA S 0777, 0779, 0828  EOF */ /* MD_MSR_Rule5.1, MD_MSR_Rule5.2, MD_MSR_Dir1.1 */
+
+
+#define OS_TIMINGWHEEL_SOURCE
+
+/***********************************************************************************************************************
+ *  INCLUDES
+ **********************************************************************************************************************/
+/* AUTOSAR includes */
+#include "Std_Types.h"
+
+/* Os module declarations */
+#include "Os_TimingWheel.h"
+
+/* Os kernel module dependencies */
+#include "Os_Cfg.h"
+#include "Os_Common_Types.h"
+#include "Os_Job.h"
+#include "Os_Bit.h"
+#include "Os_Error.h"
+
+
+/***********************************************************************************************************************
+ *  LOCAL CONSTANT MACROS
+ **********************************************************************************************************************/
+/*! Marks that no event is pending. */
+#define OS_TIMINGWHEEL_NO_EVENT                 ((Os_TimingWheelTimeType)0xFFFFFFFFuL)
+
+
+/***********************************************************************************************************************
+ *  LOCAL FUNCTION MACROS
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *  LOCAL DATA TYPES AND STRUCTURES
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *  LOCAL DATA PROTOTYPES
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *  GLOBAL DATA
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *  LOCAL FUNCTION PROTOTYPES
+ **********************************************************************************************************************/
+#define OS_START_SEC_CODE
+#include "Os_MemMap_OsCode.h"                                                                                           /* PRQA S 5087 */ /* MD_MSR_MemMap */
+
+
+/***********************************************************************************************************************
+ *  Os_TimingWheelLowestSlot()
+ **********************************************************************************************************************/
+/*! \brief          Returns the index of the least significant set bit of an occupation mask.
+ *  \details        --no details--
+ *
+ *  \param[in]      Occupied    The occupation mask. Must not be zero.
+ *
+ *  \return         Index of the least significant set bit.
+ *
+ *  \context        ANY
+ *
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *
+ *  \pre            -
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE uint32, OS_CODE, OS_ALWAYS_INLINE,
+Os_TimingWheelLowestSlot,
+(
+  uint32 Occupied
+));
+
+
+/***********************************************************************************************************************
+ *  Os_TimingWheelSlotLink()
+ **********************************************************************************************************************/
+/*! \brief          Links the job into the given slot.
+ *  \details        --no details--
+ *
+ *  \param[in,out]  TimingWheel The timing wheel. Parameter must not be NULL.
+ *  \param[in]      SlotIdx     Index of the slot. Must be lower than LevelCount * OS_TIMINGWHEEL_SLOTS_PER_LEVEL.
+ *  \param[in]      Job         The job to link. Parameter must not be NULL.
+ *
+ *  \context        OS_INTERNAL
+ *
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *
+ *  \pre            Concurrent access to given object is prevented by caller.
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,
+Os_TimingWheelSlotLink,
+(
+  P2CONST(Os_TimingWheelConfigType, AUTOMATIC, OS_CONST) TimingWheel,
+  Os_TimingWheelSlotIdxType SlotIdx,
+  P2CONST(Os_JobConfigType, AUTOMATIC, OS_APPL_DATA) Job
+));
+
+
+/***********************************************************************************************************************
+ *  Os_TimingWheelSlotUnlink()
+ **********************************************************************************************************************/
+/*! \brief          Removes the job from its slot.
+ *  \details        --no details--
+ *
+ *  \param[in,out]  TimingWheel The timing wheel. Parameter must not be NULL.
+ *  \param[in]      Job         The job to unlink. Parameter must not be NULL.
+ *
+ *  \context        OS_INTERNAL
+ *
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *
+ *  \pre            Concurrent access to given object is prevented by caller.
+ *  \pre            The job is linked into a slot of the given wheel.
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,
+Os_TimingWheelSlotUnlink,
+(
+  P2CONST(Os_TimingWheelConfigType, AUTOMATIC, OS_CONST) TimingWheel,
+  P2CONST(Os_JobConfigType, AUTOMATIC, OS_APPL_DATA) Job
+));
+
+
+/***********************************************************************************************************************
+ *  Os_TimingWheelPlace()
+ **********************************************************************************************************************/
+/*! \brief          Links the job into the slot, which matches its wheel time stamp.
+ *  \details        The job is placed on the lowest level, which still distinguishes the job's time stamp from the
+ *                  current wheel time. Jobs beyond the range of the highest level are placed into slot 0 of the
+ *                  highest level. Slot 0 starts at the next wrap around of that level, which is the earliest time at
+ *                  which the bits above the highest level change. The current slot of the highest level would be
+ *                  reached after a full revolution only, which may be later than the job's expiration.
+ *
+ *  \param[in,out]  TimingWheel The timing wheel. Parameter must not be NULL.
+ *  \param[in]      Job         The job to place. Parameter must not be NULL.
+ *
+ *  \context        OS_INTERNAL
+ *
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *
+ *  \pre            Concurrent access to given object is prevented by caller.
+ *  \pre            The job's wheel time stamp is not in the past of the current wheel time.
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,
+Os_TimingWheelPlace,
+(
+  P2CONST(Os_TimingWheelConfigType, AUTOMATIC, OS_CONST) TimingWheel,
+  P2CONST(Os_JobConfigType, AUTOMATIC, OS_APPL_DATA) Job
+));
+
+
+/**********************************************************************************************************************
+ *  LOCAL FUNCTIONS
+ **********************************************************************************************************************/
+
+
+/***********************************************************************************************************************
+ *  Os_TimingWheelLowestSlot()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE uint32, OS_CODE, OS_ALWAYS_INLINE,
+Os_TimingWheelLowestSlot,
+(
+  uint32 Occupied
+))
+{
+  uint32 lowestBit;
+
+  Os_Assert((Os_StdReturnType)(Occupied != 0u));                                                                        /* PRQA S 4304 */ /* MD_Os_C90BooleanCompatibility */
+
+  /* #10 Isolate the least significant set bit and derive its index from the number of leading zeros. */
+  lowestBit = Occupied & ((uint32)0u - Occupied);
+
+  return (OS_TIMINGWHEEL_SLOTS_PER_LEVEL - 1u) - (uint32)Os_Bit_CountLeadingZeros((Os_BitFieldType)lowestBit);
+}
+
+
+/***********************************************************************************************************************
+ *  Os_TimingWheelSlotLink()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,
+Os_TimingWheelSlotLink,
+(
+  P2CONST(Os_TimingWheelConfigType, AUTOMATIC, OS_CONST) TimingWheel,
+  Os_TimingWheelSlotIdxType SlotIdx,
+  P2CONST(Os_JobConfigType, AUTOMATIC, OS_APPL_DATA) Job
+))
+{
+  P2CONST(Os_JobConfigType, AUTOMATIC, OS_APPL_DATA) first = TimingWheel->Slots[SlotIdx].First;
+
+  /* #10 Put the job in front of the slot's list. */
+  Job->WheelJob->Slot = SlotIdx;                                                                                        /* SBSW_OS_TW_WHEELJOB_001 */
+  Job->WheelJob->Prev = NULL_PTR;                                                                                       /* SBSW_OS_TW_WHEELJOB_001 */
+  Job->WheelJob->Next = first;                                                                                          /* SBSW_OS_TW_WHEELJOB_001 */
+
+  if(first != NULL_PTR)
+  {
+    first->WheelJob->Prev = Job;                                                                                        /* SBSW_OS_TW_WHEELJOB_002 */
+  }
+
+  TimingWheel->Slots[SlotIdx].First = Job;                                                                              /* SBSW_OS_TW_SLOT_INDEX_001 */
+
+  /* #20 Mark the slot as used. */
+  TimingWheel->Dyn->Occupied[SlotIdx >> OS_TIMINGWHEEL_SLOT_BITS] |=                                                    /* SBSW_OS_TW_TIMINGWHEELGETDYN_001 */
+    ((uint32)1u << (SlotIdx & OS_TIMINGWHEEL_SLOT_MASK));
+}
+
+
+/***********************************************************************************************************************
+ *  Os_TimingWheelSlotUnlink()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,
+Os_TimingWheelSlotUnlink,
+(
+  P2CONST(Os_TimingWheelConfigType, AUTOMATIC, OS_CONST) TimingWheel,
+  P2CONST(Os_JobConfigType, AUTOMATIC, OS_APPL_DATA) Job
+))
+{
+  Os_TimingWheelSlotIdxType slotIdx = Job->WheelJob->Slot;
+  P2CONST(Os_JobConfigType, AUTOMATIC, OS_APPL_DATA) prev = Job->WheelJob->Prev;
+  P2CONST(Os_JobConfigType, AUTOMATIC, OS_APPL_DATA) next = Job->WheelJob->Next;
+
+  /* #10 Remove the job from the slot's list. */
+  if(prev == NULL_PTR)
+  {
+    TimingWheel->Slots[slotIdx].First = next;                                                                           /* SBSW_OS_TW_SLOT_INDEX_001 */
+  }
+  else
+  {
+    prev->WheelJob->Next = next;                                                                                        /* SBSW_OS_TW_WHEELJOB_002 */
+  }
+
+  if(next != NULL_PTR)
+  {
+    next->WheelJob->Prev = prev;                                                                                        /* SBSW_OS_TW_WHEELJOB_002 */
+  }
+
+  /* #20 If the slot is empty now, mark it as unused. */
+  if(TimingWheel->Slots[slotIdx].First == NULL_PTR)
+  {
+    TimingWheel->Dyn->Occupied[slotIdx >> OS_TIMINGWHEEL_SLOT_BITS] &=                                                  /* SBSW_OS_TW_TIMINGWHEELGETDYN_001 */
+      ~((uint32)1u << (slotIdx & OS_TIMINGWHEEL_SLOT_MASK));
+  }
+}
+
+
+/***********************************************************************************************************************
+ *  Os_TimingWheelPlace()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,
+Os_TimingWheelPlace,
+(
+  P2CONST(Os_TimingWheelConfigType, AUTOMATIC, OS_CONST) TimingWheel,
+  P2CONST(Os_JobConfigType, AUTOMATIC, OS_APPL_DATA) Job
+))
+{
+  Os_TimingWheelTimeType timestamp = Job->WheelJob->Timestamp;
+  Os_TimingWheelTimeType difference;
+  uint32 level = 0u;
+  uint32 slot;
+
+  /* #10 Find the lowest level above all bits, in which the time stamp differs from the wheel time. */
+  difference = (timestamp ^ TimingWheel->Dyn->Time) >> OS_TIMINGWHEEL_SLOT_BITS;
+
+  while((difference != 0u) && (level < ((uint32)TimingWheel->LevelCount - 1u)))
+  {
+    difference >>= OS_TIMINGWHEEL_SLOT_BITS;
+    level++;
+  }
+
+  /* #20 If the time stamp is beyond the highest level, use slot 0, which is reached at its next wrap around. */
+  if(difference != 0u)
+  {
+    slot = 0u;
+  }
+  /* #30 Otherwise use the slot which matches the time stamp. */
+  else
+  {
+    slot = (timestamp >> (level * OS_TIMINGWHEEL_SLOT_BITS)) & OS_TIMINGWHEEL_SLOT_MASK;
+  }
+
+  /* #40 Link the job into the slot. */
+  Os_TimingWheelSlotLink(TimingWheel,                                                                                   /* SBSW_OS_FC_PRECONDITION */
+                         (Os_TimingWheelSlotIdxType)((level * OS_TIMINGWHEEL_SLOTS_PER_LEVEL) + slot),
+                         Job);
+}
+
+
+/**********************************************************************************************************************
+ *  GLOBAL FUNCTIONS
+ **********************************************************************************************************************/
+
+
+/***********************************************************************************************************************
+ *  Os_TimingWheelInit()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ */
+FUNC(void, OS_CODE) Os_TimingWheelInit
+(
+  P2CONST(Os_TimingWheelConfigType, AUTOMATIC, OS_CONST) TimingWheel
+)
+{
+  uint32 idx;
+
+  Os_Assert((Os_StdReturnType)(TimingWheel->LevelCount >= OS_TIMINGWHEEL_LEVELS_MIN));                                  /* PRQA S 4304 */ /* MD_Os_C90BooleanCompatibility */
+  Os_Assert((Os_StdReturnType)(TimingWheel->LevelCount <= OS_TIMINGWHEEL_LEVELS_MAX));                                  /* PRQA S 4304 */ /* MD_Os_C90BooleanCompatibility */
+
+  /* #10 Reset the wheel time and the job counter. */
+  TimingWheel->Dyn->Time = 0u;                                                                                          /* SBSW_OS_TW_TIMINGWHEELGETDYN_001 */
+  TimingWheel->Dyn->Reference = 0u;                                                                                     /* SBSW_OS_TW_TIMINGWHEELGETDYN_001 */
+  TimingWheel->Dyn->JobCount = 0u;                                                                                      /* SBSW_OS_TW_TIMINGWHEELGETDYN_001 */
+
+  /* #20 Mark all slots as unused. */
+  for(idx = 0u; idx < OS_TIMINGWHEEL_LEVELS_MAX; idx++)
+  {
+    TimingWheel->Dyn->Occupied[idx] = 0u;                                                                               /* SBSW_OS_TW_TIMINGWHEELGETDYN_001 */
+  }
+
+  for(idx = 0u; idx < ((uint32)TimingWheel->LevelCount * OS_TIMINGWHEEL_SLOTS_PER_LEVEL); idx++)
+  {
+    TimingWheel->Slots[idx].First = NULL_PTR;                                                                           /* SBSW_OS_TW_SLOT_INDEX_001 */
+  }
+}
+
+
+/***********************************************************************************************************************
+ *  Os_TimingWheelInsert()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ */
+FUNC(Os_StdReturnType, OS_CODE) Os_TimingWheelInsert
+(
+  P2CONST(Os_TimingWheelConfigType, AUTOMATIC, OS_CONST) TimingWheel,
+  P2CONST(Os_JobConfigType, AUTOMATIC, OS_APPL_DATA) Job,
+  Os_TimingWheelTimeType Delay
+)
+{
+  Os_TimingWheelTimeType previousEvent = OS_TIMINGWHEEL_NO_EVENT;
+
+  Os_Assert((Os_StdReturnType)(Job->WheelJob != NULL_PTR));                                                             /* PRQA S 4304 */ /* MD_Os_C90BooleanCompatibility */
+
+  /* #10 Remember the next event before the insertion. */
+  if(Os_TimingWheelIsEmpty(TimingWheel) == 0u)                                                                          /* SBSW_OS_FC_PRECONDITION */
+  {
+    previousEvent = Os_TimingWheelNextEventGet(TimingWheel);                                                            /* SBSW_OS_FC_PRECONDITION */
+  }
+
+  /* #20 Convert the delay into a wheel time stamp and link the job into the matching slot. */
+  Job->WheelJob->Timestamp = TimingWheel->Dyn->Time + Delay;                                                            /* SBSW_OS_TW_WHEELJOB_001 */
+  Os_TimingWheelPlace(TimingWheel, Job);                                                                                /* SBSW_OS_FC_PRECONDITION */
+  TimingWheel->Dyn->JobCount++;                                                                                         /* SBSW_OS_TW_TIMINGWHEELGETDYN_001 */
+
+  /* #30 Report whether the next event has changed. */
+  return (Os_StdReturnType)(Os_TimingWheelNextEventGet(TimingWheel) != previousEvent);                                  /* PRQA S 4304 */ /* MD_Os_C90BooleanCompatibility */ /* SBSW_OS_FC_PRECONDITION */
+}
+
+
+/***********************************************************************************************************************
+ *  Os_TimingWheelDelete()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ */
+FUNC(Os_StdReturnType, OS_CODE) Os_TimingWheelDelete
+(
+  P2CONST(Os_TimingWheelConfigType, AUTOMATIC, OS_CONST) TimingWheel,
+  P2CONST(Os_JobConfigType, AUTOMATIC, OS_APPL_DATA) Job
+)
+{
+  Os_TimingWheelTimeType previousEvent;
+  Os_StdReturnType result;
+
+  Os_Assert((Os_StdReturnType)(TimingWheel->Dyn->JobCount > 0u));                                                      /* PRQA S 4304 */ /* MD_Os_C90BooleanCompatibility */
+
+  /* #10 Remember the next event before the deletion. */
+  previousEvent = Os_TimingWheelNextEventGet(TimingWheel);                                                              /* SBSW_OS_FC_PRECONDITION */
+
+  /* #20 Unlink the job. */
+  Os_TimingWheelSlotUnlink(TimingWheel, Job);                                                                           /* SBSW_OS_FC_PRECONDITION */
+  TimingWheel->Dyn->JobCount--;                                                                                         /* SBSW_OS_TW_TIMINGWHEELGETDYN_001 */
+
+  /* #30 Report whether the wheel is empty now or the next event has changed. */
+  if(Os_TimingWheelIsEmpty(TimingWheel) != 0u)                                                                          /* SBSW_OS_FC_PRECONDITION */
+  {
+    result = !0u;                                                                                                       /* PRQA S 4404, 4558 */ /* MD_Os_C90BooleanCompatibility, MD_Os_Rule10.1_4558 */
+  }
+  else
+  {
+    result = (Os_StdReturnType)(Os_TimingWheelNextEventGet(TimingWheel) != previousEvent);                              /* PRQA S 4304 */ /* MD_Os_C90BooleanCompatibility */ /* SBSW_OS_FC_PRECONDITION */
+  }
+
+  return result;
+}
+
+
+/***********************************************************************************************************************
+ *  Os_TimingWheelDeleteTop()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ */
+FUNC(void, OS_CODE) Os_TimingWheelDeleteTop
+(
+  P2CONST(Os_TimingWheelConfigType, AUTOMATIC, OS_CONST) TimingWheel
+)
+{
+  P2CONST(Os_JobConfigType, AUTOMATIC, OS_APPL_DATA) top = Os_TimingWheelTopGet(TimingWheel);                          /* SBSW_OS_FC_PRECONDITION */
+
+  Os_Assert((Os_StdReturnType)(top != NULL_PTR));                                                                       /* PRQA S 4304 */ /* MD_Os_C90BooleanCompatibility */
+
+  /* #10 Unlink the first expired job. */
+  Os_TimingWheelSlotUnlink(TimingWheel, top);                                                                           /* SBSW_OS_FC_PRECONDITION */
+  TimingWheel->Dyn->JobCount--;                                                                                         /* SBSW_OS_TW_TIMINGWHEELGETDYN_001 */
+}
+
+
+/***********************************************************************************************************************
+ *  Os_TimingWheelNextEventGet()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ *
+ *
+ */
+FUNC(Os_TimingWheelTimeType, OS_CODE) Os_TimingWheelNextEventGet
+(
+  P2CONST(Os_TimingWheelConfigType, AUTOMATIC, OS_CONST) TimingWheel
+)
+{
+  Os_TimingWheelTimeType time = TimingWheel->Dyn->Time;
+  Os_TimingWheelTimeType result = OS_TIMINGWHEEL_NO_EVENT;
+  uint32 level;
+
+  Os_Assert((Os_StdReturnType)(TimingWheel->Dyn->JobCount > 0u));                                                       /* PRQA S 4304 */ /* MD_Os_C90BooleanCompatibility */
+
+  /* #10 For each level with used slots: */
+  for(level = 0u; level < (uint32)TimingWheel->LevelCount; level++)
+  {
+    uint32 occupied = TimingWheel->Dyn->Occupied[level];
+
+    if(occupied != 0u)
+    {
+      uint32 shift = level * OS_TIMINGWHEEL_SLOT_BITS;
+      uint32 current = (time >> shift) & OS_TIMINGWHEEL_SLOT_MASK;
+      uint32 distance;
+      Os_TimingWheelTimeType event;
+
+      /* #20 Rotate the occupation mask, so that bit 0 represents the current slot. */
+      occupied = (occupied >> current) | (occupied << ((OS_TIMINGWHEEL_SLOTS_PER_LEVEL - current) &
+                                                        OS_TIMINGWHEEL_SLOT_MASK));
+
+      /* #30 On higher levels, the current slot is reached again after a full revolution only. */
+      if(level != 0u)
+      {
+        occupied &= ~(uint32)1u;
+      }
+
+      /* #40 Get the number of slots until the next used one. */
+      if(occupied == 0u)
+      {
+        distance = OS_TIMINGWHEEL_SLOTS_PER_LEVEL;
+      }
+      else
+      {
+        distance = Os_TimingWheelLowestSlot(occupied);
+      }
+
+      /* #50 Calculate the ticks until the start of that slot and keep the minimum. */
+      event = (((time >> shift) + distance) << shift) - time;
+
+      if(event < result)
+      {
+        result = event;
+      }
+    }
+  }
+
+  return result;
+}
+
+
+/***********************************************************************************************************************
+ *  Os_TimingWheelAdvance()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ *
+ */
+FUNC(void, OS_CODE) Os_TimingWheelAdvance
+(
+  P2CONST(Os_TimingWheelConfigType, AUTOMATIC, OS_CONST) TimingWheel,
+  Os_TimingWheelTimeType Delay,
+  Os_TickType Reference
+)
+{
+  Os_TimingWheelTimeType time;
+  uint32 level;
+
+  Os_Assert((Os_StdReturnType)((TimingWheel->Dyn->JobCount == 0u)                                                      /* PRQA S 4304 */ /* MD_Os_C90BooleanCompatibility */
+                              || (Delay <= Os_TimingWheelNextEventGet(TimingWheel))));
+
+  /* #10 Move the wheel time. */
+  time = TimingWheel->Dyn->Time + Delay;
+  TimingWheel->Dyn->Time = time;                                                                                        /* SBSW_OS_TW_TIMINGWHEELGETDYN_001 */
+  TimingWheel->Dyn->Reference = Reference;                                                                              /* SBSW_OS_TW_TIMINGWHEELGETDYN_001 */
+
+  /* #20 For each higher level, from the highest to the lowest one: */
+  for(level = (uint32)TimingWheel->LevelCount - 1u; level > 0u; level--)
+  {
+    uint32 shift = level * OS_TIMINGWHEEL_SLOT_BITS;
+
+    /* #30 If the wheel time has reached the start of a slot on this level: */
+    if((time & (((uint32)1u << shift) - 1u)) == 0u)
+    {
+      Os_TimingWheelSlotIdxType slotIdx;
+      P2CONST(Os_JobConfigType, AUTOMATIC, OS_APPL_DATA) job;
+
+      slotIdx = (Os_TimingWheelSlotIdxType)((level * OS_TIMINGWHEEL_SLOTS_PER_LEVEL) +
+                                            ((time >> shift) & OS_TIMINGWHEEL_SLOT_MASK));
+      job = TimingWheel->Slots[slotIdx].First;
+
+      /* #40 Empty the slot and move its jobs to lower levels (cascading). */
+      TimingWheel->Slots[slotIdx].First = NULL_PTR;                                                                     /* SBSW_OS_TW_SLOT_INDEX_001 */
+      TimingWheel->Dyn->Occupied[level] &= ~((uint32)1u << (slotIdx & OS_TIMINGWHEEL_SLOT_MASK));                       /* SBSW_OS_TW_TIMINGWHEELGETDYN_001 */
+
+      while(job != NULL_PTR)
+      {
+        P2CONST(Os_JobConfigType, AUTOMATIC, OS_APPL_DATA) next = job->WheelJob->Next;
+
+        Os_TimingWheelPlace(TimingWheel, job);                                                                          /* SBSW_OS_TW_PLACE_001 */
+        job = next;
+      }
+    }
+  }
+}
+
+
+#define OS_STOP_SEC_CODE
+#include "Os_MemMap_OsCode.h"                                                                                           /* PRQA S 5087 */ /* MD_MSR_MemMap */
+
+
+/* module specific MISRA deviations:
+ *
+ */
+
+/* SBSW_JUSTIFICATION_BEGIN
+
+\ID SBSW_OS_TW_TIMINGWHEELGETDYN_001
+ \DESCRIPTION    Write access to a Dyn element. The Dyn element is derived from a TimingWheel which is passed as
+                 argument. Precondition ensures that the TimingWheel pointer is valid. The compliance of the
+                 precondition is check during review.
+ \COUNTERMEASURE \M [CM_OS_TIMINGWHEEL_DYN_M]
+
+\ID SBSW_OS_TW_SLOT_INDEX_001
+ \DESCRIPTION    Write access to a Slot element. The index is either derived from the wheel time limited by
+                 OS_TIMINGWHEEL_SLOT_MASK, a level lower than LevelCount or the slot index stored in a job, which has
+                 been calculated the same way.
+ \COUNTERMEASURE \M [CM_OS_TIMINGWHEEL_SLOTS_M]
+
+\ID SBSW_OS_TW_WHEELJOB_001
+ \DESCRIPTION    Write access to the WheelJob element of a job, which is passed as argument. Precondition ensures that
+                 the Job pointer is valid. The compliance of the precondition is check during review.
+ \COUNTERMEASURE \M [CM_OS_TIMINGWHEEL_WHEELJOB_M]
+
+\ID SBSW_OS_TW_WHEELJOB_002
+ \DESCRIPTION    Write access to the WheelJob element of a job, which is linked into a slot of the wheel. Only jobs
+                 which have been passed to the wheel as valid arguments are linked into slots.
+ \COUNTERMEASURE \M [CM_OS_TIMINGWHEEL_WHEELJOB_M]
+
+\ID SBSW_OS_TW_PLACE_001
+ \DESCRIPTION    Os_TimingWheelPlace is called with a job, which has been linked into a slot of the wheel. Only jobs
+                 which have been passed to the wheel as valid arguments are linked into slots.
+ \COUNTERMEASURE \M [CM_OS_TIMINGWHEEL_WHEELJOB_M]
+
+SBSW_JUSTIFICATION_END */
+
+
+/*
+\CM CM_OS_TIMINGWHEEL_DYN_M
+      Verify that the Dyn pointer of each TimingWheel object is valid.
+
+\CM CM_OS_TIMINGWHEEL_SLOTS_M
+      Verify that:
+        1. the Slots pointer of each timing wheel is no NULL_PTR,
+        2. the LevelCount of each timing wheel is in range OS_TIMINGWHEEL_LEVELS_MIN .. OS_TIMINGWHEEL_LEVELS_MAX and
+        3. the size of the Slots array is equal to LevelCount * OS_TIMINGWHEEL_SLOTS_PER_LEVEL.
+
+\CM CM_OS_TIMINGWHEEL_WHEELJOB_M
+      Verify that the WheelJob pointer of each job, whose counter has a JobWheel, is valid and that no two jobs
+      reference the same WheelJob object.
+ */
+
+
+/*!
+ * \}
+ */
+
+/***********************************************************************************************************************
+ *  END OF FILE: Os_TimingWheel.c
+ **********************************************************************************************************************/
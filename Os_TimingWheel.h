@@ -0,0 +1,143 @@
+/***********************************************************************************************************************
+ *  COPYRIGHT
+ *  --------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2021 by Vector Informatik GmbH.                                              All rights reserved.
+ *
+ *                This software is copyright protected and proprietary to Vector Informatik GmbH.
+ *                Vector Informatik GmbH grants to you only those rights as set out in the license conditions.
+ *                All other rights remain with Vector Informatik GmbH.
+ *  \endverbatim
+ *  --------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  ------------------------------------------------------------------------------------------------------------------*/
+/**
+ * \addtogroup Os_TimingWheel
+ *
+ * \{
+ * \file
+ * \brief   Provides the API declaration.
+ * \details --no details--
+ *
+ **********************************************************************************************************************/
+/***********************************************************************************************************************
+ *  REVISION HISTORY
+ *  --------------------------------------------------------------------------------------------------------------------
+ *  Refer to Os.h.
+ **********************************************************************************************************************/
+
+
+#ifndef OS_TIMINGWHEEL_H
+# define OS_TIMINGWHEEL_H
+                                                                                                                         /* PRQA S 0388 EOF */ /* MD_MSR_Dir1.1 */
+/***********************************************************************************************************************
+ *  INCLUDES
+ **********************************************************************************************************************/
+/* AUTOSAR includes */
+# include "Std_Types.h"
+
+/* Os module declarations */
+# include "Os_TimingWheelInt.h"
+
+/* Os kernel module dependencies */
+# include "Os_Job.h"
+
+/* Os HAL dependencies */
+# include "Os_Hal_Compiler.h"
+
+
+/***********************************************************************************************************************
+ *  GLOBAL CONSTANT MACROS
+ **********************************************************************************************************************/
+
+
+/***********************************************************************************************************************
+ *  GLOBAL FUNCTION MACROS
+ **********************************************************************************************************************/
+
+
+/***********************************************************************************************************************
+ *  GLOBAL DATA TYPES AND STRUCTURES
+ **********************************************************************************************************************/
+
+
+/***********************************************************************************************************************
+ *  GLOBAL DATA PROTOTYPES
+ **********************************************************************************************************************/
+
+
+/***********************************************************************************************************************
+ *  GLOBAL FUNCTION PROTOTYPES
+ **********************************************************************************************************************/
+
+# define OS_START_SEC_CODE
+# include "Os_MemMap_OsCode.h"                                                                                          /* PRQA S 5087 */ /* MD_MSR_MemMap */
+
+/***********************************************************************************************************************
+ *  GLOBAL FUNCTIONS
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *  Os_TimingWheelTopGet()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(                                                                                           /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+OS_LOCAL_INLINE P2CONST(Os_JobConfigType, AUTOMATIC, OS_CODE), OS_CODE,
+OS_ALWAYS_INLINE, Os_TimingWheelTopGet,
+(
+  P2CONST(Os_TimingWheelConfigType, AUTOMATIC, OS_CONST) TimingWheel
+))
+{
+  /* #10 Return the first job of the current level 0 slot. Only expired jobs are linked into this slot. */
+  return TimingWheel->Slots[TimingWheel->Dyn->Time & OS_TIMINGWHEEL_SLOT_MASK].First;
+}
+
+
+/***********************************************************************************************************************
+ *  Os_TimingWheelIsEmpty()
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE Os_StdReturnType, OS_CODE, OS_ALWAYS_INLINE,                               /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+Os_TimingWheelIsEmpty,
+(
+  P2CONST(Os_TimingWheelConfigType, AUTOMATIC, OS_CONST) TimingWheel
+))
+{
+  return (Os_StdReturnType)(TimingWheel->Dyn->JobCount == 0u);                                                          /* PRQA S 4304 */ /* MD_Os_C90BooleanCompatibility */
+}
+
+
+/***********************************************************************************************************************
+ *  Os_TimingWheelReferenceGet()
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE Os_TickType, OS_CODE, OS_ALWAYS_INLINE,                                    /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+Os_TimingWheelReferenceGet,
+(
+  P2CONST(Os_TimingWheelConfigType, AUTOMATIC, OS_CONST) TimingWheel
+))
+{
+  return TimingWheel->Dyn->Reference;
+}
+
+
+
+# define OS_STOP_SEC_CODE
+# include "Os_MemMap_OsCode.h"                                                                                          /* PRQA S 5087 */ /* MD_MSR_MemMap */
+
+
+#endif /* OS_TIMINGWHEEL_H */
+
+/* module specific MISRA deviations:
+ *
+ */
+
+/*!
+ * \}
+ */
+
+/***********************************************************************************************************************
+ *  END OF FILE: Os_TimingWheel.h
+ **********************************************************************************************************************/
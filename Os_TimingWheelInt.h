@@ -0,0 +1,346 @@
+/***********************************************************************************************************************
+ *  COPYRIGHT
+ *  --------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2021 by Vector Informatik GmbH.                                              All rights reserved.
+ *
+ *                This software is copyright protected and proprietary to Vector Informatik GmbH.
+ *                Vector Informatik GmbH grants to you only those rights as set out in the license conditions.
+ *                All other rights remain with Vector Informatik GmbH.
+ *  \endverbatim
+ *  --------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  ------------------------------------------------------------------------------------------------------------------*/
+/**
+ * \ingroup     Os_Kernel
+ * \defgroup    Os_TimingWheel Timing Wheel
+ * \brief       Hierarchical [timing wheel](http:\\www.cs.columbia.edu/~nahum/w6998/papers/sosp87-timing-wheels.pdf)
+ *              as alternative job store of a counter.
+ * \details
+ * A counter either keeps its jobs in a priority queue (\ref Os_PriorityQueue) or in a timing wheel. The wheel is
+ * selected per counter by the generator, e.g. for counters with many cyclic alarms.
+ *
+ * The wheel consists of LevelCount levels with OS_TIMINGWHEEL_SLOTS_PER_LEVEL slots each. Level 0 has a resolution
+ * of one tick, each further level a resolution of OS_TIMINGWHEEL_SLOTS_PER_LEVEL times the previous one. A job is
+ * linked into the slot of the lowest level, which still distinguishes its expiration from the current wheel time.
+ * When the wheel time reaches a slot of a higher level, the slot's jobs are moved to lower levels (cascading).
+ * Jobs in the current slot of level 0 are expired.
+ *
+ * The slot links of a job are kept in a separate Os_TimingWheelJobType object, which is referenced by the job's
+ * WheelJob member. Jobs of counters with a priority queue do not have such an object.
+ *
+ * Operations which are provided:
+ * - Insert a job: *O(1)*.
+ * - Get and delete an expired job: *O(1)*.
+ * - Remove an arbitrary job: *O(1)*.
+ * - Get the time of the next slot, which has to be worked on: *O(LevelCount)*.
+ *
+ * Each job is cascaded at most LevelCount - 1 times. In contrast to the priority queue, the next timer interrupt may
+ * be caused by cascading instead of an expiring job.
+ *
+ * The wheel has its own time base (Os_TimingWheelTimeType), which counts modulo 2^32. The counter maps it to timer
+ * values by the reference value, which is the timer value of the current wheel time.
+ *
+ * \{
+ * \file
+ * \brief   Provides the API declaration.
+ * \details --no details--
+ *
+ **********************************************************************************************************************/
+/***********************************************************************************************************************
+ *  REVISION HISTORY
+ *  --------------------------------------------------------------------------------------------------------------------
+ *  Refer to Os.h.
+ **********************************************************************************************************************/
+
+
+#ifndef OS_TIMINGWHEELINT_H
+# define OS_TIMINGWHEELINT_H
+                                                                                                                         /* PRQA S 0388 EOF */ /* MD_MSR_Dir1.1 */
+/***********************************************************************************************************************
+ *  INCLUDES
+ **********************************************************************************************************************/
+/* AUTOSAR includes */
+# include "Std_Types.h"
+
+/* Os module declarations */
+# include "Os_TimingWheel_Types.h"
+
+/* Os kernel module dependencies */
+# include "Os_Common_Types.h"
+
+/* Os HAL dependencies */
+# include "Os_Hal_CompilerInt.h"
+
+
+/***********************************************************************************************************************
+ *  GLOBAL CONSTANT MACROS
+ **********************************************************************************************************************/
+
+
+/***********************************************************************************************************************
+ *  GLOBAL FUNCTION MACROS
+ **********************************************************************************************************************/
+
+
+/***********************************************************************************************************************
+ *  GLOBAL DATA TYPES AND STRUCTURES
+ **********************************************************************************************************************/
+
+
+/***********************************************************************************************************************
+ *  GLOBAL DATA PROTOTYPES
+ **********************************************************************************************************************/
+
+
+/***********************************************************************************************************************
+ *  GLOBAL FUNCTION PROTOTYPES
+ **********************************************************************************************************************/
+
+# define OS_START_SEC_CODE
+# include "Os_MemMap_OsCode.h"                                                                                          /* PRQA S 5087 */ /* MD_MSR_MemMap */
+
+/***********************************************************************************************************************
+ *  Os_TimingWheelInit()
+ **********************************************************************************************************************/
+/*! \brief          Initialize the given timing wheel. This function has to be called for each wheel once.
+ *                  Any other operation on a wheel instance may only be performed after calling Os_TimingWheelInit.
+ *  \details        --no details--
+ *
+ *  \param[in,out]  TimingWheel   The timing wheel to be initialized. Parameter must not be NULL.
+ *
+ *  \context        OS_INTERNAL
+ *
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *
+ *  \pre            Concurrent access to given object is prevented by caller.
+ **********************************************************************************************************************/
+FUNC(void, OS_CODE) Os_TimingWheelInit
+(
+  P2CONST(Os_TimingWheelConfigType, AUTOMATIC, OS_CONST) TimingWheel
+);
+
+
+/***********************************************************************************************************************
+ *  Os_TimingWheelInsert()
+ **********************************************************************************************************************/
+/*! \brief          Inserts a job which expires Delay ticks after the current wheel time.
+ *  \details        A Delay of zero marks the job as expired.
+ *
+ *  \param[in,out]  TimingWheel   The timing wheel. Parameter must not be NULL.
+ *  \param[in]      Job           The job which shall be inserted. Parameter must not be NULL.
+ *  \param[in]      Delay         Number of ticks until the job expires.
+ *
+ *  \retval         !0    The next event of the wheel has changed.
+ *  \retval         0     The next event of the wheel is unchanged.
+ *
+ *  \context        OS_INTERNAL
+ *
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *
+ *  \pre            Concurrent access to given object is prevented by caller.
+ *  \pre            The job is not part of any job store.
+ **********************************************************************************************************************/
+FUNC(Os_StdReturnType, OS_CODE) Os_TimingWheelInsert
+(
+  P2CONST(Os_TimingWheelConfigType, AUTOMATIC, OS_CONST) TimingWheel,
+  P2CONST(Os_JobConfigType, AUTOMATIC, OS_APPL_DATA) Job,
+  Os_TimingWheelTimeType Delay
+);
+
+
+/***********************************************************************************************************************
+ *  Os_TimingWheelDelete()
+ **********************************************************************************************************************/
+/*! \brief          Removes the given job from the wheel.
+ *  \details        The deleted job does not have to be expired.
+ *
+ *  \param[in,out]  TimingWheel   The timing wheel. Parameter must not be NULL.
+ *  \param[in]      Job           The job which shall be deleted. Parameter must not be NULL.
+ *
+ *  \retval         !0    The next event of the wheel has changed or the wheel is empty now.
+ *  \retval         0     The next event of the wheel is unchanged.
+ *
+ *  \context        OS_INTERNAL
+ *
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *
+ *  \pre            Concurrent access to given object is prevented by caller.
+ *  \pre            The job is part of the given wheel.
+ **********************************************************************************************************************/
+FUNC(Os_StdReturnType, OS_CODE) Os_TimingWheelDelete
+(
+  P2CONST(Os_TimingWheelConfigType, AUTOMATIC, OS_CONST) TimingWheel,
+  P2CONST(Os_JobConfigType, AUTOMATIC, OS_APPL_DATA) Job
+);
+
+
+/***********************************************************************************************************************
+ *  Os_TimingWheelDeleteTop()
+ **********************************************************************************************************************/
+/*! \brief          Deletes the job returned by Os_TimingWheelTopGet().
+ *  \details        --no details--
+ *
+ *  \param[in,out]  TimingWheel   The timing wheel. Parameter must not be NULL.
+ *
+ *  \context        OS_INTERNAL
+ *
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *
+ *  \pre            Concurrent access to given object is prevented by caller.
+ *  \pre            Os_TimingWheelTopGet() does not return NULL_PTR.
+ **********************************************************************************************************************/
+FUNC(void, OS_CODE) Os_TimingWheelDeleteTop
+(
+  P2CONST(Os_TimingWheelConfigType, AUTOMATIC, OS_CONST) TimingWheel
+);
+
+
+/***********************************************************************************************************************
+ *  Os_TimingWheelNextEventGet()
+ **********************************************************************************************************************/
+/*! \brief          Returns the number of ticks from the current wheel time until the next used slot is reached.
+ *  \details        The next event is either the expiration of a level 0 job or the cascading of a higher level slot.
+ *                  It is never later than the expiration of any job in the wheel.
+ *
+ *  \param[in]      TimingWheel   The timing wheel. Parameter must not be NULL.
+ *
+ *  \return         Ticks until the next event. Zero if there are expired jobs.
+ *
+ *  \context        OS_INTERNAL
+ *
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *
+ *  \pre            Concurrent access to given object is prevented by caller.
+ *  \pre            The wheel is not empty.
+ **********************************************************************************************************************/
+FUNC(Os_TimingWheelTimeType, OS_CODE) Os_TimingWheelNextEventGet
+(
+  P2CONST(Os_TimingWheelConfigType, AUTOMATIC, OS_CONST) TimingWheel
+);
+
+
+/***********************************************************************************************************************
+ *  Os_TimingWheelAdvance()
+ **********************************************************************************************************************/
+/*! \brief          Moves the wheel time forward and cascades the slot, which is reached.
+ *  \details        --no details--
+ *
+ *  \param[in,out]  TimingWheel   The timing wheel. Parameter must not be NULL.
+ *  \param[in]      Delay         Number of ticks to advance. Must not exceed Os_TimingWheelNextEventGet(), if the
+ *                                wheel is not empty.
+ *  \param[in]      Reference     Timer value of the new wheel time.
+ *
+ *  \context        OS_INTERNAL
+ *
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *
+ *  \pre            Concurrent access to given object is prevented by caller.
+ **********************************************************************************************************************/
+FUNC(void, OS_CODE) Os_TimingWheelAdvance
+(
+  P2CONST(Os_TimingWheelConfigType, AUTOMATIC, OS_CONST) TimingWheel,
+  Os_TimingWheelTimeType Delay,
+  Os_TickType Reference
+);
+
+
+/***********************************************************************************************************************
+ *  Os_TimingWheelTopGet()
+ **********************************************************************************************************************/
+/*! \brief          Returns an expired job.
+ *  \details        --no details--
+ *
+ *  \param[in]      TimingWheel   The timing wheel. Parameter must not be NULL.
+ *
+ *  \return         Returns an expired job.
+ *  \retval         NULL_PTR  If no job is expired at the current wheel time.
+ *
+ *  \context        OS_INTERNAL
+ *
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *
+ *  \pre            Concurrent access to given object is prevented by caller.
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(
+OS_LOCAL_INLINE P2CONST(Os_JobConfigType, AUTOMATIC, OS_CODE), OS_CODE, OS_ALWAYS_INLINE,
+Os_TimingWheelTopGet,
+(
+  P2CONST(Os_TimingWheelConfigType, AUTOMATIC, OS_CONST) TimingWheel
+));
+
+
+/***********************************************************************************************************************
+ *  Os_TimingWheelIsEmpty()
+ **********************************************************************************************************************/
+/*! \brief          Returns whether the wheel contains any job.
+ *  \details        --no details--
+ *
+ *  \param[in]      TimingWheel   The timing wheel. Parameter must not be NULL.
+ *
+ *  \retval         !0    The wheel is empty.
+ *  \retval         0     The wheel contains at least one job.
+ *
+ *  \context        OS_INTERNAL
+ *
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *
+ *  \pre            -
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE Os_StdReturnType, OS_CODE, OS_ALWAYS_INLINE,
+Os_TimingWheelIsEmpty,
+(
+  P2CONST(Os_TimingWheelConfigType, AUTOMATIC, OS_CONST) TimingWheel
+));
+
+
+/***********************************************************************************************************************
+ *  Os_TimingWheelReferenceGet()
+ **********************************************************************************************************************/
+/*! \brief          Returns the timer value of the current wheel time.
+ *  \details        --no details--
+ *
+ *  \param[in]      TimingWheel   The timing wheel. Parameter must not be NULL.
+ *
+ *  \return         The timer value of the current wheel time.
+ *
+ *  \context        OS_INTERNAL
+ *
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *
+ *  \pre            -
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE Os_TickType, OS_CODE, OS_ALWAYS_INLINE,
+Os_TimingWheelReferenceGet,
+(
+  P2CONST(Os_TimingWheelConfigType, AUTOMATIC, OS_CONST) TimingWheel
+));
+
+
+
+# define OS_STOP_SEC_CODE
+# include "Os_MemMap_OsCode.h"                                                                                          /* PRQA S 5087 */ /* MD_MSR_MemMap */
+
+
+#endif /* OS_TIMINGWHEELINT_H */
+
+/* module specific MISRA deviations:
+ *
+ */
+
+/*!
+ * \}
+ */
+
+/***********************************************************************************************************************
+ *  END OF FILE: Os_TimingWheelInt.h
+ **********************************************************************************************************************/
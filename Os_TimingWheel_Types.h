@@ -0,0 +1,145 @@
+/***********************************************************************************************************************
+ *  COPYRIGHT
+ *  --------------------------------------------------------------------------------------------------------------------
+ *  \verbatim
+ *  Copyright (c) 2021 by Vector Informatik GmbH.                                              All rights reserved.
+ *
+ *                This software is copyright protected and proprietary to Vector Informatik GmbH.
+ *                Vector Informatik GmbH grants to you only those rights as set out in the license conditions.
+ *                All other rights remain with Vector Informatik GmbH.
+ *  \endverbatim
+ *  --------------------------------------------------------------------------------------------------------------------
+ *  FILE DESCRIPTION
+ *  ------------------------------------------------------------------------------------------------------------------*/
+/**
+ * \addtogroup Os_TimingWheel
+ * \{
+ *
+ * \file
+ * \brief       Contains the timing wheel type definitions.
+ * \details     --no details--
+ *
+ **********************************************************************************************************************/
+/***********************************************************************************************************************
+ *  REVISION HISTORY
+ *  --------------------------------------------------------------------------------------------------------------------
+ *  Refer to Os.h.
+ **********************************************************************************************************************/
+
+#ifndef OS_TIMINGWHEEL_TYPES_H
+# define OS_TIMINGWHEEL_TYPES_H
+                                                                                                                         /* PRQA S 0388 EOF */ /* MD_MSR_Dir1.1 */
+/***********************************************************************************************************************
+ *  INCLUDES
+ **********************************************************************************************************************/
+/* AUTOSAR includes */
+# include "Std_Types.h"
+
+/* Os module declarations */
+
+/* Os kernel module dependencies */
+# include "Os_Types.h"
+# include "Os_Job_Types.h"
+
+
+
+/***********************************************************************************************************************
+ *  GLOBAL CONSTANT MACROS
+ **********************************************************************************************************************/
+/*! Number of time bits resolved by a single level. */
+# define OS_TIMINGWHEEL_SLOT_BITS               (5u)
+
+/*! Number of slots of a single level. Each level is tracked by one bit of a 32 bit occupation mask. */
+# define OS_TIMINGWHEEL_SLOTS_PER_LEVEL         ((uint32)1u << OS_TIMINGWHEEL_SLOT_BITS)
+
+/*! Mask which extracts the slot index of a level from a shifted wheel time. */
+# define OS_TIMINGWHEEL_SLOT_MASK               (OS_TIMINGWHEEL_SLOTS_PER_LEVEL - 1u)
+
+/*! Minimum number of levels. The highest level keeps jobs beyond the wheel range, which is not possible on level 0. */
+# define OS_TIMINGWHEEL_LEVELS_MIN              (2u)
+
+/*! Maximum number of levels. Six levels resolve 30 bits, which keeps all slot boundaries within the wheel time. */
+# define OS_TIMINGWHEEL_LEVELS_MAX              (6u)
+
+
+/***********************************************************************************************************************
+ *  GLOBAL FUNCTION MACROS
+ **********************************************************************************************************************/
+
+
+/***********************************************************************************************************************
+ *  GLOBAL DATA TYPES AND STRUCTURES
+ **********************************************************************************************************************/
+/*! Time in ticks, as seen by a timing wheel. The wheel time counts modulo 2^32 independent of the counter range. */
+typedef uint32 Os_TimingWheelTimeType;
+
+/*! Index of a slot within all slots of a timing wheel (Level * OS_TIMINGWHEEL_SLOTS_PER_LEVEL + Slot). */
+typedef uint16 Os_TimingWheelSlotIdxType;
+
+/*! Number of levels of a timing wheel. */
+typedef uint8 Os_TimingWheelLevelType;
+
+
+/*! A single slot of a timing wheel. */
+typedef struct
+{
+  P2CONST(Os_JobConfigType, AUTOMATIC, OS_APPL_DATA) First;     /*!< First job of the slot's list or NULL_PTR. */
+} Os_TimingWheelSlotType;
+
+
+/*! Timing wheel specific runtime data of a job. Only jobs of counters with a timing wheel reference this data. */
+typedef struct
+{
+  P2CONST(Os_JobConfigType, AUTOMATIC, OS_CONST) Next;          /*!< Next job in the same slot or NULL_PTR. */
+  P2CONST(Os_JobConfigType, AUTOMATIC, OS_CONST) Prev;          /*!< Previous job in the same slot. NULL_PTR, if the
+                                                                 *   job is the first one. */
+  Os_TimingWheelTimeType Timestamp;                             /*!< Expiration time in the time base of the wheel. */
+  Os_TimingWheelSlotIdxType Slot;                               /*!< Index of the slot which holds the job. */
+} Os_TimingWheelJobType;
+
+
+/*! The runtime data of a timing wheel. */
+typedef struct
+{
+  Os_TimingWheelTimeType Time;                                  /*!< Current wheel time. */
+  Os_TickType Reference;                                        /*!< Timer value which corresponds to Time. */
+  uint32 JobCount;                                              /*!< Number of jobs in the wheel. */
+  uint32 Occupied[OS_TIMINGWHEEL_LEVELS_MAX];                   /*!< Per level: bit n is set, if slot n is used. */
+} Os_TimingWheelType;
+
+
+/*! The configuration data of a timing wheel. */
+typedef struct
+{
+  P2VAR(Os_TimingWheelSlotType, AUTOMATIC, OS_CONST) Slots;     /*!< LevelCount * OS_TIMINGWHEEL_SLOTS_PER_LEVEL
+                                                                 *   slots. */
+  P2VAR(Os_TimingWheelType, AUTOMATIC, OS_CONST) Dyn;           /*!< Points to the runtime data of the wheel. */
+  Os_TimingWheelLevelType LevelCount;                           /*!< Number of levels. Range: OS_TIMINGWHEEL_LEVELS_MIN
+                                                                 *   .. OS_TIMINGWHEEL_LEVELS_MAX. */
+} Os_TimingWheelConfigType;
+
+
+/***********************************************************************************************************************
+ *  GLOBAL DATA PROTOTYPES
+ **********************************************************************************************************************/
+
+
+/***********************************************************************************************************************
+ *  GLOBAL FUNCTION PROTOTYPES
+ **********************************************************************************************************************/
+
+
+
+
+#endif /* OS_TIMINGWHEEL_TYPES_H */
+
+/* module specific MISRA deviations:
+ */
+
+/*!
+ * \}
+ */
+
+/***********************************************************************************************************************
+ *  END OF FILE: Os_TimingWheel_Types.h
+ **********************************************************************************************************************/
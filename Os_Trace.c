@@ -40,6 +40,9 @@
 #include "Os_Trace.h"
 
 /* Os kernel module dependencies */
+#include "Os_Thread.h"
+#include "Os_Task.h"
+#include "Os_Isr.h"
 
 /* Os hal dependencies */
 
@@ -80,6 +83,85 @@
  *  GLOBAL FUNCTIONS
  **********************************************************************************************************************/
 
+/***********************************************************************************************************************
+ *  Os_Api_GetTaskAccounting()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ */
+FUNC(Os_StatusType, OS_CODE) Os_Api_GetTaskAccounting
+(
+  TaskType TaskID,
+  Os_ThreadAccountingRefType Accounting
+)
+{
+  Os_StatusType status;
+
+  /* #10 Perform error checks. */
+  if(Os_TraceIsAccountingEnabled() == 0u)                                                                               /* PRQA S 2992, 2996 */ /* MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2996 */
+  {
+    status = OS_STATUS_ACCOUNTING_DISABLED_BY_CONFIG;
+  }
+  else if(OS_UNLIKELY(Os_TaskCheckId(TaskID) == OS_CHECK_FAILED))
+  {
+    status = OS_STATUS_ID_1;
+  }
+  /* #20 Copy the accounting data. The copy is not atomic with respect to the core the task is assigned to. */
+  else
+  {
+    P2CONST(Os_TraceThreadConfigType, AUTOMATIC, OS_CONST) trace;
+
+    trace = Os_ThreadGetTrace(Os_TaskGetThread(Os_TaskId2Task(TaskID)));                                                /* SBSW_OS_TRACE_THREADGETTRACE_002 */ /* SBSW_OS_TRACE_TASKGETTHREAD_001 */
+    *Accounting = trace->Dyn->Accounting;                                                                               /* SBSW_OS_PWA_PRECONDITION */
+    status = OS_STATUS_OK;
+  }
+
+  return status;
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Api_GetISRAccounting()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ */
+FUNC(Os_StatusType, OS_CODE) Os_Api_GetISRAccounting
+(
+  ISRType ISRID,
+  Os_ThreadAccountingRefType Accounting
+)
+{
+  Os_StatusType status;
+
+  /* #10 Perform error checks. */
+  if(Os_TraceIsAccountingEnabled() == 0u)                                                                               /* PRQA S 2992, 2996 */ /* MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2996 */
+  {
+    status = OS_STATUS_ACCOUNTING_DISABLED_BY_CONFIG;
+  }
+  else if(OS_UNLIKELY(Os_IsrCheckId(ISRID) == OS_CHECK_FAILED))
+  {
+    status = OS_STATUS_ID_1;
+  }
+  /* #20 Copy the accounting data. The copy is not atomic with respect to the core the ISR is assigned to. */
+  else
+  {
+    P2CONST(Os_TraceThreadConfigType, AUTOMATIC, OS_CONST) trace;
+
+    trace = Os_ThreadGetTrace(Os_IsrGetThread(Os_IsrId2Isr(ISRID)));                                                    /* SBSW_OS_TRACE_THREADGETTRACE_003 */ /* SBSW_OS_TRACE_ISRGETTHREAD_001 */
+    *Accounting = trace->Dyn->Accounting;                                                                               /* SBSW_OS_PWA_PRECONDITION */
+    status = OS_STATUS_OK;
+  }
+
+  return status;
+}
+
 
 #define OS_STOP_SEC_CODE
 #include "Os_MemMap_OsCode.h"                                                                                           /* PRQA S 5087 */ /* MD_MSR_MemMap */
@@ -123,6 +205,48 @@
  \DESCRIPTION    Os_CoreCriticalUserSectionLeave is called with the return value of Os_Core2AsrCore.
  \COUNTERMEASURE \N [CM_OS_CORE2ASRCORE_N]
 
+\ID SBSW_OS_TRACE_COREGETTRACERECORDER_001
+ \DESCRIPTION    Os_CoreGetTraceRecorder is called with the return value of Os_CoreGetCurrentCore.
+ \COUNTERMEASURE \S [CM_OS_COREGETCURRENTCORE_S]
+
+\ID SBSW_OS_TRACE_RECORDER_DYN_001
+ \DESCRIPTION    Write access to the Dyn object of the trace recorder returned by Os_CoreGetTraceRecorder.
+ \COUNTERMEASURE \M [CM_OS_COREGETTRACERECORDER_M]
+
+\ID SBSW_OS_TRACE_RECORD_001
+ \DESCRIPTION    Write access to an element of the Buffer of the trace recorder returned by Os_CoreGetTraceRecorder.
+                 The index is limited by Mask.
+ \COUNTERMEASURE \M [CM_OS_COREGETTRACERECORDER_M]
+
+\ID SBSW_OS_TRACE_HAL_TIMERFRTGETCOUNTERVALUE_001
+ \DESCRIPTION    Os_Hal_TimerFrtGetCounterValue is called with the Timer of the trace recorder returned by
+                 Os_CoreGetTraceRecorder.
+ \COUNTERMEASURE \M [CM_OS_COREGETTRACERECORDER_M]
+
+\ID SBSW_OS_TRACE_HAL_TIMERFRTGETCOUNTERVALUE_002
+ \DESCRIPTION    Os_Hal_TimerFrtGetCounterValue is called with the return value of Os_CoreGetAccountingTimer.
+ \COUNTERMEASURE \M [CM_OS_COREGETACCOUNTINGTIMER_M]
+
+\ID SBSW_OS_TRACE_COREGETACCOUNTINGTIMER_001
+ \DESCRIPTION    Os_CoreGetAccountingTimer is called with the return value of Os_CoreGetCurrentCore.
+ \COUNTERMEASURE \S [CM_OS_COREGETCURRENTCORE_S]
+
+\ID SBSW_OS_TRACE_TASKGETTHREAD_001
+ \DESCRIPTION    Os_TaskGetThread is called with the return value of Os_TaskId2Task.
+ \COUNTERMEASURE \M [CM_OS_TASKID2TASK_M]
+
+\ID SBSW_OS_TRACE_THREADGETTRACE_002
+ \DESCRIPTION    Os_ThreadGetTrace is called with the return value of Os_TaskGetThread.
+ \COUNTERMEASURE \N [CM_OS_TASKGETTHREAD_N]
+
+\ID SBSW_OS_TRACE_ISRGETTHREAD_001
+ \DESCRIPTION    Os_IsrGetThread is called with the return value of Os_IsrId2Isr.
+ \COUNTERMEASURE \M [CM_OS_ISRID2ISR_M]
+
+\ID SBSW_OS_TRACE_THREADGETTRACE_003
+ \DESCRIPTION    Os_ThreadGetTrace is called with the return value of Os_IsrGetThread.
+ \COUNTERMEASURE \N [CM_OS_ISRGETTHREAD_N]
+
 SBSW_JUSTIFICATION_END */
 
 /*
@@ -50,6 +50,8 @@
 
 /* Os hal dependencies */
 # include "Os_Hal_Compiler.h"
+# include "Os_Hal_Interrupt.h"
+# include "Os_Hal_Timer.h"
 
 # if(OS_CFG_ORTI == STD_ON)
 #   include "Os_Orti.h"
@@ -598,6 +600,201 @@ OS_LOCAL_INLINE Os_StdReturnType, OS_CODE, OS_ALWAYS_INLINE, Os_TraceIsTimingHoo
 }
 
 
+/***********************************************************************************************************************
+ *  Os_TraceIsRecorderEnabled()
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DEFINITION(                                                                                           /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+OS_LOCAL_INLINE Os_StdReturnType, OS_CODE, OS_ALWAYS_INLINE, Os_TraceIsRecorderEnabled,
+( void ))
+{
+  return (Os_StdReturnType)(OS_CFG_TRACE_RECORDER == STD_ON);                                                           /* PRQA S 4304, 2996 */ /* MD_Os_C90BooleanCompatibility, MD_Os_Rule2.2_2996 */
+}
+
+
+/***********************************************************************************************************************
+ *  Os_TraceRecorderWrite()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,                                           /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+Os_TraceRecorderWrite,
+(
+  Os_TraceRecordEventType EventId,
+  uint16 ObjectId,
+  uint8 Info
+))
+{
+  /* - #10 Check if the trace recorder is enabled. */
+  if(Os_TraceIsRecorderEnabled() != 0u)                                                                                 /* PRQA S 2992, 2996 */ /* MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2996 */
+  {
+    P2CONST(Os_TraceRecorderConfigType, AUTOMATIC, OS_CONST) recorder;
+    P2VAR(Os_TraceRecordType, AUTOMATIC, OS_VAR_NOINIT) record;
+    Os_Hal_IntGlobalStateType interruptState;
+
+    recorder = Os_CoreGetTraceRecorder(Os_CoreGetCurrentCore());                                                        /* SBSW_OS_TRACE_COREGETTRACERECORDER_001 */
+
+    /* - #20 Disable interrupts of the local core, so that a nested hook cannot take the same slot. */
+    interruptState = Os_Hal_IntDisableAndReturnGlobalState();
+
+    /* - #30 Take the next slot of the ring buffer. If the ring buffer is full, the oldest record is overwritten. */
+    record = &(recorder->Buffer[recorder->Dyn->WriteCount & recorder->Mask]);
+    recorder->Dyn->WriteCount++;                                                                                        /* SBSW_OS_TRACE_RECORDER_DYN_001 */
+
+    /* - #40 Fill the record. */
+    record->Timestamp = (uint32)Os_Hal_TimerFrtGetCounterValue(recorder->Timer);                                        /* SBSW_OS_TRACE_RECORD_001 */ /* SBSW_OS_TRACE_HAL_TIMERFRTGETCOUNTERVALUE_001 */
+    record->ObjectId = ObjectId;                                                                                        /* SBSW_OS_TRACE_RECORD_001 */
+    record->EventId = (uint8)EventId;                                                                                   /* SBSW_OS_TRACE_RECORD_001 */
+    record->Info = Info;                                                                                                /* SBSW_OS_TRACE_RECORD_001 */
+
+    /* - #50 Restore the interrupt state. */
+    Os_Hal_IntSetGlobalState(&interruptState);                                                                          /* SBSW_OS_FC_POINTER2LOCAL */
+  }
+}
+
+
+/***********************************************************************************************************************
+ *  Os_TraceIsAccountingEnabled()
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DEFINITION(                                                                                           /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+OS_LOCAL_INLINE Os_StdReturnType, OS_CODE, OS_ALWAYS_INLINE, Os_TraceIsAccountingEnabled,
+( void ))
+{
+  return (Os_StdReturnType)(OS_CFG_THREAD_ACCOUNTING == STD_ON);                                                        /* PRQA S 4304, 2996 */ /* MD_Os_C90BooleanCompatibility, MD_Os_Rule2.2_2996 */
+}
+
+
+/***********************************************************************************************************************
+ *  Os_TraceAccountingActivate()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,                                           /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+Os_TraceAccountingActivate,
+(
+  P2CONST(Os_TraceThreadConfigType, AUTOMATIC, OS_CONST) Thread
+))
+{
+  /* - #10 Check if runtime accounting is enabled and the thread is a task or ISR. */
+  if((Os_TraceIsAccountingEnabled() != 0u) && (Thread->Type != OS_TRACE_THREAD_TYPE_MISC))                              /* PRQA S 2992, 2996 */ /* MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2996 */
+  {
+    P2VAR(Os_TraceThreadType, AUTOMATIC, OS_VAR_NOINIT) dyn;
+    dyn = Thread->Dyn;
+
+    /* - #20 Count the activation. */
+    dyn->Accounting.ActivationCount++;                                                                                  /* SBSW_OS_TRACE_GETDYN_001 */
+
+    /* - #30 If the thread has no pending job, the response time of the new job starts now. */
+    if(dyn->PendingJobs == 0u)
+    {
+      dyn->ActivationTime = Os_Hal_TimerFrtGetCounterValue(                                                             /* SBSW_OS_TRACE_GETDYN_001 */ /* SBSW_OS_TRACE_HAL_TIMERFRTGETCOUNTERVALUE_002 */
+                              Os_CoreGetAccountingTimer(Os_CoreGetCurrentCore()));                                      /* SBSW_OS_TRACE_COREGETACCOUNTINGTIMER_001 */
+    }
+    dyn->PendingJobs++;                                                                                                 /* SBSW_OS_TRACE_GETDYN_001 */
+  }
+}
+
+
+/***********************************************************************************************************************
+ *  Os_TraceAccountingSwitch()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,                                           /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+Os_TraceAccountingSwitch,
+(
+  P2CONST(Os_TraceThreadConfigType, AUTOMATIC, OS_CONST) Current,
+  Os_TraceAccountingLeaveType Leave
+))
+{
+  /* - #10 Check if runtime accounting is enabled. */
+  if(Os_TraceIsAccountingEnabled() != 0u)                                                                               /* PRQA S 2992, 2996 */ /* MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2996 */
+  {
+    P2CONST(Os_CoreConfigType, AUTOMATIC, OS_CONST) core;
+    P2VAR(Os_TraceCoreType, AUTOMATIC, OS_VAR_NOINIT) trace;
+    Os_Hal_TimerFrtTickType now;
+
+    core = Os_CoreGetCurrentCore();
+    trace = Os_CoreGetTrace(core);                                                                                      /* SBSW_OS_TRACE_COREGETTRACE_002 */
+    now = Os_Hal_TimerFrtGetCounterValue(Os_CoreGetAccountingTimer(core));                                              /* SBSW_OS_TRACE_HAL_TIMERFRTGETCOUNTERVALUE_002 */ /* SBSW_OS_TRACE_COREGETACCOUNTINGTIMER_001 */
+
+    /* - #20 If a task or ISR leaves the CPU: */
+    if((Leave != OS_TRACE_ACCOUNTING_START) && (Current->Type != OS_TRACE_THREAD_TYPE_MISC))
+    {
+      P2VAR(Os_TraceThreadType, AUTOMATIC, OS_VAR_NOINIT) dyn;
+      dyn = Current->Dyn;
+
+      /* - #30 Account the elapsed execution slice. */
+      dyn->Accounting.ExecutionTime +=                                                                                  /* SBSW_OS_TRACE_GETDYN_001 */
+        (uint64)(Os_Hal_TimerFrtTickType)(now - trace->AccountingSliceStart);
+
+      /* - #40 Count a preemption. */
+      if(Leave == OS_TRACE_ACCOUNTING_PREEMPT)
+      {
+        dyn->Accounting.PreemptionCount++;                                                                              /* SBSW_OS_TRACE_GETDYN_001 */
+      }
+      /* - #50 If a job has terminated, update the response times. The next pending job starts now. */
+      else if((Leave == OS_TRACE_ACCOUNTING_TERMINATE) && (dyn->PendingJobs > 0u))
+      {
+        uint32 responseTime;
+        responseTime = (uint32)(Os_Hal_TimerFrtTickType)(now - dyn->ActivationTime);
+
+        if(responseTime > dyn->Accounting.MaxResponseTime)
+        {
+          dyn->Accounting.MaxResponseTime = responseTime;                                                               /* SBSW_OS_TRACE_GETDYN_001 */
+        }
+        if(responseTime < dyn->Accounting.MinResponseTime)
+        {
+          dyn->Accounting.MinResponseTime = responseTime;                                                               /* SBSW_OS_TRACE_GETDYN_001 */
+        }
+
+        dyn->PendingJobs--;                                                                                             /* SBSW_OS_TRACE_GETDYN_001 */
+        dyn->ActivationTime = now;                                                                                      /* SBSW_OS_TRACE_GETDYN_001 */
+      }
+      else
+      {
+        /* The thread waits or has been killed. */
+      }
+    }
+
+    /* - #60 Start the next execution slice. */
+    trace->AccountingSliceStart = now;                                                                                  /* SBSW_OS_TRACE_COREGETTRACE_001 */
+  }
+}
+
+
+/***********************************************************************************************************************
+ *  Os_TraceAccountingKill()
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,                                           /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */
+Os_TraceAccountingKill,
+(
+  P2CONST(Os_TraceThreadConfigType, AUTOMATIC, OS_CONST) Thread
+))
+{
+  /* - #10 Discard the pending jobs, so that no response time is recorded for them. */
+  if(Os_TraceIsAccountingEnabled() != 0u)                                                                               /* PRQA S 2992, 2996 */ /* MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2996 */
+  {
+    Thread->Dyn->PendingJobs = 0u;                                                                                      /* SBSW_OS_TRACE_GETDYN_001 */
+  }
+}
+
+
 /***********************************************************************************************************************
  *  Os_TraceIsScheduleTimingHookEnabled()
  **********************************************************************************************************************/
@@ -799,6 +996,17 @@ Os_TraceThreadInit,
       break;
     }
   }
+
+  /* - #30 Reset the runtime accounting data, if runtime accounting is enabled. */
+  if(Os_TraceIsAccountingEnabled() != 0u)                                                                               /* PRQA S 2992, 2996 */ /* MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2996 */
+  {
+    Thread->Dyn->Accounting.ExecutionTime = 0uLL;                                                                       /* SBSW_OS_TRACE_GETDYN_001 */
+    Thread->Dyn->Accounting.ActivationCount = 0uL;                                                                      /* SBSW_OS_TRACE_GETDYN_001 */
+    Thread->Dyn->Accounting.PreemptionCount = 0uL;                                                                      /* SBSW_OS_TRACE_GETDYN_001 */
+    Thread->Dyn->Accounting.MaxResponseTime = 0uL;                                                                      /* SBSW_OS_TRACE_GETDYN_001 */
+    Thread->Dyn->Accounting.MinResponseTime = 0xFFFFFFFFuL;                                                             /* SBSW_OS_TRACE_GETDYN_001 */
+    Thread->Dyn->PendingJobs = 0uL;                                                                                     /* SBSW_OS_TRACE_GETDYN_001 */
+  }
 }
 
 
@@ -850,6 +1058,9 @@ Os_TraceThreadInitAndStart,
     /* No initialization of NextRunReason necessary as it is anyhow setup when the task is left and
      * not needed before it gets active for the next time. */
   }
+
+  /* - #60 Start the first execution slice if runtime accounting is enabled. */
+  Os_TraceAccountingSwitch(Task, OS_TRACE_ACCOUNTING_START);                                                            /* SBSW_OS_FC_PRECONDITION */
 }
 
 /***********************************************************************************************************************
@@ -918,6 +1129,16 @@ Os_TraceThreadSwitch,
     core = Os_CoreGetCurrentCore();
     Os_CoreGetTrace(core)->CurrentTask = Next;                                                                          /* SBSW_OS_TRACE_COREGETTRACE_001 */ /* SBSW_OS_TRACE_COREGETTRACE_002 */
   }
+
+  /* - #70 Account the execution slice of the current task if runtime accounting is enabled. */
+  if(CurrentTaskState == WAITING)
+  {
+    Os_TraceAccountingSwitch(Current, OS_TRACE_ACCOUNTING_WAIT);                                                        /* SBSW_OS_FC_PRECONDITION */
+  }
+  else
+  {
+    Os_TraceAccountingSwitch(Current, OS_TRACE_ACCOUNTING_PREEMPT);                                                     /* SBSW_OS_FC_PRECONDITION */
+  }
 }                                                                                                                       /* PRQA S 6050 */ /* MD_MSR_STCAL */
 
 
@@ -975,6 +1196,9 @@ Os_TraceThreadResetAndResume,
     core = Os_CoreGetCurrentCore();
     Os_CoreGetTrace(core)->CurrentTask = Next;                                                                          /* SBSW_OS_TRACE_COREGETTRACE_001 */ /* SBSW_OS_TRACE_COREGETTRACE_002 */
   }
+
+  /* - #70 Account the last execution slice and the response time of the terminated thread. */
+  Os_TraceAccountingSwitch(Current, OS_TRACE_ACCOUNTING_TERMINATE);                                                     /* SBSW_OS_FC_PRECONDITION */
 }                                                                                                                       /* PRQA S 6050 */ /* MD_MSR_STCAL */
 
 
@@ -1052,6 +1276,9 @@ Os_TraceThreadCleanupAndResume,
       trace->CurrentTask = Next;                                                                                        /* SBSW_OS_TRACE_COREGETTRACE_001 */
     }
   }
+
+  /* - #80 Account the last execution slice and the response time of the terminated thread. */
+  Os_TraceAccountingSwitch(Current, OS_TRACE_ACCOUNTING_TERMINATE);                                                     /* SBSW_OS_FC_PRECONDITION */
 }                                                                                                                       /* PRQA S 6050 */ /* MD_MSR_STCAL */
 
 
@@ -1110,6 +1337,10 @@ Os_TraceThreadSuspendAndStart,
     core = Os_CoreGetCurrentCore();
     Os_CoreGetTrace(core)->CurrentIsr = Next;                                                                           /* SBSW_OS_TRACE_COREGETTRACE_001 */ /* SBSW_OS_TRACE_COREGETTRACE_002 */
   }
+
+  /* - #70 Account the activation of the started ISR and the preemption of the current thread. */
+  Os_TraceAccountingActivate(Next);                                                                                     /* SBSW_OS_FC_PRECONDITION */
+  Os_TraceAccountingSwitch(Current, OS_TRACE_ACCOUNTING_PREEMPT);                                                       /* SBSW_OS_FC_PRECONDITION */
 }                                                                                                                       /* PRQA S 6050 */ /* MD_MSR_STCAL */
 
 
@@ -1150,6 +1381,9 @@ Os_TraceIsrKill,
     /* - #50 Leave critical user section. */
     Os_CoreCriticalUserSectionLeave(coreAsr);                                                                           /* SBSW_OS_TRACE_CORECRITICALUSERSECTIONLEAVE_001 */
   }
+
+  /* - #60 Discard the pending job of the killed ISR. */
+  Os_TraceAccountingKill(KilledIsr);                                                                                    /* SBSW_OS_FC_PRECONDITION */
 }
 
 
@@ -1203,6 +1437,9 @@ Os_TraceTaskKill,
       Os_CoreCriticalUserSectionLeave(coreAsr);                                                                         /* SBSW_OS_TRACE_CORECRITICALUSERSECTIONLEAVE_001 */
     }
   }
+
+  /* - #70 Discard the pending jobs of the killed task. */
+  Os_TraceAccountingKill(KilledTask);                                                                                   /* SBSW_OS_FC_PRECONDITION */
 }                                                                                                                       /* PRQA S 6050 */ /* MD_MSR_STCAL */
 
 
@@ -1243,6 +1480,9 @@ Os_TraceTaskActivate,
     /* - #40 Leave critical user section. */
     Os_CoreCriticalUserSectionLeave(coreAsr);                                                                           /* SBSW_OS_TRACE_CORECRITICALUSERSECTIONLEAVE_001 */
   }
+
+  /* - #50 Account the activation if runtime accounting is enabled. */
+  Os_TraceAccountingActivate(Task);                                                                                     /* SBSW_OS_FC_PRECONDITION */
 }
 
 /***********************************************************************************************************************
@@ -1776,6 +2016,9 @@ Os_TraceOrtiApiEntry,
     core = Os_CoreGetCurrentCore();
     Os_CoreGetTrace(core)->OrtiCurrentServiceId = ((uint8) ServiceId) + (uint8)1;                                       /* SBSW_OS_TRACE_COREGETTRACE_001 */ /* SBSW_OS_TRACE_COREGETTRACE_002 */
   }
+
+  /* - #20 Record the start of the OS Api if the trace recorder is enabled. */
+  Os_TraceRecorderWrite(OS_TRACE_RECORD_API_ENTRY, (uint16)ServiceId, 0u);
 }
 
 /***********************************************************************************************************************
@@ -1800,6 +2043,9 @@ Os_TraceOrtiApiExit,
     core = Os_CoreGetCurrentCore();
     Os_CoreGetTrace(core)->OrtiCurrentServiceId = ((uint8) ServiceId);                                                  /* SBSW_OS_TRACE_COREGETTRACE_001 */ /* SBSW_OS_TRACE_COREGETTRACE_002 */
   }
+
+  /* - #20 Record the end of the OS Api if the trace recorder is enabled. */
+  Os_TraceRecorderWrite(OS_TRACE_RECORD_API_EXIT, (uint16)ServiceId, 0u);
 }
 
 
@@ -162,6 +162,43 @@
  *  respective task of ISR will usually not finish its job on time. The OS signals forcible termination by
  *  a call of the macro OS_VTH_FORCED_TERMINATION().
  *
+ *  Built-in trace recorder
+ *  -----------------------
+ *  If OS_CFG_TRACE_RECORDER is enabled, the OS provides an implementation of each timing hook which is not defined
+ *  by the user. These hooks and the ORTI service tracing write compact records (\ref Os_TraceRecordType_Tag) into a
+ *  ring buffer of the calling core (\ref Os_TraceRecorderConfigType_Tag). The time stamps are taken from the timer
+ *  which is configured for the recorder of the core.
+ *
+ *  Each ring buffer is only written by its own core. A record is written with disabled interrupts of the local core
+ *  for a few instructions. So writing a record never waits and needs no cross core synchronization. If the ring
+ *  buffer is full, the oldest records are overwritten.
+ *
+ *  A dump of a core consists of the ring buffer and the write counter (\ref Os_TraceRecorderType_Tag::WriteCount).
+ *  The latest record is located at index (WriteCount - 1) & Mask, the dump contains min(WriteCount, Mask + 1)
+ *  valid records. The meaning of ObjectId and Info is given by \ref Os_TraceRecordEventType. A host tool converts a
+ *  dump e.g. into Chrome trace JSON or CTF as follows:
+ *  - A OS_TRACE_RECORD_SCHEDULE record ends the execution slice of the thread, which has been started by the
+ *    previous OS_TRACE_RECORD_SCHEDULE record, and starts the slice of the thread ObjectId.
+ *  - The reason why a thread has left the CPU is not recorded. Due to the direct mapping of FromThreadReason and
+ *    ToThreadReason, it is the Info of the OS_TRACE_RECORD_SCHEDULE record which lets the thread run again.
+ *  - All other records are instant events or begin/end pairs (API entry/exit, lock taken/released).
+ *
+ *  Runtime accounting
+ *  ------------------
+ *  If OS_CFG_THREAD_ACCOUNTING is enabled, the thread switch functions above also accumulate per task and ISR the
+ *  execution time, the number of activations and preemptions and the minimum and maximum response time
+ *  (\ref Os_ThreadAccountingType). The time stamps are taken from the accounting timer of the core. The start of the
+ *  current execution slice is kept per core (\ref Os_TraceCoreType_Tag::AccountingSliceStart). Hooks have no own
+ *  accounting, their execution time is accounted to the thread which has called them.
+ *
+ *  A job of a task starts with its activation and ends with its termination. A job of an ISR starts with the
+ *  interrupt entry and ends with the interrupt exit. If a task is activated while it has a pending job, the response
+ *  time of the next job is measured from the termination of the previous job. Forcibly terminated jobs do not
+ *  record a response time.
+ *
+ *  The information is written only by the core which executes the thread and is read by \ref Os_GetTaskAccounting()
+ *  and \ref Os_GetISRAccounting() without synchronization.
+ *
  *  \{
  *
  *  \file
@@ -199,6 +236,8 @@
 
 /* Os Hal dependencies */
 # include "Os_Hal_CompilerInt.h"
+# include "Os_Hal_InterruptInt.h"
+# include "Os_Hal_TimerInt.h"
 
 
 # if(OS_CFG_ORTI == STD_ON)
@@ -213,6 +252,83 @@
 /***********************************************************************************************************************
  *  GLOBAL CONSTANT MACROS
  **********************************************************************************************************************/
+/*! The built-in trace recorder is not used, unless enabled by the configuration. */
+# ifndef OS_CFG_TRACE_RECORDER
+#  define OS_CFG_TRACE_RECORDER  STD_OFF
+# endif
+
+/*! Execution times of tasks and ISRs are not accumulated, unless enabled by the configuration. */
+# ifndef OS_CFG_THREAD_ACCOUNTING
+#  define OS_CFG_THREAD_ACCOUNTING  STD_OFF
+# endif
+
+/* If the built-in trace recorder is enabled, it implements all timing hooks which are not defined by the user. */
+# if (OS_CFG_TRACE_RECORDER == STD_ON)
+#  ifndef OS_VTH_SCHEDULE
+#   define OS_VTH_SCHEDULE(FromThreadId,FromThreadReason,ToThreadId,ToThreadReason,CallerCoreId) \
+   Os_TraceRecorderWrite(OS_TRACE_RECORD_SCHEDULE, (uint16)(ToThreadId), (uint8)(ToThreadReason));
+#  endif
+#  ifndef OS_VTH_FORCED_TERMINATION
+#   define OS_VTH_FORCED_TERMINATION(ThreadId,CallerCoreId) \
+   Os_TraceRecorderWrite(OS_TRACE_RECORD_FORCED_TERMINATION, (uint16)(ThreadId), 0u);
+#  endif
+#  ifndef OS_VTH_ACTIVATION
+#   define OS_VTH_ACTIVATION(TaskId, DestCoreId, CallerCoreId) \
+   Os_TraceRecorderWrite(OS_TRACE_RECORD_ACTIVATION, (uint16)(TaskId), (uint8)(DestCoreId));
+#  endif
+#  ifndef OS_VTH_ACTIVATION_LIMIT
+#   define OS_VTH_ACTIVATION_LIMIT(TaskId, DestCoreId, CallerCoreId) \
+   Os_TraceRecorderWrite(OS_TRACE_RECORD_ACTIVATION_LIMIT, (uint16)(TaskId), (uint8)(DestCoreId));
+#  endif
+#  ifndef OS_VTH_SETEVENT
+#   define OS_VTH_SETEVENT(TaskId, EventMask, StateChanged, DestCoreId, CallerCoreId) \
+   Os_TraceRecorderWrite(OS_TRACE_RECORD_SETEVENT, (uint16)(TaskId), (uint8)((StateChanged) != 0u));
+#  endif
+#  ifndef OS_VTH_WAITEVENT_NOWAIT
+#   define OS_VTH_WAITEVENT_NOWAIT(TaskId, EventMask, DestCoreId, CallerCoreId) \
+   Os_TraceRecorderWrite(OS_TRACE_RECORD_WAITEVENT_NOWAIT, (uint16)(TaskId), 0u);
+#  endif
+#  ifndef OS_VTH_GOT_RES
+#   define OS_VTH_GOT_RES(ResId, CallerCoreId) \
+   Os_TraceRecorderWrite(OS_TRACE_RECORD_GOT_RES, (uint16)(ResId), 0u);
+#  endif
+#  ifndef OS_VTH_REL_RES
+#   define OS_VTH_REL_RES(ResId, CallerCoreId) \
+   Os_TraceRecorderWrite(OS_TRACE_RECORD_REL_RES, (uint16)(ResId), 0u);
+#  endif
+#  ifndef OS_VTH_REQ_SPINLOCK
+#   define OS_VTH_REQ_SPINLOCK(SpinlockId, CallerCoreId) \
+   Os_TraceRecorderWrite(OS_TRACE_RECORD_REQ_SPINLOCK, (uint16)(SpinlockId), 0u);
+#  endif
+#  ifndef OS_VTH_GOT_SPINLOCK
+#   define OS_VTH_GOT_SPINLOCK(SpinlockId, CallerCoreId) \
+   Os_TraceRecorderWrite(OS_TRACE_RECORD_GOT_SPINLOCK, (uint16)(SpinlockId), 0u);
+#  endif
+#  ifndef OS_VTH_REL_SPINLOCK
+#   define OS_VTH_REL_SPINLOCK(SpinlockId, CallerCoreId) \
+   Os_TraceRecorderWrite(OS_TRACE_RECORD_REL_SPINLOCK, (uint16)(SpinlockId), 0u);
+#  endif
+#  ifndef OS_VTH_REQ_ISPINLOCK
+#   define OS_VTH_REQ_ISPINLOCK(SpinlockId, CallerCoreId) \
+   Os_TraceRecorderWrite(OS_TRACE_RECORD_REQ_ISPINLOCK, (uint16)(SpinlockId), 0u);
+#  endif
+#  ifndef OS_VTH_GOT_ISPINLOCK
+#   define OS_VTH_GOT_ISPINLOCK(SpinlockId, CallerCoreId) \
+   Os_TraceRecorderWrite(OS_TRACE_RECORD_GOT_ISPINLOCK, (uint16)(SpinlockId), 0u);
+#  endif
+#  ifndef OS_VTH_REL_ISPINLOCK
+#   define OS_VTH_REL_ISPINLOCK(SpinlockId, CallerCoreId) \
+   Os_TraceRecorderWrite(OS_TRACE_RECORD_REL_ISPINLOCK, (uint16)(SpinlockId), 0u);
+#  endif
+#  ifndef OS_VTH_DISABLEDINT
+#   define OS_VTH_DISABLEDINT(IntLockId, CallerCoreId) \
+   Os_TraceRecorderWrite(OS_TRACE_RECORD_DISABLEDINT, (uint16)(IntLockId), 0u);
+#  endif
+#  ifndef OS_VTH_ENABLEDINT
+#   define OS_VTH_ENABLEDINT(IntLockId, CallerCoreId) \
+   Os_TraceRecorderWrite(OS_TRACE_RECORD_ENABLEDINT, (uint16)(IntLockId), 0u);
+#  endif
+# endif
 
 /* The OS_IS_DEFINED_ macros below are necessary as Doxygen cannot handle the following sequence correctly:
  * #ifndef   SOME_MACRO
@@ -477,10 +593,59 @@ typedef enum
   OsOrtiApiIdInitialEnableInterruptSources = 0xD2u,  /*!< Os_InitialEnableInterruptSources() */
   OsOrtiApiIdGetCoreStartState             = 0xD4u,  /*!< Os_GetCoreStartState() */
   OsOrtiApiIdGetExceptionAddress           = 0xD6u,  /*!< Os_GetExceptionAddress() */
-  OsOrtiApiIdGetNonTrustedFunctionStackUsage = 0xD8u /*!< Os_GetNonTrustedFunctionStackUsage() */
+  OsOrtiApiIdGetNonTrustedFunctionStackUsage = 0xD8u, /*!< Os_GetNonTrustedFunctionStackUsage() */
+  OsOrtiApiIdGetSpinlockStatistics         = 0xDAu,  /*!< Os_GetSpinlockStatistics() */
+  OsOrtiApiIdGetTaskStateAsync             = 0xDCu,  /*!< Os_GetTaskStateAsync() */
+  OsOrtiApiIdGetAlarmAsync                 = 0xDEu,  /*!< Os_GetAlarmAsync() */
+  OsOrtiApiIdGetCounterValueAsync          = 0xE0u,  /*!< Os_GetCounterValueAsync() */
+  OsOrtiApiIdGetAsyncCallResult            = 0xE2u,  /*!< Os_GetAsyncCallResult() */
+  OsOrtiApiIdGetTaskAccounting             = 0xE4u,  /*!< Os_GetTaskAccounting() */
+  OsOrtiApiIdGetISRAccounting              = 0xE6u,  /*!< Os_GetISRAccounting() */
+  OsOrtiApiIdScanStackUsage                = 0xE8u,  /*!< Os_ScanStackUsage() */
+  OsOrtiApiIdGetNtfStackPoolStatistics     = 0xEAu,  /*!< Os_GetNtfStackPoolStatistics() */
+  OsOrtiApiIdActivateTaskSet               = 0xECu,  /*!< Os_ActivateTaskSet() */
+  OsOrtiApiIdGetMpSkippedSwitches          = 0xEEu   /*!< Os_GetMpSkippedSwitches() */
   /* All numbers should be even. */
 } OsOrtiApiIdType;
 
+/*! \brief    Identifies the kind of a record of the built-in trace recorder.
+ *  \details  The comments give the meaning of ObjectId and Info of the record.
+ */
+typedef enum
+{
+  OS_TRACE_RECORD_SCHEDULE           = 0x01u,  /*!< OS_VTH_SCHEDULE(): ToThreadId, ToThreadReason */
+  OS_TRACE_RECORD_FORCED_TERMINATION = 0x02u,  /*!< OS_VTH_FORCED_TERMINATION(): ThreadId, 0 */
+  OS_TRACE_RECORD_ACTIVATION         = 0x03u,  /*!< OS_VTH_ACTIVATION(): TaskId, DestCoreId */
+  OS_TRACE_RECORD_ACTIVATION_LIMIT   = 0x04u,  /*!< OS_VTH_ACTIVATION_LIMIT(): TaskId, DestCoreId */
+  OS_TRACE_RECORD_SETEVENT           = 0x05u,  /*!< OS_VTH_SETEVENT(): TaskId, 1 if StateChanged else 0 */
+  OS_TRACE_RECORD_WAITEVENT_NOWAIT   = 0x06u,  /*!< OS_VTH_WAITEVENT_NOWAIT(): TaskId, 0 */
+  OS_TRACE_RECORD_GOT_RES            = 0x07u,  /*!< OS_VTH_GOT_RES(): ResId, 0 */
+  OS_TRACE_RECORD_REL_RES            = 0x08u,  /*!< OS_VTH_REL_RES(): ResId, 0 */
+  OS_TRACE_RECORD_REQ_SPINLOCK       = 0x09u,  /*!< OS_VTH_REQ_SPINLOCK(): SpinlockId, 0 */
+  OS_TRACE_RECORD_GOT_SPINLOCK       = 0x0Au,  /*!< OS_VTH_GOT_SPINLOCK(): SpinlockId, 0 */
+  OS_TRACE_RECORD_REL_SPINLOCK       = 0x0Bu,  /*!< OS_VTH_REL_SPINLOCK(): SpinlockId, 0 */
+  OS_TRACE_RECORD_REQ_ISPINLOCK      = 0x0Cu,  /*!< OS_VTH_REQ_ISPINLOCK(): SpinlockId, 0 */
+  OS_TRACE_RECORD_GOT_ISPINLOCK      = 0x0Du,  /*!< OS_VTH_GOT_ISPINLOCK(): SpinlockId, 0 */
+  OS_TRACE_RECORD_REL_ISPINLOCK      = 0x0Eu,  /*!< OS_VTH_REL_ISPINLOCK(): SpinlockId, 0 */
+  OS_TRACE_RECORD_DISABLEDINT        = 0x0Fu,  /*!< OS_VTH_DISABLEDINT(): IntLockId, 0 */
+  OS_TRACE_RECORD_ENABLEDINT         = 0x10u,  /*!< OS_VTH_ENABLEDINT(): IntLockId, 0 */
+  OS_TRACE_RECORD_API_ENTRY          = 0x11u,  /*!< Os_TraceOrtiApiEntry(): OsOrtiApiIdType, 0 */
+  OS_TRACE_RECORD_API_EXIT           = 0x12u   /*!< Os_TraceOrtiApiExit(): OsOrtiApiIdType, 0 */
+} Os_TraceRecordEventType;
+
+/*! Defines why a thread leaves the CPU for the runtime accounting. */
+typedef enum
+{
+  /*! No thread leaves the CPU, the first thread of the core is started. */
+  OS_TRACE_ACCOUNTING_START,
+  /*! The thread is preempted by a task or interrupted by an ISR. */
+  OS_TRACE_ACCOUNTING_PREEMPT,
+  /*! The thread waits for an event. */
+  OS_TRACE_ACCOUNTING_WAIT,
+  /*! The thread has finished its job. */
+  OS_TRACE_ACCOUNTING_TERMINATE
+}Os_TraceAccountingLeaveType;
+
 /*! Defines the thread type. */
 typedef enum
 {
@@ -502,6 +667,12 @@ struct Os_TraceThreadType_Tag
 {
   /*! The next run reason of this thread. */
   Os_TraceThreadRunReason NextRunReason;
+  /*! The runtime accounting information of this thread. */
+  Os_ThreadAccountingType Accounting;
+  /*! The activation time of the oldest pending job (runtime accounting only). */
+  Os_Hal_TimerFrtTickType ActivationTime;
+  /*! The number of jobs which have been activated but have not terminated yet (runtime accounting only). */
+  uint32 PendingJobs;
 };
 
 /*! Trace configuration data of a thread.
@@ -527,6 +698,8 @@ struct Os_TraceCoreType_Tag
     P2CONST(Os_TraceThreadConfigType, TYPEDEF, OS_CONST) CurrentIsr;
     /*! the currently traced API service */
     uint8 OrtiCurrentServiceId;
+    /*! Start time of the current execution slice (runtime accounting only) */
+    Os_Hal_TimerFrtTickType AccountingSliceStart;
 };
 
 /*! Defines the ID of spinlocks and internal spinlocks for tracing */
@@ -535,6 +708,39 @@ struct Os_TraceSpinlockConfigType_Tag
     Os_TraceSpinlockIdType SpinlockId;
 };
 
+/*! One record of the built-in trace recorder (8 bytes). */
+struct Os_TraceRecordType_Tag
+{
+  /*! Counter value of the recorder timer, when the record has been written. */
+  uint32 Timestamp;
+  /*! ID of the traced object (see \ref Os_TraceRecordEventType). */
+  uint16 ObjectId;
+  /*! Kind of the record (\ref Os_TraceRecordEventType). */
+  uint8 EventId;
+  /*! Record specific information (see \ref Os_TraceRecordEventType). */
+  uint8 Info;
+};
+
+/*! Dynamic data of the built-in trace recorder of a core. */
+struct Os_TraceRecorderType_Tag
+{
+  /*! Number of records written since reset. The next record is written to index (WriteCount & Mask). */
+  uint32 WriteCount;
+};
+
+/*! Configuration of the built-in trace recorder of a core. */
+struct Os_TraceRecorderConfigType_Tag
+{
+  /*! Dynamic data of the recorder. It is zero initialized, so that records can be written before StartOS(). */
+  P2VAR(Os_TraceRecorderType, TYPEDEF, OS_VAR_ZERO_INIT) Dyn;
+  /*! The ring buffer. */
+  P2VAR(Os_TraceRecordType, TYPEDEF, OS_VAR_NOINIT) Buffer;
+  /*! Number of elements of the ring buffer minus one. The number of elements is a power of two. */
+  uint32 Mask;
+  /*! The timer, which provides the time stamps. */
+  P2CONST(Os_Hal_TimerFrtConfigType, TYPEDEF, OS_CONST) Timer;
+};
+
 /***********************************************************************************************************************
  *  GLOBAL DATA PROTOTYPES
  **********************************************************************************************************************/
@@ -566,6 +772,142 @@ struct Os_TraceSpinlockConfigType_Tag
 OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE Os_StdReturnType, OS_CODE, OS_ALWAYS_INLINE,
 Os_TraceIsTimingHookEnabled, ( void ));
 
+/***********************************************************************************************************************
+ *  Os_TraceIsRecorderEnabled()
+ **********************************************************************************************************************/
+/*! \brief        Returns whether the built-in trace recorder is enabled or not.
+ *  \details      --no details--
+ *
+ *  \retval       !0    The trace recorder is enabled.
+ *  \retval       0     The trace recorder is disabled.
+ *
+ *  \context      OS_INTERNAL
+ *
+ *  \reentrant    TRUE
+ *  \synchronous  TRUE
+ *
+ *  \pre          -
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE Os_StdReturnType, OS_CODE, OS_ALWAYS_INLINE,
+Os_TraceIsRecorderEnabled, ( void ));
+
+/***********************************************************************************************************************
+ *  Os_TraceRecorderWrite()
+ **********************************************************************************************************************/
+/*! \brief        Appends a record to the trace recorder of the current core.
+ *  \details      The record is written with disabled interrupts of the local core, so that records of nested
+ *                hooks (e.g. DisableAllInterrupts() in a category 1 ISR) are not lost. The oldest record is
+ *                overwritten, if the ring buffer is full. Does nothing, if the trace recorder is disabled.
+ *
+ *  \param[in]    EventId   The kind of the record.
+ *  \param[in]    ObjectId  The ID of the traced object.
+ *  \param[in]    Info      Record specific information.
+ *
+ *  \context      OS_INTERNAL
+ *
+ *  \reentrant    TRUE
+ *  \synchronous  TRUE
+ *
+ *  \pre          Supervisor mode.
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,
+Os_TraceRecorderWrite,
+(
+  Os_TraceRecordEventType EventId,
+  uint16 ObjectId,
+  uint8 Info
+));
+
+/***********************************************************************************************************************
+ *  Os_TraceIsAccountingEnabled()
+ **********************************************************************************************************************/
+/*! \brief        Returns whether runtime accounting is enabled or not.
+ *  \details      --no details--
+ *
+ *  \retval       !0    Runtime accounting is enabled.
+ *  \retval       0     Runtime accounting is disabled.
+ *
+ *  \context      OS_INTERNAL
+ *
+ *  \reentrant    TRUE
+ *  \synchronous  TRUE
+ *
+ *  \pre          -
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE Os_StdReturnType, OS_CODE, OS_ALWAYS_INLINE,
+Os_TraceIsAccountingEnabled, ( void ));
+
+/***********************************************************************************************************************
+ *  Os_TraceAccountingActivate()
+ **********************************************************************************************************************/
+/*! \brief        Accounts the activation of a job of the given thread.
+ *  \details      Does nothing, if runtime accounting is disabled or the thread is no task or ISR.
+ *
+ *  \param[in]    Thread    The activated thread. Parameter must not be NULL.
+ *
+ *  \context      OS_INTERNAL
+ *
+ *  \reentrant    TRUE for different threads.
+ *  \synchronous  TRUE
+ *
+ *  \pre          Supervisor mode.
+ *  \pre          Interrupts locked to TP lock level.
+ *  \pre          The thread is executed by the current core.
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,
+Os_TraceAccountingActivate,
+(
+  P2CONST(Os_TraceThreadConfigType, AUTOMATIC, OS_CONST) Thread
+));
+
+/***********************************************************************************************************************
+ *  Os_TraceAccountingSwitch()
+ **********************************************************************************************************************/
+/*! \brief        Accounts the end of the current execution slice and starts a new one.
+ *  \details      The elapsed slice is accounted to the given thread. Does nothing, if runtime accounting is disabled.
+ *
+ *  \param[in]    Current   The thread which leaves the CPU. Ignored for OS_TRACE_ACCOUNTING_START.
+ *                          Parameter must not be NULL.
+ *  \param[in]    Leave     The reason why the thread leaves the CPU.
+ *
+ *  \context      OS_INTERNAL
+ *
+ *  \reentrant    TRUE for different cores.
+ *  \synchronous  TRUE
+ *
+ *  \pre          Supervisor mode.
+ *  \pre          Interrupts locked to TP lock level.
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,
+Os_TraceAccountingSwitch,
+(
+  P2CONST(Os_TraceThreadConfigType, AUTOMATIC, OS_CONST) Current,
+  Os_TraceAccountingLeaveType Leave
+));
+
+/***********************************************************************************************************************
+ *  Os_TraceAccountingKill()
+ **********************************************************************************************************************/
+/*! \brief        Discards the pending jobs of a forcibly terminated thread.
+ *  \details      Does nothing, if runtime accounting is disabled.
+ *
+ *  \param[in]    Thread    The killed thread. Parameter must not be NULL.
+ *
+ *  \context      OS_INTERNAL
+ *
+ *  \reentrant    TRUE for different threads.
+ *  \synchronous  TRUE
+ *
+ *  \pre          Supervisor mode.
+ *  \pre          Interrupts locked to TP lock level.
+ *  \pre          The thread is executed by the current core.
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,
+Os_TraceAccountingKill,
+(
+  P2CONST(Os_TraceThreadConfigType, AUTOMATIC, OS_CONST) Thread
+));
+
 /***********************************************************************************************************************
  *  Os_TraceIsScheduleTimingHookEnabled()
  **********************************************************************************************************************/
@@ -1454,6 +1796,60 @@ OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE Os_TraceSpinlockIdType, OS_CODE, O
 Os_TraceGetNumberOfConfiguredSpinlocks, ( void ));
 
 
+/***********************************************************************************************************************
+ *  Os_Api_GetTaskAccounting()
+ **********************************************************************************************************************/
+/*! \brief        OS service Os_GetTaskAccounting().
+ *  \details      For further details see Os_GetTaskAccounting().
+ *
+ *  \param[in]    TaskID            See Os_GetTaskAccounting().
+ *  \param[out]   Accounting        See Os_GetTaskAccounting().
+ *
+ *  \retval       OS_STATUS_OK                              No error.
+ *  \retval       OS_STATUS_ACCOUNTING_DISABLED_BY_CONFIG   Runtime accounting is not enabled in the configuration.
+ *  \retval       OS_STATUS_ID_1                            (EXTENDED status:) Invalid TaskID.
+ *
+ *  \context      TASK|ISR2
+ *
+ *  \reentrant    TRUE
+ *  \synchronous  TRUE
+ *
+ *  \pre          Accounting points to a writable object.
+ **********************************************************************************************************************/
+FUNC(Os_StatusType, OS_CODE) Os_Api_GetTaskAccounting
+(
+  TaskType TaskID,
+  Os_ThreadAccountingRefType Accounting
+);
+
+
+/***********************************************************************************************************************
+ *  Os_Api_GetISRAccounting()
+ **********************************************************************************************************************/
+/*! \brief        OS service Os_GetISRAccounting().
+ *  \details      For further details see Os_GetISRAccounting().
+ *
+ *  \param[in]    ISRID             See Os_GetISRAccounting().
+ *  \param[out]   Accounting        See Os_GetISRAccounting().
+ *
+ *  \retval       OS_STATUS_OK                              No error.
+ *  \retval       OS_STATUS_ACCOUNTING_DISABLED_BY_CONFIG   Runtime accounting is not enabled in the configuration.
+ *  \retval       OS_STATUS_ID_1                            (EXTENDED status:) Invalid ISRID.
+ *
+ *  \context      TASK|ISR2
+ *
+ *  \reentrant    TRUE
+ *  \synchronous  TRUE
+ *
+ *  \pre          Accounting points to a writable object.
+ **********************************************************************************************************************/
+FUNC(Os_StatusType, OS_CODE) Os_Api_GetISRAccounting
+(
+  ISRType ISRID,
+  Os_ThreadAccountingRefType Accounting
+);
+
+
 # define OS_STOP_SEC_CODE
 # include "Os_MemMap_OsCode.h"                                                                                          /* PRQA S 5087 */ /* MD_MSR_MemMap */
 
@@ -68,6 +68,15 @@ typedef struct Os_TraceCoreType_Tag Os_TraceCoreType;
 struct Os_TraceSpinlockConfigType_Tag;
 typedef struct Os_TraceSpinlockConfigType_Tag Os_TraceSpinlockConfigType;
 
+struct Os_TraceRecordType_Tag;
+typedef struct Os_TraceRecordType_Tag Os_TraceRecordType;
+
+struct Os_TraceRecorderType_Tag;
+typedef struct Os_TraceRecorderType_Tag Os_TraceRecorderType;
+
+struct Os_TraceRecorderConfigType_Tag;
+typedef struct Os_TraceRecorderConfigType_Tag Os_TraceRecorderConfigType;
+
 
 /***********************************************************************************************************************
  *  GLOBAL DATA PROTOTYPES
@@ -2321,6 +2321,299 @@ OS_ALWAYS_INLINE, Os_TrapCallTryToGetSpinlock,
 ));
 
 
+/***********************************************************************************************************************
+ *  Os_TrapCallGetSpinlockStatistics()
+ **********************************************************************************************************************/
+/*! \brief          OS service \ref Os_GetSpinlockStatistics().
+ *  \details        This function informs the trace module on entry and exit of the API Os_GetSpinlockStatistics().
+ *                  For further details see \ref Os_Api_GetSpinlockStatistics().
+ *
+ *  \param[in]      SpinlockId  See \ref Os_Api_GetSpinlockStatistics().
+ *  \param[in]      CoreID      See \ref Os_Api_GetSpinlockStatistics().
+ *  \param[out]     Statistics  See \ref Os_Api_GetSpinlockStatistics().
+ *
+ *  \return         See \ref Os_Api_GetSpinlockStatistics().
+ *
+ *  \context        OS_INTERNAL
+ *
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *
+ *  \pre             See \ref Os_Api_GetSpinlockStatistics().
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE Os_StatusType, OS_CODE,
+OS_ALWAYS_INLINE, Os_TrapCallGetSpinlockStatistics,
+(
+  SpinlockIdType SpinlockId,
+  CoreIdType CoreID,
+  Os_SpinlockStatisticsRefType Statistics
+));
+
+
+/***********************************************************************************************************************
+ *  Os_TrapCallGetTaskStateAsync()
+ **********************************************************************************************************************/
+/*! \brief          OS service \ref Os_GetTaskStateAsync().
+ *  \details        This function informs the trace module on entry and exit of the API Os_GetTaskStateAsync().
+ *                  For further details see \ref Os_Api_GetTaskStateAsync().
+ *
+ *  \param[in]      TaskID      See \ref Os_Api_GetTaskStateAsync().
+ *  \param[in]      Mask        See \ref Os_Api_GetTaskStateAsync().
+ *  \param[out]     Call        See \ref Os_Api_GetTaskStateAsync().
+ *
+ *  \return         See \ref Os_Api_GetTaskStateAsync().
+ *
+ *  \context        OS_INTERNAL
+ *
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *
+ *  \pre             See \ref Os_Api_GetTaskStateAsync().
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE Os_StatusType, OS_CODE,
+OS_ALWAYS_INLINE, Os_TrapCallGetTaskStateAsync,
+(
+  TaskType TaskID,
+  EventMaskType Mask,
+  Os_AsyncCallRefType Call
+));
+
+
+/***********************************************************************************************************************
+ *  Os_TrapCallGetAlarmAsync()
+ **********************************************************************************************************************/
+/*! \brief          OS service \ref Os_GetAlarmAsync().
+ *  \details        This function informs the trace module on entry and exit of the API Os_GetAlarmAsync().
+ *                  For further details see \ref Os_Api_GetAlarmAsync().
+ *
+ *  \param[in]      AlarmID     See \ref Os_Api_GetAlarmAsync().
+ *  \param[in]      Mask        See \ref Os_Api_GetAlarmAsync().
+ *  \param[out]     Call        See \ref Os_Api_GetAlarmAsync().
+ *
+ *  \return         See \ref Os_Api_GetAlarmAsync().
+ *
+ *  \context        OS_INTERNAL
+ *
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *
+ *  \pre             See \ref Os_Api_GetAlarmAsync().
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE Os_StatusType, OS_CODE,
+OS_ALWAYS_INLINE, Os_TrapCallGetAlarmAsync,
+(
+  AlarmType AlarmID,
+  EventMaskType Mask,
+  Os_AsyncCallRefType Call
+));
+
+
+/***********************************************************************************************************************
+ *  Os_TrapCallGetCounterValueAsync()
+ **********************************************************************************************************************/
+/*! \brief          OS service \ref Os_GetCounterValueAsync().
+ *  \details        This function informs the trace module on entry and exit of the API Os_GetCounterValueAsync().
+ *                  For further details see \ref Os_Api_GetCounterValueAsync().
+ *
+ *  \param[in]      CounterID   See \ref Os_Api_GetCounterValueAsync().
+ *  \param[in]      Mask        See \ref Os_Api_GetCounterValueAsync().
+ *  \param[out]     Call        See \ref Os_Api_GetCounterValueAsync().
+ *
+ *  \return         See \ref Os_Api_GetCounterValueAsync().
+ *
+ *  \context        OS_INTERNAL
+ *
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *
+ *  \pre             See \ref Os_Api_GetCounterValueAsync().
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE Os_StatusType, OS_CODE,
+OS_ALWAYS_INLINE, Os_TrapCallGetCounterValueAsync,
+(
+  CounterType CounterID,
+  EventMaskType Mask,
+  Os_AsyncCallRefType Call
+));
+
+
+/***********************************************************************************************************************
+ *  Os_TrapCallGetAsyncCallResult()
+ **********************************************************************************************************************/
+/*! \brief          OS service \ref Os_GetAsyncCallResult().
+ *  \details        This function informs the trace module on entry and exit of the API Os_GetAsyncCallResult().
+ *                  For further details see \ref Os_Api_GetAsyncCallResult().
+ *
+ *  \param[in,out]  Call        See \ref Os_Api_GetAsyncCallResult().
+ *
+ *  \return         See \ref Os_Api_GetAsyncCallResult().
+ *
+ *  \context        OS_INTERNAL
+ *
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *
+ *  \pre             See \ref Os_Api_GetAsyncCallResult().
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE Os_StatusType, OS_CODE,
+OS_ALWAYS_INLINE, Os_TrapCallGetAsyncCallResult,
+(
+  Os_AsyncCallRefType Call
+));
+
+/***********************************************************************************************************************
+ *  Os_TrapCallGetTaskAccounting()
+ **********************************************************************************************************************/
+/*! \brief          OS service \ref Os_GetTaskAccounting().
+ *  \details        This function informs the trace module on entry and exit of the API Os_GetTaskAccounting().
+ *                  For further details see \ref Os_Api_GetTaskAccounting().
+ *
+ *  \param[in]      TaskID      See \ref Os_Api_GetTaskAccounting().
+ *  \param[out]     Accounting  See \ref Os_Api_GetTaskAccounting().
+ *
+ *  \return         See \ref Os_Api_GetTaskAccounting().
+ *
+ *  \context        OS_INTERNAL
+ *
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *
+ *  \pre             See \ref Os_Api_GetTaskAccounting().
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE Os_StatusType, OS_CODE,
+OS_ALWAYS_INLINE, Os_TrapCallGetTaskAccounting,
+(
+  TaskType TaskID,
+  Os_ThreadAccountingRefType Accounting
+));
+
+/***********************************************************************************************************************
+ *  Os_TrapCallGetISRAccounting()
+ **********************************************************************************************************************/
+/*! \brief          OS service \ref Os_GetISRAccounting().
+ *  \details        This function informs the trace module on entry and exit of the API Os_GetISRAccounting().
+ *                  For further details see \ref Os_Api_GetISRAccounting().
+ *
+ *  \param[in]      ISRID       See \ref Os_Api_GetISRAccounting().
+ *  \param[out]     Accounting  See \ref Os_Api_GetISRAccounting().
+ *
+ *  \return         See \ref Os_Api_GetISRAccounting().
+ *
+ *  \context        OS_INTERNAL
+ *
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *
+ *  \pre             See \ref Os_Api_GetISRAccounting().
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE Os_StatusType, OS_CODE,
+OS_ALWAYS_INLINE, Os_TrapCallGetISRAccounting,
+(
+  ISRType ISRID,
+  Os_ThreadAccountingRefType Accounting
+));
+
+
+/***********************************************************************************************************************
+ *  Os_TrapCallScanStackUsage()
+ **********************************************************************************************************************/
+/*! \brief          OS service \ref Os_ScanStackUsage().
+ *  \details        This function informs the trace module on entry and exit of the API Os_ScanStackUsage().
+ *                  For further details see \ref Os_Api_ScanStackUsage().
+ *
+ *  \return         See \ref Os_Api_ScanStackUsage().
+ *
+ *  \context        OS_INTERNAL
+ *
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *
+ *  \pre             See \ref Os_Api_ScanStackUsage().
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE Os_StatusType, OS_CODE,
+OS_ALWAYS_INLINE, Os_TrapCallScanStackUsage,
+(
+  void
+));
+
+
+/***********************************************************************************************************************
+ *  Os_TrapCallGetNtfStackPoolStatistics()
+ **********************************************************************************************************************/
+/*! \brief          OS service \ref Os_GetNtfStackPoolStatistics().
+ *  \details        This function informs the trace module on entry and exit of the API Os_GetNtfStackPoolStatistics().
+ *                  For further details see \ref Os_Api_GetNtfStackPoolStatistics().
+ *
+ *  \param[in]      FunctionIndex  See \ref Os_Api_GetNtfStackPoolStatistics().
+ *  \param[out]     Statistics     See \ref Os_Api_GetNtfStackPoolStatistics().
+ *
+ *  \return         See \ref Os_Api_GetNtfStackPoolStatistics().
+ *
+ *  \context        OS_INTERNAL
+ *
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *
+ *  \pre             See \ref Os_Api_GetNtfStackPoolStatistics().
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE Os_StatusType, OS_CODE,
+OS_ALWAYS_INLINE, Os_TrapCallGetNtfStackPoolStatistics,
+(
+  Os_NonTrustedFunctionIndexType FunctionIndex,
+  Os_NtfStackPoolStatisticsRefType Statistics
+));
+
+
+/***********************************************************************************************************************
+ *  Os_TrapCallActivateTaskSet()
+ **********************************************************************************************************************/
+/*! \brief          OS service \ref Os_ActivateTaskSet().
+ *  \details        This function informs the trace module on entry and exit of the API Os_ActivateTaskSet().
+ *                  For further details see \ref Os_Api_ActivateTaskSet().
+ *
+ *  \param[in]      TaskSetID   See \ref Os_Api_ActivateTaskSet().
+ *
+ *  \return         See \ref Os_Api_ActivateTaskSet().
+ *
+ *  \context        OS_INTERNAL
+ *
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *
+ *  \pre             See \ref Os_Api_ActivateTaskSet().
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE Os_StatusType, OS_CODE,
+OS_ALWAYS_INLINE, Os_TrapCallActivateTaskSet,
+(
+  Os_TaskSetIdType TaskSetID
+));
+
+
+/***********************************************************************************************************************
+ *  Os_TrapCallGetMpSkippedSwitches()
+ **********************************************************************************************************************/
+/*! \brief          OS service \ref Os_GetMpSkippedSwitches().
+ *  \details        This function informs the trace module on entry and exit of the API Os_GetMpSkippedSwitches().
+ *                  For further details see \ref Os_Api_GetMpSkippedSwitches().
+ *
+ *  \param[in]      CoreID   See \ref Os_Api_GetMpSkippedSwitches().
+ *
+ *  \return         See \ref Os_Api_GetMpSkippedSwitches().
+ *
+ *  \context        OS_INTERNAL
+ *
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *
+ *  \pre             See \ref Os_Api_GetMpSkippedSwitches().
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE uint32, OS_CODE,
+OS_ALWAYS_INLINE, Os_TrapCallGetMpSkippedSwitches,
+(
+  CoreIdType CoreID
+));
+
+
 /***********************************************************************************************************************
  *  Os_TrapCallGetTaskStackUsage()
  **********************************************************************************************************************/
@@ -5461,7 +5754,7 @@ OS_ALWAYS_INLINE, Os_TrapCallTryToGetSpinlock,
 
 
 /***********************************************************************************************************************
- *  Os_TrapCallGetTaskStackUsage()
+ *  Os_TrapCallGetSpinlockStatistics()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -5470,29 +5763,31 @@ OS_ALWAYS_INLINE, Os_TrapCallTryToGetSpinlock,
  *
  *
  */
-OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE uint32, OS_CODE,
-OS_ALWAYS_INLINE, Os_TrapCallGetTaskStackUsage,
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE Os_StatusType, OS_CODE,
+OS_ALWAYS_INLINE, Os_TrapCallGetSpinlockStatistics,
 (
-  TaskType TaskID
+  SpinlockIdType SpinlockId,
+  CoreIdType CoreID,
+  Os_SpinlockStatisticsRefType Statistics
 ))
 {
-  uint32 result;
+  Os_StatusType status;
 
   /* #10 Inform the trace module on service function entry. */
-  Os_TraceOrtiApiEntry(OsOrtiApiIdGetTaskStackUsage);
+  Os_TraceOrtiApiEntry(OsOrtiApiIdGetSpinlockStatistics);
 
   /* #20 Call the API. */
-  result = Os_Api_GetTaskStackUsage(TaskID);
+  status = Os_Api_GetSpinlockStatistics(SpinlockId, CoreID, Statistics);                                                /* SBSW_OS_FC_PRECONDITION */
 
   /* #30 Inform the trace module on service function exit. */
-  Os_TraceOrtiApiExit(OsOrtiApiIdGetTaskStackUsage);
+  Os_TraceOrtiApiExit(OsOrtiApiIdGetSpinlockStatistics);
 
-  return result;
+  return status;
 }
 
 
 /***********************************************************************************************************************
- *  Os_TrapCallGetISRStackUsage()
+ *  Os_TrapCallGetTaskStateAsync()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -5501,29 +5796,31 @@ OS_ALWAYS_INLINE, Os_TrapCallGetTaskStackUsage,
  *
  *
  */
-OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE uint32, OS_CODE,
-OS_ALWAYS_INLINE, Os_TrapCallGetISRStackUsage,
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE Os_StatusType, OS_CODE,
+OS_ALWAYS_INLINE, Os_TrapCallGetTaskStateAsync,
 (
-  ISRType IsrID
+  TaskType TaskID,
+  EventMaskType Mask,
+  Os_AsyncCallRefType Call
 ))
 {
-  uint32 result;
+  Os_StatusType status;
 
   /* #10 Inform the trace module on service function entry. */
-  Os_TraceOrtiApiEntry(OsOrtiApiIdGetISRStackUsage);
+  Os_TraceOrtiApiEntry(OsOrtiApiIdGetTaskStateAsync);
 
   /* #20 Call the API. */
-  result = Os_Api_GetISRStackUsage(IsrID);
+  status = Os_Api_GetTaskStateAsync(TaskID, Mask, Call);                                                                /* SBSW_OS_FC_PRECONDITION */
 
   /* #30 Inform the trace module on service function exit. */
-  Os_TraceOrtiApiExit(OsOrtiApiIdGetISRStackUsage);
+  Os_TraceOrtiApiExit(OsOrtiApiIdGetTaskStateAsync);
 
-  return result;
+  return status;
 }
 
 
 /***********************************************************************************************************************
- *  Os_TrapCallGetKernelStackUsage()
+ *  Os_TrapCallGetAlarmAsync()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -5532,29 +5829,31 @@ OS_ALWAYS_INLINE, Os_TrapCallGetISRStackUsage,
  *
  *
  */
-OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE uint32, OS_CODE,
-OS_ALWAYS_INLINE, Os_TrapCallGetKernelStackUsage,
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE Os_StatusType, OS_CODE,
+OS_ALWAYS_INLINE, Os_TrapCallGetAlarmAsync,
 (
-  CoreIdType CoreID
+  AlarmType AlarmID,
+  EventMaskType Mask,
+  Os_AsyncCallRefType Call
 ))
 {
-  uint32 result;
+  Os_StatusType status;
 
   /* #10 Inform the trace module on service function entry. */
-  Os_TraceOrtiApiEntry(OsOrtiApiIdGetKernelStackUsage);
+  Os_TraceOrtiApiEntry(OsOrtiApiIdGetAlarmAsync);
 
   /* #20 Call the API. */
-  result = Os_Api_GetKernelStackUsage(CoreID);
+  status = Os_Api_GetAlarmAsync(AlarmID, Mask, Call);                                                                   /* SBSW_OS_FC_PRECONDITION */
 
   /* #30 Inform the trace module on service function exit. */
-  Os_TraceOrtiApiExit(OsOrtiApiIdGetKernelStackUsage);
+  Os_TraceOrtiApiExit(OsOrtiApiIdGetAlarmAsync);
 
-  return result;
+  return status;
 }
 
 
 /***********************************************************************************************************************
- *  Os_TrapCallGetStartupHookStackUsage()
+ *  Os_TrapCallGetCounterValueAsync()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -5563,29 +5862,31 @@ OS_ALWAYS_INLINE, Os_TrapCallGetKernelStackUsage,
  *
  *
  */
-OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE uint32, OS_CODE,
-OS_ALWAYS_INLINE, Os_TrapCallGetStartupHookStackUsage,
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE Os_StatusType, OS_CODE,
+OS_ALWAYS_INLINE, Os_TrapCallGetCounterValueAsync,
 (
-  CoreIdType CoreID
+  CounterType CounterID,
+  EventMaskType Mask,
+  Os_AsyncCallRefType Call
 ))
 {
-  uint32 result;
+  Os_StatusType status;
 
   /* #10 Inform the trace module on service function entry. */
-  Os_TraceOrtiApiEntry(OsOrtiApiIdGetStartupHookStackUsage);
+  Os_TraceOrtiApiEntry(OsOrtiApiIdGetCounterValueAsync);
 
   /* #20 Call the API. */
-  result = Os_Api_GetStartupHookStackUsage(CoreID);
+  status = Os_Api_GetCounterValueAsync(CounterID, Mask, Call);                                                          /* SBSW_OS_FC_PRECONDITION */
 
   /* #30 Inform the trace module on service function exit. */
-  Os_TraceOrtiApiExit(OsOrtiApiIdGetStartupHookStackUsage);
+  Os_TraceOrtiApiExit(OsOrtiApiIdGetCounterValueAsync);
 
-  return result;
+  return status;
 }
 
 
 /***********************************************************************************************************************
- *  Os_TrapCallGetErrorHookStackUsage()
+ *  Os_TrapCallGetAsyncCallResult()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -5594,29 +5895,28 @@ OS_ALWAYS_INLINE, Os_TrapCallGetStartupHookStackUsage,
  *
  *
  */
-OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE uint32, OS_CODE,
-OS_ALWAYS_INLINE, Os_TrapCallGetErrorHookStackUsage,
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE Os_StatusType, OS_CODE,
+OS_ALWAYS_INLINE, Os_TrapCallGetAsyncCallResult,
 (
-  CoreIdType CoreID
+  Os_AsyncCallRefType Call
 ))
 {
-  uint32 result;
+  Os_StatusType status;
 
   /* #10 Inform the trace module on service function entry. */
-  Os_TraceOrtiApiEntry(OsOrtiApiIdGetErrorHookStackUsage);
+  Os_TraceOrtiApiEntry(OsOrtiApiIdGetAsyncCallResult);
 
   /* #20 Call the API. */
-  result = Os_Api_GetErrorHookStackUsage(CoreID);
+  status = Os_Api_GetAsyncCallResult(Call);                                                                             /* SBSW_OS_FC_PRECONDITION */
 
   /* #30 Inform the trace module on service function exit. */
-  Os_TraceOrtiApiExit(OsOrtiApiIdGetErrorHookStackUsage);
+  Os_TraceOrtiApiExit(OsOrtiApiIdGetAsyncCallResult);
 
-  return result;
+  return status;
 }
 
-
 /***********************************************************************************************************************
- *  Os_TrapCallGetShutdownHookStackUsage()
+ *  Os_TrapCallGetTaskAccounting()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -5625,29 +5925,29 @@ OS_ALWAYS_INLINE, Os_TrapCallGetErrorHookStackUsage,
  *
  *
  */
-OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE uint32, OS_CODE,
-OS_ALWAYS_INLINE, Os_TrapCallGetShutdownHookStackUsage,
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE Os_StatusType, OS_CODE,
+OS_ALWAYS_INLINE, Os_TrapCallGetTaskAccounting,
 (
-  CoreIdType CoreID
+  TaskType TaskID,
+  Os_ThreadAccountingRefType Accounting
 ))
 {
-  uint32 result;
+  Os_StatusType status;
 
   /* #10 Inform the trace module on service function entry. */
-  Os_TraceOrtiApiEntry(OsOrtiApiIdGetShutdownHookStackUsage);
+  Os_TraceOrtiApiEntry(OsOrtiApiIdGetTaskAccounting);
 
   /* #20 Call the API. */
-  result = Os_Api_GetShutdownHookStackUsage(CoreID);
+  status = Os_Api_GetTaskAccounting(TaskID, Accounting);                                                                /* SBSW_OS_FC_PRECONDITION */
 
   /* #30 Inform the trace module on service function exit. */
-  Os_TraceOrtiApiExit(OsOrtiApiIdGetShutdownHookStackUsage);
+  Os_TraceOrtiApiExit(OsOrtiApiIdGetTaskAccounting);
 
-  return result;
+  return status;
 }
 
-
 /***********************************************************************************************************************
- *  Os_TrapCallGetProtectionHookStackUsage()
+ *  Os_TrapCallGetISRAccounting()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -5656,29 +5956,30 @@ OS_ALWAYS_INLINE, Os_TrapCallGetShutdownHookStackUsage,
  *
  *
  */
-OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE uint32, OS_CODE,
-OS_ALWAYS_INLINE, Os_TrapCallGetProtectionHookStackUsage,
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE Os_StatusType, OS_CODE,
+OS_ALWAYS_INLINE, Os_TrapCallGetISRAccounting,
 (
-  CoreIdType CoreID
+  ISRType ISRID,
+  Os_ThreadAccountingRefType Accounting
 ))
 {
-  uint32 result;
+  Os_StatusType status;
 
   /* #10 Inform the trace module on service function entry. */
-  Os_TraceOrtiApiEntry(OsOrtiApiIdGetProtectionHookStackUsage);
+  Os_TraceOrtiApiEntry(OsOrtiApiIdGetISRAccounting);
 
   /* #20 Call the API. */
-  result = Os_Api_GetProtectionHookStackUsage(CoreID);
+  status = Os_Api_GetISRAccounting(ISRID, Accounting);                                                                  /* SBSW_OS_FC_PRECONDITION */
 
   /* #30 Inform the trace module on service function exit. */
-  Os_TraceOrtiApiExit(OsOrtiApiIdGetProtectionHookStackUsage);
+  Os_TraceOrtiApiExit(OsOrtiApiIdGetISRAccounting);
 
-  return result;
+  return status;
 }
 
 
 /***********************************************************************************************************************
- *  Os_TrapCallGetNonTrustedFunctionStackUsage()
+ *  Os_TrapCallScanStackUsage()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -5687,29 +5988,29 @@ OS_ALWAYS_INLINE, Os_TrapCallGetProtectionHookStackUsage,
  *
  *
  */
-OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE uint32, OS_CODE,
-OS_ALWAYS_INLINE, Os_TrapCallGetNonTrustedFunctionStackUsage,
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE Os_StatusType, OS_CODE,
+OS_ALWAYS_INLINE, Os_TrapCallScanStackUsage,
 (
-  Os_NonTrustedFunctionIndexType FunctionIndex
+  void
 ))
 {
-  uint32 result;
+  Os_StatusType status;
 
   /* #10 Inform the trace module on service function entry. */
-  Os_TraceOrtiApiEntry(OsOrtiApiIdGetNonTrustedFunctionStackUsage);
+  Os_TraceOrtiApiEntry(OsOrtiApiIdScanStackUsage);
 
   /* #20 Call the API. */
-  result = Os_Api_GetNonTrustedFunctionStackUsage(FunctionIndex);
+  status = Os_Api_ScanStackUsage();
 
   /* #30 Inform the trace module on service function exit. */
-  Os_TraceOrtiApiExit(OsOrtiApiIdGetNonTrustedFunctionStackUsage);
+  Os_TraceOrtiApiExit(OsOrtiApiIdScanStackUsage);
 
-  return result;
+  return status;
 }
 
 
 /***********************************************************************************************************************
- *  Os_TrapCallBarrierSynchronize()
+ *  Os_TrapCallGetNtfStackPoolStatistics()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -5719,28 +6020,29 @@ OS_ALWAYS_INLINE, Os_TrapCallGetNonTrustedFunctionStackUsage,
  *
  */
 OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE Os_StatusType, OS_CODE,
-OS_ALWAYS_INLINE, Os_TrapCallBarrierSynchronize,
+OS_ALWAYS_INLINE, Os_TrapCallGetNtfStackPoolStatistics,
 (
-  Os_BarrierIdType BarrierID
+  Os_NonTrustedFunctionIndexType FunctionIndex,
+  Os_NtfStackPoolStatisticsRefType Statistics
 ))
 {
   Os_StatusType status;
 
   /* #10 Inform the trace module on service function entry. */
-  Os_TraceOrtiApiEntry(OsOrtiApiIdBarrierSynchronize);
+  Os_TraceOrtiApiEntry(OsOrtiApiIdGetNtfStackPoolStatistics);
 
   /* #20 Call the API. */
-  status = Os_Api_BarrierSynchronize(BarrierID);
+  status = Os_Api_GetNtfStackPoolStatistics(FunctionIndex, Statistics);                                                 /* SBSW_OS_FC_PRECONDITION */
 
   /* #30 Inform the trace module on service function exit. */
-  Os_TraceOrtiApiExit(OsOrtiApiIdBarrierSynchronize);
+  Os_TraceOrtiApiExit(OsOrtiApiIdGetNtfStackPoolStatistics);
 
   return status;
 }
 
 
 /***********************************************************************************************************************
- *  Os_TrapCallActivateTask()
+ *  Os_TrapCallActivateTaskSet()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -5750,28 +6052,28 @@ OS_ALWAYS_INLINE, Os_TrapCallBarrierSynchronize,
  *
  */
 OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE Os_StatusType, OS_CODE,
-OS_ALWAYS_INLINE, Os_TrapCallActivateTask,
+OS_ALWAYS_INLINE, Os_TrapCallActivateTaskSet,
 (
-  TaskType TaskID
+  Os_TaskSetIdType TaskSetID
 ))
 {
   Os_StatusType status;
 
   /* #10 Inform the trace module on service function entry. */
-  Os_TraceOrtiApiEntry(OsOrtiApiIdActivateTask);
+  Os_TraceOrtiApiEntry(OsOrtiApiIdActivateTaskSet);
 
   /* #20 Call the API. */
-  status = Os_Api_ActivateTask(TaskID);
+  status = Os_Api_ActivateTaskSet(TaskSetID);
 
   /* #30 Inform the trace module on service function exit. */
-  Os_TraceOrtiApiExit(OsOrtiApiIdActivateTask);
+  Os_TraceOrtiApiExit(OsOrtiApiIdActivateTaskSet);
 
   return status;
 }
 
 
 /***********************************************************************************************************************
- *  Os_TrapCallTerminateTask()
+ *  Os_TrapCallGetMpSkippedSwitches()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -5780,29 +6082,29 @@ OS_ALWAYS_INLINE, Os_TrapCallActivateTask,
  *
  *
  */
-OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE Os_StatusType, OS_CODE,
-OS_ALWAYS_INLINE, Os_TrapCallTerminateTask,
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE uint32, OS_CODE,
+OS_ALWAYS_INLINE, Os_TrapCallGetMpSkippedSwitches,
 (
-  void
+  CoreIdType CoreID
 ))
 {
-  Os_StatusType status;
+  uint32 result;
 
   /* #10 Inform the trace module on service function entry. */
-  Os_TraceOrtiApiEntry(OsOrtiApiIdTerminateTask);
+  Os_TraceOrtiApiEntry(OsOrtiApiIdGetMpSkippedSwitches);
 
   /* #20 Call the API. */
-  status = Os_Api_TerminateTask();
+  result = Os_Api_GetMpSkippedSwitches(CoreID);
 
   /* #30 Inform the trace module on service function exit. */
-  Os_TraceOrtiApiExit(OsOrtiApiIdTerminateTask);
+  Os_TraceOrtiApiExit(OsOrtiApiIdGetMpSkippedSwitches);
 
-  return status;
+  return result;
 }
 
 
 /***********************************************************************************************************************
- *  Os_TrapCallChainTask()
+ *  Os_TrapCallGetTaskStackUsage()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -5811,29 +6113,29 @@ OS_ALWAYS_INLINE, Os_TrapCallTerminateTask,
  *
  *
  */
-OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE Os_StatusType, OS_CODE,
-OS_ALWAYS_INLINE, Os_TrapCallChainTask,
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE uint32, OS_CODE,
+OS_ALWAYS_INLINE, Os_TrapCallGetTaskStackUsage,
 (
   TaskType TaskID
 ))
 {
-  Os_StatusType status;
+  uint32 result;
 
   /* #10 Inform the trace module on service function entry. */
-  Os_TraceOrtiApiEntry(OsOrtiApiIdChainTask);
+  Os_TraceOrtiApiEntry(OsOrtiApiIdGetTaskStackUsage);
 
   /* #20 Call the API. */
-  status = Os_Api_ChainTask(TaskID);
+  result = Os_Api_GetTaskStackUsage(TaskID);
 
   /* #30 Inform the trace module on service function exit. */
-  Os_TraceOrtiApiExit(OsOrtiApiIdChainTask);
+  Os_TraceOrtiApiExit(OsOrtiApiIdGetTaskStackUsage);
 
-  return status;
+  return result;
 }
 
 
 /***********************************************************************************************************************
- *  Os_TrapCallSchedule()
+ *  Os_TrapCallGetISRStackUsage()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -5842,29 +6144,29 @@ OS_ALWAYS_INLINE, Os_TrapCallChainTask,
  *
  *
  */
-OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE Os_StatusType, OS_CODE,
-OS_ALWAYS_INLINE, Os_TrapCallSchedule,
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE uint32, OS_CODE,
+OS_ALWAYS_INLINE, Os_TrapCallGetISRStackUsage,
 (
-  void
+  ISRType IsrID
 ))
 {
-  Os_StatusType status;
+  uint32 result;
 
   /* #10 Inform the trace module on service function entry. */
-  Os_TraceOrtiApiEntry(OsOrtiApiIdSchedule);
+  Os_TraceOrtiApiEntry(OsOrtiApiIdGetISRStackUsage);
 
   /* #20 Call the API. */
-  status = Os_Api_Schedule();
+  result = Os_Api_GetISRStackUsage(IsrID);
 
   /* #30 Inform the trace module on service function exit. */
-  Os_TraceOrtiApiExit(OsOrtiApiIdSchedule);
+  Os_TraceOrtiApiExit(OsOrtiApiIdGetISRStackUsage);
 
-  return status;
+  return result;
 }
 
 
 /***********************************************************************************************************************
- *  Os_TrapCallGetTaskID()
+ *  Os_TrapCallGetKernelStackUsage()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -5873,29 +6175,29 @@ OS_ALWAYS_INLINE, Os_TrapCallSchedule,
  *
  *
  */
-OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE Os_StatusType, OS_CODE,
-OS_ALWAYS_INLINE, Os_TrapCallGetTaskID,
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE uint32, OS_CODE,
+OS_ALWAYS_INLINE, Os_TrapCallGetKernelStackUsage,
 (
-  TaskRefType TaskID
+  CoreIdType CoreID
 ))
 {
-  Os_StatusType status;
+  uint32 result;
 
   /* #10 Inform the trace module on service function entry. */
-  Os_TraceOrtiApiEntry(OsOrtiApiIdGetTaskID);
+  Os_TraceOrtiApiEntry(OsOrtiApiIdGetKernelStackUsage);
 
   /* #20 Call the API. */
-  status = Os_Api_GetTaskID(TaskID);                                                                                    /* SBSW_OS_FC_PRECONDITION */
+  result = Os_Api_GetKernelStackUsage(CoreID);
 
   /* #30 Inform the trace module on service function exit. */
-  Os_TraceOrtiApiExit(OsOrtiApiIdGetTaskID);
+  Os_TraceOrtiApiExit(OsOrtiApiIdGetKernelStackUsage);
 
-  return status;
+  return result;
 }
 
 
 /***********************************************************************************************************************
- *  Os_TrapCallGetTaskState()
+ *  Os_TrapCallGetStartupHookStackUsage()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -5904,30 +6206,29 @@ OS_ALWAYS_INLINE, Os_TrapCallGetTaskID,
  *
  *
  */
-OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE Os_StatusType, OS_CODE,
-OS_ALWAYS_INLINE, Os_TrapCallGetTaskState,
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE uint32, OS_CODE,
+OS_ALWAYS_INLINE, Os_TrapCallGetStartupHookStackUsage,
 (
-  TaskType TaskID,
-  TaskStateRefType State
+  CoreIdType CoreID
 ))
 {
-  Os_StatusType status;
+  uint32 result;
 
   /* #10 Inform the trace module on service function entry. */
-  Os_TraceOrtiApiEntry(OsOrtiApiIdGetTaskState);
+  Os_TraceOrtiApiEntry(OsOrtiApiIdGetStartupHookStackUsage);
 
   /* #20 Call the API. */
-  status = Os_Api_GetTaskState(TaskID, State);                                                                          /* SBSW_OS_FC_PRECONDITION */
+  result = Os_Api_GetStartupHookStackUsage(CoreID);
 
   /* #30 Inform the trace module on service function exit. */
-  Os_TraceOrtiApiExit(OsOrtiApiIdGetTaskState);
+  Os_TraceOrtiApiExit(OsOrtiApiIdGetStartupHookStackUsage);
 
-  return status;
+  return result;
 }
 
 
 /***********************************************************************************************************************
- *  Os_TrapCallGetCoreStartState()
+ *  Os_TrapCallGetErrorHookStackUsage()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -5936,31 +6237,29 @@ OS_ALWAYS_INLINE, Os_TrapCallGetTaskState,
  *
  *
  */
-OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE,
-OS_ALWAYS_INLINE, Os_TrapCallGetCoreStartState,
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE uint32, OS_CODE,
+OS_ALWAYS_INLINE, Os_TrapCallGetErrorHookStackUsage,
 (
-  CoreIdType CoreID,
-  Os_CoreStartStateType *CoreState,
-  StatusType *Status
+  CoreIdType CoreID
 ))
 {
+  uint32 result;
+
   /* #10 Inform the trace module on service function entry. */
-  Os_TraceOrtiApiEntry(OsOrtiApiIdGetCoreStartState);
+  Os_TraceOrtiApiEntry(OsOrtiApiIdGetErrorHookStackUsage);
 
   /* #20 Call the API. */
-  Os_Api_GetCoreStartState(CoreID, CoreState, Status);                                                                  /* SBSW_OS_FC_PRECONDITION */
+  result = Os_Api_GetErrorHookStackUsage(CoreID);
 
   /* #30 Inform the trace module on service function exit. */
-  Os_TraceOrtiApiExit(OsOrtiApiIdGetCoreStartState);
-}
+  Os_TraceOrtiApiExit(OsOrtiApiIdGetErrorHookStackUsage);
 
+  return result;
+}
 
-/***********************************************************************************************************************
- *  GLOBAL FUNCTIONS
- **********************************************************************************************************************/
 
 /***********************************************************************************************************************
- *  Os_TrapSpinlockGet()
+ *  Os_TrapCallGetShutdownHookStackUsage()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -5968,45 +6267,30 @@ OS_ALWAYS_INLINE, Os_TrapCallGetCoreStartState,
  *
  *
  *
- *
- *
- *
  */
-FUNC(Os_StatusType, OS_CODE) Os_TrapSpinlockGet
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE uint32, OS_CODE,
+OS_ALWAYS_INLINE, Os_TrapCallGetShutdownHookStackUsage,
 (
-  P2CONST(Os_SpinlockConfigType, AUTOMATIC, OS_CONST) Spinlock
-)
+  CoreIdType CoreID
+))
 {
-  Os_StatusType status;
-
-  /* #10 If a trap is needed: */
-  if(Os_TrapIsTrapForWriteAccessRequired() != 0u)                                                                       /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */
-  {
-    Os_TrapPacketType packet;
+  uint32 result;
 
-    /* #20 Marshal API data. */
-    packet.TrapId = OS_TRAPID_SPINLOCKGET;
-    packet.Parameters[OS_TRAPPARAMINDEX_1].ParamSpinlockConfigRefType = Spinlock;                                       /* SBSW_OS_PWA_LOCAL */
+  /* #10 Inform the trace module on service function entry. */
+  Os_TraceOrtiApiEntry(OsOrtiApiIdGetShutdownHookStackUsage);
 
-    /* #30 Trigger trap. */
-    Os_Hal_Trap(&packet);                                                                                               /* SBSW_OS_FC_POINTER2LOCAL */
+  /* #20 Call the API. */
+  result = Os_Api_GetShutdownHookStackUsage(CoreID);
 
-    /* #40 Unmarshal return value. */
-    status = packet.ReturnValue.ReturnOs_StatusType;
-  }
-  /* #50 Otherwise: */
-  else
-  {
-    /* #60 Call the API directly. */
-    status = Os_TrapCallGetSpinlock(Spinlock);                                                                          /* SBSW_OS_FC_PRECONDITION */
-  }
+  /* #30 Inform the trace module on service function exit. */
+  Os_TraceOrtiApiExit(OsOrtiApiIdGetShutdownHookStackUsage);
 
-  return status;
+  return result;
 }
 
 
 /***********************************************************************************************************************
- *  Os_TrapSpinlockRelease()
+ *  Os_TrapCallGetProtectionHookStackUsage()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -6014,45 +6298,30 @@ FUNC(Os_StatusType, OS_CODE) Os_TrapSpinlockGet
  *
  *
  *
- *
- *
- *
  */
-FUNC(Os_StatusType, OS_CODE) Os_TrapSpinlockRelease
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE uint32, OS_CODE,
+OS_ALWAYS_INLINE, Os_TrapCallGetProtectionHookStackUsage,
 (
-  P2CONST(Os_SpinlockConfigType, AUTOMATIC, OS_CONST) Spinlock
-)
+  CoreIdType CoreID
+))
 {
-  Os_StatusType status;
-
-  /* #10 If a trap is needed: */
-  if(Os_TrapIsTrapForWriteAccessRequired() != 0u)                                                                       /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */ /* COV_OS_HALPLATFORMTESTEDASMULTICORE */
-  {
-    Os_TrapPacketType packet;
+  uint32 result;
 
-    /* #20 Marshal API data. */
-    packet.TrapId = OS_TRAPID_SPINLOCKRELEASE;
-    packet.Parameters[OS_TRAPPARAMINDEX_1].ParamSpinlockConfigRefType = Spinlock;                                       /* SBSW_OS_PWA_LOCAL */
+  /* #10 Inform the trace module on service function entry. */
+  Os_TraceOrtiApiEntry(OsOrtiApiIdGetProtectionHookStackUsage);
 
-    /* #30 Trigger trap. */
-    Os_Hal_Trap(&packet);                                                                                               /* SBSW_OS_FC_POINTER2LOCAL */
+  /* #20 Call the API. */
+  result = Os_Api_GetProtectionHookStackUsage(CoreID);
 
-    /* #40 Unmarshal return value. */
-    status = packet.ReturnValue.ReturnOs_StatusType;
-  }
-  /* #50 Otherwise: */
-  else
-  {
-    /* #60 Call the API directly. */
-    status = Os_TrapCallReleaseSpinlock(Spinlock);                                                                      /* SBSW_OS_FC_PRECONDITION */
-  }
+  /* #30 Inform the trace module on service function exit. */
+  Os_TraceOrtiApiExit(OsOrtiApiIdGetProtectionHookStackUsage);
 
-  return status;
+  return result;
 }
 
 
 /***********************************************************************************************************************
- *  Os_TrapSpinlockTryGet()
+ *  Os_TrapCallGetNonTrustedFunctionStackUsage()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -6060,50 +6329,1256 @@ FUNC(Os_StatusType, OS_CODE) Os_TrapSpinlockRelease
  *
  *
  *
- *
- *
- *
  */
-FUNC(Os_StatusType, OS_CODE) Os_TrapSpinlockTryGet
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE uint32, OS_CODE,
+OS_ALWAYS_INLINE, Os_TrapCallGetNonTrustedFunctionStackUsage,
 (
-  P2CONST(Os_SpinlockConfigType, AUTOMATIC, OS_CONST) Spinlock,
-  TryToGetSpinlockType* Success
-)
+  Os_NonTrustedFunctionIndexType FunctionIndex
+))
 {
-  Os_StatusType status;
+  uint32 result;
 
-  /* #10 If a trap is needed: */
-  if(Os_TrapIsTrapForWriteAccessRequired() != 0u)                                                                       /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */
-  {
-    Os_TrapPacketType packet;
-    TryToGetSpinlockType userspaceSuccess;
+  /* #10 Inform the trace module on service function entry. */
+  Os_TraceOrtiApiEntry(OsOrtiApiIdGetNonTrustedFunctionStackUsage);
+
+  /* #20 Call the API. */
+  result = Os_Api_GetNonTrustedFunctionStackUsage(FunctionIndex);
+
+  /* #30 Inform the trace module on service function exit. */
+  Os_TraceOrtiApiExit(OsOrtiApiIdGetNonTrustedFunctionStackUsage);
+
+  return result;
+}
+
+
+/***********************************************************************************************************************
+ *  Os_TrapCallBarrierSynchronize()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE Os_StatusType, OS_CODE,
+OS_ALWAYS_INLINE, Os_TrapCallBarrierSynchronize,
+(
+  Os_BarrierIdType BarrierID
+))
+{
+  Os_StatusType status;
+
+  /* #10 Inform the trace module on service function entry. */
+  Os_TraceOrtiApiEntry(OsOrtiApiIdBarrierSynchronize);
+
+  /* #20 Call the API. */
+  status = Os_Api_BarrierSynchronize(BarrierID);
+
+  /* #30 Inform the trace module on service function exit. */
+  Os_TraceOrtiApiExit(OsOrtiApiIdBarrierSynchronize);
+
+  return status;
+}
+
+
+/***********************************************************************************************************************
+ *  Os_TrapCallActivateTask()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE Os_StatusType, OS_CODE,
+OS_ALWAYS_INLINE, Os_TrapCallActivateTask,
+(
+  TaskType TaskID
+))
+{
+  Os_StatusType status;
+
+  /* #10 Inform the trace module on service function entry. */
+  Os_TraceOrtiApiEntry(OsOrtiApiIdActivateTask);
+
+  /* #20 Call the API. */
+  status = Os_Api_ActivateTask(TaskID);
+
+  /* #30 Inform the trace module on service function exit. */
+  Os_TraceOrtiApiExit(OsOrtiApiIdActivateTask);
+
+  return status;
+}
+
+
+/***********************************************************************************************************************
+ *  Os_TrapCallTerminateTask()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE Os_StatusType, OS_CODE,
+OS_ALWAYS_INLINE, Os_TrapCallTerminateTask,
+(
+  void
+))
+{
+  Os_StatusType status;
+
+  /* #10 Inform the trace module on service function entry. */
+  Os_TraceOrtiApiEntry(OsOrtiApiIdTerminateTask);
+
+  /* #20 Call the API. */
+  status = Os_Api_TerminateTask();
+
+  /* #30 Inform the trace module on service function exit. */
+  Os_TraceOrtiApiExit(OsOrtiApiIdTerminateTask);
+
+  return status;
+}
+
+
+/***********************************************************************************************************************
+ *  Os_TrapCallChainTask()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE Os_StatusType, OS_CODE,
+OS_ALWAYS_INLINE, Os_TrapCallChainTask,
+(
+  TaskType TaskID
+))
+{
+  Os_StatusType status;
+
+  /* #10 Inform the trace module on service function entry. */
+  Os_TraceOrtiApiEntry(OsOrtiApiIdChainTask);
+
+  /* #20 Call the API. */
+  status = Os_Api_ChainTask(TaskID);
+
+  /* #30 Inform the trace module on service function exit. */
+  Os_TraceOrtiApiExit(OsOrtiApiIdChainTask);
+
+  return status;
+}
+
+
+/***********************************************************************************************************************
+ *  Os_TrapCallSchedule()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE Os_StatusType, OS_CODE,
+OS_ALWAYS_INLINE, Os_TrapCallSchedule,
+(
+  void
+))
+{
+  Os_StatusType status;
+
+  /* #10 Inform the trace module on service function entry. */
+  Os_TraceOrtiApiEntry(OsOrtiApiIdSchedule);
+
+  /* #20 Call the API. */
+  status = Os_Api_Schedule();
+
+  /* #30 Inform the trace module on service function exit. */
+  Os_TraceOrtiApiExit(OsOrtiApiIdSchedule);
+
+  return status;
+}
+
+
+/***********************************************************************************************************************
+ *  Os_TrapCallGetTaskID()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE Os_StatusType, OS_CODE,
+OS_ALWAYS_INLINE, Os_TrapCallGetTaskID,
+(
+  TaskRefType TaskID
+))
+{
+  Os_StatusType status;
+
+  /* #10 Inform the trace module on service function entry. */
+  Os_TraceOrtiApiEntry(OsOrtiApiIdGetTaskID);
+
+  /* #20 Call the API. */
+  status = Os_Api_GetTaskID(TaskID);                                                                                    /* SBSW_OS_FC_PRECONDITION */
+
+  /* #30 Inform the trace module on service function exit. */
+  Os_TraceOrtiApiExit(OsOrtiApiIdGetTaskID);
+
+  return status;
+}
+
+
+/***********************************************************************************************************************
+ *  Os_TrapCallGetTaskState()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE Os_StatusType, OS_CODE,
+OS_ALWAYS_INLINE, Os_TrapCallGetTaskState,
+(
+  TaskType TaskID,
+  TaskStateRefType State
+))
+{
+  Os_StatusType status;
+
+  /* #10 Inform the trace module on service function entry. */
+  Os_TraceOrtiApiEntry(OsOrtiApiIdGetTaskState);
+
+  /* #20 Call the API. */
+  status = Os_Api_GetTaskState(TaskID, State);                                                                          /* SBSW_OS_FC_PRECONDITION */
+
+  /* #30 Inform the trace module on service function exit. */
+  Os_TraceOrtiApiExit(OsOrtiApiIdGetTaskState);
+
+  return status;
+}
+
+
+/***********************************************************************************************************************
+ *  Os_TrapCallGetCoreStartState()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE,
+OS_ALWAYS_INLINE, Os_TrapCallGetCoreStartState,
+(
+  CoreIdType CoreID,
+  Os_CoreStartStateType *CoreState,
+  StatusType *Status
+))
+{
+  /* #10 Inform the trace module on service function entry. */
+  Os_TraceOrtiApiEntry(OsOrtiApiIdGetCoreStartState);
+
+  /* #20 Call the API. */
+  Os_Api_GetCoreStartState(CoreID, CoreState, Status);                                                                  /* SBSW_OS_FC_PRECONDITION */
+
+  /* #30 Inform the trace module on service function exit. */
+  Os_TraceOrtiApiExit(OsOrtiApiIdGetCoreStartState);
+}
+
+
+/***********************************************************************************************************************
+ *  GLOBAL FUNCTIONS
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *  Os_TrapSpinlockGet()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ *
+ *
+ *
+ */
+FUNC(Os_StatusType, OS_CODE) Os_TrapSpinlockGet
+(
+  P2CONST(Os_SpinlockConfigType, AUTOMATIC, OS_CONST) Spinlock
+)
+{
+  Os_StatusType status;
+
+  /* #10 If a trap is needed: */
+  if(Os_TrapIsTrapForWriteAccessRequired() != 0u)                                                                       /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */
+  {
+    Os_TrapPacketType packet;
+
+    /* #20 Marshal API data. */
+    packet.TrapId = OS_TRAPID_SPINLOCKGET;
+    packet.Parameters[OS_TRAPPARAMINDEX_1].ParamSpinlockConfigRefType = Spinlock;                                       /* SBSW_OS_PWA_LOCAL */
+
+    /* #30 Trigger trap. */
+    Os_Hal_Trap(&packet);                                                                                               /* SBSW_OS_FC_POINTER2LOCAL */
+
+    /* #40 Unmarshal return value. */
+    status = packet.ReturnValue.ReturnOs_StatusType;
+  }
+  /* #50 Otherwise: */
+  else
+  {
+    /* #60 Call the API directly. */
+    status = Os_TrapCallGetSpinlock(Spinlock);                                                                          /* SBSW_OS_FC_PRECONDITION */
+  }
+
+  return status;
+}
+
+
+/***********************************************************************************************************************
+ *  Os_TrapSpinlockRelease()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ *
+ *
+ *
+ */
+FUNC(Os_StatusType, OS_CODE) Os_TrapSpinlockRelease
+(
+  P2CONST(Os_SpinlockConfigType, AUTOMATIC, OS_CONST) Spinlock
+)
+{
+  Os_StatusType status;
+
+  /* #10 If a trap is needed: */
+  if(Os_TrapIsTrapForWriteAccessRequired() != 0u)                                                                       /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */ /* COV_OS_HALPLATFORMTESTEDASMULTICORE */
+  {
+    Os_TrapPacketType packet;
+
+    /* #20 Marshal API data. */
+    packet.TrapId = OS_TRAPID_SPINLOCKRELEASE;
+    packet.Parameters[OS_TRAPPARAMINDEX_1].ParamSpinlockConfigRefType = Spinlock;                                       /* SBSW_OS_PWA_LOCAL */
+
+    /* #30 Trigger trap. */
+    Os_Hal_Trap(&packet);                                                                                               /* SBSW_OS_FC_POINTER2LOCAL */
+
+    /* #40 Unmarshal return value. */
+    status = packet.ReturnValue.ReturnOs_StatusType;
+  }
+  /* #50 Otherwise: */
+  else
+  {
+    /* #60 Call the API directly. */
+    status = Os_TrapCallReleaseSpinlock(Spinlock);                                                                      /* SBSW_OS_FC_PRECONDITION */
+  }
+
+  return status;
+}
+
+
+/***********************************************************************************************************************
+ *  Os_TrapSpinlockTryGet()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ *
+ *
+ *
+ */
+FUNC(Os_StatusType, OS_CODE) Os_TrapSpinlockTryGet
+(
+  P2CONST(Os_SpinlockConfigType, AUTOMATIC, OS_CONST) Spinlock,
+  TryToGetSpinlockType* Success
+)
+{
+  Os_StatusType status;
+
+  /* #10 If a trap is needed: */
+  if(Os_TrapIsTrapForWriteAccessRequired() != 0u)                                                                       /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */
+  {
+    Os_TrapPacketType packet;
+    TryToGetSpinlockType userspaceSuccess;
+
+    /* #20 Marshal API data. */
+    packet.TrapId = OS_TRAPID_SPINLOCKTRYGET;
+    packet.Parameters[OS_TRAPPARAMINDEX_1].ParamSpinlockConfigRefType = Spinlock;                                       /* SBSW_OS_PWA_LOCAL */
+    packet.Parameters[OS_TRAPPARAMINDEX_2].ParamApiType.ParamTryToGetSpinlockRefType =
+                                                                (TryToGetSpinlockType*)&userspaceSuccess;               /* SBSW_OS_PWA_LOCAL */
+
+    /* #30 Trigger trap. */
+    Os_Hal_Trap(&packet);                                                                                               /* SBSW_OS_FC_POINTER2LOCAL */
+
+    /* #40 Unmarshal return value. */
+    (*Success) = *((volatile TryToGetSpinlockType*)&userspaceSuccess);                                                  /* SBSW_OS_TRAP_API_USERPOINTER_002 */
+    status = packet.ReturnValue.ReturnOs_StatusType;
+  }
+  /* #50 Otherwise: */
+  else
+  {
+    /* #60 Call the API directly. */
+    status = Os_TrapCallTryToGetSpinlock(Spinlock, Success);                                                            /* SBSW_OS_FC_PRECONDITION */
+  }
+
+  return status;
+}
+
+
+/***********************************************************************************************************************
+ *  Os_TrapIoc08Receive()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ *
+ *
+ *
+ */
+FUNC(Std_ReturnType, OS_CODE) Os_TrapIoc08Receive
+(
+  boolean IsTrapRequired,
+  P2CONST(Os_Ioc08ReceiveConfigType, TYPEDEF, OS_CONST) Ioc,
+  P2VAR(uint8, TYPEDEF, AUTOMATIC) Data
+)
+{
+  Std_ReturnType result;
+
+  /* #10 If trap is required: */
+  if(Os_TrapIsTrapRequired(IsTrapRequired) != 0u)                                                                       /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */
+  {
+    Os_TrapPacketType packet;
+
+    /* #20 Marshal API data. */
+    packet.TrapId = OS_TRAPID_IOC08RECEIVE;
+    packet.Parameters[OS_TRAPPARAMINDEX_1].ParamIoc08ReceiveConfigRefType = Ioc;                                        /* SBSW_OS_PWA_LOCAL */
+    packet.Parameters[OS_TRAPPARAMINDEX_2].ParamUint8RefType = Data;                                                    /* SBSW_OS_PWA_LOCAL */
+
+    /* #30 Trigger trap. */
+    Os_Hal_Trap(&packet);                                                                                               /* SBSW_OS_FC_POINTER2LOCAL */
+
+    /* #40 Unmarshal return value. */
+    result = packet.ReturnValue.ReturnStd_ReturnType;
+  }
+  /* #50 Otherwise: */
+  else
+  {
+    /* #60 Call the API directly. */
+    result = Os_Ioc08Receive(Ioc, Data);                                                                                /* SBSW_OS_FC_PRECONDITION */
+  }
+
+  return result;
+}
+
+
+/***********************************************************************************************************************
+ *  Os_TrapIoc8EmptyQueue()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ *
+ *
+ *
+ */
+FUNC(Std_ReturnType, OS_CODE) Os_TrapIoc08EmptyQueue
+(
+  boolean IsTrapRequired,
+  P2CONST(Os_Ioc08ReceiveConfigType, TYPEDEF, OS_CONST) Ioc
+)
+{
+  Std_ReturnType result;
+
+  /* #10 If trap is required: */
+  if(Os_TrapIsTrapRequired(IsTrapRequired) != 0u)                                                                       /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */
+  {
+    Os_TrapPacketType packet;
+
+    /* #20 Marshal API data. */
+    packet.TrapId = OS_TRAPID_IOC08EMPTYQUEUE;
+    packet.Parameters[OS_TRAPPARAMINDEX_1].ParamIoc08ReceiveConfigRefType = Ioc;                                        /* SBSW_OS_PWA_LOCAL */
+
+    /* #30 Trigger trap. */
+    Os_Hal_Trap(&packet);                                                                                               /* SBSW_OS_FC_POINTER2LOCAL */
+
+    /* #40 Unmarshal return value. */
+    result = packet.ReturnValue.ReturnStd_ReturnType;
+  }
+  /* #50 Otherwise: */
+  else
+  {
+    /* #60 Call the API directly. */
+    result = Os_Ioc08EmptyQueue(Ioc);                                                                                   /* SBSW_OS_FC_PRECONDITION */
+  }
+
+  return result;
+}
+
+
+/***********************************************************************************************************************
+ *  Os_TrapIoc8Send()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ *
+ *
+ *
+ */
+FUNC(Std_ReturnType, OS_CODE) Os_TrapIoc08Send
+(
+  boolean IsTrapRequired,
+  P2CONST(Os_Ioc08SendConfigType, TYPEDEF, OS_CONST) Ioc,
+  uint8 Data
+)
+{
+  Std_ReturnType result;
+
+  /* #10 If trap is required: */
+  if(Os_TrapIsTrapRequired(IsTrapRequired) != 0u)                                                                       /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */
+  {
+    Os_TrapPacketType packet;
+
+    /* #20 Marshal API data. */
+    packet.TrapId = OS_TRAPID_IOC08SEND;
+    packet.Parameters[OS_TRAPPARAMINDEX_1].ParamIoc08SendConfigRefType = Ioc;                                           /* SBSW_OS_PWA_LOCAL */
+    packet.Parameters[OS_TRAPPARAMINDEX_2].ParamUint8Type = Data;                                                       /* SBSW_OS_PWA_LOCAL */
+
+    /* #30 Trigger trap. */
+    Os_Hal_Trap(&packet);                                                                                               /* SBSW_OS_FC_POINTER2LOCAL */
+
+    /* #40 Unmarshal return value. */
+    result = packet.ReturnValue.ReturnStd_ReturnType;
+  }
+  /* #50 Otherwise: */
+  else
+  {
+    /* #60 Call the API directly. */
+    result = Os_Ioc08Send(Ioc, Data);                                                                                   /* SBSW_OS_FC_PRECONDITION */
+  }
+
+  return result;
+}
+
+
+/***********************************************************************************************************************
+ *  Os_TrapIoc08ReceiveN()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ *
+ *
+ *
+ */
+FUNC(Std_ReturnType, OS_CODE) Os_TrapIoc08ReceiveN
+(
+  boolean IsTrapRequired,
+  P2CONST(Os_Ioc08ReceiveConfigType, TYPEDEF, OS_CONST) Ioc,
+  P2VAR(uint8, TYPEDEF, AUTOMATIC) Data,
+  uint32 Count,
+  P2VAR(uint32, TYPEDEF, AUTOMATIC) Received
+)
+{
+  Std_ReturnType result;
+
+  /* #10 Check that the given pointer is valid. */
+  if(OS_UNLIKELY(Os_ErrCheckPointerIsNotNull(Received) == OS_CHECK_FAILED))                                             /* PRQA S 0315 */ /* MD_Os_Dir1.1_0315 */ /* SBSW_OS_TRAP_ERRCHECKPOINTERISNOTNULL_001 */
+  {
+    result = IOC_E_NOK;
+  }
+  /* #20 Otherwise, if trap is required: */
+  else if(Os_TrapIsTrapRequired(IsTrapRequired) != 0u)                                                                  /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */
+  {
+    Os_TrapPacketType packet;
+
+    /* #30 Marshal API data. */
+    packet.TrapId = OS_TRAPID_IOC08RECEIVEN;
+    packet.Parameters[OS_TRAPPARAMINDEX_1].ParamIoc08ReceiveConfigRefType = Ioc;                                        /* SBSW_OS_PWA_LOCAL */
+    packet.Parameters[OS_TRAPPARAMINDEX_2].ParamUint8RefType = Data;                                                    /* SBSW_OS_PWA_LOCAL */
+    packet.Parameters[OS_TRAPPARAMINDEX_3].ParamUint32Type = Count;                                                     /* SBSW_OS_PWA_LOCAL */
+    packet.Parameters[OS_TRAPPARAMINDEX_4].ParamUint32RefType = Received;                                               /* SBSW_OS_PWA_LOCAL */
+
+    /* #40 Trigger trap. */
+    Os_Hal_Trap(&packet);                                                                                               /* SBSW_OS_FC_POINTER2LOCAL */
+
+    /* #50 Unmarshal return value. */
+    result = packet.ReturnValue.ReturnStd_ReturnType;
+  }
+  /* #60 Otherwise: */
+  else
+  {
+    /* #70 Call the API directly. */
+    result = Os_Ioc08ReceiveN(Ioc, Data, Count, Received);                                                              /* SBSW_OS_FC_PRECONDITION */
+  }
+
+  return result;
+}
+
+
+/***********************************************************************************************************************
+ *  Os_TrapIoc08SendN()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ *
+ *
+ *
+ */
+FUNC(Std_ReturnType, OS_CODE) Os_TrapIoc08SendN
+(
+  boolean IsTrapRequired,
+  P2CONST(Os_Ioc08SendConfigType, TYPEDEF, OS_CONST) Ioc,
+  P2CONST(uint8, TYPEDEF, AUTOMATIC) Data,
+  uint32 Count,
+  P2VAR(uint32, TYPEDEF, AUTOMATIC) Sent
+)
+{
+  Std_ReturnType result;
+
+  /* #10 Check that the given pointer is valid. */
+  if(OS_UNLIKELY(Os_ErrCheckPointerIsNotNull(Sent) == OS_CHECK_FAILED))                                                 /* PRQA S 0315 */ /* MD_Os_Dir1.1_0315 */ /* SBSW_OS_TRAP_ERRCHECKPOINTERISNOTNULL_001 */
+  {
+    result = IOC_E_NOK;
+  }
+  /* #20 Otherwise, if trap is required: */
+  else if(Os_TrapIsTrapRequired(IsTrapRequired) != 0u)                                                                  /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */
+  {
+    Os_TrapPacketType packet;
+
+    /* #30 Marshal API data. */
+    packet.TrapId = OS_TRAPID_IOC08SENDN;
+    packet.Parameters[OS_TRAPPARAMINDEX_1].ParamIoc08SendConfigRefType = Ioc;                                           /* SBSW_OS_PWA_LOCAL */
+    packet.Parameters[OS_TRAPPARAMINDEX_2].ParamConstUint8RefType = Data;                                               /* SBSW_OS_PWA_LOCAL */
+    packet.Parameters[OS_TRAPPARAMINDEX_3].ParamUint32Type = Count;                                                     /* SBSW_OS_PWA_LOCAL */
+    packet.Parameters[OS_TRAPPARAMINDEX_4].ParamUint32RefType = Sent;                                                   /* SBSW_OS_PWA_LOCAL */
+
+    /* #40 Trigger trap. */
+    Os_Hal_Trap(&packet);                                                                                               /* SBSW_OS_FC_POINTER2LOCAL */
+
+    /* #50 Unmarshal return value. */
+    result = packet.ReturnValue.ReturnStd_ReturnType;
+  }
+  /* #60 Otherwise: */
+  else
+  {
+    /* #70 Call the API directly. */
+    result = Os_Ioc08SendN(Ioc, Data, Count, Sent);                                                                     /* SBSW_OS_FC_PRECONDITION */
+  }
+
+  return result;
+}
+
+
+/***********************************************************************************************************************
+ *  Os_TrapIoc16Receive()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ *
+ *
+ *
+ */
+FUNC(Std_ReturnType, OS_CODE) Os_TrapIoc16Receive
+(
+  boolean IsTrapRequired,
+  P2CONST(Os_Ioc16ReceiveConfigType, TYPEDEF, OS_CONST) Ioc,
+  P2VAR(uint16, TYPEDEF, AUTOMATIC) Data
+)
+{
+  Std_ReturnType result;
+
+  /* #10 If trap is required: */
+  if(Os_TrapIsTrapRequired(IsTrapRequired) != 0u)                                                                       /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */
+  {
+    Os_TrapPacketType packet;
+
+    /* #20 Marshal API data. */
+    packet.TrapId = OS_TRAPID_IOC16RECEIVE;
+    packet.Parameters[OS_TRAPPARAMINDEX_1].ParamIoc16ReceiveConfigRefType = Ioc;                                        /* SBSW_OS_PWA_LOCAL */
+    packet.Parameters[OS_TRAPPARAMINDEX_2].ParamUint16RefType = Data;                                                   /* SBSW_OS_PWA_LOCAL */
+
+    /* #30 Trigger trap. */
+    Os_Hal_Trap(&packet);                                                                                               /* SBSW_OS_FC_POINTER2LOCAL */
+
+    /* #40 Unmarshal return value. */
+    result = packet.ReturnValue.ReturnStd_ReturnType;
+  }
+  /* #50 Otherwise: */
+  else
+  {
+    /* #60 Call the API directly. */
+    result = Os_Ioc16Receive(Ioc, Data);                                                                                /* SBSW_OS_FC_PRECONDITION */
+  }
+
+  return result;
+}
+
+
+/***********************************************************************************************************************
+ *  Os_TrapIoc16EmptyQueue()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ *
+ *
+ *
+ */
+FUNC(Std_ReturnType, OS_CODE) Os_TrapIoc16EmptyQueue
+(
+  boolean IsTrapRequired,
+  P2CONST(Os_Ioc16ReceiveConfigType, TYPEDEF, OS_CONST) Ioc
+)
+{
+  Std_ReturnType result;
+
+  /* #10 If trap is required: */
+  if(Os_TrapIsTrapRequired(IsTrapRequired) != 0u)                                                                       /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */
+  {
+    Os_TrapPacketType packet;
+
+    /* #20 Marshal API data. */
+    packet.TrapId = OS_TRAPID_IOC16EMPTYQUEUE;
+    packet.Parameters[OS_TRAPPARAMINDEX_1].ParamIoc16ReceiveConfigRefType = Ioc;                                        /* SBSW_OS_PWA_LOCAL */
+
+    /* #30 Trigger trap. */
+    Os_Hal_Trap(&packet);                                                                                               /* SBSW_OS_FC_POINTER2LOCAL */
+
+    /* #40 Unmarshal return value. */
+    result = packet.ReturnValue.ReturnStd_ReturnType;
+  }
+  /* #50 Otherwise: */
+  else
+  {
+    /* #60 Call the API directly. */
+    result = Os_Ioc16EmptyQueue(Ioc);                                                                                   /* SBSW_OS_FC_PRECONDITION */
+  }
+
+  return result;
+}
+
+
+/***********************************************************************************************************************
+ *  Os_TrapIoc16Send()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ *
+ *
+ *
+ */
+FUNC(Std_ReturnType, OS_CODE) Os_TrapIoc16Send
+(
+  boolean IsTrapRequired,
+  P2CONST(Os_Ioc16SendConfigType, TYPEDEF, OS_CONST) Ioc,
+  uint16 Data
+)
+{
+  Std_ReturnType result;
+
+  /* #10 If trap is required: */
+  if(Os_TrapIsTrapRequired(IsTrapRequired) != 0u)                                                                       /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */ /* COV_OS_HALPLATFORMTESTEDASMULTICORE */
+  {
+    Os_TrapPacketType packet;
+
+    /* #20 Marshal API data. */
+    packet.TrapId = OS_TRAPID_IOC16SEND;
+    packet.Parameters[OS_TRAPPARAMINDEX_1].ParamIoc16SendConfigRefType = Ioc;                                           /* SBSW_OS_PWA_LOCAL */
+    packet.Parameters[OS_TRAPPARAMINDEX_2].ParamUint16Type = Data;                                                      /* SBSW_OS_PWA_LOCAL */
+
+    /* #30 Trigger trap. */
+    Os_Hal_Trap(&packet);                                                                                               /* SBSW_OS_FC_POINTER2LOCAL */
+
+    /* #40 Unmarshal return value. */
+    result = packet.ReturnValue.ReturnStd_ReturnType;
+  }
+  /* #50 Otherwise: */
+  else
+  {
+    /* #60 Call the API directly. */
+    result = Os_Ioc16Send(Ioc, Data);                                                                                   /* SBSW_OS_FC_PRECONDITION */
+  }
+
+  return result;
+}
+
+
+/***********************************************************************************************************************
+ *  Os_TrapIoc16ReceiveN()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ *
+ *
+ *
+ */
+FUNC(Std_ReturnType, OS_CODE) Os_TrapIoc16ReceiveN
+(
+  boolean IsTrapRequired,
+  P2CONST(Os_Ioc16ReceiveConfigType, TYPEDEF, OS_CONST) Ioc,
+  P2VAR(uint16, TYPEDEF, AUTOMATIC) Data,
+  uint32 Count,
+  P2VAR(uint32, TYPEDEF, AUTOMATIC) Received
+)
+{
+  Std_ReturnType result;
+
+  /* #10 Check that the given pointer is valid. */
+  if(OS_UNLIKELY(Os_ErrCheckPointerIsNotNull(Received) == OS_CHECK_FAILED))                                             /* PRQA S 0315 */ /* MD_Os_Dir1.1_0315 */ /* SBSW_OS_TRAP_ERRCHECKPOINTERISNOTNULL_001 */
+  {
+    result = IOC_E_NOK;
+  }
+  /* #20 Otherwise, if trap is required: */
+  else if(Os_TrapIsTrapRequired(IsTrapRequired) != 0u)                                                                  /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */
+  {
+    Os_TrapPacketType packet;
+
+    /* #30 Marshal API data. */
+    packet.TrapId = OS_TRAPID_IOC16RECEIVEN;
+    packet.Parameters[OS_TRAPPARAMINDEX_1].ParamIoc16ReceiveConfigRefType = Ioc;                                        /* SBSW_OS_PWA_LOCAL */
+    packet.Parameters[OS_TRAPPARAMINDEX_2].ParamUint16RefType = Data;                                                   /* SBSW_OS_PWA_LOCAL */
+    packet.Parameters[OS_TRAPPARAMINDEX_3].ParamUint32Type = Count;                                                     /* SBSW_OS_PWA_LOCAL */
+    packet.Parameters[OS_TRAPPARAMINDEX_4].ParamUint32RefType = Received;                                               /* SBSW_OS_PWA_LOCAL */
+
+    /* #40 Trigger trap. */
+    Os_Hal_Trap(&packet);                                                                                               /* SBSW_OS_FC_POINTER2LOCAL */
+
+    /* #50 Unmarshal return value. */
+    result = packet.ReturnValue.ReturnStd_ReturnType;
+  }
+  /* #60 Otherwise: */
+  else
+  {
+    /* #70 Call the API directly. */
+    result = Os_Ioc16ReceiveN(Ioc, Data, Count, Received);                                                              /* SBSW_OS_FC_PRECONDITION */
+  }
+
+  return result;
+}
+
+
+/***********************************************************************************************************************
+ *  Os_TrapIoc16SendN()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ *
+ *
+ *
+ */
+FUNC(Std_ReturnType, OS_CODE) Os_TrapIoc16SendN
+(
+  boolean IsTrapRequired,
+  P2CONST(Os_Ioc16SendConfigType, TYPEDEF, OS_CONST) Ioc,
+  P2CONST(uint16, TYPEDEF, AUTOMATIC) Data,
+  uint32 Count,
+  P2VAR(uint32, TYPEDEF, AUTOMATIC) Sent
+)
+{
+  Std_ReturnType result;
+
+  /* #10 Check that the given pointer is valid. */
+  if(OS_UNLIKELY(Os_ErrCheckPointerIsNotNull(Sent) == OS_CHECK_FAILED))                                                 /* PRQA S 0315 */ /* MD_Os_Dir1.1_0315 */ /* SBSW_OS_TRAP_ERRCHECKPOINTERISNOTNULL_001 */
+  {
+    result = IOC_E_NOK;
+  }
+  /* #20 Otherwise, if trap is required: */
+  else if(Os_TrapIsTrapRequired(IsTrapRequired) != 0u)                                                                  /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */
+  {
+    Os_TrapPacketType packet;
+
+    /* #30 Marshal API data. */
+    packet.TrapId = OS_TRAPID_IOC16SENDN;
+    packet.Parameters[OS_TRAPPARAMINDEX_1].ParamIoc16SendConfigRefType = Ioc;                                           /* SBSW_OS_PWA_LOCAL */
+    packet.Parameters[OS_TRAPPARAMINDEX_2].ParamConstUint16RefType = Data;                                              /* SBSW_OS_PWA_LOCAL */
+    packet.Parameters[OS_TRAPPARAMINDEX_3].ParamUint32Type = Count;                                                     /* SBSW_OS_PWA_LOCAL */
+    packet.Parameters[OS_TRAPPARAMINDEX_4].ParamUint32RefType = Sent;                                                   /* SBSW_OS_PWA_LOCAL */
+
+    /* #40 Trigger trap. */
+    Os_Hal_Trap(&packet);                                                                                               /* SBSW_OS_FC_POINTER2LOCAL */
+
+    /* #50 Unmarshal return value. */
+    result = packet.ReturnValue.ReturnStd_ReturnType;
+  }
+  /* #60 Otherwise: */
+  else
+  {
+    /* #70 Call the API directly. */
+    result = Os_Ioc16SendN(Ioc, Data, Count, Sent);                                                                     /* SBSW_OS_FC_PRECONDITION */
+  }
+
+  return result;
+}
+
+
+/***********************************************************************************************************************
+ *  Os_TrapIoc32Receive()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ *
+ *
+ *
+ */
+FUNC(Std_ReturnType, OS_CODE) Os_TrapIoc32Receive
+(
+  boolean IsTrapRequired,
+  P2CONST(Os_Ioc32ReceiveConfigType, TYPEDEF, OS_CONST) Ioc,
+  P2VAR(uint32, TYPEDEF, AUTOMATIC) Data
+)
+{
+  Std_ReturnType result;
+
+  /* #10 If trap is required: */
+  if(Os_TrapIsTrapRequired(IsTrapRequired) != 0u)                                                                       /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */
+  {
+    Os_TrapPacketType packet;
+
+    /* #20 Marshal API data. */
+    packet.TrapId = OS_TRAPID_IOC32RECEIVE;
+    packet.Parameters[OS_TRAPPARAMINDEX_1].ParamIoc32ReceiveConfigRefType = Ioc;                                        /* SBSW_OS_PWA_LOCAL */
+    packet.Parameters[OS_TRAPPARAMINDEX_2].ParamUint32RefType = Data;                                                   /* SBSW_OS_PWA_LOCAL */
+
+    /* #30 Trigger trap. */
+    Os_Hal_Trap(&packet);                                                                                               /* SBSW_OS_FC_POINTER2LOCAL */
+
+    /* #40 Unmarshal return value. */
+    result = packet.ReturnValue.ReturnStd_ReturnType;
+  }
+  /* #50 Otherwise: */
+  else
+  {
+    /* #60 Call the API directly. */
+    result = Os_Ioc32Receive(Ioc, Data);                                                                                /* SBSW_OS_FC_PRECONDITION */
+  }
+
+  return result;
+}
+
+
+/***********************************************************************************************************************
+ *  Os_TrapIoc32EmptyQueue()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ *
+ *
+ *
+ */
+FUNC(Std_ReturnType, OS_CODE) Os_TrapIoc32EmptyQueue
+(
+  boolean IsTrapRequired,
+  P2CONST(Os_Ioc32ReceiveConfigType, TYPEDEF, OS_CONST) Ioc
+)
+{
+  Std_ReturnType result;
+
+  /* #10 If trap is required: */
+  if(Os_TrapIsTrapRequired(IsTrapRequired) != 0u)                                                                       /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */
+  {
+    Os_TrapPacketType packet;
+
+    /* #20 Marshal API data. */
+    packet.TrapId = OS_TRAPID_IOC32EMPTYQUEUE;
+    packet.Parameters[OS_TRAPPARAMINDEX_1].ParamIoc32ReceiveConfigRefType = Ioc;                                        /* SBSW_OS_PWA_LOCAL */
+
+    /* #30 Trigger trap. */
+    Os_Hal_Trap(&packet);                                                                                               /* SBSW_OS_FC_POINTER2LOCAL */
+
+    /* #40 Unmarshal return value. */
+    result = packet.ReturnValue.ReturnStd_ReturnType;
+  }
+  /* #50 Otherwise: */
+  else
+  {
+    /* #60 Call the API directly. */
+    result = Os_Ioc32EmptyQueue(Ioc);                                                                                   /* SBSW_OS_FC_PRECONDITION */
+  }
+
+  return result;
+}
+
+
+/***********************************************************************************************************************
+ *  Os_TrapIoc32Send()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ *
+ *
+ *
+ */
+FUNC(Std_ReturnType, OS_CODE) Os_TrapIoc32Send
+(
+  boolean IsTrapRequired,
+  P2CONST(Os_Ioc32SendConfigType, TYPEDEF, OS_CONST) Ioc,
+  uint32 Data
+)
+{
+  Std_ReturnType result;
+
+  /* #10 If trap is required: */
+  if(Os_TrapIsTrapRequired(IsTrapRequired) != 0u)                                                                       /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */
+  {
+    Os_TrapPacketType packet;
+
+    /* #20 Marshal API data. */
+    packet.TrapId = OS_TRAPID_IOC32SEND;
+    packet.Parameters[OS_TRAPPARAMINDEX_1].ParamIoc32SendConfigRefType = Ioc;                                           /* SBSW_OS_PWA_LOCAL */
+    packet.Parameters[OS_TRAPPARAMINDEX_2].ParamUint32Type = Data;                                                      /* SBSW_OS_PWA_LOCAL */
+
+    /* #30 Trigger trap. */
+    Os_Hal_Trap(&packet);                                                                                               /* SBSW_OS_FC_POINTER2LOCAL */
+
+    /* #40 Unmarshal return value. */
+    result =  packet.ReturnValue.ReturnStd_ReturnType;
+  }
+  /* #50 Otherwise: */
+  else
+  {
+    /* #60 Call the API directly. */
+    result = Os_Ioc32Send(Ioc, Data);                                                                                   /* SBSW_OS_FC_PRECONDITION */
+  }
+
+  return result;
+}
+
+
+/***********************************************************************************************************************
+ *  Os_TrapIoc32ReceiveN()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ *
+ *
+ *
+ */
+FUNC(Std_ReturnType, OS_CODE) Os_TrapIoc32ReceiveN
+(
+  boolean IsTrapRequired,
+  P2CONST(Os_Ioc32ReceiveConfigType, TYPEDEF, OS_CONST) Ioc,
+  P2VAR(uint32, TYPEDEF, AUTOMATIC) Data,
+  uint32 Count,
+  P2VAR(uint32, TYPEDEF, AUTOMATIC) Received
+)
+{
+  Std_ReturnType result;
+
+  /* #10 Check that the given pointer is valid. */
+  if(OS_UNLIKELY(Os_ErrCheckPointerIsNotNull(Received) == OS_CHECK_FAILED))                                             /* PRQA S 0315 */ /* MD_Os_Dir1.1_0315 */ /* SBSW_OS_TRAP_ERRCHECKPOINTERISNOTNULL_001 */
+  {
+    result = IOC_E_NOK;
+  }
+  /* #20 Otherwise, if trap is required: */
+  else if(Os_TrapIsTrapRequired(IsTrapRequired) != 0u)                                                                  /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */
+  {
+    Os_TrapPacketType packet;
+
+    /* #30 Marshal API data. */
+    packet.TrapId = OS_TRAPID_IOC32RECEIVEN;
+    packet.Parameters[OS_TRAPPARAMINDEX_1].ParamIoc32ReceiveConfigRefType = Ioc;                                        /* SBSW_OS_PWA_LOCAL */
+    packet.Parameters[OS_TRAPPARAMINDEX_2].ParamUint32RefType = Data;                                                   /* SBSW_OS_PWA_LOCAL */
+    packet.Parameters[OS_TRAPPARAMINDEX_3].ParamUint32Type = Count;                                                     /* SBSW_OS_PWA_LOCAL */
+    packet.Parameters[OS_TRAPPARAMINDEX_4].ParamUint32RefType = Received;                                               /* SBSW_OS_PWA_LOCAL */
+
+    /* #40 Trigger trap. */
+    Os_Hal_Trap(&packet);                                                                                               /* SBSW_OS_FC_POINTER2LOCAL */
+
+    /* #50 Unmarshal return value. */
+    result = packet.ReturnValue.ReturnStd_ReturnType;
+  }
+  /* #60 Otherwise: */
+  else
+  {
+    /* #70 Call the API directly. */
+    result = Os_Ioc32ReceiveN(Ioc, Data, Count, Received);                                                              /* SBSW_OS_FC_PRECONDITION */
+  }
+
+  return result;
+}
+
+
+/***********************************************************************************************************************
+ *  Os_TrapIoc32SendN()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ *
+ *
+ *
+ */
+FUNC(Std_ReturnType, OS_CODE) Os_TrapIoc32SendN
+(
+  boolean IsTrapRequired,
+  P2CONST(Os_Ioc32SendConfigType, TYPEDEF, OS_CONST) Ioc,
+  P2CONST(uint32, TYPEDEF, AUTOMATIC) Data,
+  uint32 Count,
+  P2VAR(uint32, TYPEDEF, AUTOMATIC) Sent
+)
+{
+  Std_ReturnType result;
+
+  /* #10 Check that the given pointer is valid. */
+  if(OS_UNLIKELY(Os_ErrCheckPointerIsNotNull(Sent) == OS_CHECK_FAILED))                                                 /* PRQA S 0315 */ /* MD_Os_Dir1.1_0315 */ /* SBSW_OS_TRAP_ERRCHECKPOINTERISNOTNULL_001 */
+  {
+    result = IOC_E_NOK;
+  }
+  /* #20 Otherwise, if trap is required: */
+  else if(Os_TrapIsTrapRequired(IsTrapRequired) != 0u)                                                                  /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */
+  {
+    Os_TrapPacketType packet;
+
+    /* #30 Marshal API data. */
+    packet.TrapId = OS_TRAPID_IOC32SENDN;
+    packet.Parameters[OS_TRAPPARAMINDEX_1].ParamIoc32SendConfigRefType = Ioc;                                           /* SBSW_OS_PWA_LOCAL */
+    packet.Parameters[OS_TRAPPARAMINDEX_2].ParamConstUint32RefType = Data;                                              /* SBSW_OS_PWA_LOCAL */
+    packet.Parameters[OS_TRAPPARAMINDEX_3].ParamUint32Type = Count;                                                     /* SBSW_OS_PWA_LOCAL */
+    packet.Parameters[OS_TRAPPARAMINDEX_4].ParamUint32RefType = Sent;                                                   /* SBSW_OS_PWA_LOCAL */
+
+    /* #40 Trigger trap. */
+    Os_Hal_Trap(&packet);                                                                                               /* SBSW_OS_FC_POINTER2LOCAL */
+
+    /* #50 Unmarshal return value. */
+    result = packet.ReturnValue.ReturnStd_ReturnType;
+  }
+  /* #60 Otherwise: */
+  else
+  {
+    /* #70 Call the API directly. */
+    result = Os_Ioc32SendN(Ioc, Data, Count, Sent);                                                                     /* SBSW_OS_FC_PRECONDITION */
+  }
+
+  return result;
+}
+
+
+/***********************************************************************************************************************
+ *  Os_TrapIocRefReceive()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ *
+ *
+ *
+ */
+FUNC(Std_ReturnType, OS_CODE) Os_TrapIocRefReceive
+(
+  boolean IsTrapRequired,
+  P2CONST(Os_IocRefReceiveConfigType, TYPEDEF, OS_CONST) Ioc,
+  P2VAR(void, TYPEDEF, AUTOMATIC) Data
+)
+{
+  Std_ReturnType result;
+
+  /* #10 If trap is required: */
+  if(Os_TrapIsTrapRequired(IsTrapRequired) != 0u)                                                                       /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */ /* COV_OS_HALPLATFORMTESTEDASMULTICORE */
+  {
+    Os_TrapPacketType packet;
 
     /* #20 Marshal API data. */
-    packet.TrapId = OS_TRAPID_SPINLOCKTRYGET;
-    packet.Parameters[OS_TRAPPARAMINDEX_1].ParamSpinlockConfigRefType = Spinlock;                                       /* SBSW_OS_PWA_LOCAL */
-    packet.Parameters[OS_TRAPPARAMINDEX_2].ParamApiType.ParamTryToGetSpinlockRefType =
-                                                                (TryToGetSpinlockType*)&userspaceSuccess;               /* SBSW_OS_PWA_LOCAL */
+    packet.TrapId = OS_TRAPID_IOCREFRECEIVE;
+    packet.Parameters[OS_TRAPPARAMINDEX_1].ParamIocRefReceiveConfigRefType = Ioc;                                       /* SBSW_OS_PWA_LOCAL */
+    packet.Parameters[OS_TRAPPARAMINDEX_2].ParamVoidRefType = Data;                                                     /* SBSW_OS_PWA_LOCAL */
 
     /* #30 Trigger trap. */
     Os_Hal_Trap(&packet);                                                                                               /* SBSW_OS_FC_POINTER2LOCAL */
 
     /* #40 Unmarshal return value. */
-    (*Success) = *((volatile TryToGetSpinlockType*)&userspaceSuccess);                                                  /* SBSW_OS_TRAP_API_USERPOINTER_002 */
-    status = packet.ReturnValue.ReturnOs_StatusType;
+    result = packet.ReturnValue.ReturnStd_ReturnType;
   }
   /* #50 Otherwise: */
   else
   {
     /* #60 Call the API directly. */
-    status = Os_TrapCallTryToGetSpinlock(Spinlock, Success);                                                            /* SBSW_OS_FC_PRECONDITION */
+    result = Os_IocRefReceive(Ioc, Data);                                                                               /* SBSW_OS_FC_PRECONDITION */
   }
 
-  return status;
+  return result;
 }
 
 
 /***********************************************************************************************************************
- *  Os_TrapIoc08Receive()
+ *  Os_TrapIocRefEmptyQueue()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -6115,24 +7590,22 @@ FUNC(Os_StatusType, OS_CODE) Os_TrapSpinlockTryGet
  *
  *
  */
-FUNC(Std_ReturnType, OS_CODE) Os_TrapIoc08Receive
+FUNC(Std_ReturnType, OS_CODE) Os_TrapIocRefEmptyQueue
 (
   boolean IsTrapRequired,
-  P2CONST(Os_Ioc08ReceiveConfigType, TYPEDEF, OS_CONST) Ioc,
-  P2VAR(uint8, TYPEDEF, AUTOMATIC) Data
+  P2CONST(Os_IocRefReceiveConfigType, TYPEDEF, OS_CONST) Ioc
 )
 {
   Std_ReturnType result;
 
   /* #10 If trap is required: */
-  if(Os_TrapIsTrapRequired(IsTrapRequired) != 0u)                                                                       /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */
+  if(Os_TrapIsTrapRequired(IsTrapRequired) != 0u)                                                                       /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */ /* COV_OS_HALPLATFORMTESTEDASMULTICORE */
   {
     Os_TrapPacketType packet;
 
     /* #20 Marshal API data. */
-    packet.TrapId = OS_TRAPID_IOC08RECEIVE;
-    packet.Parameters[OS_TRAPPARAMINDEX_1].ParamIoc08ReceiveConfigRefType = Ioc;                                        /* SBSW_OS_PWA_LOCAL */
-    packet.Parameters[OS_TRAPPARAMINDEX_2].ParamUint8RefType = Data;                                                    /* SBSW_OS_PWA_LOCAL */
+    packet.TrapId = OS_TRAPID_IOCREFEMPTYQUEUE;
+    packet.Parameters[OS_TRAPPARAMINDEX_1].ParamIocRefReceiveConfigRefType = Ioc;                                       /* SBSW_OS_PWA_LOCAL */
 
     /* #30 Trigger trap. */
     Os_Hal_Trap(&packet);                                                                                               /* SBSW_OS_FC_POINTER2LOCAL */
@@ -6144,7 +7617,7 @@ FUNC(Std_ReturnType, OS_CODE) Os_TrapIoc08Receive
   else
   {
     /* #60 Call the API directly. */
-    result = Os_Ioc08Receive(Ioc, Data);                                                                                /* SBSW_OS_FC_PRECONDITION */
+    result = Os_IocRefEmptyQueue(Ioc);                                                                                  /* SBSW_OS_FC_PRECONDITION */
   }
 
   return result;
@@ -6152,7 +7625,7 @@ FUNC(Std_ReturnType, OS_CODE) Os_TrapIoc08Receive
 
 
 /***********************************************************************************************************************
- *  Os_TrapIoc8EmptyQueue()
+ *  Os_TrapIocRefSend()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -6164,22 +7637,24 @@ FUNC(Std_ReturnType, OS_CODE) Os_TrapIoc08Receive
  *
  *
  */
-FUNC(Std_ReturnType, OS_CODE) Os_TrapIoc08EmptyQueue
+FUNC(Std_ReturnType, OS_CODE) Os_TrapIocRefSend
 (
   boolean IsTrapRequired,
-  P2CONST(Os_Ioc08ReceiveConfigType, TYPEDEF, OS_CONST) Ioc
+  P2CONST(Os_IocRefSendConfigType, TYPEDEF, OS_CONST) Ioc,
+  P2CONST(void, TYPEDEF, AUTOMATIC) Data
 )
 {
   Std_ReturnType result;
 
   /* #10 If trap is required: */
-  if(Os_TrapIsTrapRequired(IsTrapRequired) != 0u)                                                                       /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */
+  if(Os_TrapIsTrapRequired(IsTrapRequired) != 0u)                                                                       /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */ /* COV_OS_HALPLATFORMTESTEDASMULTICORE */
   {
     Os_TrapPacketType packet;
 
     /* #20 Marshal API data. */
-    packet.TrapId = OS_TRAPID_IOC08EMPTYQUEUE;
-    packet.Parameters[OS_TRAPPARAMINDEX_1].ParamIoc08ReceiveConfigRefType = Ioc;                                        /* SBSW_OS_PWA_LOCAL */
+    packet.TrapId = OS_TRAPID_IOCREFSEND;
+    packet.Parameters[OS_TRAPPARAMINDEX_1].ParamIocRefSendConfigRefType = Ioc;                                          /* SBSW_OS_PWA_LOCAL */
+    packet.Parameters[OS_TRAPPARAMINDEX_2].ParamVoidConfigRefType = Data;                                               /* SBSW_OS_PWA_LOCAL */
 
     /* #30 Trigger trap. */
     Os_Hal_Trap(&packet);                                                                                               /* SBSW_OS_FC_POINTER2LOCAL */
@@ -6191,7 +7666,7 @@ FUNC(Std_ReturnType, OS_CODE) Os_TrapIoc08EmptyQueue
   else
   {
     /* #60 Call the API directly. */
-    result = Os_Ioc08EmptyQueue(Ioc);                                                                                   /* SBSW_OS_FC_PRECONDITION */
+    result = Os_IocRefSend(Ioc, Data);                                                                                  /* SBSW_OS_FC_PRECONDITION */
   }
 
   return result;
@@ -6199,7 +7674,7 @@ FUNC(Std_ReturnType, OS_CODE) Os_TrapIoc08EmptyQueue
 
 
 /***********************************************************************************************************************
- *  Os_TrapIoc8Send()
+ *  Os_TrapIocRead()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -6211,24 +7686,24 @@ FUNC(Std_ReturnType, OS_CODE) Os_TrapIoc08EmptyQueue
  *
  *
  */
-FUNC(Std_ReturnType, OS_CODE) Os_TrapIoc08Send
+FUNC(Std_ReturnType, OS_CODE) Os_TrapIocRead
 (
   boolean IsTrapRequired,
-  P2CONST(Os_Ioc08SendConfigType, TYPEDEF, OS_CONST) Ioc,
-  uint8 Data
+  P2CONST(Os_IocReadConfigType, TYPEDEF, OS_CONST) Ioc,
+  P2VAR(void, TYPEDEF, AUTOMATIC) Data
 )
 {
   Std_ReturnType result;
 
   /* #10 If trap is required: */
-  if(Os_TrapIsTrapRequired(IsTrapRequired) != 0u)                                                                       /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */
+  if(Os_TrapIsTrapRequired(IsTrapRequired) != 0u)                                                                       /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */ /* COV_OS_HALPLATFORMTESTEDASMULTICORE */
   {
     Os_TrapPacketType packet;
 
     /* #20 Marshal API data. */
-    packet.TrapId = OS_TRAPID_IOC08SEND;
-    packet.Parameters[OS_TRAPPARAMINDEX_1].ParamIoc08SendConfigRefType = Ioc;                                           /* SBSW_OS_PWA_LOCAL */
-    packet.Parameters[OS_TRAPPARAMINDEX_2].ParamUint8Type = Data;                                                       /* SBSW_OS_PWA_LOCAL */
+    packet.TrapId = OS_TRAPID_IOCREAD;
+    packet.Parameters[OS_TRAPPARAMINDEX_1].ParamIocReadConfigRefType = Ioc;                                             /* SBSW_OS_PWA_LOCAL */
+    packet.Parameters[OS_TRAPPARAMINDEX_2].ParamVoidRefType = Data;                                                     /* SBSW_OS_PWA_LOCAL */
 
     /* #30 Trigger trap. */
     Os_Hal_Trap(&packet);                                                                                               /* SBSW_OS_FC_POINTER2LOCAL */
@@ -6240,7 +7715,7 @@ FUNC(Std_ReturnType, OS_CODE) Os_TrapIoc08Send
   else
   {
     /* #60 Call the API directly. */
-    result = Os_Ioc08Send(Ioc, Data);                                                                                   /* SBSW_OS_FC_PRECONDITION */
+    result = Os_IocRead(Ioc, Data);                                                                                     /* SBSW_OS_FC_PRECONDITION */
   }
 
   return result;
@@ -6248,7 +7723,7 @@ FUNC(Std_ReturnType, OS_CODE) Os_TrapIoc08Send
 
 
 /***********************************************************************************************************************
- *  Os_TrapIoc16Receive()
+ *  Os_TrapIocWrite()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -6260,24 +7735,169 @@ FUNC(Std_ReturnType, OS_CODE) Os_TrapIoc08Send
  *
  *
  */
-FUNC(Std_ReturnType, OS_CODE) Os_TrapIoc16Receive
+FUNC(Std_ReturnType, OS_CODE) Os_TrapIocWrite
 (
   boolean IsTrapRequired,
-  P2CONST(Os_Ioc16ReceiveConfigType, TYPEDEF, OS_CONST) Ioc,
+  P2CONST(Os_IocWriteConfigType, TYPEDEF, OS_CONST) Ioc,
+  P2CONST(void, TYPEDEF, AUTOMATIC) Data
+)
+{
+  Std_ReturnType result;
+
+  /* #10 If trap is required: */
+  if(Os_TrapIsTrapRequired(IsTrapRequired) != 0u)                                                                       /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */ /* COV_OS_HALPLATFORMTESTEDASMULTICORE */
+  {
+    Os_TrapPacketType packet;
+
+    /* #20 Marshal API data. */
+    packet.TrapId = OS_TRAPID_IOCWRITE;
+    packet.Parameters[OS_TRAPPARAMINDEX_1].ParamIocWriteConfigRefType = Ioc;                                            /* SBSW_OS_PWA_LOCAL */
+    packet.Parameters[OS_TRAPPARAMINDEX_2].ParamVoidConfigRefType = Data;                                               /* SBSW_OS_PWA_LOCAL */
+
+    /* #30 Trigger trap. */
+    Os_Hal_Trap(&packet);                                                                                               /* SBSW_OS_FC_POINTER2LOCAL */
+
+    /* #40 Unmarshal return value. */
+    result = packet.ReturnValue.ReturnStd_ReturnType;
+  }
+  /* #50 Otherwise: */
+  else
+  {
+    /* #60 Call the API directly. */
+    result = Os_IocWrite(Ioc, Data);                                                                                    /* SBSW_OS_FC_PRECONDITION */
+  }
+
+  return result;
+}
+
+
+/***********************************************************************************************************************
+ *  Os_TrapIoc08MultiReceive()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ *
+ *
+ *
+ */
+FUNC(Std_ReturnType, OS_CODE) Os_TrapIoc08MultiReceive                                                                  /* COV_OS_HALPLATFORMTESTEDASMULTICORE */
+(
+  boolean IsTrapRequired,
+  P2CONST(Os_Ioc08MultiReceiveConfigType, TYPEDEF, OS_CONST) Ioc,
+  P2VAR(uint8, TYPEDEF, AUTOMATIC) Data
+)
+{
+  Std_ReturnType result;
+
+  /* #10 If trap is required: */
+  if(Os_TrapIsTrapRequired(IsTrapRequired) != 0u)                                                                       /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */ /* COV_OS_HALPLATFORM_NEED_NO_TRAP_IOC_MULTIQUEUE */
+  {
+    Os_TrapPacketType packet;
+
+    /* #20 Marshal API data. */
+    packet.TrapId = OS_TRAPID_IOC08MULTIRECEIVE;
+    packet.Parameters[OS_TRAPPARAMINDEX_1].ParamIoc08MultiReceiveConfigRefType = Ioc;                                   /* SBSW_OS_PWA_LOCAL */
+    packet.Parameters[OS_TRAPPARAMINDEX_2].ParamVoidConfigRefType = Data;                                               /* PRQA S 0315 */ /* MD_Os_Dir1.1_0315 */ /* SBSW_OS_PWA_LOCAL */
+
+    /* #30 Trigger trap. */
+    Os_Hal_Trap(&packet);                                                                                               /* SBSW_OS_FC_POINTER2LOCAL */
+
+    /* #40 Unmarshal return value. */
+    result = packet.ReturnValue.ReturnStd_ReturnType;
+  }
+  /* #50 Otherwise: */
+  else
+  {
+    /* #60 Call the API directly. */
+    result = Os_Ioc08MultiReceive(Ioc, Data);                                                                           /* SBSW_OS_FC_PRECONDITION */
+  }
+
+  return result;
+}
+
+
+/***********************************************************************************************************************
+ *  Os_TrapIoc08EmptyMultiQueue()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ *
+ *
+ *
+ */
+FUNC(Std_ReturnType, OS_CODE) Os_TrapIoc08EmptyMultiQueue                                                               /* COV_OS_HALPLATFORMTESTEDASMULTICORE */
+(
+  boolean IsTrapRequired,
+  P2CONST(Os_Ioc08MultiReceiveConfigType, TYPEDEF, OS_CONST) Ioc
+)
+{
+  Std_ReturnType result;
+
+  /* #10 If trap is required: */
+  if(Os_TrapIsTrapRequired(IsTrapRequired) != 0u)                                                                       /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */ /* COV_OS_HALPLATFORM_NEED_NO_TRAP_IOC_MULTIQUEUE */
+  {
+    Os_TrapPacketType packet;
+
+    /* #20 Marshal API data. */
+    packet.TrapId = OS_TRAPID_IOC08EMPTYMULTIQUEUE;
+    packet.Parameters[OS_TRAPPARAMINDEX_1].ParamIoc08MultiReceiveConfigRefType = Ioc;                                   /* SBSW_OS_PWA_LOCAL */
+
+    /* #30 Trigger trap. */
+    Os_Hal_Trap(&packet);                                                                                               /* SBSW_OS_FC_POINTER2LOCAL */
+
+    /* #40 Unmarshal return value. */
+    result = packet.ReturnValue.ReturnStd_ReturnType;
+  }
+  /* #50 Otherwise: */
+  else
+  {
+    /* #60 Call the API directly. */
+    result = Os_Ioc08EmptyMultiQueue(Ioc);                                                                              /* SBSW_OS_FC_PRECONDITION */
+  }
+
+  return result;
+}
+
+
+/***********************************************************************************************************************
+ *  Os_TrapIoc16MultiReceive()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ *
+ *
+ *
+ */
+FUNC(Std_ReturnType, OS_CODE) Os_TrapIoc16MultiReceive                                                                  /* COV_OS_HALPLATFORMTESTEDASMULTICORE */
+(
+  boolean IsTrapRequired,
+  P2CONST(Os_Ioc16MultiReceiveConfigType, TYPEDEF, OS_CONST) Ioc,
   P2VAR(uint16, TYPEDEF, AUTOMATIC) Data
 )
 {
   Std_ReturnType result;
 
   /* #10 If trap is required: */
-  if(Os_TrapIsTrapRequired(IsTrapRequired) != 0u)                                                                       /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */
+  if(Os_TrapIsTrapRequired(IsTrapRequired) != 0u)                                                                       /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */ /* COV_OS_HALPLATFORM_NEED_NO_TRAP_IOC_MULTIQUEUE */
   {
     Os_TrapPacketType packet;
 
     /* #20 Marshal API data. */
-    packet.TrapId = OS_TRAPID_IOC16RECEIVE;
-    packet.Parameters[OS_TRAPPARAMINDEX_1].ParamIoc16ReceiveConfigRefType = Ioc;                                        /* SBSW_OS_PWA_LOCAL */
-    packet.Parameters[OS_TRAPPARAMINDEX_2].ParamUint16RefType = Data;                                                   /* SBSW_OS_PWA_LOCAL */
+    packet.TrapId = OS_TRAPID_IOC16MULTIRECEIVE;
+    packet.Parameters[OS_TRAPPARAMINDEX_1].ParamIoc16MultiReceiveConfigRefType = Ioc;                                   /* SBSW_OS_PWA_LOCAL */
+    packet.Parameters[OS_TRAPPARAMINDEX_2].ParamVoidConfigRefType = Data;                                               /* PRQA S 0315 */ /* MD_Os_Dir1.1_0315 */ /* SBSW_OS_PWA_LOCAL */
 
     /* #30 Trigger trap. */
     Os_Hal_Trap(&packet);                                                                                               /* SBSW_OS_FC_POINTER2LOCAL */
@@ -6289,7 +7909,7 @@ FUNC(Std_ReturnType, OS_CODE) Os_TrapIoc16Receive
   else
   {
     /* #60 Call the API directly. */
-    result = Os_Ioc16Receive(Ioc, Data);                                                                                /* SBSW_OS_FC_PRECONDITION */
+    result = Os_Ioc16MultiReceive(Ioc, Data);                                                                           /* SBSW_OS_FC_PRECONDITION */
   }
 
   return result;
@@ -6297,7 +7917,7 @@ FUNC(Std_ReturnType, OS_CODE) Os_TrapIoc16Receive
 
 
 /***********************************************************************************************************************
- *  Os_TrapIoc16EmptyQueue()
+ *  Os_TrapIoc16EmptyMultiQueue()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -6309,22 +7929,22 @@ FUNC(Std_ReturnType, OS_CODE) Os_TrapIoc16Receive
  *
  *
  */
-FUNC(Std_ReturnType, OS_CODE) Os_TrapIoc16EmptyQueue
+FUNC(Std_ReturnType, OS_CODE) Os_TrapIoc16EmptyMultiQueue                                                               /* COV_OS_HALPLATFORMTESTEDASMULTICORE */
 (
   boolean IsTrapRequired,
-  P2CONST(Os_Ioc16ReceiveConfigType, TYPEDEF, OS_CONST) Ioc
+  P2CONST(Os_Ioc16MultiReceiveConfigType, TYPEDEF, OS_CONST) Ioc
 )
 {
   Std_ReturnType result;
 
   /* #10 If trap is required: */
-  if(Os_TrapIsTrapRequired(IsTrapRequired) != 0u)                                                                       /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */
+  if(Os_TrapIsTrapRequired(IsTrapRequired) != 0u)                                                                       /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */ /* COV_OS_HALPLATFORM_NEED_NO_TRAP_IOC_MULTIQUEUE */
   {
     Os_TrapPacketType packet;
 
     /* #20 Marshal API data. */
-    packet.TrapId = OS_TRAPID_IOC16EMPTYQUEUE;
-    packet.Parameters[OS_TRAPPARAMINDEX_1].ParamIoc16ReceiveConfigRefType = Ioc;                                        /* SBSW_OS_PWA_LOCAL */
+    packet.TrapId = OS_TRAPID_IOC16EMPTYMULTIQUEUE;
+    packet.Parameters[OS_TRAPPARAMINDEX_1].ParamIoc16MultiReceiveConfigRefType = Ioc;                                   /* SBSW_OS_PWA_LOCAL */
 
     /* #30 Trigger trap. */
     Os_Hal_Trap(&packet);                                                                                               /* SBSW_OS_FC_POINTER2LOCAL */
@@ -6336,7 +7956,7 @@ FUNC(Std_ReturnType, OS_CODE) Os_TrapIoc16EmptyQueue
   else
   {
     /* #60 Call the API directly. */
-    result = Os_Ioc16EmptyQueue(Ioc);                                                                                   /* SBSW_OS_FC_PRECONDITION */
+    result = Os_Ioc16EmptyMultiQueue(Ioc);                                                                              /* SBSW_OS_FC_PRECONDITION */
   }
 
   return result;
@@ -6344,7 +7964,7 @@ FUNC(Std_ReturnType, OS_CODE) Os_TrapIoc16EmptyQueue
 
 
 /***********************************************************************************************************************
- *  Os_TrapIoc16Send()
+ *  Os_TrapIoc32MultiReceive()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -6356,24 +7976,24 @@ FUNC(Std_ReturnType, OS_CODE) Os_TrapIoc16EmptyQueue
  *
  *
  */
-FUNC(Std_ReturnType, OS_CODE) Os_TrapIoc16Send
+FUNC(Std_ReturnType, OS_CODE) Os_TrapIoc32MultiReceive                                                                  /* COV_OS_HALPLATFORMTESTEDASMULTICORE */
 (
   boolean IsTrapRequired,
-  P2CONST(Os_Ioc16SendConfigType, TYPEDEF, OS_CONST) Ioc,
-  uint16 Data
+  P2CONST(Os_Ioc32MultiReceiveConfigType, TYPEDEF, OS_CONST) Ioc,
+  P2VAR(uint32, TYPEDEF, AUTOMATIC) Data
 )
 {
   Std_ReturnType result;
 
   /* #10 If trap is required: */
-  if(Os_TrapIsTrapRequired(IsTrapRequired) != 0u)                                                                       /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */ /* COV_OS_HALPLATFORMTESTEDASMULTICORE */
+  if(Os_TrapIsTrapRequired(IsTrapRequired) != 0u)                                                                       /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */ /* COV_OS_HALPLATFORM_NEED_NO_TRAP_IOC_MULTIQUEUE */
   {
     Os_TrapPacketType packet;
 
     /* #20 Marshal API data. */
-    packet.TrapId = OS_TRAPID_IOC16SEND;
-    packet.Parameters[OS_TRAPPARAMINDEX_1].ParamIoc16SendConfigRefType = Ioc;                                           /* SBSW_OS_PWA_LOCAL */
-    packet.Parameters[OS_TRAPPARAMINDEX_2].ParamUint16Type = Data;                                                      /* SBSW_OS_PWA_LOCAL */
+    packet.TrapId = OS_TRAPID_IOC32MULTIRECEIVE;
+    packet.Parameters[OS_TRAPPARAMINDEX_1].ParamIoc32MultiReceiveConfigRefType = Ioc;                                   /* SBSW_OS_PWA_LOCAL */
+    packet.Parameters[OS_TRAPPARAMINDEX_2].ParamVoidConfigRefType = Data;                                               /* PRQA S 0315 */ /* MD_Os_Dir1.1_0315 */ /* SBSW_OS_PWA_LOCAL */
 
     /* #30 Trigger trap. */
     Os_Hal_Trap(&packet);                                                                                               /* SBSW_OS_FC_POINTER2LOCAL */
@@ -6385,15 +8005,14 @@ FUNC(Std_ReturnType, OS_CODE) Os_TrapIoc16Send
   else
   {
     /* #60 Call the API directly. */
-    result = Os_Ioc16Send(Ioc, Data);                                                                                   /* SBSW_OS_FC_PRECONDITION */
+    result = Os_Ioc32MultiReceive(Ioc, Data);                                                                           /* SBSW_OS_FC_PRECONDITION */
   }
 
   return result;
 }
 
-
 /***********************************************************************************************************************
- *  Os_TrapIoc32Receive()
+ *  Os_TrapIoc32EmptyMultiQueue()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -6405,24 +8024,22 @@ FUNC(Std_ReturnType, OS_CODE) Os_TrapIoc16Send
  *
  *
  */
-FUNC(Std_ReturnType, OS_CODE) Os_TrapIoc32Receive
+FUNC(Std_ReturnType, OS_CODE) Os_TrapIoc32EmptyMultiQueue                                                               /* COV_OS_HALPLATFORMTESTEDASMULTICORE */
 (
   boolean IsTrapRequired,
-  P2CONST(Os_Ioc32ReceiveConfigType, TYPEDEF, OS_CONST) Ioc,
-  P2VAR(uint32, TYPEDEF, AUTOMATIC) Data
+  P2CONST(Os_Ioc32MultiReceiveConfigType, TYPEDEF, OS_CONST) Ioc
 )
 {
   Std_ReturnType result;
 
   /* #10 If trap is required: */
-  if(Os_TrapIsTrapRequired(IsTrapRequired) != 0u)                                                                       /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */
+  if(Os_TrapIsTrapRequired(IsTrapRequired) != 0u)                                                                       /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */ /* COV_OS_HALPLATFORM_NEED_NO_TRAP_IOC_MULTIQUEUE */
   {
     Os_TrapPacketType packet;
 
     /* #20 Marshal API data. */
-    packet.TrapId = OS_TRAPID_IOC32RECEIVE;
-    packet.Parameters[OS_TRAPPARAMINDEX_1].ParamIoc32ReceiveConfigRefType = Ioc;                                        /* SBSW_OS_PWA_LOCAL */
-    packet.Parameters[OS_TRAPPARAMINDEX_2].ParamUint32RefType = Data;                                                   /* SBSW_OS_PWA_LOCAL */
+    packet.TrapId = OS_TRAPID_IOC32EMPTYMULTIQUEUE;
+    packet.Parameters[OS_TRAPPARAMINDEX_1].ParamIoc32MultiReceiveConfigRefType = Ioc;                                   /* SBSW_OS_PWA_LOCAL */
 
     /* #30 Trigger trap. */
     Os_Hal_Trap(&packet);                                                                                               /* SBSW_OS_FC_POINTER2LOCAL */
@@ -6434,15 +8051,14 @@ FUNC(Std_ReturnType, OS_CODE) Os_TrapIoc32Receive
   else
   {
     /* #60 Call the API directly. */
-    result = Os_Ioc32Receive(Ioc, Data);                                                                                /* SBSW_OS_FC_PRECONDITION */
+    result = Os_Ioc32EmptyMultiQueue(Ioc);                                                                              /* SBSW_OS_FC_PRECONDITION */
   }
 
   return result;
 }
 
-
 /***********************************************************************************************************************
- *  Os_TrapIoc32EmptyQueue()
+ *  Os_TrapIocRefMultiReceive()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -6454,22 +8070,24 @@ FUNC(Std_ReturnType, OS_CODE) Os_TrapIoc32Receive
  *
  *
  */
-FUNC(Std_ReturnType, OS_CODE) Os_TrapIoc32EmptyQueue
+FUNC(Std_ReturnType, OS_CODE) Os_TrapIocRefMultiReceive                                                                 /* COV_OS_HALPLATFORMTESTEDASMULTICORE */
 (
   boolean IsTrapRequired,
-  P2CONST(Os_Ioc32ReceiveConfigType, TYPEDEF, OS_CONST) Ioc
+  P2CONST(Os_IocRefMultiReceiveConfigType, TYPEDEF, OS_CONST) Ioc,
+  P2VAR(void, TYPEDEF, AUTOMATIC) Data
 )
 {
   Std_ReturnType result;
 
   /* #10 If trap is required: */
-  if(Os_TrapIsTrapRequired(IsTrapRequired) != 0u)                                                                       /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */
+  if(Os_TrapIsTrapRequired(IsTrapRequired) != 0u)                                                                       /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */ /* COV_OS_HALPLATFORM_NEED_NO_TRAP_IOC_MULTIQUEUE */
   {
     Os_TrapPacketType packet;
 
     /* #20 Marshal API data. */
-    packet.TrapId = OS_TRAPID_IOC32EMPTYQUEUE;
-    packet.Parameters[OS_TRAPPARAMINDEX_1].ParamIoc32ReceiveConfigRefType = Ioc;                                        /* SBSW_OS_PWA_LOCAL */
+    packet.TrapId = OS_TRAPID_IOCREFMULTIRECEIVE;
+    packet.Parameters[OS_TRAPPARAMINDEX_1].ParamIocRefMultiReceiveConfigRefType = Ioc;                                  /* SBSW_OS_PWA_LOCAL */
+    packet.Parameters[OS_TRAPPARAMINDEX_2].ParamVoidConfigRefType = Data;                                               /* SBSW_OS_PWA_LOCAL */
 
     /* #30 Trigger trap. */
     Os_Hal_Trap(&packet);                                                                                               /* SBSW_OS_FC_POINTER2LOCAL */
@@ -6481,7 +8099,7 @@ FUNC(Std_ReturnType, OS_CODE) Os_TrapIoc32EmptyQueue
   else
   {
     /* #60 Call the API directly. */
-    result = Os_Ioc32EmptyQueue(Ioc);                                                                                   /* SBSW_OS_FC_PRECONDITION */
+    result = Os_IocRefMultiReceive(Ioc, Data);                                                                          /* SBSW_OS_FC_PRECONDITION */
   }
 
   return result;
@@ -6489,7 +8107,7 @@ FUNC(Std_ReturnType, OS_CODE) Os_TrapIoc32EmptyQueue
 
 
 /***********************************************************************************************************************
- *  Os_TrapIoc32Send()
+ *  Os_TrapIocRefEmptyMultiQueue()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -6501,36 +8119,34 @@ FUNC(Std_ReturnType, OS_CODE) Os_TrapIoc32EmptyQueue
  *
  *
  */
-FUNC(Std_ReturnType, OS_CODE) Os_TrapIoc32Send
+FUNC(Std_ReturnType, OS_CODE) Os_TrapIocRefEmptyMultiQueue                                                              /* COV_OS_HALPLATFORMTESTEDASMULTICORE */
 (
   boolean IsTrapRequired,
-  P2CONST(Os_Ioc32SendConfigType, TYPEDEF, OS_CONST) Ioc,
-  uint32 Data
+  P2CONST(Os_IocRefMultiReceiveConfigType, TYPEDEF, OS_CONST) Ioc
 )
 {
   Std_ReturnType result;
 
   /* #10 If trap is required: */
-  if(Os_TrapIsTrapRequired(IsTrapRequired) != 0u)                                                                       /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */
+  if(Os_TrapIsTrapRequired(IsTrapRequired) != 0u)                                                                       /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */ /* COV_OS_HALPLATFORM_NEED_NO_TRAP_IOC_MULTIQUEUE */
   {
     Os_TrapPacketType packet;
 
     /* #20 Marshal API data. */
-    packet.TrapId = OS_TRAPID_IOC32SEND;
-    packet.Parameters[OS_TRAPPARAMINDEX_1].ParamIoc32SendConfigRefType = Ioc;                                           /* SBSW_OS_PWA_LOCAL */
-    packet.Parameters[OS_TRAPPARAMINDEX_2].ParamUint32Type = Data;                                                      /* SBSW_OS_PWA_LOCAL */
+    packet.TrapId = OS_TRAPID_IOCREFEMPTYMULTIQUEUE;
+    packet.Parameters[OS_TRAPPARAMINDEX_1].ParamIocRefMultiReceiveConfigRefType = Ioc;                                  /* SBSW_OS_PWA_LOCAL */
 
     /* #30 Trigger trap. */
     Os_Hal_Trap(&packet);                                                                                               /* SBSW_OS_FC_POINTER2LOCAL */
 
     /* #40 Unmarshal return value. */
-    result =  packet.ReturnValue.ReturnStd_ReturnType;
+    result = packet.ReturnValue.ReturnStd_ReturnType;
   }
   /* #50 Otherwise: */
   else
   {
     /* #60 Call the API directly. */
-    result = Os_Ioc32Send(Ioc, Data);                                                                                   /* SBSW_OS_FC_PRECONDITION */
+    result = Os_IocRefEmptyMultiQueue(Ioc);                                                                             /* SBSW_OS_FC_PRECONDITION */
   }
 
   return result;
@@ -6538,7 +8154,7 @@ FUNC(Std_ReturnType, OS_CODE) Os_TrapIoc32Send
 
 
 /***********************************************************************************************************************
- *  Os_TrapIocRefReceive()
+ *  Os_TrapErrApplicationError()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -6548,93 +8164,103 @@ FUNC(Std_ReturnType, OS_CODE) Os_TrapIoc32Send
  *
  *
  *
- *
  */
-FUNC(Std_ReturnType, OS_CODE) Os_TrapIocRefReceive
+FUNC(void, OS_CODE) Os_TrapErrApplicationError
 (
-  boolean IsTrapRequired,
-  P2CONST(Os_IocRefReceiveConfigType, TYPEDEF, OS_CONST) Ioc,
-  P2VAR(void, TYPEDEF, AUTOMATIC) Data
+  OSServiceIdType ServiceId,
+  Os_StatusType Status,
+  P2VAR(Os_ErrorParamsType, TYPEDEF, OS_VAR_NOINIT) Parameters
 )
 {
-  Std_ReturnType result;
-
-  /* #10 If trap is required: */
-  if(Os_TrapIsTrapRequired(IsTrapRequired) != 0u)                                                                       /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */ /* COV_OS_HALPLATFORMTESTEDASMULTICORE */
+  /* #10 If a trap is needed: */
+  if(Os_TrapIsTrapForWriteAccessRequired() != 0u)                                                                       /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */
   {
     Os_TrapPacketType packet;
 
     /* #20 Marshal API data. */
-    packet.TrapId = OS_TRAPID_IOCREFRECEIVE;
-    packet.Parameters[OS_TRAPPARAMINDEX_1].ParamIocRefReceiveConfigRefType = Ioc;                                       /* SBSW_OS_PWA_LOCAL */
-    packet.Parameters[OS_TRAPPARAMINDEX_2].ParamVoidRefType = Data;                                                     /* SBSW_OS_PWA_LOCAL */
+    packet.TrapId = OS_TRAPID_ERRAPPLICATIONERROR;
+    packet.Parameters[OS_TRAPPARAMINDEX_1].ParamOSServiceIdType = ServiceId;                                            /* SBSW_OS_PWA_LOCAL */
+    packet.Parameters[OS_TRAPPARAMINDEX_2].ParamOs_StatusType = Status;                                                 /* SBSW_OS_PWA_LOCAL */
+    packet.Parameters[OS_TRAPPARAMINDEX_3].ParamOs_ErrorParamsRefType = Parameters;                                     /* SBSW_OS_PWA_LOCAL */
 
     /* #30 Trigger trap. */
     Os_Hal_Trap(&packet);                                                                                               /* SBSW_OS_FC_POINTER2LOCAL */
-
-    /* #40 Unmarshal return value. */
-    result = packet.ReturnValue.ReturnStd_ReturnType;
   }
-  /* #50 Otherwise: */
+  /* #40 Otherwise: */
   else
   {
-    /* #60 Call the API directly. */
-    result = Os_IocRefReceive(Ioc, Data);                                                                               /* SBSW_OS_FC_PRECONDITION */
+    /* #50 Call the API directly. */
+    Os_ErrApplicationError(ServiceId, Status, Parameters);                                                              /* SBSW_OS_FC_PRECONDITION */
   }
-
-  return result;
 }
 
 
 /***********************************************************************************************************************
- *  Os_TrapIocRefEmptyQueue()
+ *  Os_TrapServiceReturn()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
  *
  *
  *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(void, OS_CODE, OS_NORETURN, Os_TrapServiceReturn, (void))
+{
+  Os_TrapPacketType packet;
+
+  /*! Internal comment removed.
+ *
+ * */
+
+  /* #10 Marshal API data. */
+  packet.TrapId = OS_TRAPID_SERVICERETURN;
+
+  /* #20 Trigger trap. */
+  Os_Hal_Trap(&packet);                                                                                                 /* SBSW_OS_FC_POINTER2LOCAL */
+
+  Os_ErrKernelPanic();
+}
+
+
+/***********************************************************************************************************************
+ *  Os_TrapIsrEpilogue()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
  *
  *
  *
  *
  */
-FUNC(Std_ReturnType, OS_CODE) Os_TrapIocRefEmptyQueue
-(
-  boolean IsTrapRequired,
-  P2CONST(Os_IocRefReceiveConfigType, TYPEDEF, OS_CONST) Ioc
-)
+OS_FUNC_ATTRIBUTE_DEFINITION(void, OS_CODE, OS_NORETURN, Os_TrapIsrEpilogue, (void))
 {
-  Std_ReturnType result;
-
-  /* #10 If trap is required: */
-  if(Os_TrapIsTrapRequired(IsTrapRequired) != 0u)                                                                       /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */ /* COV_OS_HALPLATFORMTESTEDASMULTICORE */
+  /* #10 If a trap is needed: */
+  if(Os_TrapIsTrapForWriteAccessRequired() != 0u)                                                                       /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */
   {
     Os_TrapPacketType packet;
 
     /* #20 Marshal API data. */
-    packet.TrapId = OS_TRAPID_IOCREFEMPTYQUEUE;
-    packet.Parameters[OS_TRAPPARAMINDEX_1].ParamIocRefReceiveConfigRefType = Ioc;                                       /* SBSW_OS_PWA_LOCAL */
+    packet.TrapId = OS_TRAPID_ISREPILOGUE;
 
     /* #30 Trigger trap. */
     Os_Hal_Trap(&packet);                                                                                               /* SBSW_OS_FC_POINTER2LOCAL */
 
-    /* #40 Unmarshal return value. */
-    result = packet.ReturnValue.ReturnStd_ReturnType;
   }
-  /* #50 Otherwise: */
+  /* #40 Otherwise: */
   else
   {
-    /* #60 Call the API directly. */
-    result = Os_IocRefEmptyQueue(Ioc);                                                                                  /* SBSW_OS_FC_PRECONDITION */
+    /* #50 Call the API directly. */
+    Os_IsrEpilogue();
   }
 
-  return result;
+  Os_ErrKernelPanic();
 }
 
 
 /***********************************************************************************************************************
- *  Os_TrapIocRefSend()
+ *  Os_TrapTaskMissingTerminateTask()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -6644,46 +8270,33 @@ FUNC(Std_ReturnType, OS_CODE) Os_TrapIocRefEmptyQueue
  *
  *
  *
- *
  */
-FUNC(Std_ReturnType, OS_CODE) Os_TrapIocRefSend
-(
-  boolean IsTrapRequired,
-  P2CONST(Os_IocRefSendConfigType, TYPEDEF, OS_CONST) Ioc,
-  P2CONST(void, TYPEDEF, AUTOMATIC) Data
-)
+OS_FUNC_ATTRIBUTE_DEFINITION(void, OS_CODE, OS_NORETURN, Os_TrapTaskMissingTerminateTask, (void))
 {
-  Std_ReturnType result;
-
-  /* #10 If trap is required: */
-  if(Os_TrapIsTrapRequired(IsTrapRequired) != 0u)                                                                       /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */ /* COV_OS_HALPLATFORMTESTEDASMULTICORE */
+  /* #10 If a trap is needed: */
+  if(Os_TrapIsTrapForWriteAccessRequired() != 0u)                                                                       /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */
   {
     Os_TrapPacketType packet;
 
     /* #20 Marshal API data. */
-    packet.TrapId = OS_TRAPID_IOCREFSEND;
-    packet.Parameters[OS_TRAPPARAMINDEX_1].ParamIocRefSendConfigRefType = Ioc;                                          /* SBSW_OS_PWA_LOCAL */
-    packet.Parameters[OS_TRAPPARAMINDEX_2].ParamVoidConfigRefType = Data;                                               /* SBSW_OS_PWA_LOCAL */
+    packet.TrapId = OS_TRAPID_TASKMISSINGTERMINATETASK;
 
     /* #30 Trigger trap. */
     Os_Hal_Trap(&packet);                                                                                               /* SBSW_OS_FC_POINTER2LOCAL */
-
-    /* #40 Unmarshal return value. */
-    result = packet.ReturnValue.ReturnStd_ReturnType;
   }
-  /* #50 Otherwise: */
+  /* #40 Otherwise: */
   else
   {
-    /* #60 Call the API directly. */
-    result = Os_IocRefSend(Ioc, Data);                                                                                  /* SBSW_OS_FC_PRECONDITION */
+    /* #50 Call the API directly. */
+    Os_TaskMissingTerminateTask();
   }
 
-  return result;
+  Os_ErrKernelPanic();
 }
 
 
 /***********************************************************************************************************************
- *  Os_TrapIocRead()
+ *  Os_TrapHookReturn()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -6693,46 +8306,33 @@ FUNC(Std_ReturnType, OS_CODE) Os_TrapIocRefSend
  *
  *
  *
- *
  */
-FUNC(Std_ReturnType, OS_CODE) Os_TrapIocRead
-(
-  boolean IsTrapRequired,
-  P2CONST(Os_IocReadConfigType, TYPEDEF, OS_CONST) Ioc,
-  P2VAR(void, TYPEDEF, AUTOMATIC) Data
-)
+OS_FUNC_ATTRIBUTE_DEFINITION(void, OS_CODE, OS_NORETURN, Os_TrapHookReturn, (void))
 {
-  Std_ReturnType result;
-
-  /* #10 If trap is required: */
-  if(Os_TrapIsTrapRequired(IsTrapRequired) != 0u)                                                                       /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */ /* COV_OS_HALPLATFORMTESTEDASMULTICORE */
+  /* #10 If a trap is needed: */
+  if(Os_TrapIsTrapForWriteAccessRequired() != 0u)                                                                       /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */
   {
     Os_TrapPacketType packet;
 
     /* #20 Marshal API data. */
-    packet.TrapId = OS_TRAPID_IOCREAD;
-    packet.Parameters[OS_TRAPPARAMINDEX_1].ParamIocReadConfigRefType = Ioc;                                             /* SBSW_OS_PWA_LOCAL */
-    packet.Parameters[OS_TRAPPARAMINDEX_2].ParamVoidRefType = Data;                                                     /* SBSW_OS_PWA_LOCAL */
+    packet.TrapId = OS_TRAPID_HOOKRETURN;
 
     /* #30 Trigger trap. */
     Os_Hal_Trap(&packet);                                                                                               /* SBSW_OS_FC_POINTER2LOCAL */
-
-    /* #40 Unmarshal return value. */
-    result = packet.ReturnValue.ReturnStd_ReturnType;
   }
-  /* #50 Otherwise: */
+  /* #40 Otherwise: */
   else
   {
-    /* #60 Call the API directly. */
-    result = Os_IocRead(Ioc, Data);                                                                                     /* SBSW_OS_FC_PRECONDITION */
+    /* #50 Call the API directly. */
+    Os_HookReturn();
   }
 
-  return result;
+  Os_ErrKernelPanic();
 }
 
 
 /***********************************************************************************************************************
- *  Os_TrapIocWrite()
+ *  Os_TrapCoreGetThread()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -6744,44 +8344,64 @@ FUNC(Std_ReturnType, OS_CODE) Os_TrapIocRead
  *
  *
  */
-FUNC(Std_ReturnType, OS_CODE) Os_TrapIocWrite
+FUNC(P2CONST(Os_ThreadConfigType, AUTOMATIC, OS_CONST), OS_CODE) Os_TrapCoreGetThread
 (
-  boolean IsTrapRequired,
-  P2CONST(Os_IocWriteConfigType, TYPEDEF, OS_CONST) Ioc,
-  P2CONST(void, TYPEDEF, AUTOMATIC) Data
+  void
 )
 {
-  Std_ReturnType result;
+  P2CONST(Os_ThreadConfigType, AUTOMATIC, OS_CONST) result;
 
-  /* #10 If trap is required: */
-  if(Os_TrapIsTrapRequired(IsTrapRequired) != 0u)                                                                       /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */ /* COV_OS_HALPLATFORMTESTEDASMULTICORE */
+  /* #10 If a trap is needed: */
+  if(Os_TrapIsTrapForWriteAccessRequired() != 0u)                                                                       /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */
   {
     Os_TrapPacketType packet;
 
     /* #20 Marshal API data. */
-    packet.TrapId = OS_TRAPID_IOCWRITE;
-    packet.Parameters[OS_TRAPPARAMINDEX_1].ParamIocWriteConfigRefType = Ioc;                                            /* SBSW_OS_PWA_LOCAL */
-    packet.Parameters[OS_TRAPPARAMINDEX_2].ParamVoidConfigRefType = Data;                                               /* SBSW_OS_PWA_LOCAL */
+    packet.TrapId = OS_TRAPID_COREGETTHREAD;
 
     /* #30 Trigger trap. */
     Os_Hal_Trap(&packet);                                                                                               /* SBSW_OS_FC_POINTER2LOCAL */
 
     /* #40 Unmarshal return value. */
-    result = packet.ReturnValue.ReturnStd_ReturnType;
+    result = packet.ReturnValue.ReturnThreadConfigRefType;
   }
   /* #50 Otherwise: */
   else
   {
     /* #60 Call the API directly. */
-    result = Os_IocWrite(Ioc, Data);                                                                                    /* SBSW_OS_FC_PRECONDITION */
+    result = Os_CoreGetThread();
   }
 
   return result;
 }
 
 
+
+/*
+ * \}
+ * \addtogroup Os_UserInterface
+ * \{
+ */
+/***********************************************************************************************************************
+ *  Os_GetVersionInfo()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ */
+FUNC(void, OS_CODE) Os_GetVersionInfo
+(
+  Std_VersionInfoType *versioninfo
+)
+{
+  /* #10 Getter API. Call API directly. */
+  Os_TrapCallGetVersionInfo(versioninfo);                                                                               /* SBSW_OS_TRAP_API_USERPOINTER_001 */
+}
+
+
 /***********************************************************************************************************************
- *  Os_TrapIoc08MultiReceive()
+ *  Os_GetExceptionContext()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -6792,45 +8412,54 @@ FUNC(Std_ReturnType, OS_CODE) Os_TrapIocWrite
  *
  *
  *
+ *
  */
-FUNC(Std_ReturnType, OS_CODE) Os_TrapIoc08MultiReceive                                                                  /* COV_OS_HALPLATFORMTESTEDASMULTICORE */
+FUNC(StatusType, OS_CODE) Os_GetExceptionContext
 (
-  boolean IsTrapRequired,
-  P2CONST(Os_Ioc08MultiReceiveConfigType, TYPEDEF, OS_CONST) Ioc,
-  P2VAR(uint8, TYPEDEF, AUTOMATIC) Data
+  Os_ExceptionContextRefType Context
 )
 {
-  Std_ReturnType result;
+  Os_StatusType status;
 
-  /* #10 If trap is required: */
-  if(Os_TrapIsTrapRequired(IsTrapRequired) != 0u)                                                                       /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */ /* COV_OS_HALPLATFORM_NEED_NO_TRAP_IOC_MULTIQUEUE */
+  /* #10 Check that the given pointer is valid. */
+  if(OS_UNLIKELY(Os_ErrCheckPointerIsNotNull(Context) == OS_CHECK_FAILED))                                              /* PRQA S 0315 */ /* MD_Os_Dir1.1_0315 */ /* SBSW_OS_TRAP_ERRCHECKPOINTERISNOTNULL_001 */
   {
-    Os_TrapPacketType packet;
-
-    /* #20 Marshal API data. */
-    packet.TrapId = OS_TRAPID_IOC08MULTIRECEIVE;
-    packet.Parameters[OS_TRAPPARAMINDEX_1].ParamIoc08MultiReceiveConfigRefType = Ioc;                                   /* SBSW_OS_PWA_LOCAL */
-    packet.Parameters[OS_TRAPPARAMINDEX_2].ParamVoidConfigRefType = Data;                                               /* PRQA S 0315 */ /* MD_Os_Dir1.1_0315 */ /* SBSW_OS_PWA_LOCAL */
-
-    /* #30 Trigger trap. */
-    Os_Hal_Trap(&packet);                                                                                               /* SBSW_OS_FC_POINTER2LOCAL */
-
-    /* #40 Unmarshal return value. */
-    result = packet.ReturnValue.ReturnStd_ReturnType;
+    status = OS_STATUS_PARAM_POINTER_1;
   }
-  /* #50 Otherwise: */
   else
   {
-    /* #60 Call the API directly. */
-    result = Os_Ioc08MultiReceive(Ioc, Data);                                                                           /* SBSW_OS_FC_PRECONDITION */
+    /* #20 If a trap is needed: */
+    if(Os_TrapIsTrapForReadAccessRequired() != 0u)                                                                      /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */
+    {
+      Os_TrapPacketType packet;
+      Os_ExceptionContextType userspaceContext;
+
+      /* #30 Marshal API data. */
+      packet.TrapId = OS_TRAPID_GETEXCEPTIONCONTEXT;
+      packet.Parameters[OS_TRAPPARAMINDEX_1].ParamApiType.ParamExceptionContextRefType =
+                                                               (Os_ExceptionContextType*)&userspaceContext;             /* SBSW_OS_PWA_LOCAL */
+
+      /* #40 Trigger trap. */
+      Os_Hal_Trap(&packet);                                                                                             /* SBSW_OS_FC_POINTER2LOCAL */
+
+      /* #50 Unmarshal return value. */
+      (*Context) = *((volatile Os_ExceptionContextType*)&userspaceContext);                                             /* SBSW_OS_TRAP_API_USERPOINTER_002 */
+      status = packet.ReturnValue.ReturnOs_StatusType;
+    }
+    /* #60 Otherwise: */
+    else
+    {
+      /* #70 Call the API directly. */
+      status = Os_TrapCallGetExceptionContext(Context);                                                                 /* SBSW_OS_TRAP_API_USERPOINTER_001 */
+    }
   }
 
-  return result;
+  return Os_ErrReportGetExceptionContext(status, Context);                                                              /* SBSW_OS_TRAP_API_USERPOINTER_001 */
 }
 
 
 /***********************************************************************************************************************
- *  Os_TrapIoc08EmptyMultiQueue()
+ *  Os_SetExceptionContext()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -6841,43 +8470,55 @@ FUNC(Std_ReturnType, OS_CODE) Os_TrapIoc08MultiReceive
  *
  *
  *
+ *
  */
-FUNC(Std_ReturnType, OS_CODE) Os_TrapIoc08EmptyMultiQueue                                                               /* COV_OS_HALPLATFORMTESTEDASMULTICORE */
+FUNC(StatusType, OS_CODE) Os_SetExceptionContext
 (
-  boolean IsTrapRequired,
-  P2CONST(Os_Ioc08MultiReceiveConfigType, TYPEDEF, OS_CONST) Ioc
+  Os_ExceptionContextRefType Context
 )
 {
-  Std_ReturnType result;
+  Os_StatusType status;
 
-  /* #10 If trap is required: */
-  if(Os_TrapIsTrapRequired(IsTrapRequired) != 0u)                                                                       /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */ /* COV_OS_HALPLATFORM_NEED_NO_TRAP_IOC_MULTIQUEUE */
+  /* #10 Check that the given pointer is valid. */
+  if(OS_UNLIKELY(Os_ErrCheckPointerIsNotNull(Context) == OS_CHECK_FAILED))                                              /* PRQA S 0315 */ /* MD_Os_Dir1.1_0315 */ /* SBSW_OS_TRAP_ERRCHECKPOINTERISNOTNULL_001 */
   {
-    Os_TrapPacketType packet;
-
-    /* #20 Marshal API data. */
-    packet.TrapId = OS_TRAPID_IOC08EMPTYMULTIQUEUE;
-    packet.Parameters[OS_TRAPPARAMINDEX_1].ParamIoc08MultiReceiveConfigRefType = Ioc;                                   /* SBSW_OS_PWA_LOCAL */
-
-    /* #30 Trigger trap. */
-    Os_Hal_Trap(&packet);                                                                                               /* SBSW_OS_FC_POINTER2LOCAL */
-
-    /* #40 Unmarshal return value. */
-    result = packet.ReturnValue.ReturnStd_ReturnType;
+    status = OS_STATUS_PARAM_POINTER_1;
   }
-  /* #50 Otherwise: */
   else
   {
-    /* #60 Call the API directly. */
-    result = Os_Ioc08EmptyMultiQueue(Ioc);                                                                              /* SBSW_OS_FC_PRECONDITION */
+    /* #20 If a trap is needed: */
+    if(Os_TrapIsTrapForWriteAccessRequired() != 0u)                                                                     /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */
+    {
+      Os_TrapPacketType packet;
+      Os_ExceptionContextType userspaceContext;
+      userspaceContext = (*Context);
+
+      /* #30 Marshal API data. */
+      packet.TrapId = OS_TRAPID_SETEXCEPTIONCONTEXT;
+      packet.Parameters[OS_TRAPPARAMINDEX_1].ParamApiType.ParamExceptionContextRefType =
+                                                               (Os_ExceptionContextType*)&userspaceContext;             /* SBSW_OS_PWA_LOCAL */
+
+      /* #40 Trigger trap. */
+      Os_Hal_Trap(&packet);                                                                                             /* SBSW_OS_FC_POINTER2LOCAL */
+
+      /* #50 Unmarshal return value. */
+      status = packet.ReturnValue.ReturnOs_StatusType;
+    }
+    /* #60 Otherwise: */
+    else
+    {
+      /* #70 Call the API directly. */
+      status = Os_TrapCallSetExceptionContext(Context);                                                                 /* SBSW_OS_TRAP_API_USERPOINTER_001 */
+
+    }
   }
 
-  return result;
+  return Os_ErrReportSetExceptionContext(status, Context);                                                              /* SBSW_OS_TRAP_API_USERPOINTER_001 */
 }
 
 
 /***********************************************************************************************************************
- *  Os_TrapIoc16MultiReceive()
+ *  Os_GetExceptionAddress()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -6889,139 +8530,164 @@ FUNC(Std_ReturnType, OS_CODE) Os_TrapIoc08EmptyMultiQueue
  *
  *
  */
-FUNC(Std_ReturnType, OS_CODE) Os_TrapIoc16MultiReceive                                                                  /* COV_OS_HALPLATFORMTESTEDASMULTICORE */
+FUNC(Os_AddressOfConstType, OS_CODE) Os_GetExceptionAddress
 (
-  boolean IsTrapRequired,
-  P2CONST(Os_Ioc16MultiReceiveConfigType, TYPEDEF, OS_CONST) Ioc,
-  P2VAR(uint16, TYPEDEF, AUTOMATIC) Data
+  void
 )
 {
-  Std_ReturnType result;
+  Os_AddressOfConstType address;
 
-  /* #10 If trap is required: */
-  if(Os_TrapIsTrapRequired(IsTrapRequired) != 0u)                                                                       /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */ /* COV_OS_HALPLATFORM_NEED_NO_TRAP_IOC_MULTIQUEUE */
+  /* #10 If a trap is needed: */
+  if(Os_TrapIsTrapForReadAccessRequired() != 0u)                                                                        /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */
   {
     Os_TrapPacketType packet;
 
     /* #20 Marshal API data. */
-    packet.TrapId = OS_TRAPID_IOC16MULTIRECEIVE;
-    packet.Parameters[OS_TRAPPARAMINDEX_1].ParamIoc16MultiReceiveConfigRefType = Ioc;                                   /* SBSW_OS_PWA_LOCAL */
-    packet.Parameters[OS_TRAPPARAMINDEX_2].ParamVoidConfigRefType = Data;                                               /* PRQA S 0315 */ /* MD_Os_Dir1.1_0315 */ /* SBSW_OS_PWA_LOCAL */
+    packet.TrapId = OS_TRAPID_GETEXCEPTIONADDRESS;
 
     /* #30 Trigger trap. */
     Os_Hal_Trap(&packet);                                                                                               /* SBSW_OS_FC_POINTER2LOCAL */
 
     /* #40 Unmarshal return value. */
-    result = packet.ReturnValue.ReturnStd_ReturnType;
+    address = packet.ReturnValue.ReturnOs_AddressOfConstType;
   }
   /* #50 Otherwise: */
   else
   {
     /* #60 Call the API directly. */
-    result = Os_Ioc16MultiReceive(Ioc, Data);                                                                           /* SBSW_OS_FC_PRECONDITION */
+    address = Os_TrapCallGetExceptionAddress();                                                                         /* SBSW_OS_TRAP_API_USERPOINTER_001 */
   }
 
-  return result;
+  return address;
 }
 
 
 /***********************************************************************************************************************
- *  Os_TrapIoc16EmptyMultiQueue()
+ *  Os_InitMemory()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
  *
  *
- *
- *
- *
+ */
+FUNC(void, OS_CODE) Os_InitMemory
+(
+  void
+)
+{
+  /* #10 Caller (startup code) is privileged. Call API directly. */
+  Os_TrapCallInitMemory();
+}
+
+
+/***********************************************************************************************************************
+ *  Os_Init()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
  *
  *
  */
-FUNC(Std_ReturnType, OS_CODE) Os_TrapIoc16EmptyMultiQueue                                                               /* COV_OS_HALPLATFORMTESTEDASMULTICORE */
+FUNC(void, OS_CODE) Os_Init
 (
-  boolean IsTrapRequired,
-  P2CONST(Os_Ioc16MultiReceiveConfigType, TYPEDEF, OS_CONST) Ioc
+  void
 )
 {
-  Std_ReturnType result;
-
-  /* #10 If trap is required: */
-  if(Os_TrapIsTrapRequired(IsTrapRequired) != 0u)                                                                       /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */ /* COV_OS_HALPLATFORM_NEED_NO_TRAP_IOC_MULTIQUEUE */
-  {
-    Os_TrapPacketType packet;
+  /* #10 Caller (startup code) is privileged exception vectors are not yet initialized. Call API directly. */
+  Os_TrapCallInit();
+}
 
-    /* #20 Marshal API data. */
-    packet.TrapId = OS_TRAPID_IOC16EMPTYMULTIQUEUE;
-    packet.Parameters[OS_TRAPPARAMINDEX_1].ParamIoc16MultiReceiveConfigRefType = Ioc;                                   /* SBSW_OS_PWA_LOCAL */
 
-    /* #30 Trigger trap. */
-    Os_Hal_Trap(&packet);                                                                                               /* SBSW_OS_FC_POINTER2LOCAL */
+/***********************************************************************************************************************
+ *  Os_InitInterruptOnly()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ */
+FUNC(void, OS_CODE) Os_InitInterruptOnly
+(
+  void
+)
+{
+  /* #10 Caller (startup code) is privileged. Call API directly. */
+  Os_TrapCallInitInterruptOnly();
+}
 
-    /* #40 Unmarshal return value. */
-    result = packet.ReturnValue.ReturnStd_ReturnType;
-  }
-  /* #50 Otherwise: */
-  else
-  {
-    /* #60 Call the API directly. */
-    result = Os_Ioc16EmptyMultiQueue(Ioc);                                                                              /* SBSW_OS_FC_PRECONDITION */
-  }
 
-  return result;
+/***********************************************************************************************************************
+ *  Os_EnterPreStartTask()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ */
+FUNC(void, OS_CODE) Os_EnterPreStartTask
+(
+  void
+)
+{
+  /* #10 Caller (startup code) is privileged. Call API directly. */
+  Os_TrapCallEnterPreStartTask();
 }
 
 
 /***********************************************************************************************************************
- *  Os_TrapIoc32MultiReceive()
+ *  StartCore()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
  *
  *
  *
- *
+ */
+FUNC(void, OS_CODE) StartCore                                                                                           /* COV_OS_HALPLATFORMTESTEDASMULTICORE */
+(
+  CoreIdType CoreID,
+  StatusType *Status
+)
+{
+  /* #10 If the given status pointer is valid: */
+  if(OS_UNLIKELY(Os_ErrCheckPointerIsNotNull(Status) != OS_CHECK_FAILED))                                               /* PRQA S 0315 */ /* MD_Os_Dir1.1_0315 */ /* SBSW_OS_TRAP_ERRCHECKPOINTERISNOTNULL_001 */
+  {
+    /* #20 Caller (startup code) is privileged. Call API directly. */
+    Os_TrapCallStartCore(CoreID, Status);                                                                               /* SBSW_OS_TRAP_API_USERPOINTER_001 */
+  }
+  /* else
+   *   Do NOT write the error code to the Status pointer, as it is a NULL_PTR!  */
+}
+
+
+/***********************************************************************************************************************
+ *  StartNonAutosarCore()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
  *
  *
  *
  */
-FUNC(Std_ReturnType, OS_CODE) Os_TrapIoc32MultiReceive                                                                  /* COV_OS_HALPLATFORMTESTEDASMULTICORE */
+FUNC(void, OS_CODE) StartNonAutosarCore                                                                                 /* COV_OS_HALPLATFORMTESTEDASMULTICORE */
 (
-  boolean IsTrapRequired,
-  P2CONST(Os_Ioc32MultiReceiveConfigType, TYPEDEF, OS_CONST) Ioc,
-  P2VAR(uint32, TYPEDEF, AUTOMATIC) Data
+  CoreIdType CoreID,
+  StatusType *Status
 )
 {
-  Std_ReturnType result;
-
-  /* #10 If trap is required: */
-  if(Os_TrapIsTrapRequired(IsTrapRequired) != 0u)                                                                       /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */ /* COV_OS_HALPLATFORM_NEED_NO_TRAP_IOC_MULTIQUEUE */
-  {
-    Os_TrapPacketType packet;
-
-    /* #20 Marshal API data. */
-    packet.TrapId = OS_TRAPID_IOC32MULTIRECEIVE;
-    packet.Parameters[OS_TRAPPARAMINDEX_1].ParamIoc32MultiReceiveConfigRefType = Ioc;                                   /* SBSW_OS_PWA_LOCAL */
-    packet.Parameters[OS_TRAPPARAMINDEX_2].ParamVoidConfigRefType = Data;                                               /* PRQA S 0315 */ /* MD_Os_Dir1.1_0315 */ /* SBSW_OS_PWA_LOCAL */
-
-    /* #30 Trigger trap. */
-    Os_Hal_Trap(&packet);                                                                                               /* SBSW_OS_FC_POINTER2LOCAL */
-
-    /* #40 Unmarshal return value. */
-    result = packet.ReturnValue.ReturnStd_ReturnType;
-  }
-  /* #50 Otherwise: */
-  else
+  /* #10 If the given status pointer is valid: */
+  if(OS_UNLIKELY(Os_ErrCheckPointerIsNotNull(Status) != OS_CHECK_FAILED))                                               /* PRQA S 0315 */ /* MD_Os_Dir1.1_0315 */ /* SBSW_OS_TRAP_ERRCHECKPOINTERISNOTNULL_001 */
   {
-    /* #60 Call the API directly. */
-    result = Os_Ioc32MultiReceive(Ioc, Data);                                                                           /* SBSW_OS_FC_PRECONDITION */
+    /* #20 Caller (startup code) is privileged. Call API directly. */
+    Os_TrapCallStartNonAutosarCore(CoreID, Status);                                                                     /* SBSW_OS_TRAP_API_USERPOINTER_001 */
   }
-
-  return result;
+  /* else
+   *   Do NOT write the error code to the Status pointer, as it is a NULL_PTR!  */
 }
 
+
 /***********************************************************************************************************************
- *  Os_TrapIoc32EmptyMultiQueue()
+ *  GetCoreID()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -7033,41 +8699,40 @@ FUNC(Std_ReturnType, OS_CODE) Os_TrapIoc32MultiReceive
  *
  *
  */
-FUNC(Std_ReturnType, OS_CODE) Os_TrapIoc32EmptyMultiQueue                                                               /* COV_OS_HALPLATFORMTESTEDASMULTICORE */
+FUNC(CoreIdType, OS_CODE) GetCoreID
 (
-  boolean IsTrapRequired,
-  P2CONST(Os_Ioc32MultiReceiveConfigType, TYPEDEF, OS_CONST) Ioc
+  void
 )
 {
-  Std_ReturnType result;
+  CoreIdType result;
 
-  /* #10 If trap is required: */
-  if(Os_TrapIsTrapRequired(IsTrapRequired) != 0u)                                                                       /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */ /* COV_OS_HALPLATFORM_NEED_NO_TRAP_IOC_MULTIQUEUE */
+  /* #10 If a trap is needed: */
+  if(Os_TrapIsTrapForReadAccessRequired() != 0u)                                                                        /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */
   {
     Os_TrapPacketType packet;
 
     /* #20 Marshal API data. */
-    packet.TrapId = OS_TRAPID_IOC32EMPTYMULTIQUEUE;
-    packet.Parameters[OS_TRAPPARAMINDEX_1].ParamIoc32MultiReceiveConfigRefType = Ioc;                                   /* SBSW_OS_PWA_LOCAL */
+    packet.TrapId = OS_TRAPID_GETCOREID;
 
     /* #30 Trigger trap. */
     Os_Hal_Trap(&packet);                                                                                               /* SBSW_OS_FC_POINTER2LOCAL */
 
     /* #40 Unmarshal return value. */
-    result = packet.ReturnValue.ReturnStd_ReturnType;
+    result = packet.ReturnValue.ReturnCoreIdType;
   }
   /* #50 Otherwise: */
   else
   {
     /* #60 Call the API directly. */
-    result = Os_Ioc32EmptyMultiQueue(Ioc);                                                                              /* SBSW_OS_FC_PRECONDITION */
+    result = Os_TrapCallGetCoreID();
   }
 
   return result;
 }
 
+
 /***********************************************************************************************************************
- *  Os_TrapIocRefMultiReceive()
+ *  GetNumberOfActivatedCores()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -7079,36 +8744,32 @@ FUNC(Std_ReturnType, OS_CODE) Os_TrapIoc32EmptyMultiQueue
  *
  *
  */
-FUNC(Std_ReturnType, OS_CODE) Os_TrapIocRefMultiReceive                                                                 /* COV_OS_HALPLATFORMTESTEDASMULTICORE */
+FUNC(uint32, OS_CODE) GetNumberOfActivatedCores
 (
-  boolean IsTrapRequired,
-  P2CONST(Os_IocRefMultiReceiveConfigType, TYPEDEF, OS_CONST) Ioc,
-  P2VAR(void, TYPEDEF, AUTOMATIC) Data
+  void
 )
 {
-  Std_ReturnType result;
+  uint32 result;
 
-  /* #10 If trap is required: */
-  if(Os_TrapIsTrapRequired(IsTrapRequired) != 0u)                                                                       /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */ /* COV_OS_HALPLATFORM_NEED_NO_TRAP_IOC_MULTIQUEUE */
+  /* #10 If a trap is needed: */
+  if(Os_TrapIsTrapForReadAccessRequired() != 0u)                                                                        /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */ /* COV_OS_HALPLATFORMTESTEDASMULTICORE */
   {
     Os_TrapPacketType packet;
 
     /* #20 Marshal API data. */
-    packet.TrapId = OS_TRAPID_IOCREFMULTIRECEIVE;
-    packet.Parameters[OS_TRAPPARAMINDEX_1].ParamIocRefMultiReceiveConfigRefType = Ioc;                                  /* SBSW_OS_PWA_LOCAL */
-    packet.Parameters[OS_TRAPPARAMINDEX_2].ParamVoidConfigRefType = Data;                                               /* SBSW_OS_PWA_LOCAL */
+    packet.TrapId = OS_TRAPID_GETNUMBEROFACTIVATEDCORES;
 
     /* #30 Trigger trap. */
     Os_Hal_Trap(&packet);                                                                                               /* SBSW_OS_FC_POINTER2LOCAL */
 
     /* #40 Unmarshal return value. */
-    result = packet.ReturnValue.ReturnStd_ReturnType;
+    result = packet.ReturnValue.ReturnUint32Type;
   }
   /* #50 Otherwise: */
   else
   {
     /* #60 Call the API directly. */
-    result = Os_IocRefMultiReceive(Ioc, Data);                                                                          /* SBSW_OS_FC_PRECONDITION */
+    result = Os_TrapCallGetNumberOfActivatedCores();
   }
 
   return result;
@@ -7116,7 +8777,7 @@ FUNC(Std_ReturnType, OS_CODE) Os_TrapIocRefMultiReceive
 
 
 /***********************************************************************************************************************
- *  Os_TrapIocRefEmptyMultiQueue()
+ *  Os_GetCoreStartState()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -7127,43 +8788,66 @@ FUNC(Std_ReturnType, OS_CODE) Os_TrapIocRefMultiReceive
  *
  *
  *
+ *
+ *
+ *
+ *
  */
-FUNC(Std_ReturnType, OS_CODE) Os_TrapIocRefEmptyMultiQueue                                                              /* COV_OS_HALPLATFORMTESTEDASMULTICORE */
+FUNC(void, OS_CODE) Os_GetCoreStartState
 (
-  boolean IsTrapRequired,
-  P2CONST(Os_IocRefMultiReceiveConfigType, TYPEDEF, OS_CONST) Ioc
+  CoreIdType CoreID,
+  P2VAR(Os_CoreStartStateType, TYPEDEF, AUTOMATIC) CoreState,
+  StatusType *Status
 )
 {
-  Std_ReturnType result;
-
-  /* #10 If trap is required: */
-  if(Os_TrapIsTrapRequired(IsTrapRequired) != 0u)                                                                       /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */ /* COV_OS_HALPLATFORM_NEED_NO_TRAP_IOC_MULTIQUEUE */
+  /* #10 If the given status pointer is valid: */
+  if(OS_UNLIKELY(Os_ErrCheckPointerIsNotNull(Status) != OS_CHECK_FAILED))                                               /* PRQA S 0315 */ /* MD_Os_Dir1.1_0315 */ /* SBSW_OS_TRAP_ERRCHECKPOINTERISNOTNULL_001 */
   {
-    Os_TrapPacketType packet;
+    /* #20 If the given state pointer is valid: */
+    if(OS_UNLIKELY(Os_ErrCheckPointerIsNotNull(CoreState) != OS_CHECK_FAILED))                                          /* PRQA S 0315 */ /* MD_Os_Dir1.1_0315 */ /* SBSW_OS_TRAP_ERRCHECKPOINTERISNOTNULL_001 */
+    {
+      /* #30 If a trap is needed: */
+      if(Os_TrapIsTrapForReadAccessRequired() != 0u)                                                                    /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */
+      {
+        Os_TrapPacketType packet;
+        Os_CoreStartStateType userspaceCoreState;
+        StatusType userspaceStatus;
 
-    /* #20 Marshal API data. */
-    packet.TrapId = OS_TRAPID_IOCREFEMPTYMULTIQUEUE;
-    packet.Parameters[OS_TRAPPARAMINDEX_1].ParamIocRefMultiReceiveConfigRefType = Ioc;                                  /* SBSW_OS_PWA_LOCAL */
+        /* #40 Marshal API data. */
+        packet.TrapId = OS_TRAPID_GETCORESTARTSTATE;
+        packet.Parameters[OS_TRAPPARAMINDEX_1].ParamApiType.ParamCoreIdType = CoreID;                                   /* SBSW_OS_PWA_LOCAL */
+        packet.Parameters[OS_TRAPPARAMINDEX_2].ParamApiType.ParamCoreStartStateRefType =
+                                                                (Os_CoreStartStateType*)&userspaceCoreState;            /* SBSW_OS_PWA_LOCAL */
+        packet.Parameters[OS_TRAPPARAMINDEX_3].ParamApiType.ParamStatusRefType = (StatusType*)&userspaceStatus;         /* SBSW_OS_PWA_LOCAL */
 
-    /* #30 Trigger trap. */
-    Os_Hal_Trap(&packet);                                                                                               /* SBSW_OS_FC_POINTER2LOCAL */
+        /* #50 Trigger trap. */
+        Os_Hal_Trap(&packet);                                                                                           /* SBSW_OS_FC_POINTER2LOCAL */
 
-    /* #40 Unmarshal return value. */
-    result = packet.ReturnValue.ReturnStd_ReturnType;
-  }
-  /* #50 Otherwise: */
-  else
-  {
-    /* #60 Call the API directly. */
-    result = Os_IocRefEmptyMultiQueue(Ioc);                                                                             /* SBSW_OS_FC_PRECONDITION */
+        /* #60 Unmarshal return values. */
+        (*Status) = *((volatile StatusType*)&userspaceStatus);                                                          /* SBSW_OS_TRAP_API_USERPOINTER_002 */
+        (*CoreState) = *((volatile Os_CoreStartStateType*)&userspaceCoreState);                                         /* SBSW_OS_TRAP_API_USERPOINTER_002 */
+      }
+      /* #70 Otherwise: */
+      else
+      {
+        /* #80 Call the API directly. */
+        Os_TrapCallGetCoreStartState(CoreID, CoreState, Status);                                                        /* SBSW_OS_TRAP_API_USERPOINTER_001 */
+      }
+    }
+    /* #90 Otherwise: */
+    else
+    {
+      /* #100 Set the Status parameter to E_OS_PARAM_POINTER. */
+      *Status = E_OS_PARAM_POINTER;                                                                                     /* SBSW_OS_PWA_PRECONDITION */
+    }
   }
-
-  return result;
+  /* else
+   *   Do NOT write the error code to the Status pointer, as it is a NULL_PTR!  */
 }
 
 
 /***********************************************************************************************************************
- *  Os_TrapErrApplicationError()
+ *  GetActiveApplicationMode()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -7173,103 +8857,60 @@ FUNC(Std_ReturnType, OS_CODE) Os_TrapIocRefEmptyMultiQueue
  *
  *
  *
+ *
  */
-FUNC(void, OS_CODE) Os_TrapErrApplicationError
+FUNC(AppModeType, OS_CODE) GetActiveApplicationMode
 (
-  OSServiceIdType ServiceId,
-  Os_StatusType Status,
-  P2VAR(Os_ErrorParamsType, TYPEDEF, OS_VAR_NOINIT) Parameters
+  void
 )
 {
+  AppModeType result;
+
   /* #10 If a trap is needed: */
-  if(Os_TrapIsTrapForWriteAccessRequired() != 0u)                                                                       /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */
+  if(Os_TrapIsTrapForReadAccessRequired() != 0u)                                                                        /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */
   {
     Os_TrapPacketType packet;
 
     /* #20 Marshal API data. */
-    packet.TrapId = OS_TRAPID_ERRAPPLICATIONERROR;
-    packet.Parameters[OS_TRAPPARAMINDEX_1].ParamOSServiceIdType = ServiceId;                                            /* SBSW_OS_PWA_LOCAL */
-    packet.Parameters[OS_TRAPPARAMINDEX_2].ParamOs_StatusType = Status;                                                 /* SBSW_OS_PWA_LOCAL */
-    packet.Parameters[OS_TRAPPARAMINDEX_3].ParamOs_ErrorParamsRefType = Parameters;                                     /* SBSW_OS_PWA_LOCAL */
+    packet.TrapId = OS_TRAPID_GETACTIVEAPPLICATIONMODE;
 
     /* #30 Trigger trap. */
     Os_Hal_Trap(&packet);                                                                                               /* SBSW_OS_FC_POINTER2LOCAL */
+
+    /* #40 Unmarshal return value. */
+    result = packet.ReturnValue.ReturnAppModeType;
   }
-  /* #40 Otherwise: */
+  /* #50 Otherwise: */
   else
   {
-    /* #50 Call the API directly. */
-    Os_ErrApplicationError(ServiceId, Status, Parameters);                                                              /* SBSW_OS_FC_PRECONDITION */
+    /* #60 Call the API directly. */
+    result = Os_TrapCallGetActiveApplicationMode();
   }
-}
-
-
-/***********************************************************************************************************************
- *  Os_TrapServiceReturn()
- **********************************************************************************************************************/
-/*!
- * Internal comment removed.
- *
- *
- *
- */
-OS_FUNC_ATTRIBUTE_DEFINITION(void, OS_CODE, OS_NORETURN, Os_TrapServiceReturn, (void))
-{
-  Os_TrapPacketType packet;
-
-  /*! Internal comment removed.
- *
- * */
-
-  /* #10 Marshal API data. */
-  packet.TrapId = OS_TRAPID_SERVICERETURN;
-
-  /* #20 Trigger trap. */
-  Os_Hal_Trap(&packet);                                                                                                 /* SBSW_OS_FC_POINTER2LOCAL */
 
-  Os_ErrKernelPanic();
+  return result;
 }
 
 
 /***********************************************************************************************************************
- *  Os_TrapIsrEpilogue()
+ *  StartOS()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
  *
  *
- *
- *
- *
- *
  */
-OS_FUNC_ATTRIBUTE_DEFINITION(void, OS_CODE, OS_NORETURN, Os_TrapIsrEpilogue, (void))
+FUNC(void, OS_CODE) StartOS
+(
+  AppModeType Mode
+)
 {
-  /* #10 If a trap is needed: */
-  if(Os_TrapIsTrapForWriteAccessRequired() != 0u)                                                                       /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */
-  {
-    Os_TrapPacketType packet;
-
-    /* #20 Marshal API data. */
-    packet.TrapId = OS_TRAPID_ISREPILOGUE;
-
-    /* #30 Trigger trap. */
-    Os_Hal_Trap(&packet);                                                                                               /* SBSW_OS_FC_POINTER2LOCAL */
-
-  }
-  /* #40 Otherwise: */
-  else
-  {
-    /* #50 Call the API directly. */
-    Os_IsrEpilogue();
-  }
-
-  Os_ErrKernelPanic();
+  /* #10 Caller (startup code) is privileged. Call API directly. */
+  Os_TrapCallStartOS(Mode);
 }
 
 
 /***********************************************************************************************************************
- *  Os_TrapTaskMissingTerminateTask()
+ *  ShutdownOS()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -7280,7 +8921,10 @@ OS_FUNC_ATTRIBUTE_DEFINITION(void, OS_CODE, OS_NORETURN, Os_TrapIsrEpilogue, (vo
  *
  *
  */
-OS_FUNC_ATTRIBUTE_DEFINITION(void, OS_CODE, OS_NORETURN, Os_TrapTaskMissingTerminateTask, (void))
+FUNC(void, OS_CODE) ShutdownOS
+(
+  StatusType Error
+)
 {
   /* #10 If a trap is needed: */
   if(Os_TrapIsTrapForWriteAccessRequired() != 0u)                                                                       /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */
@@ -7288,7 +8932,8 @@ OS_FUNC_ATTRIBUTE_DEFINITION(void, OS_CODE, OS_NORETURN, Os_TrapTaskMissingTermi
     Os_TrapPacketType packet;
 
     /* #20 Marshal API data. */
-    packet.TrapId = OS_TRAPID_TASKMISSINGTERMINATETASK;
+    packet.TrapId = OS_TRAPID_SHUTDOWNOS;
+    packet.Parameters[OS_TRAPPARAMINDEX_1].ParamApiType.ParamStatusType = Error;                                        /* SBSW_OS_PWA_LOCAL */
 
     /* #30 Trigger trap. */
     Os_Hal_Trap(&packet);                                                                                               /* SBSW_OS_FC_POINTER2LOCAL */
@@ -7297,15 +8942,13 @@ OS_FUNC_ATTRIBUTE_DEFINITION(void, OS_CODE, OS_NORETURN, Os_TrapTaskMissingTermi
   else
   {
     /* #50 Call the API directly. */
-    Os_TaskMissingTerminateTask();
+    Os_TrapCallShutdownOS(Error);
   }
-
-  Os_ErrKernelPanic();
 }
 
 
 /***********************************************************************************************************************
- *  Os_TrapHookReturn()
+ *  ShutdownAllCores()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -7316,7 +8959,10 @@ OS_FUNC_ATTRIBUTE_DEFINITION(void, OS_CODE, OS_NORETURN, Os_TrapTaskMissingTermi
  *
  *
  */
-OS_FUNC_ATTRIBUTE_DEFINITION(void, OS_CODE, OS_NORETURN, Os_TrapHookReturn, (void))
+FUNC(void, OS_CODE) ShutdownAllCores                                                                                    /* COV_OS_HALPLATFORMTESTEDASMULTICORE */
+(
+  StatusType Error
+)
 {
   /* #10 If a trap is needed: */
   if(Os_TrapIsTrapForWriteAccessRequired() != 0u)                                                                       /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */
@@ -7324,7 +8970,8 @@ OS_FUNC_ATTRIBUTE_DEFINITION(void, OS_CODE, OS_NORETURN, Os_TrapHookReturn, (voi
     Os_TrapPacketType packet;
 
     /* #20 Marshal API data. */
-    packet.TrapId = OS_TRAPID_HOOKRETURN;
+    packet.TrapId = OS_TRAPID_SHUTDOWNALLCORES;
+    packet.Parameters[OS_TRAPPARAMINDEX_1].ParamApiType.ParamStatusType = Error;                                        /* SBSW_OS_PWA_LOCAL */
 
     /* #30 Trigger trap. */
     Os_Hal_Trap(&packet);                                                                                               /* SBSW_OS_FC_POINTER2LOCAL */
@@ -7333,15 +8980,13 @@ OS_FUNC_ATTRIBUTE_DEFINITION(void, OS_CODE, OS_NORETURN, Os_TrapHookReturn, (voi
   else
   {
     /* #50 Call the API directly. */
-    Os_HookReturn();
+    Os_TrapCallShutdownAllCores(Error);
   }
-
-  Os_ErrKernelPanic();
 }
 
 
 /***********************************************************************************************************************
- *  Os_TrapCoreGetThread()
+ *  ControlIdle()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -7353,64 +8998,43 @@ OS_FUNC_ATTRIBUTE_DEFINITION(void, OS_CODE, OS_NORETURN, Os_TrapHookReturn, (voi
  *
  *
  */
-FUNC(P2CONST(Os_ThreadConfigType, AUTOMATIC, OS_CONST), OS_CODE) Os_TrapCoreGetThread
+FUNC(StatusType, OS_CODE) ControlIdle
 (
-  void
+  CoreIdType CoreID,
+  IdleModeType IdleMode
 )
 {
-  P2CONST(Os_ThreadConfigType, AUTOMATIC, OS_CONST) result;
+  Os_StatusType status;
 
   /* #10 If a trap is needed: */
-  if(Os_TrapIsTrapForWriteAccessRequired() != 0u)                                                                       /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */
+  if(Os_TrapIsTrapForWriteAccessRequired() != 0u)                                                                       /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */ /* COV_OS_HALPLATFORMTESTEDASMULTICORE */
   {
     Os_TrapPacketType packet;
 
     /* #20 Marshal API data. */
-    packet.TrapId = OS_TRAPID_COREGETTHREAD;
+    packet.TrapId = OS_TRAPID_CONTROLIDLE;
+    packet.Parameters[OS_TRAPPARAMINDEX_1].ParamApiType.ParamCoreIdType = CoreID;                                       /* SBSW_OS_PWA_LOCAL */
+    packet.Parameters[OS_TRAPPARAMINDEX_2].ParamApiType.ParamIdleModeType = IdleMode;                                   /* SBSW_OS_PWA_LOCAL */
 
     /* #30 Trigger trap. */
     Os_Hal_Trap(&packet);                                                                                               /* SBSW_OS_FC_POINTER2LOCAL */
 
     /* #40 Unmarshal return value. */
-    result = packet.ReturnValue.ReturnThreadConfigRefType;
+    status = packet.ReturnValue.ReturnOs_StatusType;
   }
   /* #50 Otherwise: */
   else
   {
     /* #60 Call the API directly. */
-    result = Os_CoreGetThread();
+    status = Os_TrapCallControlIdle(CoreID, IdleMode);
   }
 
-  return result;
-}
-
-
-
-/*
- * \}
- * \addtogroup Os_UserInterface
- * \{
- */
-/***********************************************************************************************************************
- *  Os_GetVersionInfo()
- **********************************************************************************************************************/
-/*!
- * Internal comment removed.
- *
- *
- */
-FUNC(void, OS_CODE) Os_GetVersionInfo
-(
-  Std_VersionInfoType *versioninfo
-)
-{
-  /* #10 Getter API. Call API directly. */
-  Os_TrapCallGetVersionInfo(versioninfo);                                                                               /* SBSW_OS_TRAP_API_USERPOINTER_001 */
-}
+  return Os_ErrReportControlIdle(status, CoreID, IdleMode);
+}                                                                                                                       /* PRQA S 6050 */ /* MD_MSR_STCAL */
 
 
 /***********************************************************************************************************************
- *  Os_GetExceptionContext()
+ *  Os_GetUnhandledIrq()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -7423,52 +9047,53 @@ FUNC(void, OS_CODE) Os_GetVersionInfo
  *
  *
  */
-FUNC(StatusType, OS_CODE) Os_GetExceptionContext
+FUNC(StatusType, OS_CODE) Os_GetUnhandledIrq
 (
-  Os_ExceptionContextRefType Context
+  Os_InterruptSourceIdRefType InterruptSource
 )
 {
   Os_StatusType status;
 
   /* #10 Check that the given pointer is valid. */
-  if(OS_UNLIKELY(Os_ErrCheckPointerIsNotNull(Context) == OS_CHECK_FAILED))                                              /* PRQA S 0315 */ /* MD_Os_Dir1.1_0315 */ /* SBSW_OS_TRAP_ERRCHECKPOINTERISNOTNULL_001 */
+  if(OS_UNLIKELY(Os_ErrCheckPointerIsNotNull(InterruptSource) == OS_CHECK_FAILED))                                      /* PRQA S 0315 */ /* MD_Os_Dir1.1_0315 */ /* SBSW_OS_TRAP_ERRCHECKPOINTERISNOTNULL_001 */ /* COV_OS_HALPLATFORMTESTEDASMULTICORE */
   {
     status = OS_STATUS_PARAM_POINTER_1;
   }
   else
   {
     /* #20 If a trap is needed: */
-    if(Os_TrapIsTrapForReadAccessRequired() != 0u)                                                                      /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */
+    if(Os_TrapIsTrapForWriteAccessRequired() != 0u)                                                                     /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */ /* COV_OS_HALPLATFORMTESTEDASMULTICORE */
     {
       Os_TrapPacketType packet;
-      Os_ExceptionContextType userspaceContext;
+      Os_InterruptSourceIdType userspaceInterruptSource;
 
       /* #30 Marshal API data. */
-      packet.TrapId = OS_TRAPID_GETEXCEPTIONCONTEXT;
-      packet.Parameters[OS_TRAPPARAMINDEX_1].ParamApiType.ParamExceptionContextRefType =
-                                                               (Os_ExceptionContextType*)&userspaceContext;             /* SBSW_OS_PWA_LOCAL */
+      packet.TrapId = OS_TRAPID_GETUNHANDLEDIRQ;
+      packet.Parameters[OS_TRAPPARAMINDEX_1].ParamApiType.ParamInterruptSourceIdRefType =
+                                                               (Os_InterruptSourceIdType*)&userspaceInterruptSource;    /* SBSW_OS_PWA_LOCAL */
 
       /* #40 Trigger trap. */
       Os_Hal_Trap(&packet);                                                                                             /* SBSW_OS_FC_POINTER2LOCAL */
 
       /* #50 Unmarshal return value. */
-      (*Context) = *((volatile Os_ExceptionContextType*)&userspaceContext);                                             /* SBSW_OS_TRAP_API_USERPOINTER_002 */
+      (*InterruptSource) = *((volatile Os_InterruptSourceIdType*)&userspaceInterruptSource);                            /* SBSW_OS_TRAP_API_USERPOINTER_002 */
       status = packet.ReturnValue.ReturnOs_StatusType;
     }
     /* #60 Otherwise: */
     else
     {
       /* #70 Call the API directly. */
-      status = Os_TrapCallGetExceptionContext(Context);                                                                 /* SBSW_OS_TRAP_API_USERPOINTER_001 */
+      status = Os_TrapCallGetUnhandledIrq(InterruptSource);                                                             /* SBSW_OS_TRAP_API_USERPOINTER_001 */
+
     }
   }
 
-  return Os_ErrReportGetExceptionContext(status, Context);                                                              /* SBSW_OS_TRAP_API_USERPOINTER_001 */
-}
+  return Os_ErrReportGetUnhandledIrq(status, InterruptSource);                                                          /* SBSW_OS_TRAP_API_USERPOINTER_001 */
+}                                                                                                                       /* PRQA S 6050 */ /* MD_MSR_STCAL */
 
 
 /***********************************************************************************************************************
- *  Os_SetExceptionContext()
+ *  Os_GetUnhandledExc()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -7481,53 +9106,53 @@ FUNC(StatusType, OS_CODE) Os_GetExceptionContext
  *
  *
  */
-FUNC(StatusType, OS_CODE) Os_SetExceptionContext
+FUNC(StatusType, OS_CODE) Os_GetUnhandledExc
 (
-  Os_ExceptionContextRefType Context
+  Os_ExceptionSourceIdRefType ExceptionSource
 )
 {
   Os_StatusType status;
 
   /* #10 Check that the given pointer is valid. */
-  if(OS_UNLIKELY(Os_ErrCheckPointerIsNotNull(Context) == OS_CHECK_FAILED))                                              /* PRQA S 0315 */ /* MD_Os_Dir1.1_0315 */ /* SBSW_OS_TRAP_ERRCHECKPOINTERISNOTNULL_001 */
+  if(OS_UNLIKELY(Os_ErrCheckPointerIsNotNull(ExceptionSource) == OS_CHECK_FAILED))                                      /* PRQA S 0315 */ /* MD_Os_Dir1.1_0315 */ /* SBSW_OS_TRAP_ERRCHECKPOINTERISNOTNULL_001 */ /* COV_OS_HALPLATFORMTESTEDASMULTICORE */
   {
     status = OS_STATUS_PARAM_POINTER_1;
   }
   else
   {
     /* #20 If a trap is needed: */
-    if(Os_TrapIsTrapForWriteAccessRequired() != 0u)                                                                     /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */
+    if(Os_TrapIsTrapForWriteAccessRequired() != 0u)                                                                     /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */ /* COV_OS_HALPLATFORMTESTEDASMULTICORE */
     {
       Os_TrapPacketType packet;
-      Os_ExceptionContextType userspaceContext;
-      userspaceContext = (*Context);
+      Os_ExceptionSourceIdType userspaceExceptionSource;
 
       /* #30 Marshal API data. */
-      packet.TrapId = OS_TRAPID_SETEXCEPTIONCONTEXT;
-      packet.Parameters[OS_TRAPPARAMINDEX_1].ParamApiType.ParamExceptionContextRefType =
-                                                               (Os_ExceptionContextType*)&userspaceContext;             /* SBSW_OS_PWA_LOCAL */
+      packet.TrapId = OS_TRAPID_GETUNHANDLEDEXC;
+      packet.Parameters[OS_TRAPPARAMINDEX_1].ParamApiType.ParamExceptionSourceIdRefType =
+                                                               (Os_ExceptionSourceIdType*)&userspaceExceptionSource;    /* SBSW_OS_PWA_LOCAL */
 
       /* #40 Trigger trap. */
       Os_Hal_Trap(&packet);                                                                                             /* SBSW_OS_FC_POINTER2LOCAL */
 
       /* #50 Unmarshal return value. */
+      (*ExceptionSource) = *((volatile Os_ExceptionSourceIdType*)&userspaceExceptionSource);                            /* SBSW_OS_TRAP_API_USERPOINTER_002 */
       status = packet.ReturnValue.ReturnOs_StatusType;
     }
     /* #60 Otherwise: */
     else
     {
       /* #70 Call the API directly. */
-      status = Os_TrapCallSetExceptionContext(Context);                                                                 /* SBSW_OS_TRAP_API_USERPOINTER_001 */
+      status = Os_TrapCallGetUnhandledExc(ExceptionSource);                                                             /* SBSW_OS_TRAP_API_USERPOINTER_001 */
 
     }
   }
 
-  return Os_ErrReportSetExceptionContext(status, Context);                                                              /* SBSW_OS_TRAP_API_USERPOINTER_001 */
-}
+  return Os_ErrReportGetUnhandledExc(status, ExceptionSource);                                                          /* SBSW_OS_TRAP_API_USERPOINTER_001 */
+}                                                                                                                       /* PRQA S 6050 */ /* MD_MSR_STCAL */
 
 
 /***********************************************************************************************************************
- *  Os_GetExceptionAddress()
+ *  Os_GetTaskStackUsage()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -7539,164 +9164,42 @@ FUNC(StatusType, OS_CODE) Os_SetExceptionContext
  *
  *
  */
-FUNC(Os_AddressOfConstType, OS_CODE) Os_GetExceptionAddress
+FUNC(uint32, OS_CODE) Os_GetTaskStackUsage
 (
-  void
+  TaskType TaskID
 )
 {
-  Os_AddressOfConstType address;
+  uint32 result;
 
   /* #10 If a trap is needed: */
-  if(Os_TrapIsTrapForReadAccessRequired() != 0u)                                                                        /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */
+  if(Os_TrapIsTrapForWriteAccessRequired() != 0u)                                                                       /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */
   {
     Os_TrapPacketType packet;
 
     /* #20 Marshal API data. */
-    packet.TrapId = OS_TRAPID_GETEXCEPTIONADDRESS;
+    packet.TrapId = OS_TRAPID_GETTASKSTACKUSAGE;
+    packet.Parameters[OS_TRAPPARAMINDEX_1].ParamApiType.ParamTaskType = TaskID;                                         /* SBSW_OS_PWA_LOCAL */
 
     /* #30 Trigger trap. */
     Os_Hal_Trap(&packet);                                                                                               /* SBSW_OS_FC_POINTER2LOCAL */
 
     /* #40 Unmarshal return value. */
-    address = packet.ReturnValue.ReturnOs_AddressOfConstType;
+    result = packet.ReturnValue.ReturnUint32Type;
   }
   /* #50 Otherwise: */
   else
   {
     /* #60 Call the API directly. */
-    address = Os_TrapCallGetExceptionAddress();                                                                         /* SBSW_OS_TRAP_API_USERPOINTER_001 */
-  }
-
-  return address;
-}
-
-
-/***********************************************************************************************************************
- *  Os_InitMemory()
- **********************************************************************************************************************/
-/*!
- * Internal comment removed.
- *
- *
- */
-FUNC(void, OS_CODE) Os_InitMemory
-(
-  void
-)
-{
-  /* #10 Caller (startup code) is privileged. Call API directly. */
-  Os_TrapCallInitMemory();
-}
-
-
-/***********************************************************************************************************************
- *  Os_Init()
- **********************************************************************************************************************/
-/*!
- * Internal comment removed.
- *
- *
- */
-FUNC(void, OS_CODE) Os_Init
-(
-  void
-)
-{
-  /* #10 Caller (startup code) is privileged exception vectors are not yet initialized. Call API directly. */
-  Os_TrapCallInit();
-}
-
-
-/***********************************************************************************************************************
- *  Os_InitInterruptOnly()
- **********************************************************************************************************************/
-/*!
- * Internal comment removed.
- *
- *
- */
-FUNC(void, OS_CODE) Os_InitInterruptOnly
-(
-  void
-)
-{
-  /* #10 Caller (startup code) is privileged. Call API directly. */
-  Os_TrapCallInitInterruptOnly();
-}
-
-
-/***********************************************************************************************************************
- *  Os_EnterPreStartTask()
- **********************************************************************************************************************/
-/*!
- * Internal comment removed.
- *
- *
- */
-FUNC(void, OS_CODE) Os_EnterPreStartTask
-(
-  void
-)
-{
-  /* #10 Caller (startup code) is privileged. Call API directly. */
-  Os_TrapCallEnterPreStartTask();
-}
-
-
-/***********************************************************************************************************************
- *  StartCore()
- **********************************************************************************************************************/
-/*!
- * Internal comment removed.
- *
- *
- *
- */
-FUNC(void, OS_CODE) StartCore                                                                                           /* COV_OS_HALPLATFORMTESTEDASMULTICORE */
-(
-  CoreIdType CoreID,
-  StatusType *Status
-)
-{
-  /* #10 If the given status pointer is valid: */
-  if(OS_UNLIKELY(Os_ErrCheckPointerIsNotNull(Status) != OS_CHECK_FAILED))                                               /* PRQA S 0315 */ /* MD_Os_Dir1.1_0315 */ /* SBSW_OS_TRAP_ERRCHECKPOINTERISNOTNULL_001 */
-  {
-    /* #20 Caller (startup code) is privileged. Call API directly. */
-    Os_TrapCallStartCore(CoreID, Status);                                                                               /* SBSW_OS_TRAP_API_USERPOINTER_001 */
-  }
-  /* else
-   *   Do NOT write the error code to the Status pointer, as it is a NULL_PTR!  */
-}
-
-
-/***********************************************************************************************************************
- *  StartNonAutosarCore()
- **********************************************************************************************************************/
-/*!
- * Internal comment removed.
- *
- *
- *
- */
-FUNC(void, OS_CODE) StartNonAutosarCore                                                                                 /* COV_OS_HALPLATFORMTESTEDASMULTICORE */
-(
-  CoreIdType CoreID,
-  StatusType *Status
-)
-{
-  /* #10 If the given status pointer is valid: */
-  if(OS_UNLIKELY(Os_ErrCheckPointerIsNotNull(Status) != OS_CHECK_FAILED))                                               /* PRQA S 0315 */ /* MD_Os_Dir1.1_0315 */ /* SBSW_OS_TRAP_ERRCHECKPOINTERISNOTNULL_001 */
-  {
-    /* #20 Caller (startup code) is privileged. Call API directly. */
-    Os_TrapCallStartNonAutosarCore(CoreID, Status);                                                                     /* SBSW_OS_TRAP_API_USERPOINTER_001 */
-  }
-  /* else
-   *   Do NOT write the error code to the Status pointer, as it is a NULL_PTR!  */
-}
+    result = Os_TrapCallGetTaskStackUsage(TaskID);
+  }
+
+  return result;
+}                                                                                                                       /* PRQA S 6050 */ /* MD_MSR_STCAL */
+
 
 
 /***********************************************************************************************************************
- *  GetCoreID()
+ *  Os_GetISRStackUsage()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -7708,40 +9211,41 @@ FUNC(void, OS_CODE) StartNonAutosarCore
  *
  *
  */
-FUNC(CoreIdType, OS_CODE) GetCoreID
+FUNC(uint32, OS_CODE) Os_GetISRStackUsage
 (
-  void
+  ISRType IsrID
 )
 {
-  CoreIdType result;
+  uint32 result;
 
   /* #10 If a trap is needed: */
-  if(Os_TrapIsTrapForReadAccessRequired() != 0u)                                                                        /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */
+  if(Os_TrapIsTrapForWriteAccessRequired() != 0u)                                                                       /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */
   {
     Os_TrapPacketType packet;
 
     /* #20 Marshal API data. */
-    packet.TrapId = OS_TRAPID_GETCOREID;
+    packet.TrapId = OS_TRAPID_GETISRSTACKUSAGE;
+    packet.Parameters[OS_TRAPPARAMINDEX_1].ParamApiType.ParamISRType = IsrID;                                           /* SBSW_OS_PWA_LOCAL */
 
     /* #30 Trigger trap. */
     Os_Hal_Trap(&packet);                                                                                               /* SBSW_OS_FC_POINTER2LOCAL */
 
     /* #40 Unmarshal return value. */
-    result = packet.ReturnValue.ReturnCoreIdType;
+    result = packet.ReturnValue.ReturnUint32Type;
   }
   /* #50 Otherwise: */
   else
   {
     /* #60 Call the API directly. */
-    result = Os_TrapCallGetCoreID();
+    result = Os_TrapCallGetISRStackUsage(IsrID);
   }
 
   return result;
-}
+}                                                                                                                       /* PRQA S 6050 */ /* MD_MSR_STCAL */
 
 
 /***********************************************************************************************************************
- *  GetNumberOfActivatedCores()
+ *  Os_GetKernelStackUsage()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -7753,20 +9257,21 @@ FUNC(CoreIdType, OS_CODE) GetCoreID
  *
  *
  */
-FUNC(uint32, OS_CODE) GetNumberOfActivatedCores
+FUNC(uint32, OS_CODE) Os_GetKernelStackUsage
 (
-  void
+  CoreIdType CoreID
 )
 {
   uint32 result;
 
   /* #10 If a trap is needed: */
-  if(Os_TrapIsTrapForReadAccessRequired() != 0u)                                                                        /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */ /* COV_OS_HALPLATFORMTESTEDASMULTICORE */
+  if(Os_TrapIsTrapForWriteAccessRequired() != 0u)                                                                       /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */
   {
     Os_TrapPacketType packet;
 
     /* #20 Marshal API data. */
-    packet.TrapId = OS_TRAPID_GETNUMBEROFACTIVATEDCORES;
+    packet.TrapId = OS_TRAPID_GETKERNELSTACKUSAGE;
+    packet.Parameters[OS_TRAPPARAMINDEX_1].ParamApiType.ParamCoreIdType = CoreID;                                       /* SBSW_OS_PWA_LOCAL */
 
     /* #30 Trigger trap. */
     Os_Hal_Trap(&packet);                                                                                               /* SBSW_OS_FC_POINTER2LOCAL */
@@ -7778,15 +9283,15 @@ FUNC(uint32, OS_CODE) GetNumberOfActivatedCores
   else
   {
     /* #60 Call the API directly. */
-    result = Os_TrapCallGetNumberOfActivatedCores();
+    result = Os_TrapCallGetKernelStackUsage(CoreID);
   }
 
   return result;
-}
+}                                                                                                                       /* PRQA S 6050 */ /* MD_MSR_STCAL */
 
 
 /***********************************************************************************************************************
- *  Os_GetCoreStartState()
+ *  Os_GetStartupHookStackUsage()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -7797,66 +9302,42 @@ FUNC(uint32, OS_CODE) GetNumberOfActivatedCores
  *
  *
  *
- *
- *
- *
- *
  */
-FUNC(void, OS_CODE) Os_GetCoreStartState
+FUNC(uint32, OS_CODE) Os_GetStartupHookStackUsage
 (
-  CoreIdType CoreID,
-  P2VAR(Os_CoreStartStateType, TYPEDEF, AUTOMATIC) CoreState,
-  StatusType *Status
+  CoreIdType CoreID
 )
 {
-  /* #10 If the given status pointer is valid: */
-  if(OS_UNLIKELY(Os_ErrCheckPointerIsNotNull(Status) != OS_CHECK_FAILED))                                               /* PRQA S 0315 */ /* MD_Os_Dir1.1_0315 */ /* SBSW_OS_TRAP_ERRCHECKPOINTERISNOTNULL_001 */
+  uint32 result;
+
+  /* #10 If a trap is needed: */
+  if(Os_TrapIsTrapForWriteAccessRequired() != 0u)                                                                       /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */
   {
-    /* #20 If the given state pointer is valid: */
-    if(OS_UNLIKELY(Os_ErrCheckPointerIsNotNull(CoreState) != OS_CHECK_FAILED))                                          /* PRQA S 0315 */ /* MD_Os_Dir1.1_0315 */ /* SBSW_OS_TRAP_ERRCHECKPOINTERISNOTNULL_001 */
-    {
-      /* #30 If a trap is needed: */
-      if(Os_TrapIsTrapForReadAccessRequired() != 0u)                                                                    /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */
-      {
-        Os_TrapPacketType packet;
-        Os_CoreStartStateType userspaceCoreState;
-        StatusType userspaceStatus;
+    Os_TrapPacketType packet;
 
-        /* #40 Marshal API data. */
-        packet.TrapId = OS_TRAPID_GETCORESTARTSTATE;
-        packet.Parameters[OS_TRAPPARAMINDEX_1].ParamApiType.ParamCoreIdType = CoreID;                                   /* SBSW_OS_PWA_LOCAL */
-        packet.Parameters[OS_TRAPPARAMINDEX_2].ParamApiType.ParamCoreStartStateRefType =
-                                                                (Os_CoreStartStateType*)&userspaceCoreState;            /* SBSW_OS_PWA_LOCAL */
-        packet.Parameters[OS_TRAPPARAMINDEX_3].ParamApiType.ParamStatusRefType = (StatusType*)&userspaceStatus;         /* SBSW_OS_PWA_LOCAL */
+    /* #20 Marshal API data. */
+    packet.TrapId = OS_TRAPID_GETSTARTUPHOOKSTACKUSAGE;
+    packet.Parameters[OS_TRAPPARAMINDEX_1].ParamApiType.ParamCoreIdType = CoreID;                                       /* SBSW_OS_PWA_LOCAL */
 
-        /* #50 Trigger trap. */
-        Os_Hal_Trap(&packet);                                                                                           /* SBSW_OS_FC_POINTER2LOCAL */
+    /* #30 Trigger trap. */
+    Os_Hal_Trap(&packet);                                                                                               /* SBSW_OS_FC_POINTER2LOCAL */
 
-        /* #60 Unmarshal return values. */
-        (*Status) = *((volatile StatusType*)&userspaceStatus);                                                          /* SBSW_OS_TRAP_API_USERPOINTER_002 */
-        (*CoreState) = *((volatile Os_CoreStartStateType*)&userspaceCoreState);                                         /* SBSW_OS_TRAP_API_USERPOINTER_002 */
-      }
-      /* #70 Otherwise: */
-      else
-      {
-        /* #80 Call the API directly. */
-        Os_TrapCallGetCoreStartState(CoreID, CoreState, Status);                                                        /* SBSW_OS_TRAP_API_USERPOINTER_001 */
-      }
-    }
-    /* #90 Otherwise: */
-    else
-    {
-      /* #100 Set the Status parameter to E_OS_PARAM_POINTER. */
-      *Status = E_OS_PARAM_POINTER;                                                                                     /* SBSW_OS_PWA_PRECONDITION */
-    }
+    /* #40 Unmarshal return value. */
+    result = packet.ReturnValue.ReturnUint32Type;
   }
-  /* else
-   *   Do NOT write the error code to the Status pointer, as it is a NULL_PTR!  */
-}
+  /* #50 Otherwise: */
+  else
+  {
+    /* #60 Call the API directly. */
+    result = Os_TrapCallGetStartupHookStackUsage(CoreID);
+  }
+
+  return result;
+}                                                                                                                       /* PRQA S 6050 */ /* MD_MSR_STCAL */
 
 
 /***********************************************************************************************************************
- *  GetActiveApplicationMode()
+ *  Os_GetErrorHookStackUsage()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -7868,58 +9349,87 @@ FUNC(void, OS_CODE) Os_GetCoreStartState
  *
  *
  */
-FUNC(AppModeType, OS_CODE) GetActiveApplicationMode
+FUNC(uint32, OS_CODE) Os_GetErrorHookStackUsage
 (
-  void
+  CoreIdType CoreID
 )
 {
-  AppModeType result;
+  uint32 result;
 
   /* #10 If a trap is needed: */
-  if(Os_TrapIsTrapForReadAccessRequired() != 0u)                                                                        /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */
+  if(Os_TrapIsTrapForWriteAccessRequired() != 0u)                                                                       /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */
   {
     Os_TrapPacketType packet;
 
     /* #20 Marshal API data. */
-    packet.TrapId = OS_TRAPID_GETACTIVEAPPLICATIONMODE;
+    packet.TrapId = OS_TRAPID_GETERRORHOOKSTACKUSAGE;
+    packet.Parameters[OS_TRAPPARAMINDEX_1].ParamApiType.ParamCoreIdType = CoreID;                                       /* SBSW_OS_PWA_LOCAL */
 
     /* #30 Trigger trap. */
     Os_Hal_Trap(&packet);                                                                                               /* SBSW_OS_FC_POINTER2LOCAL */
 
     /* #40 Unmarshal return value. */
-    result = packet.ReturnValue.ReturnAppModeType;
+    result = packet.ReturnValue.ReturnUint32Type;
   }
   /* #50 Otherwise: */
   else
   {
     /* #60 Call the API directly. */
-    result = Os_TrapCallGetActiveApplicationMode();
+    result = Os_TrapCallGetErrorHookStackUsage(CoreID);
   }
 
   return result;
-}
+}                                                                                                                       /* PRQA S 6050 */ /* MD_MSR_STCAL */
 
 
 /***********************************************************************************************************************
- *  StartOS()
+ *  Os_GetShutdownHookStackUsage()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
  *
  *
+ *
+ *
+ *
+ *
+ *
  */
-FUNC(void, OS_CODE) StartOS
+FUNC(uint32, OS_CODE) Os_GetShutdownHookStackUsage
 (
-  AppModeType Mode
+  CoreIdType CoreID
 )
 {
-  /* #10 Caller (startup code) is privileged. Call API directly. */
-  Os_TrapCallStartOS(Mode);
-}
+  uint32 result;
+
+  /* #10 If a trap is needed: */
+  if(Os_TrapIsTrapForWriteAccessRequired() != 0u)                                                                       /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */
+  {
+    Os_TrapPacketType packet;
+
+    /* #20 Marshal API data. */
+    packet.TrapId = OS_TRAPID_GETSHUTDOWNHOOKSTACKUSAGE;
+    packet.Parameters[OS_TRAPPARAMINDEX_1].ParamApiType.ParamCoreIdType = CoreID;                                       /* SBSW_OS_PWA_LOCAL */
+
+    /* #30 Trigger trap. */
+    Os_Hal_Trap(&packet);                                                                                               /* SBSW_OS_FC_POINTER2LOCAL */
+
+    /* #40 Unmarshal return value. */
+    result = packet.ReturnValue.ReturnUint32Type;
+  }
+  /* #50 Otherwise: */
+  else
+  {
+    /* #60 Call the API directly. */
+    result = Os_TrapCallGetShutdownHookStackUsage(CoreID);
+  }
+
+  return result;
+}                                                                                                                       /* PRQA S 6050 */ /* MD_MSR_STCAL */
 
 
 /***********************************************************************************************************************
- *  ShutdownOS()
+ *  Os_GetProtectionHookStackUsage()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -7929,35 +9439,43 @@ FUNC(void, OS_CODE) StartOS
  *
  *
  *
+ *
  */
-FUNC(void, OS_CODE) ShutdownOS
+FUNC(uint32, OS_CODE) Os_GetProtectionHookStackUsage
 (
-  StatusType Error
+  CoreIdType CoreID
 )
 {
+  uint32 result;
+
   /* #10 If a trap is needed: */
   if(Os_TrapIsTrapForWriteAccessRequired() != 0u)                                                                       /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */
   {
     Os_TrapPacketType packet;
 
     /* #20 Marshal API data. */
-    packet.TrapId = OS_TRAPID_SHUTDOWNOS;
-    packet.Parameters[OS_TRAPPARAMINDEX_1].ParamApiType.ParamStatusType = Error;                                        /* SBSW_OS_PWA_LOCAL */
+    packet.TrapId = OS_TRAPID_GETPROTECTIONHOOKSTACKUSAGE;
+    packet.Parameters[OS_TRAPPARAMINDEX_1].ParamApiType.ParamCoreIdType = CoreID;                                       /* SBSW_OS_PWA_LOCAL */
 
     /* #30 Trigger trap. */
     Os_Hal_Trap(&packet);                                                                                               /* SBSW_OS_FC_POINTER2LOCAL */
+
+    /* #40 Unmarshal return value. */
+    result = packet.ReturnValue.ReturnUint32Type;
   }
-  /* #40 Otherwise: */
+  /* #50 Otherwise: */
   else
   {
-    /* #50 Call the API directly. */
-    Os_TrapCallShutdownOS(Error);
+    /* #60 Call the API directly. */
+    result = Os_TrapCallGetProtectionHookStackUsage(CoreID);
   }
-}
+
+  return result;
+}                                                                                                                       /* PRQA S 6050 */ /* MD_MSR_STCAL */
 
 
 /***********************************************************************************************************************
- *  ShutdownAllCores()
+ *  Os_GetNonTrustedFunctionStackUsage()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -7967,83 +9485,113 @@ FUNC(void, OS_CODE) ShutdownOS
  *
  *
  *
+ *
  */
-FUNC(void, OS_CODE) ShutdownAllCores                                                                                    /* COV_OS_HALPLATFORMTESTEDASMULTICORE */
+FUNC(uint32, OS_CODE) Os_GetNonTrustedFunctionStackUsage
 (
-  StatusType Error
+  Os_NonTrustedFunctionIndexType FunctionIndex
 )
 {
+  uint32 result;
+
   /* #10 If a trap is needed: */
   if(Os_TrapIsTrapForWriteAccessRequired() != 0u)                                                                       /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */
   {
     Os_TrapPacketType packet;
 
     /* #20 Marshal API data. */
-    packet.TrapId = OS_TRAPID_SHUTDOWNALLCORES;
-    packet.Parameters[OS_TRAPPARAMINDEX_1].ParamApiType.ParamStatusType = Error;                                        /* SBSW_OS_PWA_LOCAL */
+    packet.TrapId = OS_TRAPID_GETNONTRUSTEDFUNCTIONSTACKUSAGE;
+    packet.Parameters[OS_TRAPPARAMINDEX_1].ParamApiType.ParamOs_NonTrustedFunctionIndexType = FunctionIndex;            /* SBSW_OS_PWA_LOCAL */
 
     /* #30 Trigger trap. */
     Os_Hal_Trap(&packet);                                                                                               /* SBSW_OS_FC_POINTER2LOCAL */
+
+    /* #40 Unmarshal return value. */
+    result = packet.ReturnValue.ReturnUint32Type;
   }
-  /* #40 Otherwise: */
+  /* #50 Otherwise: */
   else
   {
-    /* #50 Call the API directly. */
-    Os_TrapCallShutdownAllCores(Error);
+    /* #60 Call the API directly. */
+    result = Os_TrapCallGetNonTrustedFunctionStackUsage(FunctionIndex);
   }
+
+  return result;
+}                                                                                                                       /* PRQA S 6050 */ /* MD_MSR_STCAL */
+
+
+/***********************************************************************************************************************
+ *  GetSpinlock()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ */
+FUNC(StatusType, OS_CODE) GetSpinlock(SpinlockIdType SpinlockId)
+{
+  Os_StatusType status;
+
+  /* #10 Spinlock API call is configurable. Spinlock module handles whether trap is needed or not. */
+  status = Os_Api_GetSpinlock(SpinlockId);
+
+  return Os_ErrReportGetSpinlock(status, SpinlockId);
+}
+
+
+/***********************************************************************************************************************
+ *  ReleaseSpinlock()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ */
+FUNC(StatusType, OS_CODE) ReleaseSpinlock(SpinlockIdType SpinlockId)
+{
+  Os_StatusType status;
+
+  /* #10 Spinlock API call is configurable. Spinlock module handles whether trap is needed or not. */
+  status = Os_Api_ReleaseSpinlock(SpinlockId);
+
+  return Os_ErrReportReleaseSpinlock(status, SpinlockId);
 }
 
 
 /***********************************************************************************************************************
- *  ControlIdle()
+ *  TryToGetSpinlock()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
  *
  *
  *
- *
- *
- *
- *
  */
-FUNC(StatusType, OS_CODE) ControlIdle
+FUNC(StatusType, OS_CODE) TryToGetSpinlock
 (
-  CoreIdType CoreID,
-  IdleModeType IdleMode
+  SpinlockIdType SpinlockId,
+  TryToGetSpinlockType* Success
 )
 {
   Os_StatusType status;
 
-  /* #10 If a trap is needed: */
-  if(Os_TrapIsTrapForWriteAccessRequired() != 0u)                                                                       /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */ /* COV_OS_HALPLATFORMTESTEDASMULTICORE */
+  /* #10 Check that the given pointer is valid. */
+  if(OS_UNLIKELY(Os_ErrCheckPointerIsNotNull(Success) == OS_CHECK_FAILED))                                              /* PRQA S 0315 */ /* MD_Os_Dir1.1_0315 */ /* SBSW_OS_TRAP_ERRCHECKPOINTERISNOTNULL_001 */
   {
-    Os_TrapPacketType packet;
-
-    /* #20 Marshal API data. */
-    packet.TrapId = OS_TRAPID_CONTROLIDLE;
-    packet.Parameters[OS_TRAPPARAMINDEX_1].ParamApiType.ParamCoreIdType = CoreID;                                       /* SBSW_OS_PWA_LOCAL */
-    packet.Parameters[OS_TRAPPARAMINDEX_2].ParamApiType.ParamIdleModeType = IdleMode;                                   /* SBSW_OS_PWA_LOCAL */
-
-    /* #30 Trigger trap. */
-    Os_Hal_Trap(&packet);                                                                                               /* SBSW_OS_FC_POINTER2LOCAL */
-
-    /* #40 Unmarshal return value. */
-    status = packet.ReturnValue.ReturnOs_StatusType;
+    status = OS_STATUS_PARAM_POINTER_2;
   }
-  /* #50 Otherwise: */
   else
   {
-    /* #60 Call the API directly. */
-    status = Os_TrapCallControlIdle(CoreID, IdleMode);
+    /* #20 Otherwise call the API. */
+    status = Os_Api_TryToGetSpinlock(SpinlockId, Success);                                                              /* SBSW_OS_TRAP_API_USERPOINTER_001 */
   }
 
-  return Os_ErrReportControlIdle(status, CoreID, IdleMode);
-}                                                                                                                       /* PRQA S 6050 */ /* MD_MSR_STCAL */
+  return Os_ErrReportTryToGetSpinlock(status, SpinlockId, Success);                                                     /* SBSW_OS_TRAP_ERRREPORT_001 */
+}
 
 
 /***********************************************************************************************************************
- *  Os_GetUnhandledIrq()
+ *  Os_GetSpinlockStatistics()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -8056,53 +9604,55 @@ FUNC(StatusType, OS_CODE) ControlIdle
  *
  *
  */
-FUNC(StatusType, OS_CODE) Os_GetUnhandledIrq
+FUNC(StatusType, OS_CODE) Os_GetSpinlockStatistics
 (
-  Os_InterruptSourceIdRefType InterruptSource
+  SpinlockIdType SpinlockId,
+  CoreIdType CoreID,
+  Os_SpinlockStatisticsRefType Statistics
 )
 {
   Os_StatusType status;
 
   /* #10 Check that the given pointer is valid. */
-  if(OS_UNLIKELY(Os_ErrCheckPointerIsNotNull(InterruptSource) == OS_CHECK_FAILED))                                      /* PRQA S 0315 */ /* MD_Os_Dir1.1_0315 */ /* SBSW_OS_TRAP_ERRCHECKPOINTERISNOTNULL_001 */ /* COV_OS_HALPLATFORMTESTEDASMULTICORE */
+  if(OS_UNLIKELY(Os_ErrCheckPointerIsNotNull(Statistics) == OS_CHECK_FAILED))                                           /* PRQA S 0315 */ /* MD_Os_Dir1.1_0315 */ /* SBSW_OS_TRAP_ERRCHECKPOINTERISNOTNULL_001 */
   {
-    status = OS_STATUS_PARAM_POINTER_1;
+    status = OS_STATUS_PARAM_POINTER_3;
   }
   else
   {
     /* #20 If a trap is needed: */
-    if(Os_TrapIsTrapForWriteAccessRequired() != 0u)                                                                     /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */ /* COV_OS_HALPLATFORMTESTEDASMULTICORE */
+    if(Os_TrapIsTrapForWriteAccessRequired() != 0u)                                                                     /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */
     {
       Os_TrapPacketType packet;
-      Os_InterruptSourceIdType userspaceInterruptSource;
+      Os_SpinlockStatisticsType userspaceStatistics;
 
       /* #30 Marshal API data. */
-      packet.TrapId = OS_TRAPID_GETUNHANDLEDIRQ;
-      packet.Parameters[OS_TRAPPARAMINDEX_1].ParamApiType.ParamInterruptSourceIdRefType =
-                                                               (Os_InterruptSourceIdType*)&userspaceInterruptSource;    /* SBSW_OS_PWA_LOCAL */
+      packet.TrapId = OS_TRAPID_GETSPINLOCKSTATISTICS;
+      packet.Parameters[OS_TRAPPARAMINDEX_1].ParamApiType.ParamSpinlockIdType = SpinlockId;                             /* SBSW_OS_PWA_LOCAL */
+      packet.Parameters[OS_TRAPPARAMINDEX_2].ParamApiType.ParamCoreIdType = CoreID;                                     /* SBSW_OS_PWA_LOCAL */
+      packet.Parameters[OS_TRAPPARAMINDEX_3].ParamApiType.ParamSpinlockStatisticsRefType = &userspaceStatistics;        /* SBSW_OS_PWA_LOCAL */
 
       /* #40 Trigger trap. */
       Os_Hal_Trap(&packet);                                                                                             /* SBSW_OS_FC_POINTER2LOCAL */
 
       /* #50 Unmarshal return value. */
-      (*InterruptSource) = *((volatile Os_InterruptSourceIdType*)&userspaceInterruptSource);                            /* SBSW_OS_TRAP_API_USERPOINTER_002 */
+      (*Statistics) = *((volatile Os_SpinlockStatisticsType*)&userspaceStatistics);                                     /* SBSW_OS_TRAP_API_USERPOINTER_002 */
       status = packet.ReturnValue.ReturnOs_StatusType;
     }
     /* #60 Otherwise: */
     else
     {
       /* #70 Call the API directly. */
-      status = Os_TrapCallGetUnhandledIrq(InterruptSource);                                                             /* SBSW_OS_TRAP_API_USERPOINTER_001 */
-
+      status = Os_TrapCallGetSpinlockStatistics(SpinlockId, CoreID, Statistics);                                        /* SBSW_OS_TRAP_API_USERPOINTER_001 */
     }
   }
 
-  return Os_ErrReportGetUnhandledIrq(status, InterruptSource);                                                          /* SBSW_OS_TRAP_API_USERPOINTER_001 */
+  return Os_ErrReportGetSpinlockStatistics(status, SpinlockId, CoreID, Statistics);                                     /* SBSW_OS_TRAP_ERRREPORT_001 */
 }                                                                                                                       /* PRQA S 6050 */ /* MD_MSR_STCAL */
 
 
 /***********************************************************************************************************************
- *  Os_GetUnhandledExc()
+ *  Os_GetTaskStateAsync()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -8115,53 +9665,56 @@ FUNC(StatusType, OS_CODE) Os_GetUnhandledIrq
  *
  *
  */
-FUNC(StatusType, OS_CODE) Os_GetUnhandledExc
+FUNC(StatusType, OS_CODE) Os_GetTaskStateAsync
 (
-  Os_ExceptionSourceIdRefType ExceptionSource
+  TaskType TaskID,
+  EventMaskType Mask,
+  Os_AsyncCallRefType Call
 )
 {
   Os_StatusType status;
 
   /* #10 Check that the given pointer is valid. */
-  if(OS_UNLIKELY(Os_ErrCheckPointerIsNotNull(ExceptionSource) == OS_CHECK_FAILED))                                      /* PRQA S 0315 */ /* MD_Os_Dir1.1_0315 */ /* SBSW_OS_TRAP_ERRCHECKPOINTERISNOTNULL_001 */ /* COV_OS_HALPLATFORMTESTEDASMULTICORE */
+  if(OS_UNLIKELY(Os_ErrCheckPointerIsNotNull(Call) == OS_CHECK_FAILED))                                                 /* PRQA S 0315 */ /* MD_Os_Dir1.1_0315 */ /* SBSW_OS_TRAP_ERRCHECKPOINTERISNOTNULL_001 */
   {
-    status = OS_STATUS_PARAM_POINTER_1;
+    status = OS_STATUS_PARAM_POINTER_3;
   }
   else
   {
     /* #20 If a trap is needed: */
-    if(Os_TrapIsTrapForWriteAccessRequired() != 0u)                                                                     /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */ /* COV_OS_HALPLATFORMTESTEDASMULTICORE */
+    if(Os_TrapIsTrapForWriteAccessRequired() != 0u)                                                                     /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */
     {
       Os_TrapPacketType packet;
-      Os_ExceptionSourceIdType userspaceExceptionSource;
+      Os_AsyncCallType userspaceCall;
 
-      /* #30 Marshal API data. */
-      packet.TrapId = OS_TRAPID_GETUNHANDLEDEXC;
-      packet.Parameters[OS_TRAPPARAMINDEX_1].ParamApiType.ParamExceptionSourceIdRefType =
-                                                               (Os_ExceptionSourceIdType*)&userspaceExceptionSource;    /* SBSW_OS_PWA_LOCAL */
+      /* #30 Marshal API data. The handle is copied in both directions. */
+      userspaceCall = (*Call);
+      packet.TrapId = OS_TRAPID_GETTASKSTATEASYNC;
+      packet.Parameters[OS_TRAPPARAMINDEX_1].ParamApiType.ParamTaskType = TaskID;                                       /* SBSW_OS_PWA_LOCAL */
+      packet.Parameters[OS_TRAPPARAMINDEX_2].ParamApiType.ParamEventMaskType = Mask;                                    /* SBSW_OS_PWA_LOCAL */
+      packet.Parameters[OS_TRAPPARAMINDEX_3].ParamApiType.ParamAsyncCallRefType = &userspaceCall;                       /* SBSW_OS_PWA_LOCAL */
 
       /* #40 Trigger trap. */
       Os_Hal_Trap(&packet);                                                                                             /* SBSW_OS_FC_POINTER2LOCAL */
 
       /* #50 Unmarshal return value. */
-      (*ExceptionSource) = *((volatile Os_ExceptionSourceIdType*)&userspaceExceptionSource);                            /* SBSW_OS_TRAP_API_USERPOINTER_002 */
+      (*Call) = *((volatile Os_AsyncCallType*)&userspaceCall);                                                          /* SBSW_OS_TRAP_API_USERPOINTER_002 */
       status = packet.ReturnValue.ReturnOs_StatusType;
     }
     /* #60 Otherwise: */
     else
     {
       /* #70 Call the API directly. */
-      status = Os_TrapCallGetUnhandledExc(ExceptionSource);                                                             /* SBSW_OS_TRAP_API_USERPOINTER_001 */
-
+      status = Os_TrapCallGetTaskStateAsync(TaskID, Mask, Call);                                                        /* SBSW_OS_TRAP_API_USERPOINTER_001 */
     }
   }
 
-  return Os_ErrReportGetUnhandledExc(status, ExceptionSource);                                                          /* SBSW_OS_TRAP_API_USERPOINTER_001 */
+  return Os_ErrReportGetTaskStateAsync(status, TaskID, Mask, Call);                                                     /* SBSW_OS_TRAP_ERRREPORT_001 */
 }                                                                                                                       /* PRQA S 6050 */ /* MD_MSR_STCAL */
 
 
 /***********************************************************************************************************************
- *  Os_GetTaskStackUsage()
+ *  Os_GetAlarmAsync()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -8172,43 +9725,58 @@ FUNC(StatusType, OS_CODE) Os_GetUnhandledExc
  *
  *
  *
+ *
  */
-FUNC(uint32, OS_CODE) Os_GetTaskStackUsage
+FUNC(StatusType, OS_CODE) Os_GetAlarmAsync
 (
-  TaskType TaskID
+  AlarmType AlarmID,
+  EventMaskType Mask,
+  Os_AsyncCallRefType Call
 )
 {
-  uint32 result;
+  Os_StatusType status;
 
-  /* #10 If a trap is needed: */
-  if(Os_TrapIsTrapForWriteAccessRequired() != 0u)                                                                       /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */
+  /* #10 Check that the given pointer is valid. */
+  if(OS_UNLIKELY(Os_ErrCheckPointerIsNotNull(Call) == OS_CHECK_FAILED))                                                 /* PRQA S 0315 */ /* MD_Os_Dir1.1_0315 */ /* SBSW_OS_TRAP_ERRCHECKPOINTERISNOTNULL_001 */
   {
-    Os_TrapPacketType packet;
-
-    /* #20 Marshal API data. */
-    packet.TrapId = OS_TRAPID_GETTASKSTACKUSAGE;
-    packet.Parameters[OS_TRAPPARAMINDEX_1].ParamApiType.ParamTaskType = TaskID;                                         /* SBSW_OS_PWA_LOCAL */
-
-    /* #30 Trigger trap. */
-    Os_Hal_Trap(&packet);                                                                                               /* SBSW_OS_FC_POINTER2LOCAL */
-
-    /* #40 Unmarshal return value. */
-    result = packet.ReturnValue.ReturnUint32Type;
+    status = OS_STATUS_PARAM_POINTER_3;
   }
-  /* #50 Otherwise: */
   else
   {
-    /* #60 Call the API directly. */
-    result = Os_TrapCallGetTaskStackUsage(TaskID);
+    /* #20 If a trap is needed: */
+    if(Os_TrapIsTrapForWriteAccessRequired() != 0u)                                                                     /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */
+    {
+      Os_TrapPacketType packet;
+      Os_AsyncCallType userspaceCall;
+
+      /* #30 Marshal API data. The handle is copied in both directions. */
+      userspaceCall = (*Call);
+      packet.TrapId = OS_TRAPID_GETALARMASYNC;
+      packet.Parameters[OS_TRAPPARAMINDEX_1].ParamApiType.ParamAlarmType = AlarmID;                                     /* SBSW_OS_PWA_LOCAL */
+      packet.Parameters[OS_TRAPPARAMINDEX_2].ParamApiType.ParamEventMaskType = Mask;                                    /* SBSW_OS_PWA_LOCAL */
+      packet.Parameters[OS_TRAPPARAMINDEX_3].ParamApiType.ParamAsyncCallRefType = &userspaceCall;                       /* SBSW_OS_PWA_LOCAL */
+
+      /* #40 Trigger trap. */
+      Os_Hal_Trap(&packet);                                                                                             /* SBSW_OS_FC_POINTER2LOCAL */
+
+      /* #50 Unmarshal return value. */
+      (*Call) = *((volatile Os_AsyncCallType*)&userspaceCall);                                                          /* SBSW_OS_TRAP_API_USERPOINTER_002 */
+      status = packet.ReturnValue.ReturnOs_StatusType;
+    }
+    /* #60 Otherwise: */
+    else
+    {
+      /* #70 Call the API directly. */
+      status = Os_TrapCallGetAlarmAsync(AlarmID, Mask, Call);                                                           /* SBSW_OS_TRAP_API_USERPOINTER_001 */
+    }
   }
 
-  return result;
+  return Os_ErrReportGetAlarmAsync(status, AlarmID, Mask, Call);                                                        /* SBSW_OS_TRAP_ERRREPORT_001 */
 }                                                                                                                       /* PRQA S 6050 */ /* MD_MSR_STCAL */
 
 
-
 /***********************************************************************************************************************
- *  Os_GetISRStackUsage()
+ *  Os_GetCounterValueAsync()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -8219,42 +9787,58 @@ FUNC(uint32, OS_CODE) Os_GetTaskStackUsage
  *
  *
  *
+ *
  */
-FUNC(uint32, OS_CODE) Os_GetISRStackUsage
+FUNC(StatusType, OS_CODE) Os_GetCounterValueAsync
 (
-  ISRType IsrID
+  CounterType CounterID,
+  EventMaskType Mask,
+  Os_AsyncCallRefType Call
 )
 {
-  uint32 result;
+  Os_StatusType status;
 
-  /* #10 If a trap is needed: */
-  if(Os_TrapIsTrapForWriteAccessRequired() != 0u)                                                                       /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */
+  /* #10 Check that the given pointer is valid. */
+  if(OS_UNLIKELY(Os_ErrCheckPointerIsNotNull(Call) == OS_CHECK_FAILED))                                                 /* PRQA S 0315 */ /* MD_Os_Dir1.1_0315 */ /* SBSW_OS_TRAP_ERRCHECKPOINTERISNOTNULL_001 */
   {
-    Os_TrapPacketType packet;
-
-    /* #20 Marshal API data. */
-    packet.TrapId = OS_TRAPID_GETISRSTACKUSAGE;
-    packet.Parameters[OS_TRAPPARAMINDEX_1].ParamApiType.ParamISRType = IsrID;                                           /* SBSW_OS_PWA_LOCAL */
-
-    /* #30 Trigger trap. */
-    Os_Hal_Trap(&packet);                                                                                               /* SBSW_OS_FC_POINTER2LOCAL */
-
-    /* #40 Unmarshal return value. */
-    result = packet.ReturnValue.ReturnUint32Type;
+    status = OS_STATUS_PARAM_POINTER_3;
   }
-  /* #50 Otherwise: */
   else
   {
-    /* #60 Call the API directly. */
-    result = Os_TrapCallGetISRStackUsage(IsrID);
+    /* #20 If a trap is needed: */
+    if(Os_TrapIsTrapForWriteAccessRequired() != 0u)                                                                     /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */
+    {
+      Os_TrapPacketType packet;
+      Os_AsyncCallType userspaceCall;
+
+      /* #30 Marshal API data. The handle is copied in both directions. */
+      userspaceCall = (*Call);
+      packet.TrapId = OS_TRAPID_GETCOUNTERVALUEASYNC;
+      packet.Parameters[OS_TRAPPARAMINDEX_1].ParamApiType.ParamCounterType = CounterID;                                 /* SBSW_OS_PWA_LOCAL */
+      packet.Parameters[OS_TRAPPARAMINDEX_2].ParamApiType.ParamEventMaskType = Mask;                                    /* SBSW_OS_PWA_LOCAL */
+      packet.Parameters[OS_TRAPPARAMINDEX_3].ParamApiType.ParamAsyncCallRefType = &userspaceCall;                       /* SBSW_OS_PWA_LOCAL */
+
+      /* #40 Trigger trap. */
+      Os_Hal_Trap(&packet);                                                                                             /* SBSW_OS_FC_POINTER2LOCAL */
+
+      /* #50 Unmarshal return value. */
+      (*Call) = *((volatile Os_AsyncCallType*)&userspaceCall);                                                          /* SBSW_OS_TRAP_API_USERPOINTER_002 */
+      status = packet.ReturnValue.ReturnOs_StatusType;
+    }
+    /* #60 Otherwise: */
+    else
+    {
+      /* #70 Call the API directly. */
+      status = Os_TrapCallGetCounterValueAsync(CounterID, Mask, Call);                                                  /* SBSW_OS_TRAP_API_USERPOINTER_001 */
+    }
   }
 
-  return result;
+  return Os_ErrReportGetCounterValueAsync(status, CounterID, Mask, Call);                                               /* SBSW_OS_TRAP_ERRREPORT_001 */
 }                                                                                                                       /* PRQA S 6050 */ /* MD_MSR_STCAL */
 
 
 /***********************************************************************************************************************
- *  Os_GetKernelStackUsage()
+ *  Os_GetAsyncCallResult()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -8265,42 +9849,53 @@ FUNC(uint32, OS_CODE) Os_GetISRStackUsage
  *
  *
  *
+ *
  */
-FUNC(uint32, OS_CODE) Os_GetKernelStackUsage
+FUNC(StatusType, OS_CODE) Os_GetAsyncCallResult
 (
-  CoreIdType CoreID
+  Os_AsyncCallRefType Call
 )
 {
-  uint32 result;
+  Os_StatusType status;
 
-  /* #10 If a trap is needed: */
-  if(Os_TrapIsTrapForWriteAccessRequired() != 0u)                                                                       /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */
+  /* #10 Check that the given pointer is valid. */
+  if(OS_UNLIKELY(Os_ErrCheckPointerIsNotNull(Call) == OS_CHECK_FAILED))                                                 /* PRQA S 0315 */ /* MD_Os_Dir1.1_0315 */ /* SBSW_OS_TRAP_ERRCHECKPOINTERISNOTNULL_001 */
   {
-    Os_TrapPacketType packet;
-
-    /* #20 Marshal API data. */
-    packet.TrapId = OS_TRAPID_GETKERNELSTACKUSAGE;
-    packet.Parameters[OS_TRAPPARAMINDEX_1].ParamApiType.ParamCoreIdType = CoreID;                                       /* SBSW_OS_PWA_LOCAL */
-
-    /* #30 Trigger trap. */
-    Os_Hal_Trap(&packet);                                                                                               /* SBSW_OS_FC_POINTER2LOCAL */
-
-    /* #40 Unmarshal return value. */
-    result = packet.ReturnValue.ReturnUint32Type;
+    status = OS_STATUS_PARAM_POINTER_1;
   }
-  /* #50 Otherwise: */
   else
   {
-    /* #60 Call the API directly. */
-    result = Os_TrapCallGetKernelStackUsage(CoreID);
+    /* #20 If a trap is needed: */
+    if(Os_TrapIsTrapForWriteAccessRequired() != 0u)                                                                     /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */
+    {
+      Os_TrapPacketType packet;
+      Os_AsyncCallType userspaceCall;
+
+      /* #30 Marshal API data. The handle is copied in both directions. */
+      userspaceCall = (*Call);
+      packet.TrapId = OS_TRAPID_GETASYNCCALLRESULT;
+      packet.Parameters[OS_TRAPPARAMINDEX_1].ParamApiType.ParamAsyncCallRefType = &userspaceCall;                       /* SBSW_OS_PWA_LOCAL */
+
+      /* #40 Trigger trap. */
+      Os_Hal_Trap(&packet);                                                                                             /* SBSW_OS_FC_POINTER2LOCAL */
+
+      /* #50 Unmarshal return value. */
+      (*Call) = *((volatile Os_AsyncCallType*)&userspaceCall);                                                          /* SBSW_OS_TRAP_API_USERPOINTER_002 */
+      status = packet.ReturnValue.ReturnOs_StatusType;
+    }
+    /* #60 Otherwise: */
+    else
+    {
+      /* #70 Call the API directly. */
+      status = Os_TrapCallGetAsyncCallResult(Call);                                                                     /* SBSW_OS_TRAP_API_USERPOINTER_001 */
+    }
   }
 
-  return result;
+  return Os_ErrReportGetAsyncCallResult(status, Call);                                                                  /* SBSW_OS_TRAP_ERRREPORT_001 */
 }                                                                                                                       /* PRQA S 6050 */ /* MD_MSR_STCAL */
 
-
 /***********************************************************************************************************************
- *  Os_GetStartupHookStackUsage()
+ *  Os_GetTaskAccounting()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -8311,42 +9906,54 @@ FUNC(uint32, OS_CODE) Os_GetKernelStackUsage
  *
  *
  *
+ *
  */
-FUNC(uint32, OS_CODE) Os_GetStartupHookStackUsage
+FUNC(StatusType, OS_CODE) Os_GetTaskAccounting
 (
-  CoreIdType CoreID
+  TaskType TaskID,
+  Os_ThreadAccountingRefType Accounting
 )
 {
-  uint32 result;
+  Os_StatusType status;
 
-  /* #10 If a trap is needed: */
-  if(Os_TrapIsTrapForWriteAccessRequired() != 0u)                                                                       /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */
+  /* #10 Check that the given pointer is valid. */
+  if(OS_UNLIKELY(Os_ErrCheckPointerIsNotNull(Accounting) == OS_CHECK_FAILED))                                           /* PRQA S 0315 */ /* MD_Os_Dir1.1_0315 */ /* SBSW_OS_TRAP_ERRCHECKPOINTERISNOTNULL_001 */
   {
-    Os_TrapPacketType packet;
-
-    /* #20 Marshal API data. */
-    packet.TrapId = OS_TRAPID_GETSTARTUPHOOKSTACKUSAGE;
-    packet.Parameters[OS_TRAPPARAMINDEX_1].ParamApiType.ParamCoreIdType = CoreID;                                       /* SBSW_OS_PWA_LOCAL */
-
-    /* #30 Trigger trap. */
-    Os_Hal_Trap(&packet);                                                                                               /* SBSW_OS_FC_POINTER2LOCAL */
-
-    /* #40 Unmarshal return value. */
-    result = packet.ReturnValue.ReturnUint32Type;
+    status = OS_STATUS_PARAM_POINTER_2;
   }
-  /* #50 Otherwise: */
   else
   {
-    /* #60 Call the API directly. */
-    result = Os_TrapCallGetStartupHookStackUsage(CoreID);
+    /* #20 If a trap is needed: */
+    if(Os_TrapIsTrapForWriteAccessRequired() != 0u)                                                                     /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */
+    {
+      Os_TrapPacketType packet;
+      Os_ThreadAccountingType userspaceAccounting;
+
+      /* #30 Marshal API data. */
+      packet.TrapId = OS_TRAPID_GETTASKACCOUNTING;
+      packet.Parameters[OS_TRAPPARAMINDEX_1].ParamApiType.ParamTaskType = TaskID;                                       /* SBSW_OS_PWA_LOCAL */
+      packet.Parameters[OS_TRAPPARAMINDEX_2].ParamApiType.ParamThreadAccountingRefType = &userspaceAccounting;          /* SBSW_OS_PWA_LOCAL */
+
+      /* #40 Trigger trap. */
+      Os_Hal_Trap(&packet);                                                                                             /* SBSW_OS_FC_POINTER2LOCAL */
+
+      /* #50 Unmarshal return value. */
+      (*Accounting) = *((volatile Os_ThreadAccountingType*)&userspaceAccounting);                                       /* SBSW_OS_TRAP_API_USERPOINTER_002 */
+      status = packet.ReturnValue.ReturnOs_StatusType;
+    }
+    /* #60 Otherwise: */
+    else
+    {
+      /* #70 Call the API directly. */
+      status = Os_TrapCallGetTaskAccounting(TaskID, Accounting);                                                        /* SBSW_OS_TRAP_API_USERPOINTER_001 */
+    }
   }
 
-  return result;
+  return Os_ErrReportGetTaskAccounting(status, TaskID, Accounting);                                                     /* SBSW_OS_TRAP_ERRREPORT_001 */
 }                                                                                                                       /* PRQA S 6050 */ /* MD_MSR_STCAL */
 
-
 /***********************************************************************************************************************
- *  Os_GetErrorHookStackUsage()
+ *  Os_GetISRAccounting()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -8357,42 +9964,55 @@ FUNC(uint32, OS_CODE) Os_GetStartupHookStackUsage
  *
  *
  *
+ *
  */
-FUNC(uint32, OS_CODE) Os_GetErrorHookStackUsage
+FUNC(StatusType, OS_CODE) Os_GetISRAccounting
 (
-  CoreIdType CoreID
+  ISRType ISRID,
+  Os_ThreadAccountingRefType Accounting
 )
 {
-  uint32 result;
+  Os_StatusType status;
 
-  /* #10 If a trap is needed: */
-  if(Os_TrapIsTrapForWriteAccessRequired() != 0u)                                                                       /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */
+  /* #10 Check that the given pointer is valid. */
+  if(OS_UNLIKELY(Os_ErrCheckPointerIsNotNull(Accounting) == OS_CHECK_FAILED))                                           /* PRQA S 0315 */ /* MD_Os_Dir1.1_0315 */ /* SBSW_OS_TRAP_ERRCHECKPOINTERISNOTNULL_001 */
   {
-    Os_TrapPacketType packet;
-
-    /* #20 Marshal API data. */
-    packet.TrapId = OS_TRAPID_GETERRORHOOKSTACKUSAGE;
-    packet.Parameters[OS_TRAPPARAMINDEX_1].ParamApiType.ParamCoreIdType = CoreID;                                       /* SBSW_OS_PWA_LOCAL */
-
-    /* #30 Trigger trap. */
-    Os_Hal_Trap(&packet);                                                                                               /* SBSW_OS_FC_POINTER2LOCAL */
-
-    /* #40 Unmarshal return value. */
-    result = packet.ReturnValue.ReturnUint32Type;
+    status = OS_STATUS_PARAM_POINTER_2;
   }
-  /* #50 Otherwise: */
   else
   {
-    /* #60 Call the API directly. */
-    result = Os_TrapCallGetErrorHookStackUsage(CoreID);
+    /* #20 If a trap is needed: */
+    if(Os_TrapIsTrapForWriteAccessRequired() != 0u)                                                                     /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */
+    {
+      Os_TrapPacketType packet;
+      Os_ThreadAccountingType userspaceAccounting;
+
+      /* #30 Marshal API data. */
+      packet.TrapId = OS_TRAPID_GETISRACCOUNTING;
+      packet.Parameters[OS_TRAPPARAMINDEX_1].ParamApiType.ParamISRType = ISRID;                                         /* SBSW_OS_PWA_LOCAL */
+      packet.Parameters[OS_TRAPPARAMINDEX_2].ParamApiType.ParamThreadAccountingRefType = &userspaceAccounting;          /* SBSW_OS_PWA_LOCAL */
+
+      /* #40 Trigger trap. */
+      Os_Hal_Trap(&packet);                                                                                             /* SBSW_OS_FC_POINTER2LOCAL */
+
+      /* #50 Unmarshal return value. */
+      (*Accounting) = *((volatile Os_ThreadAccountingType*)&userspaceAccounting);                                       /* SBSW_OS_TRAP_API_USERPOINTER_002 */
+      status = packet.ReturnValue.ReturnOs_StatusType;
+    }
+    /* #60 Otherwise: */
+    else
+    {
+      /* #70 Call the API directly. */
+      status = Os_TrapCallGetISRAccounting(ISRID, Accounting);                                                          /* SBSW_OS_TRAP_API_USERPOINTER_001 */
+    }
   }
 
-  return result;
+  return Os_ErrReportGetISRAccounting(status, ISRID, Accounting);                                                       /* SBSW_OS_TRAP_ERRREPORT_001 */
 }                                                                                                                       /* PRQA S 6050 */ /* MD_MSR_STCAL */
 
 
 /***********************************************************************************************************************
- *  Os_GetShutdownHookStackUsage()
+ *  Os_ScanStackUsage()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -8402,14 +10022,13 @@ FUNC(uint32, OS_CODE) Os_GetErrorHookStackUsage
  *
  *
  *
- *
  */
-FUNC(uint32, OS_CODE) Os_GetShutdownHookStackUsage
+FUNC(StatusType, OS_CODE) Os_ScanStackUsage
 (
-  CoreIdType CoreID
+  void
 )
 {
-  uint32 result;
+  Os_StatusType status;
 
   /* #10 If a trap is needed: */
   if(Os_TrapIsTrapForWriteAccessRequired() != 0u)                                                                       /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */
@@ -8417,28 +10036,27 @@ FUNC(uint32, OS_CODE) Os_GetShutdownHookStackUsage
     Os_TrapPacketType packet;
 
     /* #20 Marshal API data. */
-    packet.TrapId = OS_TRAPID_GETSHUTDOWNHOOKSTACKUSAGE;
-    packet.Parameters[OS_TRAPPARAMINDEX_1].ParamApiType.ParamCoreIdType = CoreID;                                       /* SBSW_OS_PWA_LOCAL */
+    packet.TrapId = OS_TRAPID_SCANSTACKUSAGE;
 
     /* #30 Trigger trap. */
     Os_Hal_Trap(&packet);                                                                                               /* SBSW_OS_FC_POINTER2LOCAL */
 
     /* #40 Unmarshal return value. */
-    result = packet.ReturnValue.ReturnUint32Type;
+    status = packet.ReturnValue.ReturnOs_StatusType;
   }
   /* #50 Otherwise: */
   else
   {
     /* #60 Call the API directly. */
-    result = Os_TrapCallGetShutdownHookStackUsage(CoreID);
+    status = Os_TrapCallScanStackUsage();
   }
 
-  return result;
+  return Os_ErrReportScanStackUsage(status);
 }                                                                                                                       /* PRQA S 6050 */ /* MD_MSR_STCAL */
 
 
 /***********************************************************************************************************************
- *  Os_GetProtectionHookStackUsage()
+ *  Os_GetNtfStackPoolStatistics()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -8449,42 +10067,55 @@ FUNC(uint32, OS_CODE) Os_GetShutdownHookStackUsage
  *
  *
  *
+ *
  */
-FUNC(uint32, OS_CODE) Os_GetProtectionHookStackUsage
+FUNC(StatusType, OS_CODE) Os_GetNtfStackPoolStatistics
 (
-  CoreIdType CoreID
+  Os_NonTrustedFunctionIndexType FunctionIndex,
+  Os_NtfStackPoolStatisticsRefType Statistics
 )
 {
-  uint32 result;
+  Os_StatusType status;
 
-  /* #10 If a trap is needed: */
-  if(Os_TrapIsTrapForWriteAccessRequired() != 0u)                                                                       /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */
+  /* #10 Check that the given pointer is valid. */
+  if(OS_UNLIKELY(Os_ErrCheckPointerIsNotNull(Statistics) == OS_CHECK_FAILED))                                           /* PRQA S 0315 */ /* MD_Os_Dir1.1_0315 */ /* SBSW_OS_TRAP_ERRCHECKPOINTERISNOTNULL_001 */
   {
-    Os_TrapPacketType packet;
-
-    /* #20 Marshal API data. */
-    packet.TrapId = OS_TRAPID_GETPROTECTIONHOOKSTACKUSAGE;
-    packet.Parameters[OS_TRAPPARAMINDEX_1].ParamApiType.ParamCoreIdType = CoreID;                                       /* SBSW_OS_PWA_LOCAL */
-
-    /* #30 Trigger trap. */
-    Os_Hal_Trap(&packet);                                                                                               /* SBSW_OS_FC_POINTER2LOCAL */
-
-    /* #40 Unmarshal return value. */
-    result = packet.ReturnValue.ReturnUint32Type;
+    status = OS_STATUS_PARAM_POINTER_2;
   }
-  /* #50 Otherwise: */
   else
   {
-    /* #60 Call the API directly. */
-    result = Os_TrapCallGetProtectionHookStackUsage(CoreID);
+    /* #20 If a trap is needed: */
+    if(Os_TrapIsTrapForWriteAccessRequired() != 0u)                                                                     /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */
+    {
+      Os_TrapPacketType packet;
+      Os_NtfStackPoolStatisticsType userspaceStatistics;
+
+      /* #30 Marshal API data. */
+      packet.TrapId = OS_TRAPID_GETNTFSTACKPOOLSTATISTICS;
+      packet.Parameters[OS_TRAPPARAMINDEX_1].ParamApiType.ParamOs_NonTrustedFunctionIndexType = FunctionIndex;          /* SBSW_OS_PWA_LOCAL */
+      packet.Parameters[OS_TRAPPARAMINDEX_2].ParamApiType.ParamNtfStackPoolStatisticsRefType = &userspaceStatistics;    /* SBSW_OS_PWA_LOCAL */
+
+      /* #40 Trigger trap. */
+      Os_Hal_Trap(&packet);                                                                                             /* SBSW_OS_FC_POINTER2LOCAL */
+
+      /* #50 Unmarshal return value. */
+      (*Statistics) = *((volatile Os_NtfStackPoolStatisticsType*)&userspaceStatistics);                                 /* SBSW_OS_TRAP_API_USERPOINTER_002 */
+      status = packet.ReturnValue.ReturnOs_StatusType;
+    }
+    /* #60 Otherwise: */
+    else
+    {
+      /* #70 Call the API directly. */
+      status = Os_TrapCallGetNtfStackPoolStatistics(FunctionIndex, Statistics);                                         /* SBSW_OS_TRAP_API_USERPOINTER_001 */
+    }
   }
 
-  return result;
+  return Os_ErrReportGetNtfStackPoolStatistics(status, FunctionIndex, Statistics);                                      /* SBSW_OS_TRAP_ERRREPORT_001 */
 }                                                                                                                       /* PRQA S 6050 */ /* MD_MSR_STCAL */
 
 
 /***********************************************************************************************************************
- *  Os_GetNonTrustedFunctionStackUsage()
+ *  Os_ActivateTaskSet()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -8496,12 +10127,12 @@ FUNC(uint32, OS_CODE) Os_GetProtectionHookStackUsage
  *
  *
  */
-FUNC(uint32, OS_CODE) Os_GetNonTrustedFunctionStackUsage
+FUNC(StatusType, OS_CODE) Os_ActivateTaskSet
 (
-  Os_NonTrustedFunctionIndexType FunctionIndex
+  Os_TaskSetIdType TaskSetID
 )
 {
-  uint32 result;
+  Os_StatusType status;
 
   /* #10 If a trap is needed: */
   if(Os_TrapIsTrapForWriteAccessRequired() != 0u)                                                                       /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */
@@ -8509,94 +10140,70 @@ FUNC(uint32, OS_CODE) Os_GetNonTrustedFunctionStackUsage
     Os_TrapPacketType packet;
 
     /* #20 Marshal API data. */
-    packet.TrapId = OS_TRAPID_GETNONTRUSTEDFUNCTIONSTACKUSAGE;
-    packet.Parameters[OS_TRAPPARAMINDEX_1].ParamApiType.ParamOs_NonTrustedFunctionIndexType = FunctionIndex;            /* SBSW_OS_PWA_LOCAL */
+    packet.TrapId = OS_TRAPID_ACTIVATETASKSET;
+    packet.Parameters[OS_TRAPPARAMINDEX_1].ParamApiType.ParamTaskSetIdType = TaskSetID;                                 /* SBSW_OS_PWA_LOCAL */
 
     /* #30 Trigger trap. */
     Os_Hal_Trap(&packet);                                                                                               /* SBSW_OS_FC_POINTER2LOCAL */
 
     /* #40 Unmarshal return value. */
-    result = packet.ReturnValue.ReturnUint32Type;
+    status = packet.ReturnValue.ReturnOs_StatusType;
   }
   /* #50 Otherwise: */
   else
   {
     /* #60 Call the API directly. */
-    result = Os_TrapCallGetNonTrustedFunctionStackUsage(FunctionIndex);
+    status = Os_TrapCallActivateTaskSet(TaskSetID);
   }
 
-  return result;
+  return Os_ErrReportActivateTaskSet(status, TaskSetID);
 }                                                                                                                       /* PRQA S 6050 */ /* MD_MSR_STCAL */
 
 
 /***********************************************************************************************************************
- *  GetSpinlock()
+ *  Os_GetMpSkippedSwitches()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
  *
  *
- */
-FUNC(StatusType, OS_CODE) GetSpinlock(SpinlockIdType SpinlockId)
-{
-  Os_StatusType status;
-
-  /* #10 Spinlock API call is configurable. Spinlock module handles whether trap is needed or not. */
-  status = Os_Api_GetSpinlock(SpinlockId);
-
-  return Os_ErrReportGetSpinlock(status, SpinlockId);
-}
-
-
-/***********************************************************************************************************************
- *  ReleaseSpinlock()
- **********************************************************************************************************************/
-/*!
- * Internal comment removed.
  *
  *
- */
-FUNC(StatusType, OS_CODE) ReleaseSpinlock(SpinlockIdType SpinlockId)
-{
-  Os_StatusType status;
-
-  /* #10 Spinlock API call is configurable. Spinlock module handles whether trap is needed or not. */
-  status = Os_Api_ReleaseSpinlock(SpinlockId);
-
-  return Os_ErrReportReleaseSpinlock(status, SpinlockId);
-}
-
-
-/***********************************************************************************************************************
- *  TryToGetSpinlock()
- **********************************************************************************************************************/
-/*!
- * Internal comment removed.
  *
  *
  *
  */
-FUNC(StatusType, OS_CODE) TryToGetSpinlock
+FUNC(uint32, OS_CODE) Os_GetMpSkippedSwitches
 (
-  SpinlockIdType SpinlockId,
-  TryToGetSpinlockType* Success
+  CoreIdType CoreID
 )
 {
-  Os_StatusType status;
+  uint32 result;
 
-  /* #10 Check that the given pointer is valid. */
-  if(OS_UNLIKELY(Os_ErrCheckPointerIsNotNull(Success) == OS_CHECK_FAILED))                                              /* PRQA S 0315 */ /* MD_Os_Dir1.1_0315 */ /* SBSW_OS_TRAP_ERRCHECKPOINTERISNOTNULL_001 */
+  /* #10 If a trap is needed: */
+  if(Os_TrapIsTrapForWriteAccessRequired() != 0u)                                                                       /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */
   {
-    status = OS_STATUS_PARAM_POINTER_2;
+    Os_TrapPacketType packet;
+
+    /* #20 Marshal API data. */
+    packet.TrapId = OS_TRAPID_GETMPSKIPPEDSWITCHES;
+    packet.Parameters[OS_TRAPPARAMINDEX_1].ParamApiType.ParamCoreIdType = CoreID;                                       /* SBSW_OS_PWA_LOCAL */
+
+    /* #30 Trigger trap. */
+    Os_Hal_Trap(&packet);                                                                                               /* SBSW_OS_FC_POINTER2LOCAL */
+
+    /* #40 Unmarshal return value. */
+    result = packet.ReturnValue.ReturnUint32Type;
   }
+  /* #50 Otherwise: */
   else
   {
-    /* #20 Otherwise call the API. */
-    status = Os_Api_TryToGetSpinlock(SpinlockId, Success);                                                              /* SBSW_OS_TRAP_API_USERPOINTER_001 */
+    /* #60 Call the API directly. */
+    result = Os_TrapCallGetMpSkippedSwitches(CoreID);
   }
 
-  return Os_ErrReportTryToGetSpinlock(status, SpinlockId, Success);                                                     /* SBSW_OS_TRAP_ERRREPORT_001 */
-}
+  return result;
+}                                                                                                                       /* PRQA S 6050 */ /* MD_MSR_STCAL */
 
 
 /***********************************************************************************************************************
@@ -13467,6 +15074,26 @@ FUNC(void, OS_CODE) Os_TrapHandler
             );
         break;
 
+      case OS_TRAPID_IOC08RECEIVEN:
+        Packet->ReturnValue.ReturnStd_ReturnType =                                                                      /* SBSW_OS_PWA_PRECONDITION */
+            Os_Ioc08ReceiveN(                                                                                           /* SBSW_OS_FC_PRECONDITION */
+                Packet->Parameters[OS_TRAPPARAMINDEX_1].ParamIoc08ReceiveConfigRefType,
+                Packet->Parameters[OS_TRAPPARAMINDEX_2].ParamUint8RefType,
+                Packet->Parameters[OS_TRAPPARAMINDEX_3].ParamUint32Type,
+                Packet->Parameters[OS_TRAPPARAMINDEX_4].ParamUint32RefType
+            );
+        break;
+
+      case OS_TRAPID_IOC08SENDN:
+        Packet->ReturnValue.ReturnStd_ReturnType =                                                                      /* SBSW_OS_PWA_PRECONDITION */
+            Os_Ioc08SendN(                                                                                              /* SBSW_OS_FC_PRECONDITION */
+                Packet->Parameters[OS_TRAPPARAMINDEX_1].ParamIoc08SendConfigRefType,
+                Packet->Parameters[OS_TRAPPARAMINDEX_2].ParamConstUint8RefType,
+                Packet->Parameters[OS_TRAPPARAMINDEX_3].ParamUint32Type,
+                Packet->Parameters[OS_TRAPPARAMINDEX_4].ParamUint32RefType
+            );
+        break;
+
       case OS_TRAPID_IOC16RECEIVE:
         Packet->ReturnValue.ReturnStd_ReturnType =                                                                      /* SBSW_OS_PWA_PRECONDITION */
             Os_Ioc16Receive(                                                                                            /* SBSW_OS_FC_PRECONDITION */
@@ -13490,6 +15117,26 @@ FUNC(void, OS_CODE) Os_TrapHandler
             );
         break;
 
+      case OS_TRAPID_IOC16RECEIVEN:
+        Packet->ReturnValue.ReturnStd_ReturnType =                                                                      /* SBSW_OS_PWA_PRECONDITION */
+            Os_Ioc16ReceiveN(                                                                                           /* SBSW_OS_FC_PRECONDITION */
+                Packet->Parameters[OS_TRAPPARAMINDEX_1].ParamIoc16ReceiveConfigRefType,
+                Packet->Parameters[OS_TRAPPARAMINDEX_2].ParamUint16RefType,
+                Packet->Parameters[OS_TRAPPARAMINDEX_3].ParamUint32Type,
+                Packet->Parameters[OS_TRAPPARAMINDEX_4].ParamUint32RefType
+            );
+        break;
+
+      case OS_TRAPID_IOC16SENDN:
+        Packet->ReturnValue.ReturnStd_ReturnType =                                                                      /* SBSW_OS_PWA_PRECONDITION */
+            Os_Ioc16SendN(                                                                                              /* SBSW_OS_FC_PRECONDITION */
+                Packet->Parameters[OS_TRAPPARAMINDEX_1].ParamIoc16SendConfigRefType,
+                Packet->Parameters[OS_TRAPPARAMINDEX_2].ParamConstUint16RefType,
+                Packet->Parameters[OS_TRAPPARAMINDEX_3].ParamUint32Type,
+                Packet->Parameters[OS_TRAPPARAMINDEX_4].ParamUint32RefType
+            );
+        break;
+
       case OS_TRAPID_IOC32RECEIVE:
         Packet->ReturnValue.ReturnStd_ReturnType =                                                                      /* SBSW_OS_PWA_PRECONDITION */
             Os_Ioc32Receive(                                                                                            /* SBSW_OS_FC_PRECONDITION */
@@ -13513,6 +15160,26 @@ FUNC(void, OS_CODE) Os_TrapHandler
             );
         break;
 
+      case OS_TRAPID_IOC32RECEIVEN:
+        Packet->ReturnValue.ReturnStd_ReturnType =                                                                      /* SBSW_OS_PWA_PRECONDITION */
+            Os_Ioc32ReceiveN(                                                                                           /* SBSW_OS_FC_PRECONDITION */
+                Packet->Parameters[OS_TRAPPARAMINDEX_1].ParamIoc32ReceiveConfigRefType,
+                Packet->Parameters[OS_TRAPPARAMINDEX_2].ParamUint32RefType,
+                Packet->Parameters[OS_TRAPPARAMINDEX_3].ParamUint32Type,
+                Packet->Parameters[OS_TRAPPARAMINDEX_4].ParamUint32RefType
+            );
+        break;
+
+      case OS_TRAPID_IOC32SENDN:
+        Packet->ReturnValue.ReturnStd_ReturnType =                                                                      /* SBSW_OS_PWA_PRECONDITION */
+            Os_Ioc32SendN(                                                                                              /* SBSW_OS_FC_PRECONDITION */
+                Packet->Parameters[OS_TRAPPARAMINDEX_1].ParamIoc32SendConfigRefType,
+                Packet->Parameters[OS_TRAPPARAMINDEX_2].ParamConstUint32RefType,
+                Packet->Parameters[OS_TRAPPARAMINDEX_3].ParamUint32Type,
+                Packet->Parameters[OS_TRAPPARAMINDEX_4].ParamUint32RefType
+            );
+        break;
+
       case OS_TRAPID_IOCREFRECEIVE:                                                                                     /* COV_OS_HALPLATFORMTESTEDASMULTICORE */
         Packet->ReturnValue.ReturnStd_ReturnType =                                                                      /* SBSW_OS_PWA_PRECONDITION */
             Os_IocRefReceive(                                                                                           /* SBSW_OS_FC_PRECONDITION */
@@ -13802,6 +15469,91 @@ FUNC(void, OS_CODE) Os_TrapHandler
             );
         break;
 
+      case OS_TRAPID_GETSPINLOCKSTATISTICS:
+        Packet->ReturnValue.ReturnOs_StatusType =                                                                       /* SBSW_OS_PWA_PRECONDITION */
+            Os_TrapCallGetSpinlockStatistics(                                                                           /* SBSW_OS_FC_PRECONDITION */
+                Packet->Parameters[OS_TRAPPARAMINDEX_1].ParamApiType.ParamSpinlockIdType,
+                Packet->Parameters[OS_TRAPPARAMINDEX_2].ParamApiType.ParamCoreIdType,
+                Packet->Parameters[OS_TRAPPARAMINDEX_3].ParamApiType.ParamSpinlockStatisticsRefType
+            );
+        break;
+
+      case OS_TRAPID_GETTASKSTATEASYNC:
+        Packet->ReturnValue.ReturnOs_StatusType =                                                                       /* SBSW_OS_PWA_PRECONDITION */
+            Os_TrapCallGetTaskStateAsync(                                                                               /* SBSW_OS_FC_PRECONDITION */
+                Packet->Parameters[OS_TRAPPARAMINDEX_1].ParamApiType.ParamTaskType,
+                Packet->Parameters[OS_TRAPPARAMINDEX_2].ParamApiType.ParamEventMaskType,
+                Packet->Parameters[OS_TRAPPARAMINDEX_3].ParamApiType.ParamAsyncCallRefType
+            );
+        break;
+
+      case OS_TRAPID_GETALARMASYNC:
+        Packet->ReturnValue.ReturnOs_StatusType =                                                                       /* SBSW_OS_PWA_PRECONDITION */
+            Os_TrapCallGetAlarmAsync(                                                                                   /* SBSW_OS_FC_PRECONDITION */
+                Packet->Parameters[OS_TRAPPARAMINDEX_1].ParamApiType.ParamAlarmType,
+                Packet->Parameters[OS_TRAPPARAMINDEX_2].ParamApiType.ParamEventMaskType,
+                Packet->Parameters[OS_TRAPPARAMINDEX_3].ParamApiType.ParamAsyncCallRefType
+            );
+        break;
+
+      case OS_TRAPID_GETCOUNTERVALUEASYNC:
+        Packet->ReturnValue.ReturnOs_StatusType =                                                                       /* SBSW_OS_PWA_PRECONDITION */
+            Os_TrapCallGetCounterValueAsync(                                                                            /* SBSW_OS_FC_PRECONDITION */
+                Packet->Parameters[OS_TRAPPARAMINDEX_1].ParamApiType.ParamCounterType,
+                Packet->Parameters[OS_TRAPPARAMINDEX_2].ParamApiType.ParamEventMaskType,
+                Packet->Parameters[OS_TRAPPARAMINDEX_3].ParamApiType.ParamAsyncCallRefType
+            );
+        break;
+
+      case OS_TRAPID_GETASYNCCALLRESULT:
+        Packet->ReturnValue.ReturnOs_StatusType =                                                                       /* SBSW_OS_PWA_PRECONDITION */
+            Os_TrapCallGetAsyncCallResult(                                                                              /* SBSW_OS_FC_PRECONDITION */
+                Packet->Parameters[OS_TRAPPARAMINDEX_1].ParamApiType.ParamAsyncCallRefType
+            );
+        break;
+
+      case OS_TRAPID_GETTASKACCOUNTING:
+        Packet->ReturnValue.ReturnOs_StatusType =                                                                       /* SBSW_OS_PWA_PRECONDITION */
+            Os_TrapCallGetTaskAccounting(                                                                               /* SBSW_OS_FC_PRECONDITION */
+                Packet->Parameters[OS_TRAPPARAMINDEX_1].ParamApiType.ParamTaskType,
+                Packet->Parameters[OS_TRAPPARAMINDEX_2].ParamApiType.ParamThreadAccountingRefType
+            );
+        break;
+
+      case OS_TRAPID_GETISRACCOUNTING:
+        Packet->ReturnValue.ReturnOs_StatusType =                                                                       /* SBSW_OS_PWA_PRECONDITION */
+            Os_TrapCallGetISRAccounting(                                                                                /* SBSW_OS_FC_PRECONDITION */
+                Packet->Parameters[OS_TRAPPARAMINDEX_1].ParamApiType.ParamISRType,
+                Packet->Parameters[OS_TRAPPARAMINDEX_2].ParamApiType.ParamThreadAccountingRefType
+            );
+        break;
+
+      case OS_TRAPID_SCANSTACKUSAGE:
+        Packet->ReturnValue.ReturnOs_StatusType = Os_TrapCallScanStackUsage();                                          /* SBSW_OS_PWA_PRECONDITION */
+        break;
+
+      case OS_TRAPID_GETNTFSTACKPOOLSTATISTICS:
+        Packet->ReturnValue.ReturnOs_StatusType =                                                                       /* SBSW_OS_PWA_PRECONDITION */
+            Os_TrapCallGetNtfStackPoolStatistics(                                                                       /* SBSW_OS_FC_PRECONDITION */
+                Packet->Parameters[OS_TRAPPARAMINDEX_1].ParamApiType.ParamOs_NonTrustedFunctionIndexType,
+                Packet->Parameters[OS_TRAPPARAMINDEX_2].ParamApiType.ParamNtfStackPoolStatisticsRefType
+            );
+        break;
+
+      case OS_TRAPID_ACTIVATETASKSET:
+        Packet->ReturnValue.ReturnOs_StatusType =                                                                       /* SBSW_OS_PWA_PRECONDITION */
+            Os_TrapCallActivateTaskSet(
+                Packet->Parameters[OS_TRAPPARAMINDEX_1].ParamApiType.ParamTaskSetIdType
+            );
+        break;
+
+      case OS_TRAPID_GETMPSKIPPEDSWITCHES:
+        Packet->ReturnValue.ReturnUint32Type =                                                                          /* SBSW_OS_PWA_PRECONDITION */
+            Os_TrapCallGetMpSkippedSwitches(
+                Packet->Parameters[OS_TRAPPARAMINDEX_1].ParamApiType.ParamCoreIdType
+            );
+        break;
+
       case OS_TRAPID_GETUNHANDLEDIRQ:                                                                                   /* COV_OS_HALPLATFORMTESTEDASMULTICORE */
         Packet->ReturnValue.ReturnOs_StatusType =                                                                       /* SBSW_OS_PWA_PRECONDITION */
             Os_TrapCallGetUnhandledIrq(                                                                                 /* SBSW_OS_FC_PRECONDITION */
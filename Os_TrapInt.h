@@ -214,6 +214,23 @@ typedef enum
   OS_TRAPID_GETCORESTARTSTATE,
   OS_TRAPID_GETEXCEPTIONADDRESS,
   OS_TRAPID_GETNONTRUSTEDFUNCTIONSTACKUSAGE,
+  OS_TRAPID_GETSPINLOCKSTATISTICS,
+  OS_TRAPID_GETTASKSTATEASYNC,
+  OS_TRAPID_GETALARMASYNC,
+  OS_TRAPID_GETCOUNTERVALUEASYNC,
+  OS_TRAPID_GETASYNCCALLRESULT,
+  OS_TRAPID_GETTASKACCOUNTING,
+  OS_TRAPID_GETISRACCOUNTING,
+  OS_TRAPID_SCANSTACKUSAGE,
+  OS_TRAPID_GETNTFSTACKPOOLSTATISTICS,
+  OS_TRAPID_ACTIVATETASKSET,
+  OS_TRAPID_GETMPSKIPPEDSWITCHES,
+  OS_TRAPID_IOC08RECEIVEN,
+  OS_TRAPID_IOC08SENDN,
+  OS_TRAPID_IOC16RECEIVEN,
+  OS_TRAPID_IOC16SENDN,
+  OS_TRAPID_IOC32RECEIVEN,
+  OS_TRAPID_IOC32SENDN,
   OS_TRAPID_COUNT
 } Os_TrapIdType;
 
@@ -469,6 +486,74 @@ FUNC(Std_ReturnType, OS_CODE) Os_TrapIoc08Send
 );
 
 
+/***********************************************************************************************************************
+ *  Os_TrapIoc08ReceiveN()
+ **********************************************************************************************************************/
+/*! \brief        Reads up to Count items from the IOC.
+ *  \details      For further details see Os_Ioc08ReceiveN().
+ *
+ *  \param[in]      IsTrapRequired  Defines whether a trap is required:
+ *                                   - TRUE:  Trap is always performed.
+ *                                   - FALSE: Trap is performed, if supervisor mode is required by platform.
+ *  \param[in,out]  Ioc             See Os_Ioc08ReceiveN().
+ *  \param[out]     Data            See Os_Ioc08ReceiveN().
+ *  \param[in]      Count           See Os_Ioc08ReceiveN().
+ *  \param[out]     Received        See Os_Ioc08ReceiveN().
+ *
+ *  \retval       IOC_E_NOK   Received is a NULL_PTR.
+ *  \return       Otherwise see Os_Ioc08ReceiveN().
+ *
+ *  \context      ANY
+ *
+ *  \reentrant    TRUE for different objects.
+ *  \synchronous  TRUE
+ *
+ *  \pre          See Os_Ioc08ReceiveN().
+ **********************************************************************************************************************/
+FUNC(Std_ReturnType, OS_CODE) Os_TrapIoc08ReceiveN
+(
+  boolean IsTrapRequired,
+  P2CONST(Os_Ioc08ReceiveConfigType, TYPEDEF, OS_CONST) Ioc,
+  P2VAR(uint8, TYPEDEF, AUTOMATIC) Data,
+  uint32 Count,
+  P2VAR(uint32, TYPEDEF, AUTOMATIC) Received
+);
+
+
+/***********************************************************************************************************************
+ *  Os_TrapIoc08SendN()
+ **********************************************************************************************************************/
+/*! \brief        Writes up to Count items to the IOC.
+ *  \details      For further details see Os_Ioc08SendN().
+ *
+ *  \param[in]      IsTrapRequired  Defines whether a trap is required:
+ *                                   - TRUE:  Trap is always performed.
+ *                                   - FALSE: Trap is performed, if supervisor mode is required by platform.
+ *  \param[in,out]  Ioc             See Os_Ioc08SendN().
+ *  \param[in]      Data            See Os_Ioc08SendN().
+ *  \param[in]      Count           See Os_Ioc08SendN().
+ *  \param[out]     Sent            See Os_Ioc08SendN().
+ *
+ *  \retval       IOC_E_NOK   Sent is a NULL_PTR.
+ *  \return       Otherwise see Os_Ioc08SendN().
+ *
+ *  \context      ANY
+ *
+ *  \reentrant    TRUE for different objects.
+ *  \synchronous  TRUE
+ *
+ *  \pre          See Os_Ioc08SendN().
+ **********************************************************************************************************************/
+FUNC(Std_ReturnType, OS_CODE) Os_TrapIoc08SendN
+(
+  boolean IsTrapRequired,
+  P2CONST(Os_Ioc08SendConfigType, TYPEDEF, OS_CONST) Ioc,
+  P2CONST(uint8, TYPEDEF, AUTOMATIC) Data,
+  uint32 Count,
+  P2VAR(uint32, TYPEDEF, AUTOMATIC) Sent
+);
+
+
 /***********************************************************************************************************************
  *  Os_TrapIoc16Receive()
  **********************************************************************************************************************/
@@ -554,6 +639,74 @@ FUNC(Std_ReturnType, OS_CODE) Os_TrapIoc16Send
 );
 
 
+/***********************************************************************************************************************
+ *  Os_TrapIoc16ReceiveN()
+ **********************************************************************************************************************/
+/*! \brief        Reads up to Count items from the IOC.
+ *  \details      For further details see Os_Ioc16ReceiveN().
+ *
+ *  \param[in]      IsTrapRequired  Defines whether a trap is required:
+ *                                   - TRUE:  Trap is always performed.
+ *                                   - FALSE: Trap is performed, if supervisor mode is required by platform.
+ *  \param[in,out]  Ioc             See Os_Ioc16ReceiveN().
+ *  \param[out]     Data            See Os_Ioc16ReceiveN().
+ *  \param[in]      Count           See Os_Ioc16ReceiveN().
+ *  \param[out]     Received        See Os_Ioc16ReceiveN().
+ *
+ *  \retval       IOC_E_NOK   Received is a NULL_PTR.
+ *  \return       Otherwise see Os_Ioc16ReceiveN().
+ *
+ *  \context      ANY
+ *
+ *  \reentrant    TRUE for different objects.
+ *  \synchronous  TRUE
+ *
+ *  \pre          See Os_Ioc16ReceiveN().
+ **********************************************************************************************************************/
+FUNC(Std_ReturnType, OS_CODE) Os_TrapIoc16ReceiveN
+(
+  boolean IsTrapRequired,
+  P2CONST(Os_Ioc16ReceiveConfigType, TYPEDEF, OS_CONST) Ioc,
+  P2VAR(uint16, TYPEDEF, AUTOMATIC) Data,
+  uint32 Count,
+  P2VAR(uint32, TYPEDEF, AUTOMATIC) Received
+);
+
+
+/***********************************************************************************************************************
+ *  Os_TrapIoc16SendN()
+ **********************************************************************************************************************/
+/*! \brief        Writes up to Count items to the IOC.
+ *  \details      For further details see Os_Ioc16SendN().
+ *
+ *  \param[in]      IsTrapRequired  Defines whether a trap is required:
+ *                                   - TRUE:  Trap is always performed.
+ *                                   - FALSE: Trap is performed, if supervisor mode is required by platform.
+ *  \param[in,out]  Ioc             See Os_Ioc16SendN().
+ *  \param[in]      Data            See Os_Ioc16SendN().
+ *  \param[in]      Count           See Os_Ioc16SendN().
+ *  \param[out]     Sent            See Os_Ioc16SendN().
+ *
+ *  \retval       IOC_E_NOK   Sent is a NULL_PTR.
+ *  \return       Otherwise see Os_Ioc16SendN().
+ *
+ *  \context      ANY
+ *
+ *  \reentrant    TRUE for different objects.
+ *  \synchronous  TRUE
+ *
+ *  \pre          See Os_Ioc16SendN().
+ **********************************************************************************************************************/
+FUNC(Std_ReturnType, OS_CODE) Os_TrapIoc16SendN
+(
+  boolean IsTrapRequired,
+  P2CONST(Os_Ioc16SendConfigType, TYPEDEF, OS_CONST) Ioc,
+  P2CONST(uint16, TYPEDEF, AUTOMATIC) Data,
+  uint32 Count,
+  P2VAR(uint32, TYPEDEF, AUTOMATIC) Sent
+);
+
+
 /***********************************************************************************************************************
  *  Os_TrapIoc32Receive()
  **********************************************************************************************************************/
@@ -639,6 +792,74 @@ FUNC(Std_ReturnType, OS_CODE) Os_TrapIoc32Send
 );
 
 
+/***********************************************************************************************************************
+ *  Os_TrapIoc32ReceiveN()
+ **********************************************************************************************************************/
+/*! \brief        Reads up to Count items from the IOC.
+ *  \details      For further details see Os_Ioc32ReceiveN().
+ *
+ *  \param[in]      IsTrapRequired  Defines whether a trap is required:
+ *                                   - TRUE:  Trap is always performed.
+ *                                   - FALSE: Trap is performed, if supervisor mode is required by platform.
+ *  \param[in,out]  Ioc             See Os_Ioc32ReceiveN().
+ *  \param[out]     Data            See Os_Ioc32ReceiveN().
+ *  \param[in]      Count           See Os_Ioc32ReceiveN().
+ *  \param[out]     Received        See Os_Ioc32ReceiveN().
+ *
+ *  \retval       IOC_E_NOK   Received is a NULL_PTR.
+ *  \return       Otherwise see Os_Ioc32ReceiveN().
+ *
+ *  \context      ANY
+ *
+ *  \reentrant    TRUE for different objects.
+ *  \synchronous  TRUE
+ *
+ *  \pre          See Os_Ioc32ReceiveN().
+ **********************************************************************************************************************/
+FUNC(Std_ReturnType, OS_CODE) Os_TrapIoc32ReceiveN
+(
+  boolean IsTrapRequired,
+  P2CONST(Os_Ioc32ReceiveConfigType, TYPEDEF, OS_CONST) Ioc,
+  P2VAR(uint32, TYPEDEF, AUTOMATIC) Data,
+  uint32 Count,
+  P2VAR(uint32, TYPEDEF, AUTOMATIC) Received
+);
+
+
+/***********************************************************************************************************************
+ *  Os_TrapIoc32SendN()
+ **********************************************************************************************************************/
+/*! \brief        Writes up to Count items to the IOC.
+ *  \details      For further details see Os_Ioc32SendN().
+ *
+ *  \param[in]      IsTrapRequired  Defines whether a trap is required:
+ *                                   - TRUE:  Trap is always performed.
+ *                                   - FALSE: Trap is performed, if supervisor mode is required by platform.
+ *  \param[in,out]  Ioc             See Os_Ioc32SendN().
+ *  \param[in]      Data            See Os_Ioc32SendN().
+ *  \param[in]      Count           See Os_Ioc32SendN().
+ *  \param[out]     Sent            See Os_Ioc32SendN().
+ *
+ *  \retval       IOC_E_NOK   Sent is a NULL_PTR.
+ *  \return       Otherwise see Os_Ioc32SendN().
+ *
+ *  \context      ANY
+ *
+ *  \reentrant    TRUE for different objects.
+ *  \synchronous  TRUE
+ *
+ *  \pre          See Os_Ioc32SendN().
+ **********************************************************************************************************************/
+FUNC(Std_ReturnType, OS_CODE) Os_TrapIoc32SendN
+(
+  boolean IsTrapRequired,
+  P2CONST(Os_Ioc32SendConfigType, TYPEDEF, OS_CONST) Ioc,
+  P2CONST(uint32, TYPEDEF, AUTOMATIC) Data,
+  uint32 Count,
+  P2VAR(uint32, TYPEDEF, AUTOMATIC) Sent
+);
+
+
 /***********************************************************************************************************************
  *  Os_TrapIocRefReceive()
  **********************************************************************************************************************/
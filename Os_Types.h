@@ -173,6 +173,15 @@
  *  \details Parameter value of hook macros OS_VTH_DISABLEDINT() and OS_VTH_ENABLEDINT(). */
 #define OS_VTHP_ALLINTERRUPTS      2
 
+/*! \brief   Number of wait time buckets of the spinlock statistics.
+ *  \details Bucket 0 counts waits of 0 ticks, bucket i counts waits of [2^(i-1), 2^i - 1] ticks. The last bucket also
+ *           counts all longer waits. See \ref Os_SpinlockStatisticsType. */
+#define OS_SPINLOCKSTATISTICS_BUCKET_COUNT    (16u)
+
+/*! \brief   Element value of a completed asynchronous call.
+ *  \details See \ref Os_AsyncCallType. */
+#define OS_ASYNCCALL_COMPLETED                (0xFFFFFFFFuL)
+
 
 /***********************************************************************************************************************
  *  GLOBAL FUNCTION MACROS
@@ -229,8 +238,9 @@ typedef uint8  AppModeType;
  */
 typedef enum
 {
-  IDLE_NO_HALT = 0, /*!< The core does not perform any specific actions during idle time. */
-  OS_IDLEMODE_COUNT = 1
+  IDLE_NO_HALT = 0,  /*!< The core does not perform any specific actions during idle time. */
+  IDLE_TICKLESS = 1, /*!< The periodic ticks of the core's tickless timers are suppressed until the next expiry. */
+  OS_IDLEMODE_COUNT = 2
 } IdleModeType;
 
 
@@ -509,6 +519,17 @@ typedef enum
   OSServiceId_InitialEnableInterruptSources=0xBFu,  /*!< Os_InitialEnableInterruptSources() */
   OSServiceId_GetCoreStartState           = 0xC0u,  /*!< Os_GetCoreStartState() */
   OSServiceId_GetNonTrustedFunctionStackUsage = 0xC1u,  /*!< Os_GetNonTrustedFunctionStackUsage() */
+  OSServiceId_GetSpinlockStatistics       = 0xC2u,  /*!< Os_GetSpinlockStatistics() */
+  OSServiceId_GetTaskStateAsync           = 0xC3u,  /*!< Os_GetTaskStateAsync() */
+  OSServiceId_GetAlarmAsync               = 0xC4u,  /*!< Os_GetAlarmAsync() */
+  OSServiceId_GetCounterValueAsync        = 0xC5u,  /*!< Os_GetCounterValueAsync() */
+  OSServiceId_GetAsyncCallResult          = 0xC6u,  /*!< Os_GetAsyncCallResult() */
+  OSServiceId_GetTaskAccounting           = 0xC7u,  /*!< Os_GetTaskAccounting() */
+  OSServiceId_GetISRAccounting            = 0xC8u,  /*!< Os_GetISRAccounting() */
+  OSServiceId_ScanStackUsage              = 0xC9u,  /*!< Os_ScanStackUsage() */
+  OSServiceId_GetNtfStackPoolStatistics   = 0xCAu,  /*!< Os_GetNtfStackPoolStatistics() */
+  OSServiceId_ActivateTaskSet             = 0xCBu,  /*!< Os_ActivateTaskSet() */
+  OSServiceId_GetMpSkippedSwitches        = 0xCCu,  /*!< Os_GetMpSkippedSwitches() */
 
   /* ----- OSEK ----- */
   OSServiceId_StartOS                     = 0xD0u,  /*!< StartOS() */
@@ -622,6 +643,8 @@ typedef enum
   OS_STATUS_FUNCTION_UNAVAILABLE              = E_OS_SYS_FUNCTION_UNAVAILABLE,
   /*! A buffer or value overflow occurred. */
   OS_STATUS_OVERFLOW                          = E_OS_SYS_OVERFLOW,
+  /*! The cross core call has been sent, but the receiver core has not handled it yet. */
+  OS_STATUS_CROSS_CORE_REQUESTED              = E_OS_SYS_CROSS_CORE_REQUESTED,
 
   /*! Invalid calling context. */
   OS_STATUS_CALLEVEL_SHARED_STACK             = (OS_STATUS_TYPE_VARIANT(E_OS_CALLEVEL, 1u)),
@@ -677,6 +700,8 @@ typedef enum
   OS_STATUS_KILLING_IS_DISABLED               = (OS_STATUS_TYPE_VARIANT(E_OS_NOFUNC, 8u)),
   /*! OS object is accessed in the wrong order. */
   OS_STATUS_ORDER                             = (OS_STATUS_TYPE_VARIANT(E_OS_NOFUNC, 9u)),
+  /*! The handle given in parameter 1 does not refer to an asynchronous call of the caller. */
+  OS_STATUS_NOFUNC_ASYNCCALL_1                = (OS_STATUS_TYPE_VARIANT(E_OS_NOFUNC, 10u)),
   /*! OS object is not in correct state to perform the requested operation. */
   OS_STATUS_STATE_1                           = (OS_STATUS_TYPE_VARIANT(E_OS_STATE, 1u)),
   /*! OS object is not in correct state to perform the requested operation. */
@@ -740,7 +765,13 @@ typedef enum
   /*! Stack Usage Measurement is not enabled in the configuration */
   OS_STATUS_STACKUSAGE_DISABLED_BY_CONFIG     = (OS_STATUS_TYPE_VARIANT(E_OS_SYS_DISABLED, 1u)),
   /*! Event is not enabled in the configuration */
-  OS_STATUS_EVENT_DISABLED_BY_CONFIG          = (OS_STATUS_TYPE_VARIANT(E_OS_SYS_DISABLED, 2u))
+  OS_STATUS_EVENT_DISABLED_BY_CONFIG          = (OS_STATUS_TYPE_VARIANT(E_OS_SYS_DISABLED, 2u)),
+  /*! Spinlock statistics are not enabled in the configuration */
+  OS_STATUS_SPINLOCKSTATISTICS_DISABLED_BY_CONFIG = (OS_STATUS_TYPE_VARIANT(E_OS_SYS_DISABLED, 3u)),
+  /*! Runtime accounting is not enabled in the configuration */
+  OS_STATUS_ACCOUNTING_DISABLED_BY_CONFIG     = (OS_STATUS_TYPE_VARIANT(E_OS_SYS_DISABLED, 4u)),
+  /*! Memory protection is not enabled in the configuration */
+  OS_STATUS_MP_DISABLED_BY_CONFIG             = (OS_STATUS_TYPE_VARIANT(E_OS_SYS_DISABLED, 5u))
 
 } Os_StatusType;
 
@@ -903,6 +934,95 @@ typedef enum
 }Os_CoreStartStateType;
 
 
+/*! \brief   Contention statistics of a spinlock on one core.
+ *  \details The statistics are recorded, if OS_CFG_SPINLOCK_STATISTICS is enabled. All times are given in ticks of the
+ *           timer which is configured for the spinlock. The statistics can be requested by the API
+ *           \ref Os_GetSpinlockStatistics().
+ */
+typedef struct
+{
+  /*! Number of times the spinlock has been taken. */
+  uint32 AcquisitionCount;
+  /*! Number of times the spinlock has been taken after it was found locked. */
+  uint32 ContendedCount;
+  /*! Longest time between the lock request and the lock grant. */
+  uint32 MaxWaitTime;
+  /*! Longest time between the lock grant and the release. */
+  uint32 MaxHoldTime;
+  /*! Number of lock grants per wait time bucket (see \ref OS_SPINLOCKSTATISTICS_BUCKET_COUNT). */
+  uint32 WaitHistogram[OS_SPINLOCKSTATISTICS_BUCKET_COUNT];
+}Os_SpinlockStatisticsType;
+
+/*! Reference to spinlock statistics. */
+typedef Os_SpinlockStatisticsType* Os_SpinlockStatisticsRefType;
+
+
+/*! \brief   Handle of an asynchronous cross core call.
+ *  \details The handle is set up by \ref Os_GetTaskStateAsync(), \ref Os_GetAlarmAsync() or
+ *           \ref Os_GetCounterValueAsync() and is completed by \ref Os_GetAsyncCallResult(). The members Port and
+ *           Element are managed by the OS and must not be modified by the application.
+ */
+typedef struct
+{
+  /*! Send port of the calling core, which carries the call. */
+  uint32 Port;
+  /*! Communication element of the call within the send port. OS_ASYNCCALL_COMPLETED, if the call is completed. */
+  uint32 Element;
+  /*! Result of \ref Os_GetTaskStateAsync(). Valid once the call is completed. */
+  TaskStateType State;
+  /*! Result of \ref Os_GetAlarmAsync() or \ref Os_GetCounterValueAsync(). Valid once the call is completed. */
+  TickType Tick;
+}Os_AsyncCallType;
+
+/*! Reference to an asynchronous call handle. */
+typedef Os_AsyncCallType* Os_AsyncCallRefType;
+
+
+/*! \brief   Runtime accounting information of a task or ISR.
+ *  \details The information is recorded, if OS_CFG_THREAD_ACCOUNTING is enabled. All times are given in ticks of the
+ *           accounting timer of the core which executes the thread. The information can be requested by the APIs
+ *           \ref Os_GetTaskAccounting() and \ref Os_GetISRAccounting(). The response time jitter is
+ *           (MaxResponseTime - MinResponseTime).
+ */
+typedef struct
+{
+  /*! Accumulated execution time. Hooks are accounted to the thread which has called them. The current execution
+   *  slice of a running thread is not included. */
+  uint64 ExecutionTime;
+  /*! Number of task activations or ISR requests. */
+  uint32 ActivationCount;
+  /*! Number of times the thread has been preempted by a task or interrupted by an ISR. */
+  uint32 PreemptionCount;
+  /*! Longest time between the activation and the termination of a job. */
+  uint32 MaxResponseTime;
+  /*! Shortest time between the activation and the termination of a job. 0xFFFFFFFF, if no job has terminated. */
+  uint32 MinResponseTime;
+}Os_ThreadAccountingType;
+
+/*! Reference to runtime accounting information. */
+typedef Os_ThreadAccountingType* Os_ThreadAccountingRefType;
+
+
+/*! \brief   Usage statistics of the stack pool of a non-trusted function.
+ *  \details The statistics are recorded since StartOS() and can be requested by the API
+ *           \ref Os_GetNtfStackPoolStatistics(). They help to size the stack pool and the per application limits.
+ */
+typedef struct
+{
+  /*! Number of stacks in the pool. */
+  uint8 StackCount;
+  /*! Number of stacks currently in use. */
+  uint8 InUse;
+  /*! Highest number of stacks which have been in use at the same time. */
+  uint8 PeakInUse;
+  /*! Number of calls which did not get a stack, either due to the application limit or an empty pool. */
+  uint32 Denials;
+}Os_NtfStackPoolStatisticsType;
+
+/*! Reference to stack pool statistics. */
+typedef Os_NtfStackPoolStatisticsType* Os_NtfStackPoolStatisticsRefType;
+
+
 /***********************************************************************************************************************
  *  GLOBAL DATA PROTOTYPES
  **********************************************************************************************************************/
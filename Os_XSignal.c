@@ -56,6 +56,7 @@
 #include "Os_ServiceFunction.h"
 #include "Os_Stack.h"
 #include "Os_Hook.h"
+#include "Os_Bit.h"
 
 /* Os hal dependencies */
 #include "Os_Hal_Compiler.h"
@@ -254,6 +255,8 @@ Os_XSigRecvCheckIsReceiveElementValid,
  *  \param[in]      FunctionIdx   The function to call.
  *  \param[in]      Parameters    The parameters which are passed to the function. Parameter must not be NULL.
  *  \param[in]      Acknowledge   The acknowledge value of the request.
+ *  \param[in]      NotifyMask    Events which the receiver sets for the sending task, once the request has been
+ *                                handled. 0 for no notification. If not 0, SendThread must be an extended task.
  *  \param[out]     ComData       The ComData object which has been used for data transmission.
  *                                Parameter must not be NULL.
  *
@@ -275,10 +278,64 @@ OS_ALWAYS_INLINE, Os_XSigSendInternal,
   Os_XSigFunctionIdx FunctionIdx,
   P2CONST(Os_XSigParamsType, AUTOMATIC, TYPEDEF) Parameters,
   Os_XSigState_Type Acknowledge,
+  EventMaskType NotifyMask,
   P2VAR(Os_XSigComDataConfigRefType, AUTOMATIC, OS_VAR_NOINIT) ComData
 ));
 
 
+/***********************************************************************************************************************
+ *  Os_XSigIsTriggerRequired()
+ **********************************************************************************************************************/
+/*! \brief          Returns whether a request, which has just been sent, has to trigger the receiver.
+ *  \details        Synchronous requests always trigger the receiver. Without coalescing, each asynchronous request
+ *                  outside of a batch triggers the receiver. Otherwise an asynchronous request triggers the receiver
+ *                  only, if the receiver had handled all previous requests of the send port. Within a batch, the
+ *                  receiver is thus started by its first request and drains the channel while further requests are
+ *                  written, instead of waiting for Os_XSigBatchFlush() with a full channel.
+ *
+ *  \param[in]      SendPort      The send port which has been written. Parameter must not be NULL.
+ *  \param[in]      SendIdx       The send position of the channel before the request has been sent.
+ *  \param[in]      Acknowledge   The acknowledge value of the request.
+ *
+ *  \retval         !0   The receiver has to be triggered.
+ *  \retval         0    The receiver handles the request without an additional trigger.
+ *
+ *  \context        OS_INTERNAL
+ *
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *
+ *  \pre            Interrupts are suspended.
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE Os_StdReturnType, OS_CODE, OS_ALWAYS_INLINE, Os_XSigIsTriggerRequired,
+(
+  P2CONST(Os_XSigSendPortConfigType, AUTOMATIC, OS_CONST) SendPort,
+  Os_XSigBufferIdxType SendIdx,
+  Os_XSigState_Type Acknowledge
+));
+
+
+/***********************************************************************************************************************
+ *  Os_XSigBatchTrigger()
+ **********************************************************************************************************************/
+/*! \brief          Triggers each receiver, which has not yet handled all requests of the given core.
+ *  \details        Called when the outermost batch of the core ends.
+ *
+ *  \param[in]      XSignal       The XSignal object of the sending core. Parameter must not be NULL.
+ *
+ *  \context        OS_INTERNAL
+ *
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *
+ *  \pre            Interrupts are suspended.
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE, Os_XSigBatchTrigger,
+(
+  P2CONST(Os_XSigConfigType, AUTOMATIC, OS_CONST) XSignal
+));
+
+
 /***********************************************************************************************************************
  *  Os_XSigFunctionIdx2ServiceId()
  **********************************************************************************************************************/
@@ -372,7 +429,8 @@ OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE, O
  *  Os_XSigIsrInit()
  **********************************************************************************************************************/
 /*! \brief          Initializes the given ISR (Init-Step4).
- *  \details        --no details--
+ *  \details        Performs a kernel panic, if the ISR has more receive ports than the ready mask has bits or if its
+ *                  batch size is zero.
  *
  *  \param[in,out]  XSigIsr    The ISR to initialize. Parameter must not be NULL.
  *
@@ -389,6 +447,88 @@ OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE, O
 ));
 
 
+/***********************************************************************************************************************
+ *  Os_XSigRecvPortHandle()
+ **********************************************************************************************************************/
+/*! \brief          Handles the requests of the given receive port.
+ *  \details        At most XSigIsr->RecvBatchSize requests are handled.
+ *
+ *  \param[in]      XSigIsr   The XSignal ISR, which owns the receive port. Parameter must not be NULL.
+ *  \param[in]      RecvPort  The receive port to handle. Parameter must not be NULL.
+ *
+ *  \retval         !0        Further requests are left in the receive port.
+ *  \retval         0         The receive port is empty.
+ *
+ *  \context        ISR2
+ *
+ *  \reentrant      FALSE
+ *  \synchronous    TRUE
+ *
+ *  \pre            Interrupts are suspended.
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE Os_StdReturnType, OS_CODE, OS_ALWAYS_INLINE, Os_XSigRecvPortHandle,
+(
+  P2CONST(Os_XSigIsrConfigType, AUTOMATIC, OS_CONST) XSigIsr,
+  P2CONST(Os_XSigRecvPortConfigType, AUTOMATIC, OS_CONST) RecvPort
+));
+
+
+/***********************************************************************************************************************
+ *  Os_XSigRecvNotify()
+ **********************************************************************************************************************/
+/*! \brief          Sets the events, which the sender of a handled request waits for.
+ *  \details        A failure is reported to the error hook of the receiver core, as the sender would otherwise
+ *                  wait for the events forever.
+ *
+ *  \param[in]      NotifyTask  The task to notify. Parameter must not be NULL.
+ *  \param[in]      NotifyMask  The events to set.
+ *
+ *  \context        ISR2
+ *
+ *  \reentrant      FALSE
+ *  \synchronous    TRUE
+ *
+ *  \pre            The current thread is the XSignal ISR which has handled the request.
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE, Os_XSigRecvNotify,
+(
+  P2CONST(Os_TaskConfigType, AUTOMATIC, OS_CONST) NotifyTask,
+  EventMaskType NotifyMask
+));
+
+
+/***********************************************************************************************************************
+ *  Os_XSigCheckNotificationPath()
+ **********************************************************************************************************************/
+/*! \brief          Checks whether the receiver of a request is able to notify the sending task.
+ *  \details        The receiving XSignal ISR sets the events by an asynchronous SetEvent request to the sender core
+ *                  with its own access rights.
+ *
+ *  \param[in]      SendPort    The send port of the request. Parameter must not be NULL.
+ *  \param[in]      RecvCore    The receiving core. Parameter must not be NULL.
+ *  \param[in]      SendThread  The sending task. Parameter must not be NULL.
+ *
+ *  \retval         OS_STATUS_OK                    The notification can be delivered.
+ *  \retval         OS_STATUS_CALL_NOT_ALLOWED      The receiving core may not send requests to the sender core or
+ *                                                  the receiving XSignal ISR has no access to the sending task.
+ *  \retval         OS_STATUS_FUNCTION_UNAVAILABLE  The sender core does not handle SetEvent requests of the
+ *                                                  receiving core.
+ *
+ *  \context        OS_INTERNAL
+ *
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *
+ *  \pre            SendThread is a task.
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE Os_StatusType, OS_CODE, OS_ALWAYS_INLINE, Os_XSigCheckNotificationPath,
+(
+  P2CONST(Os_XSigSendPortConfigType, AUTOMATIC, OS_CONST) SendPort,
+  P2CONST(Os_CoreAsrConfigType, AUTOMATIC, OS_CONST) RecvCore,
+  P2CONST(Os_ThreadConfigType, AUTOMATIC, OS_CONST) SendThread
+));
+
+
 /***********************************************************************************************************************
  *  Os_XSigThread2XSigIsr()
  **********************************************************************************************************************/
@@ -428,6 +568,44 @@ OS_CODE, OS_ALWAYS_INLINE, Os_XSigGetSendPort,
   return XSignal->SendPorts[SendPortIdx];                                                                               /* PRQA S 2842 */ /* MD_Os_Rule18.1_2842_Precondition */
 }
 
+/***********************************************************************************************************************
+ *  Os_XSigBatchTrigger()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE, Os_XSigBatchTrigger,                      /* COV_OS_HALPLATFORMTESTEDASMULTICORE */
+(
+  P2CONST(Os_XSigConfigType, AUTOMATIC, OS_CONST) XSignal
+))
+{
+  Os_CoreAsrCoreIdx itSendPort;
+
+  /* #10 Order the preceding send index updates before the receive indices are read. */
+  Os_Hal_Dsync();
+
+  /* #20 Trigger each receiver, which has not yet handled all requests of this core. */
+  for(itSendPort = (Os_CoreAsrCoreIdx)0; itSendPort < OS_COREASRCOREIDX_COUNT; ++itSendPort)                            /* PRQA S 4332,  4527 */ /* MD_Os_Rule10.5_4332,  MD_Os_Rule10.1_4527 */ /* COMP_WARN_OS_CW_005 */
+  {
+    P2CONST(Os_XSigSendPortConfigType, AUTOMATIC, OS_CONST) sendPort;
+
+    sendPort = Os_XSigGetSendPort(XSignal, itSendPort);                                                                 /* SBSW_OS_XSIG_XSIGGETSENDPORT_001 */
+
+    if(sendPort != NULL_PTR)
+    {
+      P2CONST(Os_XSigChannelSendConfigType, AUTOMATIC, OS_CONST) sendChannel = &(sendPort->SendChannel);
+
+      if(Os_XSigChannelIsReceivedUpTo(sendChannel, Os_XSigChannelGetSendIdx(sendChannel)) == 0u)                        /* SBSW_OS_XSIG_XSIGCHANNEL_001 */
+      {
+        Os_Hal_XSigTrigger(sendPort->XSigIsr->HwConfig);                                                                /* SBSW_OS_XSIG_HAL_XSIGTRIGGER_002 */
+      }
+    }
+  }
+}
+
 
 
 /***********************************************************************************************************************
@@ -561,11 +739,13 @@ OS_ALWAYS_INLINE, Os_XSigSendInternal,
   Os_XSigFunctionIdx FunctionIdx,
   P2CONST(Os_XSigParamsType, AUTOMATIC, TYPEDEF) Parameters,
   Os_XSigState_Type Acknowledge,
+  EventMaskType NotifyMask,
   P2VAR(Os_XSigComDataConfigRefType, AUTOMATIC, OS_VAR_NOINIT) ComData
 ))                                                                                                                      /* COV_OS_HALPLATFORMTESTEDASMULTICORE */
 {
   Os_StatusType status;
   Os_IntStateType interruptState;
+  Os_XSigBufferIdxType sendIdx;
 
   /* #10 Suspend interrupts. */
   Os_IntSuspend(&interruptState);                                                                                       /* SBSW_OS_FC_POINTER2LOCAL */
@@ -574,6 +754,9 @@ OS_ALWAYS_INLINE, Os_XSigSendInternal,
     /* #20 Free the result buffer. */
     Os_XSigHandleResults(&(SendPort->SendChannel));                                                                     /* SBSW_OS_FC_PRECONDITION */
 
+    /* #25 Remember the send position, before the search for a free element may advance it. */
+    sendIdx = Os_XSigChannelGetSendIdx(&(SendPort->SendChannel));                                                       /* SBSW_OS_FC_PRECONDITION */
+
     /* #30 Get a communication data element from the queue and initialize it. */
     *ComData = Os_XSigChannelGetSendElement(&(SendPort->SendChannel));                                                  /* SBSW_OS_PWA_PRECONDITION */ /* SBSW_OS_FC_PRECONDITION */
 
@@ -589,10 +772,19 @@ OS_ALWAYS_INLINE, Os_XSigSendInternal,
       (*ComData)->SendData->ParameterData = *Parameters;                                                                /* SBSW_OS_XSIG_SENDDATA_001 */
       (*ComData)->SendData->Sender = SendThread;                                                                        /* SBSW_OS_XSIG_SENDDATA_001 */
       (*ComData)->SendData->SenderApp = Os_ThreadGetCurrentApplication(SendThread);                                     /* SBSW_OS_XSIG_SENDDATA_001 */ /* SBSW_OS_FC_PRECONDITION */
+      (*ComData)->SendData->NotifyMask = NotifyMask;                                                                    /* SBSW_OS_XSIG_SENDDATA_001 */
+      if(NotifyMask != 0u)
+      {
+        (*ComData)->SendData->NotifyTask = Os_TaskThread2Task(SendThread);                                              /* SBSW_OS_XSIG_SENDDATA_001 */ /* SBSW_OS_FC_PRECONDITION */
+      }
 
-      /* #50 Send the data element and trigger the receiver. */
+      /* #50 Send the data element, mark the receive port and trigger the receiver, if required. */
       Os_XSigChannelSend(&(SendPort->SendChannel));                                                                     /* SBSW_OS_FC_PRECONDITION */
-      Os_Hal_XSigTrigger(SendPort->XSigIsr->HwConfig);                                                                  /* SBSW_OS_XSIG_HAL_XSIGTRIGGER_001 */
+      Os_Hal_BitFieldSetAtomic(&(SendPort->XSigIsr->RecvDyn->ReadyMask), SendPort->ReadyBit);                           /* SBSW_OS_XSIG_RECVDYN_001 */
+      if(Os_XSigIsTriggerRequired(SendPort, sendIdx, Acknowledge) != 0u)                                                /* SBSW_OS_FC_PRECONDITION */
+      {
+        Os_Hal_XSigTrigger(SendPort->XSigIsr->HwConfig);                                                                /* SBSW_OS_XSIG_HAL_XSIGTRIGGER_001 */
+      }
 
       status = OS_STATUS_OK;
     }
@@ -604,6 +796,52 @@ OS_ALWAYS_INLINE, Os_XSigSendInternal,
 }                                                                                                                       /* PRQA S 6060 */ /* MD_MSR_STPAR */
 
 
+/***********************************************************************************************************************
+ *  Os_XSigIsTriggerRequired()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE Os_StdReturnType, OS_CODE,                                                 /* COV_OS_HALPLATFORMTESTEDASMULTICORE */
+OS_ALWAYS_INLINE, Os_XSigIsTriggerRequired,
+(
+  P2CONST(Os_XSigSendPortConfigType, AUTOMATIC, OS_CONST) SendPort,
+  Os_XSigBufferIdxType SendIdx,
+  Os_XSigState_Type Acknowledge
+))                                                                                                                      /* COV_OS_HALPLATFORMTESTEDASMULTICORE */
+{
+  Os_StdReturnType result;
+
+  /* #10 A synchronous sender waits for the result, so the receiver is always triggered. */
+  if(Acknowledge == OS_XSIGSTATE_SYNC_NACK)
+  {
+    result = !0u;                                                                                                       /* PRQA S 4404, 4558 */ /* MD_Os_C90BooleanCompatibility, MD_Os_Rule10.1_4558 */
+  }
+  /* #20 Outside of a batch and without coalescing each request triggers the receiver. */
+  else if((Os_CoreGetXSig(SendPort->SendCore)->Dyn->BatchDepth == 0u)                                                   /* SBSW_OS_XSIG_COREGETXSIG_002 */
+       && (Os_XSigUseCoalescing() == 0u))                                                                               /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */
+  {
+    result = !0u;                                                                                                       /* PRQA S 4404, 4558 */ /* MD_Os_C90BooleanCompatibility, MD_Os_Rule10.1_4558 */
+  }
+  /* #30 Otherwise trigger the receiver only, if it had handled all previous requests. Requests of a batch, which
+   *     find the receiver busy, are signaled by Os_XSigBatchFlush(). The barrier orders the write of the send index
+   *     before the read of the receive index. The receiver orders its writes of the receive index before its reads
+   *     of the send index the same way, so at least one of both observes the other's update. */
+  else
+  {
+    Os_Hal_Dsync();
+    result = Os_XSigChannelIsReceivedUpTo(&(SendPort->SendChannel), SendIdx);                                           /* SBSW_OS_FC_PRECONDITION */
+  }
+
+  return result;
+}
+
+
 /***********************************************************************************************************************
  *  Os_XSigFunctionIdx2ServiceId()
  **********************************************************************************************************************/
@@ -690,6 +928,12 @@ OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE, Os
       /* #70 Set the state to pending. It will be handled by the sender.*/
        comData->SendData->Acknowledge = OS_XSIGSTATE_SYNC_PENDING;                                                      /* SBSW_OS_XSIG_XSIGCHANNELGETRESULT_001 */
     }
+    /* #75 Otherwise if the sender of the synchronous request has been killed, mark the buffer element as unused.
+     *     The receiver has passed it, so no other core accesses it any more. */
+    else if(comData->SendData->Acknowledge == OS_XSIGSTATE_SYNC_ABORTED)
+    {
+      comData->SendData->Acknowledge = OS_XSIGSTATE_ACK;                                                                /* SBSW_OS_XSIG_XSIGCHANNELGETRESULT_001 */
+    }
     else /* The MISRA-else */
     {
        /* OS_XSIGSTATE_ACK don't require any action. */
@@ -723,72 +967,670 @@ OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE, Os
 
 
 /***********************************************************************************************************************
- *  Os_XSigRecvPortInit()
+ *  Os_XSigRecvPortInit()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE, Os_XSigRecvPortInit,                      /* COV_OS_HALPLATFORMMULTICOREUNSUPPORTED */
+(
+  P2CONST(Os_XSigRecvPortConfigType, AUTOMATIC, OS_CONST) RecvPort
+))                                                                                                                      /* COV_OS_HALPLATFORMMULTICOREUNSUPPORTED */
+{
+  /* #10 Initialize the receiver side of the communication buffer. */
+  Os_XSigChannelReceiveInit(&(RecvPort->RecvChannel));                                                                  /* SBSW_OS_FC_PRECONDITION */
+}
+
+
+/***********************************************************************************************************************
+ *  Os_XSigIsrInit()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE, Os_XSigIsrInit,                           /* COV_OS_HALPLATFORMMULTICOREUNSUPPORTED */
+(
+    P2CONST(Os_XSigIsrConfigType, AUTOMATIC, OS_CONST) XSigIsr
+))                                                                                                                      /* COV_OS_HALPLATFORMMULTICOREUNSUPPORTED */
+{
+  Os_ObjIdx_IteratorType it;
+
+  /* #10 If the ready mask cannot represent all receive ports or no request would be handled per pass:
+   *     KernelPanic. */
+  if(OS_UNLIKELY((XSigIsr->RecvPortCount > (Os_ObjIdxType)OS_BITFIELD_BITWIDTH)                                         /* COV_OS_INVSTATE */
+              || (XSigIsr->RecvBatchSize == 0u)))
+  {
+    Os_ErrKernelPanic();
+  }
+
+  /* #20 Initialize the base ISR. */
+  Os_IsrInit(&(XSigIsr->IsrCfg));                                                                                       /* SBSW_OS_FC_PRECONDITION */
+
+  /* #30 Initialize the hardware interrupt. */
+  Os_Hal_XSigInit(XSigIsr->HwConfig);                                                                                   /* SBSW_OS_XSIG_HAL_XSIGINIT_001 */
+
+  /* #40 No receive port is marked. */
+  XSigIsr->RecvDyn->ReadyMask = 0u;                                                                                     /* SBSW_OS_XSIG_RECVDYN_001 */
+
+  /* #50 Initialize the receiver ports. */
+  for(it = 0; it < (Os_ObjIdx_IteratorType) XSigIsr->RecvPortCount; ++it)
+  {
+    Os_XSigRecvPortInit(XSigIsr->RecvPortRefs[it]);                                                                     /* SBSW_OS_XSIG_XSIGRECVPORTINIT_001 */
+  }
+}
+
+
+/***********************************************************************************************************************
+ *  Os_XSigThread2XSigIsr()
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE P2CONST(Os_XSigIsrConfigType, AUTOMATIC, OS_CONST), OS_CODE,               /* COV_OS_HALPLATFORMMULTICOREUNSUPPORTED */
+OS_ALWAYS_INLINE, Os_XSigThread2XSigIsr,
+(
+  P2CONST(Os_ThreadConfigType, AUTOMATIC, OS_CONST) Thread
+))                                                                                                                      /* COV_OS_HALPLATFORMMULTICOREUNSUPPORTED */
+{
+  return (P2CONST(Os_XSigIsrConfigType, AUTOMATIC, OS_CONST))Thread;                                                    /* PRQA S 0310 */ /* MD_Os_Rule11.3_0310 */
+}
+
+
+/***********************************************************************************************************************
+ *  Os_XSigRecvNotify()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE, Os_XSigRecvNotify,                        /* COV_OS_HALPLATFORMMULTICOREUNSUPPORTED */
+(
+  P2CONST(Os_TaskConfigType, AUTOMATIC, OS_CONST) NotifyTask,
+  EventMaskType NotifyMask
+))                                                                                                                      /* COV_OS_HALPLATFORMMULTICOREUNSUPPORTED */
+{
+  Os_StatusType status;
+
+  /* #10 Set the events. */
+  status = Os_EventSetInternal(NotifyTask, NotifyMask);                                                                 /* SBSW_OS_FC_PRECONDITION */
+
+  /* #20 If the events could not be set, report the failed SetEvent request to the error module. */
+  if(OS_UNLIKELY(status != OS_STATUS_OK))
+  {
+    Os_ErrorParamsType errorParameters;
+
+    errorParameters.Parameter[OS_ERRORPARAMINDEX_1].ParamTaskType = Os_TaskGetId(NotifyTask);                           /* SBSW_OS_PWA_LOCAL */ /* SBSW_OS_FC_PRECONDITION */
+    errorParameters.Parameter[OS_ERRORPARAMINDEX_2].ParamEventMaskType = NotifyMask;                                    /* SBSW_OS_PWA_LOCAL */
+    Os_ErrApplicationError(OSServiceId_SetEvent, status, &errorParameters);                                             /* SBSW_OS_FC_POINTER2LOCAL */
+  }
+}
+
+
+/***********************************************************************************************************************
+ *  Os_XSigCheckNotificationPath()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE Os_StatusType, OS_CODE, OS_ALWAYS_INLINE, Os_XSigCheckNotificationPath,    /* COV_OS_HALPLATFORMMULTICOREUNSUPPORTED */
+(
+  P2CONST(Os_XSigSendPortConfigType, AUTOMATIC, OS_CONST) SendPort,
+  P2CONST(Os_CoreAsrConfigType, AUTOMATIC, OS_CONST) RecvCore,
+  P2CONST(Os_ThreadConfigType, AUTOMATIC, OS_CONST) SendThread
+))                                                                                                                      /* COV_OS_HALPLATFORMMULTICOREUNSUPPORTED */
+{
+  P2CONST(Os_XSigSendPortConfigType, AUTOMATIC, OS_CONST) returnPort;
+  P2CONST(Os_ThreadConfigType, AUTOMATIC, OS_CONST) notifyingThread;
+  Os_AppAccessMaskType permittedApplications;
+  Os_StatusType status;
+
+  returnPort = Os_XSigGetSendPort(Os_CoreGetXSig(RecvCore),                                                             /* SBSW_OS_XSIG_XSIGGETSENDPORT_001 */ /* SBSW_OS_XSIG_COREGETXSIG_001 */
+                                  Os_CoreGetAsrCoreIdx(Os_ThreadGetCore(SendThread)));                                  /* SBSW_OS_FC_PRECONDITION */
+  notifyingThread = Os_IsrGetThread(OS_XSIGNAL_CASTCONFIG_XSIGNALISR_2_ISR(*(SendPort->XSigIsr)));                      /* SBSW_OS_FC_PRECONDITION */
+  permittedApplications = Os_TaskGetAccessingApplications(Os_TaskThread2Task(SendThread));                              /* SBSW_OS_XSIG_TASKGETACCESSINGAPPLICATIONS_002 */
+
+  /* #10 Check that the receiving core may send requests to the sender core. */
+  if(OS_UNLIKELY(returnPort == NULL_PTR))
+  {
+    status = OS_STATUS_CALL_NOT_ALLOWED;
+  }
+  /* #20 Check that the sender core handles SetEvent requests of the receiving core. */
+  else if(OS_UNLIKELY(Os_XSigRecvCheckIsFunctionAvailable(returnPort->XSigIsr, XSigFunctionIdx_SetEvent)                /* SBSW_OS_XSIG_XSIGRECVCHECKISFUNCTIONAVAILABLE_002 */
+                   == OS_CHECK_FAILED))
+  {
+    status = OS_STATUS_FUNCTION_UNAVAILABLE;
+  }
+  /* #30 Check that the receiving XSignal ISR may set events for the sending task. */
+  else if(OS_UNLIKELY(Os_AppCheckAccess(Os_ThreadGetOwnerApplication(notifyingThread), permittedApplications)           /* SBSW_OS_FC_PRECONDITION */
+                   == OS_CHECK_FAILED))
+  {
+    status = OS_STATUS_CALL_NOT_ALLOWED;
+  }
+  else
+  {
+    status = OS_STATUS_OK;
+  }
+
+  return status;
+}
+
+
+/***********************************************************************************************************************
+ *  Os_XSigRecvPortHandle()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ *
+ *
+ *
+ *
+ *
+ *
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE Os_StdReturnType, OS_CODE, OS_ALWAYS_INLINE, Os_XSigRecvPortHandle,        /* COV_OS_HALPLATFORMMULTICOREUNSUPPORTED */
+(
+  P2CONST(Os_XSigIsrConfigType, AUTOMATIC, OS_CONST) XSigIsr,
+  P2CONST(Os_XSigRecvPortConfigType, AUTOMATIC, OS_CONST) RecvPort
+))                                                                                                                      /* COV_OS_HALPLATFORMMULTICOREUNSUPPORTED */
+{
+  P2CONST(Os_CoreAsrConfigType, AUTOMATIC, OS_CONST) sendCore;
+  Os_StatusType status;
+  Os_StdReturnType requestsLeft;
+  uint32 handledCount;
+
+  sendCore = RecvPort->SendPort->SendCore;
+  requestsLeft = 0u;
+
+  /* #10 If the core was started as AUTOSAR core: */
+  if(Os_CoreIsStartedAsAsr(Os_CoreAsr2Core(sendCore)) != 0u)                                                            /* SBSW_OS_XSIG_COREISSTARTEDASASR */ /* SBSW_OS_XSIG_COREASR2CORE_001 */
+  {
+    /* #20 If the sender's channel index is valid: */
+    if(Os_XSigChannelReceiveCheckInRange(&(RecvPort->RecvChannel)) != 0u)                                               /* SBSW_OS_XSIG_XSIGCHANNELRECEIVECHECKINRANGE */
+    {
+      /* #30 While the batch is not exhausted and the core has sent a request: */
+      for(handledCount = 0u;
+          (handledCount < XSigIsr->RecvBatchSize)
+            && (Os_XSigChannelIsReceiveElementAvailable(&(RecvPort->RecvChannel)) != 0u);                               /* SBSW_OS_XSIG_XSIGCHANNELISRECEIVEELEMENTAVAILABLE_001 */
+          ++handledCount)
+      {
+        P2CONST(Os_XSigComDataConfigType, AUTOMATIC, OS_CONST) comData;
+        P2CONST(Os_XSigSendDataType volatile, AUTOMATIC, OS_VAR_NOINIT) sendData;
+        P2CONST(Os_TaskConfigType, AUTOMATIC, OS_CONST) notifyTask;
+        EventMaskType notifyMask;
+
+        notifyTask = NULL_PTR;
+        notifyMask = 0u;
+
+        /* #40 Check that the received data is valid. */
+        comData = Os_XSigChannelGetReceiveElement(&(RecvPort->RecvChannel));                                            /* SBSW_OS_XSIG_XSIGCHANNELGETRECEIVEELEMENT_001 */
+        if(Os_XSigRecvCheckIsReceiveElementValid(comData) != 0u)                                                        /* SBSW_OS_XSIGRECVCHECKISRECEIVEELEMENTVALID_001 */
+        {
+          sendData = comData->SendData;
+
+          /* #45 Remember the requested notification, as the sender may reuse the element after the reply. */
+          notifyMask = sendData->NotifyMask;
+          notifyTask = sendData->NotifyTask;
+
+          /* #50 Check that the function is available. */
+          if(Os_XSigRecvCheckIsFunctionAvailable(XSigIsr, sendData->FunctionIdx) == OS_CHECK_FAILED)                    /* SBSW_OS_XSIG_XSIGRECVCHECKISFUNCTIONAVAILABLE_001 */ /* PRQA S 2991, 2995 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule2.2_2995 */
+          {
+            status = OS_STATUS_FUNCTION_UNAVAILABLE;
+          }
+          /* #60 Call the respective function. */
+          else
+          {
+            Os_XSigFunctionType functionRef;
+            P2CONST(Os_XSigParamsType, AUTOMATIC, OS_VAR_NOINIT) inParameter;
+            P2VAR(Os_XSigOutputParamsType, AUTOMATIC, OS_VAR_NOINIT) outParameter;
+
+            /* Explicitly cast pointers to volatile data to non volatile data. */
+            inParameter = ((P2CONST(Os_XSigParamsType, AUTOMATIC, OS_VAR_NOINIT))&(sendData->ParameterData));           /* PRQA S 0312 */ /* MD_Os_Rule11.8_0312_Volatile */ /* COMP_WARN_OS_VOLATILE_CAST */
+            outParameter = ((P2VAR(Os_XSigOutputParamsType, AUTOMATIC, OS_VAR_NOINIT))                                  /* PRQA S 0312 */ /* MD_Os_Rule11.8_0312_Volatile */ /* COMP_WARN_OS_VOLATILE_CAST */
+                &(comData->RecvData->ReturnData.OutputParameter));
+
+            functionRef = XSigIsr->FunctionTable->FunctionDescription[sendData->FunctionIdx].FunctionRef;               /* PRQA S 2842 */ /* MD_Os_Rule18.1_2842_Check */
+
+            status = functionRef(sendData->SenderApp, inParameter, outParameter);                                       /* SBSW_OS_XSIG_CALLCACK_001 */
+          }
+
+          /* #70 Reply, unless the sender has been killed in the meantime. The sender core does not reuse the element
+           *     before it has passed the receive index, so a sender killed after this check only leaves an unused
+           *     result. Its notification is then reported as failed SetEvent request. */
+          if(sendData->Acknowledge != OS_XSIGSTATE_SYNC_ABORTED)
+          {
+            comData->RecvData->ReturnData.Status = status;                                                              /* SBSW_OS_XSIG_RECVDATA_001 */
+          }
+          else
+          {
+            notifyMask = 0u;
+          }
+        }
+        Os_XSigChannelReply(&(RecvPort->RecvChannel));                                                                  /* SBSW_OS_XSIG_XSIGCHANNELREPLY_001 */
+
+        /* #75 Notify the sending task, if requested. */
+        if(notifyMask != 0u)
+        {
+          Os_XSigRecvNotify(notifyTask, notifyMask);                                                                    /* SBSW_OS_XSIG_XSIGRECVNOTIFY_001 */
+        }
+
+        /* #80 If the senders coalesce their triggers, publish the receive index before the send indices are
+         *     checked again (see Os_XSigIsTriggerRequired()). */
+        if(Os_XSigUseCoalescing() != 0u)                                                                                /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */
+        {
+          Os_Hal_Dsync();
+        }
+      }
+
+      /* #90 Report, whether further requests are left. */
+      requestsLeft = Os_XSigChannelIsReceiveElementAvailable(&(RecvPort->RecvChannel));                                 /* SBSW_OS_XSIG_XSIGCHANNELISRECEIVEELEMENTAVAILABLE_001 */
+    }
+  }
+
+  return requestsLeft;
+}                                                                                                                       /* PRQA S 6050, 6080 */ /* MD_MSR_STCAL, MD_MSR_STMIF */
+
+
+/***********************************************************************************************************************
+ *  ISR(Os_XSigRecvIsrHandler)
+ **********************************************************************************************************************/
+/*!
+ *
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ *
+ *
+ *
+ *
+ *
+ *
+ *
+ *
+ */
+
+ISR(Os_XSigRecvIsrHandler)                                                                                              /* COV_OS_HALPLATFORMMULTICOREUNSUPPORTED */
+{
+  P2CONST(Os_XSigIsrConfigType, AUTOMATIC, OS_CONST) xSigIsr;
+  P2VAR(Os_XSigRecvType volatile, AUTOMATIC, OS_VAR_NOINIT) recvDyn;
+  Os_IntStateType interruptState;
+  Os_BitFieldType pending;
+
+  xSigIsr = Os_XSigThread2XSigIsr(Os_CoreGetThread());                                                                  /* SBSW_OS_XSIG_XSIGTHREAD2XSIGISR_001 */
+  recvDyn = xSigIsr->RecvDyn;
+
+  /* #10 Suspend interrupts. */
+  Os_IntSuspend(&interruptState);                                                                                       /* SBSW_OS_FC_POINTER2LOCAL */
+
+  /* #20 Acknowledge the interrupt. Requests sent afterwards mark their receive port again. */
+  Os_Hal_XSigAcknowledge(xSigIsr->HwConfig);                                                                            /* SBSW_OS_XSIG_HAL_XSIGACKNOWLEDGE_001 */
+  pending = recvDyn->ReadyMask;
+
+  /* #30 While any receive port is marked: */
+  while(pending != 0u)
+  {
+    /* #40 Visit each marked receive port once. */
+    do
+    {
+      Os_ObjIdx_IteratorType portIdx;
+      Os_BitFieldType readyBit;
+
+      portIdx = (Os_ObjIdx_IteratorType)Os_Bit_CountLeadingZeros(pending);
+      readyBit = (Os_BitFieldType)(OS_BITFIELD_MASK_MSB >> portIdx);
+      pending &= (Os_BitFieldType)(~readyBit);
+
+      /* #50 Unmark the receive port before reading it, so that requests sent concurrently mark it again. */
+      Os_Hal_BitFieldClearAtomic(&(recvDyn->ReadyMask), readyBit);                                                      /* SBSW_OS_XSIG_RECVDYN_001 */
+
+      /* #60 Handle a batch of requests. Mark the receive port again, if requests are left. */
+      if(Os_XSigRecvPortHandle(xSigIsr, xSigIsr->RecvPortRefs[portIdx]) != 0u)                                          /* SBSW_OS_XSIG_XSIGRECVPORTHANDLE_001 */
+      {
+        Os_Hal_BitFieldSetAtomic(&(recvDyn->ReadyMask), readyBit);                                                      /* SBSW_OS_XSIG_RECVDYN_001 */
+      }
+    } while(pending != 0u);
+
+    pending = recvDyn->ReadyMask;
+
+    /* #70 If requests are left, let pending interrupts of higher priority in, before the next pass starts. */
+    if(pending != 0u)
+    {
+      Os_IntResume(&interruptState);                                                                                    /* SBSW_OS_FC_POINTER2LOCAL */
+      Os_IntSuspend(&interruptState);                                                                                   /* SBSW_OS_FC_POINTER2LOCAL */
+
+      Os_Hal_XSigAcknowledge(xSigIsr->HwConfig);                                                                        /* SBSW_OS_XSIG_HAL_XSIGACKNOWLEDGE_001 */
+      pending = recvDyn->ReadyMask;
+    }
+  }
+
+  /* #80 Resume interrupts. */
+  Os_IntResume(&interruptState);                                                                                        /* SBSW_OS_FC_POINTER2LOCAL */
+}                                                                                                                       /* PRQA S 6080 */ /* MD_MSR_STMIF */
+
+
+/***********************************************************************************************************************
+ *  GLOBAL FUNCTIONS
+ **********************************************************************************************************************/
+
+
+/***********************************************************************************************************************
+ *  Os_XSigInit()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ */
+FUNC(void, OS_CODE) Os_XSigInit
+(
+  P2CONST(Os_XSigConfigType, AUTOMATIC, OS_CONST) XSignal
+)
+{
+  /* #10 If XSignal is enabled: */
+  if(Os_XSigIsEnabled() != 0u)                                                                                          /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */ /* COV_OS_HALPLATFORMMULTICOREUNSUPPORTED */
+  {
+    Os_CoreAsrCoreIdx itSendPort;
+    Os_ObjIdxType recvIsrCount;
+    Os_ObjIdx_IteratorType itReceivePort;
+
+    recvIsrCount = Os_XSigGetRecvIsrCount(XSignal);                                                                     /* SBSW_OS_FC_PRECONDITION */
+
+    /* #15 No batch is open. */
+    XSignal->Dyn->BatchDepth = 0u;                                                                                      /* SBSW_OS_XSIG_BATCHDEPTH_001 */
+    XSignal->Dyn->BatchThread = NULL_PTR;                                                                               /* SBSW_OS_XSIG_BATCHDEPTH_001 */
+
+    /* #20 Initialize the send ports. */
+    for(itSendPort = (Os_CoreAsrCoreIdx)0; itSendPort < OS_COREASRCOREIDX_COUNT; ++itSendPort)                          /* PRQA S 4332,  4527 */ /* MD_Os_Rule10.5_4332,  MD_Os_Rule10.1_4527 */ /* COMP_WARN_OS_CW_005 */
+    {
+      Os_XSigSendPortInit(Os_XSigGetSendPort(XSignal, itSendPort));                                                     /* SBSW_OS_XSIG_XSIGSENDPORTINIT_001 */ /* SBSW_OS_FC_PRECONDITION */
+    }
+
+    /* #30 Initialize the receiver ISRs. */
+    for(itReceivePort = 0; itReceivePort < (Os_ObjIdx_IteratorType) recvIsrCount; ++itReceivePort)
+    {
+      Os_XSigIsrInit(Os_XSigGetRecvIsr(XSignal, (Os_ObjIdxType) itReceivePort));                                        /* SBSW_OS_XSIG_XSIGISRINIT_001 */ /* SBSW_OS_FC_PRECONDITION */
+    }
+  }
+}
+
+
+/***********************************************************************************************************************
+ *  Os_XSigSendAsync()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ */
+FUNC(Os_StatusType, OS_CODE) Os_XSigSendAsync                                                                           /* COV_OS_HALPLATFORMTESTEDASMULTICORE */
+(
+  P2CONST(Os_CoreAsrConfigType, AUTOMATIC, OS_CONST) RecvCore,
+  P2CONST(Os_ThreadConfigType, AUTOMATIC, OS_CONST) SendThread,
+  Os_XSigFunctionIdx FunctionIdx,
+  P2CONST(Os_XSigParamsType, AUTOMATIC, TYPEDEF) Parameters
+)
+{
+  Os_StatusType status;
+
+  if(Os_XSigIsEnabled() != 0u)                                                                                          /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */
+  {
+    P2CONST(Os_XSigSendPortConfigType, AUTOMATIC, OS_CONST) sendPort;
+    Os_XSigComDataConfigRefType comData;
+
+    sendPort = Os_XSigGetSendPortToCore(SendThread, RecvCore);                                                          /* SBSW_OS_FC_PRECONDITION */
+
+    /* #10 Check that a send port to the receiver core exists. */
+    if(OS_UNLIKELY(sendPort == NULL_PTR))
+    {
+      status = OS_STATUS_CALL_NOT_ALLOWED;
+    }
+    /* #20 Trigger the transmission asynchronously. */
+    else
+    {
+      status = Os_XSigSendInternal(sendPort, SendThread, FunctionIdx, Parameters, OS_XSIGSTATE_ASYNC_NACK, 0u,          /* SBSW_OS_XSIG_XSIGSENDINTERNAL_001 */
+                                   &comData);
+    }
+  }
+  else
+  {
+    status = OS_STATUS_FUNCTION_UNAVAILABLE;
+  }
+
+  return status;
+}
+
+
+/***********************************************************************************************************************
+ *  Os_XSigSendSync()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ *
+ *
+ */
+FUNC(Os_StatusType, OS_CODE) Os_XSigSendSync                                                                            /* COV_OS_HALPLATFORMTESTEDASMULTICORE */
+(
+  P2CONST(Os_CoreAsrConfigType, AUTOMATIC, OS_CONST) RecvCore,
+  P2CONST(Os_ThreadConfigType, AUTOMATIC, OS_CONST) SendThread,
+  Os_XSigFunctionIdx FunctionIdx,
+  P2CONST(Os_XSigParamsType, AUTOMATIC, TYPEDEF) InParameters,
+  P2VAR(volatile Os_XSigOutputParamsType, AUTOMATIC, TYPEDEF) OutParameters
+)
+{
+  Os_StatusType status;
+
+  if(Os_XSigIsEnabled() != 0u)                                                                                          /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */
+  {
+    P2CONST(Os_XSigSendPortConfigType, AUTOMATIC, OS_CONST) sendPort;
+    Os_XSigComDataConfigRefType comData;
+
+    sendPort = Os_XSigGetSendPortToCore(SendThread, RecvCore);                                                          /* SBSW_OS_FC_PRECONDITION */
+
+    /* #10 Perform checks. */
+    if(OS_UNLIKELY(sendPort == NULL_PTR))
+    {
+      status = OS_STATUS_CALL_NOT_ALLOWED;
+    }
+    /*! Internal comment removed.
+ *
+ * */
+    else if(OS_UNLIKELY(Os_ThreadCheckCallContext(SendThread, OS_APICONTEXT_XSIGSENDSYNC) == OS_CHECK_FAILED))          /* SBSW_OS_FC_PRECONDITION */
+    {
+      status = OS_STATUS_CALLEVEL_CROSS_CORE_SYNC;
+    }
+    else
+    {
+      /* #20 Send the request. */
+      status = Os_XSigSendInternal(sendPort, SendThread, FunctionIdx, InParameters, OS_XSIGSTATE_SYNC_NACK, 0u,         /* SBSW_OS_XSIG_XSIGSENDINTERNAL_001 */
+                                   &comData);
+
+      if(status == OS_STATUS_OK)
+      {
+        /* #30 Wait until the result is available. */
+        while(Os_XSigChannelIsRequestHandled(&(sendPort->SendChannel), comData) == 0u)                                  /* SBSW_OS_XSIG_XSIGCHANNELISREQUESTHANDLED_001 */
+        {
+          /*! Internal comment removed.
+ *
+ *
+ * */
+          Os_Hal_CoreNop();
+        }
+
+        /* #40 Copy return data. */
+        status = comData->RecvData->ReturnData.Status;
+        (*OutParameters) = comData->RecvData->ReturnData.OutputParameter;                                               /* SBSW_OS_PWA_PRECONDITION */
+
+        /* #50 Free the communication element. */
+        comData->SendData->Acknowledge = OS_XSIGSTATE_ACK;                                                              /* SBSW_OS_XSIG_SENDDATA_002 */
+      }
+    }
+  }
+  else
+  {
+    status = OS_STATUS_FUNCTION_UNAVAILABLE;
+  }
+
+  return status;
+}                                                                                                                       /* PRQA S 6060, 6080 */ /* MD_MSR_STPAR, MD_MSR_STMIF */
+
+
+/***********************************************************************************************************************
+ *  Os_XSigSendRequest()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ *
+ */
+FUNC(Os_StatusType, OS_CODE) Os_XSigSendRequest                                                                         /* COV_OS_HALPLATFORMTESTEDASMULTICORE */
+(
+  P2CONST(Os_CoreAsrConfigType, AUTOMATIC, OS_CONST) RecvCore,
+  P2CONST(Os_ThreadConfigType, AUTOMATIC, OS_CONST) SendThread,
+  Os_XSigFunctionIdx FunctionIdx,
+  P2CONST(Os_XSigParamsType, AUTOMATIC, TYPEDEF) Parameters,
+  EventMaskType NotifyMask,
+  Os_AsyncCallRefType Call
+)
+{
+  Os_StatusType status;
+
+  if(Os_XSigIsEnabled() != 0u)                                                                                          /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */
+  {
+    P2CONST(Os_XSigSendPortConfigType, AUTOMATIC, OS_CONST) sendPort;
+    Os_XSigComDataConfigRefType comData;
+
+    sendPort = Os_XSigGetSendPortToCore(SendThread, RecvCore);                                                          /* SBSW_OS_FC_PRECONDITION */
+
+    /* #10 Check that a send port to the receiver core exists. */
+    if(OS_UNLIKELY(sendPort == NULL_PTR))
+    {
+      status = OS_STATUS_CALL_NOT_ALLOWED;
+    }
+    else
+    {
+      /* #20 If a notification is requested, check that the receiver is able to deliver it. */
+      status = OS_STATUS_OK;
+      if(NotifyMask != 0u)
+      {
+        status = Os_XSigCheckNotificationPath(sendPort, RecvCore, SendThread);                                          /* SBSW_OS_FC_PRECONDITION */
+      }
+
+      /* #30 Send the request. It keeps its communication element until the result has been fetched. */
+      if(status == OS_STATUS_OK)
+      {
+        status = Os_XSigSendInternal(sendPort, SendThread, FunctionIdx, Parameters, OS_XSIGSTATE_SYNC_NACK,             /* SBSW_OS_XSIG_XSIGSENDINTERNAL_001 */
+                                     NotifyMask, &comData);
+      }
+
+      /* #40 Let the handle refer to the communication element. */
+      if(status == OS_STATUS_OK)
+      {
+        Call->Port = (uint32)Os_CoreGetAsrCoreIdx(RecvCore);                                                            /* SBSW_OS_PWA_PRECONDITION */ /* SBSW_OS_FC_PRECONDITION */
+        Call->Element = (uint32)comData->Idx;                                                                           /* SBSW_OS_PWA_PRECONDITION */
+      }
+    }
+  }
+  else
+  {
+    status = OS_STATUS_FUNCTION_UNAVAILABLE;
+  }
+
+  return status;
+}                                                                                                                       /* PRQA S 6060 */ /* MD_MSR_STPAR */
+
+
+/***********************************************************************************************************************
+ *  Os_XSigCheckNotification()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
  *
  *
+ *
  */
-OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE, Os_XSigRecvPortInit,                      /* COV_OS_HALPLATFORMMULTICOREUNSUPPORTED */
+FUNC(Os_StatusType, OS_CODE) Os_XSigCheckNotification
 (
-  P2CONST(Os_XSigRecvPortConfigType, AUTOMATIC, OS_CONST) RecvPort
-))                                                                                                                      /* COV_OS_HALPLATFORMMULTICOREUNSUPPORTED */
+  P2CONST(Os_ThreadConfigType, AUTOMATIC, OS_CONST) SendThread,
+  EventMaskType NotifyMask
+)
 {
-  /* #10 Initialize the receiver side of the communication buffer. */
-  Os_XSigChannelReceiveInit(&(RecvPort->RecvChannel));                                                                  /* SBSW_OS_FC_PRECONDITION */
+  Os_StatusType status;
+
+  /* #10 If a notification is requested, the caller has to be an extended task. */
+  if(NotifyMask == 0u)
+  {
+    status = OS_STATUS_OK;
+  }
+  else if(OS_UNLIKELY(Os_ThreadIsTask(SendThread) == 0u))                                                               /* SBSW_OS_FC_PRECONDITION */
+  {
+    status = OS_STATUS_NOEXTENDEDTASK_CALLER;
+  }
+  else if(OS_UNLIKELY(Os_TaskCheckIsExtendedTask(Os_TaskThread2Task(SendThread)) == OS_CHECK_FAILED))                   /* SBSW_OS_XSIG_TASKCHECKISEXTENDEDTASK_001 */
+  {
+    status = OS_STATUS_NOEXTENDEDTASK_CALLER;
+  }
+  else
+  {
+    status = OS_STATUS_OK;
+  }
+
+  return status;
 }
 
 
 /***********************************************************************************************************************
- *  Os_XSigIsrInit()
+ *  Os_XSigCompleteLocal()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
  *
  *
- *
- *
  */
-OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE, Os_XSigIsrInit,                           /* COV_OS_HALPLATFORMMULTICOREUNSUPPORTED */
+FUNC(void, OS_CODE) Os_XSigCompleteLocal
 (
-    P2CONST(Os_XSigIsrConfigType, AUTOMATIC, OS_CONST) XSigIsr
-))                                                                                                                      /* COV_OS_HALPLATFORMMULTICOREUNSUPPORTED */
+  P2CONST(Os_ThreadConfigType, AUTOMATIC, OS_CONST) SendThread,
+  EventMaskType NotifyMask,
+  Os_AsyncCallRefType Call
+)
 {
-  Os_ObjIdx_IteratorType it;
-
-  /* #10 Initialize the base ISR. */
-  Os_IsrInit(&(XSigIsr->IsrCfg));                                                                                       /* SBSW_OS_FC_PRECONDITION */
-
-  /* #20 Initialize the hardware interrupt. */
-  Os_Hal_XSigInit(XSigIsr->HwConfig);                                                                                   /* SBSW_OS_XSIG_HAL_XSIGINIT_001 */
+  /* #10 Mark the handle as completed. */
+  Call->Element = OS_ASYNCCALL_COMPLETED;                                                                               /* SBSW_OS_PWA_PRECONDITION */
 
-  /* #30 Initialize the receiver ports. */
-  for(it = 0; it < (Os_ObjIdx_IteratorType) XSigIsr->RecvPortCount; ++it)
+  /* #20 Notify the calling task, if requested. As it is the running task, no task switch is needed. */
+  if(NotifyMask != 0u)
   {
-    Os_XSigRecvPortInit(XSigIsr->RecvPortRefs[it]);                                                                     /* SBSW_OS_XSIG_XSIGRECVPORTINIT_001 */
+    (void)Os_EventSetInternal(Os_TaskThread2Task(SendThread), NotifyMask);                                              /* SBSW_OS_XSIG_EVENTSETINTERNAL_002 */
   }
 }
 
 
 /***********************************************************************************************************************
- *  Os_XSigThread2XSigIsr()
- **********************************************************************************************************************/
-OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE P2CONST(Os_XSigIsrConfigType, AUTOMATIC, OS_CONST), OS_CODE,               /* COV_OS_HALPLATFORMMULTICOREUNSUPPORTED */
-OS_ALWAYS_INLINE, Os_XSigThread2XSigIsr,
-(
-  P2CONST(Os_ThreadConfigType, AUTOMATIC, OS_CONST) Thread
-))                                                                                                                      /* COV_OS_HALPLATFORMMULTICOREUNSUPPORTED */
-{
-  return (P2CONST(Os_XSigIsrConfigType, AUTOMATIC, OS_CONST))Thread;                                                    /* PRQA S 0310 */ /* MD_Os_Rule11.3_0310 */
-}
-
-
-/***********************************************************************************************************************
- *  ISR(Os_XSigRecvIsrHandler)
+ *  Os_Api_GetAsyncCallResult()
  **********************************************************************************************************************/
 /*!
- *
  * Internal comment removed.
  *
  *
@@ -797,110 +1639,128 @@ OS_ALWAYS_INLINE, Os_XSigThread2XSigIsr,
  *
  *
  *
- *
- *
- *
- *
- *
- *
- *
  */
-
-ISR(Os_XSigRecvIsrHandler)                                                                                              /* COV_OS_HALPLATFORMMULTICOREUNSUPPORTED */
+FUNC(Os_StatusType, OS_CODE) Os_Api_GetAsyncCallResult
+(
+  Os_AsyncCallRefType Call
+)
 {
-  P2CONST(Os_XSigIsrConfigType, AUTOMATIC, OS_CONST) xSigIsr;
   Os_StatusType status;
-  Os_IntStateType interruptState;
-  uint8_least messageReceived;
-
-  xSigIsr = Os_XSigThread2XSigIsr(Os_CoreGetThread());                                                                  /* SBSW_OS_XSIG_XSIGTHREAD2XSIGISR_001 */
+  uint32 port;
+  uint32 element;
 
-  /* #10 Suspend interrupts. */
-  Os_IntSuspend(&interruptState);                                                                                       /* SBSW_OS_FC_POINTER2LOCAL */
+  /* #10 Read the handle once, as it is located in user memory. */
+  port = Call->Port;
+  element = Call->Element;
 
-  /* #20 Loop. */
-  do
+  /* #20 A completed call has no pending result. */
+  if(element == OS_ASYNCCALL_COMPLETED)
   {
-    Os_ObjIdx_IteratorType it;
-
-    messageReceived = 0;
+    status = OS_STATUS_OK;
+  }
+  /* #30 Without XSignal there are no remote calls. */
+  else if(Os_XSigIsEnabled() == 0u)                                                                                     /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */
+  {
+    status = OS_STATUS_NOFUNC_ASYNCCALL_1;
+  }
+  else if(OS_UNLIKELY(Os_ErrIsValueLo(port, (uint32)OS_COREASRCOREIDX_COUNT) == 0u))
+  {
+    status = OS_STATUS_NOFUNC_ASYNCCALL_1;
+  }
+  else
+  {
+    P2CONST(Os_ThreadConfigType, AUTOMATIC, OS_CONST) currentThread;
+    P2CONST(Os_XSigSendPortConfigType, AUTOMATIC, OS_CONST) sendPort;
+    P2CONST(Os_XSigComDataConfigType, AUTOMATIC, OS_CONST) comData;
 
-    /* #30 Acknowledge the interrupt. */
-    Os_Hal_XSigAcknowledge(xSigIsr->HwConfig);                                                                          /* SBSW_OS_XSIG_HAL_XSIGACKNOWLEDGE_001 */
+    currentThread = Os_CoreGetThread();
 
-    /* #30 Loop over all incoming ports. */
-    for(it = 0; it < (Os_ObjIdx_IteratorType) xSigIsr->RecvPortCount; ++it)
+    /* #40 Look up the communication element of the handle. */
+    sendPort = Os_XSigGetSendPort(Os_CoreGetXSig(Os_ThreadGetCore(currentThread)), (Os_CoreAsrCoreIdx)port);            /* PRQA S 4342 */ /* MD_Os_Rule10.5_4342 */ /* SBSW_OS_XSIG_XSIGGETSENDPORT_002 */
+    comData = NULL_PTR;
+    if(sendPort != NULL_PTR)
     {
-      P2CONST(Os_XSigRecvPortConfigType, AUTOMATIC, OS_CONST) recvPort;
-      P2CONST(Os_CoreAsrConfigType, AUTOMATIC, OS_CONST) sendCore;
-
-      recvPort = xSigIsr->RecvPortRefs[it];
-      sendCore = recvPort->SendPort->SendCore;
+      comData = Os_XSigChannelGetElement(&(sendPort->SendChannel), element);                                            /* SBSW_OS_XSIG_XSIGCHANNEL_001 */
+    }
 
-      /* #40 If the core was started as AUTOSAR core: */
-      if(Os_CoreIsStartedAsAsr(Os_CoreAsr2Core(sendCore)) != 0u)                                                        /* SBSW_OS_XSIG_COREISSTARTEDASASR */ /* SBSW_OS_XSIG_COREASR2CORE_001 */
+    /* #50 Check that the element carries an asynchronous call of the caller. */
+    if(OS_UNLIKELY(comData == NULL_PTR))
+    {
+      status = OS_STATUS_NOFUNC_ASYNCCALL_1;
+    }
+    else if(OS_UNLIKELY(comData->SendData->Sender != currentThread))
+    {
+      status = OS_STATUS_NOFUNC_ASYNCCALL_1;
+    }
+    else if(OS_UNLIKELY((comData->SendData->Acknowledge != OS_XSIGSTATE_SYNC_NACK)
+                     && (comData->SendData->Acknowledge != OS_XSIGSTATE_SYNC_PENDING)))
+    {
+      status = OS_STATUS_NOFUNC_ASYNCCALL_1;
+    }
+    /* #60 Check whether the receiver has handled the call. */
+    else if(Os_XSigChannelIsRequestHandled(&(sendPort->SendChannel), comData) == 0u)                                    /* SBSW_OS_XSIG_XSIGCHANNEL_001 */
+    {
+      status = OS_STATUS_CROSS_CORE_REQUESTED;
+    }
+    else
+    {
+      /* #70 Copy the return data. */
+      status = comData->RecvData->ReturnData.Status;
+      if(comData->SendData->FunctionIdx == XSigFunctionIdx_GetTaskState)
       {
-        /* #50 If the sender's channel index is valid: */
-        if(Os_XSigChannelReceiveCheckInRange(&(recvPort->RecvChannel)) != 0u)                                           /* SBSW_OS_XSIG_XSIGCHANNELRECEIVECHECKINRANGE */
-        {
-          /* #60 If the core has send a request: */
-          if(Os_XSigChannelIsReceiveElementAvailable(&(recvPort->RecvChannel)) != 0u)                                   /* SBSW_OS_XSIG_XSIGCHANNELISRECEIVEELEMENTAVAILABLE_001 */
-          {
-            P2CONST(Os_XSigComDataConfigType, AUTOMATIC, OS_CONST) comData;
-            P2CONST(Os_XSigSendDataType volatile, AUTOMATIC, OS_VAR_NOINIT) sendData;
-
-            /* #70 Check that the received data is valid. */
-            comData = Os_XSigChannelGetReceiveElement(&(recvPort->RecvChannel));                                        /* SBSW_OS_XSIG_XSIGCHANNELGETRECEIVEELEMENT_001 */
-            if(Os_XSigRecvCheckIsReceiveElementValid(comData) != 0u)                                                    /* SBSW_OS_XSIGRECVCHECKISRECEIVEELEMENTVALID_001 */
-            {
-              sendData = comData->SendData;
-
-              /* #80 Check that the function is available. */
-              if(Os_XSigRecvCheckIsFunctionAvailable(xSigIsr, sendData->FunctionIdx) == OS_CHECK_FAILED)                /* SBSW_OS_XSIG_XSIGRECVCHECKISFUNCTIONAVAILABLE_001 */ /* PRQA S 2991, 2995 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule2.2_2995 */
-              {
-                status = OS_STATUS_FUNCTION_UNAVAILABLE;
-              }
-              /* #90 Call the respective function. */
-              else
-              {
-                Os_XSigFunctionType functionRef;
-                P2CONST(Os_XSigParamsType, AUTOMATIC, OS_VAR_NOINIT) inParameter;
-                P2VAR(Os_XSigOutputParamsType, AUTOMATIC, OS_VAR_NOINIT) outParameter;
-
-                /* Explicitly cast pointers to volatile data to non volatile data. */
-                inParameter = ((P2CONST(Os_XSigParamsType, AUTOMATIC, OS_VAR_NOINIT))&(sendData->ParameterData));       /* PRQA S 0312 */ /* MD_Os_Rule11.8_0312_Volatile */ /* COMP_WARN_OS_VOLATILE_CAST */
-                outParameter = ((P2VAR(Os_XSigOutputParamsType, AUTOMATIC, OS_VAR_NOINIT))                              /* PRQA S 0312 */ /* MD_Os_Rule11.8_0312_Volatile */ /* COMP_WARN_OS_VOLATILE_CAST */
-                    &(comData->RecvData->ReturnData.OutputParameter));
-
-                functionRef = xSigIsr->FunctionTable->FunctionDescription[sendData->FunctionIdx].FunctionRef;           /* PRQA S 2842 */ /* MD_Os_Rule18.1_2842_Check */
-
-                status = functionRef(sendData->SenderApp, inParameter, outParameter);                                   /* SBSW_OS_XSIG_CALLCACK_001 */
-              }
-
-              /* #100 Reply. */
-              comData->RecvData->ReturnData.Status = status;                                                            /* SBSW_OS_XSIG_RECVDATA_001 */
-            }
-            Os_XSigChannelReply(&(recvPort->RecvChannel));                                                              /* SBSW_OS_XSIG_XSIGCHANNELREPLY_001 */
-            messageReceived = 1;
-          }
-        }
+        Call->State = comData->RecvData->ReturnData.OutputParameter.ParameterData.ParamTaskStateType;                   /* SBSW_OS_PWA_PRECONDITION */
+      }
+      else
+      {
+        Call->Tick = comData->RecvData->ReturnData.OutputParameter.ParameterData.ParamTickType;                         /* SBSW_OS_PWA_PRECONDITION */
       }
+
+      /* #80 Free the communication element and complete the handle. */
+      comData->SendData->Acknowledge = OS_XSIGSTATE_ACK;                                                                /* SBSW_OS_XSIG_SENDDATA_003 */
+      Call->Element = OS_ASYNCCALL_COMPLETED;                                                                           /* SBSW_OS_PWA_PRECONDITION */
     }
-    /* #110 While any buffer had entries. */
-  } while(messageReceived != 0u);
+  }
 
-  /* #120 Resume interrupts. */
-  Os_IntResume(&interruptState);                                                                                        /* SBSW_OS_FC_POINTER2LOCAL */
-}                                                                                                                       /* PRQA S 6050, 6080 */ /* MD_MSR_STCAL, MD_MSR_STMIF */
+  return status;
+}                                                                                                                       /* PRQA S 6080 */ /* MD_MSR_STMIF */
 
 
 /***********************************************************************************************************************
- *  GLOBAL FUNCTIONS
+ *  Os_XSigBatchBegin()
  **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ */
+FUNC(void, OS_CODE) Os_XSigBatchBegin                                                                                   /* COV_OS_HALPLATFORMTESTEDASMULTICORE */
+(
+  P2CONST(Os_ThreadConfigType, AUTOMATIC, OS_CONST) SendThread
+)
+{
+  if(Os_XSigIsEnabled() != 0u)                                                                                          /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */
+  {
+    P2CONST(Os_XSigConfigType, AUTOMATIC, OS_CONST) xSignal;
+    Os_IntStateType interruptState;
+
+    xSignal = Os_CoreGetXSig(Os_ThreadGetCore(SendThread));                                                             /* SBSW_OS_XSIG_COREGETXSIG_001 */ /* SBSW_OS_FC_PRECONDITION */
+
+    /* #10 Open a further batch level. Interrupts are suspended, as ISRs of this core may send requests as well.
+     *     Remember the thread, which opened the outermost level. */
+    Os_IntSuspend(&interruptState);                                                                                     /* SBSW_OS_FC_POINTER2LOCAL */
+    if(xSignal->Dyn->BatchDepth == 0u)
+    {
+      xSignal->Dyn->BatchThread = SendThread;                                                                           /* SBSW_OS_XSIG_BATCHDEPTH_001 */
+    }
+    xSignal->Dyn->BatchDepth++;                                                                                         /* SBSW_OS_XSIG_BATCHDEPTH_001 */
+    Os_IntResume(&interruptState);                                                                                      /* SBSW_OS_FC_POINTER2LOCAL */
+  }
+}
 
 
 /***********************************************************************************************************************
- *  Os_XSigInit()
+ *  Os_XSigBatchFlush()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -908,38 +1768,41 @@ ISR(Os_XSigRecvIsrHandler)
  *
  *
  *
+ *
  */
-FUNC(void, OS_CODE) Os_XSigInit
+FUNC(void, OS_CODE) Os_XSigBatchFlush                                                                                   /* COV_OS_HALPLATFORMTESTEDASMULTICORE */
 (
-  P2CONST(Os_XSigConfigType, AUTOMATIC, OS_CONST) XSignal
+  P2CONST(Os_ThreadConfigType, AUTOMATIC, OS_CONST) SendThread
 )
 {
-  /* #10 If XSignal is enabled: */
-  if(Os_XSigIsEnabled() != 0u)                                                                                          /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */ /* COV_OS_HALPLATFORMMULTICOREUNSUPPORTED */
+  if(Os_XSigIsEnabled() != 0u)                                                                                          /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */
   {
-    Os_CoreAsrCoreIdx itSendPort;
-    Os_ObjIdxType recvIsrCount;
-    Os_ObjIdx_IteratorType itReceivePort;
+    P2CONST(Os_XSigConfigType, AUTOMATIC, OS_CONST) xSignal;
+    Os_IntStateType interruptState;
 
-    recvIsrCount = Os_XSigGetRecvIsrCount(XSignal);                                                                     /* SBSW_OS_FC_PRECONDITION */
+    xSignal = Os_CoreGetXSig(Os_ThreadGetCore(SendThread));                                                             /* SBSW_OS_XSIG_COREGETXSIG_001 */ /* SBSW_OS_FC_PRECONDITION */
 
-    /* #20 Initialize the send ports. */
-    for(itSendPort = (Os_CoreAsrCoreIdx)0; itSendPort < OS_COREASRCOREIDX_COUNT; ++itSendPort)                          /* PRQA S 4332,  4527 */ /* MD_Os_Rule10.5_4332,  MD_Os_Rule10.1_4527 */ /* COMP_WARN_OS_CW_005 */
-    {
-      Os_XSigSendPortInit(Os_XSigGetSendPort(XSignal, itSendPort));                                                     /* SBSW_OS_XSIG_XSIGSENDPORTINIT_001 */ /* SBSW_OS_FC_PRECONDITION */
-    }
+    Os_IntSuspend(&interruptState);                                                                                     /* SBSW_OS_FC_POINTER2LOCAL */
 
-    /* #30 Initialize the receiver ISRs. */
-    for(itReceivePort = 0; itReceivePort < (Os_ObjIdx_IteratorType) recvIsrCount; ++itReceivePort)
+    Os_Assert((Os_StdReturnType)(xSignal->Dyn->BatchDepth > 0u));                                                       /* PRQA S 4304 */ /* MD_Os_C90BooleanCompatibility */
+
+    /* #10 Close the current batch level. */
+    xSignal->Dyn->BatchDepth--;                                                                                         /* SBSW_OS_XSIG_BATCHDEPTH_001 */
+
+    /* #20 If the outermost batch has been closed, trigger the receivers. */
+    if(xSignal->Dyn->BatchDepth == 0u)
     {
-      Os_XSigIsrInit(Os_XSigGetRecvIsr(XSignal, (Os_ObjIdxType) itReceivePort));                                        /* SBSW_OS_XSIG_XSIGISRINIT_001 */ /* SBSW_OS_FC_PRECONDITION */
+      xSignal->Dyn->BatchThread = NULL_PTR;                                                                             /* SBSW_OS_XSIG_BATCHDEPTH_001 */
+      Os_XSigBatchTrigger(xSignal);                                                                                     /* SBSW_OS_FC_PRECONDITION */
     }
+
+    Os_IntResume(&interruptState);                                                                                      /* SBSW_OS_FC_POINTER2LOCAL */
   }
-}
+}                                                                                                                       /* PRQA S 6080 */ /* MD_MSR_STMIF */
 
 
 /***********************************************************************************************************************
- *  Os_XSigSendAsync()
+ *  Os_XSigBatchAbort()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
@@ -947,118 +1810,75 @@ FUNC(void, OS_CODE) Os_XSigInit
  *
  *
  */
-FUNC(Os_StatusType, OS_CODE) Os_XSigSendAsync                                                                           /* COV_OS_HALPLATFORMTESTEDASMULTICORE */
+FUNC(void, OS_CODE) Os_XSigBatchAbort                                                                                   /* COV_OS_HALPLATFORMTESTEDASMULTICORE */
 (
-  P2CONST(Os_CoreAsrConfigType, AUTOMATIC, OS_CONST) RecvCore,
-  P2CONST(Os_ThreadConfigType, AUTOMATIC, OS_CONST) SendThread,
-  Os_XSigFunctionIdx FunctionIdx,
-  P2CONST(Os_XSigParamsType, AUTOMATIC, TYPEDEF) Parameters
+  P2CONST(Os_ThreadConfigType, AUTOMATIC, OS_CONST) Thread
 )
 {
-  Os_StatusType status;
-
   if(Os_XSigIsEnabled() != 0u)                                                                                          /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */
   {
-    P2CONST(Os_XSigSendPortConfigType, AUTOMATIC, OS_CONST) sendPort;
-    Os_XSigComDataConfigRefType comData;
+    P2CONST(Os_XSigConfigType, AUTOMATIC, OS_CONST) xSignal;
+    Os_IntStateType interruptState;
 
-    sendPort = Os_XSigGetSendPortToCore(SendThread, RecvCore);                                                          /* SBSW_OS_FC_PRECONDITION */
+    xSignal = Os_CoreGetXSig(Os_ThreadGetCore(Thread));                                                                 /* SBSW_OS_XSIG_COREGETXSIG_001 */ /* SBSW_OS_FC_PRECONDITION */
 
-    /* #10 Check that a send port to the receiver core exists. */
-    if(OS_UNLIKELY(sendPort == NULL_PTR))
-    {
-      status = OS_STATUS_CALL_NOT_ALLOWED;
-    }
-    /* #20 Trigger the transmission asynchronously. */
-    else
+    Os_IntSuspend(&interruptState);                                                                                     /* SBSW_OS_FC_POINTER2LOCAL */
+
+    /* #10 If the given thread has opened a batch, close all its levels and trigger the receivers of the requests
+     *     sent so far. */
+    if((xSignal->Dyn->BatchDepth != 0u) && (xSignal->Dyn->BatchThread == Thread))
     {
-      status = Os_XSigSendInternal(sendPort, SendThread, FunctionIdx, Parameters, OS_XSIGSTATE_ASYNC_NACK, &comData);   /* SBSW_OS_XSIG_XSIGSENDINTERNAL_001 */
+      xSignal->Dyn->BatchDepth = 0u;                                                                                    /* SBSW_OS_XSIG_BATCHDEPTH_001 */
+      xSignal->Dyn->BatchThread = NULL_PTR;                                                                             /* SBSW_OS_XSIG_BATCHDEPTH_001 */
+      Os_XSigBatchTrigger(xSignal);                                                                                     /* SBSW_OS_FC_PRECONDITION */
     }
-  }
-  else
-  {
-    status = OS_STATUS_FUNCTION_UNAVAILABLE;
-  }
 
-  return status;
+    Os_IntResume(&interruptState);                                                                                      /* SBSW_OS_FC_POINTER2LOCAL */
+  }
 }
 
 
 /***********************************************************************************************************************
- *  Os_XSigSendSync()
+ *  Os_XSigRequestAbort()
  **********************************************************************************************************************/
 /*!
  * Internal comment removed.
  *
  *
  *
- *
- *
- *
  */
-FUNC(Os_StatusType, OS_CODE) Os_XSigSendSync                                                                            /* COV_OS_HALPLATFORMTESTEDASMULTICORE */
+FUNC(void, OS_CODE) Os_XSigRequestAbort                                                                                 /* COV_OS_HALPLATFORMTESTEDASMULTICORE */
 (
-  P2CONST(Os_CoreAsrConfigType, AUTOMATIC, OS_CONST) RecvCore,
-  P2CONST(Os_ThreadConfigType, AUTOMATIC, OS_CONST) SendThread,
-  Os_XSigFunctionIdx FunctionIdx,
-  P2CONST(Os_XSigParamsType, AUTOMATIC, TYPEDEF) InParameters,
-  P2VAR(volatile Os_XSigOutputParamsType, AUTOMATIC, TYPEDEF) OutParameters
+  P2CONST(Os_ThreadConfigType, AUTOMATIC, OS_CONST) Thread
 )
 {
-  Os_StatusType status;
-
   if(Os_XSigIsEnabled() != 0u)                                                                                          /* PRQA S 2991, 2992, 2995, 2996 */ /* MD_Os_Rule14.3_2991, MD_Os_Rule14.3_2992, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */
   {
-    P2CONST(Os_XSigSendPortConfigType, AUTOMATIC, OS_CONST) sendPort;
-    Os_XSigComDataConfigRefType comData;
+    P2CONST(Os_XSigConfigType, AUTOMATIC, OS_CONST) xSignal;
+    Os_CoreAsrCoreIdx itSendPort;
+    Os_IntStateType interruptState;
 
-    sendPort = Os_XSigGetSendPortToCore(SendThread, RecvCore);                                                          /* SBSW_OS_FC_PRECONDITION */
+    xSignal = Os_CoreGetXSig(Os_ThreadGetCore(Thread));                                                                 /* SBSW_OS_XSIG_COREGETXSIG_001 */ /* SBSW_OS_FC_PRECONDITION */
 
-    /* #10 Perform checks. */
-    if(OS_UNLIKELY(sendPort == NULL_PTR))
-    {
-      status = OS_STATUS_CALL_NOT_ALLOWED;
-    }
-    /*! Internal comment removed.
- *
- * */
-    else if(OS_UNLIKELY(Os_ThreadCheckCallContext(SendThread, OS_APICONTEXT_XSIGSENDSYNC) == OS_CHECK_FAILED))          /* SBSW_OS_FC_PRECONDITION */
-    {
-      status = OS_STATUS_CALLEVEL_CROSS_CORE_SYNC;
-    }
-    else
-    {
-      /* #20 Send the request. */
-      status = Os_XSigSendInternal(sendPort, SendThread, FunctionIdx, InParameters, OS_XSIGSTATE_SYNC_NACK, &comData);  /* SBSW_OS_XSIG_XSIGSENDINTERNAL_001 */
+    Os_IntSuspend(&interruptState);                                                                                     /* SBSW_OS_FC_POINTER2LOCAL */
 
-      if(status == OS_STATUS_OK)
-      {
-        /* #30 Wait until the result is available. */
-        while(Os_XSigChannelIsRequestHandled(&(sendPort->SendChannel), comData) == 0u)                                  /* SBSW_OS_XSIG_XSIGCHANNELISREQUESTHANDLED_001 */
-        {
-          /*! Internal comment removed.
- *
- *
- * */
-          Os_Hal_CoreNop();
-        }
+    /* #10 For each send port of the core of the given thread: */
+    for(itSendPort = (Os_CoreAsrCoreIdx)0; itSendPort < OS_COREASRCOREIDX_COUNT; ++itSendPort)                          /* PRQA S 4332,  4527 */ /* MD_Os_Rule10.5_4332,  MD_Os_Rule10.1_4527 */ /* COMP_WARN_OS_CW_005 */
+    {
+      P2CONST(Os_XSigSendPortConfigType, AUTOMATIC, OS_CONST) sendPort;
 
-        /* #40 Copy return data. */
-        status = comData->RecvData->ReturnData.Status;
-        (*OutParameters) = comData->RecvData->ReturnData.OutputParameter;                                               /* SBSW_OS_PWA_PRECONDITION */
+      sendPort = Os_XSigGetSendPort(xSignal, itSendPort);                                                               /* SBSW_OS_XSIG_XSIGGETSENDPORT_001 */
 
-        /* #50 Free the communication element. */
-        comData->SendData->Acknowledge = OS_XSIGSTATE_ACK;                                                              /* SBSW_OS_XSIG_SENDDATA_002 */
+      /* #20 Free the communication elements of all synchronous requests of the thread. */
+      if(sendPort != NULL_PTR)
+      {
+        Os_XSigChannelReleaseSyncRequests(&(sendPort->SendChannel), Thread);                                            /* SBSW_OS_XSIG_XSIGCHANNEL_001 */
       }
     }
-  }
-  else
-  {
-    status = OS_STATUS_FUNCTION_UNAVAILABLE;
-  }
 
-  return status;
-}                                                                                                                       /* PRQA S 6060, 6080 */ /* MD_MSR_STPAR, MD_MSR_STMIF */
+    Os_IntResume(&interruptState);                                                                                      /* SBSW_OS_FC_POINTER2LOCAL */
+  }
+}
 
 
 /***********************************************************************************************************************
@@ -2602,6 +3422,30 @@ FUNC(Os_StatusType, OS_CODE) Os_XSigRecv_HookCallCallback
  \COUNTERMEASURE \M [CM_OS_XSIGSENDPORT_ISR_M]
                  \M [CM_OS_XSIGISR_HWCONFIG_M]
 
+\ID SBSW_OS_XSIG_HAL_XSIGTRIGGER_002
+ \DESCRIPTION    Os_Hal_XSigTrigger is called with the HwConfig derived from a XSigIsr. The XSigIsr is derived
+                 from a SendPort returned by Os_XSigGetSendPort, which is checked against NULL_PTR.
+ \COUNTERMEASURE \M [CM_OS_XSIGSENDPORT_ISR_M]
+                 \M [CM_OS_XSIGISR_HWCONFIG_M]
+
+\ID SBSW_OS_XSIG_XSIGCHANNEL_001
+ \DESCRIPTION    A channel function is called with the SendChannel of a SendPort returned by Os_XSigGetSendPort,
+                 which is checked against NULL_PTR.
+ \COUNTERMEASURE \R [CM_OS_XSIGGETSENDPORTTOCORE_02_02_R]
+
+\ID SBSW_OS_XSIG_COREGETXSIG_002
+ \DESCRIPTION    Os_CoreGetXSig is called with the SendCore of a SendPort passed as argument to the caller function.
+                 The returned XSignal is used to access its Dyn reference.
+ \COUNTERMEASURE \M [CM_OS_XSIGSENDPORTGETSENDCORE_M]
+                 \M [CM_OS_COREASR_XSIGNAL_M]
+                 \M [CM_OS_XSIG_DYN_M]
+
+\ID SBSW_OS_XSIG_BATCHDEPTH_001
+ \DESCRIPTION    Write access to the Dyn reference of a XSignal object. The XSignal object is passed as argument or
+                 returned by Os_CoreGetXSig.
+ \COUNTERMEASURE \M [CM_OS_COREASR_XSIGNAL_M]
+                 \M [CM_OS_XSIG_DYN_M]
+
 \ID SBSW_OS_XSIG_HAL_XSIGINIT_001
  \DESCRIPTION    Os_Hal_XSigInit is called with the HwConfig derived from a XSigIsr. The XSigIsr is passed as
                  argument to the caller function. The correctness of the caller argument
@@ -3015,6 +3859,59 @@ FUNC(Os_StatusType, OS_CODE) Os_XSigRecv_HookCallCallback
                  \M [CM_OS_XSIGRECVPORT_M]
                  \R [CM_OS_XSIG_INDEX_R]
 
+\ID SBSW_OS_XSIG_RECVDYN_001
+ \DESCRIPTION    Write access to the ReadyMask of the RecvDyn of a XSigIsr. The XSigIsr is either derived from a
+                 SendPort or returned by Os_XSigThread2XSigIsr.
+ \COUNTERMEASURE \M [CM_OS_XSIGSENDPORT_ISR_M]
+                 \M [CM_OS_XSIGTHREAD2XSIGISR_M]
+                 \M [CM_OS_XSIGISR_RECVDYN_M]
+
+\ID SBSW_OS_XSIG_XSIGRECVPORTHANDLE_001
+ \DESCRIPTION    Os_XSigRecvPortHandle is called with a XSigIsr returned by Os_XSigThread2XSigIsr and a receive port
+                 derived with an index from the receive port list of this XSigIsr. The index is derived from a bit of
+                 the ReadyMask, which is only set by the SendPorts of the RecvPorts of the XSigIsr.
+ \COUNTERMEASURE \M [CM_OS_XSIGTHREAD2XSIGISR_M]
+                 \M [CM_OS_XSIGISR_RECVPORTREFS_01_03_M]
+                 \M [CM_OS_XSIGISR_RECVPORTREFS_02_03_M]
+                 \M [CM_OS_XSIGRECVPORT_M]
+                 \M [CM_OS_XSIGSENDPORT_READYBIT_M]
+
+\ID SBSW_OS_XSIG_EVENTSETINTERNAL_002
+ \DESCRIPTION    Os_EventSetInternal is called with the return value of Os_TaskThread2Task. The caller has checked
+                 that the thread is a task (see Os_XSigCheckNotification).
+ \COUNTERMEASURE \R [CM_OS_TASKTHREAD2TASK_R]
+
+\ID SBSW_OS_XSIG_XSIGRECVCHECKISFUNCTIONAVAILABLE_002
+ \DESCRIPTION    Os_XSigRecvCheckIsFunctionAvailable is called with the XSigIsr of a SendPort returned by
+                 Os_XSigGetSendPort, which is checked against NULL_PTR.
+ \COUNTERMEASURE \R [CM_OS_XSIGGETSENDPORTTOCORE_02_02_R]
+                 \M [CM_OS_XSIGSENDPORT_ISR_M]
+
+\ID SBSW_OS_XSIG_XSIGRECVNOTIFY_001
+ \DESCRIPTION    Os_XSigRecvNotify is called with the NotifyTask of the send data of a received element. The
+                 NotifyTask is only used, if NotifyMask is not 0, in which case the sender has set it to the return
+                 value of Os_TaskThread2Task.
+ \COUNTERMEASURE \R [CM_OS_XSIGSENDDATA_NOTIFYTASK_R]
+                 \R [CM_OS_TASKTHREAD2TASK_R]
+
+\ID SBSW_OS_XSIG_TASKGETACCESSINGAPPLICATIONS_002
+ \DESCRIPTION    Os_TaskGetAccessingApplications is called with the return value of Os_TaskThread2Task. The caller has
+                 checked that the thread is a task (see Os_XSigCheckNotification).
+ \COUNTERMEASURE \R [CM_OS_TASKTHREAD2TASK_R]
+
+\ID SBSW_OS_XSIG_TASKCHECKISEXTENDEDTASK_001
+ \DESCRIPTION    Os_TaskCheckIsExtendedTask is called with the return value of Os_TaskThread2Task.
+ \COUNTERMEASURE \R [CM_OS_TASKTHREAD2TASK_R]
+
+\ID SBSW_OS_XSIG_XSIGGETSENDPORT_002
+ \DESCRIPTION    Os_XSigGetSendPort is called with the XSignal of the current core and an index taken from user memory.
+ \COUNTERMEASURE \R [CM_OS_XSIGGETSENDPORT_02_02_R]
+
+\ID SBSW_OS_XSIG_SENDDATA_003
+ \DESCRIPTION    Write access to the send data derived from the return value of Os_XSigChannelGetElement.
+ \COUNTERMEASURE \R [CM_OS_XSIGCHANNELGETELEMENT_R]
+                 \M [CM_OS_XSIGCOM_SENDDATA_M]
+
 
 SBSW_JUSTIFICATION_END */
 
@@ -3053,6 +3950,9 @@ SBSW_JUSTIFICATION_END */
 \CM CM_OS_XSIGISR_HWCONFIG_M
       Verify that the HwConfig reference of each XSigIsr instance is a non NULL_PTR.
 
+\CM CM_OS_XSIG_DYN_M
+      Verify that the Dyn reference of each Os_XSigConfigType object is a non NULL_PTR.
+
 \CM CM_OS_XSIGCOM_SENDDATA_M
       Verify that each SendData reference of each XSigCom instance is a non NULL_PTR.
 
@@ -3095,6 +3995,21 @@ SBSW_JUSTIFICATION_END */
 \CM CM_OS_XSIGISR_FUNCTIONTABLE_M
       Verify that the FunctionTable reference of each XSigIsr is a non NULL_PTR.
 
+\CM CM_OS_XSIGISR_RECVDYN_M
+      Verify that the RecvDyn reference of each XSigIsr is a non NULL_PTR.
+
+\CM CM_OS_XSIGSENDPORT_READYBIT_M
+      Verify that:
+        1. the RecvPortCount of each XSigIsr is lower than or equal to OS_BITFIELD_BITWIDTH and
+        2. the ReadyBit of each SendPort equals OS_BITFIELD_MASK_MSB shifted right by the index of its RecvPort in the
+           RecvPortRefs of its XSigIsr.
+
+\CM CM_OS_XSIGSENDDATA_NOTIFYTASK_R
+      Implementation ensures that NotifyTask is written together with a non zero NotifyMask.
+
+\CM CM_OS_XSIGCHANNELGETELEMENT_R
+      Implementation ensures, that the returned value is not used if it is a NULL_PTR.
+
 \CM CM_OS_XSIGFUNCTIONTABLE_FUNCTIONDESCRIPTION_M
       Verify that each function refers either to the receive callback function which belongs to the corresponding
       enum identifier or that the function reference is a NULL_PTR.
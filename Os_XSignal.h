@@ -118,6 +118,19 @@ OS_ALWAYS_INLINE, Os_XSigUseAsynchronous,
 }
 
 
+/***********************************************************************************************************************
+ *  Os_XSigUseCoalescing()
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE Os_StdReturnType, OS_CODE,                                                 /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */ /* COV_OS_HALPLATFORMMULTICOREUNSUPPORTED */
+OS_ALWAYS_INLINE, Os_XSigUseCoalescing,
+(
+  void
+))                                                                                                                      /* COV_OS_HALPLATFORMMULTICOREUNSUPPORTED */
+{
+  return (OS_CFG_XSIG_COALESCING == STD_ON);                                                                            /* PRQA S 4304, 4404, 2995, 2996 */ /* MD_Os_C90BooleanCompatibility, MD_Os_C90BooleanCompatibility, MD_Os_Rule2.2_2995, MD_Os_Rule2.2_2996 */
+}
+
+
 /***********************************************************************************************************************
  *  Os_XSigSend()
  **********************************************************************************************************************/
@@ -272,6 +285,93 @@ OS_ALWAYS_INLINE, Os_XSigSend_GetCounterValue,
 }
 
 
+/***********************************************************************************************************************
+ *  Os_XSigSendRequest_GetTaskState()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE Os_StatusType, OS_CODE,                                                    /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */ /* COV_OS_HALPLATFORMMULTICOREUNSUPPORTED */
+OS_ALWAYS_INLINE, Os_XSigSendRequest_GetTaskState,
+(
+  P2CONST(Os_CoreAsrConfigType, AUTOMATIC, OS_CONST) RecvCore,
+  P2CONST(Os_ThreadConfigType, AUTOMATIC, OS_CONST) SendThread,
+  TaskType TaskID,
+  EventMaskType NotifyMask,
+  Os_AsyncCallRefType Call
+))                                                                                                                      /* COV_OS_HALPLATFORMMULTICOREUNSUPPORTED */
+{
+  Os_XSigParamsType parameters;
+
+  /* #10 Initialize the call parameters. */
+  parameters.ParameterData[0].ParamTaskType = TaskID;                                                                   /* SBSW_OS_PWA_LOCAL */
+
+  /* #20 Send the request without waiting for the result. */
+  return Os_XSigSendRequest(RecvCore, SendThread, XSigFunctionIdx_GetTaskState, &parameters, NotifyMask, Call);         /* SBSW_OS_XSIG_XSIGSEND_001 */
+}
+
+
+/***********************************************************************************************************************
+ *  Os_XSigSendRequest_GetAlarm()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE Os_StatusType, OS_CODE,                                                    /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */ /* COV_OS_HALPLATFORMMULTICOREUNSUPPORTED */
+OS_ALWAYS_INLINE, Os_XSigSendRequest_GetAlarm,
+(
+  P2CONST(Os_CoreAsrConfigType, AUTOMATIC, OS_CONST) RecvCore,
+  P2CONST(Os_ThreadConfigType, AUTOMATIC, OS_CONST) SendThread,
+  AlarmType AlarmID,
+  EventMaskType NotifyMask,
+  Os_AsyncCallRefType Call
+))                                                                                                                      /* COV_OS_HALPLATFORMMULTICOREUNSUPPORTED */
+{
+  Os_XSigParamsType parameters;
+
+  /* #10 Initialize the call parameters. */
+  parameters.ParameterData[0].ParamAlarmType = AlarmID;                                                                 /* SBSW_OS_PWA_LOCAL */
+
+  /* #20 Send the request without waiting for the result. */
+  return Os_XSigSendRequest(RecvCore, SendThread, XSigFunctionIdx_GetAlarm, &parameters, NotifyMask, Call);             /* SBSW_OS_XSIG_XSIGSEND_001 */
+}
+
+
+/***********************************************************************************************************************
+ *  Os_XSigSendRequest_GetCounterValue()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE Os_StatusType, OS_CODE,                                                    /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */ /* COV_OS_HALPLATFORMMULTICOREUNSUPPORTED */
+OS_ALWAYS_INLINE, Os_XSigSendRequest_GetCounterValue,
+(
+  P2CONST(Os_CoreAsrConfigType, AUTOMATIC, OS_CONST) RecvCore,
+  P2CONST(Os_ThreadConfigType, AUTOMATIC, OS_CONST) SendThread,
+  CounterType CounterID,
+  EventMaskType NotifyMask,
+  Os_AsyncCallRefType Call
+))                                                                                                                      /* COV_OS_HALPLATFORMMULTICOREUNSUPPORTED */
+{
+  Os_XSigParamsType parameters;
+
+  /* #10 Initialize the call parameters. */
+  parameters.ParameterData[0].ParamCounterType = CounterID;                                                             /* SBSW_OS_PWA_LOCAL */
+
+  /* #20 Send the request without waiting for the result. */
+  return Os_XSigSendRequest(RecvCore, SendThread, XSigFunctionIdx_GetCounterValue, &parameters, NotifyMask, Call);      /* SBSW_OS_XSIG_XSIGSEND_001 */
+}
+
+
 /***********************************************************************************************************************
  *  Os_XSigSend_SetEvent()
  **********************************************************************************************************************/
@@ -338,6 +338,116 @@ OS_ALWAYS_INLINE, Os_XSigChannelIsRequestHandled,
 }
 
 
+/***********************************************************************************************************************
+ *  Os_XSigChannelGetElement()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE P2CONST(Os_XSigComDataConfigType, AUTOMATIC, OS_CONST),                    /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */ /* COV_OS_HALPLATFORMMULTICOREUNSUPPORTED */
+OS_CODE, OS_ALWAYS_INLINE, Os_XSigChannelGetElement,
+(
+  P2CONST(Os_XSigChannelSendConfigType, AUTOMATIC, OS_APPL_DATA) Channel,
+  uint32 Idx
+))                                                                                                                      /* COV_OS_HALPLATFORMMULTICOREUNSUPPORTED */
+{
+  P2CONST(Os_XSigComDataConfigType, AUTOMATIC, OS_CONST) comData;
+
+  /* #10 Return the element, if the index is in range. */
+  if(Idx < (uint32)Channel->BufferSize)
+  {
+    comData = &(Channel->Buffer[Idx]);
+  }
+  else
+  {
+    comData = NULL_PTR;
+  }
+
+  return comData;
+}
+
+
+/***********************************************************************************************************************
+ *  Os_XSigChannelReleaseSyncRequests()
+ **********************************************************************************************************************/
+/*!
+ * Internal comment removed.
+ *
+ *
+ *
+ */
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,                                           /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */ /* COV_OS_HALPLATFORMMULTICOREUNSUPPORTED */
+Os_XSigChannelReleaseSyncRequests,
+(
+  P2CONST(Os_XSigChannelSendConfigType, AUTOMATIC, OS_APPL_DATA) Channel,
+  P2CONST(Os_ThreadConfigType, AUTOMATIC, OS_CONST) Sender
+))                                                                                                                      /* COV_OS_HALPLATFORMMULTICOREUNSUPPORTED */
+{
+  Os_XSigBufferIdx_IteratorType comDataIdx;
+
+  /* #10 For each element of the channel: */
+  for(comDataIdx = 0; comDataIdx < (Os_XSigBufferIdx_IteratorType) Channel->BufferSize; ++comDataIdx)
+  {
+    P2VAR(Os_XSigSendDataType volatile, AUTOMATIC, OS_VAR_NOINIT) sendData;
+
+    sendData = Channel->Buffer[comDataIdx].SendData;
+
+    if(sendData->Sender == Sender)
+    {
+      /* #20 If the result of a synchronous request of the given sender has been handled on sender side, no other
+       *     core accesses the element any more. Mark it as unused. */
+      if(sendData->Acknowledge == OS_XSIGSTATE_SYNC_PENDING)
+      {
+        sendData->Acknowledge = OS_XSIGSTATE_ACK;                                                                       /* SBSW_OS_XSIG_CHANNEL_SENDDATA_001 */
+      }
+      /* #30 Otherwise, if the element holds a synchronous request of the given sender, the receiver may still handle
+       *     it. Mark it as aborted, so that the receiver neither writes its result nor notifies the sender. The
+       *     element is marked as unused, when its result is handled on sender side (see Os_XSigHandleResults()). */
+      else if(sendData->Acknowledge == OS_XSIGSTATE_SYNC_NACK)
+      {
+        sendData->Acknowledge = OS_XSIGSTATE_SYNC_ABORTED;                                                              /* SBSW_OS_XSIG_CHANNEL_SENDDATA_001 */
+      }
+      else
+      {
+        /* Asynchronous requests and unused elements are not affected. */
+      }
+    }
+  }
+}
+
+
+/***********************************************************************************************************************
+ *  Os_XSigChannelGetSendIdx()
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE Os_XSigBufferIdxType, OS_CODE, OS_ALWAYS_INLINE,                           /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */ /* COV_OS_HALPLATFORMMULTICOREUNSUPPORTED */
+Os_XSigChannelGetSendIdx,
+(
+  P2CONST(Os_XSigChannelSendConfigType, AUTOMATIC, OS_APPL_DATA) Channel
+))                                                                                                                      /* COV_OS_HALPLATFORMMULTICOREUNSUPPORTED */
+{
+  return Channel->Dyn->SendIdx;
+}
+
+
+/***********************************************************************************************************************
+ *  Os_XSigChannelIsReceivedUpTo()
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DEFINITION(OS_LOCAL_INLINE Os_StdReturnType, OS_CONST,                                                /* PRQA S 3219 */ /* MD_Os_Rule2.1_3219 */ /* COV_OS_HALPLATFORMMULTICOREUNSUPPORTED */
+OS_ALWAYS_INLINE, Os_XSigChannelIsReceivedUpTo,
+(
+  P2CONST(Os_XSigChannelSendConfigType, AUTOMATIC, OS_APPL_DATA) Channel,
+  Os_XSigBufferIdxType SendIdx
+))                                                                                                                      /* COV_OS_HALPLATFORMMULTICOREUNSUPPORTED */
+{
+  Os_XSigBufferIdxType receiveIdx;
+
+  receiveIdx = Channel->Receive->ReceiveIdx;
+  return (receiveIdx == SendIdx);                                                                                       /* PRQA S 4404 */ /* MD_Os_C90BooleanCompatibility */
+}
+
+
 /***********************************************************************************************************************
  *  Channel Receive Functions
  **********************************************************************************************************************/
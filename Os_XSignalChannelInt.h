@@ -96,6 +96,8 @@ typedef enum
   OS_XSIGSTATE_ASYNC_NACK,    /*!< The request is asynchronous and the result was not handled on sender side. */
   OS_XSIGSTATE_SYNC_NACK,     /*!< The request is synchronous and the result was not handled on sender side. */
   OS_XSIGSTATE_SYNC_PENDING,  /*!< The request is synchronous and the result was handled on receiver side. */
+  OS_XSIGSTATE_SYNC_ABORTED,  /*!< The request is synchronous and its sender has been killed, before the result was
+                                   handled on sender side. */
   OS_XSIGSTATE_ACK            /*!< The result of the request was handled on sender side. */
 }Os_XSigState_Type;
 
@@ -162,6 +164,12 @@ struct Os_XSigSendDataType_Tag
   /*! Pointer to the sender application. */
   P2CONST(Os_AppConfigType, TYPEDEF, OS_CONST) SenderApp;
 
+  /*! Task which is notified, once the request has been handled. Only valid, if NotifyMask is not 0. */
+  P2CONST(Os_TaskConfigType, TYPEDEF, OS_CONST) NotifyTask;
+
+  /*! Events which are set for NotifyTask, once the request has been handled. 0, if no notification is requested. */
+  EventMaskType NotifyMask;
+
   Os_XSigState_Type Acknowledge;
 };
 
@@ -461,9 +469,117 @@ OS_ALWAYS_INLINE, Os_XSigChannelIsRequestHandled,
 ));
 
 
+/***********************************************************************************************************************
+ *  Os_XSigChannelGetElement()
+ **********************************************************************************************************************/
+/*! \brief          Returns the communication element with the given index.
+ *  \details        The index is not trusted, so that it may stem from user memory.
+ *
+ *  \param[in]      Channel     The Channel instance. Parameter must not be NULL.
+ *  \param[in]      Idx         The index of the element.
+ *
+ *  \return         The element with the given index.
+ *  \retval         NULL_PTR    The index is out of range.
+ *
+ *  \context        ANY
+ *
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *
+ *  \pre            -
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE P2CONST(Os_XSigComDataConfigType, AUTOMATIC, OS_CONST),
+OS_CODE, OS_ALWAYS_INLINE, Os_XSigChannelGetElement,
+(
+  P2CONST(Os_XSigChannelSendConfigType, AUTOMATIC, OS_APPL_DATA) Channel,
+  uint32 Idx
+));
+
+
+/***********************************************************************************************************************
+ *  Os_XSigChannelReleaseSyncRequests()
+ **********************************************************************************************************************/
+/*! \brief          Releases all elements, which hold a synchronous request of the given sender.
+ *  \details        Used to free the elements of a thread, which is killed or terminated while its requests are
+ *                  outstanding or their results have not been fetched. Elements, whose result has already been
+ *                  handled on sender side, are marked as unused. All others are marked as aborted, as the receiver
+ *                  may still handle them. They are marked as unused, when their result is handled on sender side.
+ *
+ *  \param[in]      Channel     The Channel instance. Parameter must not be NULL.
+ *  \param[in]      Sender      The thread whose requests are released. Parameter must not be NULL.
+ *
+ *  \context        OS_INTERNAL
+ *
+ *  \reentrant      FALSE
+ *  \synchronous    TRUE
+ *
+ *  \pre            Concurrent access by the sender core is prevented by the caller.
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE void, OS_CODE, OS_ALWAYS_INLINE,
+Os_XSigChannelReleaseSyncRequests,
+(
+  P2CONST(Os_XSigChannelSendConfigType, AUTOMATIC, OS_APPL_DATA) Channel,
+  P2CONST(Os_ThreadConfigType, AUTOMATIC, OS_CONST) Sender
+));
+
+
 /***********************************************************************************************************************
  *  Channel Receive Functions
  **********************************************************************************************************************/
+/***********************************************************************************************************************
+ *  Os_XSigChannelGetSendIdx()
+ **********************************************************************************************************************/
+/*! \brief          Returns the current send position of the channel.
+ *  \details        The returned value is used with Os_XSigChannelIsReceivedUpTo() to check whether the receiver has
+ *                  handled all elements up to this position.
+ *
+ *  \param[in]      Channel     The Channel instance. Parameter must not be NULL.
+ *
+ *  \return         The index of the next send element.
+ *
+ *  \context        ANY
+ *
+ *  \reentrant      TRUE for different Channels
+ *  \synchronous    TRUE
+ *
+ *  \pre            Concurrent access to given object is prevented by caller.
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE Os_XSigBufferIdxType, OS_CODE, OS_ALWAYS_INLINE,
+Os_XSigChannelGetSendIdx,
+(
+  P2CONST(Os_XSigChannelSendConfigType, AUTOMATIC, OS_APPL_DATA) Channel
+));
+
+
+/***********************************************************************************************************************
+ *  Os_XSigChannelIsReceivedUpTo()
+ **********************************************************************************************************************/
+/*! \brief          Returns whether the receiver has handled all elements sent before the given send position.
+ *  \details        The receiver updates its index concurrently. The caller has to order its own preceding channel
+ *                  writes before this read by a memory barrier, if the result is used to decide whether the receiver
+ *                  has to be triggered.
+ *
+ *  \param[in]      Channel     The Channel instance. Parameter must not be NULL.
+ *  \param[in]      SendIdx     A send position returned by Os_XSigChannelGetSendIdx().
+ *
+ *  \retval         !0          The receive index equals SendIdx.
+ *  \retval         0           The receiver has not reached SendIdx yet.
+ *
+ *  \context        ANY
+ *
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *
+ *  \pre            -
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE Os_StdReturnType, OS_CONST, OS_ALWAYS_INLINE,
+Os_XSigChannelIsReceivedUpTo,
+(
+  P2CONST(Os_XSigChannelSendConfigType, AUTOMATIC, OS_APPL_DATA) Channel,
+  Os_XSigBufferIdxType SendIdx
+));
+
+
 /***********************************************************************************************************************
  *  Os_XSigChannelReceiveInit()
  **********************************************************************************************************************/
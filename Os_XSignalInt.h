@@ -73,6 +73,22 @@
  *  8. Thread 1 sends a further request 3. As the channel is not empty, any handled request is removed.
  *  9. The request 3 is written to the channel.
  *
+ * If a thread is killed or terminates while it holds the communication objects of synchronous requests (e.g. results
+ * of asynchronous calls, which have not been fetched), the objects are released. Objects, whose result has already
+ * been handled on sender side, are marked as free. All others are marked as aborted: The receiver skips an aborted
+ * request or, if it is just handling it, neither writes its result nor notifies the sender. The sender core marks
+ * an aborted object as free, once the receiver has passed it.
+ *
+ *
+ * ###Reception
+ * Each sender marks its receive port in the ready mask of the receiver ISR, after it has written a request. The
+ * receiver ISR only visits marked ports, in the order found by a bit scan of the mask. It unmarks a port before it
+ * reads the port, so that a request written concurrently marks the port again.
+ *
+ * The receiver ISR handles at most RecvBatchSize requests of a port in one pass and marks the port again, if further
+ * requests are left. Between two passes it resumes interrupts for a moment, so that a core which sends at a high rate
+ * cannot block interrupts on the receiver core for an unbounded time.
+ *
  *
  * ###Measures against deadlock
  * - Busy waiting with disabled interrupts must be prevented (and is unnecessary in the described implementation)
@@ -135,6 +151,7 @@
 # include "Os_InterruptInt.h"
 # include "Os_Core_Lcfg.h"
 # include "Os_HookInt.h"
+# include "Os_BitInt.h"
 
 /* Os hal dependencies */
 # include "Os_Hal_CoreInt.h"
@@ -147,6 +164,11 @@
  *  GLOBAL CONSTANT MACROS
  **********************************************************************************************************************/
 
+/*! Defines whether asynchronous requests trigger the receiver only if it is idle (STD_ON) or always (STD_OFF). */
+# ifndef OS_CFG_XSIG_COALESCING
+#  define OS_CFG_XSIG_COALESCING  STD_OFF
+# endif
+
 
 /***********************************************************************************************************************
  *  GLOBAL FUNCTION MACROS
@@ -223,9 +245,21 @@ struct Os_XSigSendPortConfigType_Tag
 
   /*! The sender core associated with this send port. */
   P2CONST(Os_CoreAsrConfigType, TYPEDEF, OS_CONST) SendCore;
+
+  /*! The ready mask bit of RecvPort within XSigIsr (OS_BITFIELD_MASK_MSB >> index within RecvPortRefs). */
+  Os_BitFieldType ReadyBit;
 };
 
 
+/*! Dynamic information of the receive side of a cross core function call interrupt. */
+typedef struct
+{
+  /*! \brief    Marks the receive ports, which may contain requests. The MSb belongs to the first receive port.
+   *  \details  Set by the senders, cleared by the receiver. */
+  Os_BitFieldType ReadyMask;
+}Os_XSigRecvType;
+
+
 /*! Interrupt configuration for the cross core function call interrupt
  *  \extends Os_IsrConfigType_Tag
  */
@@ -240,11 +274,19 @@ struct Os_XSigIsrConfigType_Tag
   /*! The list of receive ports, which are assigned to this ISR. */
   P2CONST(Os_XSigRecvPortConfigRefType, TYPEDEF, OS_CONST) RecvPortRefs;
 
-  /*! The number of elements in RecvPortRefs (equals OS_CFG_XSIG_NUM_ISR_<Name>_RECEIVER). */
+  /*! The number of elements in RecvPortRefs (equals OS_CFG_XSIG_NUM_ISR_<Name>_RECEIVER).
+   *  It must not exceed OS_BITFIELD_BITWIDTH. */
   Os_ObjIdxType RecvPortCount;
 
+  /*! The maximum number of requests handled per receive port, before interrupts are resumed for a moment.
+   *  It must not be zero. */
+  uint32 RecvBatchSize;
+
   /*! The cross core interrupt to be triggered after data has been added to the FIFO. */
   P2CONST(Os_Hal_XSigInterruptConfigType, TYPEDEF, OS_CONST) HwConfig;
+
+  /*! Dynamic receive side data of this ISR. It is written by all sender cores. */
+  P2VAR(Os_XSigRecvType volatile, TYPEDEF, OS_VAR_NOINIT) RecvDyn;
 };
 
 
@@ -255,6 +297,18 @@ struct Os_XSigIsrType_Tag
 };
 
 
+/*! Dynamic information of the send side of a core. */
+typedef struct
+{
+  /*! Nesting depth of Os_XSigBatchBegin() calls. While this value is not zero, an asynchronous request triggers the
+   *  receiver only, if the receiver had handled all previous requests. */
+  uint32 BatchDepth;
+
+  /*! The thread, which has opened the outermost batch. NULL_PTR, if no batch is open. */
+  P2CONST(Os_ThreadConfigType, TYPEDEF, OS_CONST) BatchThread;
+}Os_XSigType;
+
+
 
 /***********************************************************************************************************************
  *  Cross Core Configuration
@@ -271,6 +325,9 @@ struct Os_XSigConfigType_Tag
 
   /*! The number of elements in RecvPortRefs (equals OS_CFG_XSIG_NUM_ISR_<Name>_RECEIVER). */
   Os_ObjIdxType RecvIsrCount;
+
+  /*! Dynamic send side data of this core. */
+  P2VAR(Os_XSigType, TYPEDEF, OS_VAR_NOINIT) Dyn;
 };
 
 
@@ -350,6 +407,30 @@ OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE Os_StdReturnType, OS_CODE, OS_ALWA
 ));
 
 
+/***********************************************************************************************************************
+ *  Os_XSigUseCoalescing()
+ **********************************************************************************************************************/
+/*! \brief          Returns whether the cross core interrupts of asynchronous requests are coalesced.
+ *  \details        Returns current state of OS_CFG_XSIG_COALESCING. If enabled, an asynchronous request triggers
+ *                  the receiver only, if the receiver has already handled all previous requests of the send port.
+ *                  Otherwise the pending receiver ISR handles the request within its receive loop.
+ *
+ *  \retval         0    Each request triggers the cross core interrupt.
+ *  \retval         !0   Asynchronous requests are coalesced.
+ *
+ *  \context        OS_INTERNAL
+ *
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *
+ *  \pre            -
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE Os_StdReturnType, OS_CODE, OS_ALWAYS_INLINE, Os_XSigUseCoalescing,
+(
+  void
+));
+
+
 /***********************************************************************************************************************
  *  Os_XSigSend()
  **********************************************************************************************************************/
@@ -453,6 +534,222 @@ FUNC(Os_StatusType, OS_CODE) Os_XSigSendSync
 );
 
 
+/***********************************************************************************************************************
+ *  Os_XSigBatchBegin()
+ **********************************************************************************************************************/
+/*! \brief          Starts a batch of asynchronous cross core requests on the core of the given thread.
+ *  \details        Until the matching Os_XSigBatchFlush(), an asynchronous request of this core triggers the
+ *                  receiver only, if the receiver had handled all previous requests of this core. So each receiver is
+ *                  triggered by its first request of the batch and does not wait for the flush with a full channel.
+ *                  Synchronous requests still trigger the receiver. Batches may be nested.
+ *                  If XSignal is disabled, this function does nothing.
+ *
+ *  \param[in]      SendThread      The current thread. Parameter must not be NULL.
+ *
+ *  \context        OS_INTERNAL
+ *
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *
+ *  \pre            SendThread is the current thread.
+ *  \pre            Each call is followed by a call of Os_XSigBatchFlush() by the same thread.
+ **********************************************************************************************************************/
+FUNC(void, OS_CODE) Os_XSigBatchBegin
+(
+  P2CONST(Os_ThreadConfigType, AUTOMATIC, OS_CONST) SendThread
+);
+
+
+/***********************************************************************************************************************
+ *  Os_XSigBatchFlush()
+ **********************************************************************************************************************/
+/*! \brief          Ends a batch of asynchronous cross core requests.
+ *  \details        When the outermost batch ends, each receiver core, which has not handled all requests of this
+ *                  core yet, is triggered once. If XSignal is disabled, this function does nothing.
+ *
+ *  \param[in]      SendThread      The current thread. Parameter must not be NULL.
+ *
+ *  \context        OS_INTERNAL
+ *
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *
+ *  \pre            SendThread is the current thread.
+ *  \pre            A batch has been started by Os_XSigBatchBegin().
+ **********************************************************************************************************************/
+FUNC(void, OS_CODE) Os_XSigBatchFlush
+(
+  P2CONST(Os_ThreadConfigType, AUTOMATIC, OS_CONST) SendThread
+);
+
+
+/***********************************************************************************************************************
+ *  Os_XSigBatchAbort()
+ **********************************************************************************************************************/
+/*! \brief          Closes a batch of asynchronous cross core requests of a killed thread.
+ *  \details        If the given thread has opened a batch on its core, all batch levels are closed and each receiver
+ *                  core, which has not handled all requests of this core yet, is triggered. Otherwise nothing
+ *                  happens. If XSignal is disabled, this function does nothing.
+ *
+ *  \param[in]      Thread          The thread which is killed. Parameter must not be NULL.
+ *
+ *  \context        OS_INTERNAL
+ *
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *
+ *  \pre            Thread belongs to the local core.
+ **********************************************************************************************************************/
+FUNC(void, OS_CODE) Os_XSigBatchAbort
+(
+  P2CONST(Os_ThreadConfigType, AUTOMATIC, OS_CONST) Thread
+);
+
+
+/***********************************************************************************************************************
+ *  Os_XSigRequestAbort()
+ **********************************************************************************************************************/
+/*! \brief          Frees the communication elements of the synchronous requests of a killed thread.
+ *  \details        This covers requests whose result the thread still waits for and results of asynchronous calls
+ *                  (\ref Os_XSigSendRequest()) which have not been fetched. A request which has not been handled yet
+ *                  is skipped by the receiver. If XSignal is disabled, this function does nothing.
+ *
+ *  \param[in]      Thread          The thread which is killed or terminated. Parameter must not be NULL.
+ *
+ *  \context        OS_INTERNAL
+ *
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *
+ *  \pre            Thread belongs to the local core.
+ **********************************************************************************************************************/
+FUNC(void, OS_CODE) Os_XSigRequestAbort
+(
+  P2CONST(Os_ThreadConfigType, AUTOMATIC, OS_CONST) Thread
+);
+
+
+/***********************************************************************************************************************
+ *  Os_XSigSendRequest()
+ **********************************************************************************************************************/
+/*! \brief          Trigger a remote function on a foreign core without waiting for the result.
+ *  \details        The request keeps its communication element until the sender fetches the result by
+ *                  \ref Os_Api_GetAsyncCallResult(). The given handle is set up to refer to the request.
+ *                  If NotifyMask is not 0, the receiver sets these events for the sending task, once it has handled
+ *                  the request. The events are set with the access rights of the receiving XSignal ISR.
+ *
+ *  \param[in]      RecvCore        The receiving core. Parameter must not be NULL.
+ *  \param[in]      SendThread      The sender thread of the cross core request. Parameter must not be NULL.
+ *  \param[in]      FunctionIdx     The function to call.
+ *  \param[in]      Parameters      The call parameters. Parameter must not be NULL.
+ *  \param[in]      NotifyMask      Events to set for the sending task on completion. 0 for no notification.
+ *  \param[out]     Call            The handle of the request. Parameter must not be NULL.
+ *
+ *  \retval         OS_STATUS_OK                    No error.
+ *  \retval         OS_STATUS_CALL_NOT_ALLOWED      No communication with that core allowed or a notification is
+ *                                                  requested, which the receiver cannot deliver.
+ *  \retval         OS_STATUS_FUNCTION_UNAVAILABLE  XSignal is disabled or a notification is requested, which the
+ *                                                  sender core does not handle.
+ *  \retval         OS_STATUS_OVERFLOW              The send port has no free communication element.
+ *
+ *  \context        OS_INTERNAL
+ *
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *
+ *  \pre            Target object is located on receiver core.
+ *  \pre            SendThread is the current thread.
+ *  \pre            The notification has been checked by \ref Os_XSigCheckNotification().
+ **********************************************************************************************************************/
+FUNC(Os_StatusType, OS_CODE) Os_XSigSendRequest
+(
+  P2CONST(Os_CoreAsrConfigType, AUTOMATIC, OS_CONST) RecvCore,
+  P2CONST(Os_ThreadConfigType, AUTOMATIC, OS_CONST) SendThread,
+  Os_XSigFunctionIdx FunctionIdx,
+  P2CONST(Os_XSigParamsType, AUTOMATIC, TYPEDEF) Parameters,
+  EventMaskType NotifyMask,
+  Os_AsyncCallRefType Call
+);
+
+
+/***********************************************************************************************************************
+ *  Os_XSigCheckNotification()
+ **********************************************************************************************************************/
+/*! \brief          Checks whether the given thread may request a completion event for an asynchronous call.
+ *  \details        A notification requires an extended task as caller.
+ *
+ *  \param[in]      SendThread      The current thread. Parameter must not be NULL.
+ *  \param[in]      NotifyMask      Events to set on completion. 0 for no notification.
+ *
+ *  \retval         OS_STATUS_OK                        No notification requested or the notification is possible.
+ *  \retval         OS_STATUS_NOEXTENDEDTASK_CALLER     The caller is no extended task.
+ *
+ *  \context        OS_INTERNAL
+ *
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *
+ *  \pre            SendThread is the current thread.
+ **********************************************************************************************************************/
+FUNC(Os_StatusType, OS_CODE) Os_XSigCheckNotification
+(
+  P2CONST(Os_ThreadConfigType, AUTOMATIC, OS_CONST) SendThread,
+  EventMaskType NotifyMask
+);
+
+
+/***********************************************************************************************************************
+ *  Os_XSigCompleteLocal()
+ **********************************************************************************************************************/
+/*! \brief          Completes an asynchronous call, which has been performed on the local core.
+ *  \details        Marks the handle as completed and sets the requested events for the calling task.
+ *
+ *  \param[in]      SendThread      The current thread. Parameter must not be NULL.
+ *  \param[in]      NotifyMask      Events to set for the calling task. 0 for no notification.
+ *  \param[out]     Call            The handle of the call. Parameter must not be NULL.
+ *
+ *  \context        OS_INTERNAL
+ *
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *
+ *  \pre            SendThread is the current thread.
+ *  \pre            The notification has been checked by \ref Os_XSigCheckNotification().
+ **********************************************************************************************************************/
+FUNC(void, OS_CODE) Os_XSigCompleteLocal
+(
+  P2CONST(Os_ThreadConfigType, AUTOMATIC, OS_CONST) SendThread,
+  EventMaskType NotifyMask,
+  Os_AsyncCallRefType Call
+);
+
+
+/***********************************************************************************************************************
+ *  Os_Api_GetAsyncCallResult()
+ **********************************************************************************************************************/
+/*! \brief          OS service \ref Os_GetAsyncCallResult().
+ *  \details        For further details see \ref Os_GetAsyncCallResult().
+ *
+ *  \param[in,out]  Call    The handle of the call. Parameter must not be NULL.
+ *
+ *  \retval         OS_STATUS_OK                    The call is completed. The results are stored in the handle.
+ *  \retval         OS_STATUS_CROSS_CORE_REQUESTED  The receiver core has not handled the call yet.
+ *  \retval         OS_STATUS_NOFUNC_ASYNCCALL_1    The handle does not refer to an asynchronous call of the caller.
+ *  \retval         other                           The return value of the called function.
+ *
+ *  \context        TASK|ISR2
+ *
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *
+ *  \pre            Supervisor mode.
+ **********************************************************************************************************************/
+FUNC(Os_StatusType, OS_CODE) Os_Api_GetAsyncCallResult
+(
+  Os_AsyncCallRefType Call
+);
+
+
 /***********************************************************************************************************************
  *  Os_XSigSend_ActivateTask()
  **********************************************************************************************************************/
@@ -600,6 +897,111 @@ OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE Os_StatusType, OS_CODE, OS_ALWAYS_
 ));
 
 
+/***********************************************************************************************************************
+ *  Os_XSigSendRequest_GetTaskState()
+ **********************************************************************************************************************/
+/*! \brief          Send signal to get the task state on a foreign core without waiting for the result.
+ *  \details        See \ref Os_XSigSendRequest().
+ *
+ *  \param[in]      RecvCore    Pointer to the core configuration of the destination core.
+ *                              Parameter must not be NULL.
+ *  \param[in]      SendThread  The user thread that called the API. Parameter must not be NULL.
+ *  \param[in]      TaskID      As described for \ref Os_Api_GetTaskState.
+ *  \param[in]      NotifyMask  Events to set for the calling task on completion. 0 for no notification.
+ *  \param[out]     Call        The handle of the request. Parameter must not be NULL.
+ *
+ *  \return         See \ref Os_XSigSendRequest().
+ *
+ *  \context        OS_INTERNAL
+ *
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *
+ *  \pre            Caller has already performed checks, which can be performed locally.
+ *  \pre            Target object is located on receiver core.
+ *  \pre            SendThread is the current thread.
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE Os_StatusType, OS_CODE,
+OS_ALWAYS_INLINE, Os_XSigSendRequest_GetTaskState,
+(
+  P2CONST(Os_CoreAsrConfigType, AUTOMATIC, OS_CONST) RecvCore,
+  P2CONST(Os_ThreadConfigType, AUTOMATIC, OS_CONST) SendThread,
+  TaskType TaskID,
+  EventMaskType NotifyMask,
+  Os_AsyncCallRefType Call
+));
+
+
+/***********************************************************************************************************************
+ *  Os_XSigSendRequest_GetAlarm()
+ **********************************************************************************************************************/
+/*! \brief          Send signal to get the alarm on a foreign core without waiting for the result.
+ *  \details        See \ref Os_XSigSendRequest().
+ *
+ *  \param[in]      RecvCore    Pointer to the core configuration of the destination core.
+ *                              Parameter must not be NULL.
+ *  \param[in]      SendThread  The user thread that called the API. Parameter must not be NULL.
+ *  \param[in]      AlarmID     As described for \ref Os_Api_GetAlarm.
+ *  \param[in]      NotifyMask  Events to set for the calling task on completion. 0 for no notification.
+ *  \param[out]     Call        The handle of the request. Parameter must not be NULL.
+ *
+ *  \return         See \ref Os_XSigSendRequest().
+ *
+ *  \context        OS_INTERNAL
+ *
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *
+ *  \pre            Caller has already performed checks, which can be performed locally.
+ *  \pre            Target object is located on receiver core.
+ *  \pre            SendThread is the current thread.
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE Os_StatusType, OS_CODE,
+OS_ALWAYS_INLINE, Os_XSigSendRequest_GetAlarm,
+(
+  P2CONST(Os_CoreAsrConfigType, AUTOMATIC, OS_CONST) RecvCore,
+  P2CONST(Os_ThreadConfigType, AUTOMATIC, OS_CONST) SendThread,
+  AlarmType AlarmID,
+  EventMaskType NotifyMask,
+  Os_AsyncCallRefType Call
+));
+
+
+/***********************************************************************************************************************
+ *  Os_XSigSendRequest_GetCounterValue()
+ **********************************************************************************************************************/
+/*! \brief          Send signal to get a counter value on a foreign core without waiting for the result.
+ *  \details        See \ref Os_XSigSendRequest().
+ *
+ *  \param[in]      RecvCore    Pointer to the core configuration of the destination core.
+ *                              Parameter must not be NULL.
+ *  \param[in]      SendThread  The user thread that called the API. Parameter must not be NULL.
+ *  \param[in]      CounterID   As described for \ref Os_Api_GetCounterValue.
+ *  \param[in]      NotifyMask  Events to set for the calling task on completion. 0 for no notification.
+ *  \param[out]     Call        The handle of the request. Parameter must not be NULL.
+ *
+ *  \return         See \ref Os_XSigSendRequest().
+ *
+ *  \context        OS_INTERNAL
+ *
+ *  \reentrant      TRUE
+ *  \synchronous    TRUE
+ *
+ *  \pre            Caller has already performed checks, which can be performed locally.
+ *  \pre            Target object is located on receiver core.
+ *  \pre            SendThread is the current thread.
+ **********************************************************************************************************************/
+OS_FUNC_ATTRIBUTE_DECLARATION(OS_LOCAL_INLINE Os_StatusType, OS_CODE,
+OS_ALWAYS_INLINE, Os_XSigSendRequest_GetCounterValue,
+(
+  P2CONST(Os_CoreAsrConfigType, AUTOMATIC, OS_CONST) RecvCore,
+  P2CONST(Os_ThreadConfigType, AUTOMATIC, OS_CONST) SendThread,
+  CounterType CounterID,
+  EventMaskType NotifyMask,
+  Os_AsyncCallRefType Call
+));
+
+
 /***********************************************************************************************************************
  *  Os_XSigSend_SetEvent()
  **********************************************************************************************************************/
@@ -0,0 +1,38 @@
+/**********************************************************************************************************************
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file   Compiler.h
+ *  \brief  AUTOSAR compiler abstraction for GNU C on the POSIX host. Memory classes are not used on the host.
+ *********************************************************************************************************************/
+
+#ifndef COMPILER_H
+# define COMPILER_H
+
+# define AUTOMATIC
+# define TYPEDEF
+
+# ifndef NULL_PTR
+#  define NULL_PTR                                    ((void*)0)
+# endif
+
+# define INLINE                                      inline
+# define LOCAL_INLINE                                static inline
+# ifndef STATIC
+#  define STATIC                                     static
+# endif
+
+# define FUNC(rettype, memclass)                     rettype
+# define FUNC_P2CONST(rettype, ptrclass, memclass)   const rettype *
+# define FUNC_P2VAR(rettype, ptrclass, memclass)     rettype *
+
+# define P2VAR(ptrtype, memclass, ptrclass)          ptrtype *
+# define P2CONST(ptrtype, memclass, ptrclass)        const ptrtype *
+# define CONSTP2VAR(ptrtype, memclass, ptrclass)     ptrtype * const
+# define CONSTP2CONST(ptrtype, memclass, ptrclass)   const ptrtype * const
+# define P2FUNC(rettype, ptrclass, fctname)          rettype (*fctname)
+# define CONSTP2FUNC(rettype, ptrclass, fctname)     rettype (* const fctname)
+
+# define CONST(type, memclass)                       const type
+# define VAR(type, memclass)                         type
+
+#endif /* COMPILER_H */
@@ -0,0 +1,14 @@
+/**********************************************************************************************************************
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file   Ioc.h
+ *  \brief  IOC interface of the POSIX host build. The tests call the kernel IOC functions directly, thus no
+ *          generated IOC wrappers are needed.
+ *********************************************************************************************************************/
+
+#ifndef IOC_H
+# define IOC_H
+
+# include "Os_Types_Lcfg.h"
+
+#endif /* IOC_H */
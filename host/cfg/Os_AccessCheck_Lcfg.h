@@ -0,0 +1,13 @@
+/**********************************************************************************************************************
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file   Os_AccessCheck_Lcfg.h
+ *  \brief  AccessCheck configuration of the POSIX host build. The host build does not configure further AccessCheck data.
+ *********************************************************************************************************************/
+
+#ifndef OS_ACCESSCHECK_LCFG_H
+# define OS_ACCESSCHECK_LCFG_H
+
+# include "Os_Lcfg.h"
+
+#endif /* OS_ACCESSCHECK_LCFG_H */
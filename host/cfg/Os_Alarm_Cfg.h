@@ -0,0 +1,13 @@
+/**********************************************************************************************************************
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file   Os_Alarm_Cfg.h
+ *  \brief  Alarm configuration of the POSIX host build. The host build does not configure further Alarm data.
+ *********************************************************************************************************************/
+
+#ifndef OS_ALARM_CFG_H
+# define OS_ALARM_CFG_H
+
+# include "Os_Cfg.h"
+
+#endif /* OS_ALARM_CFG_H */
@@ -0,0 +1,13 @@
+/**********************************************************************************************************************
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file   Os_Application_Cfg.h
+ *  \brief  Application configuration of the POSIX host build. The host build does not configure further Application data.
+ *********************************************************************************************************************/
+
+#ifndef OS_APPLICATION_CFG_H
+# define OS_APPLICATION_CFG_H
+
+# include "Os_Cfg.h"
+
+#endif /* OS_APPLICATION_CFG_H */
@@ -0,0 +1,20 @@
+/**********************************************************************************************************************
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file   Os_Application_Lcfg.h
+ *  \brief  Application configuration of the POSIX host build.
+ *********************************************************************************************************************/
+
+#ifndef OS_APPLICATION_LCFG_H
+# define OS_APPLICATION_LCFG_H
+
+# include "Os_Lcfg.h"
+# include "Os_Application_Types.h"
+
+/*! Application configuration data. */
+extern const Os_AppConfigType OsCfg_App_HostApp_Core0;
+extern const Os_AppConfigType OsCfg_App_HostApp_Core1;
+extern const Os_AppConfigType OsCfg_App_HostApp_Core2;
+extern const Os_AppConfigType OsCfg_App_HostApp_Core3;
+
+#endif /* OS_APPLICATION_LCFG_H */
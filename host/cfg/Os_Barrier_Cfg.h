@@ -0,0 +1,13 @@
+/**********************************************************************************************************************
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file   Os_Barrier_Cfg.h
+ *  \brief  Barrier configuration of the POSIX host build. The host build does not configure further Barrier data.
+ *********************************************************************************************************************/
+
+#ifndef OS_BARRIER_CFG_H
+# define OS_BARRIER_CFG_H
+
+# include "Os_Cfg.h"
+
+#endif /* OS_BARRIER_CFG_H */
@@ -0,0 +1,13 @@
+/**********************************************************************************************************************
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file   Os_Barrier_Lcfg.h
+ *  \brief  Barrier configuration of the POSIX host build. The host build does not configure further Barrier data.
+ *********************************************************************************************************************/
+
+#ifndef OS_BARRIER_LCFG_H
+# define OS_BARRIER_LCFG_H
+
+# include "Os_Lcfg.h"
+
+#endif /* OS_BARRIER_LCFG_H */
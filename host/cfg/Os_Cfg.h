@@ -0,0 +1,93 @@
+/**********************************************************************************************************************
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file   Os_Cfg.h
+ *  \brief  OS configuration of the POSIX host build.
+ *  \details
+ *  Four AUTOSAR cores, each with one trusted application and one task. Other OS objects are defined by the tests
+ *  themselves. Memory and timing protection are disabled, as the host has no MPU and no protection timers.
+ *********************************************************************************************************************/
+
+#ifndef OS_CFG_H
+# define OS_CFG_H
+
+# include "Std_Types.h"
+
+/* Version information of the configuration. */
+# define OS_CFG_MAJOR_VERSION                          (2u)
+# define OS_CFG_MINOR_VERSION                          (55u)
+# define OS_CFG_HAL_MAJOR_VERSION                      (2u)
+# define OS_CFG_HAL_MINOR_VERSION                      (30u)
+
+/* Derivative and compiler. */
+# define OS_CFG_DERIVATIVEGROUP_POSIX
+# define OS_CFG_COMPILER_GNU
+
+/* Cores. */
+# define OS_CFG_COREPHYSICALID_COUNT                   (4u)
+
+/* Kernel features. */
+# define OS_CFG_ACCESSCHECK                            STD_ON
+# define OS_CFG_ALARM_ACTIVATETASK_USED                STD_ON
+# define OS_CFG_ALARM_CALLBACK_USED                    STD_ON
+# define OS_CFG_ALARM_INCREMENTCOUNTER_USED            STD_ON
+# define OS_CFG_ALARM_SETEVENT_USED                    STD_ON
+# define OS_CFG_ASSERTIONS                             STD_ON
+# define OS_CFG_BARRIER                                STD_ON
+# define OS_CFG_CAT0                                   STD_OFF
+# define OS_CFG_COUNTER_HRT_USED                       STD_ON
+# define OS_CFG_COUNTER_PFRT_USED                      STD_ON
+# define OS_CFG_COUNTER_PIT_USED                       STD_ON
+# define OS_CFG_COUNTER_SW_USED                        STD_ON
+# define OS_CFG_EVENT                                  STD_ON
+# define OS_CFG_EXTENDED_STATUS                        STD_ON
+# define OS_CFG_INTERNAL_EXCEPTION_DETECTION           STD_OFF
+# define OS_CFG_INTERRUPT_ONLY                         STD_OFF
+# define OS_CFG_IOC                                    STD_ON
+# define OS_CFG_IOC_HAS_CALLBACKS                      STD_ON
+# define OS_CFG_KILLING                                STD_ON
+# define OS_CFG_MEMORY_PROTECTION                      STD_OFF
+# define OS_CFG_MEMORY_PROTECTION_FOR_APPLICATIONS     STD_OFF
+# define OS_CFG_MEMORY_PROTECTION_FOR_THREADS          STD_OFF
+# define OS_CFG_ORTI                                   STD_OFF
+# define OS_CFG_ORTI_ADDITIONAL                        STD_OFF
+# define OS_CFG_OS_PRESTARTTASK                        STD_OFF
+# define OS_CFG_PERIPHERAL_COMPATIBILITY               STD_OFF
+# define OS_CFG_SCHEDULE_ROUND_ROB_ENABLED             STD_OFF
+# define OS_CFG_SERVICE_PROTECTION                     STD_ON
+# define OS_CFG_SPINLOCK_STATISTICS                    STD_ON
+# define OS_CFG_STACKMEASUREMENT                       STD_ON
+# define OS_CFG_STACKMONITORING                        STD_OFF
+# define OS_CFG_THREAD_FPU_CONTEXT_ENABLED             STD_OFF
+# define OS_CFG_THREAD_FPU_CONTEXT_FOR_ALL_THREADS_ENABLED STD_OFF
+# define OS_CFG_TIMER_HIGH_RESOLUTION                  STD_ON
+# define OS_CFG_TIMING_PROTECTION                      (0u)
+# define OS_CFG_XSIGNAL                                STD_ON
+# define OS_CFG_XSIG_USEASYNC                          STD_ON
+
+/* Hooks. */
+# define OS_CFG_ERRORHOOKS                             STD_OFF
+# define OS_CFG_ERRORHOOK_SYSTEM                       STD_OFF
+# define OS_CFG_OSTIMINGHOOKS                          STD_OFF
+# define OS_CFG_PANICHOOK                              STD_ON
+# define OS_CFG_POSTTASKHOOK                           STD_OFF
+# define OS_CFG_PRETASKHOOK                            STD_OFF
+# define OS_CFG_PROTECTIONHOOK                         STD_OFF
+# define OS_CFG_PROTECTIONHOOK_SYSTEM                  STD_OFF
+# define OS_CFG_SHUTDOWNHOOKS                          STD_OFF
+# define OS_CFG_SHUTDOWNHOOK_SYSTEM                    STD_OFF
+# define OS_CFG_STARTUPHOOKS                           STD_OFF
+# define OS_CFG_STARTUPHOOK_SYSTEM                     STD_OFF
+
+/* Sizes. */
+# define OS_CFG_NUM_HOOKS                              (0u)
+# define OS_CFG_NUM_ISRLEVELS                          (8u)
+# define OS_CFG_NUM_OSCODE_SECTIONS                    (1u)
+# define OS_CFG_NUM_TASKQUEUES                         (1u)
+
+/* Interrupt levels. */
+# define OS_CFG_HAL_ISR2_DISABLE_LEVEL                 (100u)
+# define OS_CFG_HAL_ISR1_DISABLE_LEVEL                 (200u)
+# define OS_CFG_HAL_TP_DISABLE_LEVEL                   (250u)
+
+#endif /* OS_CFG_H */
@@ -0,0 +1,13 @@
+/**********************************************************************************************************************
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file   Os_Core_Cfg.h
+ *  \brief  Core configuration of the POSIX host build. The host build does not configure further Core data.
+ *********************************************************************************************************************/
+
+#ifndef OS_CORE_CFG_H
+# define OS_CORE_CFG_H
+
+# include "Os_Cfg.h"
+
+#endif /* OS_CORE_CFG_H */
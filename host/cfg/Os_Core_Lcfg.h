@@ -0,0 +1,20 @@
+/**********************************************************************************************************************
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file   Os_Core_Lcfg.h
+ *  \brief  Core configuration of the POSIX host build.
+ *********************************************************************************************************************/
+
+#ifndef OS_CORE_LCFG_H
+# define OS_CORE_LCFG_H
+
+# include "Os_Lcfg.h"
+# include "Os_Core_Types.h"
+
+/*! Core configuration data. */
+extern const Os_CoreAsrConfigType OsCfg_Core_OsCore0;
+extern const Os_CoreAsrConfigType OsCfg_Core_OsCore1;
+extern const Os_CoreAsrConfigType OsCfg_Core_OsCore2;
+extern const Os_CoreAsrConfigType OsCfg_Core_OsCore3;
+
+#endif /* OS_CORE_LCFG_H */
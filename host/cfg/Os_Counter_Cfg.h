@@ -0,0 +1,13 @@
+/**********************************************************************************************************************
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file   Os_Counter_Cfg.h
+ *  \brief  Counter configuration of the POSIX host build. The host build does not configure further Counter data.
+ *********************************************************************************************************************/
+
+#ifndef OS_COUNTER_CFG_H
+# define OS_COUNTER_CFG_H
+
+# include "Os_Cfg.h"
+
+#endif /* OS_COUNTER_CFG_H */
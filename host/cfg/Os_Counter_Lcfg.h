@@ -0,0 +1,13 @@
+/**********************************************************************************************************************
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file   Os_Counter_Lcfg.h
+ *  \brief  Counter configuration of the POSIX host build. The host build does not configure further Counter data.
+ *********************************************************************************************************************/
+
+#ifndef OS_COUNTER_LCFG_H
+# define OS_COUNTER_LCFG_H
+
+# include "Os_Lcfg.h"
+
+#endif /* OS_COUNTER_LCFG_H */
@@ -0,0 +1,13 @@
+/**********************************************************************************************************************
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file   Os_Error_Cfg.h
+ *  \brief  Error configuration of the POSIX host build. The host build does not configure further Error data.
+ *********************************************************************************************************************/
+
+#ifndef OS_ERROR_CFG_H
+# define OS_ERROR_CFG_H
+
+# include "Os_Cfg.h"
+
+#endif /* OS_ERROR_CFG_H */
@@ -0,0 +1,13 @@
+/**********************************************************************************************************************
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file   Os_Error_Lcfg.h
+ *  \brief  Error configuration of the POSIX host build. The host build does not configure further Error data.
+ *********************************************************************************************************************/
+
+#ifndef OS_ERROR_LCFG_H
+# define OS_ERROR_LCFG_H
+
+# include "Os_Lcfg.h"
+
+#endif /* OS_ERROR_LCFG_H */
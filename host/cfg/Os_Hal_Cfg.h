@@ -0,0 +1,13 @@
+/**********************************************************************************************************************
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file   Os_Hal_Cfg.h
+ *  \brief  Hal configuration of the POSIX host build. The host build does not configure further Hal data.
+ *********************************************************************************************************************/
+
+#ifndef OS_HAL_CFG_H
+# define OS_HAL_CFG_H
+
+# include "Os_Cfg.h"
+
+#endif /* OS_HAL_CFG_H */
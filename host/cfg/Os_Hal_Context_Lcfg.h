@@ -0,0 +1,13 @@
+/**********************************************************************************************************************
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file   Os_Hal_Context_Lcfg.h
+ *  \brief  Hal_Context configuration of the POSIX host build. The host build does not configure further Hal_Context data.
+ *********************************************************************************************************************/
+
+#ifndef OS_HAL_CONTEXT_LCFG_H
+# define OS_HAL_CONTEXT_LCFG_H
+
+# include "Os_Lcfg.h"
+
+#endif /* OS_HAL_CONTEXT_LCFG_H */
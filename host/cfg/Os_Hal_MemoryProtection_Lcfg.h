@@ -0,0 +1,13 @@
+/**********************************************************************************************************************
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file   Os_Hal_MemoryProtection_Lcfg.h
+ *  \brief  Hal_MemoryProtection configuration of the POSIX host build. The host build does not configure further Hal_MemoryProtection data.
+ *********************************************************************************************************************/
+
+#ifndef OS_HAL_MEMORYPROTECTION_LCFG_H
+# define OS_HAL_MEMORYPROTECTION_LCFG_H
+
+# include "Os_Lcfg.h"
+
+#endif /* OS_HAL_MEMORYPROTECTION_LCFG_H */
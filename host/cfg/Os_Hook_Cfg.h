@@ -0,0 +1,13 @@
+/**********************************************************************************************************************
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file   Os_Hook_Cfg.h
+ *  \brief  Hook configuration of the POSIX host build. The host build does not configure further Hook data.
+ *********************************************************************************************************************/
+
+#ifndef OS_HOOK_CFG_H
+# define OS_HOOK_CFG_H
+
+# include "Os_Cfg.h"
+
+#endif /* OS_HOOK_CFG_H */
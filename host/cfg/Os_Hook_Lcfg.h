@@ -0,0 +1,13 @@
+/**********************************************************************************************************************
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file   Os_Hook_Lcfg.h
+ *  \brief  Hook configuration of the POSIX host build. The host build does not configure further Hook data.
+ *********************************************************************************************************************/
+
+#ifndef OS_HOOK_LCFG_H
+# define OS_HOOK_LCFG_H
+
+# include "Os_Lcfg.h"
+
+#endif /* OS_HOOK_LCFG_H */
@@ -0,0 +1,13 @@
+/**********************************************************************************************************************
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file   Os_Interrupt_Cfg.h
+ *  \brief  Interrupt configuration of the POSIX host build. The host build does not configure further Interrupt data.
+ *********************************************************************************************************************/
+
+#ifndef OS_INTERRUPT_CFG_H
+# define OS_INTERRUPT_CFG_H
+
+# include "Os_Cfg.h"
+
+#endif /* OS_INTERRUPT_CFG_H */
@@ -0,0 +1,13 @@
+/**********************************************************************************************************************
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file   Os_Ioc_Cfg.h
+ *  \brief  Ioc configuration of the POSIX host build. The host build does not configure further Ioc data.
+ *********************************************************************************************************************/
+
+#ifndef OS_IOC_CFG_H
+# define OS_IOC_CFG_H
+
+# include "Os_Cfg.h"
+
+#endif /* OS_IOC_CFG_H */
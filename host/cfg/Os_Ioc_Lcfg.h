@@ -0,0 +1,13 @@
+/**********************************************************************************************************************
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file   Os_Ioc_Lcfg.h
+ *  \brief  Ioc configuration of the POSIX host build. The host build does not configure further Ioc data.
+ *********************************************************************************************************************/
+
+#ifndef OS_IOC_LCFG_H
+# define OS_IOC_LCFG_H
+
+# include "Os_Lcfg.h"
+
+#endif /* OS_IOC_LCFG_H */
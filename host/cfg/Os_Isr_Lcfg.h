@@ -0,0 +1,13 @@
+/**********************************************************************************************************************
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file   Os_Isr_Lcfg.h
+ *  \brief  Isr configuration of the POSIX host build. The host build does not configure further Isr data.
+ *********************************************************************************************************************/
+
+#ifndef OS_ISR_LCFG_H
+# define OS_ISR_LCFG_H
+
+# include "Os_Lcfg.h"
+
+#endif /* OS_ISR_LCFG_H */
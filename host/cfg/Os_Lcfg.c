@@ -0,0 +1,493 @@
+/**********************************************************************************************************************
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file   Os_Lcfg.c
+ *  \brief  Configuration data of the POSIX host build.
+ *  \details
+ *  Each of the four AUTOSAR cores owns one trusted application with one task. The tasks are not scheduled. The
+ *  host test harness starts the cores by Os_Hal_CoreStart() and runs its test functions as the core's task.
+ *********************************************************************************************************************/
+
+#define OS_LCFG_SOURCE
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include "Std_Types.h"
+
+#include "Os_Lcfg.h"
+#include "Os_XSignal_Lcfg.h"
+
+#include "Os.h"
+#include "Os_Application.h"
+#include "Os_Application_Lcfg.h"
+#include "Os_Core.h"
+#include "Os_Core_Lcfg.h"
+#include "Os_Task.h"
+#include "Os_Hal_Core.h"
+
+/* Start label of all host cores, provided by the host test harness. */
+extern void HostTest_CoreStartLabel(void);
+
+/**********************************************************************************************************************
+ *  DYNAMIC DATA
+ *********************************************************************************************************************/
+/* Core OsCore0 */
+static Os_CoreAsrType OsCfg_Core_OsCore0_Dyn;
+static volatile Os_CoreStatusType OsCfg_Core_OsCore0_Status;
+static Os_CoreBootBarrierType OsCfg_Core_OsCore0_BootBarrier;
+static Os_AppType OsCfg_App_HostApp_Core0_Dyn;
+static Os_TaskType OsCfg_Task_HostTask_Core0_Dyn;
+/* Core OsCore1 */
+static Os_CoreAsrType OsCfg_Core_OsCore1_Dyn;
+static volatile Os_CoreStatusType OsCfg_Core_OsCore1_Status;
+static Os_CoreBootBarrierType OsCfg_Core_OsCore1_BootBarrier;
+static Os_AppType OsCfg_App_HostApp_Core1_Dyn;
+static Os_TaskType OsCfg_Task_HostTask_Core1_Dyn;
+/* Core OsCore2 */
+static Os_CoreAsrType OsCfg_Core_OsCore2_Dyn;
+static volatile Os_CoreStatusType OsCfg_Core_OsCore2_Status;
+static Os_CoreBootBarrierType OsCfg_Core_OsCore2_BootBarrier;
+static Os_AppType OsCfg_App_HostApp_Core2_Dyn;
+static Os_TaskType OsCfg_Task_HostTask_Core2_Dyn;
+/* Core OsCore3 */
+static Os_CoreAsrType OsCfg_Core_OsCore3_Dyn;
+static volatile Os_CoreStatusType OsCfg_Core_OsCore3_Status;
+static Os_CoreBootBarrierType OsCfg_Core_OsCore3_BootBarrier;
+static Os_AppType OsCfg_App_HostApp_Core3_Dyn;
+static Os_TaskType OsCfg_Task_HostTask_Core3_Dyn;
+
+/**********************************************************************************************************************
+ *  CONFIGURATION DATA
+ *********************************************************************************************************************/
+
+static const Os_Hal_CoreConfigType OsCfg_Hal_Core_OsCore0 =
+{
+  /* .CoreId                  = */ 0uL,
+  /* .ProgramCounterRegister  = */ 0uL,
+  /* .StartLabelAddress       = */ (Os_Hal_AddressType)&HostTest_CoreStartLabel,
+  /* .DBGSRRegister           = */ 0uL,
+  /* .SYSCON_CORECON_Register = */ 0uL,
+  /* .BOOTCONRegister         = */ 0uL
+};
+
+static const Os_Hal_CoreAsrConfigType OsCfg_Hal_CoreAsr_OsCore0 =
+{
+  /* .CoreId = */ 0uL
+};
+
+static const Os_Hal_CoreConfigType OsCfg_Hal_Core_OsCore1 =
+{
+  /* .CoreId                  = */ 1uL,
+  /* .ProgramCounterRegister  = */ 0uL,
+  /* .StartLabelAddress       = */ (Os_Hal_AddressType)&HostTest_CoreStartLabel,
+  /* .DBGSRRegister           = */ 0uL,
+  /* .SYSCON_CORECON_Register = */ 0uL,
+  /* .BOOTCONRegister         = */ 0uL
+};
+
+static const Os_Hal_CoreAsrConfigType OsCfg_Hal_CoreAsr_OsCore1 =
+{
+  /* .CoreId = */ 1uL
+};
+
+static const Os_Hal_CoreConfigType OsCfg_Hal_Core_OsCore2 =
+{
+  /* .CoreId                  = */ 2uL,
+  /* .ProgramCounterRegister  = */ 0uL,
+  /* .StartLabelAddress       = */ (Os_Hal_AddressType)&HostTest_CoreStartLabel,
+  /* .DBGSRRegister           = */ 0uL,
+  /* .SYSCON_CORECON_Register = */ 0uL,
+  /* .BOOTCONRegister         = */ 0uL
+};
+
+static const Os_Hal_CoreAsrConfigType OsCfg_Hal_CoreAsr_OsCore2 =
+{
+  /* .CoreId = */ 2uL
+};
+
+static const Os_Hal_CoreConfigType OsCfg_Hal_Core_OsCore3 =
+{
+  /* .CoreId                  = */ 3uL,
+  /* .ProgramCounterRegister  = */ 0uL,
+  /* .StartLabelAddress       = */ (Os_Hal_AddressType)&HostTest_CoreStartLabel,
+  /* .DBGSRRegister           = */ 0uL,
+  /* .SYSCON_CORECON_Register = */ 0uL,
+  /* .BOOTCONRegister         = */ 0uL
+};
+
+static const Os_Hal_CoreAsrConfigType OsCfg_Hal_CoreAsr_OsCore3 =
+{
+  /* .CoreId = */ 3uL
+};
+
+/* Task HostTask_Core0 */
+const Os_TaskConfigType OsCfg_Task_HostTask_Core0 =
+{
+  .Thread =
+  {
+    .Dyn = &OsCfg_Task_HostTask_Core0_Dyn.Thread,
+    .OwnerApplication = &OsCfg_App_HostApp_Core0,
+    .Core = &OsCfg_Core_OsCore0,
+    .IntApiState = &OsCfg_Core_OsCore0_Dyn.IntApiState,
+    .InitialCallContext = OS_CALLCONTEXT_TASK,
+    .InitDuringStartUp = FALSE,
+    .UsesFpu = FALSE
+  },
+  .TaskId = HostTask_Core0,
+  .MaxActivations = 1u,
+  .AccessingApplications = (Os_AppAccessMaskType)(1uL << HostApp_Core0)
+};
+
+static const Os_TaskConfigRefType OsCfg_App_HostApp_Core0_TaskRefs[2] =
+{
+  &OsCfg_Task_HostTask_Core0,
+  NULL_PTR
+};
+
+/* Application HostApp_Core0 */
+const Os_AppConfigType OsCfg_App_HostApp_Core0 =
+{
+  .Dyn = &OsCfg_App_HostApp_Core0_Dyn,
+  .Core = &OsCfg_Core_OsCore0,
+  .AccessRightId = (Os_AppMaskType)(1uL << HostApp_Core0),
+  .TaskRefs = OsCfg_App_HostApp_Core0_TaskRefs,
+  .TaskCount = 1u,
+  .IsTrusted = TRUE,
+  .IsPrivileged = TRUE,
+  .HasTimingProtectionDelay = FALSE,
+  .Id = HostApp_Core0
+};
+
+static const Os_AppConfigRefType OsCfg_Core_OsCore0_AppRefs[2] =
+{
+  &OsCfg_App_HostApp_Core0,
+  NULL_PTR
+};
+
+/* Core OsCore0 */
+const Os_CoreAsrConfigType OsCfg_Core_OsCore0 =
+{
+  .Core =
+  {
+    .Status = &OsCfg_Core_OsCore0_Status,
+    .HwConfig = &OsCfg_Hal_Core_OsCore0,
+    .Id = OS_CORE_ID_0,
+    .IsAsrCore = TRUE,
+    .IsAutostart = TRUE,
+    .IsMasterStartAllowed = TRUE,
+    .IsHardwareInitCore = TRUE
+  },
+  .Dyn = &OsCfg_Core_OsCore0_Dyn,
+  .KernelApp = &OsCfg_App_HostApp_Core0,
+  .AppRefs = OsCfg_Core_OsCore0_AppRefs,
+  .AppCount = 1u,
+  .HwConfig = &OsCfg_Hal_CoreAsr_OsCore0,
+  .CoreIdx = 0u
+};
+
+/* Task HostTask_Core1 */
+const Os_TaskConfigType OsCfg_Task_HostTask_Core1 =
+{
+  .Thread =
+  {
+    .Dyn = &OsCfg_Task_HostTask_Core1_Dyn.Thread,
+    .OwnerApplication = &OsCfg_App_HostApp_Core1,
+    .Core = &OsCfg_Core_OsCore1,
+    .IntApiState = &OsCfg_Core_OsCore1_Dyn.IntApiState,
+    .InitialCallContext = OS_CALLCONTEXT_TASK,
+    .InitDuringStartUp = FALSE,
+    .UsesFpu = FALSE
+  },
+  .TaskId = HostTask_Core1,
+  .MaxActivations = 1u,
+  .AccessingApplications = (Os_AppAccessMaskType)(1uL << HostApp_Core1)
+};
+
+static const Os_TaskConfigRefType OsCfg_App_HostApp_Core1_TaskRefs[2] =
+{
+  &OsCfg_Task_HostTask_Core1,
+  NULL_PTR
+};
+
+/* Application HostApp_Core1 */
+const Os_AppConfigType OsCfg_App_HostApp_Core1 =
+{
+  .Dyn = &OsCfg_App_HostApp_Core1_Dyn,
+  .Core = &OsCfg_Core_OsCore1,
+  .AccessRightId = (Os_AppMaskType)(1uL << HostApp_Core1),
+  .TaskRefs = OsCfg_App_HostApp_Core1_TaskRefs,
+  .TaskCount = 1u,
+  .IsTrusted = TRUE,
+  .IsPrivileged = TRUE,
+  .HasTimingProtectionDelay = FALSE,
+  .Id = HostApp_Core1
+};
+
+static const Os_AppConfigRefType OsCfg_Core_OsCore1_AppRefs[2] =
+{
+  &OsCfg_App_HostApp_Core1,
+  NULL_PTR
+};
+
+/* Core OsCore1 */
+const Os_CoreAsrConfigType OsCfg_Core_OsCore1 =
+{
+  .Core =
+  {
+    .Status = &OsCfg_Core_OsCore1_Status,
+    .HwConfig = &OsCfg_Hal_Core_OsCore1,
+    .Id = OS_CORE_ID_1,
+    .IsAsrCore = TRUE,
+    .IsAutostart = FALSE,
+    .IsMasterStartAllowed = FALSE,
+    .IsHardwareInitCore = FALSE
+  },
+  .Dyn = &OsCfg_Core_OsCore1_Dyn,
+  .KernelApp = &OsCfg_App_HostApp_Core1,
+  .AppRefs = OsCfg_Core_OsCore1_AppRefs,
+  .AppCount = 1u,
+  .HwConfig = &OsCfg_Hal_CoreAsr_OsCore1,
+  .CoreIdx = 1u
+};
+
+/* Task HostTask_Core2 */
+const Os_TaskConfigType OsCfg_Task_HostTask_Core2 =
+{
+  .Thread =
+  {
+    .Dyn = &OsCfg_Task_HostTask_Core2_Dyn.Thread,
+    .OwnerApplication = &OsCfg_App_HostApp_Core2,
+    .Core = &OsCfg_Core_OsCore2,
+    .IntApiState = &OsCfg_Core_OsCore2_Dyn.IntApiState,
+    .InitialCallContext = OS_CALLCONTEXT_TASK,
+    .InitDuringStartUp = FALSE,
+    .UsesFpu = FALSE
+  },
+  .TaskId = HostTask_Core2,
+  .MaxActivations = 1u,
+  .AccessingApplications = (Os_AppAccessMaskType)(1uL << HostApp_Core2)
+};
+
+static const Os_TaskConfigRefType OsCfg_App_HostApp_Core2_TaskRefs[2] =
+{
+  &OsCfg_Task_HostTask_Core2,
+  NULL_PTR
+};
+
+/* Application HostApp_Core2 */
+const Os_AppConfigType OsCfg_App_HostApp_Core2 =
+{
+  .Dyn = &OsCfg_App_HostApp_Core2_Dyn,
+  .Core = &OsCfg_Core_OsCore2,
+  .AccessRightId = (Os_AppMaskType)(1uL << HostApp_Core2),
+  .TaskRefs = OsCfg_App_HostApp_Core2_TaskRefs,
+  .TaskCount = 1u,
+  .IsTrusted = TRUE,
+  .IsPrivileged = TRUE,
+  .HasTimingProtectionDelay = FALSE,
+  .Id = HostApp_Core2
+};
+
+static const Os_AppConfigRefType OsCfg_Core_OsCore2_AppRefs[2] =
+{
+  &OsCfg_App_HostApp_Core2,
+  NULL_PTR
+};
+
+/* Core OsCore2 */
+const Os_CoreAsrConfigType OsCfg_Core_OsCore2 =
+{
+  .Core =
+  {
+    .Status = &OsCfg_Core_OsCore2_Status,
+    .HwConfig = &OsCfg_Hal_Core_OsCore2,
+    .Id = OS_CORE_ID_2,
+    .IsAsrCore = TRUE,
+    .IsAutostart = FALSE,
+    .IsMasterStartAllowed = FALSE,
+    .IsHardwareInitCore = FALSE
+  },
+  .Dyn = &OsCfg_Core_OsCore2_Dyn,
+  .KernelApp = &OsCfg_App_HostApp_Core2,
+  .AppRefs = OsCfg_Core_OsCore2_AppRefs,
+  .AppCount = 1u,
+  .HwConfig = &OsCfg_Hal_CoreAsr_OsCore2,
+  .CoreIdx = 2u
+};
+
+/* Task HostTask_Core3 */
+const Os_TaskConfigType OsCfg_Task_HostTask_Core3 =
+{
+  .Thread =
+  {
+    .Dyn = &OsCfg_Task_HostTask_Core3_Dyn.Thread,
+    .OwnerApplication = &OsCfg_App_HostApp_Core3,
+    .Core = &OsCfg_Core_OsCore3,
+    .IntApiState = &OsCfg_Core_OsCore3_Dyn.IntApiState,
+    .InitialCallContext = OS_CALLCONTEXT_TASK,
+    .InitDuringStartUp = FALSE,
+    .UsesFpu = FALSE
+  },
+  .TaskId = HostTask_Core3,
+  .MaxActivations = 1u,
+  .AccessingApplications = (Os_AppAccessMaskType)(1uL << HostApp_Core3)
+};
+
+static const Os_TaskConfigRefType OsCfg_App_HostApp_Core3_TaskRefs[2] =
+{
+  &OsCfg_Task_HostTask_Core3,
+  NULL_PTR
+};
+
+/* Application HostApp_Core3 */
+const Os_AppConfigType OsCfg_App_HostApp_Core3 =
+{
+  .Dyn = &OsCfg_App_HostApp_Core3_Dyn,
+  .Core = &OsCfg_Core_OsCore3,
+  .AccessRightId = (Os_AppMaskType)(1uL << HostApp_Core3),
+  .TaskRefs = OsCfg_App_HostApp_Core3_TaskRefs,
+  .TaskCount = 1u,
+  .IsTrusted = TRUE,
+  .IsPrivileged = TRUE,
+  .HasTimingProtectionDelay = FALSE,
+  .Id = HostApp_Core3
+};
+
+static const Os_AppConfigRefType OsCfg_Core_OsCore3_AppRefs[2] =
+{
+  &OsCfg_App_HostApp_Core3,
+  NULL_PTR
+};
+
+/* Core OsCore3 */
+const Os_CoreAsrConfigType OsCfg_Core_OsCore3 =
+{
+  .Core =
+  {
+    .Status = &OsCfg_Core_OsCore3_Status,
+    .HwConfig = &OsCfg_Hal_Core_OsCore3,
+    .Id = OS_CORE_ID_3,
+    .IsAsrCore = TRUE,
+    .IsAutostart = FALSE,
+    .IsMasterStartAllowed = FALSE,
+    .IsHardwareInitCore = FALSE
+  },
+  .Dyn = &OsCfg_Core_OsCore3_Dyn,
+  .KernelApp = &OsCfg_App_HostApp_Core3,
+  .AppRefs = OsCfg_Core_OsCore3_AppRefs,
+  .AppCount = 1u,
+  .HwConfig = &OsCfg_Hal_CoreAsr_OsCore3,
+  .CoreIdx = 3u
+};
+
+/* System */
+static Os_Hal_Core2ThreadType OsCfg_Hal_Core2Thread_Dyn[OS_CFG_COREPHYSICALID_COUNT];
+
+static const Os_Hal_Core2ThreadConfigType OsCfg_Hal_Core2Thread =
+{
+  .Core2Thread =
+  {
+    &OsCfg_Hal_Core2Thread_Dyn[0],
+    &OsCfg_Hal_Core2Thread_Dyn[1],
+    &OsCfg_Hal_Core2Thread_Dyn[2],
+    &OsCfg_Hal_Core2Thread_Dyn[3]
+  }
+};
+
+static const Os_Hal_SystemConfigType OsCfg_Hal_System = 0uL;
+
+const Os_SystemConfigType OsCfg_System =
+{
+  .NumberOfAsrCores = OS_COREASRCOREIDX_COUNT,
+  .SpinlockRefs = OsCfg_SpinlockRefs,
+  .SpinlockCount = OS_SPINLOCKID_COUNT,
+  .HwConfig = &OsCfg_Hal_System,
+  .Core2Thread = &OsCfg_Hal_Core2Thread
+};
+
+/**********************************************************************************************************************
+ *  OBJECT REFERENCES
+ *********************************************************************************************************************/
+
+const Os_CoreConfigType * const OsCfg_CoreRefs[OS_COREID_COUNT + 1u] =
+{
+  &OsCfg_Core_OsCore0.Core,
+  &OsCfg_Core_OsCore1.Core,
+  &OsCfg_Core_OsCore2.Core,
+  &OsCfg_Core_OsCore3.Core,
+  NULL_PTR
+};
+
+const Os_CoreConfigType * const OsCfg_CorePhysicalRefs[OS_CFG_COREPHYSICALID_COUNT + 1u] =
+{
+  &OsCfg_Core_OsCore0.Core,
+  &OsCfg_Core_OsCore1.Core,
+  &OsCfg_Core_OsCore2.Core,
+  &OsCfg_Core_OsCore3.Core,
+  NULL_PTR
+};
+
+Os_CoreBootBarrierType * const OsCfg_CoreBootBarrierRefs[OS_COREID_COUNT + 1u] =
+{
+  &OsCfg_Core_OsCore0_BootBarrier,
+  &OsCfg_Core_OsCore1_BootBarrier,
+  &OsCfg_Core_OsCore2_BootBarrier,
+  &OsCfg_Core_OsCore3_BootBarrier,
+  NULL_PTR
+};
+
+const Os_AppConfigType * const OsCfg_AppRefs[OS_APPID_COUNT + 1u] =
+{
+  &OsCfg_App_HostApp_Core0,
+  &OsCfg_App_HostApp_Core1,
+  &OsCfg_App_HostApp_Core2,
+  &OsCfg_App_HostApp_Core3,
+  NULL_PTR
+};
+
+const Os_TaskConfigType * const OsCfg_TaskRefs[OS_TASKID_COUNT + 1u] =
+{
+  &OsCfg_Task_HostTask_Core0,
+  &OsCfg_Task_HostTask_Core1,
+  &OsCfg_Task_HostTask_Core2,
+  &OsCfg_Task_HostTask_Core3,
+  NULL_PTR
+};
+
+const Os_SpinlockConfigType * const OsCfg_SpinlockRefs[OS_SPINLOCKID_COUNT + 1u] =
+{
+  NULL_PTR
+};
+
+/*! Service IDs of the cross core functions. */
+CONST(OSServiceIdType, OS_CONST) OsCfg_XSig_ServiceMap[OS_XSIGFUNCTIONIDX_COUNT] =
+{
+  OSServiceId_ActivateTask,
+  OSServiceId_CancelAlarm,
+  OSServiceId_ControlIdle,
+  OSServiceId_GetAlarm,
+  OSServiceId_GetApplicationState,
+  OSServiceId_GetCounterValue,
+  OSServiceId_GetErrorHookStackUsage,
+  OSServiceId_GetEvent,
+  OSServiceId_GetISRStackUsage,
+  OSServiceId_GetKernelStackUsage,
+  OSServiceId_GetNonTrustedFunctionStackUsage,
+  OSServiceId_GetProtectionHookStackUsage,
+  OSServiceId_GetScheduleTableStatus,
+  OSServiceId_GetShutdownHookStackUsage,
+  OSServiceId_GetStartupHookStackUsage,
+  OSServiceId_GetTaskStackUsage,
+  OSServiceId_GetTaskState,
+  OSServiceId_HookCallCallback,
+  OSServiceId_NextScheduleTable,
+  OSServiceId_SetAbsAlarm,
+  OSServiceId_SetEvent,
+  OSServiceId_SetRelAlarm,
+  OSServiceId_ShutdownAllCores,
+  OSServiceId_StartScheduleTableAbs,
+  OSServiceId_StartScheduleTableRel,
+  OSServiceId_StopScheduleTable,
+  OSServiceId_TerminateApplication
+};
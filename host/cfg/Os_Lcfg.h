@@ -0,0 +1,37 @@
+/**********************************************************************************************************************
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file   Os_Lcfg.h
+ *  \brief  Configuration data references of the POSIX host build.
+ *********************************************************************************************************************/
+
+#ifndef OS_LCFG_H
+# define OS_LCFG_H
+
+# include "Os_Cfg.h"
+# include "Os_Types_Lcfg.h"
+
+extern const struct Os_AlarmConfigType_Tag * const OsCfg_AlarmRefs[OS_ALARMID_COUNT + 1u];
+extern const struct Os_AppConfigType_Tag * const OsCfg_AppRefs[OS_APPID_COUNT + 1u];
+extern const struct Os_CoreConfigType_Tag * const OsCfg_CoreRefs[OS_COREID_COUNT + 1u];
+extern const struct Os_CoreConfigType_Tag * const OsCfg_CorePhysicalRefs[OS_CFG_COREPHYSICALID_COUNT + 1u];
+extern struct Os_CoreBootBarrierType_Tag * const OsCfg_CoreBootBarrierRefs[OS_COREID_COUNT + 1u];
+extern const struct Os_CounterConfigType_Tag * const OsCfg_CounterRefs[OS_COUNTERID_COUNT + 1u];
+extern const struct Os_HookConfigType_Tag * const OsCfg_HookRefs[OS_CFG_NUM_HOOKS + 1u];
+extern const struct Os_IsrConfigType_Tag * const OsCfg_IsrRefs[OS_ISRID_COUNT + 1u];
+extern const struct Os_PeripheralConfigType_Tag * const OsCfg_PeripheralRefs[OS_PERIPHERALID_COUNT + 1u];
+extern const struct Os_ResourceConfigType_Tag * const OsCfg_ResourceRefs[OS_RESOURCEID_COUNT + 1u];
+extern const struct Os_SchTConfigType_Tag * const OsCfg_SchTRefs[OS_SCHTID_COUNT + 1u];
+extern const struct Os_ServiceFtfConfigType_Tag * const
+  OsCfg_FastTrustedFunctionRefs[OS_FASTTRUSTEDFUNCTIONID_COUNT + 1u];
+extern const struct Os_ServiceNtfConfigType_Tag * const OsCfg_NonTrustedFunctionRefs[OS_NONTRUSTEDFUNCTIONID_COUNT + 1u];
+extern const struct Os_ServiceTfConfigType_Tag * const OsCfg_TrustedFunctionRefs[OS_TRUSTEDFUNCTIONID_COUNT + 1u];
+extern const struct Os_SpinlockConfigType_Tag * const OsCfg_SpinlockRefs[OS_SPINLOCKID_COUNT + 1u];
+extern const struct Os_TaskConfigType_Tag * const OsCfg_TaskRefs[OS_TASKID_COUNT + 1u];
+extern const struct Os_TaskSetConfigType_Tag * const OsCfg_TaskSetRefs[OS_TASKSETID_COUNT + 1u];
+extern const struct Os_SystemConfigType_Tag OsCfg_System;
+extern const struct Os_LinkerSectionLabelsType_Tag * const OsCfg_OsCode_Sections[OS_CFG_NUM_OSCODE_SECTIONS + 1u];
+extern struct Os_ExceptionContextType_Tag * const OsCfg_Hal_Context_ExceptionContextRef[OS_CFG_COREPHYSICALID_COUNT + 1u];
+extern const struct Os_Hal_ContextStackConfigType_Tag * const OsCfg_Stack_KernelStacks[OS_CFG_COREPHYSICALID_COUNT + 1u];
+
+#endif /* OS_LCFG_H */
@@ -0,0 +1,10 @@
+/**********************************************************************************************************************
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file   Os_MemMap_OsSectionsInt.h
+ *  \brief  Memory mapping of the POSIX host build.
+ *  \details The host build places all sections into the default sections of the host toolchain. Therefore every
+ *           section define is accepted. No include guard, as this file is included for every section switch.
+ *********************************************************************************************************************/
+
+#undef MEMMAP_ERROR
@@ -0,0 +1,13 @@
+/**********************************************************************************************************************
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file   Os_MemoryProtection_Cfg.h
+ *  \brief  MemoryProtection configuration of the POSIX host build. The host build does not configure further MemoryProtection data.
+ *********************************************************************************************************************/
+
+#ifndef OS_MEMORYPROTECTION_CFG_H
+# define OS_MEMORYPROTECTION_CFG_H
+
+# include "Os_Cfg.h"
+
+#endif /* OS_MEMORYPROTECTION_CFG_H */
@@ -0,0 +1,13 @@
+/**********************************************************************************************************************
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file   Os_MemoryProtection_Lcfg.h
+ *  \brief  MemoryProtection configuration of the POSIX host build. The host build does not configure further MemoryProtection data.
+ *********************************************************************************************************************/
+
+#ifndef OS_MEMORYPROTECTION_LCFG_H
+# define OS_MEMORYPROTECTION_LCFG_H
+
+# include "Os_Lcfg.h"
+
+#endif /* OS_MEMORYPROTECTION_LCFG_H */
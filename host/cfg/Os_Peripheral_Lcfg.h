@@ -0,0 +1,13 @@
+/**********************************************************************************************************************
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file   Os_Peripheral_Lcfg.h
+ *  \brief  Peripheral configuration of the POSIX host build. The host build does not configure further Peripheral data.
+ *********************************************************************************************************************/
+
+#ifndef OS_PERIPHERAL_LCFG_H
+# define OS_PERIPHERAL_LCFG_H
+
+# include "Os_Lcfg.h"
+
+#endif /* OS_PERIPHERAL_LCFG_H */
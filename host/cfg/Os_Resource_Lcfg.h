@@ -0,0 +1,13 @@
+/**********************************************************************************************************************
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file   Os_Resource_Lcfg.h
+ *  \brief  Resource configuration of the POSIX host build. The host build does not configure further Resource data.
+ *********************************************************************************************************************/
+
+#ifndef OS_RESOURCE_LCFG_H
+# define OS_RESOURCE_LCFG_H
+
+# include "Os_Lcfg.h"
+
+#endif /* OS_RESOURCE_LCFG_H */
@@ -0,0 +1,13 @@
+/**********************************************************************************************************************
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file   Os_ScheduleTable_Cfg.h
+ *  \brief  ScheduleTable configuration of the POSIX host build. The host build does not configure further ScheduleTable data.
+ *********************************************************************************************************************/
+
+#ifndef OS_SCHEDULETABLE_CFG_H
+# define OS_SCHEDULETABLE_CFG_H
+
+# include "Os_Cfg.h"
+
+#endif /* OS_SCHEDULETABLE_CFG_H */
@@ -0,0 +1,13 @@
+/**********************************************************************************************************************
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file   Os_ScheduleTable_Lcfg.h
+ *  \brief  ScheduleTable configuration of the POSIX host build. The host build does not configure further ScheduleTable data.
+ *********************************************************************************************************************/
+
+#ifndef OS_SCHEDULETABLE_LCFG_H
+# define OS_SCHEDULETABLE_LCFG_H
+
+# include "Os_Lcfg.h"
+
+#endif /* OS_SCHEDULETABLE_LCFG_H */
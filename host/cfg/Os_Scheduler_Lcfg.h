@@ -0,0 +1,13 @@
+/**********************************************************************************************************************
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file   Os_Scheduler_Lcfg.h
+ *  \brief  Scheduler configuration of the POSIX host build. The host build does not configure further Scheduler data.
+ *********************************************************************************************************************/
+
+#ifndef OS_SCHEDULER_LCFG_H
+# define OS_SCHEDULER_LCFG_H
+
+# include "Os_Lcfg.h"
+
+#endif /* OS_SCHEDULER_LCFG_H */
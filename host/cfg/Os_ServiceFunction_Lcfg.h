@@ -0,0 +1,13 @@
+/**********************************************************************************************************************
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file   Os_ServiceFunction_Lcfg.h
+ *  \brief  ServiceFunction configuration of the POSIX host build. The host build does not configure further ServiceFunction data.
+ *********************************************************************************************************************/
+
+#ifndef OS_SERVICEFUNCTION_LCFG_H
+# define OS_SERVICEFUNCTION_LCFG_H
+
+# include "Os_Lcfg.h"
+
+#endif /* OS_SERVICEFUNCTION_LCFG_H */
@@ -0,0 +1,13 @@
+/**********************************************************************************************************************
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file   Os_Spinlock_Lcfg.h
+ *  \brief  Spinlock configuration of the POSIX host build. The host build does not configure further Spinlock data.
+ *********************************************************************************************************************/
+
+#ifndef OS_SPINLOCK_LCFG_H
+# define OS_SPINLOCK_LCFG_H
+
+# include "Os_Lcfg.h"
+
+#endif /* OS_SPINLOCK_LCFG_H */
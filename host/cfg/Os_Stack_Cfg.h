@@ -0,0 +1,13 @@
+/**********************************************************************************************************************
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file   Os_Stack_Cfg.h
+ *  \brief  Stack configuration of the POSIX host build. The host build does not configure further Stack data.
+ *********************************************************************************************************************/
+
+#ifndef OS_STACK_CFG_H
+# define OS_STACK_CFG_H
+
+# include "Os_Cfg.h"
+
+#endif /* OS_STACK_CFG_H */
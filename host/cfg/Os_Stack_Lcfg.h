@@ -0,0 +1,13 @@
+/**********************************************************************************************************************
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file   Os_Stack_Lcfg.h
+ *  \brief  Stack configuration of the POSIX host build. The host build does not configure further Stack data.
+ *********************************************************************************************************************/
+
+#ifndef OS_STACK_LCFG_H
+# define OS_STACK_LCFG_H
+
+# include "Os_Lcfg.h"
+
+#endif /* OS_STACK_LCFG_H */
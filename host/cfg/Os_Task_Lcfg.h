@@ -0,0 +1,13 @@
+/**********************************************************************************************************************
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file   Os_Task_Lcfg.h
+ *  \brief  Task configuration of the POSIX host build. The host build does not configure further Task data.
+ *********************************************************************************************************************/
+
+#ifndef OS_TASK_LCFG_H
+# define OS_TASK_LCFG_H
+
+# include "Os_Lcfg.h"
+
+#endif /* OS_TASK_LCFG_H */
@@ -0,0 +1,13 @@
+/**********************************************************************************************************************
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file   Os_TimingProtection_Cfg.h
+ *  \brief  TimingProtection configuration of the POSIX host build. The host build does not configure further TimingProtection data.
+ *********************************************************************************************************************/
+
+#ifndef OS_TIMINGPROTECTION_CFG_H
+# define OS_TIMINGPROTECTION_CFG_H
+
+# include "Os_Cfg.h"
+
+#endif /* OS_TIMINGPROTECTION_CFG_H */
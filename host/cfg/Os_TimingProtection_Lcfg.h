@@ -0,0 +1,13 @@
+/**********************************************************************************************************************
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file   Os_TimingProtection_Lcfg.h
+ *  \brief  TimingProtection configuration of the POSIX host build. The host build does not configure further TimingProtection data.
+ *********************************************************************************************************************/
+
+#ifndef OS_TIMINGPROTECTION_LCFG_H
+# define OS_TIMINGPROTECTION_LCFG_H
+
+# include "Os_Lcfg.h"
+
+#endif /* OS_TIMINGPROTECTION_LCFG_H */
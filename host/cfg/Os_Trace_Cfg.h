@@ -0,0 +1,13 @@
+/**********************************************************************************************************************
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file   Os_Trace_Cfg.h
+ *  \brief  Trace configuration of the POSIX host build. The host build does not configure further Trace data.
+ *********************************************************************************************************************/
+
+#ifndef OS_TRACE_CFG_H
+# define OS_TRACE_CFG_H
+
+# include "Os_Cfg.h"
+
+#endif /* OS_TRACE_CFG_H */
@@ -0,0 +1,13 @@
+/**********************************************************************************************************************
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file   Os_Trace_Lcfg.h
+ *  \brief  Trace configuration of the POSIX host build. The host build does not configure further Trace data.
+ *********************************************************************************************************************/
+
+#ifndef OS_TRACE_LCFG_H
+# define OS_TRACE_LCFG_H
+
+# include "Os_Lcfg.h"
+
+#endif /* OS_TRACE_LCFG_H */
@@ -0,0 +1,131 @@
+/**********************************************************************************************************************
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file   Os_Types_Lcfg.h
+ *  \brief  Object identifiers of the POSIX host build configuration.
+ *********************************************************************************************************************/
+
+#ifndef OS_TYPES_LCFG_H
+# define OS_TYPES_LCFG_H
+
+# include "Std_Types.h"
+
+/*! Number of AUTOSAR cores. */
+# define OS_COREASRCOREIDX_COUNT                       (4u)
+
+/*! Number of used and of all cross core functions. */
+# define OS_XSIGFUNCTIONIDX_USEDCOUNT                  (27u)
+# define OS_XSIGFUNCTIONIDX_COUNT                      (27u)
+
+/*! Application modes. */
+# define OSDEFAULTAPPMODE                              ((AppModeType)0x01u)
+# define DONOTCARE                                     ((AppModeType)0x00u)
+
+/*! IOC return values. */
+# define IOC_E_OK                                      ((Std_ReturnType)0u)
+# define IOC_E_NOK                                     ((Std_ReturnType)1u)
+# define IOC_E_LOST_DATA                               ((Std_ReturnType)64u)
+# define IOC_E_LIMIT                                   ((Std_ReturnType)130u)
+# define IOC_E_NO_DATA                                 ((Std_ReturnType)131u)
+
+/*! Counter ticks. */
+typedef uint32 TickType;
+
+/*! Access masks are pointer sized, as they hold the address of an access array if it is needed. */
+typedef unsigned long Os_AppAccessMaskType;
+
+/*! Index of an AUTOSAR core. */
+typedef uint32 Os_CoreAsrCoreIdx;
+
+/*! Tasks: one per core. */
+typedef enum
+{
+  HostTask_Core0 = 0,
+  HostTask_Core1 = 1,
+  HostTask_Core2 = 2,
+  HostTask_Core3 = 3,
+  OS_TASKID_COUNT = 4,
+  INVALID_TASK = OS_TASKID_COUNT
+} TaskType;
+
+/*! Applications: one trusted application per core. */
+typedef enum
+{
+  HostApp_Core0 = 0,
+  HostApp_Core1 = 1,
+  HostApp_Core2 = 2,
+  HostApp_Core3 = 3,
+  OS_APPID_COUNT = 4,
+  INVALID_OSAPPLICATION = OS_APPID_COUNT
+} ApplicationType;
+
+/*! Cores. */
+typedef enum
+{
+  OS_CORE_ID_0 = 0,
+  OS_CORE_ID_1 = 1,
+  OS_CORE_ID_2 = 2,
+  OS_CORE_ID_3 = 3,
+  OS_COREID_COUNT = 4,
+  OS_CORE_ID_INVALID = OS_COREID_COUNT
+} CoreIdType;
+
+/*! The master core. */
+# define OS_CORE_ID_MASTER                             (OS_CORE_ID_0)
+
+/* Object types which are not configured. Test objects do not need identifiers. */
+typedef enum { OS_TASKSETID_COUNT = 0, INVALID_TASKSET = OS_TASKSETID_COUNT } Os_TaskSetIdType;
+typedef enum { OS_ISRID_COUNT = 0, INVALID_ISR = OS_ISRID_COUNT } ISRType;
+typedef enum { OS_ALARMID_COUNT = 0, INVALID_ALARM = OS_ALARMID_COUNT } AlarmType;
+typedef enum { OS_COUNTERID_COUNT = 0, INVALID_COUNTER = OS_COUNTERID_COUNT } CounterType;
+typedef enum { OS_SCHTID_COUNT = 0, INVALID_SCHEDULETABLE = OS_SCHTID_COUNT } ScheduleTableType;
+typedef enum { OS_RESOURCEID_COUNT = 0, INVALID_RESOURCE = OS_RESOURCEID_COUNT } ResourceType;
+typedef enum { OS_SPINLOCKID_COUNT = 0, INVALID_SPINLOCK = OS_SPINLOCKID_COUNT } SpinlockIdType;
+typedef enum { OS_TRUSTEDFUNCTIONID_COUNT = 0, INVALID_FUNCTION = OS_TRUSTEDFUNCTIONID_COUNT }
+  TrustedFunctionIndexType;
+typedef enum { OS_NONTRUSTEDFUNCTIONID_COUNT = 0, INVALID_NONTRUSTED_FUNCTION = OS_NONTRUSTEDFUNCTIONID_COUNT }
+  Os_NonTrustedFunctionIndexType;
+typedef enum { OS_FASTTRUSTEDFUNCTIONID_COUNT = 0, INVALID_FAST_TRUSTED_FUNCTION = OS_FASTTRUSTEDFUNCTIONID_COUNT }
+  Os_FastTrustedFunctionIndexType;
+typedef enum { OS_PERIPHERALID_COUNT = 0, INVALID_PERIPHERAL = OS_PERIPHERALID_COUNT } Os_PeripheralIdType;
+typedef enum { OS_BARRIERID_COUNT = 0, INVALID_BARRIER = OS_BARRIERID_COUNT } Os_BarrierIdType;
+typedef enum { OS_IOCID_COUNT = 0 } Os_IocChannelIdType;
+
+/*! Trace identifiers. */
+typedef enum { OS_TRACE_NUMBER_OF_CONFIGURED_THREADS = 4, OS_TRACE_INVALID_THREAD } Os_TraceThreadIdType;
+typedef enum { OS_TRACE_NUMBER_OF_CONFIGURED_SPINLOCKS = 0, OS_TRACE_INVALID_SPINLOCK } Os_TraceSpinlockIdType;
+
+/*! Cross core functions. */
+typedef enum
+{
+  XSigFunctionIdx_ActivateTask,
+  XSigFunctionIdx_CancelAlarm,
+  XSigFunctionIdx_ControlIdle,
+  XSigFunctionIdx_GetAlarm,
+  XSigFunctionIdx_GetApplicationState,
+  XSigFunctionIdx_GetCounterValue,
+  XSigFunctionIdx_GetErrorHookStackUsage,
+  XSigFunctionIdx_GetEvent,
+  XSigFunctionIdx_GetISRStackUsage,
+  XSigFunctionIdx_GetKernelStackUsage,
+  XSigFunctionIdx_GetNonTrustedFunctionStackUsage,
+  XSigFunctionIdx_GetProtectionHookStackUsage,
+  XSigFunctionIdx_GetScheduleTableStatus,
+  XSigFunctionIdx_GetShutdownHookStackUsage,
+  XSigFunctionIdx_GetStartupHookStackUsage,
+  XSigFunctionIdx_GetTaskStackUsage,
+  XSigFunctionIdx_GetTaskState,
+  XSigFunctionIdx_HookCallCallback,
+  XSigFunctionIdx_NextScheduleTable,
+  XSigFunctionIdx_SetAbsAlarm,
+  XSigFunctionIdx_SetEvent,
+  XSigFunctionIdx_SetRelAlarm,
+  XSigFunctionIdx_ShutdownAllCores,
+  XSigFunctionIdx_StartScheduleTableAbs,
+  XSigFunctionIdx_StartScheduleTableRel,
+  XSigFunctionIdx_StopScheduleTable,
+  XSigFunctionIdx_TerminateApplication,
+  XSigFunctionIdx_Count
+} Os_XSigFunctionIdx;
+
+#endif /* OS_TYPES_LCFG_H */
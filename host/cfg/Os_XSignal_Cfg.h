@@ -0,0 +1,13 @@
+/**********************************************************************************************************************
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file   Os_XSignal_Cfg.h
+ *  \brief  XSignal configuration of the POSIX host build. The host build does not configure further XSignal data.
+ *********************************************************************************************************************/
+
+#ifndef OS_XSIGNAL_CFG_H
+# define OS_XSIGNAL_CFG_H
+
+# include "Os_Cfg.h"
+
+#endif /* OS_XSIGNAL_CFG_H */
@@ -0,0 +1,17 @@
+/**********************************************************************************************************************
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file   Os_XSignal_Lcfg.h
+ *  \brief  Cross core signal configuration of the POSIX host build.
+ *********************************************************************************************************************/
+
+#ifndef OS_XSIGNAL_LCFG_H
+# define OS_XSIGNAL_LCFG_H
+
+# include "Os_Lcfg.h"
+# include "Os_Types.h"
+
+/*! Service IDs of the cross core functions. */
+extern CONST(OSServiceIdType, OS_CONST) OsCfg_XSig_ServiceMap[OS_XSIGFUNCTIONIDX_COUNT];
+
+#endif /* OS_XSIGNAL_LCFG_H */
@@ -0,0 +1,58 @@
+/**********************************************************************************************************************
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file   Platform_Types.h
+ *  \brief  AUTOSAR platform types of the POSIX host (ILP32 and LP64).
+ *********************************************************************************************************************/
+
+#ifndef PLATFORM_TYPES_H
+# define PLATFORM_TYPES_H
+
+# define CPU_TYPE_8                   8u
+# define CPU_TYPE_16                  16u
+# define CPU_TYPE_32                  32u
+# define CPU_TYPE_64                  64u
+
+# define MSB_FIRST                    0u
+# define LSB_FIRST                    1u
+
+# define HIGH_BYTE_FIRST              0u
+# define LOW_BYTE_FIRST               1u
+
+# if defined (__LP64__)
+#  define CPU_TYPE                    CPU_TYPE_64
+# else
+#  define CPU_TYPE                    CPU_TYPE_32
+# endif
+# define CPU_BIT_ORDER                LSB_FIRST
+# define CPU_BYTE_ORDER               LOW_BYTE_FIRST
+
+# ifndef TRUE
+#  define TRUE                        1u
+# endif
+# ifndef FALSE
+#  define FALSE                       0u
+# endif
+
+typedef unsigned char                 boolean;
+
+typedef signed char                   sint8;
+typedef unsigned char                 uint8;
+typedef signed short                  sint16;
+typedef unsigned short                uint16;
+typedef signed int                    sint32;
+typedef unsigned int                  uint32;
+typedef signed long long              sint64;
+typedef unsigned long long            uint64;
+
+typedef signed int                    sint8_least;
+typedef unsigned int                  uint8_least;
+typedef signed int                    sint16_least;
+typedef unsigned int                  uint16_least;
+typedef signed int                    sint32_least;
+typedef unsigned int                  uint32_least;
+
+typedef float                         float32;
+typedef double                        float64;
+
+#endif /* PLATFORM_TYPES_H */
@@ -0,0 +1,41 @@
+/**********************************************************************************************************************
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file   Std_Types.h
+ *  \brief  AUTOSAR standard types of the POSIX host.
+ *********************************************************************************************************************/
+
+#ifndef STD_TYPES_H
+# define STD_TYPES_H
+
+# include "Platform_Types.h"
+# include "Compiler.h"
+
+# define STD_HIGH                     1u
+# define STD_LOW                      0u
+
+# define STD_ACTIVE                   1u
+# define STD_IDLE                     0u
+
+# define STD_ON                       1u
+# define STD_OFF                      0u
+
+# ifndef STATUSTYPEDEFINED
+#  define STATUSTYPEDEFINED
+#  define E_OK                        0u
+typedef unsigned char StatusType;
+# endif
+# define E_NOT_OK                     1u
+
+typedef uint8 Std_ReturnType;
+
+typedef struct
+{
+  uint16 vendorID;
+  uint16 moduleID;
+  uint8  sw_major_version;
+  uint8  sw_minor_version;
+  uint8  sw_patch_version;
+} Std_VersionInfoType;
+
+#endif /* STD_TYPES_H */
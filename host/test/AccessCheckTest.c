@@ -0,0 +1,186 @@
+/**********************************************************************************************************************
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file   AccessCheckTest.c
+ *  \brief  Comparison of the bisection and the linear search of access check regions.
+ *  \details
+ *  A random table of sorted, non-overlapping regions is generated. Some regions adjoin their predecessor, so that
+ *  ranges across region borders are checked. Both searches have to return the same access rights for:
+ *  - The borders of each region and the addresses just outside of them.
+ *  - Random ranges over the whole table and beyond it.
+ *  The test prints the mean time of both searches over the random ranges. Finally Os_AccessCheckIsSortingValid() has
+ *  to reject the table, after two of its regions have been made to overlap.
+ *********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include <stdio.h>
+#include <time.h>
+
+#include "HostTest.h"
+
+#include "Os_AccessCheck.h"
+
+/**********************************************************************************************************************
+ *  LOCAL CONSTANT MACROS
+ *********************************************************************************************************************/
+/*! Number of regions in the table. The region index is 8 bit wide. */
+#define ACCESSCHECKTEST_REGIONS       (255u)
+
+/*! Maximum gap between two regions and maximum length of a region. */
+#define ACCESSCHECKTEST_MAX_GAP       (64u)
+#define ACCESSCHECKTEST_MAX_LENGTH    (256u)
+
+/*! Number of random ranges. */
+#define ACCESSCHECKTEST_RANGES        (100000uL)
+
+/*! Start of the first region. */
+#define ACCESSCHECKTEST_BASE          (0x1000u)
+
+/**********************************************************************************************************************
+ *  LOCAL DATA
+ *********************************************************************************************************************/
+/*! The regions and the sorted access rights on them. */
+static Os_AccessCheckRegionConfigType AccessCheckTest_Regions[ACCESSCHECKTEST_REGIONS];
+
+static const Os_AccessCheckConfigType AccessCheckTest_Sorted =
+{
+  .Regions = AccessCheckTest_Regions,
+  .RegionCount = ACCESSCHECKTEST_REGIONS,
+  .RegionsSorted = TRUE
+};
+
+/*! The random ranges. */
+static Os_AccessCheckAddress AccessCheckTest_Start[ACCESSCHECKTEST_RANGES];
+static Os_AccessCheckAddress AccessCheckTest_End[ACCESSCHECKTEST_RANGES];
+
+/*! Sink of the benchmark results, so that the searches are not optimized away. */
+static volatile uint32 AccessCheckTest_Sink;
+
+/**********************************************************************************************************************
+ *  LOCAL FUNCTIONS
+ *********************************************************************************************************************/
+
+/*! Returns the current time in nanoseconds. */
+static uint64 AccessCheckTest_Now(void)
+{
+  struct timespec now;
+
+  (void)clock_gettime(CLOCK_MONOTONIC, &now);
+  return ((uint64)now.tv_sec * 1000000000uLL) + (uint64)now.tv_nsec;
+}
+
+
+/*! Checks that both searches return the same access rights for the given range. */
+static void AccessCheckTest_Compare(Os_AccessCheckAddress AddressStart, Os_AccessCheckAddress AddressEnd)
+{
+  HOSTTEST_CHECK(Os_AccessCheckSearchSorted(&AccessCheckTest_Sorted, AddressStart, AddressEnd) ==
+                 Os_AccessCheckSearchLinear(&AccessCheckTest_Sorted, AddressStart, AddressEnd));
+}
+
+
+/*! Prints the mean time of the given search over the random ranges. */
+static void AccessCheckTest_Measure(const char* Name,
+                                    AccessType (*Search)(const Os_AccessCheckConfigType*, Os_AccessCheckAddress,
+                                                         Os_AccessCheckAddress))
+{
+  uint64 start;
+  uint32 range;
+  uint32 sum = 0u;
+
+  start = AccessCheckTest_Now();
+  for(range = 0u; range < ACCESSCHECKTEST_RANGES; range++)
+  {
+    sum += (uint32)Search(&AccessCheckTest_Sorted, AccessCheckTest_Start[range], AccessCheckTest_End[range]);
+  }
+
+  AccessCheckTest_Sink = sum;
+  (void)printf("AccessCheckTest: %u regions: %s search: %llu ns\n", (unsigned int)ACCESSCHECKTEST_REGIONS, Name,
+               (unsigned long long)((AccessCheckTest_Now() - start) / ACCESSCHECKTEST_RANGES));
+}
+
+
+/*! Linear search with the signature of the benchmark. */
+static AccessType AccessCheckTest_SearchLinear(const Os_AccessCheckConfigType* AccessRights,
+                                               Os_AccessCheckAddress AddressStart, Os_AccessCheckAddress AddressEnd)
+{
+  return Os_AccessCheckSearchLinear(AccessRights, AddressStart, AddressEnd);
+}
+
+
+/*! Bisection with the signature of the benchmark. */
+static AccessType AccessCheckTest_SearchSorted(const Os_AccessCheckConfigType* AccessRights,
+                                               Os_AccessCheckAddress AddressStart, Os_AccessCheckAddress AddressEnd)
+{
+  return Os_AccessCheckSearchSorted(AccessRights, AddressStart, AddressEnd);
+}
+
+/**********************************************************************************************************************
+ *  GLOBAL FUNCTIONS
+ *********************************************************************************************************************/
+
+int main(void)
+{
+  uint32 seed = 0x9E3779B9u;
+  Os_AccessCheckAddress address = ACCESSCHECKTEST_BASE;
+  Os_AccessCheckAddress limit;
+  uint32 region;
+  uint32 range;
+
+  /* #10 Generate the regions. Every fourth region adjoins its predecessor. */
+  for(region = 0u; region < ACCESSCHECKTEST_REGIONS; region++)
+  {
+    if((HostTest_Random(&seed) % 4u) != 0u)
+    {
+      address += 1u + (HostTest_Random(&seed) % ACCESSCHECKTEST_MAX_GAP);
+    }
+
+    AccessCheckTest_Regions[region].AddressStart = address;
+    address += HostTest_Random(&seed) % ACCESSCHECKTEST_MAX_LENGTH;
+    AccessCheckTest_Regions[region].AddressEnd = address;
+    AccessCheckTest_Regions[region].AccessRights = (AccessType)(1u + (HostTest_Random(&seed) % 7u));
+    address++;
+  }
+  limit = address + ACCESSCHECKTEST_MAX_GAP;
+
+  HOSTTEST_CHECK(Os_AccessCheckIsSortingValid(&AccessCheckTest_Sorted) != 0u);
+
+  /* #20 Compare the searches at the borders of each region. */
+  for(region = 0u; region < ACCESSCHECKTEST_REGIONS; region++)
+  {
+    Os_AccessCheckAddress start = AccessCheckTest_Regions[region].AddressStart;
+    Os_AccessCheckAddress end = AccessCheckTest_Regions[region].AddressEnd;
+
+    HOSTTEST_CHECK(Os_AccessCheckSearchSorted(&AccessCheckTest_Sorted, start, end) ==
+                   AccessCheckTest_Regions[region].AccessRights);
+    AccessCheckTest_Compare(start, start);
+    AccessCheckTest_Compare(end, end);
+    AccessCheckTest_Compare(start - 1u, start - 1u);
+    AccessCheckTest_Compare(end + 1u, end + 1u);
+    AccessCheckTest_Compare(start - 1u, end);
+    AccessCheckTest_Compare(start, end + 1u);
+  }
+
+  /* #30 Compare the searches for random ranges. Most of them are short, some span several regions. */
+  for(range = 0u; range < ACCESSCHECKTEST_RANGES; range++)
+  {
+    Os_AccessCheckAddress start = HostTest_Random(&seed) % limit;
+    Os_AccessCheckAddress length = HostTest_Random(&seed) % (((range % 8u) == 0u) ? 4096u : 64u);
+
+    AccessCheckTest_Start[range] = start;
+    AccessCheckTest_End[range] = start + length;
+    AccessCheckTest_Compare(start, start + length);
+  }
+
+  /* #40 Measure both searches. */
+  AccessCheckTest_Measure("linear", AccessCheckTest_SearchLinear);
+  AccessCheckTest_Measure("bisection", AccessCheckTest_SearchSorted);
+
+  /* #50 Overlapping regions are rejected. */
+  AccessCheckTest_Regions[ACCESSCHECKTEST_REGIONS / 2u].AddressEnd =
+    AccessCheckTest_Regions[(ACCESSCHECKTEST_REGIONS / 2u) + 1u].AddressStart;
+  HOSTTEST_CHECK(Os_AccessCheckIsSortingValid(&AccessCheckTest_Sorted) == 0u);
+
+  return 0;
+}
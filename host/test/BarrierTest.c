@@ -0,0 +1,221 @@
+/**********************************************************************************************************************
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file   BarrierTest.c
+ *  \brief  Round trip test of the barrier synchronization.
+ *  \details
+ *  The cores run synchronization points on a barrier with 2 to 4 attached attendees. Before each synchronization
+ *  point, an attendee publishes the number of the point. After it, all attached attendees have to have reached the
+ *  point and no attendee may have passed the next one. The attendees yield at random, so that each of them becomes
+ *  the last arriving one. With 4 attendees, the last core detaches half way, when the others wait for it. This has
+ *  to open the barrier for them.
+ *  A second barrier, to which all cores stay attached, separates the runs. The test prints the mean round trip time
+ *  of each run.
+ *********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include <stdio.h>
+#include <time.h>
+
+#include "HostTest.h"
+
+#include "Os_Barrier.h"
+#include "Os_Hal_Core.h"
+
+/**********************************************************************************************************************
+ *  LOCAL CONSTANT MACROS
+ *********************************************************************************************************************/
+/*! Number of emulated cores. */
+#define BARRIERTEST_CORES             (4u)
+
+/*! Smallest number of attendees of a run. */
+#define BARRIERTEST_MIN_ATTENDEES     (2u)
+
+/*! Number of synchronization points per run. */
+#define BARRIERTEST_ROUNDS            (2000uL)
+
+/*! The tested barrier and the barrier, which separates the runs. */
+#define BARRIERTEST_TESTED            (0u)
+#define BARRIERTEST_OUTER             (1u)
+#define BARRIERTEST_BARRIERS          (2u)
+
+/**********************************************************************************************************************
+ *  LOCAL DATA
+ *********************************************************************************************************************/
+/*! Runtime data of the attendees and the shared states of the barriers. */
+static volatile Os_BarrierBaseType BarrierTest_Dyn[BARRIERTEST_BARRIERS][BARRIERTEST_CORES];
+static volatile Os_BarrierStateType BarrierTest_State[BARRIERTEST_BARRIERS];
+
+/*! The attendees of both barriers. One attendee per core. */
+static const Os_BarrierBaseConfigType BarrierTest_Attendees[BARRIERTEST_BARRIERS][BARRIERTEST_CORES];
+
+static const Os_BarrierAttendeeRefType BarrierTest_AttendeeRefs[BARRIERTEST_BARRIERS][BARRIERTEST_CORES] =
+{
+  {
+    &BarrierTest_Attendees[BARRIERTEST_TESTED][0], &BarrierTest_Attendees[BARRIERTEST_TESTED][1],
+    &BarrierTest_Attendees[BARRIERTEST_TESTED][2], &BarrierTest_Attendees[BARRIERTEST_TESTED][3]
+  },
+  {
+    &BarrierTest_Attendees[BARRIERTEST_OUTER][0], &BarrierTest_Attendees[BARRIERTEST_OUTER][1],
+    &BarrierTest_Attendees[BARRIERTEST_OUTER][2], &BarrierTest_Attendees[BARRIERTEST_OUTER][3]
+  }
+};
+
+#define BARRIERTEST_ATTENDEE(Barrier, Core)                                                                             \
+  {                                                                                                                     \
+    .Dyn = &BarrierTest_Dyn[(Barrier)][(Core)],                                                                         \
+    .State = &BarrierTest_State[(Barrier)],                                                                             \
+    .AttendeeRefs = BarrierTest_AttendeeRefs[(Barrier)],                                                                \
+    .AttendeeCount = BARRIERTEST_CORES,                                                                                 \
+    .TaskPtr = NULL_PTR                                                                                                 \
+  }
+
+static const Os_BarrierBaseConfigType BarrierTest_Attendees[BARRIERTEST_BARRIERS][BARRIERTEST_CORES] =
+{
+  {
+    BARRIERTEST_ATTENDEE(BARRIERTEST_TESTED, 0u), BARRIERTEST_ATTENDEE(BARRIERTEST_TESTED, 1u),
+    BARRIERTEST_ATTENDEE(BARRIERTEST_TESTED, 2u), BARRIERTEST_ATTENDEE(BARRIERTEST_TESTED, 3u)
+  },
+  {
+    BARRIERTEST_ATTENDEE(BARRIERTEST_OUTER, 0u), BARRIERTEST_ATTENDEE(BARRIERTEST_OUTER, 1u),
+    BARRIERTEST_ATTENDEE(BARRIERTEST_OUTER, 2u), BARRIERTEST_ATTENDEE(BARRIERTEST_OUTER, 3u)
+  }
+};
+
+/*! The last synchronization point, which each core has reached, and whether it has left the run. */
+static volatile uint32 BarrierTest_Reached[BARRIERTEST_CORES];
+static volatile uint32 BarrierTest_Left[BARRIERTEST_CORES];
+
+/*! Random sequence of each core. */
+static uint32 BarrierTest_Seed[OS_COREID_COUNT];
+
+/**********************************************************************************************************************
+ *  LOCAL FUNCTIONS
+ *********************************************************************************************************************/
+
+/*! Returns the current time in nanoseconds. */
+static uint64 BarrierTest_Now(void)
+{
+  struct timespec now;
+
+  (void)clock_gettime(CLOCK_MONOTONIC, &now);
+  return ((uint64)now.tv_sec * 1000000000uLL) + (uint64)now.tv_nsec;
+}
+
+
+/*! Runs the synchronization points of one run and checks each of them. */
+static void BarrierTest_Run(uint32 CoreId, uint32 Attendees)
+{
+  const Os_BarrierBaseConfigType* barrier = &BarrierTest_Attendees[BARRIERTEST_TESTED][CoreId];
+  uint32 round;
+  uint32 core;
+
+  for(round = 1u; round <= BARRIERTEST_ROUNDS; round++)
+  {
+    /* #10 With 4 attendees, the last core leaves the run half way, after the others have reached the point. */
+    if((Attendees == BARRIERTEST_CORES) && (CoreId == (BARRIERTEST_CORES - 1u)) &&
+       (round == (BARRIERTEST_ROUNDS / 2u)))
+    {
+      for(core = 0u; core < CoreId; core++)
+      {
+        while(BarrierTest_Reached[core] != round)
+        {
+          Os_Hal_CoreNop();
+        }
+      }
+
+      BarrierTest_Left[CoreId] = 1u;
+      Os_BarrierDetach(barrier);
+      return;
+    }
+
+    if((HostTest_Random(&BarrierTest_Seed[CoreId]) % 4u) == 0u)
+    {
+      Os_Hal_CoreNop();
+    }
+
+    BarrierTest_Reached[CoreId] = round;
+    Os_BarrierSynchronizeInternal(barrier);
+
+    /* #20 All attendees have reached the point and none has passed the next one. */
+    for(core = 0u; core < Attendees; core++)
+    {
+      uint32 reached = BarrierTest_Reached[core];
+
+      HOSTTEST_CHECK((BarrierTest_Left[core] != 0u) || (reached >= round));
+      HOSTTEST_CHECK(reached <= (round + 1u));
+    }
+  }
+
+  Os_BarrierDetach(barrier);
+}
+
+
+/*! Test function of all cores. */
+static void BarrierTest_Main(uint32 CoreId)
+{
+  const Os_BarrierBaseConfigType* outer = &BarrierTest_Attendees[BARRIERTEST_OUTER][CoreId];
+  uint32 attendees;
+
+  BarrierTest_Seed[CoreId] = 0x9E3779B9u + CoreId;
+
+  for(attendees = BARRIERTEST_MIN_ATTENDEES; attendees <= BARRIERTEST_CORES; attendees++)
+  {
+    uint64 start = 0u;
+
+    /* #10 Attach the attendees of this run, before any of them synchronizes. */
+    if(CoreId < attendees)
+    {
+      BarrierTest_Reached[CoreId] = 0u;
+      BarrierTest_Left[CoreId] = 0u;
+      Os_BarrierAttach(&BarrierTest_Attendees[BARRIERTEST_TESTED][CoreId]);
+    }
+    Os_BarrierSynchronizeInternal(outer);
+
+    /* #20 Run the synchronization points. */
+    if(CoreId < attendees)
+    {
+      start = BarrierTest_Now();
+      BarrierTest_Run(CoreId, attendees);
+    }
+    Os_BarrierSynchronizeInternal(outer);
+
+    /* #30 Report the mean round trip time. */
+    if(CoreId == 0u)
+    {
+      (void)printf("BarrierTest: %u attendees: %llu ns per synchronization point\n", (unsigned int)attendees,
+                   (unsigned long long)((BarrierTest_Now() - start) / BARRIERTEST_ROUNDS));
+    }
+  }
+
+  Os_BarrierDetach(outer);
+}
+
+/**********************************************************************************************************************
+ *  GLOBAL FUNCTIONS
+ *********************************************************************************************************************/
+
+int main(void)
+{
+  uint32 barrier;
+  uint32 core;
+
+  for(barrier = 0u; barrier < BARRIERTEST_BARRIERS; barrier++)
+  {
+    for(core = 0u; core < BARRIERTEST_CORES; core++)
+    {
+      Os_BarrierInit(&BarrierTest_Attendees[barrier][core]);
+    }
+  }
+
+  /* All cores are attached to the outer barrier, before the first of them synchronizes. */
+  for(core = 0u; core < BARRIERTEST_CORES; core++)
+  {
+    Os_BarrierAttach(&BarrierTest_Attendees[BARRIERTEST_OUTER][core]);
+  }
+
+  HostTest_RunCores(BARRIERTEST_CORES, BarrierTest_Main);
+  return 0;
+}
@@ -0,0 +1,318 @@
+/**********************************************************************************************************************
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file   CounterTest.c
+ *  \brief  Equivalence test of the counter job stores.
+ *  \details
+ *  Three software counters are driven by the same random sequence of relative job insertions, deletions, periodic
+ *  reloads and increments:
+ *  - a counter with a priority queue (the arity is selected by the build, see CMakeLists.txt),
+ *  - a counter with a two level timing wheel, so that most delays exceed the range of the wheel,
+ *  - a counter with a four level timing wheel.
+ *  A reference model tracks the expected expiration tick of each job. Each job has to expire exactly at that tick on
+ *  every counter. Bursts of jobs with the same expiration exceed the batch size of a single interrupt lock.
+ *********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include "HostTest.h"
+
+#include "Os_Counter.h"
+#include "Os_Timer.h"
+#include "Os_Job.h"
+#include "Os_Core_Lcfg.h"
+#include "Os_Application_Lcfg.h"
+
+/**********************************************************************************************************************
+ *  LOCAL CONSTANT MACROS
+ *********************************************************************************************************************/
+/*! Number of counters under test. */
+#define COUNTERTEST_COUNTERS          (3u)
+
+/*! Number of jobs per counter. */
+#define COUNTERTEST_JOBS              (48u)
+
+/*! Maximum allowed value of the counters. Small, so that the counters wrap often. */
+#define COUNTERTEST_MAXALLOWED        (0x3FFFuL)
+
+/*! Number of random operations. */
+#define COUNTERTEST_OPERATIONS        (50000uL)
+
+/*! Marks an inactive job in the reference model. */
+#define COUNTERTEST_INACTIVE          (0xFFFFFFFFFFFFFFFFuLL)
+
+/**********************************************************************************************************************
+ *  LOCAL DATA
+ *********************************************************************************************************************/
+
+/*! Runtime data of the counters. */
+static Os_TimerSwType CounterTest_TimerDyn[COUNTERTEST_COUNTERS];
+
+/*! Priority queue of counter 0. */
+static Os_PriorityQueueNodeType CounterTest_QueueNodes[COUNTERTEST_JOBS];
+static Os_PriorityQueueType CounterTest_QueueDyn;
+
+/*! Timing wheels of counter 1 and 2. */
+static Os_TimingWheelSlotType CounterTest_Wheel2Slots[2u * OS_TIMINGWHEEL_SLOTS_PER_LEVEL];
+static Os_TimingWheelSlotType CounterTest_Wheel4Slots[4u * OS_TIMINGWHEEL_SLOTS_PER_LEVEL];
+static Os_TimingWheelType CounterTest_WheelDyn[2];
+
+static const Os_TimingWheelConfigType CounterTest_Wheel2 =
+{
+  /* .Slots      = */ CounterTest_Wheel2Slots,
+  /* .Dyn        = */ &CounterTest_WheelDyn[0],
+  /* .LevelCount = */ 2u
+};
+
+static const Os_TimingWheelConfigType CounterTest_Wheel4 =
+{
+  /* .Slots      = */ CounterTest_Wheel4Slots,
+  /* .Dyn        = */ &CounterTest_WheelDyn[1],
+  /* .LevelCount = */ 4u
+};
+
+/*! Characteristics of all counters. */
+#define COUNTERTEST_CHARACTERISTICS                                                                                     \
+  {                                                                                                                     \
+    .MaxAllowedValue = COUNTERTEST_MAXALLOWED,                                                                          \
+    .MaxCountingValue = OS_TIMERSW_GETMAXCOUNTINGVALUE(COUNTERTEST_MAXALLOWED),                                         \
+    .MaxDifferentialValue = OS_TIMERSW_GETMAXDIFFERENTIALVALUE(COUNTERTEST_MAXALLOWED),                                 \
+    .MinCycle = 1u,                                                                                                     \
+    .TicksPerBase = 1u                                                                                                  \
+  }
+
+/*! The counters under test. */
+static const Os_TimerSwConfigType CounterTest_Counter[COUNTERTEST_COUNTERS] =
+{
+  {
+    .Counter =
+    {
+      .Characteristics = COUNTERTEST_CHARACTERISTICS,
+      .JobQueue = { CounterTest_QueueNodes, &CounterTest_QueueDyn, COUNTERTEST_JOBS },
+      .DriverType = OS_TIMERTYPE_SOFTWARE,
+      .Core = &OsCfg_Core_OsCore0,
+      .OwnerApplication = &OsCfg_App_HostApp_Core0,
+      .JobWheel = NULL_PTR
+    },
+    .Dyn = &CounterTest_TimerDyn[0]
+  },
+  {
+    .Counter =
+    {
+      .Characteristics = COUNTERTEST_CHARACTERISTICS,
+      .DriverType = OS_TIMERTYPE_SOFTWARE,
+      .Core = &OsCfg_Core_OsCore0,
+      .OwnerApplication = &OsCfg_App_HostApp_Core0,
+      .JobWheel = &CounterTest_Wheel2
+    },
+    .Dyn = &CounterTest_TimerDyn[1]
+  },
+  {
+    .Counter =
+    {
+      .Characteristics = COUNTERTEST_CHARACTERISTICS,
+      .DriverType = OS_TIMERTYPE_SOFTWARE,
+      .Core = &OsCfg_Core_OsCore0,
+      .OwnerApplication = &OsCfg_App_HostApp_Core0,
+      .JobWheel = &CounterTest_Wheel4
+    },
+    .Dyn = &CounterTest_TimerDyn[2]
+  }
+};
+
+/*! Jobs of all counters. */
+static Os_JobType CounterTest_JobDyn[COUNTERTEST_COUNTERS][COUNTERTEST_JOBS];
+static Os_TimingWheelJobType CounterTest_WheelJob[COUNTERTEST_COUNTERS][COUNTERTEST_JOBS];
+static Os_JobConfigType CounterTest_Job[COUNTERTEST_COUNTERS][COUNTERTEST_JOBS];
+
+/*! Reference model: expected expiration tick of each job, COUNTERTEST_INACTIVE if not queued. */
+static uint64 CounterTest_Expected[COUNTERTEST_COUNTERS][COUNTERTEST_JOBS];
+
+/*! Reference model: reload period of each job, 0 for single shot jobs. */
+static Os_TickType CounterTest_Period[COUNTERTEST_JOBS];
+
+/*! Number of increments since the start. */
+static uint64 CounterTest_Tick;
+
+/*! Number of expirations per counter. */
+static uint32 CounterTest_Expirations[COUNTERTEST_COUNTERS];
+
+/**********************************************************************************************************************
+ *  LOCAL FUNCTIONS
+ *********************************************************************************************************************/
+
+/*! Job callback: checks the expiration tick against the reference model and reloads periodic jobs. */
+static void CounterTest_Callback(const Os_JobConfigType* Job)
+{
+  uint32 counter = (uint32)((const Os_TimerSwConfigType*)(const void*)Job->Counter - CounterTest_Counter);
+  uint32 job = (uint32)(Job - CounterTest_Job[counter]);
+
+  HOSTTEST_CHECK(counter < COUNTERTEST_COUNTERS);
+  HOSTTEST_CHECK(job < COUNTERTEST_JOBS);
+  HOSTTEST_CHECK(CounterTest_Expected[counter][job] == CounterTest_Tick);
+
+  CounterTest_Expirations[counter]++;
+
+  if(CounterTest_Period[job] != 0u)
+  {
+    CounterTest_Expected[counter][job] = CounterTest_Tick + CounterTest_Period[job];
+    Os_CounterReloadJob(Job->Counter, Job, CounterTest_Period[job]);
+  }
+  else
+  {
+    CounterTest_Expected[counter][job] = COUNTERTEST_INACTIVE;
+  }
+}
+
+/*! Returns a random delay, which is short in most cases. */
+static Os_TickType CounterTest_RandomDelay(uint32* Seed)
+{
+  uint32 kind = HostTest_Random(Seed) % 4u;
+  Os_TickType limit = (kind == 0u) ? 8u : ((kind == 1u) ? 256u : ((kind == 2u) ? 2048u : COUNTERTEST_MAXALLOWED));
+
+  return (Os_TickType)(1u + (HostTest_Random(Seed) % limit));
+}
+
+/*! Inserts the job into all counters with the same delay. */
+static void CounterTest_Add(uint32 Job, Os_TickType Delay)
+{
+  uint32 counter;
+
+  for(counter = 0u; counter < COUNTERTEST_COUNTERS; counter++)
+  {
+    CounterTest_Expected[counter][Job] = CounterTest_Tick + Delay;
+    Os_CounterAddRelJob(&CounterTest_Counter[counter].Counter, &CounterTest_Job[counter][Job], Delay);
+  }
+}
+
+/*! Deletes the job from all counters. */
+static void CounterTest_Delete(uint32 Job)
+{
+  uint32 counter;
+
+  for(counter = 0u; counter < COUNTERTEST_COUNTERS; counter++)
+  {
+    CounterTest_Expected[counter][Job] = COUNTERTEST_INACTIVE;
+    Os_CounterDeleteJob(&CounterTest_Counter[counter].Counter, &CounterTest_Job[counter][Job]);
+  }
+}
+
+/*! Increments all counters the given number of times and checks that no job has been missed. */
+static void CounterTest_Advance(uint32 Ticks)
+{
+  uint32 tick;
+  uint32 counter;
+  uint32 job;
+
+  for(tick = 0u; tick < Ticks; tick++)
+  {
+    CounterTest_Tick++;
+
+    for(counter = 0u; counter < COUNTERTEST_COUNTERS; counter++)
+    {
+      HOSTTEST_CHECK(Os_CounterIncrementInternal(&CounterTest_Counter[counter].Counter) == OS_STATUS_OK);
+    }
+  }
+
+  for(counter = 0u; counter < COUNTERTEST_COUNTERS; counter++)
+  {
+    for(job = 0u; job < COUNTERTEST_JOBS; job++)
+    {
+      HOSTTEST_CHECK(CounterTest_Expected[counter][job] > CounterTest_Tick);
+    }
+  }
+}
+
+/*! Test function of core 0. */
+static void CounterTest_Main(uint32 CoreId)
+{
+  uint32 seed = 0x2545F491u;
+  uint32 operation;
+  uint32 counter;
+  uint32 job;
+
+  HOSTTEST_CHECK(CoreId == 0u);
+
+  /* #10 Initialize the counters and jobs. */
+  for(counter = 0u; counter < COUNTERTEST_COUNTERS; counter++)
+  {
+    for(job = 0u; job < COUNTERTEST_JOBS; job++)
+    {
+      CounterTest_Job[counter][job].Dyn = &CounterTest_JobDyn[counter][job];
+      CounterTest_Job[counter][job].Counter = &CounterTest_Counter[counter].Counter;
+      CounterTest_Job[counter][job].Callback = CounterTest_Callback;
+      CounterTest_Job[counter][job].WheelJob =
+        (CounterTest_Counter[counter].Counter.JobWheel != NULL_PTR) ? &CounterTest_WheelJob[counter][job] : NULL_PTR;
+      CounterTest_Expected[counter][job] = COUNTERTEST_INACTIVE;
+    }
+
+    Os_CounterInit(&CounterTest_Counter[counter].Counter);
+    Os_CounterStart(&CounterTest_Counter[counter].Counter);
+  }
+
+  /* #20 Apply random operations to all counters. */
+  for(operation = 0u; operation < COUNTERTEST_OPERATIONS; operation++)
+  {
+    uint32 kind = HostTest_Random(&seed) % 64u;
+
+    job = HostTest_Random(&seed) % COUNTERTEST_JOBS;
+
+    if(kind < 20u)
+    {
+      /* Insert a single shot or periodic job. */
+      if(CounterTest_Expected[0][job] == COUNTERTEST_INACTIVE)
+      {
+        CounterTest_Period[job] = ((HostTest_Random(&seed) % 3u) == 0u) ? CounterTest_RandomDelay(&seed) : 0u;
+        CounterTest_Add(job, CounterTest_RandomDelay(&seed));
+      }
+    }
+    else if(kind < 28u)
+    {
+      /* Delete a job. */
+      if(CounterTest_Expected[0][job] != COUNTERTEST_INACTIVE)
+      {
+        CounterTest_Delete(job);
+      }
+    }
+    else if(kind < 32u)
+    {
+      /* Burst: all inactive jobs expire at the same tick. */
+      Os_TickType delay = CounterTest_RandomDelay(&seed);
+
+      for(job = 0u; job < COUNTERTEST_JOBS; job++)
+      {
+        if(CounterTest_Expected[0][job] == COUNTERTEST_INACTIVE)
+        {
+          CounterTest_Period[job] = 0u;
+          CounterTest_Add(job, delay);
+        }
+      }
+    }
+    else if(kind < 63u)
+    {
+      /* Advance a few ticks. */
+      CounterTest_Advance(1u + (HostTest_Random(&seed) % 64u));
+    }
+    else
+    {
+      /* Advance far, so that the counters wrap around. */
+      CounterTest_Advance(HostTest_Random(&seed) % (2u * COUNTERTEST_MAXALLOWED));
+    }
+  }
+
+  /* #30 All counters have expired the same number of jobs. */
+  HOSTTEST_CHECK(CounterTest_Expirations[0] > 0u);
+  HOSTTEST_CHECK(CounterTest_Expirations[0] == CounterTest_Expirations[1]);
+  HOSTTEST_CHECK(CounterTest_Expirations[0] == CounterTest_Expirations[2]);
+}
+
+/**********************************************************************************************************************
+ *  GLOBAL FUNCTIONS
+ *********************************************************************************************************************/
+
+int main(void)
+{
+  HostTest_RunCores(1u, CounterTest_Main);
+  return 0;
+}
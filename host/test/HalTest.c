@@ -0,0 +1,262 @@
+/**********************************************************************************************************************
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file   HalTest.c
+ *  \brief  Smoke test of the POSIX host HAL.
+ *  \details
+ *  - Core 0 and 1: core identification, cross core interrupt routing, masking by level and notification of an
+ *    idle core.
+ *  - Core 2: timer compare interrupt.
+ *  - Core 3: context switches between two threads.
+ *********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include "HostTest.h"
+
+#include "Os_Core.h"
+#include "Os_Hal_Core.h"
+#include "Os_Hal_Interrupt.h"
+#include "Os_Hal_Context.h"
+#include "Os_Hal_Timer.h"
+
+/**********************************************************************************************************************
+ *  LOCAL CONSTANT MACROS
+ *********************************************************************************************************************/
+/*! Number of context switches of the context test. */
+#define HALTEST_SWITCHES          (1000uL)
+
+/*! Stack size of the second thread of the context test. */
+#define HALTEST_STACK_SIZE        (64uL * 1024uL)
+
+/*! Timer delay in ticks (1 ms). */
+#define HALTEST_TIMER_DELAY       (OS_HAL_TIMER_POSIX_FREQUENCY / 1000uL)
+
+/**********************************************************************************************************************
+ *  LOCAL DATA
+ *********************************************************************************************************************/
+
+/*! Interrupt source of core 1, level 10. */
+static const Os_Hal_IntIsrConfigType HalTest_Isr =
+{
+  /* .Level          = */ 10u,
+  /* .Source         = */ 8u * OS_HAL_INT_SRC_SIZE,
+  /* .CoreAssignment = */ 1u
+};
+
+/*! Interrupt source of the timer of core 2, level 5. */
+static const Os_Hal_IntIsrConfigType HalTest_TimerIsr =
+{
+  /* .Level          = */ 5u,
+  /* .Source         = */ 9u * OS_HAL_INT_SRC_SIZE,
+  /* .CoreAssignment = */ 2u
+};
+
+/*! Number of handled interrupts of HalTest_Isr. */
+static volatile uint32 HalTest_IsrCount;
+
+/*! Number of handled timer interrupts. */
+static volatile uint32 HalTest_TimerCount;
+
+/*! Handshake between core 0 and core 1. */
+static volatile uint32 HalTest_Step;
+
+/*! Threads of the context test. */
+static Os_Hal_ContextType HalTest_MainContext;
+static Os_Hal_ContextType HalTest_PeerContext;
+
+/*! Number of runs of the second thread. */
+static uint32 HalTest_PeerRuns;
+
+/*! Stack of the second thread. */
+static uint64 HalTest_PeerStack[HALTEST_STACK_SIZE / sizeof(uint64)];
+
+/**********************************************************************************************************************
+ *  LOCAL FUNCTIONS
+ *********************************************************************************************************************/
+
+/*! Waits until HalTest_Step has reached the given value. */
+static void HalTest_WaitStep(uint32 Step)
+{
+  while(__atomic_load_n(&HalTest_Step, __ATOMIC_SEQ_CST) < Step)
+  {
+    Os_Hal_CoreNop();
+  }
+}
+
+/*! Sets HalTest_Step. */
+static void HalTest_SetStep(uint32 Step)
+{
+  __atomic_store_n(&HalTest_Step, Step, __ATOMIC_SEQ_CST);
+}
+
+/*! Handler of HalTest_Isr. */
+static void HalTest_IsrHandler(void)
+{
+  Os_Hal_IntLevelType level;
+
+  Os_Hal_IntGetLevel(&level);
+  HOSTTEST_CHECK(Os_Hal_CoreGetId() == 1u);
+  HOSTTEST_CHECK(level == HalTest_Isr.Level);
+  HOSTTEST_CHECK((Os_Hal_PosixCoreGetSelf()->Icr & OS_HAL_ICR_INT_MASK) == 0u);
+
+  HalTest_IsrCount++;
+}
+
+/*! Handler of HalTest_TimerIsr. */
+static void HalTest_TimerHandler(void)
+{
+  HOSTTEST_CHECK(Os_Hal_CoreGetId() == 2u);
+  HalTest_TimerCount++;
+}
+
+/*! Entry function of the second thread of the context test. */
+static void HalTest_PeerEntry(const void* Parameter)
+{
+  HOSTTEST_CHECK(Parameter == &HalTest_PeerRuns);
+
+  for(;;)
+  {
+    HalTest_PeerRuns++;
+    Os_Hal_ContextSwitch(&HalTest_PeerContext, &HalTest_MainContext);
+  }
+}
+
+/*! Return address of the second thread, which must not be reached. */
+static void HalTest_PeerReturn(void)
+{
+  HOSTTEST_CHECK(0u);
+}
+
+/*! Interrupt sender. */
+static void HalTest_Core0(void)
+{
+  /* #10 Route the source to level 10 of core 1. */
+  Os_Hal_IntInterruptSourceInit(&HalTest_Isr);
+  Os_Hal_IntEnableSource(&HalTest_Isr);
+  HalTest_SetStep(1u);
+
+  /* #20 Raise the source, while core 1 masks the level. */
+  HalTest_WaitStep(2u);
+  Os_Hal_PosixSrcModify(HalTest_Isr.Source, 0uL, OS_HAL_INT_SRC_SETR_MASK);
+  HalTest_SetStep(3u);
+
+  /* #30 Raise the source, while core 1 is idle. */
+  HalTest_WaitStep(4u);
+  Os_Hal_PosixSrcModify(HalTest_Isr.Source, 0uL, OS_HAL_INT_SRC_SETR_MASK);
+}
+
+/*! Interrupt receiver. */
+static void HalTest_Core1(void)
+{
+  Os_Hal_IntLevelType masked = 20u;
+  Os_Hal_IntLevelType unmasked = 0u;
+  uint32 index;
+
+  Os_Hal_PosixIntRegisterVector(1u, HalTest_Isr.Level, HalTest_IsrHandler);
+  HalTest_WaitStep(1u);
+
+  /* #10 A pending level below the current level is not accepted. */
+  Os_Hal_IntSetLevel(&masked);
+  Os_Hal_PosixIntEnable();
+  HalTest_SetStep(2u);
+  HalTest_WaitStep(3u);
+  for(index = 0; index < 1000u; index++)
+  {
+    Os_Hal_CoreNop();
+  }
+  HOSTTEST_CHECK(HalTest_IsrCount == 0u);
+  HOSTTEST_CHECK(Os_Hal_IntIsInterruptPending(&HalTest_Isr) != 0u);
+
+  /* #20 Lowering the level handles the pending interrupt immediately. */
+  Os_Hal_IntSetLevel(&unmasked);
+  HOSTTEST_CHECK(HalTest_IsrCount == 1u);
+  HOSTTEST_CHECK(Os_Hal_IntIsInterruptPending(&HalTest_Isr) == 0u);
+
+  /* #30 An idle core is woken up by an interrupt of another core. */
+  HalTest_SetStep(4u);
+  while(HalTest_IsrCount < 2u)
+  {
+    Os_Hal_PosixCoreIdle();
+  }
+  HOSTTEST_CHECK(HalTest_IsrCount == 2u);
+
+  Os_Hal_PosixIntDisable();
+}
+
+/*! Timer interrupt. */
+static void HalTest_Core2(void)
+{
+  Os_Hal_TimerFrtTickType start;
+
+  Os_Hal_PosixIntRegisterVector(2u, HalTest_TimerIsr.Level, HalTest_TimerHandler);
+  Os_Hal_IntInterruptSourceInit(&HalTest_TimerIsr);
+  Os_Hal_IntEnableSource(&HalTest_TimerIsr);
+  Os_Hal_PosixIntEnable();
+
+  /* #10 The interrupt is raised, when the compare value has been reached. */
+  start = Os_Hal_PosixTimerGetCounter();
+  Os_Hal_PosixTimerSetCompare(0u, HalTest_TimerIsr.Source, start + HALTEST_TIMER_DELAY);
+  while(HalTest_TimerCount == 0u)
+  {
+    Os_Hal_PosixCoreIdle();
+  }
+
+  HOSTTEST_CHECK((Os_Hal_TimerFrtTickType)(Os_Hal_PosixTimerGetCounter() - start) >= HALTEST_TIMER_DELAY);
+  HOSTTEST_CHECK(HalTest_TimerCount == 1u);
+
+  Os_Hal_PosixIntDisable();
+}
+
+/*! Context switches. */
+static void HalTest_Core3(void)
+{
+  Os_Hal_ContextConfigType config =
+  {
+    .StackEndAddr = (Os_Hal_AddressType)&HalTest_PeerStack[HALTEST_STACK_SIZE / sizeof(uint64)],
+    .StackStartAddr = (Os_Hal_AddressType)&HalTest_PeerStack[0],
+    .Entry = (Os_Hal_AddressType)&HalTest_PeerEntry,
+    .ReturnAddress = (Os_Hal_AddressType)&HalTest_PeerReturn,
+    .IntStatus = 0u
+  };
+  uint32 index;
+
+  /* #10 Each switch runs the second thread once, on its own stack. */
+  Os_Hal_ContextInit(&config, &HalTest_PeerContext);
+  Os_Hal_ContextSetParameter(&HalTest_PeerContext, &HalTest_PeerRuns);
+  for(index = 1; index <= HALTEST_SWITCHES; index++)
+  {
+    Os_Hal_ContextSwitch(&HalTest_MainContext, &HalTest_PeerContext);
+    HOSTTEST_CHECK(HalTest_PeerRuns == index);
+    HOSTTEST_CHECK(Os_Hal_CoreGetId() == 3u);
+  }
+}
+
+/*! Test function of all cores. */
+static void HalTest_Main(uint32 CoreId)
+{
+  /* #10 Each core knows its ID and its current thread. */
+  HOSTTEST_CHECK(Os_Hal_CoreGetId() == CoreId);
+  HOSTTEST_CHECK(Os_CoreGetThread() == &OsCfg_TaskRefs[CoreId]->Thread);
+
+  switch(CoreId)
+  {
+    case 0u: HalTest_Core0(); break;
+    case 1u: HalTest_Core1(); break;
+    case 2u: HalTest_Core2(); break;
+    default: HalTest_Core3(); break;
+  }
+
+  HOSTTEST_CHECK(Os_CoreGetThread() == &OsCfg_TaskRefs[CoreId]->Thread);
+}
+
+/**********************************************************************************************************************
+ *  GLOBAL FUNCTIONS
+ *********************************************************************************************************************/
+
+int main(void)
+{
+  HostTest_RunCores(4u, HalTest_Main);
+  return 0;
+}
@@ -0,0 +1,140 @@
+/**********************************************************************************************************************
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file   HostTest.c
+ *  \brief  Test harness of the POSIX host build.
+ *********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include "HostTest.h"
+
+#include "Os.h"
+#include "Os_Application.h"
+#include "Os_Core.h"
+#include "Os_Thread.h"
+#include "Os_Task.h"
+#include "Os_Hal_Core.h"
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/**********************************************************************************************************************
+ *  LOCAL DATA
+ *********************************************************************************************************************/
+
+/*! Test function of the running test. */
+static HostTest_CoreMainType HostTest_Main;
+
+/*! Number of cores, which have not yet returned from the test function. */
+static uint32 HostTest_Running;
+
+/*! Protects HostTest_Running. */
+static pthread_mutex_t HostTest_Lock = PTHREAD_MUTEX_INITIALIZER;
+
+/*! Signals that HostTest_Running became 0. */
+static pthread_cond_t HostTest_Done = PTHREAD_COND_INITIALIZER;
+
+/**********************************************************************************************************************
+ *  GLOBAL FUNCTIONS
+ *********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *  HostTest_CoreStartLabel()
+ **********************************************************************************************************************/
+void HostTest_CoreStartLabel(void)
+{
+  Os_CorePhysicalIdType coreId = Os_Hal_CoreGetId();
+  P2CONST(Os_CoreAsrConfigType, AUTOMATIC, OS_CONST) core;
+  P2CONST(Os_ThreadConfigType, AUTOMATIC, OS_CONST) thread;
+
+  core = (P2CONST(Os_CoreAsrConfigType, AUTOMATIC, OS_CONST))OsCfg_CoreRefs[coreId];
+  thread = &OsCfg_TaskRefs[coreId]->Thread;
+
+  /* #10 Initialize the core, make its application accessible and make its task the current thread. */
+  Os_Hal_CoreInit(core->HwConfig);
+  core->KernelApp->Dyn->State = APPLICATION_ACCESSIBLE;
+  Os_ThreadInit(thread);
+  Os_CoreSetThread(thread);
+
+  /* #20 Run the test function. */
+  HostTest_Main((uint32)coreId);
+
+  /* #30 Report the end of the test function. */
+  (void)pthread_mutex_lock(&HostTest_Lock);
+  HostTest_Running--;
+  if(HostTest_Running == 0u)
+  {
+    (void)pthread_cond_signal(&HostTest_Done);
+  }
+  (void)pthread_mutex_unlock(&HostTest_Lock);
+}
+
+
+/***********************************************************************************************************************
+ *  HostTest_RunCores()
+ **********************************************************************************************************************/
+void HostTest_RunCores(uint32 CoreCount, HostTest_CoreMainType Main)
+{
+  uint32 core;
+
+  HOSTTEST_CHECK((CoreCount > 0u) && (CoreCount <= (uint32)OS_COREID_COUNT));
+
+  HostTest_Main = Main;
+  HostTest_Running = CoreCount;
+
+  /* #10 Start the cores. */
+  for(core = 0; core < CoreCount; core++)
+  {
+    Os_Hal_CoreStart(OsCfg_CoreRefs[core]->HwConfig);
+  }
+
+  /* #20 Wait for all cores. */
+  (void)pthread_mutex_lock(&HostTest_Lock);
+  while(HostTest_Running != 0u)
+  {
+    (void)pthread_cond_wait(&HostTest_Done, &HostTest_Lock);
+  }
+  (void)pthread_mutex_unlock(&HostTest_Lock);
+}
+
+
+/***********************************************************************************************************************
+ *  HostTest_Check()
+ **********************************************************************************************************************/
+void HostTest_Check(uint32 Ok, const char* Condition, const char* File, int Line)
+{
+  if(Ok == 0u)
+  {
+    (void)fprintf(stderr, "%s:%d: check failed: %s\n", File, Line, Condition);
+    exit(EXIT_FAILURE);
+  }
+}
+
+
+/***********************************************************************************************************************
+ *  HostTest_Random()
+ **********************************************************************************************************************/
+uint32 HostTest_Random(P2VAR(uint32, AUTOMATIC, AUTOMATIC) State)
+{
+  uint32 x = *State;
+
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  *State = x;
+
+  return x;
+}
+
+
+/***********************************************************************************************************************
+ *  Os_PanicHook()
+ **********************************************************************************************************************/
+/*! A kernel panic (e.g. a failed kernel assertion) fails the test. The kernel freezes the core afterwards. */
+FUNC(void, OS_PANICHOOK_CODE) Os_PanicHook(void)
+{
+  (void)fprintf(stderr, "kernel panic on core %u\n", (unsigned int)Os_Hal_CoreGetId());
+}
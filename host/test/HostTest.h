@@ -0,0 +1,79 @@
+/**********************************************************************************************************************
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file   HostTest.h
+ *  \brief  Test harness of the POSIX host build.
+ *  \details
+ *  A test runs test functions on emulated cores. Each core is started by Os_Hal_CoreStart() and executes its test
+ *  function as the task of the core's application (see host/cfg/Os_Lcfg.c). The interrupts of a core are disabled,
+ *  when the test function is entered.
+ *********************************************************************************************************************/
+
+#ifndef HOSTTEST_H
+# define HOSTTEST_H
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+# include "Std_Types.h"
+# include "Os_Lcfg.h"
+
+/**********************************************************************************************************************
+ *  GLOBAL FUNCTION MACROS
+ *********************************************************************************************************************/
+
+/*! Checks a test condition. A failed condition terminates the test with a non-zero exit code. */
+# define HOSTTEST_CHECK(Condition)                                                                                      \
+         HostTest_Check((uint32)((Condition) ? 1u : 0u), #Condition, __FILE__, __LINE__)
+
+/**********************************************************************************************************************
+ *  GLOBAL DATA TYPES AND STRUCTURES
+ *********************************************************************************************************************/
+
+/*! Test function of a core. */
+typedef P2FUNC(void, OS_CODE, HostTest_CoreMainType)(uint32 CoreId);
+
+/**********************************************************************************************************************
+ *  GLOBAL FUNCTION PROTOTYPES
+ *********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *  HostTest_RunCores()
+ **********************************************************************************************************************/
+/*! \brief        Starts the cores 0 to CoreCount - 1 with the given test function and waits until all of them have
+ *                returned from it.
+ *  \param[in]    CoreCount   Number of cores. Must not exceed OS_COREID_COUNT.
+ *  \param[in]    Main        Test function, which is called on each core.
+ *  \context      Host main thread
+ **********************************************************************************************************************/
+void HostTest_RunCores(uint32 CoreCount, HostTest_CoreMainType Main);
+
+
+/***********************************************************************************************************************
+ *  HostTest_Check()
+ **********************************************************************************************************************/
+/*! \brief        Reports a failed test condition and terminates the test. Use HOSTTEST_CHECK().
+ *  \context      ANY
+ **********************************************************************************************************************/
+void HostTest_Check(uint32 Ok, const char* Condition, const char* File, int Line);
+
+
+/***********************************************************************************************************************
+ *  HostTest_Random()
+ **********************************************************************************************************************/
+/*! \brief        Returns the next value of a xorshift pseudo random sequence.
+ *  \param[in,out] State  The state of the sequence. Must not be 0.
+ *  \context      ANY
+ **********************************************************************************************************************/
+uint32 HostTest_Random(P2VAR(uint32, AUTOMATIC, AUTOMATIC) State);
+
+
+/***********************************************************************************************************************
+ *  HostTest_CoreStartLabel()
+ **********************************************************************************************************************/
+/*! \brief        Start label of all cores, referenced by the core configuration.
+ *  \context      Core start
+ **********************************************************************************************************************/
+void HostTest_CoreStartLabel(void);
+
+#endif /* HOSTTEST_H */
@@ -0,0 +1,231 @@
+/**********************************************************************************************************************
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file   IocSequenceTest.c
+ *  \brief  Torture test of single buffered IOCs with sequence counter.
+ *  \details
+ *  Core 0 writes an ascending version number into all words of the buffer. The cores 1 to 3 read the buffer
+ *  concurrently, each with its own snapshot buffer. The copy functions yield at random words, so that writes and
+ *  reads interleave. Each successful read has to return a buffer, whose words carry the same version, and the
+ *  versions seen by a reader must not decrease. A failed read must not change the caller's data.
+ *********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include "HostTest.h"
+
+#include "Os_Ioc.h"
+#include "Os_Hal_Core.h"
+
+/**********************************************************************************************************************
+ *  LOCAL CONSTANT MACROS
+ *********************************************************************************************************************/
+/*! Number of words of the buffer. */
+#define IOCSEQUENCETEST_WORDS         (16u)
+
+/*! Number of readers. */
+#define IOCSEQUENCETEST_READERS       (3u)
+
+/*! Number of writes. */
+#define IOCSEQUENCETEST_WRITES        (20000uL)
+
+/*! Marks the data of the caller before a read. */
+#define IOCSEQUENCETEST_UNTOUCHED     (0xA5A5A5A5uL)
+
+/**********************************************************************************************************************
+ *  LOCAL DATA TYPES AND STRUCTURES
+ *********************************************************************************************************************/
+/*! The transferred data. Each word carries the version of the write. */
+typedef struct
+{
+  uint32 Words[IOCSEQUENCETEST_WORDS];
+} IocSequenceTest_DataType;
+
+/**********************************************************************************************************************
+ *  LOCAL FUNCTION PROTOTYPES
+ *********************************************************************************************************************/
+static void IocSequenceTest_Copy(const void* Source, void* Target);
+
+/**********************************************************************************************************************
+ *  LOCAL DATA
+ *********************************************************************************************************************/
+/*! The IOC buffer, its sequence counter and the snapshot buffers of the readers. */
+static IocSequenceTest_DataType IocSequenceTest_Buffer;
+static volatile Os_IocSequenceType IocSequenceTest_Sequence;
+static IocSequenceTest_DataType IocSequenceTest_Snapshot[IOCSEQUENCETEST_READERS];
+
+/*! Random sequence of each core, which decides where a copy yields. */
+static uint32 IocSequenceTest_Seed[OS_COREID_COUNT];
+
+/*! Runtime data of the writer and the readers. */
+static Os_IocWriteType IocSequenceTest_WriteDyn;
+static Os_IocReadType IocSequenceTest_ReadDyn[IOCSEQUENCETEST_READERS];
+
+/*! The writer on core 0. */
+static const Os_IocWriteConfigType IocSequenceTest_Write =
+{
+  .Ioc =
+  {
+    .Spinlock = NULL_PTR,
+    .LockMode = OS_IOCLOCKMODE_INTERRUPTS,
+    .Dyn = &IocSequenceTest_WriteDyn.Ioc,
+    .SubClass = IocWrite,
+    .AccessingApplications = (Os_AppAccessMaskType)(1uL << HostApp_Core0)
+  },
+  .Data = &IocSequenceTest_Buffer,
+  .Callbacks = { NULL_PTR, 0u },
+  .CopyCbk = IocSequenceTest_Copy,
+  .InitCbk = NULL_PTR,
+  .Sequence = &IocSequenceTest_Sequence
+};
+
+/*! The reader of the cores 1 to 3. */
+#define IOCSEQUENCETEST_READER(Reader)                                                                                  \
+  {                                                                                                                     \
+    .Ioc =                                                                                                              \
+    {                                                                                                                   \
+      .Spinlock = NULL_PTR,                                                                                             \
+      .LockMode = OS_IOCLOCKMODE_INTERRUPTS,                                                                            \
+      .Dyn = &IocSequenceTest_ReadDyn[(Reader)].Ioc,                                                                    \
+      .SubClass = IocRead,                                                                                              \
+      .AccessingApplications = (Os_AppAccessMaskType)(1uL << ((Reader) + 1u))                                          \
+    },                                                                                                                  \
+    .Data = &IocSequenceTest_Buffer,                                                                                    \
+    .CopyCbk = IocSequenceTest_Copy,                                                                                    \
+    .Sequence = &IocSequenceTest_Sequence,                                                                              \
+    .Snapshot = &IocSequenceTest_Snapshot[(Reader)]                                                                     \
+  }
+
+static const Os_IocReadConfigType IocSequenceTest_Read[IOCSEQUENCETEST_READERS] =
+{
+  IOCSEQUENCETEST_READER(0u),
+  IOCSEQUENCETEST_READER(1u),
+  IOCSEQUENCETEST_READER(2u)
+};
+
+/**********************************************************************************************************************
+ *  LOCAL FUNCTIONS
+ *********************************************************************************************************************/
+
+/*! Copies the buffer word by word and yields at random words, so that copies interleave. */
+static void IocSequenceTest_Copy(const void* Source, void* Target)
+{
+  const volatile uint32* source = ((const IocSequenceTest_DataType*)Source)->Words;
+  volatile uint32* target = ((IocSequenceTest_DataType*)Target)->Words;
+  uint32 word;
+
+  for(word = 0u; word < IOCSEQUENCETEST_WORDS; word++)
+  {
+    target[word] = source[word];
+
+    if((HostTest_Random(&IocSequenceTest_Seed[Os_Hal_CoreGetId()]) % IOCSEQUENCETEST_WORDS) == 0u)
+    {
+      Os_Hal_CoreNop();
+    }
+  }
+}
+
+
+/*! Writes all versions. */
+static void IocSequenceTest_Writer(void)
+{
+  IocSequenceTest_DataType data;
+  uint32 version;
+  uint32 word;
+
+  for(version = 1u; version <= IOCSEQUENCETEST_WRITES; version++)
+  {
+    for(word = 0u; word < IOCSEQUENCETEST_WORDS; word++)
+    {
+      data.Words[word] = version;
+    }
+
+    HOSTTEST_CHECK(Os_IocWrite(&IocSequenceTest_Write, &data) == IOC_E_OK);
+    Os_Hal_CoreNop();
+  }
+}
+
+
+/*! Reads until the last version has been seen and checks each read. */
+static void IocSequenceTest_Reader(uint32 Reader)
+{
+  IocSequenceTest_DataType data;
+  uint32 last = 0u;
+  uint32 succeeded = 0u;
+  uint32 word;
+
+  while(last < IOCSEQUENCETEST_WRITES)
+  {
+    Std_ReturnType status;
+
+    for(word = 0u; word < IOCSEQUENCETEST_WORDS; word++)
+    {
+      data.Words[word] = IOCSEQUENCETEST_UNTOUCHED;
+    }
+
+    status = Os_IocRead(&IocSequenceTest_Read[Reader], &data);
+
+    if(status == IOC_E_OK)
+    {
+      /* A successful read returns a single version, which is not older than the previous one. */
+      for(word = 0u; word < IOCSEQUENCETEST_WORDS; word++)
+      {
+        HOSTTEST_CHECK(data.Words[word] == data.Words[0]);
+      }
+      HOSTTEST_CHECK(data.Words[0] >= last);
+
+      last = data.Words[0];
+      succeeded++;
+    }
+    else
+    {
+      /* A failed read leaves the caller's data untouched. */
+      HOSTTEST_CHECK(status == IOC_E_NOK);
+
+      for(word = 0u; word < IOCSEQUENCETEST_WORDS; word++)
+      {
+        HOSTTEST_CHECK(data.Words[word] == IOCSEQUENCETEST_UNTOUCHED);
+      }
+    }
+
+    Os_Hal_CoreNop();
+  }
+
+  HOSTTEST_CHECK(succeeded > 0u);
+}
+
+
+/*! Test function of all cores. */
+static void IocSequenceTest_Main(uint32 CoreId)
+{
+  IocSequenceTest_Seed[CoreId] = 0x9E3779B9u + CoreId;
+
+  if(CoreId == 0u)
+  {
+    IocSequenceTest_Writer();
+  }
+  else
+  {
+    IocSequenceTest_Reader(CoreId - 1u);
+  }
+}
+
+/**********************************************************************************************************************
+ *  GLOBAL FUNCTIONS
+ *********************************************************************************************************************/
+
+int main(void)
+{
+  uint32 reader;
+
+  Os_IocInit(&IocSequenceTest_Write.Ioc);
+
+  for(reader = 0u; reader < IOCSEQUENCETEST_READERS; reader++)
+  {
+    Os_IocInit(&IocSequenceTest_Read[reader].Ioc);
+  }
+
+  HostTest_RunCores(1u + IOCSEQUENCETEST_READERS, IocSequenceTest_Main);
+  return 0;
+}
@@ -0,0 +1,314 @@
+/**********************************************************************************************************************
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file   IocTest.c
+ *  \brief  Test of queued IOC channels, Os_Ioc32SendN() and Os_Ioc32ReceiveN().
+ *  \details
+ *  - Core 0 feeds a lock-free (OS_IOCLOCKMODE_LOCKFREE) channel, core 1 drains it. Both sides mix single and multi
+ *    element calls of random size. The receiver checks that the sequence arrives complete and in order.
+ *  - Core 2 checks the results of Os_Ioc32SendN() and Os_Ioc32ReceiveN() on a full, an empty and a foreign channel.
+ *********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include "HostTest.h"
+
+#include "Os_Ioc.h"
+#include "Os_Hal_Core.h"
+
+/**********************************************************************************************************************
+ *  LOCAL CONSTANT MACROS
+ *********************************************************************************************************************/
+/*! Channels under test. */
+#define IOCTEST_CHANNEL_SPSC          (0u)
+#define IOCTEST_CHANNEL_LOCAL         (1u)
+#define IOCTEST_CHANNELS              (2u)
+
+/*! FIFO size of the channels. A FIFO holds one element less. */
+#define IOCTEST_FIFO_SIZE             (8u)
+
+/*! Number of elements sent over the lock-free channel. */
+#define IOCTEST_ELEMENTS              (200000uL)
+
+/*! Maximum number of elements per multi element call. */
+#define IOCTEST_BATCH                 (12u)
+
+/**********************************************************************************************************************
+ *  LOCAL DATA
+ *********************************************************************************************************************/
+/*! Runtime data of the channels. */
+static Os_Ioc32SendType IocTest_SendDyn[IOCTEST_CHANNELS];
+static Os_Ioc32ReceiveType IocTest_ReceiveDyn[IOCTEST_CHANNELS];
+static Os_Fifo32NodeType IocTest_Fifo[IOCTEST_CHANNELS][IOCTEST_FIFO_SIZE];
+
+static const Os_Ioc32ReceiveConfigType IocTest_Receive[IOCTEST_CHANNELS];
+
+/*! Sender of the channels. */
+static const Os_Ioc32SendConfigType IocTest_Send[IOCTEST_CHANNELS] =
+{
+  {
+    .Ioc =
+    {
+      .Base =
+      {
+        .Spinlock = NULL_PTR,
+        .LockMode = OS_IOCLOCKMODE_LOCKFREE,
+        .Dyn = &IocTest_SendDyn[0].Ioc.Base,
+        .SubClass = Ioc32Send,
+        .AccessingApplications = (Os_AppAccessMaskType)(1uL << HostApp_Core0)
+      },
+      .Callbacks = { NULL_PTR, 0u },
+      .Receive = &IocTest_Receive[0].Ioc,
+      .MultiReceive = NULL_PTR,
+      .ReadyBit = 0u
+    },
+    .FifoWrite = { &IocTest_SendDyn[0].FifoWrite, &IocTest_ReceiveDyn[0].FifoRead, IocTest_Fifo[0], IOCTEST_FIFO_SIZE }
+  },
+  {
+    .Ioc =
+    {
+      .Base =
+      {
+        .Spinlock = NULL_PTR,
+        .LockMode = OS_IOCLOCKMODE_NONE,
+        .Dyn = &IocTest_SendDyn[1].Ioc.Base,
+        .SubClass = Ioc32Send,
+        .AccessingApplications = (Os_AppAccessMaskType)(1uL << HostApp_Core2)
+      },
+      .Callbacks = { NULL_PTR, 0u },
+      .Receive = &IocTest_Receive[1].Ioc,
+      .MultiReceive = NULL_PTR,
+      .ReadyBit = 0u
+    },
+    .FifoWrite = { &IocTest_SendDyn[1].FifoWrite, &IocTest_ReceiveDyn[1].FifoRead, IocTest_Fifo[1], IOCTEST_FIFO_SIZE }
+  }
+};
+
+/*! Receiver of the channels. */
+static const Os_Ioc32ReceiveConfigType IocTest_Receive[IOCTEST_CHANNELS] =
+{
+  {
+    .Ioc =
+    {
+      .Base =
+      {
+        .Spinlock = NULL_PTR,
+        .LockMode = OS_IOCLOCKMODE_LOCKFREE,
+        .Dyn = &IocTest_ReceiveDyn[0].Ioc.Base,
+        .SubClass = Ioc32Receive,
+        .AccessingApplications = (Os_AppAccessMaskType)(1uL << HostApp_Core1)
+      },
+      .Send = &IocTest_Send[0].Ioc
+    },
+    .FifoRead = { &IocTest_ReceiveDyn[0].FifoRead, &IocTest_SendDyn[0].FifoWrite, IocTest_Fifo[0], IOCTEST_FIFO_SIZE }
+  },
+  {
+    .Ioc =
+    {
+      .Base =
+      {
+        .Spinlock = NULL_PTR,
+        .LockMode = OS_IOCLOCKMODE_NONE,
+        .Dyn = &IocTest_ReceiveDyn[1].Ioc.Base,
+        .SubClass = Ioc32Receive,
+        .AccessingApplications = (Os_AppAccessMaskType)(1uL << HostApp_Core2)
+      },
+      .Send = &IocTest_Send[1].Ioc
+    },
+    .FifoRead = { &IocTest_ReceiveDyn[1].FifoRead, &IocTest_SendDyn[1].FifoWrite, IocTest_Fifo[1], IOCTEST_FIFO_SIZE }
+  }
+};
+
+/**********************************************************************************************************************
+ *  LOCAL FUNCTIONS
+ *********************************************************************************************************************/
+
+/*! Sends the sequence 0 to IOCTEST_ELEMENTS - 1 over the lock-free channel. */
+static void IocTest_Sender(void)
+{
+  uint32 seed = 0x1B873593u;
+  uint32 next = 0u;
+  uint32 data[IOCTEST_BATCH];
+
+  while(next < IOCTEST_ELEMENTS)
+  {
+    Std_ReturnType status;
+    uint32 sent;
+    uint32 count = 1u + (HostTest_Random(&seed) % IOCTEST_BATCH);
+    uint32 index;
+
+    if(count > (IOCTEST_ELEMENTS - next))
+    {
+      count = IOCTEST_ELEMENTS - next;
+    }
+
+    /* Use the single element call for one element, so that both paths feed the same FIFO. */
+    if(count == 1u)
+    {
+      status = Os_Ioc32Send(&IocTest_Send[IOCTEST_CHANNEL_SPSC], next);
+      sent = (status == IOC_E_OK) ? 1u : 0u;
+    }
+    else
+    {
+      for(index = 0u; index < count; index++)
+      {
+        data[index] = next + index;
+      }
+
+      sent = 0xFFFFFFFFu;
+      status = Os_Ioc32SendN(&IocTest_Send[IOCTEST_CHANNEL_SPSC], data, count, &sent);
+    }
+
+    HOSTTEST_CHECK((status == IOC_E_OK) || (status == IOC_E_LIMIT));
+    HOSTTEST_CHECK((status == IOC_E_OK) ? (sent == count) : (sent < count));
+
+    next += sent;
+
+    if(status == IOC_E_LIMIT)
+    {
+      /* The FIFO is full. The elements which have not been sent, are sent again. */
+      Os_Hal_CoreNop();
+    }
+  }
+}
+
+
+/*! Receives the sequence from the lock-free channel and checks that it is complete and in order. */
+static void IocTest_Receiver(void)
+{
+  uint32 seed = 0x85EBCA6Bu;
+  uint32 expected = 0u;
+  uint32 data[IOCTEST_BATCH];
+
+  while(expected < IOCTEST_ELEMENTS)
+  {
+    Std_ReturnType status;
+    uint32 received;
+    uint32 count = 1u + (HostTest_Random(&seed) % IOCTEST_BATCH);
+    uint32 index;
+
+    if(count == 1u)
+    {
+      status = Os_Ioc32Receive(&IocTest_Receive[IOCTEST_CHANNEL_SPSC], &data[0]);
+      received = (status == IOC_E_NO_DATA) ? 0u : 1u;
+    }
+    else
+    {
+      received = 0xFFFFFFFFu;
+      status = Os_Ioc32ReceiveN(&IocTest_Receive[IOCTEST_CHANNEL_SPSC], data, count, &received);
+    }
+
+    HOSTTEST_CHECK((status == IOC_E_OK) || (status == IOC_E_LOST_DATA) || (status == IOC_E_NO_DATA));
+    HOSTTEST_CHECK((status == IOC_E_NO_DATA) ? (received == 0u) : ((received > 0u) && (received <= count)));
+
+    for(index = 0u; index < received; index++)
+    {
+      HOSTTEST_CHECK(data[index] == expected);
+      expected++;
+    }
+
+    if(status == IOC_E_NO_DATA)
+    {
+      Os_Hal_CoreNop();
+    }
+  }
+
+  /* The sender has stopped, so the channel stays empty. */
+  HOSTTEST_CHECK(Os_Ioc32Receive(&IocTest_Receive[IOCTEST_CHANNEL_SPSC], &data[0]) == IOC_E_NO_DATA);
+}
+
+
+/*! Checks the results of the multi element calls on a channel, which is used by a single core only. */
+static void IocTest_Local(void)
+{
+  const uint32 capacity = IOCTEST_FIFO_SIZE - 1u;
+  uint32 data[IOCTEST_BATCH];
+  uint32 count;
+  uint32 index;
+
+  /* #10 Receiving from an empty channel reports no data. */
+  count = 0xFFFFFFFFu;
+  HOSTTEST_CHECK(Os_Ioc32ReceiveN(&IocTest_Receive[IOCTEST_CHANNEL_LOCAL], data, 4u, &count) == IOC_E_NO_DATA);
+  HOSTTEST_CHECK(count == 0u);
+
+  /* #20 Sending more elements than the FIFO holds sends the first ones and reports the overflow. */
+  for(index = 0u; index < IOCTEST_BATCH; index++)
+  {
+    data[index] = 100u + index;
+  }
+  count = 0xFFFFFFFFu;
+  HOSTTEST_CHECK(Os_Ioc32SendN(&IocTest_Send[IOCTEST_CHANNEL_LOCAL], data, IOCTEST_BATCH, &count) == IOC_E_LIMIT);
+  HOSTTEST_CHECK(count == capacity);
+
+  /* #30 Sending to a full channel sends nothing. Sending no element succeeds. */
+  HOSTTEST_CHECK(Os_Ioc32SendN(&IocTest_Send[IOCTEST_CHANNEL_LOCAL], data, 1u, &count) == IOC_E_LIMIT);
+  HOSTTEST_CHECK(count == 0u);
+  HOSTTEST_CHECK(Os_Ioc32SendN(&IocTest_Send[IOCTEST_CHANNEL_LOCAL], data, 0u, &count) == IOC_E_OK);
+  HOSTTEST_CHECK(count == 0u);
+
+  /* #40 The first receive reports the data loss once, the following one does not. */
+  count = 0xFFFFFFFFu;
+  HOSTTEST_CHECK(Os_Ioc32ReceiveN(&IocTest_Receive[IOCTEST_CHANNEL_LOCAL], data, 3u, &count) == IOC_E_LOST_DATA);
+  HOSTTEST_CHECK(count == 3u);
+  HOSTTEST_CHECK((data[0] == 100u) && (data[1] == 101u) && (data[2] == 102u));
+
+  count = 0xFFFFFFFFu;
+  HOSTTEST_CHECK(Os_Ioc32ReceiveN(&IocTest_Receive[IOCTEST_CHANNEL_LOCAL], data, IOCTEST_BATCH, &count) == IOC_E_OK);
+  HOSTTEST_CHECK(count == (capacity - 3u));
+  for(index = 0u; index < count; index++)
+  {
+    HOSTTEST_CHECK(data[index] == (103u + index));
+  }
+
+  /* #50 Receiving no element reports no data. */
+  HOSTTEST_CHECK(Os_Ioc32Send(&IocTest_Send[IOCTEST_CHANNEL_LOCAL], 7u) == IOC_E_OK);
+  HOSTTEST_CHECK(Os_Ioc32ReceiveN(&IocTest_Receive[IOCTEST_CHANNEL_LOCAL], data, 0u, &count) == IOC_E_NO_DATA);
+  HOSTTEST_CHECK(count == 0u);
+  HOSTTEST_CHECK(Os_Ioc32ReceiveN(&IocTest_Receive[IOCTEST_CHANNEL_LOCAL], data, 2u, &count) == IOC_E_OK);
+  HOSTTEST_CHECK((count == 1u) && (data[0] == 7u));
+
+  /* #60 The channels of other applications are rejected without any transfer. */
+  count = 0xFFFFFFFFu;
+  HOSTTEST_CHECK(Os_Ioc32SendN(&IocTest_Send[IOCTEST_CHANNEL_SPSC], data, 2u, &count) == IOC_E_NOK);
+  HOSTTEST_CHECK(count == 0u);
+  count = 0xFFFFFFFFu;
+  HOSTTEST_CHECK(Os_Ioc32ReceiveN(&IocTest_Receive[IOCTEST_CHANNEL_SPSC], data, 2u, &count) == IOC_E_NOK);
+  HOSTTEST_CHECK(count == 0u);
+}
+
+
+/*! Test function of all cores. */
+static void IocTest_Main(uint32 CoreId)
+{
+  switch(CoreId)
+  {
+    case 0u:
+      IocTest_Sender();
+      break;
+    case 1u:
+      IocTest_Receiver();
+      break;
+    default:
+      IocTest_Local();
+      break;
+  }
+}
+
+/**********************************************************************************************************************
+ *  GLOBAL FUNCTIONS
+ *********************************************************************************************************************/
+
+int main(void)
+{
+  uint32 channel;
+
+  for(channel = 0u; channel < IOCTEST_CHANNELS; channel++)
+  {
+    Os_IocInit(&IocTest_Send[channel].Ioc.Base);
+    Os_IocInit(&IocTest_Receive[channel].Ioc.Base);
+  }
+
+  HostTest_RunCores(3u, IocTest_Main);
+  return 0;
+}
@@ -0,0 +1,306 @@
+/**********************************************************************************************************************
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  \file   SpinlockTest.c
+ *  \brief  Fairness and mutual exclusion test of the ticket and the MCS spinlock.
+ *  \details
+ *  The test runs for each queue based algorithm:
+ *  - Fairness: Core 0 holds the spinlock and lets the cores 1 to 3 request it in a random order. It waits until each
+ *    requester is enqueued, before it lets the next one request. After core 0 has released the spinlock, the
+ *    requesters have to be granted in the order of their requests.
+ *  - Mutual exclusion: All cores increment a shared counter within the spinlock. The increments yield in between,
+ *    so that lost updates show up in the final counter value.
+ *  Finally the statistics of each core have to count all grants of the core.
+ *********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include "HostTest.h"
+
+#include "Os_Spinlock.h"
+#include "Os_Hal_Core.h"
+
+/**********************************************************************************************************************
+ *  LOCAL CONSTANT MACROS
+ *********************************************************************************************************************/
+/*! Number of emulated cores. */
+#define SPINLOCKTEST_CORES            (4u)
+
+/*! Number of requesters in a fairness round. */
+#define SPINLOCKTEST_REQUESTERS       (SPINLOCKTEST_CORES - 1u)
+
+/*! Number of tested spinlocks. */
+#define SPINLOCKTEST_SPINLOCKS        (2u)
+
+/*! Number of fairness rounds per spinlock. */
+#define SPINLOCKTEST_ROUNDS           (500uL)
+
+/*! Number of increments per core and spinlock. */
+#define SPINLOCKTEST_INCREMENTS       (5000uL)
+
+/**********************************************************************************************************************
+ *  LOCAL DATA
+ *********************************************************************************************************************/
+/*! Runtime data, MCS nodes and statistics records of the spinlocks. */
+static Os_SpinlockType SpinlockTest_Dyn[SPINLOCKTEST_SPINLOCKS];
+static Os_SpinlockMcsNodeType SpinlockTest_McsNodes[OS_COREID_COUNT];
+static Os_SpinlockStatisticsRecordType SpinlockTest_Statistics[SPINLOCKTEST_SPINLOCKS][OS_COREID_COUNT];
+
+/*! Timer of the statistics. */
+static const Os_Hal_TimerFrtConfigType SpinlockTest_Timer =
+{
+  .Channel = 0u,
+  .InterruptSource = 0u,
+  .ReloadValue = 0u
+};
+
+/*! The tested spinlocks. */
+#define SPINLOCKTEST_SPINLOCK(Index, SpinlockAlgorithm, Nodes)                                                         \
+  {                                                                                                                     \
+    .Lock =                                                                                                             \
+    {                                                                                                                   \
+      .Dyn = OS_SPINLOCK_CASTDYN_SPINLOCK_2_LOCK(SpinlockTest_Dyn[(Index)]),                                            \
+      .AccessingApplications = (Os_AppAccessMaskType)0xFu,                                                              \
+      .Type = OS_LOCKTYPE_SPINLOCK                                                                                      \
+    },                                                                                                                  \
+    .Method = OS_SPINLOCKMETHOD_NOTHING,                                                                                \
+    .CeilingPriority = 0u,                                                                                              \
+    .Mode = OS_SPINLOCKMODE_SUPERVISOR,                                                                                 \
+    .Trace = OS_SPINLOCKTRACE_DISABLED,                                                                                 \
+    .Checks = OS_SPINLOCKCHECK_DISABLED,                                                                                \
+    .Order = 0u,                                                                                                        \
+    .TimingHookTrace = NULL_PTR,                                                                                        \
+    .Algorithm = (SpinlockAlgorithm),                                                                                   \
+    .McsNodes = (Nodes),                                                                                                \
+    .Statistics = SpinlockTest_Statistics[(Index)],                                                                     \
+    .StatisticsTimer = &SpinlockTest_Timer                                                                              \
+  }
+
+static const Os_SpinlockConfigType SpinlockTest_Spinlocks[SPINLOCKTEST_SPINLOCKS] =
+{
+  SPINLOCKTEST_SPINLOCK(0u, OS_SPINLOCKALGORITHM_TICKET, NULL_PTR),
+  SPINLOCKTEST_SPINLOCK(1u, OS_SPINLOCKALGORITHM_MCS, SpinlockTest_McsNodes)
+};
+
+/*! The current fairness round and the requester, which may request the spinlock (0: none). */
+static volatile uint32 SpinlockTest_Round;
+static volatile uint32 SpinlockTest_Turn;
+
+/*! Requesters in the order of their grants. Written within the spinlock. */
+static volatile uint32 SpinlockTest_Granted;
+static uint32 SpinlockTest_Grants[SPINLOCKTEST_REQUESTERS];
+
+/*! The shared counter and whether a core is within the spinlock. Written within the spinlock. */
+static volatile uint32 SpinlockTest_Counter;
+static volatile uint32 SpinlockTest_Inside;
+
+/*! Synchronization of all cores. */
+static volatile uint32 SpinlockTest_Arrived;
+static volatile uint32 SpinlockTest_Generation;
+
+/*! Random sequence of each core. */
+static uint32 SpinlockTest_Seed[OS_COREID_COUNT];
+
+/**********************************************************************************************************************
+ *  LOCAL FUNCTIONS
+ *********************************************************************************************************************/
+
+/*! Waits until all cores have arrived. */
+static void SpinlockTest_Sync(void)
+{
+  uint32 generation = __atomic_load_n(&SpinlockTest_Generation, __ATOMIC_SEQ_CST);
+
+  if(__atomic_add_fetch(&SpinlockTest_Arrived, 1u, __ATOMIC_SEQ_CST) == SPINLOCKTEST_CORES)
+  {
+    __atomic_store_n(&SpinlockTest_Arrived, 0u, __ATOMIC_SEQ_CST);
+    __atomic_store_n(&SpinlockTest_Generation, generation + 1u, __ATOMIC_SEQ_CST);
+  }
+  else
+  {
+    while(__atomic_load_n(&SpinlockTest_Generation, __ATOMIC_SEQ_CST) == generation)
+    {
+      Os_Hal_CoreNop();
+    }
+  }
+}
+
+
+/*! Returns whether the given requester waits for the spinlock as the Waiters-th waiter behind the holder. */
+static uint32 SpinlockTest_IsEnqueued(const Os_SpinlockConfigType* Spinlock, uint32 Requester, uint32 Waiters)
+{
+  const Os_SpinlockType* spinlockDyn = Os_SpinlockGetDyn(Spinlock);
+  uint32 result;
+
+  if(Spinlock->Algorithm == OS_SPINLOCKALGORITHM_TICKET)
+  {
+    result = (uint32)((spinlockDyn->TicketNext - spinlockDyn->TicketServing) == (Waiters + 1u));
+  }
+  else
+  {
+    result = (uint32)(spinlockDyn->McsTail == (Requester + 1u));
+  }
+
+  return result;
+}
+
+
+/*! Core 0 holds the spinlock, lets the requesters enqueue in a random order and checks the order of the grants. */
+static void SpinlockTest_FairnessHolder(const Os_SpinlockConfigType* Spinlock)
+{
+  uint32 order[SPINLOCKTEST_REQUESTERS];
+  uint32 round;
+  uint32 index;
+
+  for(round = 1u; round <= SPINLOCKTEST_ROUNDS; round++)
+  {
+    /* #10 Shuffle the requesters. */
+    for(index = 0u; index < SPINLOCKTEST_REQUESTERS; index++)
+    {
+      order[index] = index + 1u;
+    }
+    for(index = SPINLOCKTEST_REQUESTERS - 1u; index > 0u; index--)
+    {
+      uint32 other = HostTest_Random(&SpinlockTest_Seed[0]) % (index + 1u);
+      uint32 requester = order[index];
+
+      order[index] = order[other];
+      order[other] = requester;
+    }
+
+    /* #20 Take the spinlock and let one requester after another enqueue. */
+    Os_SpinlockInternalGet(Spinlock);
+    SpinlockTest_Granted = 0u;
+    SpinlockTest_Round = round;
+
+    for(index = 0u; index < SPINLOCKTEST_REQUESTERS; index++)
+    {
+      SpinlockTest_Turn = order[index];
+
+      while(SpinlockTest_IsEnqueued(Spinlock, order[index], index + 1u) == 0u)
+      {
+        Os_Hal_CoreNop();
+      }
+    }
+
+    SpinlockTest_Turn = 0u;
+    Os_SpinlockInternalRelease(Spinlock);
+
+    /* #30 The requesters are granted in the order of their requests. */
+    while(SpinlockTest_Granted != SPINLOCKTEST_REQUESTERS)
+    {
+      Os_Hal_CoreNop();
+    }
+
+    for(index = 0u; index < SPINLOCKTEST_REQUESTERS; index++)
+    {
+      HOSTTEST_CHECK(SpinlockTest_Grants[index] == order[index]);
+    }
+  }
+}
+
+
+/*! Requests the spinlock once per round, when it is the turn of the core. */
+static void SpinlockTest_FairnessRequester(const Os_SpinlockConfigType* Spinlock, uint32 CoreId)
+{
+  uint32 round;
+
+  for(round = 1u; round <= SPINLOCKTEST_ROUNDS; round++)
+  {
+    while((SpinlockTest_Turn != CoreId) || (SpinlockTest_Round != round))
+    {
+      Os_Hal_CoreNop();
+    }
+
+    Os_SpinlockInternalGet(Spinlock);
+    SpinlockTest_Grants[SpinlockTest_Granted] = CoreId;
+    SpinlockTest_Granted = SpinlockTest_Granted + 1u;
+    Os_SpinlockInternalRelease(Spinlock);
+  }
+}
+
+
+/*! Increments the shared counter within the spinlock. */
+static void SpinlockTest_Exclusion(const Os_SpinlockConfigType* Spinlock, uint32 CoreId)
+{
+  uint32 increment;
+
+  for(increment = 0u; increment < SPINLOCKTEST_INCREMENTS; increment++)
+  {
+    uint32 counter;
+
+    Os_SpinlockInternalGet(Spinlock);
+    HOSTTEST_CHECK(SpinlockTest_Inside == 0u);
+    SpinlockTest_Inside = 1u;
+
+    counter = SpinlockTest_Counter;
+    if((HostTest_Random(&SpinlockTest_Seed[CoreId]) % 4u) == 0u)
+    {
+      Os_Hal_CoreNop();
+    }
+    SpinlockTest_Counter = counter + 1u;
+
+    SpinlockTest_Inside = 0u;
+    Os_SpinlockInternalRelease(Spinlock);
+  }
+}
+
+
+/*! Test function of all cores. */
+static void SpinlockTest_Main(uint32 CoreId)
+{
+  uint32 spinlock;
+
+  SpinlockTest_Seed[CoreId] = 0x9E3779B9u + CoreId;
+
+  for(spinlock = 0u; spinlock < SPINLOCKTEST_SPINLOCKS; spinlock++)
+  {
+    const Os_SpinlockConfigType* config = &SpinlockTest_Spinlocks[spinlock];
+
+    if(CoreId == 0u)
+    {
+      SpinlockTest_FairnessHolder(config);
+    }
+    else
+    {
+      SpinlockTest_FairnessRequester(config, CoreId);
+    }
+
+    SpinlockTest_Sync();
+    SpinlockTest_Exclusion(config, CoreId);
+    SpinlockTest_Sync();
+
+    /* #10 No increment got lost and the statistics count all grants of this core. */
+    HOSTTEST_CHECK(SpinlockTest_Counter == (SPINLOCKTEST_CORES * SPINLOCKTEST_INCREMENTS));
+    HOSTTEST_CHECK(SpinlockTest_Statistics[spinlock][CoreId].Statistics.AcquisitionCount ==
+                   (SPINLOCKTEST_ROUNDS + SPINLOCKTEST_INCREMENTS));
+    if(CoreId != 0u)
+    {
+      HOSTTEST_CHECK(SpinlockTest_Statistics[spinlock][CoreId].Statistics.ContendedCount >= SPINLOCKTEST_ROUNDS);
+    }
+
+    SpinlockTest_Sync();
+    if(CoreId == 0u)
+    {
+      SpinlockTest_Counter = 0u;
+    }
+    SpinlockTest_Sync();
+  }
+}
+
+/**********************************************************************************************************************
+ *  GLOBAL FUNCTIONS
+ *********************************************************************************************************************/
+
+int main(void)
+{
+  uint32 spinlock;
+
+  for(spinlock = 0u; spinlock < SPINLOCKTEST_SPINLOCKS; spinlock++)
+  {
+    Os_SpinlockInit(&SpinlockTest_Spinlocks[spinlock]);
+  }
+
+  HostTest_RunCores(SPINLOCKTEST_CORES, SpinlockTest_Main);
+  return 0;
+}